@@ -20,6 +20,7 @@
 // Implementation
 
 #include "AACAudioEncoder.hh"
+#include "AudioEncodingQueue.hh"
 extern "C" {
 #include "AACEncoder/faac.h"
 }
@@ -37,26 +38,26 @@ AACAudioEncoder* AACAudioEncoder
 AACAudioEncoder
 ::AACAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource,
 		  unsigned numChannels, unsigned samplingRate, unsigned outputKbps)
-  : FramedFilter(env, inputPCMSource) {
+  : FramedFilter(env, inputPCMSource), fNumChannels(numChannels),
+    fPendingOutputKbps(0) {
+  // (The AAC library is reentrant, so each encoder may run on its own thread.)
   fEncoderState = faacEncOpen(samplingRate, numChannels,
 			      &fNumSamplesPerFrame, &fMaxEncodedFrameSize);
 
   // Note: "fNumSamplesPerFrame" is already multiplied by "numChannels"
   fMicrosecondsPerFrame = (MILLION*fNumSamplesPerFrame)/(numChannels*samplingRate);
-  fMicrosecondsPerByte
+  double microsecondsPerByte
     = (1.0*MILLION)/(samplingRate*numChannels*sizeof (unsigned short));
-  fInputSampleBufferBytesDesired = fNumSamplesPerFrame*sizeof (unsigned short);
-  fInputSampleBufferSize = 10*fInputSampleBufferBytesDesired;
-  fInputSampleBuffer = new unsigned char[fInputSampleBufferSize];
-  fInputSampleBufferBytesFull = 0;
-
-  fLastInputDataPresentationTime.tv_sec = 0;
-  fLastInputDataPresentationTime.tv_usec = 0;
+  fEncodingQueue
+    = new AudioEncodingQueue(env, inputPCMSource,
+			     fNumSamplesPerFrame*sizeof (unsigned short),
+			     microsecondsPerByte, 1/*overlap*/, fMaxEncodedFrameSize,
+			     encodeFrame, this);
 
   // Set remaining parameters of the encoder:
   faacEncConfiguration* config = faacEncGetCurrentConfiguration(fEncoderState);
   config->mpegVersion = MPEG4;
-  config->bitRate = outputKbps/numChannels; // parameter is bit rate per channel
+  config->bitRate = outputKbps*1000/numChannels; // parameter is bps per channel
   config->bandWidth = 16000; // as specified in "FAAC.bitrate.README"
   config->quantqual = 200; // as specified in "FAAC.bitrate.README"
   config->outputFormat = 0; // Raw
@@ -64,83 +65,61 @@ AACAudioEncoder
   faacEncSetConfiguration(fEncoderState, config);
 }
 
+void AACAudioEncoder::setOutputKbps(unsigned outputKbps) {
+  // A worker thread may be encoding a frame now, so the encoder gets
+  // reconfigured (by "encodeFrame1()") before it encodes the next one:
+  if (outputKbps == 0) return;
+  __sync_lock_test_and_set(&fPendingOutputKbps, outputKbps);
+}
+
 AACAudioEncoder::~AACAudioEncoder() {
+  delete fEncodingQueue; // first, because it may be using the encoder
   faacEncClose(fEncoderState);
-  delete[] fInputSampleBuffer;
 }
 
 void AACAudioEncoder::doGetNextFrame() {
-  // If we have enough samples in order to encode a frame, do this now:
-  if (fInputSampleBufferBytesFull >= fInputSampleBufferBytesDesired*2) {
-    // Note: The "*2" is because of the faacEncEncoder() 'overlap' bullshit
-    if (fMaxSize < fMaxEncodedFrameSize) {
-      // Our sink hasn't given us enough space for a frame.  We can't encode.
-      fFrameSize = 0;
-      fNumTruncatedBytes = fMaxEncodedFrameSize;
-    } else {
-      fFrameSize = faacEncEncode(fEncoderState,
-				 (int16_t*)(&fInputSampleBuffer[fInputSampleBufferBytesDesired]),
-				 (int16_t*)fInputSampleBuffer, // overlapBuffer
-				 fNumSamplesPerFrame, fTo, fMaxSize);
-      fNumTruncatedBytes = 0;
-
-      // Shift the data that we just encoded, plus any remaining samples,
-      // down the the start of the buffer.  (The data that we just encoded will be the overlap
-      // buffer for the next encoding.)
-      fInputSampleBufferBytesFull -= fInputSampleBufferBytesDesired;
-      memmove(fInputSampleBuffer,
-	      &fInputSampleBuffer[fInputSampleBufferBytesDesired],
-	      fInputSampleBufferBytesFull);
-    }
+  // Deliver our next encoded frame, once it's ready:
+  fEncodingQueue->getNextEncodedFrame(afterEncoding, this,
+				      FramedSource::handleClosure, this);
+}
 
-    // Complete delivery to the client:
-    fPresentationTime = fLastInputDataPresentationTime;
-    //fDurationInMicroseconds = fMicrosecondsPerFrame;
-    fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
-    afterGetting(this);
-  } else {
-    // Read more samples from our source, then try again:
-    unsigned maxBytesToRead
-      = fInputSampleBufferSize - fInputSampleBufferBytesFull;
-    fInputSource
-      ->getNextFrame(&fInputSampleBuffer[fInputSampleBufferBytesFull],
-		     maxBytesToRead,
-		     afterGettingFrame, this,
-		     FramedSource::handleClosure, this);
-  }
+void AACAudioEncoder::doStopGettingFrames() {
+  fEncodingQueue->stopGettingFrames();
 }
 
-void AACAudioEncoder
-::afterGettingFrame(void* clientData, unsigned frameSize,
-                    unsigned numTruncatedBytes,
-                    struct timeval presentationTime,
-                    unsigned durationInMicroseconds) {
+void AACAudioEncoder::afterEncoding(void* clientData) {
   AACAudioEncoder* source = (AACAudioEncoder*)clientData;
-  source->afterGettingFrame1(frameSize, numTruncatedBytes,
-                             presentationTime, durationInMicroseconds);
+  source->fEncodingQueue->deliverFrame(source->fTo, source->fMaxSize,
+				       source->fFrameSize, source->fNumTruncatedBytes,
+				       source->fPresentationTime);
+      // The frame's presentation time is that of its overlap (the start of
+      // the data that it was encoded from)
+
+  // Complete delivery to the client:
+  //source->fDurationInMicroseconds = source->fMicrosecondsPerFrame;
+  source->fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
+  afterGetting(source);
 }
 
-void AACAudioEncoder
-::afterGettingFrame1(unsigned frameSize, unsigned numTruncatedBytes,
-                     struct timeval presentationTime, unsigned durationInMicroseconds) {
-  // Adjust presentationTime to allow for the data that's still in our buffer:
-  int uSecondsAdjustment = (int)(fInputSampleBufferBytesFull*fMicrosecondsPerByte);
-  presentationTime.tv_sec -= uSecondsAdjustment/MILLION;
-  uSecondsAdjustment %= MILLION;
-  if (presentationTime.tv_usec < uSecondsAdjustment) {
-    --presentationTime.tv_sec;
-    presentationTime.tv_usec += MILLION;
-  }
-  presentationTime.tv_usec -= uSecondsAdjustment;
+unsigned AACAudioEncoder
+::encodeFrame(void* encoderData, unsigned char* overlap, unsigned char* frame,
+	      unsigned char* to, unsigned maxSize) {
+  return ((AACAudioEncoder*)encoderData)->encodeFrame1(overlap, frame, to, maxSize);
+}
 
-  // Don't allow the presentation time to decrease:
-  if (presentationTime.tv_sec > fLastInputDataPresentationTime.tv_sec ||
-      (presentationTime.tv_sec == fLastInputDataPresentationTime.tv_sec &&
-       presentationTime.tv_usec > fLastInputDataPresentationTime.tv_usec)) {
-    fLastInputDataPresentationTime = presentationTime;
+unsigned AACAudioEncoder
+::encodeFrame1(unsigned char* overlap, unsigned char* frame,
+	       unsigned char* to, unsigned maxSize) {
+  // (Note that we may be called from a worker thread.)
+  unsigned outputKbps = __sync_lock_test_and_set(&fPendingOutputKbps, 0);
+  if (outputKbps != 0) {
+    faacEncConfiguration* config = faacEncGetCurrentConfiguration(fEncoderState);
+    config->bitRate = outputKbps*1000/fNumChannels; // parameter is bps per channel
+    faacEncSetConfiguration(fEncoderState, config);
   }
-  fInputSampleBufferBytesFull += frameSize;  
 
-  // Try again to encode and deliver data to the sink:
-  doGetNextFrame();
+  // faacEncEncode() also needs the frame before - the 'overlap':
+  int frameSize = faacEncEncode(fEncoderState, (int16_t*)frame, (int16_t*)overlap,
+				fNumSamplesPerFrame, to, maxSize);
+  return frameSize < 0 ? 0 : (unsigned)frameSize;
 }
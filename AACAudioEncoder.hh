@@ -24,6 +24,8 @@
 
 #include "FramedFilter.hh"
 
+class AudioEncodingQueue;
+
 class AACAudioEncoder: public FramedFilter {
 public:
   static AACAudioEncoder* createNew(UsageEnvironment& env,
@@ -31,6 +33,8 @@ public:
 				    unsigned numChannels, unsigned samplingRate,
 				    unsigned outputKbps);
 
+  void setOutputKbps(unsigned outputKbps); // takes effect from the next frame
+
 protected:
   AACAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource,
 		  unsigned numChannels, unsigned samplingRate, unsigned outputKbps);
@@ -40,26 +44,23 @@ protected:
 private:
   // redefined virtual functions:
   virtual void doGetNextFrame();
+  virtual void doStopGettingFrames();
 
 private:
-  static void afterGettingFrame(void* clientData, unsigned frameSize,
-                                unsigned numTruncatedBytes,
-                                struct timeval presentationTime,
-                                unsigned durationInMicroseconds);
-  void afterGettingFrame1(unsigned frameSize,
-                          unsigned numTruncatedBytes,
-                          struct timeval presentationTime,
-                          unsigned durationInMicroseconds);
+  static void afterEncoding(void* clientData);
+  static unsigned encodeFrame(void* encoderData,
+			      unsigned char* overlap, unsigned char* frame,
+			      unsigned char* to, unsigned maxSize);
+  unsigned encodeFrame1(unsigned char* overlap, unsigned char* frame,
+			unsigned char* to, unsigned maxSize);
 
 private:
   void* fEncoderState;
+  unsigned fNumChannels;
   unsigned long fNumSamplesPerFrame, fMaxEncodedFrameSize;
   unsigned fMicrosecondsPerFrame;
-  double fMicrosecondsPerByte;
-  unsigned char* fInputSampleBuffer;
-  unsigned fInputSampleBufferSize;
-  unsigned fInputSampleBufferBytesDesired, fInputSampleBufferBytesFull;
-  struct timeval fLastInputDataPresentationTime;
+  unsigned fPendingOutputKbps; // if non-zero, to be set before the next frame is encoded
+  AudioEncodingQueue* fEncodingQueue; // each frame is preceded by the previous one ('overlap')
 };
 
 #endif
@@ -0,0 +1,189 @@
+/*
+ * FAAC - Freeware Advanced Audio Coder
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * Encoding speed benchmark.  "make bench" builds this once for each numeric
+ * backend (aacbench-fixed, and aacbench-float with FAAC_FLOAT), and runs both
+ * on the same PCM input: either a raw 16-bit native-endian file, or else a
+ * synthetic signal (two tones, a chirp and noise) that is the same every run.
+ *
+ * usage: aacbench [-simd level] [-o out.aac] samplingRate numChannels kbps numFrames [pcmFile]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "faac.h"
+#include "fixed.h"
+#include "coder.h"
+#include "simd.h"
+
+#define NUM_RUNS 5 /* we report the fastest */
+
+static void usage(char const *progName)
+{
+    fprintf(stderr, "usage: %s [-simd level] [-o out.aac] samplingRate numChannels kbps numFrames [pcmFile]\n",
+            progName);
+    exit(1);
+}
+
+static int16_t *makeInput(char const *fileName, unsigned long sampleRate,
+                          unsigned int numChannels, unsigned long numSamples)
+{
+    int16_t *pcm = (int16_t *)calloc(numSamples, sizeof(int16_t));
+    unsigned long i;
+    uint32_t seed = 12345;
+
+    if (fileName != NULL) {
+        FILE *fid = fopen(fileName, "rb");
+
+        if (fid == NULL) {
+            perror(fileName);
+            exit(1);
+        }
+        if (fread(pcm, sizeof(int16_t), numSamples, fid) < numSamples)
+            fprintf(stderr, "%s is short; padding it with silence\n", fileName);
+        fclose(fid);
+        return pcm;
+    }
+
+    for (i = 0; i < numSamples; i++) {
+        unsigned int ch = i%numChannels;
+        double t = (double)(i/numChannels)/sampleRate;
+        double x = 8000*sin(2*M_PI*(440 + 220*ch)*t) + 6000*sin(2*M_PI*3000*t*t);
+
+        seed = seed*1103515245 + 12345;
+        pcm[i] = (int16_t)(x + (int32_t)((seed>>16)%4000) - 2000);
+    }
+    return pcm;
+}
+
+static double cpuSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return now.tv_sec + now.tv_nsec/1e9;
+}
+
+int main(int argc, char **argv)
+{
+    char const *progName = argv[0];
+    char const *outFileName = NULL;
+    int32_t simdLevel = FAAC_SIMD_BEST;
+    unsigned long sampleRate, inputSamples, maxOutputBytes, numBytes = 0;
+    unsigned int numChannels, kbps;
+    int numFrames, frame, run;
+    int16_t *pcm;
+    unsigned char *outputBuffer;
+    double bestSeconds = 0;
+
+    while (argc > 1 && argv[1][0] == '-') {
+        if (strcmp(argv[1], "-simd") == 0 && argc > 2)
+            simdLevel = atoi(argv[2]);
+        else if (strcmp(argv[1], "-o") == 0 && argc > 2)
+            outFileName = argv[2];
+        else
+            usage(progName);
+        argc -= 2; argv += 2;
+    }
+    if (argc != 5 && argc != 6)
+        usage(progName);
+    sampleRate = atol(argv[1]);
+    numChannels = atoi(argv[2]);
+    kbps = atoi(argv[3]);
+    numFrames = atoi(argv[4]);
+    if (numChannels < 1 || numChannels > MAX_CHANNELS || numFrames < 1)
+        usage(progName);
+
+    simdLevel = faac_simd_setup(simdLevel); /* before faacEncOpen() does it */
+
+    /* (Each frame is encoded along with the one before it - its 'overlap') */
+    inputSamples = 1024*numChannels;
+    pcm = makeInput(argc == 6 ? argv[5] : NULL, sampleRate, numChannels,
+                    (numFrames+1)*inputSamples);
+
+    for (run = 0; run < NUM_RUNS; run++) {
+        faacEncHandle hEncoder = faacEncOpen(sampleRate, numChannels,
+                                             &inputSamples, &maxOutputBytes);
+        faacEncConfigurationPtr config;
+        FILE *out = NULL;
+        double start;
+
+        if (hEncoder == NULL) {
+            fprintf(stderr, "faacEncOpen() failed\n");
+            return 1;
+        }
+        /* as AACAudioEncoder sets it up: */
+        config = faacEncGetCurrentConfiguration(hEncoder);
+        config->mpegVersion = MPEG4;
+        config->bitRate = kbps*1000/numChannels;
+        config->bandWidth = 16000;
+        config->quantqual = 200;
+        config->outputFormat = 0;
+        config->inputFormat = FAAC_INPUT_16BIT;
+        if (!faacEncSetConfiguration(hEncoder, config)) {
+            fprintf(stderr, "faacEncSetConfiguration() failed\n");
+            return 1;
+        }
+        if (run == 0 && outFileName != NULL && (out = fopen(outFileName, "wb")) == NULL) {
+            perror(outFileName);
+            return 1;
+        }
+        outputBuffer = (unsigned char *)malloc(maxOutputBytes);
+
+        numBytes = 0;
+        start = cpuSeconds();
+        for (frame = 0; frame < numFrames; frame++) {
+            int frameBytes = faacEncEncode(hEncoder, pcm + (frame+1)*inputSamples,
+                                           pcm + frame*inputSamples, inputSamples,
+                                           outputBuffer, maxOutputBytes);
+            if (frameBytes > 0) {
+                numBytes += frameBytes;
+                if (out != NULL)
+                    fwrite(outputBuffer, 1, frameBytes, out);
+            }
+        }
+        start = cpuSeconds() - start;
+        if (run == 0 || start < bestSeconds)
+            bestSeconds = start;
+
+        if (out != NULL)
+            fclose(out);
+        free(outputBuffer);
+        faacEncClose(hEncoder);
+    }
+
+    printf("%s, SIMD level %d: %lu Hz, %u channel(s), %u kbps: %d frames in %.3f s"
+           " = %.0f frames/s (%.1fx realtime), %.1f us/frame, %lu bytes\n",
+#ifdef FAAC_FLOAT
+           "float",
+#else
+           "fixed",
+#endif
+           (int)simdLevel, sampleRate, numChannels, kbps, numFrames, bestSeconds,
+           numFrames/bestSeconds, numFrames/bestSeconds/(sampleRate/1024.0),
+           bestSeconds*1e6/numFrames, numBytes);
+
+    free(pcm);
+    return 0;
+}
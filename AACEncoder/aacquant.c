@@ -22,22 +22,159 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 
 #include "fixed.h"
 #include "frame.h"
 #include "aacquant.h"
 #include "coder.h"
 #include "huffman.h"
+#include "simd.h"
 #include "util.h"
 
-static void QuantizeBand(const coef_t *xp, int32_t *ix,
+#ifdef FAAC_FLOAT
+/* The floating-point versions of the functions below.  They follow the
+   fixed-point versions step by step; xmin is a plain float. */
+typedef float xmin_t;
+
+static void QuantizeBand(const coef_t *xp, const coef_t *xr, int32_t *ix,
                          int32_t offset, int32_t end)
 {
     register int32_t j;
-    static coef_t realconst1 = COEF_CONST(0.5);
+    int32_t q;
 
     for (j = offset; j < end; j++) {
-        ix[j] = (int32_t)COEF2INT(xp[j]+realconst1);
+        q = (int32_t)(xp[j]+0.5f);
+        ix[j] = (xr[j] < 0) ? -q : q;
+    }
+}
+
+static void CalcAllowedDist(CoderInfo *coderInfo, 
+                            pow_t *xr2, xmin_t *xmin, real_32_t quality)
+{
+    register int32_t sfb, start, end, l;
+    int32_t last = coderInfo->lastx;
+    int32_t lastsb = 0;
+    int32_t *cb_offset = coderInfo->sfb_offset;
+    int32_t num_cb = coderInfo->nr_of_sfb;
+    eng_t avgenrg = coderInfo->avgenrg;
+    float fquality = (float)REAL2FLOAT(quality);
+
+    for (sfb = 0; sfb < num_cb; sfb++)  {
+        if (last > cb_offset[sfb])
+            lastsb = sfb;
+    }
+
+    for (sfb = 0; sfb < num_cb; sfb++)  {
+        float thr, tmp;
+        eng_t enrg = 0;
+
+        start = cb_offset[sfb];
+        end = cb_offset[sfb + 1];
+
+        if (sfb > lastsb)  {
+            xmin[sfb] = 0;
+            continue;
+        }
+
+        if (coderInfo->block_type != ONLY_SHORT_WINDOW) {
+            eng_t enmax = -1;
+            int32_t lmax;
+
+            lmax = start;
+            for (l = start; l < end; l++) {
+                if (enmax < xr2[l]) {
+                    enmax = xr2[l];
+                    lmax = l;
+                }
+            }
+
+            start = lmax - 2;
+            end = lmax + 3;
+
+            if (start < 0)
+                start = 0;
+        
+            if (end > last)
+                end = last;
+        }
+
+        for (l = start; l < end; l++) {
+            enrg += xr2[l];
+        }
+
+        if ( (avgenrg == 0) || (enrg==0) )
+            thr = 0;
+        else {
+            thr = avgenrg*(end-start)/enrg;
+            thr = powf(thr, (lastsb ? (float)sfb/(lastsb*10) : 0.0f) - 0.4f);
+        }
+
+        tmp = (float)(last-start)/last;
+        tmp = tmp*tmp*tmp + 0.075f;
+
+        thr = 1.4f*thr + tmp;
+
+        xmin[sfb] = 147.84f/thr/fquality; /* 132 * 1.12 */
+    }
+}
+
+static int32_t FixNoise(CoderInfo *coderInfo,
+                        const coef_t *xr,
+                        coef_t *xr_pow,
+                        int32_t *xi,
+                        xmin_t *xmin)
+{
+    register int32_t i, sb;
+    int32_t start, end;
+    static const float log_ifqstep = 7.6943735514f; // 1.0 / log(ifqstep) 
+
+    for (sb = 0; sb < coderInfo->nr_of_sfb; sb++) {
+        eng_t eng = 0;
+        float maxfixstep = 1.0f;
+
+        start = coderInfo->sfb_offset[sb];
+        end = coderInfo->sfb_offset[sb+1];
+
+        if (start >= coderInfo->lastx) {
+            /* the rest of the spectrum is zero */
+            for (i = start; i < end; i++)
+                xi[i] = 0;
+        }
+        else {
+            for (  i=start; i< end; i++)
+                eng += xr_pow[i]*xr_pow[i];
+
+            if ( (eng != 0) && (xmin[sb]!=0) ) {
+                maxfixstep = sqrtf(eng/(end-start)*xmin[sb]*sqrtf(xmin[sb]));
+                if ( maxfixstep == 0 )
+                    maxfixstep = 1.0f;
+                else
+                    maxfixstep = 1.0f/maxfixstep;
+            }
+            for (i = start; i < end; i++)
+                xr_pow[i] *= maxfixstep;
+            QuantizeBand(xr_pow, xr, xi, start, end);
+        }
+        coderInfo->scale_factor[sb] = (int32_t)floorf(logf(maxfixstep)*log_ifqstep - 0.5f)+1;
+    }
+    
+    return 0;
+}
+#else
+typedef real_32_t xmin_t;
+
+/* quantizes xp[], giving the result the sign of xr[] */
+static void QuantizeBand(const coef_t *xp, const coef_t *xr, int32_t *ix,
+                         int32_t offset, int32_t end)
+{
+    register int32_t j;
+    int32_t q;
+    static const coef_t realconst1 = COEF_CONST(0.5);
+
+    for (j = offset; j < end; j++) {
+        q = (int32_t)COEF2INT(xp[j]+realconst1);
+        ix[j] = (xr[j] < 0) ? -q : q;
 #ifdef DUMP_XI
         printf("ix[%d] = %d\n",j,ix[j]);
 #endif
@@ -60,10 +197,10 @@ static void CalcAllowedDist(CoderInfo *coderInfo,
     int32_t *cb_offset = coderInfo->sfb_offset;
     int32_t num_cb = coderInfo->nr_of_sfb;
     eng_t avgenrg = coderInfo->avgenrg;
-    static real_32_t realconst1 = REAL_CONST(0.075);
-    static real_32_t realconst2 = REAL_CONST(1.4);
-    static real_32_t realconst3 = REAL_CONST(0.4);
-    static real_32_t realconst4 = REAL_CONST(147.84); /* 132 * 1.12 */
+    static const real_32_t realconst1 = REAL_CONST(0.075);
+    static const real_32_t realconst2 = REAL_CONST(1.4);
+    static const real_32_t realconst3 = REAL_CONST(0.4);
+    static const real_32_t realconst4 = REAL_CONST(147.84); /* 132 * 1.12 */
 
     for (sfb = 0; sfb < num_cb; sfb++)  {
         if (last > cb_offset[sfb])
@@ -134,56 +271,73 @@ static void CalcAllowedDist(CoderInfo *coderInfo,
 /* 
  * Parameter:
  *  coderInfo(IO)(O:coderInfo->scale_factor)
- *  xr(unused)
+ *  xr(I)
  *  xr_pow(IO)
  *  xi(O)
  *  xmin(I)
  */
 static int32_t FixNoise(CoderInfo *coderInfo,
+                        const coef_t *xr,
                         coef_t *xr_pow,
                         int32_t *xi,
                         real_32_t *xmin)
 {
     register int32_t i, sb;
     int32_t start, end;
-    static real_32_t log_ifqstep = REAL_CONST(7.6943735514); // 1.0 / log(ifqstep) 
-    static real_32_t realconst1 = REAL_CONST(0.6931471806); //log2
-    static real_32_t realconst2 = REAL_CONST(0.5);
+    static const real_32_t log_ifqstep = REAL_CONST(7.6943735514); // 1.0 / log(ifqstep) 
+    static const real_32_t realconst1 = REAL_CONST(0.6931471806); //log2
+    static const real_32_t realconst2 = REAL_CONST(0.5);
 
     for (sb = 0; sb < coderInfo->nr_of_sfb; sb++) {
         eng_t eng = 0;
-        frac_t maxfixstep;
+        frac_t maxfixstep = FRAC_ICONST(1);
 
         start = coderInfo->sfb_offset[sb];
         end = coderInfo->sfb_offset[sb+1];
 
-        for (  i=start; i< end; i++)
-            eng += (int64_t)(COEF2INT(xr_pow[i]))*COEF2INT(xr_pow[i]);
-
-        if ( (eng == 0) || (xmin[sb]==0) )
-            maxfixstep = FRAC_ICONST(1);
-        else {
-            maxfixstep = faac_sqrt(eng/(end-start)*
-                                   MUL_R(xmin[sb],faac_sqrt(xmin[sb]))
-                                  );
-            if ( maxfixstep == 0 )
-                maxfixstep = FRAC_ICONST(1);
-            else
-                maxfixstep = ((real_t)1<<(FRAC_BITS+REAL_BITS))/maxfixstep;
+        if (start >= coderInfo->lastx) {
+            /* the rest of the spectrum is zero (see CalcAvgEnrg()), so there
+               is nothing to quantize */
+            for (i = start; i < end; i++)
+                xi[i] = 0;
         }
+        else {
+            if (faac_simd_kernels.energy)
+                eng = faac_simd_kernels.energy(xr_pow+start, end-start);
+            else {
+                for (  i=start; i< end; i++)
+                    eng += (int64_t)(COEF2INT(xr_pow[i]))*COEF2INT(xr_pow[i]);
+            }
+
+            if ( (eng != 0) && (xmin[sb]!=0) ) {
+                maxfixstep = faac_sqrt(eng/(end-start)*
+                                       MUL_R(xmin[sb],faac_sqrt(xmin[sb]))
+                                      );
+                if ( maxfixstep == 0 )
+                    maxfixstep = FRAC_ICONST(1);
+                else
+                    maxfixstep = ((real_t)1<<(FRAC_BITS+REAL_BITS))/maxfixstep;
+            }
 #ifdef DUMP_MAXFIXSTEP
-        printf("sb = %d, maxfixstep = %.8f\n",sb, FRAC2FLOAT(maxfixstep));
+            printf("sb = %d, maxfixstep = %.8f\n",sb, FRAC2FLOAT(maxfixstep));
 #endif
-        for (i = start; i < end; i++) {
+            /* (the kernel takes a 32-bit step) */
+            if (faac_simd_kernels.quantize && (maxfixstep <= MAX_REAL32))
+                faac_simd_kernels.quantize(xi+start, xr_pow+start, xr+start,
+                                           (int32_t)maxfixstep, end-start);
+            else {
+                for (i = start; i < end; i++) {
 #ifdef DUMP_MAXFIXSTEP
-            printf("xr_pow[%d] = %.8f\t",i,COEF2FLOAT(xr_pow[i]));
+                    printf("xr_pow[%d] = %.8f\t",i,COEF2FLOAT(xr_pow[i]));
 #endif
-            xr_pow[i] = MUL_F(xr_pow[i],maxfixstep);
+                    xr_pow[i] = MUL_F(xr_pow[i],maxfixstep);
 #ifdef DUMP_MAXFIXSTEP
-            printf("xr_pow[%d]*fix = %.8f\n",i,COEF2FLOAT(xr_pow[i]));
+                    printf("xr_pow[%d]*fix = %.8f\n",i,COEF2FLOAT(xr_pow[i]));
 #endif
+                }
+                QuantizeBand(xr_pow, xr, xi, start, end);
+            }
         }
-        QuantizeBand(xr_pow, xi, start, end);
         coderInfo->scale_factor[sb] = (int32_t)REAL2INT(MUL_R(faac_log(maxfixstep)-FRAC2REAL_BIT*realconst1,
                                                      log_ifqstep) - realconst2)+1;
 
@@ -197,6 +351,32 @@ static int32_t FixNoise(CoderInfo *coderInfo,
 #endif
     return 0;
 }
+#endif /* FAAC_FLOAT */
+
+#ifdef FAAC_QUANT_STATS
+/* Adds the energy of xr[], and that of the difference between xr[] and what
+   a decoder reconstructs from xi[] and the scalefactors (2^(-sf/4)*xi^(4/3)),
+   to aacquantCfg's totals */
+static void AddQuantStats(CoderInfo *coderInfo, const coef_t *xr, const int32_t *xi,
+                          AACQuantCfg *aacquantCfg)
+{
+    int32_t sb, i;
+
+    for (sb = 0; sb < coderInfo->nr_of_sfb; sb++) {
+        double step = pow(2.0, -0.25*coderInfo->scale_factor[sb]);
+
+        for (i = coderInfo->sfb_offset[sb]; i < coderInfo->sfb_offset[sb+1]; i++) {
+            double x = COEF2FLOAT(xr[i]);
+            double y = pow(abs(xi[i]), 4.0/3)*step;
+
+            if (xi[i] < 0)
+                y = -y;
+            aacquantCfg->signalEnergy += x*x;
+            aacquantCfg->noiseEnergy += (x-y)*(x-y);
+        }
+    }
+}
+#endif
 
 void CalcAvgEnrg(CoderInfo *coderInfo, const coef_t *xr, const pow_t *xr2)
 {
@@ -206,7 +386,7 @@ void CalcAvgEnrg(CoderInfo *coderInfo, const coef_t *xr, const pow_t *xr2)
 
     end = coderInfo->sfb_offset[coderInfo->nr_of_sfb];
     for (l = 0; l < end; l++)  {
-        if (xr[l]!=COEF_ICONST(0)) {
+        if (xr[l]!=0) {
             last = l;
             totenrg += xr2[l];
         }
@@ -219,7 +399,7 @@ void CalcAvgEnrg(CoderInfo *coderInfo, const coef_t *xr, const pow_t *xr2)
 
 void AACQuantize(CoderInfo *coderInfo,
                     ChannelInfo *channelInfo,
-                    int32_t *cb_width,
+                    const int32_t *cb_width,
                     int32_t num_cb,
                     coef_t *xr,
                     pow_t *xr2,
@@ -227,7 +407,7 @@ void AACQuantize(CoderInfo *coderInfo,
 {
     register int32_t sb, i;
     coef_t xr_pow[FRAME_LEN];
-    real_32_t xmin[MAX_SCFAC_BANDS];
+    xmin_t xmin[MAX_SCFAC_BANDS];
     int32_t xi[FRAME_LEN];
     int32_t *scale_factor;
 
@@ -239,13 +419,20 @@ void AACQuantize(CoderInfo *coderInfo,
     for (sb = 0; sb < coderInfo->nr_of_sfb; sb++)
         scale_factor[sb] = 0;
 
-    /* Compute xr_pow */
-    for (i = 0; i < FRAME_LEN; i++) {
+    /* Compute xr_pow (which is zero above coderInfo->lastx) */
+#ifndef FAAC_FLOAT
+    if (faac_simd_kernels.pow34)
+        faac_simd_kernels.pow34(xr_pow, xr, coderInfo->lastx);
+    else
+#endif
+    for (i = 0; i < coderInfo->lastx; i++) {
         xr_pow[i] = faac_pow34(xr[i]);
 #ifdef DUMP_XR_POW
         printf("xr_pow[%d] = %.8f\n",i,COEF2FLOAT(xr_pow[i]));
 #endif
     }
+    for (i = coderInfo->lastx; i < FRAME_LEN; i++)
+        xr_pow[i] = 0;
 #ifdef DUMP_XR_POW
 //    exit(1);
 #endif
@@ -253,14 +440,13 @@ void AACQuantize(CoderInfo *coderInfo,
     CalcAllowedDist(coderInfo, xr2, xmin, aacquantCfg->quality);
     coderInfo->global_gain = 0;
     
-    FixNoise(coderInfo, xr_pow, xi, xmin);
-   
-    for ( i = 0; i < FRAME_LEN; i++ )  {
-        if ( xr[i] < 0 )
-            xi[i] = -xi[i];
-    }
+    /* (this also gives xi[] the signs of xr[]) */
+    FixNoise(coderInfo, xr, xr_pow, xi, xmin);
 
     BitSearch(coderInfo, xi);
+#ifdef FAAC_QUANT_STATS
+    AddQuantStats(coderInfo, xr, xi, aacquantCfg);
+#endif
 
     /* offset the difference of common_scalefac and scalefactors by SF_OFFSET  */
     for (i = 0; i < coderInfo->nr_of_sfb; i++) {
@@ -36,12 +36,18 @@ extern "C" {
 typedef struct
   {
     real_32_t quality;
+#ifdef FAAC_QUANT_STATS
+    /* (for aacsnr.c) the energy of the spectrum that has been quantized, and
+       of the noise in a decoder's reconstruction of it */
+    double signalEnergy;
+    double noiseEnergy;
+#endif
   } AACQuantCfg;
 #pragma pack(pop)
 
 void AACQuantize(CoderInfo *coderInfo,
                     ChannelInfo *channelInfo,
-                    int32_t *cb_width,
+                    const int32_t *cb_width,
                     int32_t num_cb,
                     coef_t *xr,
                     pow_t *xr2,
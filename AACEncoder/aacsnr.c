@@ -0,0 +1,234 @@
+/*
+ * FAAC - Freeware Advanced Audio Coder
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * Bit-count/SNR comparison harness for changes to the quantizer.  "make aacsnr"
+ * builds this with FAAC_QUANT_STATS, so that AACQuantize() also measures the
+ * noise in a decoder's reconstruction of each spectrum.  For each frame, we
+ * report the number of bits that it was coded in, and its SNR.
+ *
+ * To check a change, run the unchanged build with "-o ref.txt", then the
+ * changed build (on the same input) with "-r ref.txt"; this reports how the
+ * bit counts and SNRs differ.
+ *
+ * usage: aacsnr [-simd level] [-o stats.txt] [-r ref.txt] samplingRate numChannels kbps numFrames [pcmFile]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "fixed.h"
+#include "frame.h"
+#include "simd.h"
+
+static void usage(char const *progName)
+{
+    fprintf(stderr, "usage: %s [-simd level] [-o stats.txt] [-r ref.txt] samplingRate numChannels kbps numFrames [pcmFile]\n",
+            progName);
+    exit(1);
+}
+
+/* (the same input as aacbench.c's) */
+static int16_t *makeInput(char const *fileName, unsigned long sampleRate,
+                          unsigned int numChannels, unsigned long numSamples)
+{
+    int16_t *pcm = (int16_t *)calloc(numSamples, sizeof(int16_t));
+    unsigned long i;
+    uint32_t seed = 12345;
+
+    if (fileName != NULL) {
+        FILE *fid = fopen(fileName, "rb");
+
+        if (fid == NULL) {
+            perror(fileName);
+            exit(1);
+        }
+        if (fread(pcm, sizeof(int16_t), numSamples, fid) < numSamples)
+            fprintf(stderr, "%s is short; padding it with silence\n", fileName);
+        fclose(fid);
+        return pcm;
+    }
+
+    for (i = 0; i < numSamples; i++) {
+        unsigned int ch = i%numChannels;
+        double t = (double)(i/numChannels)/sampleRate;
+        double x = 8000*sin(2*M_PI*(440 + 220*ch)*t) + 6000*sin(2*M_PI*3000*t*t);
+
+        seed = seed*1103515245 + 12345;
+        pcm[i] = (int16_t)(x + (int32_t)((seed>>16)%4000) - 2000);
+    }
+    return pcm;
+}
+
+#define NO_SNR 999.0 /* for a frame that has no signal, or no noise */
+
+static double snr(double signalEnergy, double noiseEnergy)
+{
+    if (signalEnergy <= 0 || noiseEnergy <= 0)
+        return NO_SNR;
+    return 10*log10(signalEnergy/noiseEnergy);
+}
+
+int main(int argc, char **argv)
+{
+    char const *progName = argv[0];
+    char const *outFileName = NULL, *refFileName = NULL;
+    FILE *out = NULL, *ref = NULL;
+    unsigned long sampleRate, inputSamples, maxOutputBytes;
+    unsigned int numChannels, kbps;
+    int numFrames, frame;
+    int16_t *pcm;
+    unsigned char *outputBuffer;
+    faacEncHandle hEncoder;
+    faacEncConfigurationPtr config;
+    double totalBits = 0, totalSignal = 0, totalNoise = 0, sumSNR = 0;
+    int numSNRFrames = 0;
+
+    /* our differences from the reference: */
+    int numRefFrames = 0, numRefSNRFrames = 0, numChangedFrames = 0, worstFrame = -1;
+    double refTotalBits = 0, sumSNRChange = 0, worstSNRChange = 0;
+
+    while (argc > 1 && argv[1][0] == '-') {
+        if (strcmp(argv[1], "-simd") == 0 && argc > 2)
+            faac_simd_setup(atoi(argv[2])); /* before faacEncOpen() does it */
+        else if (strcmp(argv[1], "-o") == 0 && argc > 2)
+            outFileName = argv[2];
+        else if (strcmp(argv[1], "-r") == 0 && argc > 2)
+            refFileName = argv[2];
+        else
+            usage(progName);
+        argc -= 2; argv += 2;
+    }
+    if (argc != 5 && argc != 6)
+        usage(progName);
+    sampleRate = atol(argv[1]);
+    numChannels = atoi(argv[2]);
+    kbps = atoi(argv[3]);
+    numFrames = atoi(argv[4]);
+    if (numChannels < 1 || numChannels > MAX_CHANNELS || numFrames < 1)
+        usage(progName);
+
+    if (outFileName != NULL && (out = fopen(outFileName, "w")) == NULL) {
+        perror(outFileName);
+        return 1;
+    }
+    if (refFileName != NULL && (ref = fopen(refFileName, "r")) == NULL) {
+        perror(refFileName);
+        return 1;
+    }
+
+    hEncoder = faacEncOpen(sampleRate, numChannels, &inputSamples, &maxOutputBytes);
+    if (hEncoder == NULL) {
+        fprintf(stderr, "faacEncOpen() failed\n");
+        return 1;
+    }
+    /* as AACAudioEncoder sets it up: */
+    config = faacEncGetCurrentConfiguration(hEncoder);
+    config->mpegVersion = MPEG4;
+    config->bitRate = kbps*1000/numChannels;
+    config->bandWidth = 16000;
+    config->quantqual = 200;
+    config->outputFormat = 0;
+    config->inputFormat = FAAC_INPUT_16BIT;
+    if (!faacEncSetConfiguration(hEncoder, config)) {
+        fprintf(stderr, "faacEncSetConfiguration() failed\n");
+        return 1;
+    }
+
+    /* (Each frame is encoded along with the one before it - its 'overlap') */
+    pcm = makeInput(argc == 6 ? argv[5] : NULL, sampleRate, numChannels,
+                    (numFrames+1)*inputSamples);
+    outputBuffer = (unsigned char *)malloc(maxOutputBytes);
+
+    for (frame = 0; frame < numFrames; frame++) {
+        int frameBytes, bits, refFrame, refBits;
+        double frameSNR, refSNR;
+
+        hEncoder->aacquantCfg.signalEnergy = 0;
+        hEncoder->aacquantCfg.noiseEnergy = 0;
+        frameBytes = faacEncEncode(hEncoder, pcm + (frame+1)*inputSamples,
+                                   pcm + frame*inputSamples, inputSamples,
+                                   outputBuffer, maxOutputBytes);
+        bits = frameBytes > 0 ? 8*frameBytes : 0;
+        frameSNR = snr(hEncoder->aacquantCfg.signalEnergy,
+                       hEncoder->aacquantCfg.noiseEnergy);
+
+        totalBits += bits;
+        totalSignal += hEncoder->aacquantCfg.signalEnergy;
+        totalNoise += hEncoder->aacquantCfg.noiseEnergy;
+        if (frameSNR != NO_SNR) {
+            sumSNR += frameSNR;
+            ++numSNRFrames;
+        }
+        if (out != NULL)
+            fprintf(out, "%d %d %.4f\n", frame, bits, frameSNR);
+
+        if (ref != NULL
+            && fscanf(ref, "%d %d %lf", &refFrame, &refBits, &refSNR) == 3
+            && refFrame == frame) {
+            double change;
+
+            /* (compare what we'd have written to "out" with what was) */
+            frameSNR = floor(frameSNR*10000 + 0.5)/10000;
+            change = frameSNR - refSNR;
+
+            ++numRefFrames;
+            refTotalBits += refBits;
+            if (bits != refBits || fabs(change) > 0.00005)
+                ++numChangedFrames;
+            if (frameSNR != NO_SNR && refSNR != NO_SNR) {
+                sumSNRChange += change;
+                ++numRefSNRFrames;
+                if (worstFrame < 0 || change < worstSNRChange) {
+                    worstSNRChange = change;
+                    worstFrame = frame;
+                }
+            }
+        }
+    }
+
+    printf("%d frames: %.0f bits (%.1f kbps), SNR %.2f dB overall, %.2f dB mean per frame\n",
+           numFrames, totalBits, totalBits*sampleRate/(1024.0*numFrames)/1000,
+           snr(totalSignal, totalNoise), numSNRFrames > 0 ? sumSNR/numSNRFrames : NO_SNR);
+    if (ref != NULL) {
+        if (numRefFrames < numFrames)
+            printf("(%s has only %d of these frames)\n", refFileName, numRefFrames);
+        if (numChangedFrames == 0) {
+            printf("identical to %s\n", refFileName);
+        } else {
+            printf("%d frames differ from %s: bits %+.3f%%, SNR %+.3f dB mean per frame",
+                   numChangedFrames, refFileName,
+                   refTotalBits > 0 ? 100*(totalBits-refTotalBits)/refTotalBits : 0.0,
+                   numRefSNRFrames > 0 ? sumSNRChange/numRefSNRFrames : 0.0);
+            if (worstFrame >= 0)
+                printf(", %+.3f dB at worst (frame %d)", worstSNRChange, worstFrame);
+            printf("\n");
+        }
+        fclose(ref);
+    }
+
+    if (out != NULL)
+        fclose(out);
+    free(outputBuffer);
+    free(pcm);
+    faacEncClose(hEncoder);
+    return 0;
+}
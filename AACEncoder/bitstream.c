@@ -31,10 +31,6 @@ Copyright (c) 1997.
 #include <stdlib.h>
 #include <string.h>
 
-#ifndef WIN32
-#include <byteswap.h>
-#endif
-
 #include "fixed.h"
 #include "coder.h"
 #include "channels.h"
@@ -42,15 +38,6 @@ Copyright (c) 1997.
 #include "bitstream.h"
 #include "util.h"
 
-#ifdef FAAC_STATIC_MEMORY
-static BitStream faac_bitStream;
-#endif
-
-static int32_t CountBitstream(faacEncHandle hEncoder,
-                              CoderInfo *coderInfo,
-                              ChannelInfo *channelInfo,
-                              BitStream *bitStream,
-                              int32_t numChannels);
 static int32_t WriteADTSHeader(faacEncHandle hEncoder,
                                BitStream *bitStream,
                                int32_t writeFlag);
@@ -122,23 +109,11 @@ static void calc_CRC(BitStream *bitStream, int32_t len);
 #endif
 
 static void PutBits_init(BitStream *bitStream, uchar_t *buffer, int buffer_size);
-static int32_t flush_put_bits(BitStream *bitStream,int32_t writeFlag);
-
-#ifdef WORDS_BIGENDIAN
-#define be2me_16(x) (x)
-#define be2me_32(x) (x)
-#define be2me_64(x) (x)
-#define le2me_16(x) bswap_16(x)
-#define le2me_32(x) bswap_32(x)
-#define le2me_64(x) bswap_64(x)
-#else
-#define be2me_16(x) bswap_16(x)
-#define be2me_32(x) bswap_32(x)
-#define be2me_64(x) bswap_64(x)
-#define le2me_16(x) (x)
-#define le2me_32(x) (x)
-#define le2me_64(x) (x)
-#endif
+static void flush_put_bits(BitStream *bitStream);
+static void PatchBits(BitStream *bitStream, int32_t pos, uint32_t value, int32_t n);
+
+/* the bit position of the frame length in the ADTS header */
+#define ADTS_FRAME_LENGTH_POS 30
 
 static int32_t WriteFAACStr(BitStream *bitStream, char *version, int32_t write)
 {
@@ -187,8 +162,7 @@ int32_t WriteBitstream(faacEncHandle hEncoder,
     int32_t bits = 0;
     int32_t bitsLeftAfterFill, numFillBits;
 
-    CountBitstream(hEncoder, coderInfo, channelInfo, bitStream, numChannel);
-
+    /* the frame is written in one pass; the ADTS frame length is filled in at the end */
     if(hEncoder->config.outputFormat == 1) {
         bits += WriteADTSHeader(hEncoder, bitStream, 1);
     } 
@@ -252,96 +226,11 @@ int32_t WriteBitstream(faacEncHandle hEncoder,
     bits += LEN_SE_ID;
     PutBit(bitStream, ID_END, LEN_SE_ID);
 
-    flush_put_bits(bitStream, 1);
-    hEncoder->usedBytes = (bitStream->buf_ptr-(uint8_t *)bitStream->bit_buf);
+    flush_put_bits(bitStream);
+    hEncoder->usedBytes = bitStream->buf_ptr - bitStream->buf;
 
-#if 0
-    tmp1 = bitStream->currentBit;
-//    tmp2 = bitStream->numBit;
-    bitStream->currentBit = bitStream->numBit = 30;
-    PutBit(bitStream, hEncoder->usedBytes, 13);
-    bitStream->currentBit = tmp1;
-//    bitStream->numBit = tmp2;
-#else
-    // Write head here
-#endif
-
-    return bits;
-}
-
-static int32_t CountBitstream(faacEncHandle hEncoder,
-                              CoderInfo *coderInfo,
-                              ChannelInfo *channelInfo,
-                              BitStream *bitStream,
-                              int32_t numChannel)
-{
-    register int32_t channel;
-    int32_t bits = 0;
-    int32_t bitsLeftAfterFill, numFillBits;
-
-    if(hEncoder->config.outputFormat == 1){
-        bits += WriteADTSHeader(hEncoder, bitStream, 0);
-    } else {
-        bits = 0; // compiler will remove it, but anyone will see that current size of bitstream is 0
-    }
-
-    if (hEncoder->frameNum == 4)
-      bits += WriteFAACStr(bitStream, hEncoder->config.name, 0);
-
-    for (channel = 0; channel < numChannel; channel++) {
-        if (channelInfo[channel].present) {
-            /* Write out a single_channel_element */
-            if (!channelInfo[channel].cpe) {
-
-                if (channelInfo[channel].lfe) {
-                    /* Write out lfe */
-                    bits += WriteLFE(&coderInfo[channel],
-                        &channelInfo[channel],
-                        bitStream,
-                        hEncoder->config.aacObjectType,
-                        0);
-                } else {
-                    /* Write out sce */
-                    bits += WriteSCE(&coderInfo[channel],
-                        &channelInfo[channel],
-                        bitStream,
-                        hEncoder->config.aacObjectType,
-                        0);
-                }
-
-            } else {
-                if (channelInfo[channel].ch_is_left) {
-                    /* Write out cpe */
-                    bits += WriteCPE(&coderInfo[channel],
-                        &coderInfo[channelInfo[channel].paired_ch],
-                        &channelInfo[channel],
-                        bitStream,
-                        hEncoder->config.aacObjectType,
-                        0);
-                }
-            }
-        }
-    }
-
-    /* Compute how many fill bits are needed to avoid overflowing bit reservoir */
-    /* Save room for ID_END terminator */
-    if (bits < (8 - LEN_SE_ID) ) {
-        numFillBits = 8 - LEN_SE_ID - bits;
-    } else {
-        numFillBits = 0;
-    }
-
-    /* Write AAC fill_elements, smallest fill element is 7 bits. */
-    /* Function may leave up to 6 bits left after fill, so tell it to fill a few extra */
-    numFillBits += 6;
-    bitsLeftAfterFill = WriteAACFillBits(bitStream, numFillBits, 0);
-    bits += (numFillBits - bitsLeftAfterFill);
-
-    /* Write ID_END terminator */
-    bits += LEN_SE_ID;
-
-    bits += flush_put_bits(bitStream,0);
-    hEncoder->usedBytes = bit2byte(bits);
+    if(hEncoder->config.outputFormat == 1)
+        PatchBits(bitStream, ADTS_FRAME_LENGTH_POS, hEncoder->usedBytes, 13);
 
     return bits;
 }
@@ -354,7 +243,7 @@ static int32_t WriteADTSHeader(faacEncHandle hEncoder,
 
     if (writeFlag) {
         /* Fixed ADTS header */
-        PutBit(bitStream, 0xFFFF, 12); /* 12 bit Syncword */
+        PutBit(bitStream, 0xFFF, 12); /* 12 bit Syncword */
         PutBit(bitStream, hEncoder->config.mpegVersion, 1); /* ID == 0 for MPEG4 AAC, 1 for MPEG2 AAC */
         PutBit(bitStream, 0, 2); /* layer == 0 */
         PutBit(bitStream, 1, 1); /* protection absent */
@@ -376,7 +265,7 @@ static int32_t WriteADTSHeader(faacEncHandle hEncoder,
         /* Variable ADTS header */
         PutBit(bitStream, 0, 1); /* copyr. id. bit */
         PutBit(bitStream, 0, 1); /* copyr. id. start */
-        PutBit(bitStream, hEncoder->usedBytes, 13);
+        PutBit(bitStream, 0, 13); /* frame length, see WriteBitstream() */
         PutBit(bitStream, 0x7FF, 11); /* buffer fullness (0x7FF for VBR) */
         PutBit(bitStream, 0, 2); /* raw data blocks (0+1=1) */
 
@@ -954,17 +843,9 @@ static int32_t FindGroupingBits(CoderInfo *coderInfo)
     return grouping_bits;
 }
 
-/* size in bytes! */
-BitStream *OpenBitStream(int32_t size, uchar_t *buffer)
+/* size in bytes!  (The BitStream is the caller's, usually on its stack.) */
+BitStream *OpenBitStream(BitStream *bitStream, int32_t size, uchar_t *buffer)
 {
-    BitStream *bitStream;
-
-#ifdef FAAC_STATIC_MEMORY
-    bitStream = &faac_bitStream;
-#else
-    bitStream = (BitStream *)AllocMemory(sizeof(BitStream));
-#endif
-
     PutBits_init(bitStream, buffer, size);
     
     return bitStream;
@@ -989,10 +870,6 @@ int32_t CloseBitStream(BitStream *bitStream)
     printf("\n");
 #endif
 
-#ifndef FAAC_STATIC_MEMORY
-    FreeMemory(bitStream);
-#endif
-
     return bytes;
 }
 
@@ -1008,56 +885,36 @@ static void PutBits_init(BitStream *bitStream, uchar_t *buffer, int buffer_size)
     bitStream->buf = buffer;
     bitStream->buf_end = bitStream->buf + buffer_size;
     bitStream->buf_ptr = bitStream->buf;
-    bitStream->bit_left=32;
+    bitStream->bit_left=64;
     bitStream->bit_buf=0;
 }
 
-void PutBit(BitStream *bitStream, uint32_t value, int32_t n)
+/* pad the end of the output stream with zeros */
+static void flush_put_bits(BitStream *bitStream)
 {
-    unsigned int bit_buf;
-    register int bit_left;
-   
-    bit_buf = bitStream->bit_buf;
-    bit_left = bitStream->bit_left;
-
-    /* XXX: optimize */
-    if (n < bit_left) {
-        bit_buf = (bit_buf<<n) | value;
-        bit_left-=n;
-    } else {
-        bit_buf<<=bit_left;
-        bit_buf |= value >> (n - bit_left);
-        *(uint32_t *)bitStream->buf_ptr = be2me_32(bit_buf);
-        bitStream->buf_ptr+=4;
-        bit_left+=32 - n;
-        bit_buf = value;
+    if (bitStream->bit_left < 64)
+        bitStream->bit_buf<<= bitStream->bit_left;
+    while (bitStream->bit_left < 64) {
+        /* XXX: should test end of buffer */
+        *bitStream->buf_ptr++=(uint8_t)(bitStream->bit_buf>>56);
+        bitStream->bit_buf<<=8;
+        bitStream->bit_left+=8;
     }
-
-    bitStream->bit_buf = bit_buf;
-    bitStream->bit_left = bit_left;
-
+    bitStream->bit_left=64;
+    bitStream->bit_buf=0;
 }
 
-/* pad the end of the output stream with zeros */
-static int32_t flush_put_bits(BitStream *bitStream,int32_t writeFlag)
+/* overwrites n bits at bit position pos of the stream written so far */
+static void PatchBits(BitStream *bitStream, int32_t pos, uint32_t value, int32_t n)
 {
-    int32_t padbits;
-
-    padbits = 32-bitStream->bit_left;
+    uint8_t *p;
+    int32_t bit;
 
-    if ( writeFlag ) {
-        bitStream->bit_buf<<= bitStream->bit_left;
-        while (bitStream->bit_left < 32) {
-            /* XXX: should test end of buffer */
-            *bitStream->buf_ptr++=(uint8_t)(bitStream->bit_buf>>24);
-            bitStream->bit_buf<<=8;
-            bitStream->bit_left+=8;
-        }
-        bitStream->bit_left=32;
-        bitStream->bit_buf=0;
+    for (n--; n >= 0; n--, pos++) {
+        p = bitStream->buf + (pos>>3);
+        bit = 7 - (pos&7);
+        *p = (uint8_t)((*p & ~(1<<bit)) | (((value>>n)&1)<<bit));
     }
-    
-    return padbits;
 }
 
 #if 0
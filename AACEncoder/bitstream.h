@@ -42,6 +42,8 @@ Copyright (c) 1996.
 extern "C" {
 #endif /* __cplusplus */
 
+#include <string.h>
+
 #include "frame.h"
 #include "coder.h"
 #include "channels.h"
@@ -74,6 +76,21 @@ INLINE static unsigned int ByteSwap32(unsigned int x)
 
 #define bswap_32(x) ByteSwap32(x)
 
+INLINE static unsigned __int64 ByteSwap64(unsigned __int64 x)
+{
+    return ((unsigned __int64)ByteSwap32((unsigned int)x) << 32) | ByteSwap32((unsigned int)(x >> 32));
+}
+
+#define bswap_64(x) ByteSwap64(x)
+
+#else
+#include <byteswap.h>
+#endif
+
+#ifdef WORDS_BIGENDIAN
+#define be2me_64(x) (x)
+#else
+#define be2me_64(x) bswap_64(x)
 #endif
 
 //#define OLDPUTBIT   1
@@ -179,7 +196,7 @@ typedef struct
     long_t currentBit;      /* current bit position in bit stream */
     long_t numByte;         /* number of bytes read/written (only file) */
 #else
-    uint32_t bit_buf;
+    uint64_t bit_buf;   /* the bits not yet written, in the low 64-bit_left bits */
     int32_t bit_left;
     uint8_t *buf, *buf_ptr, *buf_end;
 #endif
@@ -191,7 +208,7 @@ int32_t WriteBitstream(faacEncHandle hEncoder,
                        BitStream *bitStream,
                        int32_t numChannels);
 
-BitStream *OpenBitStream(int32_t size, uchar_t *buffer);
+BitStream *OpenBitStream(BitStream *bitStream, int32_t size, uchar_t *buffer);
 
 int32_t CloseBitStream(BitStream *bitStream);
 
@@ -204,7 +221,31 @@ int32_t PutBit2(BitStream *bitStream,
                ulong_t data,
                int32_t numBit);
 #else
-void PutBit(BitStream *bitStream, uint32_t value, int32_t n);
+/* writes the n (<= 32) low bits of value, which must not have any higher bits set;
+   whole 64-bit words go to the buffer at a time */
+static INLINE void PutBit(BitStream *bitStream, uint32_t value, int32_t n)
+{
+    uint64_t bit_buf;
+    int32_t bit_left;
+
+    bit_buf = bitStream->bit_buf;
+    bit_left = bitStream->bit_left;
+
+    if (n < bit_left) {
+        bit_buf = (bit_buf<<n) | value;
+        bit_left -= n;
+    } else {
+        bit_buf = (bit_buf<<bit_left) | (value >> (n - bit_left));
+        bit_buf = be2me_64(bit_buf);
+        memcpy(bitStream->buf_ptr, &bit_buf, 8);  /* (the buffer need not be aligned) */
+        bitStream->buf_ptr += 8;
+        bit_left += 64 - n;
+        bit_buf = value;
+    }
+
+    bitStream->bit_buf = bit_buf;
+    bitStream->bit_left = bit_left;
+}
 #endif
 
 #ifdef __cplusplus
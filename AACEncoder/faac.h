@@ -49,6 +49,14 @@ psymodellist_t;
 
 typedef void *faacEncHandle;
 
+/*
+	Thread safety: all of an encoder's state is in its handle, and the
+	tables that encoders share are built once (by the first faacEncOpen())
+	and are read-only after that.  So different handles can be opened,
+	used and closed concurrently, from different threads, without locking.
+	Calls for any one handle must not overlap, though.
+*/
+
 /*
 	Allows an application to get FAAC version info. This is intended
 	purely for informative purposes.
@@ -25,23 +25,23 @@
 
 #include "fixed.h"
 #include "fft.h"
+#include "simd.h"
 #include "util.h"
 
-#ifdef FAAC_STATIC_MEMORY
-static ushort_t faac_recodertbl[1<<FAAC_FFT_LOGM];
-#endif
+/* The tables are the same for all encoders, so they're built once, by
+   fft_init_tables(), and are read-only after that */
+static ushort_t faac_swaptbl[1<<FAAC_FFT_LOGM];
+static int32_t faac_numswaps;
+static fftfloat faac_stagecostbl[(1<<FAAC_FFT_LOGM)-1];
+static fftfloat faac_stagenegsintbl[(1<<FAAC_FFT_LOGM)-1];
 
-void fft_initialize( FFT_Tables *fft_tables )
+void fft_init_tables( void )
 {
     register int32_t i;
     int32_t size = (1<<FAAC_FFT_LOGM);
+    int32_t step, shift;
 
-#ifdef FAAC_STATIC_MEMORY
-    fft_tables->reordertbl = (ushort_t *)faac_recodertbl;
-#else
-    fft_tables->reordertbl = (ushort_t *)AllocMemory((1<<FAAC_FFT_LOGM)*sizeof(ushort_t));
-#endif
-
+    faac_numswaps = 0;
     for (i = 0; i < size; i++) {
         register int32_t b0;
         int32_t reversed = 0;
@@ -50,47 +50,103 @@ void fft_initialize( FFT_Tables *fft_tables )
             reversed = (reversed << 1) | (tmp & 1);
             tmp >>= 1;
         }
-        fft_tables->reordertbl[i] = (ushort_t)reversed;
+        if (reversed > i) {
+            faac_swaptbl[faac_numswaps++] = (ushort_t)i;
+            faac_swaptbl[faac_numswaps++] = (ushort_t)reversed;
+        }
+    }
+    faac_numswaps >>= 1;
+
+    /* stage "step" uses twiddle factors (step-1)..(2*step-2) */
+    for (step = 1; step < size; step <<= 1) {
+        for (shift = 0; shift < step; shift++) {
+            faac_stagecostbl[step-1+shift] = faac_fft_costbl[shift*(size/(step<<1))];
+            faac_stagenegsintbl[step-1+shift] = faac_fft_negsintbl[shift*(size/(step<<1))];
+        }
     }
+}
 
+void fft_initialize( FFT_Tables *fft_tables )
+{
     fft_tables->costbl = faac_fft_costbl;
     fft_tables->negsintbl = faac_fft_negsintbl;
+    fft_tables->swaptbl = faac_swaptbl;
+    fft_tables->numswaps = faac_numswaps;
+    fft_tables->stagecostbl = faac_stagecostbl;
+    fft_tables->stagenegsintbl = faac_stagenegsintbl;
 }
 
 void fft_terminate( FFT_Tables *fft_tables )
 {
     fft_tables->costbl      = NULL;
     fft_tables->negsintbl   = NULL;
-    fft_tables->reordertbl  = NULL;
-
-#ifndef FAAC_STATIC_MEMORY
-    if ( fft_tables->reordertbl )
-        FreeMemory(fft_tables->reordertbl);
-#endif
+    fft_tables->swaptbl     = NULL;
+    fft_tables->stagecostbl = NULL;
+    fft_tables->stagenegsintbl = NULL;
 }
 
-static void reorder( FFT_Tables *fft_tables, coef_t *x, int32_t logm)
+/* puts both xr and xi into bit-reversed order, in a single pass */
+static void reorder( FFT_Tables *fft_tables, coef_t *xr, coef_t *xi )
 {
-    int32_t j;
-    register int32_t i;
-    static int32_t size = (1<<FAAC_FFT_LOGM);
+    register int32_t i, j;
+    register ushort_t *swap = fft_tables->swaptbl;
+    ushort_t *end = swap + (fft_tables->numswaps<<1);
     coef_t tmp;
 
-    for (i = 0; i < size; i++) {
-        j = fft_tables->reordertbl[i];
-        
-        if (j > i) {
-            tmp = x[i];
-            x[i] = x[j];
-            x[j] = tmp;
-        }
+    for (; swap < end; swap += 2) {
+        i = swap[0];
+        j = swap[1];
+        tmp = xr[i];
+        xr[i] = xr[j];
+        xr[j] = tmp;
+        tmp = xi[i];
+        xi[i] = xi[j];
+        xi[j] = tmp;
     }
 }
 
+#ifdef FAAC_FLOAT
+/* Each stage's twiddle factors are contiguous in the stage tables, so the
+   compiler can vectorize the butterflies. */
 INLINE static void fft_proc(coef_t *xr, 
                             coef_t *xi,
                             fftfloat *refac, 
                             fftfloat *imfac, 
+                            fftfloat *stagerefac,
+                            fftfloat *stageimfac,
+                            int32_t size)	
+{
+    register int32_t step, shift, pos;
+    coef_t *xr1, *xi1, *xr2, *xi2;
+    fftfloat *wr, *wi;
+    coef_t v2r, v2i;
+
+    for (step = 1; step < size; step = (step<<1)) {
+        wr = stagerefac + step - 1;
+        wi = stageimfac + step - 1;
+        for (pos = 0; pos < size; pos += (step<<1)) {
+            xr1 = xr + pos;
+            xi1 = xi + pos;
+            xr2 = xr1 + step;
+            xi2 = xi1 + step;
+            for (shift = 0; shift < step; shift++) {
+                v2r = xr2[shift]*wr[shift] - xi2[shift]*wi[shift];
+                v2i = xr2[shift]*wi[shift] + xi2[shift]*wr[shift];
+                xr2[shift] = xr1[shift] - v2r;
+                xr1[shift] += v2r;
+                xi2[shift] = xi1[shift] - v2i;
+                xi1[shift] += v2i;
+            }
+        }
+    }
+}
+#else
+INLINE static void fft_proc(coef_t *xr, 
+                            coef_t *xi,
+                            fftfloat *refac, 
+                            fftfloat *imfac, 
+                            fftfloat *stagerefac,
+                            fftfloat *stageimfac,
                             int32_t size)	
 {
     register int32_t step, shift, pos;
@@ -107,6 +163,12 @@ INLINE static void fft_proc(coef_t *xr,
     for (step = 1; step < size; step = (step<<1)) {
         x2 = 0;
         estep >>= 1;
+        if (step >= 4 && faac_simd_kernels.butterflies) {
+            for (pos = 0; pos < size; pos += (step<<1))
+                faac_simd_kernels.butterflies(xr+pos, xi+pos, xr+pos+step, xi+pos+step,
+                                              stagerefac+step-1, stageimfac+step-1, step);
+            continue;
+        }
         for (pos = 0; pos < size; pos += (step<<1)) {
             x1 = x2;
             x2 += step;
@@ -141,13 +203,14 @@ INLINE static void fft_proc(coef_t *xr,
         }
     }
 }
+#endif
 
 
 void fft( FFT_Tables *fft_tables, coef_t *xr, coef_t *xi, int32_t logm)
 {
-    reorder( fft_tables, xr, logm);
-    reorder( fft_tables, xi, logm);
-    fft_proc( xr, xi, fft_tables->costbl, fft_tables->negsintbl, 1 << logm );
+    reorder( fft_tables, xr, xi );
+    fft_proc( xr, xi, fft_tables->costbl, fft_tables->negsintbl,
+              fft_tables->stagecostbl, fft_tables->stagenegsintbl, 1 << logm );
 }
 
 /*
@@ -26,9 +26,13 @@ typedef struct
 {
     fftfloat *costbl;
     fftfloat *negsintbl;
-    ushort_t *reordertbl;
+    ushort_t *swaptbl;      /* the (i, j) pairs to swap for the bit-reversed order */
+    int32_t numswaps;
+    fftfloat *stagecostbl;  /* costbl and negsintbl laid out stage by stage, so that */
+    fftfloat *stagenegsintbl; /* each stage's twiddle factors are contiguous */
 } FFT_Tables;
 
+void fft_init_tables	( void ); /* once, for all encoders */
 void fft_initialize		( FFT_Tables *fft_tables );
 void fft_terminate	( FFT_Tables *fft_tables );
 
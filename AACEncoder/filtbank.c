@@ -40,35 +40,40 @@ Copyright(c)1996.
 #include "filtbank.h"
 #include "frame.h"
 #include "fft.h"
+#include "simd.h"
 #include "util.h"
 
 static const frac_t sine_long_1024[1024];
 
-#ifdef FAAC_STATIC_MEMORY
-static coef_t faac_freqBuff[2][FRAME_LEN<<1];
-static pow_t faac_freqBuff2[2][FRAME_LEN<<1];
-static coef_t xi[512];
-static coef_t xr[512];
+/* the window for the SIMD kernels (and the floating-point build): sine_long_1024
+   as coef_t, followed by the same values in reverse order (for the second half
+   of the block).  It's built once, by FilterBankInitTables(). */
+static coef_t sine_long_window[BLOCK_LEN_LONG<<1];
+
+void FilterBankInitTables(void)
+{
+    int32_t i;
+    for (i = 0; i < BLOCK_LEN_LONG; i++) {
+#ifdef FAAC_FLOAT
+        sine_long_window[i] = (coef_t)FRAC2FLOAT(sine_long_1024[i]);
 #else
-static coef_t *xi;
-static coef_t *xr;
+        sine_long_window[i] = (coef_t)sine_long_1024[i];
 #endif
+        sine_long_window[(BLOCK_LEN_LONG<<1)-1-i] = sine_long_window[i];
+    }
+}
 
+/* (With FAAC_STATIC_MEMORY, faacEncOpen() has already set the buffers up.) */
 void FilterBankInit(faacEncHandle hEncoder)
 {
+#ifndef FAAC_STATIC_MEMORY
     uint32_t channel;
     for (channel = 0; channel < hEncoder->numChannels; channel++) {
-#ifdef FAAC_STATIC_MEMORY
-        hEncoder->freqBuff[channel] = (coef_t*)faac_freqBuff[channel];
-        hEncoder->freqBuff2[channel] = (pow_t*)faac_freqBuff2[channel];
-#else
         hEncoder->freqBuff[channel] = (coef_t*)AllocMemory((FRAME_LEN<<1)*sizeof(coef_t));
         hEncoder->freqBuff2[channel] = (pow_t*)AllocMemory((FRAME_LEN<<1)*sizeof(pow_t));
-#endif
     }
-#ifndef FAAC_STATIC_MEMORY
-    xi = (coef_t *)AllocMemory(512*sizeof(coef_t));
-    xr = (coef_t *)AllocMemory(512*sizeof(coef_t));
+    hEncoder->mdct_xr = (coef_t *)AllocMemory(512*sizeof(coef_t));
+    hEncoder->mdct_xi = (coef_t *)AllocMemory(512*sizeof(coef_t));
 #endif
 }
 
@@ -82,17 +87,103 @@ void FilterBankEnd(faacEncHandle hEncoder)
         if ( hEncoder->freqBuff2[channel] )
             FreeMemory(hEncoder->freqBuff2[channel]);
     }
-    if ( xi )
-        FreeMemory(xi);
-    if ( xr )
-        FreeMemory(xr);
+    if ( hEncoder->mdct_xi )
+        FreeMemory(hEncoder->mdct_xi);
+    if ( hEncoder->mdct_xr )
+        FreeMemory(hEncoder->mdct_xr);
 #endif
 }
 
-static void MDCT( FFT_Tables *fft_tables, coef_t *data, int32_t N )
+#ifdef FAAC_FLOAT
+static void MDCT( FFT_Tables *fft_tables, coef_t *xr, coef_t *xi, coef_t *data, int32_t N )
+{
+    fftfloat *cosx = faac_fft_cosx;
+    fftfloat *sinx = faac_fft_sinx;
+    coef_t tempr, tempi; /* temps for pre and post twiddle */
+    register int32_t i;
+    int32_t n,m;
+    int32_t N2 = (N>>1);
+    int32_t N4 = (N>>2);
+    int32_t N8 = (N>>3);
+
+    for (i = 0; i < N8; i++) {
+        n = N2 - 1 - (i<<1);
+        m = (i<<1);
+        xr[i] = (data [N4 + n] + data [N + N4 - 1 - n])*0.5f;
+        xi[i] = (data [N4 + m] - data [N4 - 1 - m])*0.5f;
+    }
+    for (; i < N4; i++) {
+        n = N2 - 1 - (i<<1);
+        m = (i<<1);
+        xr[i] = (data [N4 + n] - data [N4 - 1 - n])*0.5f;
+        xi[i] = (data [N4 + m] + data [N + N4 - 1 - m])*0.5f;
+    }
+
+    /* calculate pre-twiddled FFT input */
+    for (i = 0; i < N4; i++) {
+        tempr = xr[i];
+        tempi = xi[i];
+        xr[i] = tempr*cosx[i] + tempi*sinx[i];
+        xi[i] = tempi*cosx[i] - tempr*sinx[i];
+    }
+
+    /* Perform in-place complex FFT of length N/4 */
+    fft( fft_tables, xr, xi, FAAC_FFT_LOGM);
+
+    /* post-twiddle FFT output and then get output data */
+    for (i = 0; i < N4; i++) {
+        tempr = (xr[i]*cosx[i] + xi[i]*sinx[i])*4;
+        tempi = (xi[i]*cosx[i] - xr[i]*sinx[i])*4;
+        data [N - 1 - (i<<1)] = tempr;  /* second half odd */
+        data [i<<1] = -tempr;   /* first half even */
+        data [N2 - 1 - (i<<1)] = tempi;  /* first half odd */
+        data [N2 + (i<<1)] = -tempi;  /* second half even */
+    }
+}
+#else
+/* MDCT(), using the SIMD kernels for the pre- and post-twiddle */
+static void MDCT_SIMD( FFT_Tables *fft_tables, coef_t *xr, coef_t *xi, coef_t *data, int32_t N )
+{
+    fftfloat *cosx = faac_fft_cosx;
+    fftfloat *sinx = faac_fft_sinx;
+    coef_t tempr, tempi;
+    register int32_t i;
+    int32_t n,m;
+    int32_t N2 = (N>>1);
+    int32_t N4 = (N>>2);
+    int32_t N8 = (N>>3);
+
+    for (i = 0; i < N8; i++) {
+        n = N2 - 1 - (i<<1);
+        m = (i<<1);
+        xr[i] = (data [N4 + n] + data [N + N4 - 1 - n])>>1;
+        xi[i] = (data [N4 + m] - data [N4 - 1 - m])>>1;
+    }
+    for (; i < N4; i++) {
+        n = N2 - 1 - (i<<1);
+        m = (i<<1);
+        xr[i] = (data [N4 + n] - data [N4 - 1 - n])>>1;
+        xi[i] = (data [N4 + m] + data [N + N4 - 1 - m])>>1;
+    }
+    faac_simd_kernels.twiddle(xr, xi, cosx, sinx, N4);
+
+    fft( fft_tables, xr, xi, FAAC_FFT_LOGM);
+
+    faac_simd_kernels.twiddle(xr, xi, cosx, sinx, N4);
+    for (i = 0; i < N4; i++) {
+        tempr = xr[i]<<2;
+        tempi = xi[i]<<2;
+        data [N - 1 - (i<<1)] = tempr;
+        data [i<<1] = -tempr;
+        data [N2 - 1 - (i<<1)] = tempi;
+        data [N2 + (i<<1)] = -tempi;
+    }
+}
+
+static void MDCT( FFT_Tables *fft_tables, coef_t *xr, coef_t *xi, coef_t *data, int32_t N )
 {
-    static real_32_t *cosx = faac_fft_cosx;
-    static real_32_t *sinx = faac_fft_sinx;
+    fftfloat *cosx = faac_fft_cosx;
+    fftfloat *sinx = faac_fft_sinx;
     coef_t tempr, tempi; /* temps for pre and post twiddle */
     register int32_t i;
     int32_t n,m;
@@ -103,6 +194,11 @@ static void MDCT( FFT_Tables *fft_tables, coef_t *data, int32_t N )
    int32_t hi,lo;
 #endif
 
+    if (faac_simd_kernels.twiddle) {
+        MDCT_SIMD( fft_tables, xr, xi, data, N );
+        return;
+    }
+
     for (i = 0; i < N4; i++) {
         /* calculate real and imaginary parts of g(n) or G(p) */
         n = N2 - 1 - (i<<1);
@@ -162,6 +258,7 @@ static void MDCT( FFT_Tables *fft_tables, coef_t *data, int32_t N )
     exit(1);
 #endif
 }
+#endif /* FAAC_FLOAT */
 
 void FilterBank(faacEncHandle hEncoder,
                 CoderInfo *coderInfo,
@@ -176,6 +273,23 @@ void FilterBank(faacEncHandle hEncoder,
     register int32_t data;
 #endif
 
+#ifdef FAAC_FLOAT
+    for ( i = 0 ; i < BLOCK_LEN_LONG ; i++) {
+        p_out_mdct[i] = p_overlap[i<<1]*sine_long_window[i];
+        p_out_mdct[BLOCK_LEN_LONG+i] = p_in_data[i<<1]*sine_long_window[BLOCK_LEN_LONG+i];
+    }
+    MDCT( &hEncoder->fft_tables, hEncoder->mdct_xr, hEncoder->mdct_xi,
+          p_out_mdct, BLOCK_LEN_LONG<<1 );
+#else
+    if (faac_simd_kernels.window) {
+        faac_simd_kernels.window(p_out_mdct, p_overlap, sine_long_window, BLOCK_LEN_LONG);
+        faac_simd_kernels.window(p_out_mdct+BLOCK_LEN_LONG, p_in_data,
+                                 sine_long_window+BLOCK_LEN_LONG, BLOCK_LEN_LONG);
+        MDCT( &hEncoder->fft_tables, hEncoder->mdct_xr, hEncoder->mdct_xi,
+              p_out_mdct, BLOCK_LEN_LONG<<1 );
+        return;
+    }
+
     /* Separate action for each Block Type */
     for ( i = 0 ; i < BLOCK_LEN_LONG ; i++){
 #ifdef FAAC_USE_ASM
@@ -202,10 +316,12 @@ void FilterBank(faacEncHandle hEncoder,
                     i, (double)p_in_data[(BLOCK_LEN_LONG-i-1)<<1], COEF2FLOAT(p_out_mdct[(BLOCK_LEN_LONG<<1)-i-1]),FRAC2FLOAT(sine_long_1024[i]));
 #endif
     }
-    MDCT( &hEncoder->fft_tables, p_out_mdct, BLOCK_LEN_LONG<<1 );
+    MDCT( &hEncoder->fft_tables, hEncoder->mdct_xr, hEncoder->mdct_xi,
+          p_out_mdct, BLOCK_LEN_LONG<<1 );
 #ifdef DUMP_P_O_MDCT
 //    exit(1);
 #endif
+#endif /* FAAC_FLOAT */
 }
 
 void specFilter(coef_t *freqBuff,
@@ -228,7 +344,11 @@ void FilterBankPow(int32_t N, coef_t* data, pow_t* data2)
     register int32_t i;
 
     for (i = 0; i < N; i++) {
+#ifdef FAAC_FLOAT
+        data2[i] = data[i]*data[i];
+#else
         data2[i] = (int64_t)(COEF2INT(data[i]))*COEF2INT(data[i]);
+#endif
     }
 }
 
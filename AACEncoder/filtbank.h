@@ -38,6 +38,8 @@ extern "C" {
 #define SINE_WINDOW 0
 #define KBD_WINDOW  1
 
+void FilterBankInitTables(void); /* once, for all encoders */
+
 void FilterBankInit(faacEncHandle hEncoder);
 
 void FilterBankEnd(faacEncHandle hEncoder);
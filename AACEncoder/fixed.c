@@ -64,8 +64,8 @@ INLINE real_t faac_sqrt(real_t x)
 {
     real_t y;
     int32_t n=0;
-    static real_32_t realconst1 = REAL_CONST(0.1);
-    static real_32_t realconst2 = REAL_ICONST(1);
+    static const real_32_t realconst1 = REAL_CONST(0.1);
+    static const real_32_t realconst2 = REAL_ICONST(1);
 #ifdef FAAC_LAGRANGE
     int32_t i;
 #endif
@@ -113,8 +113,8 @@ INLINE real_32_t faac_log(real_t x)
 {
     real_32_t y;
     int32_t n=0;
-    static real_32_t realconst1 = REAL_CONST(0.1);
-    static real_32_t realconst2 = REAL_ICONST(1) ;
+    static const real_32_t realconst1 = REAL_CONST(0.1);
+    static const real_32_t realconst2 = REAL_ICONST(1) ;
 #ifdef FAAC_LAGRANGE
     int32_t i;
 #endif
@@ -160,8 +160,8 @@ INLINE real_32_t faac_pow(real_t x, real_32_t y)
     real_32_t zf;
     int32_t neg=0;
     real_32_t y1;
-    static real_32_t log2 = REAL_CONST(0.6931471806);
-    static real_32_t realconst1 = REAL_ICONST(1) ;
+    static const real_32_t log2 = REAL_CONST(0.6931471806);
+    static const real_32_t realconst1 = REAL_ICONST(1) ;
 #ifdef FAAC_LAGRANGE
     int32_t i;
 #endif
@@ -206,12 +206,23 @@ INLINE real_32_t faac_pow(real_t x, real_32_t y)
     return z;
 }
 
+#ifdef FAAC_FLOAT
+INLINE coef_t faac_pow34(coef_t x)
+{
+    if ( x < 0 )
+        x = -x;
+    return sqrtf(x*sqrtf(x));
+}
+#else
 INLINE coef_t faac_pow34(coef_t x)
 {
     register coef_t y;
     register int32_t n=0;
-    static coef_t realconst1 = COEF_ICONST(FAAC_POW34_MAXSAMPLE)>>4;
-    static coef_t realconst2 = COEF_ICONST(FAAC_POW34_MAXSAMPLE);
+    static const coef_t realconst1 = COEF_ICONST(FAAC_POW34_MAXSAMPLE)>>4;
+    static const coef_t realconst2 = COEF_ICONST(FAAC_POW34_MAXSAMPLE);
+#ifdef FAAC_LAGRANGE
+    int32_t i;
+#endif
 
 #ifdef FAAC_DEBUG_POW34
     printf("faac_pow34: x = %.8f, pow34(x) = %.8f",
@@ -227,16 +238,25 @@ INLINE coef_t faac_pow34(coef_t x)
             n-=3;
         }
     
-        while (x>realconst2) {
+        while (x>=realconst2) {
             x = x>>4;
             n+=3;
         }
-    
+
+#ifdef FAAC_LAGRANGE
+        /* pow34 is smooth over [MAXSAMPLE/16,MAXSAMPLE), so the interpolation
+           between 1024 samples is closer than the nearest of 16384 */
+        i = x>>FAAC_POW34_COEFCONST2;
+        y = faac_table_pow34[i] +
+            (((faac_table_pow34[i+1]-faac_table_pow34[i])*(x&((1<<FAAC_POW34_COEFCONST2)-1)))>>FAAC_POW34_COEFCONST2);
+#else
+        y = faac_table_pow34[FAAC_POW34_INDEX(x)];
+#endif
         if ( n > 0 )
-            y = (faac_table_pow34[FAAC_POW34_INDEX(x)])<<n;
+            y = y<<n;
         else {
             n = -n;
-            y = (faac_table_pow34[FAAC_POW34_INDEX(x)])>>n;
+            y = y>>n;
         }
     }
     else
@@ -248,6 +268,7 @@ INLINE coef_t faac_pow34(coef_t x)
 
     return y;
 }
+#endif
 
 void faac_fixed_init()
 {
@@ -259,7 +280,12 @@ void faac_fixed_init()
     double c, s, cold;
     int N = 2048;
     int size = (1<<FAAC_FFT_LOGM);
+#endif
+#ifdef FAAC_FLOAT
+    register int32_t k;
+#endif
 
+#ifdef FAAC_RUNTIME_TABLE
     faac_table_log[0] = 0;
     for (i=1;i<=FAAC_SAMPLES;i++) {
         faac_table_log[i]=REAL_CONST(log((double)i/FAAC_SAMPLES));
@@ -273,15 +299,16 @@ void faac_fixed_init()
         faac_table_pow[i]=REAL_CONST(pow(2,(double)i/FAAC_SAMPLES));
     }
 
-    step = ((double)FAAC_POW34_MAXSAMPLE)/FAAC_SAMPLES_POW34;
-    for (i=0;i<=FAAC_SAMPLES_POW34;i+=step) {
-        faac_table_pow34[i]=COEF_CONST(pow((double)i,0.75));
-    }
-
     for (i=1;i <= 64;i++) {
         faac_table_log2[i] = i*ln2;
     }
 
+#ifndef FAAC_FLOAT
+    step = ((double)FAAC_POW34_MAXSAMPLE)/FAAC_SAMPLES_POW34;
+    for (i=0;i<=FAAC_SAMPLES_POW34;i++) {
+        faac_table_pow34[i]=COEF_CONST(pow(i*step,0.75));
+    }
+
     for (i=0;i<(1<<(FAAC_FFT_LOGM-1));i++) {
         faac_fft_costbl[i] = REAL_CONST(cos(2.0 * FAAC_M_PI_F * ((double) i) / (double) size));
         faac_fft_negsintbl[i] = REAL_CONST(-sin(2.0 * FAAC_M_PI_F * ((double) i) / (double) size));
@@ -302,6 +329,19 @@ void faac_fixed_init()
         c = c*cfreq - s*sfreq;
         s = s*cfreq + cold*sfreq;
     }
+#endif /* !FAAC_FLOAT */
+#endif /* FAAC_RUNTIME_TABLE */
 
+#ifdef FAAC_FLOAT
+    for (k = 0; k < (1<<(FAAC_FFT_LOGM-1)); k++) {
+        faac_fft_costbl[k] = (fftfloat)cos(FAAC_TWOPI_F * k / (1<<FAAC_FFT_LOGM));
+        faac_fft_negsintbl[k] = (fftfloat)-sin(FAAC_TWOPI_F * k / (1<<FAAC_FFT_LOGM));
+    }
+
+    /* the MDCT's pre/post-twiddle factors, for N = 2048 */
+    for (k = 0; k < FAAC_FFT_SINCOS_SIZE; k++) {
+        faac_fft_cosx[k] = (fftfloat)cos(FAAC_TWOPI_F * (k + 0.125) / 2048);
+        faac_fft_sinx[k] = (fftfloat)sin(FAAC_TWOPI_F * (k + 0.125) / 2048);
+    }
 #endif
 }
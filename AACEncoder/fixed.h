@@ -50,8 +50,17 @@ extern "C" {
 /* define FAAC_RUNTIME_TABLE to generate lookup table at runtime when initializing */
 //#define FAAC_RUNTIME_TABLE  1
 
-/* define FAAC_STATIC_MEMORY to use static memory instead dynamic memory */
+/* define FAAC_STATIC_MEMORY to use static memory instead dynamic memory; up to
+    FAAC_STATIC_ENCODERS encoders can then be open at once */
 //#define FAAC_STATIC_MEMORY 1
+#ifndef FAAC_STATIC_ENCODERS
+#define FAAC_STATIC_ENCODERS 4
+#endif
+
+/* define FAAC_FLOAT to use single-precision floating point, rather than fixed point, for
+    the signal path (filterbank, MDCT and quantization); this is faster on CPUs that have an FPU.
+    The rest of the encoder (rate control, bitstream) still uses fixed point */
+//#define FAAC_FLOAT  1
 
 /* define FAAC_LAGRANGE to generate fixed-point operation result via Lagrange interpolation,
     which will improve the precision, but consume more MIPS because of extra multiplication */
@@ -100,12 +109,19 @@ typedef unsigned char uchar_t;
 
 typedef int64_t real_t;
 typedef int64_t frac_t;
-typedef int32_t coef_t;
 typedef int32_t real_32_t;
 typedef int32_t float_t;
+#ifdef FAAC_FLOAT
+typedef float coef_t;
+typedef float eng_t;
+typedef float pow_t;
+typedef float fftfloat;
+#else
+typedef int32_t coef_t;
 typedef int64_t eng_t;
 typedef int64_t pow_t;
 typedef int32_t fftfloat;
+#endif
 
 /* real */
 #define REAL_BITS 16 // MAXIMUM BITS FOR FIXED POINT SBR
@@ -126,7 +142,11 @@ typedef int32_t fftfloat;
 #define COEF_PRECISION (1 << COEF_BITS)
 #define COEF_CONST(A) (((A) >= 0) ? ((real_t)((A)*(COEF_PRECISION)+0.5)) : ((real_t)((A)*(COEF_PRECISION)-0.5)))
 #define COEF_ICONST(A)  ((coef_t)(A)<<COEF_BITS)
+#ifdef FAAC_FLOAT
+#define COEF2FLOAT(A) ((double)(A))
+#else
 #define COEF2FLOAT(A) (((double)(A))/(COEF_PRECISION))
+#endif
 #define DIV_C(A, B) ((coef_t)(((coef_t)(A) << COEF_BITS)/(B)))
 #define MUL_C(A,B) (real_t)(((int64_t)(A)*(B)) >> COEF_BITS)
 #define REAL2COEF_BIT   (REAL_BITS-COEF_BITS) // should > 0
@@ -146,17 +166,20 @@ typedef int32_t fftfloat;
 #define FRAC_ICONST(A)  ((frac_t)(A)<<FRAC_BITS)
 #define FRAC2FLOAT(A) (((double)(A))/(FRAC_PRECISION))
 
-#define SAMPLE_BITS    14
+/* 1024 samples per table (4 KB), interpolated by FAAC_LAGRANGE: log() stays
+   within 5 LSBs of REAL_BITS, sqrt() and pow34() within 2e-4 of their value
+   and pow() within 1e-3, as close as the 16384 samples that they replace */
+#define SAMPLE_BITS    10
 #define FAAC_SAMPLES    (1<<SAMPLE_BITS)
 #define REAL2SAMPLE_BIT (REAL_BITS-SAMPLE_BITS) // should > 0
 
 /* pow34(x) */
-#define POW34_SAMPLE_BIT      14
+#define POW34_SAMPLE_BIT      10
 #define FAAC_SAMPLES_POW34    (1<<POW34_SAMPLE_BIT)
 #define POW34_SCALE_BIT       14
 #define FAAC_POW34_MAXSAMPLE  (1<<POW34_SCALE_BIT)
 #define FAAC_POW34_COEFCONST1 ((1<<COEF_BITS)>>1) //REAL_CONST(0.5)
-#define FAAC_POW34_COEFCONST2 (COEF_BITS+POW34_SCALE_BIT-SAMPLE_BITS)
+#define FAAC_POW34_COEFCONST2 (COEF_BITS+POW34_SCALE_BIT-POW34_SAMPLE_BIT)
 #define FAAC_POW34_INDEX(x)   ((x+FAAC_POW34_COEFCONST1)>>FAAC_POW34_COEFCONST2)
 
 /* fixed-point operations */
@@ -169,7 +192,9 @@ extern INLINE coef_t faac_pow34(coef_t x);
 extern real_32_t faac_table_log[FAAC_SAMPLES+1];
 extern real_32_t faac_table_sqrt[FAAC_SAMPLES+1];
 extern real_32_t faac_table_pow[FAAC_SAMPLES+1];
+#ifndef FAAC_FLOAT
 extern coef_t faac_table_pow34[FAAC_SAMPLES_POW34+1];
+#endif
 extern real_32_t faac_table_log2[64+1];
 
 #define faac_fabs(x) abs(x)
@@ -179,8 +204,8 @@ extern real_32_t faac_table_log2[64+1];
 #define FAAC_FFT_SINCOS_SIZE     512
 extern fftfloat faac_fft_costbl[1<<(FAAC_FFT_LOGM-1)];
 extern fftfloat faac_fft_negsintbl[1<<(FAAC_FFT_LOGM-1)];
-extern real_32_t faac_fft_cosx[FAAC_FFT_SINCOS_SIZE];
-extern real_32_t faac_fft_sinx[FAAC_FFT_SINCOS_SIZE];
+extern fftfloat faac_fft_cosx[FAAC_FFT_SINCOS_SIZE];
+extern fftfloat faac_fft_sinx[FAAC_FFT_SINCOS_SIZE];
 
 /* definination for PI */
 #define FAAC_M_PI      REAL_CONST(3.14159265358979323846)
@@ -41,15 +41,40 @@
 #include "aacquant.h"
 #include "util.h"
 #include "huffman.h"
+#include "simd.h"
 #include "version.h"
 #ifndef WIN32
 #include <sys/resource.h>
 #endif
 
 #ifdef FAAC_STATIC_MEMORY
-static faacEncStruct faac_hEncoder;
+/* the memory for each of up to FAAC_STATIC_ENCODERS encoders */
+typedef struct {
+    faacEncStruct encoder; /* (first, so that a handle points to its faacEncMemory) */
+    coef_t freqBuff[MAX_CHANNELS][FRAME_LEN<<1];
+    pow_t freqBuff2[MAX_CHANNELS][FRAME_LEN<<1];
+    coef_t mdct_xr[512];
+    coef_t mdct_xi[512];
+    int32_t huff_data[MAX_CHANNELS][5*FRAME_LEN];
+    int32_t huff_len[MAX_CHANNELS][5*FRAME_LEN];
+    volatile int32_t in_use;
+} faacEncMemory;
+
+static faacEncMemory faac_encMemory[FAAC_STATIC_ENCODERS];
 #endif
 
+/* the tables that all encoders share, which are read-only once built */
+static faac_once_t faac_tables_once = FAAC_ONCE_INIT;
+
+static void InitTables(void)
+{
+    faac_fixed_init();
+    fft_init_tables();
+    FilterBankInitTables();
+    HuffmanTablesInit();
+    faac_simd_init();
+}
+
 #ifdef DUMP_FILTERBANK
 static dump_filterbank(faacEncHandle hEncoder)
 {
@@ -119,11 +144,10 @@ void dump_float_sample(double *sample, int nsamples)
 #endif
 
 #ifdef FAAC_PROFILE
-static unsigned long faac_gettimeused()
+static unsigned long faac_gettimeused(faacEncHandle hEncoder)
 {
     struct rusage usage;
     unsigned long cur_timeused,timeused;
-    static unsigned long last_timeused = 0;
     
     if (getrusage(RUSAGE_SELF, &usage) == 0) {
         cur_timeused = usage.ru_utime.tv_sec * 1000000 +
@@ -132,8 +156,8 @@ static unsigned long faac_gettimeused()
     else
         cur_timeused = 0;
 
-    timeused = cur_timeused-last_timeused;
-    last_timeused = cur_timeused;
+    timeused = cur_timeused-hEncoder->last_timeused;
+    hEncoder->last_timeused = cur_timeused;
 
     return timeused;
 }
@@ -150,7 +174,7 @@ static char *libCopyright =
   " Copyright (C) 2002,2003  Krzysztof Nikiel\n"
   "This software is based on the ISO MPEG-4 reference source code.\n";
 
-static SR_INFO srInfo[12+1];
+static const SR_INFO srInfo[12+1];
 
 // base bandwidth for q=100
 static const int32_t bwbase = 16000;
@@ -244,7 +268,7 @@ int32_t FAACAPI faacEncSetConfiguration(faacEncHandle hEncoder,
         return 0;
 
     if (config->bitRate && !config->bandWidth) {	
-        static struct {
+        static const struct {
             int32_t rate; // per channel at 44100 sampling frequency
             int32_t cutoff;
         }	
@@ -337,20 +361,43 @@ faacEncHandle FAACAPI faacEncOpen(ulong_t sampleRate,
 {
     uint32_t channel;
     faacEncHandle hEncoder;
+#ifdef FAAC_STATIC_MEMORY
+    faacEncMemory *memory = NULL;
+    int32_t i;
+#endif
 
-    faac_fixed_init();
+    faac_once(&faac_tables_once, InitTables);
 
     *inputSamples = FRAME_LEN*numChannels;
     *maxOutputBytes = (6144>>3)*numChannels;
 
 #ifdef FAAC_STATIC_MEMORY
-    hEncoder = &faac_hEncoder;
+    for (i = 0; i < FAAC_STATIC_ENCODERS; i++) {
+        if (faac_claim(&faac_encMemory[i].in_use)) {
+            memory = &faac_encMemory[i];
+            break;
+        }
+    }
+    if (memory == NULL)
+        return NULL; /* too many open encoders */
+    hEncoder = &memory->encoder;
 #else
     hEncoder = (faacEncHandle)AllocMemory(sizeof(faacEncStruct));
 #endif
 
     SetMemory(hEncoder, 0, sizeof(faacEncStruct));
 
+#ifdef FAAC_STATIC_MEMORY
+    for (channel = 0; channel < MAX_CHANNELS; channel++) {
+        hEncoder->freqBuff[channel] = memory->freqBuff[channel];
+        hEncoder->freqBuff2[channel] = memory->freqBuff2[channel];
+        hEncoder->coderInfo[channel].data = memory->huff_data[channel];
+        hEncoder->coderInfo[channel].len = memory->huff_len[channel];
+    }
+    hEncoder->mdct_xr = memory->mdct_xr;
+    hEncoder->mdct_xi = memory->mdct_xi;
+#endif
+
     hEncoder->numChannels = numChannels;
     hEncoder->sampleRate = sampleRate;
     hEncoder->sampleRateIdx = GetSRIndex(sampleRate);
@@ -422,7 +469,9 @@ int32_t FAACAPI faacEncClose(faacEncHandle hEncoder)
     HuffmanEnd(hEncoder->coderInfo, hEncoder->numChannels); 
     fft_terminate( &hEncoder->fft_tables );
 
-#ifndef FAAC_STATIC_MEMORY
+#ifdef FAAC_STATIC_MEMORY
+    faac_unclaim(&((faacEncMemory *)hEncoder)->in_use);
+#else
     if (hEncoder)
         FreeMemory(hEncoder);
 #endif
@@ -443,12 +492,8 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
     register int32_t sb;
     int32_t frameBytes;
     uint32_t offset;
+    BitStream bitStreamData;
     BitStream *bitStream; /* bitstream used for writing the frame to */
-#ifdef FAAC_PROFILE
-    static int encode_timeused = 0;
-    static int total_frames = 0;
-    static long total_frameBytes = 0;
-#endif
 
     /* local copy's of parameters */
     ChannelInfo *channelInfo = hEncoder->channelInfo;
@@ -457,8 +502,8 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
     uint32_t sampleRate = hEncoder->sampleRate;
     uint32_t useLfe = hEncoder->config.useLfe;
     uint32_t bandWidth = hEncoder->config.bandWidth;
-    static real_32_t realconst2 = REAL_CONST(0.01);
-    static real_32_t realconst3 = REAL_CONST(0.2);
+    static const real_32_t realconst2 = REAL_CONST(0.01);
+    static const real_32_t realconst3 = REAL_CONST(0.2);
    
     /* Increase frame number */
     hEncoder->frameNum++;
@@ -571,7 +616,7 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
     }
 
     /* Write the AAC bitstream */
-    bitStream = OpenBitStream(bufferSize, outputBuffer);
+    bitStream = OpenBitStream(&bitStreamData, bufferSize, outputBuffer);
 
     WriteBitstream(hEncoder, coderInfo, channelInfo, bitStream, numChannels);
 
@@ -583,7 +628,13 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
         real_32_t fix;
         int32_t desbits = numChannels * (hEncoder->config.bitRate << 10)
                           / hEncoder->sampleRate;
-        int32_t diff = (frameBytes << 3) - desbits;
+        int32_t diff;
+
+        /* "bitRate" is in bps; a rate too low to give even one bit per
+           frame just takes the quality down to its minimum: */
+        if (desbits <= 0)
+            desbits = 1;
+        diff = (frameBytes << 3) - desbits;
 
         hEncoder->bitDiff += diff;
         fix = hEncoder->bitDiff*realconst2/desbits;
@@ -601,22 +652,22 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
     }
 
 #ifdef FAAC_PROFILE
-    total_frames++;
-    total_frameBytes += frameBytes;
-    encode_timeused += faac_gettimeused();
+    hEncoder->total_frames++;
+    hEncoder->total_frameBytes += frameBytes;
+    hEncoder->encode_timeused += faac_gettimeused(hEncoder);
 
     /* MIPS = CPU time/Audio time = (CPU_CYCLE*timeused)/(frames/frames per second)
             = (CPU_CYCLE*timeused*frames per second)/frames
      */
-    if ( (total_frames%FAAC_PROFILE_COUNT)==0 ) {
+    if ( (hEncoder->total_frames%FAAC_PROFILE_COUNT)==0 ) {
         printf("\nMIPS[%d], encoding time[%7.3f], frames[%d], bandWidth[%d], quantqual[%d], bitRate[%d], real bitrate(kbps)[%.1f]\n",
-                (int)(FAAC_CPU_CYCLE*(hEncoder->sampleRate/1024.0)*(encode_timeused/1000000.0)/total_frames),
-                encode_timeused/1000000.0,
-                total_frames,
+                (int)(FAAC_CPU_CYCLE*(hEncoder->sampleRate/1024.0)*(hEncoder->encode_timeused/1000000.0)/hEncoder->total_frames),
+                hEncoder->encode_timeused/1000000.0,
+                hEncoder->total_frames,
                 hEncoder->config.bandWidth,
                 hEncoder->config.quantqual,
                 hEncoder->config.bitRate,
-                total_frameBytes*8/1000.0*(hEncoder->sampleRate/1024.0)/total_frames
+                hEncoder->total_frameBytes*8/1000.0*(hEncoder->sampleRate/1024.0)/hEncoder->total_frames
                 );
     }
 #endif
@@ -626,7 +677,7 @@ int32_t FAACAPI faacEncEncode(faacEncHandle hEncoder,
 
 
 /* Scalefactorband data table for 1024 transform length */
-static SR_INFO srInfo[12+1] =
+static const SR_INFO srInfo[12+1] =
 {
     { 96000, 41, 12,
         {
@@ -74,7 +74,7 @@ typedef struct {
     uint32_t flushFrame;
 
     /* Scalefactorband data */
-    SR_INFO *srInfo;
+    const SR_INFO *srInfo;
 
     /* sample buffers of current next and next next frame*/
     int16_t *sampleBuff[MAX_CHANNELS];
@@ -84,6 +84,10 @@ typedef struct {
     pow_t *freqBuff2[MAX_CHANNELS];
     int16_t *overlapBuff[MAX_CHANNELS];
 
+    /* MDCT work buffers */
+    coef_t *mdct_xr;
+    coef_t *mdct_xi;
+
     /* Channel and Coder data for all channels */
     CoderInfo coderInfo[MAX_CHANNELS];
     ChannelInfo channelInfo[MAX_CHANNELS];
@@ -99,6 +103,14 @@ typedef struct {
 
     /* output bits difference in average bitrate mode */
     int32_t bitDiff;
+
+#ifdef FAAC_PROFILE
+    /* profiling counters */
+    ulong_t last_timeused;
+    int32_t encode_timeused;
+    int32_t total_frames;
+    long_t total_frameBytes;
+#endif
 } faacEncStruct, *faacEncHandle;
 
 int32_t FAACAPI faacEncGetVersion(char **faac_id_string,
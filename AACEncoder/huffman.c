@@ -32,28 +32,86 @@ must be included in all copies or derivative works. Copyright 1996.
 #include "huffman.h"
 #include "coder.h"
 #include "bitstream.h"
+#include "simd.h"
 #include "util.h"
 
 #include "hufftab.h"
 
-#ifdef FAAC_STATIC_MEMORY
-static int32_t faac_huff_data[2][5*FRAME_LEN];
-static int32_t faac_huff_len[2][5*FRAME_LEN];
-#endif
+/*
+  Packed code lengths, for counting bits.  The lengths include the sign bits of
+  the unsigned codebooks, and each entry holds the lengths for several codebooks
+  in 16-bit fields, so that a band is costed for all the codebooks that can code
+  it in a single pass over it.  The tables are indexed by the (signed) tuple of
+  quantized values, with |q| <= 2 for the quads and |q| <= 12 for the pairs.
+  They're built once, by HuffmanTablesInit().
+*/
+#define QUAD_INDEX(q)   (125*(q)[0] + 25*(q)[1] + 5*(q)[2] + (q)[3] + 312)
+#define PAIR_INDEX(q)   (25*(q)[0] + (q)[1] + 312)
+#define LEN_FIELD(x,n)  ((int32_t)((x) >> ((n)<<4)) & 0xffff)
+
+static uint64_t quad_len[625];      /* books 1, 2, 3 and 4 */
+static uint64_t pair_len[625];      /* books 5, 6, 7 and 8 */
+static uint64_t pair_len2[625];     /* books 9 and 10 */
+
+void HuffmanTablesInit(void)
+{
+    int32_t a, b, c, d;
+    int32_t i, nz;
+    uint64_t l;
+
+    for (a = -2; a <= 2; a++) {
+        for (b = -2; b <= 2; b++) {
+            for (c = -2; c <= 2; c++) {
+                for (d = -2; d <= 2; d++) {
+                    nz = (a != 0) + (b != 0) + (c != 0) + (d != 0);
+                    l = 0;
+                    if ((ABS(a) < 2) && (ABS(b) < 2) && (ABS(c) < 2) && (ABS(d) < 2)) {
+                        i = MUL27(a) + MUL9(b) + MUL3(c) + d + 40;
+                        l |= (uint64_t)huff1[i][FIRSTINTAB];
+                        l |= (uint64_t)huff2[i][FIRSTINTAB] << 16;
+                    }
+                    i = MUL27(ABS(a)) + MUL9(ABS(b)) + MUL3(ABS(c)) + ABS(d);
+                    l |= (uint64_t)(huff3[i][FIRSTINTAB] + nz) << 32;
+                    l |= (uint64_t)(huff4[i][FIRSTINTAB] + nz) << 48;
+                    quad_len[125*a + 25*b + 5*c + d + 312] = l;
+                }
+            }
+        }
+    }
 
+    for (a = -12; a <= 12; a++) {
+        for (b = -12; b <= 12; b++) {
+            nz = (a != 0) + (b != 0);
+            l = 0;
+            if ((ABS(a) < 5) && (ABS(b) < 5)) {
+                i = MUL9(a) + b + 40;
+                l |= (uint64_t)huff5[i][FIRSTINTAB];
+                l |= (uint64_t)huff6[i][FIRSTINTAB] << 16;
+            }
+            if ((ABS(a) < 8) && (ABS(b) < 8)) {
+                i = MUL8(ABS(a)) + ABS(b);
+                l |= (uint64_t)(huff7[i][FIRSTINTAB] + nz) << 32;
+                l |= (uint64_t)(huff8[i][FIRSTINTAB] + nz) << 48;
+            }
+            pair_len[25*a + b + 312] = l;
+
+            i = MUL13(ABS(a)) + ABS(b);
+            pair_len2[25*a + b + 312] = (uint64_t)(huff9[i][FIRSTINTAB] + nz) |
+                                        (uint64_t)(huff10[i][FIRSTINTAB] + nz) << 16;
+        }
+    }
+}
+
+/* (With FAAC_STATIC_MEMORY, faacEncOpen() has already set the buffers up.) */
 void HuffmanInit(CoderInfo *coderInfo, uint32_t numChannels)
 {
+#ifndef FAAC_STATIC_MEMORY
     uint32_t channel;
-
     for (channel = 0; channel < numChannels; channel++) {
-#ifdef FAAC_STATIC_MEMORY        
-        coderInfo[channel].data = (int32_t*)faac_huff_data[channel];
-        coderInfo[channel].len = (int32_t*)faac_huff_len[channel];
-#else
         coderInfo[channel].data = (int32_t*)AllocMemory((5*FRAME_LEN)*sizeof(int32_t));
         coderInfo[channel].len = (int32_t*)AllocMemory((5*FRAME_LEN)*sizeof(int32_t));
-#endif
     }
+#endif
 }
 
 void HuffmanEnd(CoderInfo *coderInfo, uint32_t numChannels)
@@ -69,6 +127,85 @@ void HuffmanEnd(CoderInfo *coderInfo, uint32_t numChannels)
 #endif
 }
 
+/*
+  Chooses the codebooks of the scalefactor bands first..last-1, which are coded
+  as sections of bands that share a codebook.  Each section costs 'side_bits' of
+  side information, so it can pay to code a band with a codebook that is not
+  its cheapest one, to make it part of its neighbours' section.  The cheapest
+  choice is found by dynamic programming over the bands: cost[b] is the least
+  number of bits for the bands so far, given that the last of them uses
+  codebook b.  (The longer section lengths need more side information, see
+  SortBookNumbers(); that is ignored here.)
+*/
+static int32_t SectionSearch(CoderInfo *coderInfo,
+                             BandBits *band_bits,
+                             int32_t first,
+                             int32_t last)
+{
+    register int32_t sfb, b;
+    int32_t cost[NUM_BOOKS];
+    uchar_t from[MAX_SCFAC_BANDS][NUM_BOOKS];  /* the codebook of the band before */
+    int32_t side_bits;
+    int32_t best, best_book, least, new_book, extend, c;
+    BandBits *prev, *cur;
+
+    if (coderInfo->block_type == ONLY_SHORT_WINDOW)
+        side_bits = 3;
+    else
+        side_bits = 5;
+#ifdef DRM
+    side_bits += 5;
+#else
+    side_bits += 4;
+#endif
+
+    /* the first band opens a section */
+    cur = &band_bits[first];
+    best = 1 << 30;
+    best_book = cur->first_book;
+    for (b = cur->first_book; b <= cur->last_book; b++) {
+        cost[b] = side_bits + cur->bits[b];
+        if (cost[b] < best) {
+            best = cost[b];
+            best_book = b;
+        }
+    }
+
+    /* (the choices are written as conditional expressions, as they are hard to predict) */
+    for (sfb = first+1; sfb < last; sfb++) {
+        prev = cur;
+        cur = &band_bits[sfb];
+        best += side_bits;  /* the cost of opening a section here */
+        least = 1 << 30;
+        new_book = cur->first_book;
+
+        for (b = cur->first_book; b <= cur->last_book; b++) {
+            extend = ((b >= prev->first_book) && (b <= prev->last_book)) ? cost[b] : best + 1;
+#ifdef DRM
+            /* VCB11 sections are one band long */
+            if (b == 11)
+                extend += side_bits;
+#endif
+            c = (extend <= best) ? extend : best;
+            from[sfb][b] = (uchar_t)((extend <= best) ? b : best_book);
+            c += cur->bits[b];
+            cost[b] = c;
+            new_book = (c < least) ? b : new_book;
+            least = (c < least) ? c : least;
+        }
+        best = least;
+        best_book = new_book;
+    }
+
+    for (sfb = last-1; sfb >= first; sfb--) {
+        coderInfo->book_vector[sfb] = best_book;
+        if (sfb > first)
+            best_book = from[sfb][best_book];
+    }
+
+    return best;
+}
+
 int32_t BitSearch(CoderInfo *coderInfo,
                   int32_t *quant)  /* Quantized spectral values */
 /*
@@ -78,230 +215,205 @@ int32_t BitSearch(CoderInfo *coderInfo,
   case of long blocks and 112 for short blocks), and each element has a huffman codebook
   number assigned to it.
 
-  For a quick and simple algorithm, this function performs a binary
-  search across the sfb's (scale factor bands).  On the first approach, it calculates the
-  needed amount of bits if every sfb were its own section and transmitted its own huffman
-  codebook value side information (equal to 9 bits for a long block, 7 for a short).  The
-  next iteration combines adjacent sfb's, and calculates the bit rate for length two sfb
-  sections.  If any wider two-sfb section requires fewer bits than the sum of the two
-  single-sfb sections (below it in the binary tree), then the wider section will be chosen.
-  This process occurs until the sections are split into three uniform parts, each with an
-  equal amount of sfb's contained.
-
-  The binary tree is stored as a two-dimensional array.  Since this tree is not full, (there
-  are only 49 nodes, not 2^6 = 64), the numbering is a little complicated.  If the tree were
-  full, the top node would be 1.  It's children would be 2 and 3.  But, since this tree
-  is not full, the top row of three nodes are numbered {4,5,6}.  The row below it is
-  {8,9,10,11,12,13}, and so on.
-
-  The binary tree is called bit_stats[112][3].  There are 112 total nodes (some are not
-  used since it's not full).  bit_stats[x][0] holds the bit totals needed for the sfb sectioning
-  strategy represented by the node x in the tree.  bit_stats[x][1] holds the optimal huffman
-  codebook table that minimizes the bit rate, given the sectioning boundaries dictated by node x.
+  Each band is costed once, for every codebook that can code it (NoiselessBitCount()), and
+  SectionSearch() then chooses the codebooks, including the side information of the
+  sections in the cost.  Bands after the last non-zero one use codebook 0, as they are not
+  transmitted (max_sfb ends before them).  An all-zero band that joins a section gets the
+  scalefactor of the band before it, which costs a single bit.
+
+  It returns the number of bits needed for the spectral data and the section data.
 */
 
 {
-    register int32_t i,j,k;
-    int32_t hop;
-    int32_t min_book_choice[112][3];
-    int32_t bit_stats[240][3];
-    int32_t total_bit_count;
-    int32_t levels;
-    int32_t pow2levels;
-    int32_t fracpow2lev;
+    register int32_t sfb;
+    BandBits band_bits[MAX_SCFAC_BANDS];
+    int32_t nr_of_sfb = coderInfo->nr_of_sfb;
+    int32_t sfb_per_group, group, group_end, first, last;
+    int32_t previous;
+    int32_t total_bit_count = 0;
 
     /* Set local pointer to coderInfo book_vector */
     int32_t* book_vector = coderInfo -> book_vector;
 
-    levels = 6;
+    NoiselessBitCount(coderInfo, quant, band_bits);
 
-/* #define SLOW */
-
-#ifdef SLOW
-    for(i = 0; i < 5; i++) {
-#else
-        i = 0;
-#endif
-        hop = 1 << i;
+    if (coderInfo->block_type == ONLY_SHORT_WINDOW)
+        sfb_per_group = nr_of_sfb / coderInfo->num_window_groups;
+    else
+        sfb_per_group = nr_of_sfb;
 
-        NoiselessBitCount(coderInfo, quant, hop, min_book_choice);
-
-        /* load up the (not-full) binary search tree with the min_book_choice values */
-        k=0;
-        total_bit_count = 0;
-
-	pow2levels = 1 << (levels - i);
-	fracpow2lev = pow2levels + (coderInfo->nr_of_sfb >> i);
-
-        for (j=pow2levels; j < fracpow2lev; j++) {
-            bit_stats[j][0] = min_book_choice[k][0]; /* the minimum bit cost for this section */
-            bit_stats[j][1] = min_book_choice[k][1]; /* used with this huffman book number */
-
-#ifdef SLOW
-            if (i>0){  /* not on the lowest level, grouping more than one signle scalefactor band per section*/
-                if  (bit_stats[j][0] < bit_stats[j<<1][0] + bit_stats[(j<<1)+1][0]){
+    /* bands that are not transmitted */
+    for (last = nr_of_sfb; last > 0; last--) {
+        if (band_bits[last-1].first_book != 0)
+            break;
+    }
+    for (sfb = last; sfb < nr_of_sfb; sfb++) {
+        if ( (book_vector[sfb]!=INTENSITY_HCB)&&(book_vector[sfb]!=INTENSITY_HCB2) )
+            book_vector[sfb] = 0;
+    }
 
-                    /* it is cheaper to combine surrounding sfb secionts into one larger huffman book section */
-                    for(n=k;n<k+hop;n++) { /* write the optimal huffman book value for the new larger section */
-                        if ( (book_vector[n]!=INTENSITY_HCB)&&(book_vector[n]!=INTENSITY_HCB2) ) { /* Don't merge with IS bands */
-                            book_vector[n] = bit_stats[j][1];
-                        }
-                    }
-                } 
-                else {  /* it was cheaper to transmit the smaller huffman table sections */
-                    bit_stats[j][0] = bit_stats[j<<1][0] + bit_stats[(j<<1)+1][0];
-                }
-	    } 
-            else
-#endif
-	    {  /* during the first stage of the iteration, all sfb's are individual sections */
-                if ( (book_vector[k]!=INTENSITY_HCB)&&(book_vector[k]!=INTENSITY_HCB2) ) {
-                    book_vector[k] = bit_stats[j][1];  /* initially, set all sfb's to their own optimal section table values */
-                }
+    /* sections end at window groups and at intensity stereo bands */
+    for (group = 0; group < last; group += sfb_per_group) {
+        group_end = min(group + sfb_per_group, last);
+        for (first = group; first < group_end; first = sfb + 1) {
+            for (sfb = first; sfb < group_end; sfb++) {
+                if ( (book_vector[sfb]==INTENSITY_HCB)||(book_vector[sfb]==INTENSITY_HCB2) )
+                    break;
             }
-            total_bit_count = total_bit_count +  bit_stats[j][0];
-            k=k+hop;
+            if (sfb > first)
+                total_bit_count += SectionSearch(coderInfo, band_bits, first, sfb);
         }
-#ifdef SLOW
     }
-#endif
-    /*   book_vector[k] = book_vector[k-1]; */
+
+    /* an all-zero band in a section repeats the previous scalefactor */
+    previous = coderInfo->scale_factor[0];
+    for (sfb = 0; sfb < last; sfb++) {
+        if ( (book_vector[sfb]==0)||(book_vector[sfb]==INTENSITY_HCB)||(book_vector[sfb]==INTENSITY_HCB2) )
+            continue;
+        if (band_bits[sfb].first_book == 0)
+            coderInfo->scale_factor[sfb] = previous;
+        previous = coderInfo->scale_factor[sfb];
+    }
+
     return(total_bit_count);
 }
 
 
-int32_t NoiselessBitCount(CoderInfo *coderInfo,
-                          int32_t *quant,
-                          int32_t hop,
-                          int32_t min_book_choice[112][3])
+void NoiselessBitCount(CoderInfo *coderInfo,
+                       int32_t *quant,
+                       BandBits *band_bits)
 {
-    register int32_t i,j,k;
+    register int32_t i,b;
 
     /*
      This function inputs:
      - the quantized spectral data, 'quant[]';
-     - all of the huffman codebooks, 'huff[][]';
-     - the size of the sections, in scalefactor bands (SFB's), 'hop';
-     - an empty matrix, min_book_choice[][] passed to it;
+     - an empty array, band_bits[] passed to it;
 
      This function outputs:
-     - the matrix, min_book_choice.  It is a two dimensional matrix, with its
-     rows corresponding to spectral sections.  The 0th column corresponds to
-     the bits needed to code a section with 'hop' scalefactors bands wide, all using
-     the same huffman codebook.  The 1st column contains the huffman codebook number
-     that allows the minimum number of bits to be used.
+     - the array, band_bits[], with an element for each scalefactor band.  It
+     holds the range of codebooks that can code the band and the number of bits
+     needed to code the band with each of them.
 
      Other notes:
-     - Initally, the dynamic range is calculated for each spectral section.  The section
+     - Initally, the dynamic range is calculated for each band.  The band
      can only be entropy coded with books that have an equal or greater dynamic range
-     than the section's spectral data.  The exception to this is for the 11th ESC codebook.
+     than the band's spectral data.  The exception to this is for the 11th ESC codebook.
      If the dynamic range is larger than 16, then an escape code is appended after the
      table 11 codeword which encodes the larger value explicity in a pseudo-non-uniform
-     quantization method.
-
+     quantization method.  Only codebook 0 codes an all-zero band for free, but any
+     codebook can code it; those costs follow from the length of the all-zero tuple.
+     - A band is costed for all of its codebooks in one pass (see quad_len[] etc.).
     */
 
     int32_t max_sb_coeff;
-    int32_t book_choice[12][2];
-    int32_t total_bits_cost = 0;
-    int32_t offset, length, end;
-    int32_t q;
+    int32_t offset, length;
+    int32_t *q, *bits;
+    uint64_t sum, sum2;
 
     /* set local pointer to sfb_offset */
     int32_t *sfb_offset = coderInfo->sfb_offset;
     int32_t nr_of_sfb = coderInfo->nr_of_sfb;
-
-    /* each section is 'hop' scalefactor bands wide */
-    for (i=0; i < nr_of_sfb; i=i+hop) {
-#ifdef SLOW
-        if ((i+hop) > nr_of_sfb)
-            q = nr_of_sfb;
-        else
-#endif
-            q = i+hop;
-        {
-            /* find the maximum absolute value in the current spectral section, to see what tables are available to use */
+    int32_t sfb;
+
+    for (sfb = 0; sfb < nr_of_sfb; sfb++) {
+        offset = sfb_offset[sfb];
+        length = sfb_offset[sfb+1] - offset;
+        q = quant + offset;
+        bits = band_bits[sfb].bits;
+
+        /* find the maximum absolute value in the band, to see what tables are available to use */
+        if (faac_simd_kernels.max_abs)
+            max_sb_coeff = faac_simd_kernels.max_abs(q, length);
+        else {
             max_sb_coeff = 0;
-            for (j=sfb_offset[i]; j<sfb_offset[q]; j++) {  /* snl */
-                if (ABS(quant[j]) > max_sb_coeff)
-                    max_sb_coeff = ABS(quant[j]);
+            for (i = 0; i < length; i++) {
+                if (ABS(q[i]) > max_sb_coeff)
+                    max_sb_coeff = ABS(q[i]);
             }
+        }
 
-            j = 0;
-            offset = sfb_offset[i];
-#ifdef SLOW
-            if ((i+hop) > nr_of_sfb) {
-                end = sfb_offset[nr_of_sfb];
-            } else
-#endif
-                end = sfb_offset[q];
-            length = end - offset;
-
-            /* all spectral coefficients in this section are zero */
-            if (max_sb_coeff == 0) {
-                book_choice[j][0] = CalcBits(coderInfo,0,quant,offset,length);
-                book_choice[j++][1] = 0;
+        /* all spectral coefficients in this band are zero */
+        if (max_sb_coeff == 0) {
+            band_bits[sfb].first_book = 0;
+            band_bits[sfb].last_book = 11;
+            bits[0] = 0;
+            for (b = 1; b < 5; b++)
+                bits[b] = (length>>2)*LEN_FIELD(quad_len[312], b-1);
+            for (b = 5; b < 9; b++)
+                bits[b] = (length>>1)*LEN_FIELD(pair_len[312], b-5);
+            for (b = 9; b < 11; b++)
+                bits[b] = (length>>1)*LEN_FIELD(pair_len2[312], b-9);
+            bits[11] = (length>>1)*huff11[0][FIRSTINTAB];
+            for (b = 1; b < NUM_BOOKS; b++)
+                bits[b] += 1;  /* the scalefactor, see BitSearch() */
+        }
+        else if (max_sb_coeff < 3) {
+            sum = 0;
+            for (i = 0; i < length; i += 4)
+                sum += quad_len[QUAD_INDEX(q+i)];
+            if (max_sb_coeff < 2) {
+                band_bits[sfb].first_book = 1;
+                band_bits[sfb].last_book = 4;
+                bits[1] = LEN_FIELD(sum, 0);
+                bits[2] = LEN_FIELD(sum, 1);
+                bits[3] = LEN_FIELD(sum, 2);
+                bits[4] = LEN_FIELD(sum, 3);
             }
-            else {  /* if the section does have non-zero coefficients */
-                if ( max_sb_coeff < 2) {
-                    book_choice[j][0] = CalcBits(coderInfo,1,quant,offset,length);
-                    book_choice[j++][1] = 1;
-                    book_choice[j][0] = CalcBits(coderInfo,2,quant,offset,length);
-                    book_choice[j++][1] = 2;
-                    book_choice[j][0] = CalcBits(coderInfo,3,quant,offset,length);
-                    book_choice[j++][1] = 3;
-                }
-                else if (max_sb_coeff < 3) {
-                    book_choice[j][0] = CalcBits(coderInfo,3,quant,offset,length);
-                    book_choice[j++][1] = 3;
-                    book_choice[j][0] = CalcBits(coderInfo,4,quant,offset,length);
-                    book_choice[j++][1] = 4;
-                    book_choice[j][0] = CalcBits(coderInfo,5,quant,offset,length);
-                    book_choice[j++][1] = 5;
-                }
-                else if (max_sb_coeff < 5) {
-                    book_choice[j][0] = CalcBits(coderInfo,5,quant,offset,length);
-                    book_choice[j++][1] = 5;
-                    book_choice[j][0] = CalcBits(coderInfo,6,quant,offset,length);
-                    book_choice[j++][1] = 6;
-                    book_choice[j][0] = CalcBits(coderInfo,7,quant,offset,length);
-                    book_choice[j++][1] = 7;
-                }
-                else if (max_sb_coeff < 8) {
-                    book_choice[j][0] = CalcBits(coderInfo,7,quant,offset,length);
-                    book_choice[j++][1] = 7;
-                    book_choice[j][0] = CalcBits(coderInfo,8,quant,offset,length);
-                    book_choice[j++][1] = 8;
-                    book_choice[j][0] = CalcBits(coderInfo,9,quant,offset,length);
-                    book_choice[j++][1] = 9;
-                }
-                else if (max_sb_coeff < 13) {
-                    book_choice[j][0] = CalcBits(coderInfo,9,quant,offset,length);
-                    book_choice[j++][1] = 9;
-                    book_choice[j][0] = CalcBits(coderInfo,10,quant,offset,length);
-                    book_choice[j++][1] = 10;
-                }
-                /* (max_sb_coeff >= 13), choose table 11 */
-                else {
-                    book_choice[j][0] = CalcBits(coderInfo,11,quant,offset,length);
-                    book_choice[j++][1] = 11;
-                }
+            else {
+                band_bits[sfb].first_book = 3;
+                band_bits[sfb].last_book = 8;
+                bits[3] = LEN_FIELD(sum, 2);
+                bits[4] = LEN_FIELD(sum, 3);
+                sum = 0;
+                for (i = 0; i < length; i += 2)
+                    sum += pair_len[PAIR_INDEX(q+i)];
+                bits[5] = LEN_FIELD(sum, 0);
+                bits[6] = LEN_FIELD(sum, 1);
+                bits[7] = LEN_FIELD(sum, 2);
+                bits[8] = LEN_FIELD(sum, 3);
             }
-
-            /* find the minimum bit cost and table number for huffman coding this scalefactor section */
-            min_book_choice[i][1] = book_choice[0][1];
-            min_book_choice[i][0] = book_choice[0][0];
-
-            for (k=1;k<j;k++) {
-                if (book_choice[k][0] < min_book_choice[i][0]){
-                    min_book_choice[i][1] = book_choice[k][1];
-                    min_book_choice[i][0] = book_choice[k][0];
-                }
+        }
+        else if (max_sb_coeff < 5) {
+            band_bits[sfb].first_book = 5;
+            band_bits[sfb].last_book = 8;
+            sum = 0;
+            for (i = 0; i < length; i += 2)
+                sum += pair_len[PAIR_INDEX(q+i)];
+            bits[5] = LEN_FIELD(sum, 0);
+            bits[6] = LEN_FIELD(sum, 1);
+            bits[7] = LEN_FIELD(sum, 2);
+            bits[8] = LEN_FIELD(sum, 3);
+        }
+        else if (max_sb_coeff < 8) {
+            band_bits[sfb].first_book = 7;
+            band_bits[sfb].last_book = 10;
+            sum = sum2 = 0;
+            for (i = 0; i < length; i += 2) {
+                sum += pair_len[PAIR_INDEX(q+i)];
+                sum2 += pair_len2[PAIR_INDEX(q+i)];
             }
-            total_bits_cost += min_book_choice[i][0];
+            bits[7] = LEN_FIELD(sum, 2);
+            bits[8] = LEN_FIELD(sum, 3);
+            bits[9] = LEN_FIELD(sum2, 0);
+            bits[10] = LEN_FIELD(sum2, 1);
+        }
+        else if (max_sb_coeff < 13) {
+            band_bits[sfb].first_book = 9;
+            band_bits[sfb].last_book = 10;
+            sum2 = 0;
+            for (i = 0; i < length; i += 2)
+                sum2 += pair_len2[PAIR_INDEX(q+i)];
+            bits[9] = LEN_FIELD(sum2, 0);
+            bits[10] = LEN_FIELD(sum2, 1);
+        }
+        /* (max_sb_coeff >= 13), choose table 11 */
+        else {
+            band_bits[sfb].first_book = 11;
+            band_bits[sfb].last_book = 11;
+            bits[11] = CalcBits(coderInfo, 11, quant, offset, length);
         }
     }
-    return(total_bits_cost);
 }
 
 static int32_t CalculateEscSequence(int32_t input, int32_t *len_esc_sequence)
@@ -44,6 +44,15 @@ extern "C" {
 #define INTENSITY_HCB 15
 #define INTENSITY_HCB2 14
 
+/* the bits needed to code a scalefactor band with codebooks 0..11 */
+#define NUM_BOOKS 12
+
+typedef struct {
+    int32_t first_book;         /* the codebooks that can code the band */
+    int32_t last_book;
+    int32_t bits[NUM_BOOKS];    /* (valid from first_book to last_book) */
+} BandBits;
+
 
 #define ABS(A) ((A) < 0 ? (-A) : (A))
 
@@ -65,16 +74,16 @@ extern "C" {
 
 #include "frame.h"
 
+void HuffmanTablesInit(void); /* once, for all encoders */
 void HuffmanInit(CoderInfo *coderInfo, uint32_t numChannels);
 void HuffmanEnd(CoderInfo *coderInfo, uint32_t numChannels);
 
 int32_t BitSearch(CoderInfo *coderInfo,
               int32_t *quant);
 
-int32_t NoiselessBitCount(CoderInfo *coderInfo,
-                      int32_t *quant,
-                      int32_t hop,
-                      int32_t min_book_choice[112][3]);
+void NoiselessBitCount(CoderInfo *coderInfo,
+                       int32_t *quant,
+                       BandBits *band_bits);
 
 //static int32_t CalculateEscSequence(int32_t input, int32_t *len_esc_sequence);
 
@@ -19,7 +19,7 @@
  * $Id: hufftab.h,v 1.3 2006/02/20 22:53:30 kyang Exp $
  */
 
-ushort_t huff1[][2] = {
+const ushort_t huff1[][2] = {
         { 11,  2040},
         { 9,  497},{ 11,  2045},{ 10,  1013},{ 7,  104},{ 10,  1008},
         { 11,  2039},{ 9,  492},{ 11,  2037},{ 10,  1009},{ 7,  114},
@@ -38,7 +38,7 @@ ushort_t huff1[][2] = {
         { 10,  1015},{ 11,  2038},{ 9,  480},{ 11,  2041},{ 10,  1010},
         { 7,  102},{ 9,  501},{ 11,  2047},{ 9,  503},{ 11,  2036}
     };
-ushort_t huff2[][2] = {
+const ushort_t huff2[][2] = {
     { 9,  499},
         { 7,  111},{ 9,  509},{ 8,  235},{ 6,  35},{ 8,  234},
         { 9,  503},{ 8,  232},{ 9,  506},{ 8,  242},{ 6,  45},
@@ -57,7 +57,7 @@ ushort_t huff2[][2] = {
         { 7,  106},{ 9,  507},{ 7,  114},{ 9,  510},{ 7,  105},
         { 6,  46},{ 8,  246},{ 9,  511},{ 7,  109},{ 9,  502}
     };
-ushort_t huff3[][2] = {
+const ushort_t huff3[][2] = {
         { 1,  0},
         { 4,  9},{ 8,  239},{ 4,  11},{ 5,  25},{ 8,  240},
         { 9,  491},{ 9,  486},{ 10,  1010},{ 4,  10},{ 6,  53},
@@ -76,7 +76,7 @@ ushort_t huff3[][2] = {
         { 15,  32764},{ 11,  2034},{ 12,  4085},{ 16,  65534},{ 10,  1012},
         { 11,  2039},{ 15,  32763},{ 12,  4087},{ 12,  4089},{ 15,  32762}
     };
-ushort_t huff4[][2] = {
+const ushort_t huff4[][2] = {
         { 4,  7},
         { 5,  22},{ 8,  246},{ 5,  24},{ 4,  8},{ 8,  239},
         { 9,  495},{ 8,  243},{ 11,  2040},{ 5,  25},{ 5,  23},
@@ -95,7 +95,7 @@ ushort_t huff4[][2] = {
         { 11,  2036},{ 11,  2039},{ 10,  1009},{ 12,  4094},{ 10,  1005},
         { 9,  497},{ 11,  2037},{ 11,  2046},{ 10,  1013},{ 11,  2044}
     };
-ushort_t huff5[][2] = {
+const ushort_t huff5[][2] = {
         { 13,  8191},
         { 12,  4087},{ 11,  2036},{ 11,  2024},{ 10,  1009},{ 11,  2030},
         { 11,  2041},{ 12,  4088},{ 13,  8189},{ 12,  4093},{ 11,  2033},
@@ -114,7 +114,7 @@ ushort_t huff5[][2] = {
         { 12,  4089},{ 13,  8188},{ 12,  4092},{ 12,  4085},{ 11,  2026},
         { 10,  1011},{ 10,  1010},{ 11,  2037},{ 12,  4091},{ 13,  8190}
     };
-ushort_t huff6[][2] = {
+const ushort_t huff6[][2] = {
         { 11,  2046},
         { 10,  1021},{ 9,  497},{ 9,  491},{ 9,  500},{ 9,  490},
         { 9,  496},{ 10,  1020},{ 11,  2045},{ 10,  1014},{ 9,  485},
@@ -133,7 +133,7 @@ ushort_t huff6[][2] = {
         { 10,  1018},{ 11,  2047},{ 10,  1017},{ 9,  502},{ 9,  493},
         { 9,  504},{ 9,  489},{ 9,  501},{ 10,  1019},{ 11,  2044}
     };
-ushort_t huff7[][2] = {
+const ushort_t huff7[][2] = {
         { 1,  0},
         { 3,  5},{ 6,  55},{ 7,  116},{ 8,  242},{ 9,  491},
         { 10,  1005},{ 11,  2039},{ 3,  4},{ 4,  12},{ 6,  53},
@@ -149,7 +149,7 @@ ushort_t huff7[][2] = {
         { 11,  2038},{ 10,  1008},{ 10,  1010},{ 10,  1014},{ 11,  2042},
         { 11,  2045},{ 12,  4092},{ 12,  4095}
     };
-ushort_t huff8[][2] = {
+const ushort_t huff8[][2] = {
         { 5,  14},
         { 4,  5},{ 5,  16},{ 6,  48},{ 7,  111},{ 8,  241},
         { 9,  506},{ 10,  1022},{ 4,  3},{ 3,  0},{ 4,  4},
@@ -165,7 +165,7 @@ ushort_t huff8[][2] = {
         { 10,  1021},{ 8,  243},{ 8,  244},{ 8,  247},{ 9,  503},
         { 9,  507},{ 9,  508},{ 10,  1023}
     };
-ushort_t huff9[][2] = {
+const ushort_t huff9[][2] = {
         { 1,  0},
         { 3,  5},{ 6,  55},{ 8,  231},{ 9,  478},{ 10,  974},
         { 10,  985},{ 11,  1992},{ 11,  1997},{ 12,  4040},{ 12,  4061},
@@ -202,7 +202,7 @@ ushort_t huff9[][2] = {
         { 13,  8154},{ 13,  8165},{ 13,  8178},{ 14,  16378},{ 14,  16375},
         { 14,  16380},{ 14,  16381},{ 15,  32767}
     };
-ushort_t huff10[][2] = {
+const ushort_t huff10[][2] = {
         { 6,  34},
         { 5,  8},{ 6,  29},{ 6,  38},{ 7,  95},{ 8,  211},
         { 9,  463},{ 10,  976},{ 10,  983},{ 10,  1005},{ 11,  2032},
@@ -239,7 +239,7 @@ ushort_t huff10[][2] = {
         { 10,  998},{ 10,  1008},{ 11,  2025},{ 11,  2031},{ 12,  4088},
         { 12,  4094},{ 12,  4092},{ 12,  4095}
     };
-ushort_t huff11[][2] = {
+const ushort_t huff11[][2] = {
         { 4,  0},
         { 5,  6},{ 6,  25},{ 7,  61},{ 8,  156},{ 8,  198},
         { 9,  423},{ 10,  912},{ 10,  962},{ 10,  991},{ 11,  2022},
@@ -300,7 +300,7 @@ ushort_t huff11[][2] = {
         { 8,  172},{ 8,  169},{ 8,  177},{ 8,  179},{ 8,  187},
         { 8,  192},{ 9,  399},{ 5,  4}
     };
-unsigned int huff12[][2] = {
+const unsigned int huff12[][2] = {
         { 18,  262120},
         { 18,  262118},{ 18,  262119},{ 18,  262117},{ 19,  524277},{ 19,  524273},
         { 19,  524269},{ 19,  524278},{ 19,  524270},{ 19,  524271},{ 19,  524272},
@@ -0,0 +1,607 @@
+/*
+ * FAAC - Freeware Advanced Audio Coder
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * Every product in the scalar loops is computed as MUL_R(), MUL_F() or as
+ * (x*(int64_t)w)>>FRAC2COEF_BIT, and the sums of products are then stored
+ * into 32-bit coef_t.  So only bits [shift, shift+31] of each 64-bit product
+ * matter, and all the additions can wrap around in 32 bits.  The kernels
+ * below compute exactly those bits, which makes them bit-exact with the
+ * scalar loops.
+ */
+
+#include <stdlib.h>
+
+#include "fixed.h"
+#include "simd.h"
+#include "util.h"
+
+#if defined(FAAC_FLOAT)
+/* the kernels are for the fixed-point build only */
+#elif defined(__i386__) || defined(__x86_64__)
+#define FAAC_SIMD_X86   1
+#include <emmintrin.h>
+#include <immintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define FAAC_SIMD_NEON  1
+#include <arm_neon.h>
+#endif
+
+SIMD_Kernels faac_simd_kernels;
+static int32_t faac_simd_initialized = 0;
+
+#if defined(FAAC_SIMD_X86) || defined(FAAC_SIMD_NEON)
+
+/* the scalar loops, for whatever is left over after the vector loops */
+static void butterflies_c( coef_t *xr1, coef_t *xi1, coef_t *xr2, coef_t *xi2,
+                           const fftfloat *wr, const fftfloat *wi, int32_t k, int32_t n )
+{
+    int64_t v2r, v2i;
+
+    for (; k < n; k++) {
+        v2r = MUL_R(xr2[k],wr[k]) - MUL_R(xi2[k],wi[k]);
+        v2i = MUL_R(xr2[k],wi[k]) + MUL_R(xi2[k],wr[k]);
+        xr2[k] = xr1[k] - v2r;
+        xr1[k] += v2r;
+        xi2[k] = xi1[k] - v2i;
+        xi1[k] += v2i;
+    }
+}
+
+static void twiddle_c( coef_t *xr, coef_t *xi,
+                       const fftfloat *cosx, const fftfloat *sinx, int32_t k, int32_t n )
+{
+    coef_t tempr, tempi;
+
+    for (; k < n; k++) {
+        tempr = xr[k];
+        tempi = xi[k];
+        xr[k] = MUL_R(tempr,cosx[k]) + MUL_R(tempi,sinx[k]);
+        xi[k] = MUL_R(tempi,cosx[k]) - MUL_R(tempr,sinx[k]);
+    }
+}
+
+static void window_c( coef_t *out, const int16_t *in, const coef_t *win, int32_t k, int32_t n )
+{
+    for (; k < n; k++)
+        out[k] = (in[k<<1]*((int64_t)win[k]))>>FRAC2COEF_BIT;
+}
+
+static int64_t energy_c( const coef_t *x, int32_t k, int32_t n )
+{
+    int64_t eng = 0;
+
+    for (; k < n; k++)
+        eng += (int64_t)(COEF2INT(x[k]))*COEF2INT(x[k]);
+    return eng;
+}
+
+static void quantize_c( int32_t *ix, coef_t *x, const coef_t *xr, int32_t fix, int32_t k, int32_t n )
+{
+    static const coef_t realconst1 = COEF_CONST(0.5);
+
+    for (; k < n; k++) {
+        x[k] = MUL_F(x[k],fix);
+        ix[k] = (int32_t)COEF2INT(x[k]+realconst1);
+        if (xr[k] < 0)
+            ix[k] = -ix[k];
+    }
+}
+
+static int32_t max_abs_c( const int32_t *x, int32_t m, int32_t k, int32_t n )
+{
+    for (; k < n; k++) {
+        if (x[k] > m)
+            m = x[k];
+        else if (-x[k] > m)
+            m = -x[k];
+    }
+    return m;
+}
+
+#endif
+
+#ifdef FAAC_SIMD_X86
+
+/* bits [shift, shift+31] of each of the 64-bit products a*b (signed).
+   SSE2 has only an unsigned 32x32->64 bit multiply, so the result is then
+   corrected for negative operands, using
+       a*b = (unsigned)a*(unsigned)b - ((a<0 ? b : 0) + (b<0 ? a : 0))<<32
+   (which, shifted right, affects only the upper 'shift' bits of the result). */
+__attribute__((target("sse2")))
+static INLINE __m128i mul_shift_sse2( __m128i a, __m128i b, int32_t shift )
+{
+    __m128i even, odd, fix;
+    const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+
+    even = _mm_srli_epi64(_mm_mul_epu32(a, b), shift);
+    odd = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), 32-shift);
+    fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                        _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+    return _mm_sub_epi32(_mm_or_si128(_mm_and_si128(even, lo_mask), _mm_andnot_si128(lo_mask, odd)),
+                         _mm_slli_epi32(fix, 32-shift));
+}
+
+__attribute__((target("sse2")))
+static void butterflies_sse2( coef_t *xr1, coef_t *xi1, coef_t *xr2, coef_t *xi2,
+                              const fftfloat *wr, const fftfloat *wi, int32_t n )
+{
+    register int32_t k;
+    __m128i r1, i1, r2, i2, vwr, vwi, vr, vi;
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        r2 = _mm_loadu_si128((const __m128i *)(xr2+k));
+        i2 = _mm_loadu_si128((const __m128i *)(xi2+k));
+        vwr = _mm_loadu_si128((const __m128i *)(wr+k));
+        vwi = _mm_loadu_si128((const __m128i *)(wi+k));
+        vr = _mm_sub_epi32(mul_shift_sse2(r2, vwr, REAL_BITS), mul_shift_sse2(i2, vwi, REAL_BITS));
+        vi = _mm_add_epi32(mul_shift_sse2(r2, vwi, REAL_BITS), mul_shift_sse2(i2, vwr, REAL_BITS));
+        r1 = _mm_loadu_si128((const __m128i *)(xr1+k));
+        i1 = _mm_loadu_si128((const __m128i *)(xi1+k));
+        _mm_storeu_si128((__m128i *)(xr2+k), _mm_sub_epi32(r1, vr));
+        _mm_storeu_si128((__m128i *)(xr1+k), _mm_add_epi32(r1, vr));
+        _mm_storeu_si128((__m128i *)(xi2+k), _mm_sub_epi32(i1, vi));
+        _mm_storeu_si128((__m128i *)(xi1+k), _mm_add_epi32(i1, vi));
+    }
+    butterflies_c(xr1, xi1, xr2, xi2, wr, wi, k, n);
+}
+
+__attribute__((target("sse2")))
+static void twiddle_sse2( coef_t *xr, coef_t *xi,
+                          const fftfloat *cosx, const fftfloat *sinx, int32_t n )
+{
+    register int32_t k;
+    __m128i r, i, c, s;
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        r = _mm_loadu_si128((const __m128i *)(xr+k));
+        i = _mm_loadu_si128((const __m128i *)(xi+k));
+        c = _mm_loadu_si128((const __m128i *)(cosx+k));
+        s = _mm_loadu_si128((const __m128i *)(sinx+k));
+        _mm_storeu_si128((__m128i *)(xr+k),
+                         _mm_add_epi32(mul_shift_sse2(r, c, REAL_BITS), mul_shift_sse2(i, s, REAL_BITS)));
+        _mm_storeu_si128((__m128i *)(xi+k),
+                         _mm_sub_epi32(mul_shift_sse2(i, c, REAL_BITS), mul_shift_sse2(r, s, REAL_BITS)));
+    }
+    twiddle_c(xr, xi, cosx, sinx, k, n);
+}
+
+__attribute__((target("sse2")))
+static void window_sse2( coef_t *out, const int16_t *in, const coef_t *win, int32_t n )
+{
+    register int32_t k;
+    __m128i x;
+
+    /* the load takes 2*4 samples, the last of them past our channel's last
+       sample, so leave the last group to window_c() */
+    for (k = 0; k + 4 < n; k += 4) {
+        /* keep the even (i.e., our channel's) 16-bit samples, sign-extended */
+        x = _mm_loadu_si128((const __m128i *)(in+(k<<1)));
+        x = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+        _mm_storeu_si128((__m128i *)(out+k),
+                         mul_shift_sse2(x, _mm_loadu_si128((const __m128i *)(win+k)), FRAC2COEF_BIT));
+    }
+    window_c(out, in, win, k, n);
+}
+
+__attribute__((target("sse2")))
+static int64_t energy_sse2( const coef_t *x, int32_t n )
+{
+    register int32_t k;
+    __m128i v, s, sum = _mm_setzero_si128();
+    int64_t eng[2];
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        /* |COEF2INT(x)|, as the multiply is unsigned */
+        v = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(x+k)), COEF_BITS);
+        s = _mm_srai_epi32(v, 31);
+        v = _mm_sub_epi32(_mm_xor_si128(v, s), s);
+        sum = _mm_add_epi64(sum, _mm_mul_epu32(v, v));
+        v = _mm_srli_epi64(v, 32);
+        sum = _mm_add_epi64(sum, _mm_mul_epu32(v, v));
+    }
+    _mm_storeu_si128((__m128i *)eng, sum);
+    return eng[0] + eng[1] + energy_c(x, k, n);
+}
+
+__attribute__((target("sse2")))
+static void quantize_sse2( int32_t *ix, coef_t *x, const coef_t *xr, int32_t fix, int32_t n )
+{
+    register int32_t k;
+    __m128i v, s;
+    const __m128i vfix = _mm_set1_epi32(fix);
+    const __m128i half = _mm_set1_epi32(COEF_CONST(0.5));
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        v = mul_shift_sse2(_mm_loadu_si128((const __m128i *)(x+k)), vfix, FRAC_BITS);
+        _mm_storeu_si128((__m128i *)(x+k), v);
+        v = _mm_srai_epi32(_mm_add_epi32(v, half), COEF_BITS);
+        s = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(xr+k)), 31);
+        _mm_storeu_si128((__m128i *)(ix+k), _mm_sub_epi32(_mm_xor_si128(v, s), s));
+    }
+    quantize_c(ix, x, xr, fix, k, n);
+}
+
+__attribute__((target("sse2")))
+static int32_t max_abs_sse2( const int32_t *x, int32_t n )
+{
+    register int32_t k;
+    __m128i v, s, m = _mm_setzero_si128();
+    int32_t mx[4];
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        v = _mm_loadu_si128((const __m128i *)(x+k));
+        s = _mm_srai_epi32(v, 31);
+        v = _mm_sub_epi32(_mm_xor_si128(v, s), s);
+        s = _mm_cmpgt_epi32(v, m);
+        m = _mm_or_si128(_mm_and_si128(s, v), _mm_andnot_si128(s, m));
+    }
+    _mm_storeu_si128((__m128i *)mx, m);
+    return max_abs_c(x, max(max(mx[0], mx[1]), max(mx[2], mx[3])), k, n);
+}
+
+__attribute__((target("avx2")))
+static INLINE __m256i mul_shift_avx2( __m256i a, __m256i b, int32_t shift )
+{
+    __m256i even, odd;
+
+    even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), shift);
+    odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32-shift), 0xaa);
+}
+
+__attribute__((target("avx2")))
+static void butterflies_avx2( coef_t *xr1, coef_t *xi1, coef_t *xr2, coef_t *xi2,
+                              const fftfloat *wr, const fftfloat *wi, int32_t n )
+{
+    register int32_t k;
+    __m256i r1, i1, r2, i2, vwr, vwi, vr, vi;
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        r2 = _mm256_loadu_si256((const __m256i *)(xr2+k));
+        i2 = _mm256_loadu_si256((const __m256i *)(xi2+k));
+        vwr = _mm256_loadu_si256((const __m256i *)(wr+k));
+        vwi = _mm256_loadu_si256((const __m256i *)(wi+k));
+        vr = _mm256_sub_epi32(mul_shift_avx2(r2, vwr, REAL_BITS), mul_shift_avx2(i2, vwi, REAL_BITS));
+        vi = _mm256_add_epi32(mul_shift_avx2(r2, vwi, REAL_BITS), mul_shift_avx2(i2, vwr, REAL_BITS));
+        r1 = _mm256_loadu_si256((const __m256i *)(xr1+k));
+        i1 = _mm256_loadu_si256((const __m256i *)(xi1+k));
+        _mm256_storeu_si256((__m256i *)(xr2+k), _mm256_sub_epi32(r1, vr));
+        _mm256_storeu_si256((__m256i *)(xr1+k), _mm256_add_epi32(r1, vr));
+        _mm256_storeu_si256((__m256i *)(xi2+k), _mm256_sub_epi32(i1, vi));
+        _mm256_storeu_si256((__m256i *)(xi1+k), _mm256_add_epi32(i1, vi));
+    }
+    if (k < n)
+        butterflies_sse2(xr1+k, xi1+k, xr2+k, xi2+k, wr+k, wi+k, n-k);
+}
+
+__attribute__((target("avx2")))
+static void twiddle_avx2( coef_t *xr, coef_t *xi,
+                          const fftfloat *cosx, const fftfloat *sinx, int32_t n )
+{
+    register int32_t k;
+    __m256i r, i, c, s;
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        r = _mm256_loadu_si256((const __m256i *)(xr+k));
+        i = _mm256_loadu_si256((const __m256i *)(xi+k));
+        c = _mm256_loadu_si256((const __m256i *)(cosx+k));
+        s = _mm256_loadu_si256((const __m256i *)(sinx+k));
+        _mm256_storeu_si256((__m256i *)(xr+k),
+                            _mm256_add_epi32(mul_shift_avx2(r, c, REAL_BITS), mul_shift_avx2(i, s, REAL_BITS)));
+        _mm256_storeu_si256((__m256i *)(xi+k),
+                            _mm256_sub_epi32(mul_shift_avx2(i, c, REAL_BITS), mul_shift_avx2(r, s, REAL_BITS)));
+    }
+    if (k < n)
+        twiddle_sse2(xr+k, xi+k, cosx+k, sinx+k, n-k);
+}
+
+__attribute__((target("avx2")))
+static void window_avx2( coef_t *out, const int16_t *in, const coef_t *win, int32_t n )
+{
+    register int32_t k;
+    __m256i x;
+
+    for (k = 0; k + 8 < n; k += 8) {
+        x = _mm256_loadu_si256((const __m256i *)(in+(k<<1)));
+        x = _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+        _mm256_storeu_si256((__m256i *)(out+k),
+                            mul_shift_avx2(x, _mm256_loadu_si256((const __m256i *)(win+k)), FRAC2COEF_BIT));
+    }
+    if (k < n)
+        window_sse2(out+k, in+(k<<1), win+k, n-k);
+}
+
+/* faac_pow34(), with the loops that scale x into the table's range replaced
+   by shift counts that are computed from the exponent of (float)x, and the
+   table lookups done with gathers */
+__attribute__((target("avx2")))
+static void pow34_avx2( coef_t *y, const coef_t *x, int32_t n )
+{
+    register int32_t k;
+    __m256i a, e, kl, kr, xs, i, v;
+#ifdef FAAC_LAGRANGE
+    __m256i v1;
+#endif
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i big = _mm256_set1_epi32(0xffffff);
+    const __m256i low7 = _mm256_set1_epi32(~0x7f);
+#ifdef FAAC_LAGRANGE
+    const __m256i frac = _mm256_set1_epi32((1<<FAAC_POW34_COEFCONST2)-1);
+#endif
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        a = _mm256_abs_epi32(_mm256_loadu_si256((const __m256i *)(x+k)));
+
+        /* e = floor(log2(a)); dropping the low bits of large values makes
+           the conversion exact, so it cannot round up to the next power of 2 */
+        e = _mm256_and_si256(a, _mm256_or_si256(_mm256_cmpgt_epi32(big, a), low7));
+        e = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(e)), 23),
+                             _mm256_set1_epi32(127));
+
+        /* the number of 4-bit shifts left (small a) or right (large a) */
+        kl = _mm256_srli_epi32(_mm256_max_epi32(_mm256_sub_epi32(_mm256_set1_epi32(20), e), zero), 2);
+        kr = _mm256_srli_epi32(_mm256_max_epi32(_mm256_sub_epi32(e, _mm256_set1_epi32(17)), zero), 2);
+        kl = _mm256_slli_epi32(kl, 2);
+        kr = _mm256_slli_epi32(kr, 2);
+
+        xs = _mm256_sllv_epi32(_mm256_srlv_epi32(a, kr), kl);
+#ifdef FAAC_LAGRANGE
+        /* v = table[i] + (((table[i+1]-table[i])*(xs&frac))>>COEFCONST2) */
+        i = _mm256_srli_epi32(xs, FAAC_POW34_COEFCONST2);
+        v = _mm256_i32gather_epi32((const int *)faac_table_pow34, i, 4);
+        v1 = _mm256_i32gather_epi32((const int *)faac_table_pow34+1, i, 4);
+        v1 = _mm256_mullo_epi32(_mm256_sub_epi32(v1, v), _mm256_and_si256(xs, frac));
+        v = _mm256_add_epi32(v, _mm256_srai_epi32(v1, FAAC_POW34_COEFCONST2));
+#else
+        i = _mm256_srli_epi32(_mm256_add_epi32(xs, _mm256_set1_epi32(FAAC_POW34_COEFCONST1)),
+                              FAAC_POW34_COEFCONST2);
+        v = _mm256_i32gather_epi32((const int *)faac_table_pow34, i, 4);
+#endif
+
+        /* y = table<<(3*kr/4) or table>>(3*kl/4) */
+        kl = _mm256_sub_epi32(kl, _mm256_srli_epi32(kl, 2));
+        kr = _mm256_sub_epi32(kr, _mm256_srli_epi32(kr, 2));
+        _mm256_storeu_si256((__m256i *)(y+k), _mm256_srlv_epi32(_mm256_sllv_epi32(v, kr), kl));
+    }
+    for (; k < n; k++)
+        y[k] = faac_pow34(x[k]);
+}
+
+__attribute__((target("avx2")))
+static int64_t energy_avx2( const coef_t *x, int32_t n )
+{
+    register int32_t k;
+    __m256i v, sum = _mm256_setzero_si256();
+    int64_t eng[4];
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        v = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *)(x+k)), COEF_BITS);
+        sum = _mm256_add_epi64(sum, _mm256_mul_epi32(v, v));
+        v = _mm256_srli_epi64(v, 32);
+        sum = _mm256_add_epi64(sum, _mm256_mul_epi32(v, v));
+    }
+    _mm256_storeu_si256((__m256i *)eng, sum);
+    return eng[0] + eng[1] + eng[2] + eng[3] + energy_c(x, k, n);
+}
+
+__attribute__((target("avx2")))
+static void quantize_avx2( int32_t *ix, coef_t *x, const coef_t *xr, int32_t fix, int32_t n )
+{
+    register int32_t k;
+    __m256i v;
+    const __m256i vfix = _mm256_set1_epi32(fix);
+    const __m256i half = _mm256_set1_epi32(COEF_CONST(0.5));
+
+    for (k = 0; k + 8 <= n; k += 8) {
+        v = mul_shift_avx2(_mm256_loadu_si256((const __m256i *)(x+k)), vfix, FRAC_BITS);
+        _mm256_storeu_si256((__m256i *)(x+k), v);
+        v = _mm256_srai_epi32(_mm256_add_epi32(v, half), COEF_BITS);
+        _mm256_storeu_si256((__m256i *)(ix+k),
+                            _mm256_sign_epi32(v, _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(xr+k)),
+                                                                 _mm256_set1_epi32(1))));
+    }
+    if (k < n)
+        quantize_sse2(ix+k, x+k, xr+k, fix, n-k);
+}
+
+__attribute__((target("avx2")))
+static int32_t max_abs_avx2( const int32_t *x, int32_t n )
+{
+    register int32_t k;
+    __m256i m = _mm256_setzero_si256();
+    __m128i h;
+
+    for (k = 0; k + 8 <= n; k += 8)
+        m = _mm256_max_epi32(m, _mm256_abs_epi32(_mm256_loadu_si256((const __m256i *)(x+k))));
+    h = _mm_max_epi32(_mm256_castsi256_si128(m), _mm256_extracti128_si256(m, 1));
+    h = _mm_max_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(1,0,3,2)));
+    h = _mm_max_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(2,3,0,1)));
+    return max_abs_c(x, _mm_cvtsi128_si32(h), k, n);
+}
+
+#endif /* FAAC_SIMD_X86 */
+
+#ifdef FAAC_SIMD_NEON
+
+/* bits [shift, shift+31] of each of the 64-bit products a*b (signed) */
+#define MUL_SHIFT_NEON(a, b, shift) \
+    vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b)), shift), \
+                 vshrn_n_s64(vmull_s32(vget_high_s32(a), vget_high_s32(b)), shift))
+
+static void butterflies_neon( coef_t *xr1, coef_t *xi1, coef_t *xr2, coef_t *xi2,
+                              const fftfloat *wr, const fftfloat *wi, int32_t n )
+{
+    register int32_t k;
+    int32x4_t r1, i1, r2, i2, vwr, vwi, vr, vi;
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        r2 = vld1q_s32(xr2+k);
+        i2 = vld1q_s32(xi2+k);
+        vwr = vld1q_s32(wr+k);
+        vwi = vld1q_s32(wi+k);
+        vr = vsubq_s32(MUL_SHIFT_NEON(r2, vwr, REAL_BITS), MUL_SHIFT_NEON(i2, vwi, REAL_BITS));
+        vi = vaddq_s32(MUL_SHIFT_NEON(r2, vwi, REAL_BITS), MUL_SHIFT_NEON(i2, vwr, REAL_BITS));
+        r1 = vld1q_s32(xr1+k);
+        i1 = vld1q_s32(xi1+k);
+        vst1q_s32(xr2+k, vsubq_s32(r1, vr));
+        vst1q_s32(xr1+k, vaddq_s32(r1, vr));
+        vst1q_s32(xi2+k, vsubq_s32(i1, vi));
+        vst1q_s32(xi1+k, vaddq_s32(i1, vi));
+    }
+    butterflies_c(xr1, xi1, xr2, xi2, wr, wi, k, n);
+}
+
+static void twiddle_neon( coef_t *xr, coef_t *xi,
+                          const fftfloat *cosx, const fftfloat *sinx, int32_t n )
+{
+    register int32_t k;
+    int32x4_t r, i, c, s;
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        r = vld1q_s32(xr+k);
+        i = vld1q_s32(xi+k);
+        c = vld1q_s32(cosx+k);
+        s = vld1q_s32(sinx+k);
+        vst1q_s32(xr+k, vaddq_s32(MUL_SHIFT_NEON(r, c, REAL_BITS), MUL_SHIFT_NEON(i, s, REAL_BITS)));
+        vst1q_s32(xi+k, vsubq_s32(MUL_SHIFT_NEON(i, c, REAL_BITS), MUL_SHIFT_NEON(r, s, REAL_BITS)));
+    }
+    twiddle_c(xr, xi, cosx, sinx, k, n);
+}
+
+static void window_neon( coef_t *out, const int16_t *in, const coef_t *win, int32_t n )
+{
+    register int32_t k;
+    int16x4x2_t x;
+
+    for (k = 0; k + 4 < n; k += 4) {
+        x = vld2_s16(in+(k<<1)); /* de-interleaves our channel's samples into x.val[0] */
+        vst1q_s32(out+k, MUL_SHIFT_NEON(vmovl_s16(x.val[0]), vld1q_s32(win+k), FRAC2COEF_BIT));
+    }
+    window_c(out, in, win, k, n);
+}
+
+static int64_t energy_neon( const coef_t *x, int32_t n )
+{
+    register int32_t k;
+    int32x4_t v;
+    int64x2_t sum = vdupq_n_s64(0);
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        v = vshrq_n_s32(vld1q_s32(x+k), COEF_BITS);
+        sum = vmlal_s32(sum, vget_low_s32(v), vget_low_s32(v));
+        sum = vmlal_s32(sum, vget_high_s32(v), vget_high_s32(v));
+    }
+    return vgetq_lane_s64(sum, 0) + vgetq_lane_s64(sum, 1) + energy_c(x, k, n);
+}
+
+static void quantize_neon( int32_t *ix, coef_t *x, const coef_t *xr, int32_t fix, int32_t n )
+{
+    register int32_t k;
+    int32x4_t v, s;
+    const int32x4_t vfix = vdupq_n_s32(fix);
+    const int32x4_t half = vdupq_n_s32(COEF_CONST(0.5));
+
+    for (k = 0; k + 4 <= n; k += 4) {
+        v = MUL_SHIFT_NEON(vld1q_s32(x+k), vfix, FRAC_BITS);
+        vst1q_s32(x+k, v);
+        v = vshrq_n_s32(vaddq_s32(v, half), COEF_BITS);
+        s = vshrq_n_s32(vld1q_s32(xr+k), 31);
+        vst1q_s32(ix+k, vsubq_s32(veorq_s32(v, s), s));
+    }
+    quantize_c(ix, x, xr, fix, k, n);
+}
+
+static int32_t max_abs_neon( const int32_t *x, int32_t n )
+{
+    register int32_t k;
+    int32x4_t m = vdupq_n_s32(0);
+    int32x2_t h;
+
+    for (k = 0; k + 4 <= n; k += 4)
+        m = vmaxq_s32(m, vabsq_s32(vld1q_s32(x+k)));
+    h = vpmax_s32(vget_low_s32(m), vget_high_s32(m));
+    h = vpmax_s32(h, h);
+    return max_abs_c(x, vget_lane_s32(h, 0), k, n);
+}
+
+#endif /* FAAC_SIMD_NEON */
+
+static int32_t simd_supported( void )
+{
+#ifdef FAAC_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return FAAC_SIMD_256;
+    if (__builtin_cpu_supports("sse2"))
+        return FAAC_SIMD_128;
+#endif
+#ifdef FAAC_SIMD_NEON
+    return FAAC_SIMD_128; /* we were built for a CPU that has NEON */
+#endif
+    return FAAC_SIMD_NONE;
+}
+
+int32_t faac_simd_setup( int32_t max_level )
+{
+    int32_t level = min(simd_supported(), max_level);
+
+    SetMemory(&faac_simd_kernels, 0, sizeof(faac_simd_kernels));
+#ifdef FAAC_SIMD_X86
+    if (level == FAAC_SIMD_256) {
+        faac_simd_kernels.butterflies = butterflies_avx2;
+        faac_simd_kernels.twiddle = twiddle_avx2;
+        faac_simd_kernels.window = window_avx2;
+        faac_simd_kernels.pow34 = pow34_avx2;
+        faac_simd_kernels.energy = energy_avx2;
+        faac_simd_kernels.quantize = quantize_avx2;
+        faac_simd_kernels.max_abs = max_abs_avx2;
+    } else if (level == FAAC_SIMD_128) {
+        faac_simd_kernels.butterflies = butterflies_sse2;
+        faac_simd_kernels.twiddle = twiddle_sse2;
+        faac_simd_kernels.window = window_sse2;
+        /* (no pow34: SSE2 has neither variable shifts nor gathers) */
+        faac_simd_kernels.energy = energy_sse2;
+        faac_simd_kernels.quantize = quantize_sse2;
+        faac_simd_kernels.max_abs = max_abs_sse2;
+    }
+#endif
+#ifdef FAAC_SIMD_NEON
+    if (level >= FAAC_SIMD_128) {
+        level = FAAC_SIMD_128;
+        faac_simd_kernels.butterflies = butterflies_neon;
+        faac_simd_kernels.twiddle = twiddle_neon;
+        faac_simd_kernels.window = window_neon;
+        faac_simd_kernels.energy = energy_neon;
+        faac_simd_kernels.quantize = quantize_neon;
+        faac_simd_kernels.max_abs = max_abs_neon;
+    }
+#endif
+    faac_simd_kernels.level = level;
+    faac_simd_initialized = 1;
+
+    return level;
+}
+
+void faac_simd_init( void )
+{
+    if (!faac_simd_initialized)
+        faac_simd_setup(FAAC_SIMD_BEST);
+}
@@ -0,0 +1,87 @@
+/*
+ * FAAC - Freeware Advanced Audio Coder
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * Vector (SSE2, AVX2 or NEON) versions of the filterbank's, the quantizer's
+ * and the Huffman coder's inner loops.  They use exactly the same fixed-point
+ * arithmetic as the scalar loops in fft.c, filtbank.c, aacquant.c and
+ * huffman.c, so their output is bit-exact with them.
+ */
+
+#ifndef _SIMD_H_
+#define _SIMD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* vector widths, for faac_simd_setup() */
+#define FAAC_SIMD_NONE  0   /* use the scalar loops */
+#define FAAC_SIMD_128   1   /* SSE2 or NEON */
+#define FAAC_SIMD_256   2   /* AVX2 */
+#define FAAC_SIMD_BEST  FAAC_SIMD_256
+
+typedef struct
+{
+    int32_t level;
+
+    /* n radix-2 butterflies (v = x2*w; x2 = x1-v; x1 = x1+v), with the
+       twiddle factors w = wr + j*wi stored contiguously */
+    void (*butterflies)( coef_t *xr1, coef_t *xi1, coef_t *xr2, coef_t *xi2,
+                         const fftfloat *wr, const fftfloat *wi, int32_t n );
+
+    /* the MDCT pre/post-twiddle: x = x*(cosx - j*sinx), in place */
+    void (*twiddle)( coef_t *xr, coef_t *xi,
+                     const fftfloat *cosx, const fftfloat *sinx, int32_t n );
+
+    /* windowing: out[i] = in[i*2]*win[i] (the input is interleaved stereo) */
+    void (*window)( coef_t *out, const int16_t *in, const coef_t *win, int32_t n );
+
+    /* y[i] = faac_pow34(x[i]) */
+    void (*pow34)( coef_t *y, const coef_t *x, int32_t n );
+
+    /* the energy of a band: the sum of COEF2INT(x[i])^2 */
+    int64_t (*energy)( const coef_t *x, int32_t n );
+
+    /* quantizes a band: x[i] = MUL_F(x[i],fix), then ix[i] = COEF2INT(x[i]+0.5),
+       with the sign of xr[i] */
+    void (*quantize)( int32_t *ix, coef_t *x, const coef_t *xr, int32_t fix, int32_t n );
+
+    /* the largest |x[i]| of a band of quantized values */
+    int32_t (*max_abs)( const int32_t *x, int32_t n );
+} SIMD_Kernels;
+
+/* NULL entries mean that the scalar loops are used.  (The kernels are for the
+   fixed-point build only; FAAC_FLOAT builds leave vectorizing to the compiler.) */
+extern SIMD_Kernels faac_simd_kernels;
+
+/* selects the widest kernels that the CPU supports, unless faac_simd_setup()
+   has already been called (faacEncOpen() calls this once, for all encoders) */
+void faac_simd_init( void );
+
+/* selects the widest kernels up to "max_level"; returns the level chosen.
+   The kernels are shared by all encoders, so call this only while no
+   encoder is encoding - e.g., before opening any. */
+int32_t faac_simd_setup( int32_t max_level );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -5,65564 +5,4128 @@
 real_32_t faac_table_log[FAAC_SAMPLES+1];
 real_32_t faac_table_sqrt[FAAC_SAMPLES+1];
 real_32_t faac_table_pow[FAAC_SAMPLES+1];
+#ifndef FAAC_FLOAT
 coef_t faac_table_pow34[FAAC_SAMPLES_POW34+1];
+#endif
 real_32_t faac_table_log2[64+1];
 fftfloat faac_fft_costbl[1<<(FAAC_FFT_LOGM-1)];
 fftfloat faac_fft_negsintbl[1<<(FAAC_FFT_LOGM-1)];
-real_32_t faac_fft_cosx[FAAC_FFT_SINCOS_SIZE];
-real_32_t faac_fft_sinx[FAAC_FFT_SINCOS_SIZE];
+fftfloat faac_fft_cosx[FAAC_FFT_SINCOS_SIZE];
+fftfloat faac_fft_sinx[FAAC_FFT_SINCOS_SIZE];
 #else
 real_32_t faac_table_log[FAAC_SAMPLES+1] = {
     0,
-    -635965,
-    -590539,
-    -563967,
-    -545113,
-    -530489,
-    -518541,
-    -508438,
-    -499687,
-    -491968,
-    -485063,
-    -478817,
-    -473114,
-    -467869,
-    -463012,
-    -458491,
     -454261,
-    -450288,
-    -446542,
-    -442999,
-    -439637,
-    -436439,
-    -433391,
-    -430478,
-    -427688,
-    -425013,
-    -422443,
-    -419969,
-    -417586,
-    -415286,
-    -413064,
-    -410916,
     -408835,
-    -406818,
-    -404862,
-    -402962,
-    -401116,
-    -399320,
-    -397572,
-    -395870,
-    -394211,
-    -392593,
-    -391013,
-    -389471,
-    -387965,
-    -386492,
-    -385051,
-    -383642,
     -382262,
-    -380911,
-    -379587,
-    -378289,
-    -377017,
-    -375768,
-    -374543,
-    -373341,
-    -372160,
-    -371000,
-    -369860,
-    -368740,
-    -367638,
-    -366555,
-    -365489,
-    -364441,
     -363409,
-    -362393,
-    -361392,
-    -360407,
-    -359436,
-    -358479,
-    -357536,
-    -356606,
-    -355690,
-    -354786,
-    -353894,
-    -353014,
-    -352146,
-    -351290,
-    -350444,
-    -349609,
     -348785,
-    -347971,
-    -347167,
-    -346372,
-    -345587,
-    -344812,
-    -344045,
-    -343288,
-    -342539,
-    -341798,
-    -341066,
-    -340342,
-    -339625,
-    -338917,
-    -338216,
-    -337522,
     -336836,
-    -336157,
-    -335485,
-    -334820,
-    -334161,
-    -333509,
-    -332863,
-    -332224,
-    -331591,
-    -330963,
-    -330342,
-    -329727,
-    -329117,
-    -328513,
-    -327915,
-    -327322,
     -326734,
-    -326151,
-    -325574,
-    -325001,
-    -324434,
-    -323871,
-    -323314,
-    -322761,
-    -322212,
-    -321668,
-    -321129,
-    -320594,
-    -320063,
-    -319537,
-    -319015,
-    -318497,
     -317983,
-    -317473,
-    -316967,
-    -316464,
-    -315966,
-    -315471,
-    -314980,
-    -314493,
-    -314010,
-    -313529,
-    -313053,
-    -312580,
-    -312110,
-    -311643,
-    -311180,
-    -310720,
     -310264,
-    -309810,
-    -309360,
-    -308912,
-    -308468,
-    -308027,
-    -307588,
-    -307153,
-    -306720,
-    -306291,
-    -305864,
-    -305439,
-    -305018,
-    -304599,
-    -304183,
-    -303770,
     -303359,
-    -302950,
-    -302545,
-    -302141,
-    -301740,
-    -301342,
-    -300946,
-    -300552,
-    -300161,
-    -299772,
-    -299386,
-    -299001,
-    -298619,
-    -298239,
-    -297861,
-    -297486,
     -297112,
-    -296741,
-    -296372,
-    -296005,
-    -295640,
-    -295277,
-    -294916,
-    -294556,
-    -294199,
-    -293844,
-    -293491,
-    -293139,
-    -292790,
-    -292442,
-    -292096,
-    -291752,
     -291410,
-    -291070,
-    -290731,
-    -290394,
-    -290059,
-    -289725,
-    -289393,
-    -289063,
-    -288735,
-    -288408,
-    -288083,
-    -287759,
-    -287437,
-    -287117,
-    -286798,
-    -286480,
     -286164,
-    -285850,
-    -285537,
-    -285226,
-    -284916,
-    -284608,
-    -284301,
-    -283995,
-    -283691,
-    -283388,
-    -283087,
-    -282787,
-    -282489,
-    -282191,
-    -281895,
-    -281601,
     -281308,
-    -281016,
-    -280725,
-    -280436,
-    -280148,
-    -279861,
-    -279575,
-    -279291,
-    -279008,
-    -278726,
-    -278445,
-    -278166,
-    -277888,
-    -277611,
-    -277335,
-    -277060,
     -276786,
-    -276514,
-    -276242,
-    -275972,
-    -275703,
-    -275435,
-    -275168,
-    -274902,
-    -274637,
-    -274374,
-    -274111,
-    -273849,
-    -273589,
-    -273329,
-    -273071,
-    -272813,
     -272557,
-    -272301,
-    -272047,
-    -271793,
-    -271540,
-    -271289,
-    -271038,
-    -270789,
-    -270540,
-    -270292,
-    -270045,
-    -269799,
-    -269554,
-    -269310,
-    -269067,
-    -268825,
     -268583,
-    -268343,
-    -268103,
-    -267865,
-    -267627,
-    -267390,
-    -267154,
-    -266918,
-    -266684,
-    -266450,
-    -266217,
-    -265985,
-    -265754,
-    -265524,
-    -265294,
-    -265065,
     -264838,
-    -264610,
-    -264384,
-    -264158,
-    -263934,
-    -263710,
-    -263486,
-    -263264,
-    -263042,
-    -262821,
-    -262601,
-    -262381,
-    -262162,
-    -261944,
-    -261727,
-    -261510,
     -261294,
-    -261079,
-    -260864,
-    -260651,
-    -260437,
-    -260225,
-    -260013,
-    -259802,
-    -259592,
-    -259382,
-    -259173,
-    -258965,
-    -258757,
-    -258550,
-    -258344,
-    -258138,
     -257933,
-    -257728,
-    -257524,
-    -257321,
-    -257119,
-    -256917,
-    -256715,
-    -256514,
-    -256314,
-    -256115,
-    -255916,
-    -255718,
-    -255520,
-    -255323,
-    -255126,
-    -254930,
     -254735,
-    -254540,
-    -254346,
-    -254153,
-    -253960,
-    -253767,
-    -253575,
-    -253384,
-    -253193,
-    -253003,
-    -252813,
-    -252624,
-    -252435,
-    -252247,
-    -252060,
-    -251873,
     -251686,
-    -251500,
-    -251315,
-    -251130,
-    -250946,
-    -250762,
-    -250579,
-    -250396,
-    -250214,
-    -250032,
-    -249851,
-    -249670,
-    -249489,
-    -249310,
-    -249130,
-    -248952,
     -248773,
-    -248595,
-    -248418,
-    -248241,
-    -248065,
-    -247889,
-    -247713,
-    -247538,
-    -247364,
-    -247190,
-    -247016,
-    -246843,
-    -246670,
-    -246498,
-    -246326,
-    -246155,
     -245984,
-    -245814,
-    -245644,
-    -245474,
-    -245305,
-    -245136,
-    -244968,
-    -244800,
-    -244633,
-    -244466,
-    -244299,
-    -244133,
-    -243967,
-    -243802,
-    -243637,
-    -243473,
     -243309,
-    -243145,
-    -242982,
-    -242819,
-    -242657,
-    -242495,
-    -242333,
-    -242172,
-    -242011,
-    -241850,
-    -241690,
-    -241531,
-    -241372,
-    -241213,
-    -241054,
-    -240896,
     -240738,
-    -240581,
-    -240424,
-    -240267,
-    -240111,
-    -239955,
-    -239800,
-    -239645,
-    -239490,
-    -239336,
-    -239182,
-    -239028,
-    -238875,
-    -238722,
-    -238569,
-    -238417,
     -238265,
-    -238113,
-    -237962,
-    -237811,
-    -237661,
-    -237511,
-    -237361,
-    -237212,
-    -237062,
-    -236914,
-    -236765,
-    -236617,
-    -236469,
-    -236322,
-    -236175,
-    -236028,
     -235882,
-    -235735,
-    -235590,
-    -235444,
-    -235299,
-    -235154,
-    -235010,
-    -234865,
-    -234722,
-    -234578,
-    -234435,
-    -234292,
-    -234149,
-    -234007,
-    -233865,
-    -233723,
     -233582,
-    -233441,
-    -233300,
-    -233159,
-    -233019,
-    -232879,
-    -232740,
-    -232601,
-    -232462,
-    -232323,
-    -232184,
-    -232046,
-    -231908,
-    -231771,
-    -231634,
-    -231497,
     -231360,
-    -231224,
-    -231088,
-    -230952,
-    -230816,
-    -230681,
-    -230546,
-    -230411,
-    -230277,
-    -230143,
-    -230009,
-    -229875,
-    -229742,
-    -229609,
-    -229476,
-    -229343,
     -229211,
-    -229079,
-    -228947,
-    -228816,
-    -228685,
-    -228554,
-    -228423,
-    -228293,
-    -228163,
-    -228033,
-    -227903,
-    -227774,
-    -227644,
-    -227516,
-    -227387,
-    -227259,
     -227130,
-    -227003,
-    -226875,
-    -226748,
-    -226620,
-    -226494,
-    -226367,
-    -226241,
-    -226114,
-    -225988,
-    -225863,
-    -225737,
-    -225612,
-    -225487,
-    -225363,
-    -225238,
     -225114,
-    -224990,
-    -224866,
-    -224743,
-    -224619,
-    -224496,
-    -224373,
-    -224251,
-    -224128,
-    -224006,
-    -223884,
-    -223763,
-    -223641,
-    -223520,
-    -223399,
-    -223278,
     -223157,
-    -223037,
-    -222917,
-    -222797,
-    -222677,
-    -222558,
-    -222439,
-    -222319,
-    -222201,
-    -222082,
-    -221964,
-    -221845,
-    -221727,
-    -221610,
-    -221492,
-    -221375,
     -221258,
-    -221141,
-    -221024,
-    -220907,
-    -220791,
-    -220675,
-    -220559,
-    -220444,
-    -220328,
-    -220213,
-    -220098,
-    -219983,
-    -219868,
-    -219754,
-    -219639,
-    -219525,
     -219411,
-    -219298,
-    -219184,
-    -219071,
-    -218958,
-    -218845,
-    -218732,
-    -218620,
-    -218507,
-    -218395,
-    -218283,
-    -218172,
-    -218060,
-    -217949,
-    -217838,
-    -217727,
     -217616,
-    -217505,
-    -217395,
-    -217285,
-    -217174,
-    -217065,
-    -216955,
-    -216845,
-    -216736,
-    -216627,
-    -216518,
-    -216409,
-    -216301,
-    -216192,
-    -216084,
-    -215976,
     -215868,
-    -215760,
-    -215653,
-    -215546,
-    -215438,
-    -215331,
-    -215225,
-    -215118,
-    -215011,
-    -214905,
-    -214799,
-    -214693,
-    -214587,
-    -214482,
-    -214376,
-    -214271,
     -214166,
-    -214061,
-    -213956,
-    -213851,
-    -213747,
-    -213643,
-    -213539,
-    -213435,
-    -213331,
-    -213227,
-    -213124,
-    -213021,
-    -212917,
-    -212814,
-    -212712,
-    -212609,
     -212507,
-    -212404,
-    -212302,
-    -212200,
-    -212098,
-    -211997,
-    -211895,
-    -211794,
-    -211692,
-    -211591,
-    -211490,
-    -211390,
-    -211289,
-    -211189,
-    -211088,
-    -210988,
     -210888,
-    -210788,
-    -210689,
-    -210589,
-    -210490,
-    -210391,
-    -210292,
-    -210193,
-    -210094,
-    -209995,
-    -209897,
-    -209798,
-    -209700,
-    -209602,
-    -209504,
-    -209407,
     -209309,
-    -209212,
-    -209114,
-    -209017,
-    -208920,
-    -208823,
-    -208726,
-    -208630,
-    -208533,
-    -208437,
-    -208341,
-    -208245,
-    -208149,
-    -208053,
-    -207958,
-    -207862,
     -207767,
-    -207672,
-    -207577,
-    -207482,
-    -207387,
-    -207292,
-    -207198,
-    -207104,
-    -207009,
-    -206915,
-    -206821,
-    -206727,
-    -206634,
-    -206540,
-    -206447,
-    -206353,
     -206260,
-    -206167,
-    -206074,
-    -205982,
-    -205889,
-    -205796,
-    -205704,
-    -205612,
-    -205520,
-    -205428,
-    -205336,
-    -205244,
-    -205153,
-    -205061,
-    -204970,
-    -204879,
     -204788,
-    -204697,
-    -204606,
-    -204515,
-    -204424,
-    -204334,
-    -204244,
-    -204153,
-    -204063,
-    -203973,
-    -203884,
-    -203794,
-    -203704,
-    -203615,
-    -203525,
-    -203436,
     -203347,
-    -203258,
-    -203169,
-    -203081,
-    -202992,
-    -202903,
-    -202815,
-    -202727,
-    -202639,
-    -202551,
-    -202463,
-    -202375,
-    -202287,
-    -202200,
-    -202112,
-    -202025,
     -201938,
-    -201851,
-    -201764,
-    -201677,
-    -201590,
-    -201503,
-    -201417,
-    -201330,
-    -201244,
-    -201158,
-    -201072,
-    -200986,
-    -200900,
-    -200814,
-    -200729,
-    -200643,
     -200558,
-    -200473,
-    -200387,
-    -200302,
-    -200217,
-    -200133,
-    -200048,
-    -199963,
-    -199879,
-    -199794,
-    -199710,
-    -199626,
-    -199542,
-    -199458,
-    -199374,
-    -199290,
     -199207,
-    -199123,
-    -199040,
-    -198956,
-    -198873,
-    -198790,
-    -198707,
-    -198624,
-    -198541,
-    -198459,
-    -198376,
-    -198293,
-    -198211,
-    -198129,
-    -198047,
-    -197965,
     -197883,
-    -197801,
-    -197719,
-    -197637,
-    -197556,
-    -197474,
-    -197393,
-    -197312,
-    -197230,
-    -197149,
-    -197068,
-    -196988,
-    -196907,
-    -196826,
-    -196746,
-    -196665,
     -196585,
-    -196505,
-    -196424,
-    -196344,
-    -196264,
-    -196184,
-    -196105,
-    -196025,
-    -195945,
-    -195866,
-    -195787,
-    -195707,
-    -195628,
-    -195549,
-    -195470,
-    -195391,
     -195312,
-    -195234,
-    -195155,
-    -195076,
-    -194998,
-    -194920,
-    -194841,
-    -194763,
-    -194685,
-    -194607,
-    -194529,
-    -194451,
-    -194374,
-    -194296,
-    -194219,
-    -194141,
     -194064,
-    -193987,
-    -193910,
-    -193832,
-    -193755,
-    -193679,
-    -193602,
-    -193525,
-    -193449,
-    -193372,
-    -193296,
-    -193219,
-    -193143,
-    -193067,
-    -192991,
-    -192915,
     -192839,
-    -192763,
-    -192687,
-    -192612,
-    -192536,
-    -192461,
-    -192385,
-    -192310,
-    -192235,
-    -192160,
-    -192085,
-    -192010,
-    -191935,
-    -191860,
-    -191785,
-    -191711,
     -191636,
-    -191562,
-    -191488,
-    -191413,
-    -191339,
-    -191265,
-    -191191,
-    -191117,
-    -191043,
-    -190969,
-    -190896,
-    -190822,
-    -190749,
-    -190675,
-    -190602,
-    -190529,
     -190455,
-    -190382,
-    -190309,
-    -190236,
-    -190164,
-    -190091,
-    -190018,
-    -189945,
-    -189873,
-    -189800,
-    -189728,
-    -189656,
-    -189584,
-    -189511,
-    -189439,
-    -189367,
     -189296,
-    -189224,
-    -189152,
-    -189080,
-    -189009,
-    -188937,
-    -188866,
-    -188794,
-    -188723,
-    -188652,
-    -188581,
-    -188510,
-    -188439,
-    -188368,
-    -188297,
-    -188226,
     -188156,
-    -188085,
-    -188015,
-    -187944,
-    -187874,
-    -187804,
-    -187733,
-    -187663,
-    -187593,
-    -187523,
-    -187453,
-    -187383,
-    -187314,
-    -187244,
-    -187174,
-    -187105,
     -187035,
-    -186966,
-    -186897,
-    -186828,
-    -186758,
-    -186689,
-    -186620,
-    -186551,
-    -186482,
-    -186414,
-    -186345,
-    -186276,
-    -186208,
-    -186139,
-    -186071,
-    -186002,
     -185934,
-    -185866,
-    -185798,
-    -185729,
-    -185661,
-    -185594,
-    -185526,
-    -185458,
-    -185390,
-    -185322,
-    -185255,
-    -185187,
-    -185120,
-    -185052,
-    -184985,
-    -184918,
     -184851,
-    -184784,
-    -184717,
-    -184650,
-    -184583,
-    -184516,
-    -184449,
-    -184382,
-    -184316,
-    -184249,
-    -184183,
-    -184116,
-    -184050,
-    -183984,
-    -183917,
-    -183851,
     -183785,
-    -183719,
-    -183653,
-    -183587,
-    -183521,
-    -183456,
-    -183390,
-    -183324,
-    -183259,
-    -183193,
-    -183128,
-    -183062,
-    -182997,
-    -182932,
-    -182867,
-    -182802,
     -182736,
-    -182671,
-    -182607,
-    -182542,
-    -182477,
-    -182412,
-    -182348,
-    -182283,
-    -182218,
-    -182154,
-    -182090,
-    -182025,
-    -181961,
-    -181897,
-    -181832,
-    -181768,
     -181704,
-    -181640,
-    -181576,
-    -181513,
-    -181449,
-    -181385,
-    -181321,
-    -181258,
-    -181194,
-    -181131,
-    -181067,
-    -181004,
-    -180941,
-    -180878,
-    -180814,
-    -180751,
     -180688,
-    -180625,
-    -180562,
-    -180500,
-    -180437,
-    -180374,
-    -180311,
-    -180249,
-    -180186,
-    -180124,
-    -180061,
-    -179999,
-    -179936,
-    -179874,
-    -179812,
-    -179750,
     -179688,
-    -179626,
-    -179564,
-    -179502,
-    -179440,
-    -179378,
-    -179316,
-    -179255,
-    -179193,
-    -179132,
-    -179070,
-    -179009,
-    -178947,
-    -178886,
-    -178825,
-    -178763,
     -178702,
-    -178641,
-    -178580,
-    -178519,
-    -178458,
-    -178397,
-    -178336,
-    -178276,
-    -178215,
-    -178154,
-    -178094,
-    -178033,
-    -177973,
-    -177912,
-    -177852,
-    -177792,
     -177731,
-    -177671,
-    -177611,
-    -177551,
-    -177491,
-    -177431,
-    -177371,
-    -177311,
-    -177251,
-    -177191,
-    -177132,
-    -177072,
-    -177012,
-    -176953,
-    -176893,
-    -176834,
     -176775,
-    -176715,
-    -176656,
-    -176597,
-    -176538,
-    -176478,
-    -176419,
-    -176360,
-    -176301,
-    -176242,
-    -176184,
-    -176125,
-    -176066,
-    -176007,
-    -175949,
-    -175890,
     -175832,
-    -175773,
-    -175715,
-    -175656,
-    -175598,
-    -175540,
-    -175481,
-    -175423,
-    -175365,
-    -175307,
-    -175249,
-    -175191,
-    -175133,
-    -175075,
-    -175017,
-    -174960,
     -174902,
-    -174844,
-    -174787,
-    -174729,
-    -174672,
-    -174614,
-    -174557,
-    -174499,
-    -174442,
-    -174385,
-    -174328,
-    -174270,
-    -174213,
-    -174156,
-    -174099,
-    -174042,
     -173985,
-    -173928,
-    -173872,
-    -173815,
-    -173758,
-    -173702,
-    -173645,
-    -173588,
-    -173532,
-    -173475,
-    -173419,
-    -173363,
-    -173306,
-    -173250,
-    -173194,
-    -173138,
     -173081,
-    -173025,
-    -172969,
-    -172913,
-    -172857,
-    -172801,
-    -172746,
-    -172690,
-    -172634,
-    -172578,
-    -172523,
-    -172467,
-    -172412,
-    -172356,
-    -172301,
-    -172245,
     -172190,
-    -172134,
-    -172079,
-    -172024,
-    -171969,
-    -171914,
-    -171858,
-    -171803,
-    -171748,
-    -171693,
-    -171639,
-    -171584,
-    -171529,
-    -171474,
-    -171419,
-    -171365,
     -171310,
-    -171255,
-    -171201,
-    -171146,
-    -171092,
-    -171038,
-    -170983,
-    -170929,
-    -170875,
-    -170820,
-    -170766,
-    -170712,
-    -170658,
-    -170604,
-    -170550,
-    -170496,
     -170442,
-    -170388,
-    -170334,
-    -170281,
-    -170227,
-    -170173,
-    -170119,
-    -170066,
-    -170012,
-    -169959,
-    -169905,
-    -169852,
-    -169798,
-    -169745,
-    -169692,
-    -169639,
     -169585,
-    -169532,
-    -169479,
-    -169426,
-    -169373,
-    -169320,
-    -169267,
-    -169214,
-    -169161,
-    -169108,
-    -169056,
-    -169003,
-    -168950,
-    -168897,
-    -168845,
-    -168792,
     -168740,
-    -168687,
-    -168635,
-    -168582,
-    -168530,
-    -168478,
-    -168425,
-    -168373,
-    -168321,
-    -168269,
-    -168217,
-    -168165,
-    -168113,
-    -168061,
-    -168009,
-    -167957,
     -167905,
-    -167853,
-    -167801,
-    -167749,
-    -167698,
-    -167646,
-    -167594,
-    -167543,
-    -167491,
-    -167440,
-    -167388,
-    -167337,
-    -167286,
-    -167234,
-    -167183,
-    -167132,
     -167080,
-    -167029,
-    -166978,
-    -166927,
-    -166876,
-    -166825,
-    -166774,
-    -166723,
-    -166672,
-    -166621,
-    -166570,
-    -166520,
-    -166469,
-    -166418,
-    -166368,
-    -166317,
     -166266,
-    -166216,
-    -166165,
-    -166115,
-    -166064,
-    -166014,
-    -165964,
-    -165913,
-    -165863,
-    -165813,
-    -165763,
-    -165712,
-    -165662,
-    -165612,
-    -165562,
-    -165512,
     -165462,
-    -165412,
-    -165362,
-    -165313,
-    -165263,
-    -165213,
-    -165163,
-    -165113,
-    -165064,
-    -165014,
-    -164965,
-    -164915,
-    -164865,
-    -164816,
-    -164767,
-    -164717,
     -164668,
-    -164618,
-    -164569,
-    -164520,
-    -164471,
-    -164422,
-    -164372,
-    -164323,
-    -164274,
-    -164225,
-    -164176,
-    -164127,
-    -164078,
-    -164029,
-    -163981,
-    -163932,
     -163883,
-    -163834,
-    -163785,
-    -163737,
-    -163688,
-    -163640,
-    -163591,
-    -163542,
-    -163494,
-    -163446,
-    -163397,
-    -163349,
-    -163300,
-    -163252,
-    -163204,
-    -163156,
     -163107,
-    -163059,
-    -163011,
-    -162963,
-    -162915,
-    -162867,
-    -162819,
-    -162771,
-    -162723,
-    -162675,
-    -162627,
-    -162579,
-    -162532,
-    -162484,
-    -162436,
-    -162388,
     -162341,
-    -162293,
-    -162246,
-    -162198,
-    -162151,
-    -162103,
-    -162056,
-    -162008,
-    -161961,
-    -161914,
-    -161866,
-    -161819,
-    -161772,
-    -161725,
-    -161677,
-    -161630,
     -161583,
-    -161536,
-    -161489,
-    -161442,
-    -161395,
-    -161348,
-    -161301,
-    -161254,
-    -161208,
-    -161161,
-    -161114,
-    -161067,
-    -161021,
-    -160974,
-    -160927,
-    -160881,
     -160834,
-    -160788,
-    -160741,
-    -160695,
-    -160648,
-    -160602,
-    -160556,
-    -160509,
-    -160463,
-    -160417,
-    -160370,
-    -160324,
-    -160278,
-    -160232,
-    -160186,
-    -160140,
     -160094,
-    -160048,
-    -160002,
-    -159956,
-    -159910,
-    -159864,
-    -159818,
-    -159772,
-    -159727,
-    -159681,
-    -159635,
-    -159589,
-    -159544,
-    -159498,
-    -159452,
-    -159407,
     -159361,
-    -159316,
-    -159270,
-    -159225,
-    -159180,
-    -159134,
-    -159089,
-    -159044,
-    -158998,
-    -158953,
-    -158908,
-    -158863,
-    -158818,
-    -158772,
-    -158727,
-    -158682,
     -158637,
-    -158592,
-    -158547,
-    -158502,
-    -158457,
-    -158413,
-    -158368,
-    -158323,
-    -158278,
-    -158233,
-    -158189,
-    -158144,
-    -158099,
-    -158055,
-    -158010,
-    -157966,
     -157921,
-    -157876,
-    -157832,
-    -157788,
-    -157743,
-    -157699,
-    -157654,
-    -157610,
-    -157566,
-    -157522,
-    -157477,
-    -157433,
-    -157389,
-    -157345,
-    -157301,
-    -157257,
     -157212,
-    -157168,
-    -157124,
-    -157080,
-    -157037,
-    -156993,
-    -156949,
-    -156905,
-    -156861,
-    -156817,
-    -156774,
-    -156730,
-    -156686,
-    -156642,
-    -156599,
-    -156555,
     -156512,
-    -156468,
-    -156424,
-    -156381,
-    -156338,
-    -156294,
-    -156251,
-    -156207,
-    -156164,
-    -156121,
-    -156077,
-    -156034,
-    -155991,
-    -155948,
-    -155904,
-    -155861,
     -155818,
-    -155775,
-    -155732,
-    -155689,
-    -155646,
-    -155603,
-    -155560,
-    -155517,
-    -155474,
-    -155431,
-    -155388,
-    -155345,
-    -155303,
-    -155260,
-    -155217,
-    -155174,
     -155132,
-    -155089,
-    -155047,
-    -155004,
-    -154961,
-    -154919,
-    -154876,
-    -154834,
-    -154791,
-    -154749,
-    -154707,
-    -154664,
-    -154622,
-    -154579,
-    -154537,
-    -154495,
     -154453,
-    -154410,
-    -154368,
-    -154326,
-    -154284,
-    -154242,
-    -154200,
-    -154158,
-    -154116,
-    -154074,
-    -154032,
-    -153990,
-    -153948,
-    -153906,
-    -153864,
-    -153822,
     -153781,
-    -153739,
-    -153697,
-    -153655,
-    -153614,
-    -153572,
-    -153530,
-    -153489,
-    -153447,
-    -153405,
-    -153364,
-    -153322,
-    -153281,
-    -153239,
-    -153198,
-    -153157,
     -153115,
-    -153074,
-    -153032,
-    -152991,
-    -152950,
-    -152909,
-    -152867,
-    -152826,
-    -152785,
-    -152744,
-    -152703,
-    -152662,
-    -152621,
-    -152579,
-    -152538,
-    -152497,
     -152457,
-    -152416,
-    -152375,
-    -152334,
-    -152293,
-    -152252,
-    -152211,
-    -152170,
-    -152130,
-    -152089,
-    -152048,
-    -152007,
-    -151967,
-    -151926,
-    -151886,
-    -151845,
     -151804,
-    -151764,
-    -151723,
-    -151683,
-    -151642,
-    -151602,
-    -151562,
-    -151521,
-    -151481,
-    -151440,
-    -151400,
-    -151360,
-    -151320,
-    -151279,
-    -151239,
-    -151199,
     -151159,
-    -151119,
-    -151078,
-    -151038,
-    -150998,
-    -150958,
-    -150918,
-    -150878,
-    -150838,
-    -150798,
-    -150758,
-    -150718,
-    -150679,
-    -150639,
-    -150599,
-    -150559,
     -150519,
-    -150480,
-    -150440,
-    -150400,
-    -150360,
-    -150321,
-    -150281,
-    -150242,
-    -150202,
-    -150162,
-    -150123,
-    -150083,
-    -150044,
-    -150004,
-    -149965,
-    -149926,
     -149886,
-    -149847,
-    -149807,
-    -149768,
-    -149729,
-    -149690,
-    -149650,
-    -149611,
-    -149572,
-    -149533,
-    -149493,
-    -149454,
-    -149415,
-    -149376,
-    -149337,
-    -149298,
     -149259,
-    -149220,
-    -149181,
-    -149142,
-    -149103,
-    -149064,
-    -149025,
-    -148986,
-    -148948,
-    -148909,
-    -148870,
-    -148831,
-    -148793,
-    -148754,
-    -148715,
-    -148676,
     -148638,
-    -148599,
-    -148561,
-    -148522,
-    -148483,
-    -148445,
-    -148406,
-    -148368,
-    -148329,
-    -148291,
-    -148253,
-    -148214,
-    -148176,
-    -148137,
-    -148099,
-    -148061,
     -148022,
-    -147984,
-    -147946,
-    -147908,
-    -147869,
-    -147831,
-    -147793,
-    -147755,
-    -147717,
-    -147679,
-    -147641,
-    -147603,
-    -147565,
-    -147527,
-    -147489,
-    -147451,
     -147413,
-    -147375,
-    -147337,
-    -147299,
-    -147261,
-    -147223,
-    -147186,
-    -147148,
-    -147110,
-    -147072,
-    -147035,
-    -146997,
-    -146959,
-    -146922,
-    -146884,
-    -146846,
     -146809,
-    -146771,
-    -146734,
-    -146696,
-    -146659,
-    -146621,
-    -146584,
-    -146546,
-    -146509,
-    -146471,
-    -146434,
-    -146397,
-    -146359,
-    -146322,
-    -146285,
-    -146248,
     -146210,
-    -146173,
-    -146136,
-    -146099,
-    -146061,
-    -146024,
-    -145987,
-    -145950,
-    -145913,
-    -145876,
-    -145839,
-    -145802,
-    -145765,
-    -145728,
-    -145691,
-    -145654,
     -145617,
-    -145580,
-    -145543,
-    -145507,
-    -145470,
-    -145433,
-    -145396,
-    -145359,
-    -145323,
-    -145286,
-    -145249,
-    -145213,
-    -145176,
-    -145139,
-    -145103,
-    -145066,
     -145029,
-    -144993,
-    -144956,
-    -144920,
-    -144883,
-    -144847,
-    -144810,
-    -144774,
-    -144737,
-    -144701,
-    -144665,
-    -144628,
-    -144592,
-    -144556,
-    -144519,
-    -144483,
     -144447,
-    -144411,
-    -144374,
-    -144338,
-    -144302,
-    -144266,
-    -144230,
-    -144194,
-    -144158,
-    -144121,
-    -144085,
-    -144049,
-    -144013,
-    -143977,
-    -143941,
-    -143905,
     -143869,
-    -143834,
-    -143798,
-    -143762,
-    -143726,
-    -143690,
-    -143654,
-    -143618,
-    -143583,
-    -143547,
-    -143511,
-    -143475,
-    -143440,
-    -143404,
-    -143368,
-    -143333,
     -143297,
-    -143261,
-    -143226,
-    -143190,
-    -143155,
-    -143119,
-    -143084,
-    -143048,
-    -143013,
-    -142977,
-    -142942,
-    -142906,
-    -142871,
-    -142836,
-    -142800,
-    -142765,
     -142730,
-    -142694,
-    -142659,
-    -142624,
-    -142589,
-    -142553,
-    -142518,
-    -142483,
-    -142448,
-    -142413,
-    -142377,
-    -142342,
-    -142307,
-    -142272,
-    -142237,
-    -142202,
     -142167,
-    -142132,
-    -142097,
-    -142062,
-    -142027,
-    -141992,
-    -141957,
-    -141923,
-    -141888,
-    -141853,
-    -141818,
-    -141783,
-    -141748,
-    -141714,
-    -141679,
-    -141644,
     -141609,
-    -141575,
-    -141540,
-    -141505,
-    -141471,
-    -141436,
-    -141401,
-    -141367,
-    -141332,
-    -141298,
-    -141263,
-    -141229,
-    -141194,
-    -141160,
-    -141125,
-    -141091,
     -141056,
-    -141022,
-    -140987,
-    -140953,
-    -140919,
-    -140884,
-    -140850,
-    -140816,
-    -140782,
-    -140747,
-    -140713,
-    -140679,
-    -140645,
-    -140610,
-    -140576,
-    -140542,
     -140508,
-    -140474,
-    -140440,
-    -140406,
-    -140371,
-    -140337,
-    -140303,
-    -140269,
-    -140235,
-    -140201,
-    -140167,
-    -140133,
-    -140100,
-    -140066,
-    -140032,
-    -139998,
     -139964,
-    -139930,
-    -139896,
-    -139863,
-    -139829,
-    -139795,
-    -139761,
-    -139727,
-    -139694,
-    -139660,
-    -139626,
-    -139593,
-    -139559,
-    -139525,
-    -139492,
-    -139458,
     -139425,
-    -139391,
-    -139357,
-    -139324,
-    -139290,
-    -139257,
-    -139223,
-    -139190,
-    -139157,
-    -139123,
-    -139090,
-    -139056,
-    -139023,
-    -138990,
-    -138956,
-    -138923,
     -138890,
-    -138856,
-    -138823,
-    -138790,
-    -138757,
-    -138723,
-    -138690,
-    -138657,
-    -138624,
-    -138591,
-    -138557,
-    -138524,
-    -138491,
-    -138458,
-    -138425,
-    -138392,
     -138359,
-    -138326,
-    -138293,
-    -138260,
-    -138227,
-    -138194,
-    -138161,
-    -138128,
-    -138095,
-    -138062,
-    -138029,
-    -137997,
-    -137964,
-    -137931,
-    -137898,
-    -137865,
     -137833,
-    -137800,
-    -137767,
-    -137734,
-    -137702,
-    -137669,
-    -137636,
-    -137604,
-    -137571,
-    -137538,
-    -137506,
-    -137473,
-    -137441,
-    -137408,
-    -137375,
-    -137343,
     -137310,
-    -137278,
-    -137245,
-    -137213,
-    -137180,
-    -137148,
-    -137116,
-    -137083,
-    -137051,
-    -137018,
-    -136986,
-    -136954,
-    -136921,
-    -136889,
-    -136857,
-    -136825,
     -136792,
-    -136760,
-    -136728,
-    -136696,
-    -136663,
-    -136631,
-    -136599,
-    -136567,
-    -136535,
-    -136503,
-    -136471,
-    -136438,
-    -136406,
-    -136374,
-    -136342,
-    -136310,
     -136278,
-    -136246,
-    -136214,
-    -136182,
-    -136150,
-    -136118,
-    -136087,
-    -136055,
-    -136023,
-    -135991,
-    -135959,
-    -135927,
-    -135895,
-    -135864,
-    -135832,
-    -135800,
     -135768,
-    -135737,
-    -135705,
-    -135673,
-    -135641,
-    -135610,
-    -135578,
-    -135546,
-    -135515,
-    -135483,
-    -135452,
-    -135420,
-    -135388,
-    -135357,
-    -135325,
-    -135294,
     -135262,
-    -135231,
-    -135199,
-    -135168,
-    -135136,
-    -135105,
-    -135073,
-    -135042,
-    -135011,
-    -134979,
-    -134948,
-    -134917,
-    -134885,
-    -134854,
-    -134823,
-    -134791,
     -134760,
-    -134729,
-    -134697,
-    -134666,
-    -134635,
-    -134604,
-    -134573,
-    -134541,
-    -134510,
-    -134479,
-    -134448,
-    -134417,
-    -134386,
-    -134355,
-    -134324,
-    -134293,
     -134262,
-    -134231,
-    -134200,
-    -134169,
-    -134138,
-    -134107,
-    -134076,
-    -134045,
-    -134014,
-    -133983,
-    -133952,
-    -133921,
-    -133890,
-    -133859,
-    -133829,
-    -133798,
     -133767,
-    -133736,
-    -133705,
-    -133675,
-    -133644,
-    -133613,
-    -133582,
-    -133552,
-    -133521,
-    -133490,
-    -133460,
-    -133429,
-    -133398,
-    -133368,
-    -133337,
-    -133307,
     -133276,
-    -133246,
-    -133215,
-    -133184,
-    -133154,
-    -133123,
-    -133093,
-    -133062,
-    -133032,
-    -133002,
-    -132971,
-    -132941,
-    -132910,
-    -132880,
-    -132850,
-    -132819,
     -132789,
-    -132759,
-    -132728,
-    -132698,
-    -132668,
-    -132637,
-    -132607,
-    -132577,
-    -132547,
-    -132516,
-    -132486,
-    -132456,
-    -132426,
-    -132396,
-    -132365,
-    -132335,
     -132305,
-    -132275,
-    -132245,
-    -132215,
-    -132185,
-    -132155,
-    -132125,
-    -132095,
-    -132065,
-    -132035,
-    -132005,
-    -131975,
-    -131945,
-    -131915,
-    -131885,
-    -131855,
     -131825,
-    -131795,
-    -131765,
-    -131735,
-    -131706,
-    -131676,
-    -131646,
-    -131616,
-    -131586,
-    -131557,
-    -131527,
-    -131497,
-    -131467,
-    -131438,
-    -131408,
-    -131378,
     -131348,
-    -131319,
-    -131289,
-    -131259,
-    -131230,
-    -131200,
-    -131171,
-    -131141,
-    -131111,
-    -131082,
-    -131052,
-    -131023,
-    -130993,
-    -130964,
-    -130934,
-    -130905,
     -130875,
-    -130846,
-    -130816,
-    -130787,
-    -130757,
-    -130728,
-    -130699,
-    -130669,
-    -130640,
-    -130611,
-    -130581,
-    -130552,
-    -130523,
-    -130493,
-    -130464,
-    -130435,
     -130405,
-    -130376,
-    -130347,
-    -130318,
-    -130289,
-    -130259,
-    -130230,
-    -130201,
-    -130172,
-    -130143,
-    -130114,
-    -130084,
-    -130055,
-    -130026,
-    -129997,
-    -129968,
     -129939,
-    -129910,
-    -129881,
-    -129852,
-    -129823,
-    -129794,
-    -129765,
-    -129736,
-    -129707,
-    -129678,
-    -129649,
-    -129620,
-    -129591,
-    -129562,
-    -129534,
-    -129505,
     -129476,
-    -129447,
-    -129418,
-    -129389,
-    -129361,
-    -129332,
-    -129303,
-    -129274,
-    -129245,
-    -129217,
-    -129188,
-    -129159,
-    -129131,
-    -129102,
-    -129073,
-    -129045,
     -129016,
-    -128987,
-    -128959,
-    -128930,
-    -128901,
-    -128873,
-    -128844,
-    -128816,
-    -128787,
-    -128759,
-    -128730,
-    -128702,
-    -128673,
-    -128645,
-    -128616,
-    -128588,
     -128559,
-    -128531,
-    -128502,
-    -128474,
-    -128446,
-    -128417,
-    -128389,
-    -128360,
-    -128332,
-    -128304,
-    -128275,
-    -128247,
-    -128219,
-    -128191,
-    -128162,
-    -128134,
     -128106,
-    -128077,
-    -128049,
-    -128021,
-    -127993,
-    -127965,
-    -127936,
-    -127908,
-    -127880,
-    -127852,
-    -127824,
-    -127796,
-    -127768,
-    -127740,
-    -127711,
-    -127683,
     -127655,
-    -127627,
-    -127599,
-    -127571,
-    -127543,
-    -127515,
-    -127487,
-    -127459,
-    -127431,
-    -127403,
-    -127375,
-    -127347,
-    -127319,
-    -127292,
-    -127264,
-    -127236,
     -127208,
-    -127180,
-    -127152,
-    -127124,
-    -127097,
-    -127069,
-    -127041,
-    -127013,
-    -126985,
-    -126958,
-    -126930,
-    -126902,
-    -126874,
-    -126847,
-    -126819,
-    -126791,
     -126764,
-    -126736,
-    -126708,
-    -126681,
-    -126653,
-    -126625,
-    -126598,
-    -126570,
-    -126543,
-    -126515,
-    -126487,
-    -126460,
-    -126432,
-    -126405,
-    -126377,
-    -126350,
     -126322,
-    -126295,
-    -126267,
-    -126240,
-    -126212,
-    -126185,
-    -126158,
-    -126130,
-    -126103,
-    -126075,
-    -126048,
-    -126021,
-    -125993,
-    -125966,
-    -125939,
-    -125911,
     -125884,
-    -125857,
-    -125829,
-    -125802,
-    -125775,
-    -125748,
-    -125720,
-    -125693,
-    -125666,
-    -125639,
-    -125611,
-    -125584,
-    -125557,
-    -125530,
-    -125503,
-    -125476,
     -125448,
-    -125421,
-    -125394,
-    -125367,
-    -125340,
-    -125313,
-    -125286,
-    -125259,
-    -125232,
-    -125205,
-    -125178,
-    -125151,
-    -125124,
-    -125097,
-    -125070,
-    -125043,
     -125016,
-    -124989,
-    -124962,
-    -124935,
-    -124908,
-    -124881,
-    -124854,
-    -124828,
-    -124801,
-    -124774,
-    -124747,
-    -124720,
-    -124693,
-    -124667,
-    -124640,
-    -124613,
     -124586,
-    -124559,
-    -124533,
-    -124506,
-    -124479,
-    -124452,
-    -124426,
-    -124399,
-    -124372,
-    -124346,
-    -124319,
-    -124292,
-    -124266,
-    -124239,
-    -124212,
-    -124186,
     -124159,
-    -124133,
-    -124106,
-    -124079,
-    -124053,
-    -124026,
-    -124000,
-    -123973,
-    -123947,
-    -123920,
-    -123894,
-    -123867,
-    -123841,
-    -123814,
-    -123788,
-    -123761,
     -123735,
-    -123709,
-    -123682,
-    -123656,
-    -123629,
-    -123603,
-    -123577,
-    -123550,
-    -123524,
-    -123498,
-    -123471,
-    -123445,
-    -123419,
-    -123392,
-    -123366,
-    -123340,
     -123314,
-    -123287,
-    -123261,
-    -123235,
-    -123209,
-    -123182,
-    -123156,
-    -123130,
-    -123104,
-    -123078,
-    -123052,
-    -123025,
-    -122999,
-    -122973,
-    -122947,
-    -122921,
     -122895,
-    -122869,
-    -122843,
-    -122817,
-    -122791,
-    -122764,
-    -122738,
-    -122712,
-    -122686,
-    -122660,
-    -122634,
-    -122608,
-    -122582,
-    -122557,
-    -122531,
-    -122505,
     -122479,
-    -122453,
-    -122427,
-    -122401,
-    -122375,
-    -122349,
-    -122323,
-    -122297,
-    -122272,
-    -122246,
-    -122220,
-    -122194,
-    -122168,
-    -122143,
-    -122117,
-    -122091,
     -122065,
-    -122039,
-    -122014,
-    -121988,
-    -121962,
-    -121937,
-    -121911,
-    -121885,
-    -121859,
-    -121834,
-    -121808,
-    -121782,
-    -121757,
-    -121731,
-    -121706,
-    -121680,
     -121654,
-    -121629,
-    -121603,
-    -121578,
-    -121552,
-    -121526,
-    -121501,
-    -121475,
-    -121450,
-    -121424,
-    -121399,
-    -121373,
-    -121348,
-    -121322,
-    -121297,
-    -121271,
     -121246,
-    -121221,
-    -121195,
-    -121170,
-    -121144,
-    -121119,
-    -121094,
-    -121068,
-    -121043,
-    -121017,
-    -120992,
-    -120967,
-    -120941,
-    -120916,
-    -120891,
-    -120866,
     -120840,
-    -120815,
-    -120790,
-    -120764,
-    -120739,
-    -120714,
-    -120689,
-    -120663,
-    -120638,
-    -120613,
-    -120588,
-    -120563,
-    -120538,
-    -120512,
-    -120487,
-    -120462,
     -120437,
-    -120412,
-    -120387,
-    -120362,
-    -120336,
-    -120311,
-    -120286,
-    -120261,
-    -120236,
-    -120211,
-    -120186,
-    -120161,
-    -120136,
-    -120111,
-    -120086,
-    -120061,
     -120036,
-    -120011,
-    -119986,
-    -119961,
-    -119936,
-    -119911,
-    -119886,
-    -119861,
-    -119837,
-    -119812,
-    -119787,
-    -119762,
-    -119737,
-    -119712,
-    -119687,
-    -119663,
     -119638,
-    -119613,
-    -119588,
-    -119563,
-    -119538,
-    -119514,
-    -119489,
-    -119464,
-    -119439,
-    -119415,
-    -119390,
-    -119365,
-    -119340,
-    -119316,
-    -119291,
-    -119266,
     -119242,
-    -119217,
-    -119192,
-    -119168,
-    -119143,
-    -119118,
-    -119094,
-    -119069,
-    -119045,
-    -119020,
-    -118995,
-    -118971,
-    -118946,
-    -118922,
-    -118897,
-    -118873,
     -118848,
-    -118824,
-    -118799,
-    -118775,
-    -118750,
-    -118726,
-    -118701,
-    -118677,
-    -118652,
-    -118628,
-    -118603,
-    -118579,
-    -118554,
-    -118530,
-    -118506,
-    -118481,
     -118457,
-    -118432,
-    -118408,
-    -118384,
-    -118359,
-    -118335,
-    -118311,
-    -118286,
-    -118262,
-    -118238,
-    -118213,
-    -118189,
-    -118165,
-    -118141,
-    -118116,
-    -118092,
     -118068,
-    -118044,
-    -118019,
-    -117995,
-    -117971,
-    -117947,
-    -117923,
-    -117898,
-    -117874,
-    -117850,
-    -117826,
-    -117802,
-    -117778,
-    -117754,
-    -117729,
-    -117705,
     -117681,
-    -117657,
-    -117633,
-    -117609,
-    -117585,
-    -117561,
-    -117537,
-    -117513,
-    -117489,
-    -117465,
-    -117441,
-    -117417,
-    -117393,
-    -117369,
-    -117345,
-    -117321,
     -117297,
-    -117273,
-    -117249,
-    -117225,
-    -117201,
-    -117177,
-    -117153,
-    -117129,
-    -117106,
-    -117082,
-    -117058,
-    -117034,
-    -117010,
-    -116986,
-    -116962,
-    -116939,
     -116915,
-    -116891,
-    -116867,
-    -116843,
-    -116820,
-    -116796,
-    -116772,
-    -116748,
-    -116725,
-    -116701,
-    -116677,
-    -116653,
-    -116630,
-    -116606,
-    -116582,
-    -116558,
     -116535,
-    -116511,
-    -116487,
-    -116464,
-    -116440,
-    -116417,
-    -116393,
-    -116369,
-    -116346,
-    -116322,
-    -116298,
-    -116275,
-    -116251,
-    -116228,
-    -116204,
-    -116181,
     -116157,
-    -116134,
-    -116110,
-    -116087,
-    -116063,
-    -116039,
-    -116016,
-    -115993,
-    -115969,
-    -115946,
-    -115922,
-    -115899,
-    -115875,
-    -115852,
-    -115828,
-    -115805,
     -115782,
-    -115758,
-    -115735,
-    -115711,
-    -115688,
-    -115665,
-    -115641,
-    -115618,
-    -115595,
-    -115571,
-    -115548,
-    -115525,
-    -115501,
-    -115478,
-    -115455,
-    -115431,
     -115408,
-    -115385,
-    -115362,
-    -115338,
-    -115315,
-    -115292,
-    -115269,
-    -115245,
-    -115222,
-    -115199,
-    -115176,
-    -115153,
-    -115129,
-    -115106,
-    -115083,
-    -115060,
     -115037,
-    -115014,
-    -114991,
-    -114967,
-    -114944,
-    -114921,
-    -114898,
-    -114875,
-    -114852,
-    -114829,
-    -114806,
-    -114783,
-    -114760,
-    -114737,
-    -114714,
-    -114691,
     -114668,
-    -114645,
-    -114622,
-    -114599,
-    -114576,
-    -114553,
-    -114530,
-    -114507,
-    -114484,
-    -114461,
-    -114438,
-    -114415,
-    -114392,
-    -114369,
-    -114346,
-    -114323,
     -114300,
-    -114278,
-    -114255,
-    -114232,
-    -114209,
-    -114186,
-    -114163,
-    -114140,
-    -114118,
-    -114095,
-    -114072,
-    -114049,
-    -114026,
-    -114004,
-    -113981,
-    -113958,
     -113935,
-    -113913,
-    -113890,
-    -113867,
-    -113844,
-    -113822,
-    -113799,
-    -113776,
-    -113754,
-    -113731,
-    -113708,
-    -113685,
-    -113663,
-    -113640,
-    -113618,
-    -113595,
     -113572,
-    -113550,
-    -113527,
-    -113504,
-    -113482,
-    -113459,
-    -113437,
-    -113414,
-    -113391,
-    -113369,
-    -113346,
-    -113324,
-    -113301,
-    -113279,
-    -113256,
-    -113234,
     -113211,
-    -113189,
-    -113166,
-    -113144,
-    -113121,
-    -113099,
-    -113076,
-    -113054,
-    -113031,
-    -113009,
-    -112986,
-    -112964,
-    -112942,
-    -112919,
-    -112897,
-    -112874,
     -112852,
-    -112830,
-    -112807,
-    -112785,
-    -112763,
-    -112740,
-    -112718,
-    -112696,
-    -112673,
-    -112651,
-    -112629,
-    -112606,
-    -112584,
-    -112562,
-    -112539,
-    -112517,
     -112495,
-    -112473,
-    -112450,
-    -112428,
-    -112406,
-    -112384,
-    -112361,
-    -112339,
-    -112317,
-    -112295,
-    -112273,
-    -112250,
-    -112228,
-    -112206,
-    -112184,
-    -112162,
     -112140,
-    -112118,
-    -112095,
-    -112073,
-    -112051,
-    -112029,
-    -112007,
-    -111985,
-    -111963,
-    -111941,
-    -111919,
-    -111897,
-    -111875,
-    -111853,
-    -111830,
-    -111808,
     -111786,
-    -111764,
-    -111742,
-    -111720,
-    -111698,
-    -111676,
-    -111654,
-    -111632,
-    -111610,
-    -111589,
-    -111567,
-    -111545,
-    -111523,
-    -111501,
-    -111479,
-    -111457,
     -111435,
-    -111413,
-    -111391,
-    -111369,
-    -111347,
-    -111326,
-    -111304,
-    -111282,
-    -111260,
-    -111238,
-    -111216,
-    -111195,
-    -111173,
-    -111151,
-    -111129,
-    -111107,
     -111085,
-    -111064,
-    -111042,
-    -111020,
-    -110998,
-    -110977,
-    -110955,
-    -110933,
-    -110911,
-    -110890,
-    -110868,
-    -110846,
-    -110825,
-    -110803,
-    -110781,
-    -110759,
     -110738,
-    -110716,
-    -110694,
-    -110673,
-    -110651,
-    -110630,
-    -110608,
-    -110586,
-    -110565,
-    -110543,
-    -110521,
-    -110500,
-    -110478,
-    -110457,
-    -110435,
-    -110414,
     -110392,
-    -110370,
-    -110349,
-    -110327,
-    -110306,
-    -110284,
-    -110263,
-    -110241,
-    -110220,
-    -110198,
-    -110177,
-    -110155,
-    -110134,
-    -110112,
-    -110091,
-    -110069,
     -110048,
-    -110027,
-    -110005,
-    -109984,
-    -109962,
-    -109941,
-    -109919,
-    -109898,
-    -109877,
-    -109855,
-    -109834,
-    -109812,
-    -109791,
-    -109770,
-    -109748,
-    -109727,
     -109706,
-    -109684,
-    -109663,
-    -109642,
-    -109620,
-    -109599,
-    -109578,
-    -109557,
-    -109535,
-    -109514,
-    -109493,
-    -109471,
-    -109450,
-    -109429,
-    -109408,
-    -109386,
     -109365,
-    -109344,
-    -109323,
-    -109302,
-    -109280,
-    -109259,
-    -109238,
-    -109217,
-    -109196,
-    -109175,
-    -109153,
-    -109132,
-    -109111,
-    -109090,
-    -109069,
-    -109048,
     -109027,
-    -109005,
-    -108984,
-    -108963,
-    -108942,
-    -108921,
-    -108900,
-    -108879,
-    -108858,
-    -108837,
-    -108816,
-    -108795,
-    -108774,
-    -108753,
-    -108732,
-    -108711,
     -108690,
-    -108669,
-    -108648,
-    -108627,
-    -108606,
-    -108585,
-    -108564,
-    -108543,
-    -108522,
-    -108501,
-    -108480,
-    -108459,
-    -108438,
-    -108417,
-    -108396,
-    -108375,
     -108354,
-    -108334,
-    -108313,
-    -108292,
-    -108271,
-    -108250,
-    -108229,
-    -108208,
-    -108187,
-    -108167,
-    -108146,
-    -108125,
-    -108104,
-    -108083,
-    -108062,
-    -108042,
     -108021,
-    -108000,
-    -107979,
-    -107959,
-    -107938,
-    -107917,
-    -107896,
-    -107876,
-    -107855,
-    -107834,
-    -107813,
-    -107793,
-    -107772,
-    -107751,
-    -107730,
-    -107710,
     -107689,
-    -107668,
-    -107648,
-    -107627,
-    -107606,
-    -107586,
-    -107565,
-    -107544,
-    -107524,
-    -107503,
-    -107483,
-    -107462,
-    -107441,
-    -107421,
-    -107400,
-    -107379,
     -107359,
-    -107338,
-    -107318,
-    -107297,
-    -107277,
-    -107256,
-    -107236,
-    -107215,
-    -107194,
-    -107174,
-    -107153,
-    -107133,
-    -107112,
-    -107092,
-    -107071,
-    -107051,
     -107030,
-    -107010,
-    -106989,
-    -106969,
-    -106949,
-    -106928,
-    -106908,
-    -106887,
-    -106867,
-    -106846,
-    -106826,
-    -106806,
-    -106785,
-    -106765,
-    -106744,
-    -106724,
     -106704,
-    -106683,
-    -106663,
-    -106642,
-    -106622,
-    -106602,
-    -106581,
-    -106561,
-    -106541,
-    -106520,
-    -106500,
-    -106480,
-    -106459,
-    -106439,
-    -106419,
-    -106399,
     -106378,
-    -106358,
-    -106338,
-    -106318,
-    -106297,
-    -106277,
-    -106257,
-    -106237,
-    -106216,
-    -106196,
-    -106176,
-    -106156,
-    -106135,
-    -106115,
-    -106095,
-    -106075,
     -106055,
-    -106034,
-    -106014,
-    -105994,
-    -105974,
-    -105954,
-    -105934,
-    -105914,
-    -105893,
-    -105873,
-    -105853,
-    -105833,
-    -105813,
-    -105793,
-    -105773,
-    -105753,
     -105733,
-    -105713,
-    -105692,
-    -105672,
-    -105652,
-    -105632,
-    -105612,
-    -105592,
-    -105572,
-    -105552,
-    -105532,
-    -105512,
-    -105492,
-    -105472,
-    -105452,
-    -105432,
     -105412,
-    -105392,
-    -105372,
-    -105352,
-    -105332,
-    -105312,
-    -105292,
-    -105272,
-    -105253,
-    -105233,
-    -105213,
-    -105193,
-    -105173,
-    -105153,
-    -105133,
-    -105113,
     -105093,
-    -105073,
-    -105053,
-    -105034,
-    -105014,
-    -104994,
-    -104974,
-    -104954,
-    -104934,
-    -104915,
-    -104895,
-    -104875,
-    -104855,
-    -104835,
-    -104815,
-    -104796,
     -104776,
-    -104756,
-    -104736,
-    -104717,
-    -104697,
-    -104677,
-    -104657,
-    -104638,
-    -104618,
-    -104598,
-    -104578,
-    -104559,
-    -104539,
-    -104519,
-    -104499,
-    -104480,
     -104460,
-    -104440,
-    -104421,
-    -104401,
-    -104381,
-    -104362,
-    -104342,
-    -104322,
-    -104303,
-    -104283,
-    -104263,
-    -104244,
-    -104224,
-    -104205,
-    -104185,
-    -104165,
     -104146,
-    -104126,
-    -104107,
-    -104087,
-    -104067,
-    -104048,
-    -104028,
-    -104009,
-    -103989,
-    -103970,
-    -103950,
-    -103930,
-    -103911,
-    -103891,
-    -103872,
-    -103852,
     -103833,
-    -103813,
-    -103794,
-    -103774,
-    -103755,
-    -103735,
-    -103716,
-    -103697,
-    -103677,
-    -103658,
-    -103638,
-    -103619,
-    -103599,
-    -103580,
-    -103560,
-    -103541,
     -103522,
-    -103502,
-    -103483,
-    -103463,
-    -103444,
-    -103425,
-    -103405,
-    -103386,
-    -103366,
-    -103347,
-    -103328,
-    -103308,
-    -103289,
-    -103270,
-    -103250,
-    -103231,
     -103212,
-    -103192,
-    -103173,
-    -103154,
-    -103134,
-    -103115,
-    -103096,
-    -103077,
-    -103057,
-    -103038,
-    -103019,
-    -103000,
-    -102980,
-    -102961,
-    -102942,
-    -102923,
     -102903,
-    -102884,
-    -102865,
-    -102846,
-    -102826,
-    -102807,
-    -102788,
-    -102769,
-    -102750,
-    -102730,
-    -102711,
-    -102692,
-    -102673,
-    -102654,
-    -102635,
-    -102615,
     -102596,
-    -102577,
-    -102558,
-    -102539,
-    -102520,
-    -102501,
-    -102482,
-    -102462,
-    -102443,
-    -102424,
-    -102405,
-    -102386,
-    -102367,
-    -102348,
-    -102329,
-    -102310,
     -102291,
-    -102272,
-    -102253,
-    -102234,
-    -102215,
-    -102196,
-    -102177,
-    -102158,
-    -102139,
-    -102120,
-    -102101,
-    -102082,
-    -102063,
-    -102044,
-    -102025,
-    -102006,
     -101987,
-    -101968,
-    -101949,
-    -101930,
-    -101911,
-    -101892,
-    -101873,
-    -101854,
-    -101835,
-    -101816,
-    -101797,
-    -101778,
-    -101760,
-    -101741,
-    -101722,
-    -101703,
     -101684,
-    -101665,
-    -101646,
-    -101627,
-    -101609,
-    -101590,
-    -101571,
-    -101552,
-    -101533,
-    -101514,
-    -101495,
-    -101477,
-    -101458,
-    -101439,
-    -101420,
-    -101401,
     -101383,
-    -101364,
-    -101345,
-    -101326,
-    -101308,
-    -101289,
-    -101270,
-    -101251,
-    -101233,
-    -101214,
-    -101195,
-    -101176,
-    -101158,
-    -101139,
-    -101120,
-    -101101,
     -101083,
-    -101064,
-    -101045,
-    -101027,
-    -101008,
-    -100989,
-    -100971,
-    -100952,
-    -100933,
-    -100915,
-    -100896,
-    -100877,
-    -100859,
-    -100840,
-    -100821,
-    -100803,
     -100784,
-    -100766,
-    -100747,
-    -100728,
-    -100710,
-    -100691,
-    -100673,
-    -100654,
-    -100635,
-    -100617,
-    -100598,
-    -100580,
-    -100561,
-    -100543,
-    -100524,
-    -100505,
     -100487,
-    -100468,
-    -100450,
-    -100431,
-    -100413,
-    -100394,
-    -100376,
-    -100357,
-    -100339,
-    -100320,
-    -100302,
-    -100283,
-    -100265,
-    -100246,
-    -100228,
-    -100210,
     -100191,
-    -100173,
-    -100154,
-    -100136,
-    -100117,
-    -100099,
-    -100080,
-    -100062,
-    -100044,
-    -100025,
-    -100007,
-    -99988,
-    -99970,
-    -99952,
-    -99933,
-    -99915,
     -99897,
-    -99878,
-    -99860,
-    -99841,
-    -99823,
-    -99805,
-    -99786,
-    -99768,
-    -99750,
-    -99731,
-    -99713,
-    -99695,
-    -99676,
-    -99658,
-    -99640,
-    -99622,
     -99603,
-    -99585,
-    -99567,
-    -99548,
-    -99530,
-    -99512,
-    -99494,
-    -99475,
-    -99457,
-    -99439,
-    -99421,
-    -99402,
-    -99384,
-    -99366,
-    -99348,
-    -99330,
     -99311,
-    -99293,
-    -99275,
-    -99257,
-    -99239,
-    -99220,
-    -99202,
-    -99184,
-    -99166,
-    -99148,
-    -99130,
-    -99111,
-    -99093,
-    -99075,
-    -99057,
-    -99039,
     -99021,
-    -99003,
-    -98985,
-    -98966,
-    -98948,
-    -98930,
-    -98912,
-    -98894,
-    -98876,
-    -98858,
-    -98840,
-    -98822,
-    -98804,
-    -98786,
-    -98768,
-    -98749,
     -98731,
-    -98713,
-    -98695,
-    -98677,
-    -98659,
-    -98641,
-    -98623,
-    -98605,
-    -98587,
-    -98569,
-    -98551,
-    -98533,
-    -98515,
-    -98497,
-    -98479,
-    -98461,
     -98443,
-    -98425,
-    -98407,
-    -98389,
-    -98372,
-    -98354,
-    -98336,
-    -98318,
-    -98300,
-    -98282,
-    -98264,
-    -98246,
-    -98228,
-    -98210,
-    -98192,
-    -98174,
     -98157,
-    -98139,
-    -98121,
-    -98103,
-    -98085,
-    -98067,
-    -98049,
-    -98031,
-    -98014,
-    -97996,
-    -97978,
-    -97960,
-    -97942,
-    -97924,
-    -97907,
-    -97889,
     -97871,
-    -97853,
-    -97835,
-    -97818,
-    -97800,
-    -97782,
-    -97764,
-    -97746,
-    -97729,
-    -97711,
-    -97693,
-    -97675,
-    -97658,
-    -97640,
-    -97622,
-    -97604,
     -97587,
-    -97569,
-    -97551,
-    -97533,
-    -97516,
-    -97498,
-    -97480,
-    -97463,
-    -97445,
-    -97427,
-    -97410,
-    -97392,
-    -97374,
-    -97357,
-    -97339,
-    -97321,
     -97304,
-    -97286,
-    -97268,
-    -97251,
-    -97233,
-    -97215,
-    -97198,
-    -97180,
-    -97162,
-    -97145,
-    -97127,
-    -97110,
-    -97092,
-    -97074,
-    -97057,
-    -97039,
     -97022,
-    -97004,
-    -96987,
-    -96969,
-    -96951,
-    -96934,
-    -96916,
-    -96899,
-    -96881,
-    -96864,
-    -96846,
-    -96829,
-    -96811,
-    -96794,
-    -96776,
-    -96759,
     -96741,
-    -96724,
-    -96706,
-    -96689,
-    -96671,
-    -96654,
-    -96636,
-    -96619,
-    -96601,
-    -96584,
-    -96566,
-    -96549,
-    -96531,
-    -96514,
-    -96496,
-    -96479,
     -96462,
-    -96444,
-    -96427,
-    -96409,
-    -96392,
-    -96374,
-    -96357,
-    -96340,
-    -96322,
-    -96305,
-    -96287,
-    -96270,
-    -96253,
-    -96235,
-    -96218,
-    -96201,
     -96183,
-    -96166,
-    -96149,
-    -96131,
-    -96114,
-    -96097,
-    -96079,
-    -96062,
-    -96045,
-    -96027,
-    -96010,
-    -95993,
-    -95975,
-    -95958,
-    -95941,
-    -95923,
     -95906,
-    -95889,
-    -95872,
-    -95854,
-    -95837,
-    -95820,
-    -95803,
-    -95785,
-    -95768,
-    -95751,
-    -95734,
-    -95716,
-    -95699,
-    -95682,
-    -95665,
-    -95647,
     -95630,
-    -95613,
-    -95596,
-    -95579,
-    -95561,
-    -95544,
-    -95527,
-    -95510,
-    -95493,
-    -95475,
-    -95458,
-    -95441,
-    -95424,
-    -95407,
-    -95390,
-    -95373,
     -95355,
-    -95338,
-    -95321,
-    -95304,
-    -95287,
-    -95270,
-    -95253,
-    -95236,
-    -95218,
-    -95201,
-    -95184,
-    -95167,
-    -95150,
-    -95133,
-    -95116,
-    -95099,
     -95082,
-    -95065,
-    -95048,
-    -95031,
-    -95014,
-    -94997,
-    -94979,
-    -94962,
-    -94945,
-    -94928,
-    -94911,
-    -94894,
-    -94877,
-    -94860,
-    -94843,
-    -94826,
     -94809,
-    -94792,
-    -94775,
-    -94758,
-    -94741,
-    -94724,
-    -94707,
-    -94690,
-    -94673,
-    -94656,
-    -94640,
-    -94623,
-    -94606,
-    -94589,
-    -94572,
-    -94555,
     -94538,
-    -94521,
-    -94504,
-    -94487,
-    -94470,
-    -94453,
-    -94436,
-    -94420,
-    -94403,
-    -94386,
-    -94369,
-    -94352,
-    -94335,
-    -94318,
-    -94301,
-    -94285,
     -94268,
-    -94251,
-    -94234,
-    -94217,
-    -94200,
-    -94183,
-    -94167,
-    -94150,
-    -94133,
-    -94116,
-    -94099,
-    -94083,
-    -94066,
-    -94049,
-    -94032,
-    -94015,
     -93999,
-    -93982,
-    -93965,
-    -93948,
-    -93931,
-    -93915,
-    -93898,
-    -93881,
-    -93864,
-    -93848,
-    -93831,
-    -93814,
-    -93797,
-    -93781,
-    -93764,
-    -93747,
     -93730,
-    -93714,
-    -93697,
-    -93680,
-    -93664,
-    -93647,
-    -93630,
-    -93614,
-    -93597,
-    -93580,
-    -93564,
-    -93547,
-    -93530,
-    -93513,
-    -93497,
-    -93480,
     -93464,
-    -93447,
-    -93430,
-    -93414,
-    -93397,
-    -93380,
-    -93364,
-    -93347,
-    -93330,
-    -93314,
-    -93297,
-    -93281,
-    -93264,
-    -93247,
-    -93231,
-    -93214,
     -93198,
-    -93181,
-    -93165,
-    -93148,
-    -93131,
-    -93115,
-    -93098,
-    -93082,
-    -93065,
-    -93049,
-    -93032,
-    -93016,
-    -92999,
-    -92982,
-    -92966,
-    -92949,
     -92933,
-    -92916,
-    -92900,
-    -92883,
-    -92867,
-    -92850,
-    -92834,
-    -92817,
-    -92801,
-    -92784,
-    -92768,
-    -92751,
-    -92735,
-    -92719,
-    -92702,
-    -92686,
     -92669,
-    -92653,
-    -92636,
-    -92620,
-    -92603,
-    -92587,
-    -92571,
-    -92554,
-    -92538,
-    -92521,
-    -92505,
-    -92488,
-    -92472,
-    -92456,
-    -92439,
-    -92423,
     -92406,
-    -92390,
-    -92374,
-    -92357,
-    -92341,
-    -92325,
-    -92308,
-    -92292,
-    -92276,
-    -92259,
-    -92243,
-    -92226,
-    -92210,
-    -92194,
-    -92177,
-    -92161,
     -92145,
-    -92129,
-    -92112,
-    -92096,
-    -92080,
-    -92063,
-    -92047,
-    -92031,
-    -92014,
-    -91998,
-    -91982,
-    -91966,
-    -91949,
-    -91933,
-    -91917,
-    -91901,
     -91884,
-    -91868,
-    -91852,
-    -91836,
-    -91819,
-    -91803,
-    -91787,
-    -91771,
-    -91754,
-    -91738,
-    -91722,
-    -91706,
-    -91690,
-    -91673,
-    -91657,
-    -91641,
     -91625,
-    -91609,
-    -91592,
-    -91576,
-    -91560,
-    -91544,
-    -91528,
-    -91511,
-    -91495,
-    -91479,
-    -91463,
-    -91447,
-    -91431,
-    -91415,
-    -91398,
-    -91382,
     -91366,
-    -91350,
-    -91334,
-    -91318,
-    -91302,
-    -91286,
-    -91270,
-    -91253,
-    -91237,
-    -91221,
-    -91205,
-    -91189,
-    -91173,
-    -91157,
-    -91141,
-    -91125,
     -91109,
-    -91093,
-    -91077,
-    -91061,
-    -91044,
-    -91028,
-    -91012,
-    -90996,
-    -90980,
-    -90964,
-    -90948,
-    -90932,
-    -90916,
-    -90900,
-    -90884,
-    -90868,
     -90852,
-    -90836,
-    -90820,
-    -90804,
-    -90788,
-    -90772,
-    -90756,
-    -90740,
-    -90724,
-    -90708,
-    -90692,
-    -90676,
-    -90660,
-    -90645,
-    -90629,
-    -90613,
     -90597,
-    -90581,
-    -90565,
-    -90549,
-    -90533,
-    -90517,
-    -90501,
-    -90485,
-    -90469,
-    -90453,
-    -90438,
-    -90422,
-    -90406,
-    -90390,
-    -90374,
-    -90358,
     -90342,
-    -90326,
-    -90310,
-    -90295,
-    -90279,
-    -90263,
-    -90247,
-    -90231,
-    -90215,
-    -90199,
-    -90184,
-    -90168,
-    -90152,
-    -90136,
-    -90120,
-    -90104,
     -90089,
-    -90073,
-    -90057,
-    -90041,
-    -90025,
-    -90010,
-    -89994,
-    -89978,
-    -89962,
-    -89946,
-    -89931,
-    -89915,
-    -89899,
-    -89883,
-    -89868,
-    -89852,
     -89836,
-    -89820,
-    -89805,
-    -89789,
-    -89773,
-    -89757,
-    -89742,
-    -89726,
-    -89710,
-    -89694,
-    -89679,
-    -89663,
-    -89647,
-    -89632,
-    -89616,
-    -89600,
     -89585,
-    -89569,
-    -89553,
-    -89537,
-    -89522,
-    -89506,
-    -89490,
-    -89475,
-    -89459,
-    -89443,
-    -89428,
-    -89412,
-    -89396,
-    -89381,
-    -89365,
-    -89350,
     -89334,
-    -89318,
-    -89303,
-    -89287,
-    -89271,
-    -89256,
-    -89240,
-    -89225,
-    -89209,
-    -89193,
-    -89178,
-    -89162,
-    -89147,
-    -89131,
-    -89115,
-    -89100,
     -89084,
-    -89069,
-    -89053,
-    -89038,
-    -89022,
-    -89006,
-    -88991,
-    -88975,
-    -88960,
-    -88944,
-    -88929,
-    -88913,
-    -88898,
-    -88882,
-    -88867,
-    -88851,
     -88836,
-    -88820,
-    -88805,
-    -88789,
-    -88774,
-    -88758,
-    -88743,
-    -88727,
-    -88712,
-    -88696,
-    -88681,
-    -88665,
-    -88650,
-    -88634,
-    -88619,
-    -88603,
     -88588,
-    -88572,
-    -88557,
-    -88541,
-    -88526,
-    -88511,
-    -88495,
-    -88480,
-    -88464,
-    -88449,
-    -88433,
-    -88418,
-    -88403,
-    -88387,
-    -88372,
-    -88356,
     -88341,
-    -88326,
-    -88310,
-    -88295,
-    -88279,
-    -88264,
-    -88249,
-    -88233,
-    -88218,
-    -88202,
-    -88187,
-    -88172,
-    -88156,
-    -88141,
-    -88126,
-    -88110,
     -88095,
-    -88080,
-    -88064,
-    -88049,
-    -88034,
-    -88018,
-    -88003,
-    -87988,
-    -87972,
-    -87957,
-    -87942,
-    -87926,
-    -87911,
-    -87896,
-    -87881,
-    -87865,
     -87850,
-    -87835,
-    -87819,
-    -87804,
-    -87789,
-    -87774,
-    -87758,
-    -87743,
-    -87728,
-    -87713,
-    -87697,
-    -87682,
-    -87667,
-    -87652,
-    -87636,
-    -87621,
     -87606,
-    -87591,
-    -87575,
-    -87560,
-    -87545,
-    -87530,
-    -87515,
-    -87499,
-    -87484,
-    -87469,
-    -87454,
-    -87439,
-    -87423,
-    -87408,
-    -87393,
-    -87378,
     -87363,
-    -87348,
-    -87332,
-    -87317,
-    -87302,
-    -87287,
-    -87272,
-    -87257,
-    -87242,
-    -87226,
-    -87211,
-    -87196,
-    -87181,
-    -87166,
-    -87151,
-    -87136,
     -87120,
-    -87105,
-    -87090,
-    -87075,
-    -87060,
-    -87045,
-    -87030,
-    -87015,
-    -87000,
-    -86985,
-    -86970,
-    -86954,
-    -86939,
-    -86924,
-    -86909,
-    -86894,
     -86879,
-    -86864,
-    -86849,
-    -86834,
-    -86819,
-    -86804,
-    -86789,
-    -86774,
-    -86759,
-    -86744,
-    -86729,
-    -86714,
-    -86699,
-    -86684,
-    -86669,
-    -86654,
     -86639,
-    -86624,
-    -86609,
-    -86594,
-    -86579,
-    -86564,
-    -86549,
-    -86534,
-    -86519,
-    -86504,
-    -86489,
-    -86474,
-    -86459,
-    -86444,
-    -86429,
-    -86414,
     -86399,
-    -86384,
-    -86369,
-    -86354,
-    -86339,
-    -86324,
-    -86309,
-    -86294,
-    -86279,
-    -86265,
-    -86250,
-    -86235,
-    -86220,
-    -86205,
-    -86190,
-    -86175,
     -86160,
-    -86145,
-    -86130,
-    -86116,
-    -86101,
-    -86086,
-    -86071,
-    -86056,
-    -86041,
-    -86026,
-    -86011,
-    -85997,
-    -85982,
-    -85967,
-    -85952,
-    -85937,
     -85922,
-    -85908,
-    -85893,
-    -85878,
-    -85863,
-    -85848,
-    -85833,
-    -85819,
-    -85804,
-    -85789,
-    -85774,
-    -85759,
-    -85744,
-    -85730,
-    -85715,
-    -85700,
     -85685,
-    -85671,
-    -85656,
-    -85641,
-    -85626,
-    -85611,
-    -85597,
-    -85582,
-    -85567,
-    -85552,
-    -85538,
-    -85523,
-    -85508,
-    -85493,
-    -85479,
-    -85464,
     -85449,
-    -85434,
-    -85420,
-    -85405,
-    -85390,
-    -85376,
-    -85361,
-    -85346,
-    -85331,
-    -85317,
-    -85302,
-    -85287,
-    -85273,
-    -85258,
-    -85243,
-    -85229,
     -85214,
-    -85199,
-    -85184,
-    -85170,
-    -85155,
-    -85140,
-    -85126,
-    -85111,
-    -85096,
-    -85082,
-    -85067,
-    -85053,
-    -85038,
-    -85023,
-    -85009,
-    -84994,
     -84979,
-    -84965,
-    -84950,
-    -84935,
-    -84921,
-    -84906,
-    -84892,
-    -84877,
-    -84862,
-    -84848,
-    -84833,
-    -84819,
-    -84804,
-    -84789,
-    -84775,
-    -84760,
     -84746,
-    -84731,
-    -84717,
-    -84702,
-    -84687,
-    -84673,
-    -84658,
-    -84644,
-    -84629,
-    -84615,
-    -84600,
-    -84586,
-    -84571,
-    -84557,
-    -84542,
-    -84527,
     -84513,
-    -84498,
-    -84484,
-    -84469,
-    -84455,
-    -84440,
-    -84426,
-    -84411,
-    -84397,
-    -84382,
-    -84368,
-    -84353,
-    -84339,
-    -84324,
-    -84310,
-    -84295,
     -84281,
-    -84266,
-    -84252,
-    -84238,
-    -84223,
-    -84209,
-    -84194,
-    -84180,
-    -84165,
-    -84151,
-    -84136,
-    -84122,
-    -84107,
-    -84093,
-    -84079,
-    -84064,
     -84050,
-    -84035,
-    -84021,
-    -84007,
-    -83992,
-    -83978,
-    -83963,
-    -83949,
-    -83934,
-    -83920,
-    -83906,
-    -83891,
-    -83877,
-    -83863,
-    -83848,
-    -83834,
     -83819,
-    -83805,
-    -83791,
-    -83776,
-    -83762,
-    -83748,
-    -83733,
-    -83719,
-    -83705,
-    -83690,
-    -83676,
-    -83662,
-    -83647,
-    -83633,
-    -83619,
-    -83604,
     -83590,
-    -83576,
-    -83561,
-    -83547,
-    -83533,
-    -83518,
-    -83504,
-    -83490,
-    -83475,
-    -83461,
-    -83447,
-    -83433,
-    -83418,
-    -83404,
-    -83390,
-    -83375,
     -83361,
-    -83347,
-    -83333,
-    -83318,
-    -83304,
-    -83290,
-    -83276,
-    -83261,
-    -83247,
-    -83233,
-    -83219,
-    -83204,
-    -83190,
-    -83176,
-    -83162,
-    -83147,
     -83133,
-    -83119,
-    -83105,
-    -83091,
-    -83076,
-    -83062,
-    -83048,
-    -83034,
-    -83019,
-    -83005,
-    -82991,
-    -82977,
-    -82963,
-    -82949,
-    -82934,
-    -82920,
     -82906,
-    -82892,
-    -82878,
-    -82863,
-    -82849,
-    -82835,
-    -82821,
-    -82807,
-    -82793,
-    -82779,
-    -82764,
-    -82750,
-    -82736,
-    -82722,
-    -82708,
-    -82694,
     -82680,
-    -82665,
-    -82651,
-    -82637,
-    -82623,
-    -82609,
-    -82595,
-    -82581,
-    -82567,
-    -82553,
-    -82539,
-    -82524,
-    -82510,
-    -82496,
-    -82482,
-    -82468,
     -82454,
-    -82440,
-    -82426,
-    -82412,
-    -82398,
-    -82384,
-    -82370,
-    -82356,
-    -82342,
-    -82327,
-    -82313,
-    -82299,
-    -82285,
-    -82271,
-    -82257,
-    -82243,
     -82229,
-    -82215,
-    -82201,
-    -82187,
-    -82173,
-    -82159,
-    -82145,
-    -82131,
-    -82117,
-    -82103,
-    -82089,
-    -82075,
-    -82061,
-    -82047,
-    -82033,
-    -82019,
     -82005,
-    -81991,
-    -81977,
-    -81963,
-    -81949,
-    -81935,
-    -81921,
-    -81907,
-    -81893,
-    -81879,
-    -81865,
-    -81852,
-    -81838,
-    -81824,
-    -81810,
-    -81796,
     -81782,
-    -81768,
-    -81754,
-    -81740,
-    -81726,
-    -81712,
-    -81698,
-    -81684,
-    -81670,
-    -81657,
-    -81643,
-    -81629,
-    -81615,
-    -81601,
-    -81587,
-    -81573,
     -81559,
-    -81545,
-    -81532,
-    -81518,
-    -81504,
-    -81490,
-    -81476,
-    -81462,
-    -81448,
-    -81434,
-    -81421,
-    -81407,
-    -81393,
-    -81379,
-    -81365,
-    -81351,
     -81338,
-    -81324,
-    -81310,
-    -81296,
-    -81282,
-    -81268,
-    -81255,
-    -81241,
-    -81227,
-    -81213,
-    -81199,
-    -81185,
-    -81172,
-    -81158,
-    -81144,
-    -81130,
     -81117,
-    -81103,
-    -81089,
-    -81075,
-    -81061,
-    -81048,
-    -81034,
-    -81020,
-    -81006,
-    -80993,
-    -80979,
-    -80965,
-    -80951,
-    -80937,
-    -80924,
-    -80910,
     -80896,
-    -80882,
-    -80869,
-    -80855,
-    -80841,
-    -80828,
-    -80814,
-    -80800,
-    -80786,
-    -80773,
-    -80759,
-    -80745,
-    -80731,
-    -80718,
-    -80704,
-    -80690,
     -80677,
-    -80663,
-    -80649,
-    -80636,
-    -80622,
-    -80608,
-    -80595,
-    -80581,
-    -80567,
-    -80553,
-    -80540,
-    -80526,
-    -80512,
-    -80499,
-    -80485,
-    -80472,
     -80458,
-    -80444,
-    -80431,
-    -80417,
-    -80403,
-    -80390,
-    -80376,
-    -80362,
-    -80349,
-    -80335,
-    -80321,
-    -80308,
-    -80294,
-    -80281,
-    -80267,
-    -80253,
     -80240,
-    -80226,
-    -80213,
-    -80199,
-    -80185,
-    -80172,
-    -80158,
-    -80145,
-    -80131,
-    -80117,
-    -80104,
-    -80090,
-    -80077,
-    -80063,
-    -80050,
-    -80036,
     -80022,
-    -80009,
-    -79995,
-    -79982,
-    -79968,
-    -79955,
-    -79941,
-    -79928,
-    -79914,
-    -79900,
-    -79887,
-    -79873,
-    -79860,
-    -79846,
-    -79833,
-    -79819,
     -79806,
-    -79792,
-    -79779,
-    -79765,
-    -79752,
-    -79738,
-    -79725,
-    -79711,
-    -79698,
-    -79684,
-    -79671,
-    -79657,
-    -79644,
-    -79630,
-    -79617,
-    -79603,
     -79590,
-    -79576,
-    -79563,
-    -79549,
-    -79536,
-    -79522,
-    -79509,
-    -79496,
-    -79482,
-    -79469,
-    -79455,
-    -79442,
-    -79428,
-    -79415,
-    -79401,
-    -79388,
     -79375,
-    -79361,
-    -79348,
-    -79334,
-    -79321,
-    -79307,
-    -79294,
-    -79281,
-    -79267,
-    -79254,
-    -79240,
-    -79227,
-    -79214,
-    -79200,
-    -79187,
-    -79173,
     -79160,
-    -79147,
-    -79133,
-    -79120,
-    -79107,
-    -79093,
-    -79080,
-    -79066,
-    -79053,
-    -79040,
-    -79026,
-    -79013,
-    -79000,
-    -78986,
-    -78973,
-    -78960,
     -78946,
-    -78933,
-    -78920,
-    -78906,
-    -78893,
-    -78880,
-    -78866,
-    -78853,
-    -78840,
-    -78826,
-    -78813,
-    -78800,
-    -78786,
-    -78773,
-    -78760,
-    -78746,
     -78733,
-    -78720,
-    -78707,
-    -78693,
-    -78680,
-    -78667,
-    -78653,
-    -78640,
-    -78627,
-    -78614,
-    -78600,
-    -78587,
-    -78574,
-    -78560,
-    -78547,
-    -78534,
     -78521,
-    -78507,
-    -78494,
-    -78481,
-    -78468,
-    -78454,
-    -78441,
-    -78428,
-    -78415,
-    -78401,
-    -78388,
-    -78375,
-    -78362,
-    -78349,
-    -78335,
-    -78322,
     -78309,
-    -78296,
-    -78283,
-    -78269,
-    -78256,
-    -78243,
-    -78230,
-    -78217,
-    -78203,
-    -78190,
-    -78177,
-    -78164,
-    -78151,
-    -78137,
-    -78124,
-    -78111,
     -78098,
-    -78085,
-    -78072,
-    -78058,
-    -78045,
-    -78032,
-    -78019,
-    -78006,
-    -77993,
-    -77979,
-    -77966,
-    -77953,
-    -77940,
-    -77927,
-    -77914,
-    -77901,
     -77887,
-    -77874,
-    -77861,
-    -77848,
-    -77835,
-    -77822,
-    -77809,
-    -77796,
-    -77783,
-    -77769,
-    -77756,
-    -77743,
-    -77730,
-    -77717,
-    -77704,
-    -77691,
     -77678,
-    -77665,
-    -77652,
-    -77639,
-    -77625,
-    -77612,
-    -77599,
-    -77586,
-    -77573,
-    -77560,
-    -77547,
-    -77534,
-    -77521,
-    -77508,
-    -77495,
-    -77482,
     -77469,
-    -77456,
-    -77443,
-    -77430,
-    -77417,
-    -77404,
-    -77390,
-    -77377,
-    -77364,
-    -77351,
-    -77338,
-    -77325,
-    -77312,
-    -77299,
-    -77286,
-    -77273,
     -77260,
-    -77247,
-    -77234,
-    -77221,
-    -77208,
-    -77195,
-    -77182,
-    -77169,
-    -77156,
-    -77143,
-    -77130,
-    -77117,
-    -77104,
-    -77092,
-    -77079,
-    -77066,
     -77053,
-    -77040,
-    -77027,
-    -77014,
-    -77001,
-    -76988,
-    -76975,
-    -76962,
-    -76949,
-    -76936,
-    -76923,
-    -76910,
-    -76897,
-    -76884,
-    -76871,
-    -76858,
     -76846,
-    -76833,
-    -76820,
-    -76807,
-    -76794,
-    -76781,
-    -76768,
-    -76755,
-    -76742,
-    -76729,
-    -76716,
-    -76704,
-    -76691,
-    -76678,
-    -76665,
-    -76652,
     -76639,
-    -76626,
-    -76613,
-    -76601,
-    -76588,
-    -76575,
-    -76562,
-    -76549,
-    -76536,
-    -76523,
-    -76510,
-    -76498,
-    -76485,
-    -76472,
-    -76459,
-    -76446,
     -76433,
-    -76421,
-    -76408,
-    -76395,
-    -76382,
-    -76369,
-    -76356,
-    -76344,
-    -76331,
-    -76318,
-    -76305,
-    -76292,
-    -76279,
-    -76267,
-    -76254,
-    -76241,
     -76228,
-    -76215,
-    -76203,
-    -76190,
-    -76177,
-    -76164,
-    -76151,
-    -76139,
-    -76126,
-    -76113,
-    -76100,
-    -76088,
-    -76075,
-    -76062,
-    -76049,
-    -76037,
     -76024,
-    -76011,
-    -75998,
-    -75986,
-    -75973,
-    -75960,
-    -75947,
-    -75935,
-    -75922,
-    -75909,
-    -75896,
-    -75884,
-    -75871,
-    -75858,
-    -75845,
-    -75833,
     -75820,
-    -75807,
-    -75794,
-    -75782,
-    -75769,
-    -75756,
-    -75744,
-    -75731,
-    -75718,
-    -75706,
-    -75693,
-    -75680,
-    -75667,
-    -75655,
-    -75642,
-    -75629,
     -75617,
-    -75604,
-    -75591,
-    -75579,
-    -75566,
-    -75553,
-    -75541,
-    -75528,
-    -75515,
-    -75503,
-    -75490,
-    -75477,
-    -75465,
-    -75452,
-    -75439,
-    -75427,
     -75414,
-    -75401,
-    -75389,
-    -75376,
-    -75364,
-    -75351,
-    -75338,
-    -75326,
-    -75313,
-    -75300,
-    -75288,
-    -75275,
-    -75263,
-    -75250,
-    -75237,
-    -75225,
     -75212,
-    -75200,
-    -75187,
-    -75174,
-    -75162,
-    -75149,
-    -75137,
-    -75124,
-    -75111,
-    -75099,
-    -75086,
-    -75074,
-    -75061,
-    -75049,
-    -75036,
-    -75023,
     -75011,
-    -74998,
-    -74986,
-    -74973,
-    -74961,
-    -74948,
-    -74935,
-    -74923,
-    -74910,
-    -74898,
-    -74885,
-    -74873,
-    -74860,
-    -74848,
-    -74835,
-    -74823,
     -74810,
-    -74798,
-    -74785,
-    -74773,
-    -74760,
-    -74748,
-    -74735,
-    -74722,
-    -74710,
-    -74697,
-    -74685,
-    -74672,
-    -74660,
-    -74647,
-    -74635,
-    -74622,
     -74610,
-    -74598,
-    -74585,
-    -74573,
-    -74560,
-    -74548,
-    -74535,
-    -74523,
-    -74510,
-    -74498,
-    -74485,
-    -74473,
-    -74460,
-    -74448,
-    -74435,
-    -74423,
     -74410,
-    -74398,
-    -74386,
-    -74373,
-    -74361,
-    -74348,
-    -74336,
-    -74323,
-    -74311,
-    -74299,
-    -74286,
-    -74274,
-    -74261,
-    -74249,
-    -74236,
-    -74224,
     -74212,
-    -74199,
-    -74187,
-    -74174,
-    -74162,
-    -74150,
-    -74137,
-    -74125,
-    -74112,
-    -74100,
-    -74088,
-    -74075,
-    -74063,
-    -74050,
-    -74038,
-    -74026,
     -74013,
-    -74001,
-    -73989,
-    -73976,
-    -73964,
-    -73951,
-    -73939,
-    -73927,
-    -73914,
-    -73902,
-    -73890,
-    -73877,
-    -73865,
-    -73853,
-    -73840,
-    -73828,
     -73816,
-    -73803,
-    -73791,
-    -73779,
-    -73766,
-    -73754,
-    -73742,
-    -73729,
-    -73717,
-    -73705,
-    -73692,
-    -73680,
-    -73668,
-    -73655,
-    -73643,
-    -73631,
     -73619,
-    -73606,
-    -73594,
-    -73582,
-    -73569,
-    -73557,
-    -73545,
-    -73532,
-    -73520,
-    -73508,
-    -73496,
-    -73483,
-    -73471,
-    -73459,
-    -73447,
-    -73434,
     -73422,
-    -73410,
-    -73397,
-    -73385,
-    -73373,
-    -73361,
-    -73348,
-    -73336,
-    -73324,
-    -73312,
-    -73299,
-    -73287,
-    -73275,
-    -73263,
-    -73251,
-    -73238,
     -73226,
-    -73214,
-    -73202,
-    -73189,
-    -73177,
-    -73165,
-    -73153,
-    -73141,
-    -73128,
-    -73116,
-    -73104,
-    -73092,
-    -73080,
-    -73067,
-    -73055,
-    -73043,
     -73031,
-    -73019,
-    -73006,
-    -72994,
-    -72982,
-    -72970,
-    -72958,
-    -72945,
-    -72933,
-    -72921,
-    -72909,
-    -72897,
-    -72885,
-    -72872,
-    -72860,
-    -72848,
     -72836,
-    -72824,
-    -72812,
-    -72800,
-    -72787,
-    -72775,
-    -72763,
-    -72751,
-    -72739,
-    -72727,
-    -72715,
-    -72702,
-    -72690,
-    -72678,
-    -72666,
-    -72654,
     -72642,
-    -72630,
-    -72618,
-    -72605,
-    -72593,
-    -72581,
-    -72569,
-    -72557,
-    -72545,
-    -72533,
-    -72521,
-    -72509,
-    -72497,
-    -72484,
-    -72472,
-    -72460,
     -72448,
-    -72436,
-    -72424,
-    -72412,
-    -72400,
-    -72388,
-    -72376,
-    -72364,
-    -72352,
-    -72340,
-    -72327,
-    -72315,
-    -72303,
-    -72291,
-    -72279,
-    -72267,
     -72255,
-    -72243,
-    -72231,
-    -72219,
-    -72207,
-    -72195,
-    -72183,
-    -72171,
-    -72159,
-    -72147,
-    -72135,
-    -72123,
-    -72111,
-    -72099,
-    -72087,
-    -72075,
     -72063,
-    -72051,
-    -72039,
-    -72027,
-    -72015,
-    -72003,
-    -71991,
-    -71979,
-    -71967,
-    -71955,
-    -71943,
-    -71931,
-    -71919,
-    -71907,
-    -71895,
-    -71883,
     -71871,
-    -71859,
-    -71847,
-    -71835,
-    -71823,
-    -71811,
-    -71799,
-    -71787,
-    -71775,
-    -71763,
-    -71751,
-    -71739,
-    -71727,
-    -71715,
-    -71703,
-    -71691,
     -71679,
-    -71667,
-    -71656,
-    -71644,
-    -71632,
-    -71620,
-    -71608,
-    -71596,
-    -71584,
-    -71572,
-    -71560,
-    -71548,
-    -71536,
-    -71524,
-    -71512,
-    -71501,
     -71489,
-    -71477,
-    -71465,
-    -71453,
-    -71441,
-    -71429,
-    -71417,
-    -71405,
-    -71393,
-    -71382,
-    -71370,
-    -71358,
-    -71346,
-    -71334,
-    -71322,
-    -71310,
     -71298,
-    -71287,
-    -71275,
-    -71263,
-    -71251,
-    -71239,
-    -71227,
-    -71215,
-    -71203,
-    -71192,
-    -71180,
-    -71168,
-    -71156,
-    -71144,
-    -71132,
-    -71121,
     -71109,
-    -71097,
-    -71085,
-    -71073,
-    -71061,
-    -71050,
-    -71038,
-    -71026,
-    -71014,
-    -71002,
-    -70990,
-    -70979,
-    -70967,
-    -70955,
-    -70943,
-    -70931,
     -70920,
-    -70908,
-    -70896,
-    -70884,
-    -70872,
-    -70861,
-    -70849,
-    -70837,
-    -70825,
-    -70813,
-    -70802,
-    -70790,
-    -70778,
-    -70766,
-    -70755,
-    -70743,
     -70731,
-    -70719,
-    -70707,
-    -70696,
-    -70684,
-    -70672,
-    -70660,
-    -70649,
-    -70637,
-    -70625,
-    -70613,
-    -70602,
-    -70590,
-    -70578,
-    -70566,
-    -70555,
     -70543,
-    -70531,
-    -70519,
-    -70508,
-    -70496,
-    -70484,
-    -70473,
-    -70461,
-    -70449,
-    -70437,
-    -70426,
-    -70414,
-    -70402,
-    -70391,
-    -70379,
-    -70367,
     -70355,
-    -70344,
-    -70332,
-    -70320,
-    -70309,
-    -70297,
-    -70285,
-    -70274,
-    -70262,
-    -70250,
-    -70239,
-    -70227,
-    -70215,
-    -70203,
-    -70192,
-    -70180,
     -70168,
-    -70157,
-    -70145,
-    -70133,
-    -70122,
-    -70110,
-    -70098,
-    -70087,
-    -70075,
-    -70064,
-    -70052,
-    -70040,
-    -70029,
-    -70017,
-    -70005,
-    -69994,
     -69982,
-    -69970,
-    -69959,
-    -69947,
-    -69935,
-    -69924,
-    -69912,
-    -69901,
-    -69889,
-    -69877,
-    -69866,
-    -69854,
-    -69843,
-    -69831,
-    -69819,
-    -69808,
     -69796,
-    -69784,
-    -69773,
-    -69761,
-    -69750,
-    -69738,
-    -69727,
-    -69715,
-    -69703,
-    -69692,
-    -69680,
-    -69669,
-    -69657,
-    -69645,
-    -69634,
-    -69622,
     -69611,
-    -69599,
-    -69588,
-    -69576,
-    -69564,
-    -69553,
-    -69541,
-    -69530,
-    -69518,
-    -69507,
-    -69495,
-    -69484,
-    -69472,
-    -69460,
-    -69449,
-    -69437,
     -69426,
-    -69414,
-    -69403,
-    -69391,
-    -69380,
-    -69368,
-    -69357,
-    -69345,
-    -69334,
-    -69322,
-    -69311,
-    -69299,
-    -69288,
-    -69276,
-    -69264,
-    -69253,
     -69241,
-    -69230,
-    -69218,
-    -69207,
-    -69195,
-    -69184,
-    -69172,
-    -69161,
-    -69149,
-    -69138,
-    -69127,
-    -69115,
-    -69104,
-    -69092,
-    -69081,
-    -69069,
     -69058,
-    -69046,
-    -69035,
-    -69023,
-    -69012,
-    -69000,
-    -68989,
-    -68977,
-    -68966,
-    -68954,
-    -68943,
-    -68932,
-    -68920,
-    -68909,
-    -68897,
-    -68886,
     -68874,
-    -68863,
-    -68851,
-    -68840,
-    -68829,
-    -68817,
-    -68806,
-    -68794,
-    -68783,
-    -68771,
-    -68760,
-    -68749,
-    -68737,
-    -68726,
-    -68714,
-    -68703,
     -68692,
-    -68680,
-    -68669,
-    -68657,
-    -68646,
-    -68634,
-    -68623,
-    -68612,
-    -68600,
-    -68589,
-    -68578,
-    -68566,
-    -68555,
-    -68543,
-    -68532,
-    -68521,
     -68509,
-    -68498,
-    -68486,
-    -68475,
-    -68464,
-    -68452,
-    -68441,
-    -68430,
-    -68418,
-    -68407,
-    -68396,
-    -68384,
-    -68373,
-    -68361,
-    -68350,
-    -68339,
     -68327,
-    -68316,
-    -68305,
-    -68293,
-    -68282,
-    -68271,
-    -68259,
-    -68248,
-    -68237,
-    -68225,
-    -68214,
-    -68203,
-    -68191,
-    -68180,
-    -68169,
-    -68157,
     -68146,
-    -68135,
-    -68124,
-    -68112,
-    -68101,
-    -68090,
-    -68078,
-    -68067,
-    -68056,
-    -68044,
-    -68033,
-    -68022,
-    -68011,
-    -67999,
-    -67988,
-    -67977,
     -67965,
-    -67954,
-    -67943,
-    -67932,
-    -67920,
-    -67909,
-    -67898,
-    -67886,
-    -67875,
-    -67864,
-    -67853,
-    -67841,
-    -67830,
-    -67819,
-    -67808,
-    -67796,
     -67785,
-    -67774,
-    -67763,
-    -67751,
-    -67740,
-    -67729,
-    -67718,
-    -67706,
-    -67695,
-    -67684,
-    -67673,
-    -67661,
-    -67650,
-    -67639,
-    -67628,
-    -67616,
     -67605,
-    -67594,
-    -67583,
-    -67572,
-    -67560,
-    -67549,
-    -67538,
-    -67527,
-    -67516,
-    -67504,
-    -67493,
-    -67482,
-    -67471,
-    -67460,
-    -67448,
-    -67437,
     -67426,
-    -67415,
-    -67404,
-    -67392,
-    -67381,
-    -67370,
-    -67359,
-    -67348,
-    -67336,
-    -67325,
-    -67314,
-    -67303,
-    -67292,
-    -67281,
-    -67269,
-    -67258,
     -67247,
-    -67236,
-    -67225,
-    -67214,
-    -67203,
-    -67191,
-    -67180,
-    -67169,
-    -67158,
-    -67147,
-    -67136,
-    -67124,
-    -67113,
-    -67102,
-    -67091,
-    -67080,
     -67069,
-    -67058,
-    -67047,
-    -67035,
-    -67024,
-    -67013,
-    -67002,
-    -66991,
-    -66980,
-    -66969,
-    -66958,
-    -66946,
-    -66935,
-    -66924,
-    -66913,
-    -66902,
     -66891,
-    -66880,
-    -66869,
-    -66858,
-    -66847,
-    -66835,
-    -66824,
-    -66813,
-    -66802,
-    -66791,
-    -66780,
-    -66769,
-    -66758,
-    -66747,
-    -66736,
-    -66725,
     -66714,
-    -66703,
-    -66691,
-    -66680,
-    -66669,
-    -66658,
-    -66647,
-    -66636,
-    -66625,
-    -66614,
-    -66603,
-    -66592,
-    -66581,
-    -66570,
-    -66559,
-    -66548,
     -66537,
-    -66526,
-    -66515,
-    -66504,
-    -66493,
-    -66482,
-    -66471,
-    -66459,
-    -66448,
-    -66437,
-    -66426,
-    -66415,
-    -66404,
-    -66393,
-    -66382,
-    -66371,
     -66360,
-    -66349,
-    -66338,
-    -66327,
-    -66316,
-    -66305,
-    -66294,
-    -66283,
-    -66272,
-    -66261,
-    -66250,
-    -66239,
-    -66228,
-    -66217,
-    -66206,
-    -66195,
     -66184,
-    -66173,
-    -66162,
-    -66151,
-    -66140,
-    -66129,
-    -66119,
-    -66108,
-    -66097,
-    -66086,
-    -66075,
-    -66064,
-    -66053,
-    -66042,
-    -66031,
-    -66020,
     -66009,
-    -65998,
-    -65987,
-    -65976,
-    -65965,
-    -65954,
-    -65943,
-    -65932,
-    -65921,
-    -65910,
-    -65899,
-    -65889,
-    -65878,
-    -65867,
-    -65856,
-    -65845,
     -65834,
-    -65823,
-    -65812,
-    -65801,
-    -65790,
-    -65779,
-    -65768,
-    -65757,
-    -65747,
-    -65736,
-    -65725,
-    -65714,
-    -65703,
-    -65692,
-    -65681,
-    -65670,
     -65659,
-    -65648,
-    -65638,
-    -65627,
-    -65616,
-    -65605,
-    -65594,
-    -65583,
-    -65572,
-    -65561,
-    -65551,
-    -65540,
-    -65529,
-    -65518,
-    -65507,
-    -65496,
     -65485,
-    -65474,
-    -65464,
-    -65453,
-    -65442,
-    -65431,
-    -65420,
-    -65409,
-    -65398,
-    -65388,
-    -65377,
-    -65366,
-    -65355,
-    -65344,
-    -65333,
-    -65323,
     -65312,
-    -65301,
-    -65290,
-    -65279,
-    -65268,
-    -65258,
-    -65247,
-    -65236,
-    -65225,
-    -65214,
-    -65203,
-    -65193,
-    -65182,
-    -65171,
-    -65160,
-    -65149,
     -65139,
-    -65128,
-    -65117,
-    -65106,
-    -65095,
-    -65085,
-    -65074,
-    -65063,
-    -65052,
-    -65041,
-    -65031,
-    -65020,
-    -65009,
-    -64998,
-    -64987,
-    -64977,
     -64966,
-    -64955,
-    -64944,
-    -64934,
-    -64923,
-    -64912,
-    -64901,
-    -64890,
-    -64880,
-    -64869,
-    -64858,
-    -64847,
-    -64837,
-    -64826,
-    -64815,
-    -64804,
     -64794,
-    -64783,
-    -64772,
-    -64761,
-    -64751,
-    -64740,
-    -64729,
-    -64718,
-    -64708,
-    -64697,
-    -64686,
-    -64675,
-    -64665,
-    -64654,
-    -64643,
-    -64633,
     -64622,
-    -64611,
-    -64600,
-    -64590,
-    -64579,
-    -64568,
-    -64558,
-    -64547,
-    -64536,
-    -64525,
-    -64515,
-    -64504,
-    -64493,
-    -64483,
-    -64472,
-    -64461,
     -64451,
-    -64440,
-    -64429,
-    -64418,
-    -64408,
-    -64397,
-    -64386,
-    -64376,
-    -64365,
-    -64354,
-    -64344,
-    -64333,
-    -64322,
-    -64312,
-    -64301,
-    -64290,
     -64280,
-    -64269,
-    -64258,
-    -64248,
-    -64237,
-    -64226,
-    -64216,
-    -64205,
-    -64194,
-    -64184,
-    -64173,
-    -64162,
-    -64152,
-    -64141,
-    -64130,
-    -64120,
     -64109,
-    -64099,
-    -64088,
-    -64077,
-    -64067,
-    -64056,
-    -64045,
-    -64035,
-    -64024,
-    -64014,
-    -64003,
-    -63992,
-    -63982,
-    -63971,
-    -63960,
-    -63950,
     -63939,
-    -63929,
-    -63918,
-    -63907,
-    -63897,
-    -63886,
-    -63876,
-    -63865,
-    -63854,
-    -63844,
-    -63833,
-    -63823,
-    -63812,
-    -63801,
-    -63791,
-    -63780,
     -63770,
-    -63759,
-    -63748,
-    -63738,
-    -63727,
-    -63717,
-    -63706,
-    -63696,
-    -63685,
-    -63674,
-    -63664,
-    -63653,
-    -63643,
-    -63632,
-    -63622,
-    -63611,
     -63600,
-    -63590,
-    -63579,
-    -63569,
-    -63558,
-    -63548,
-    -63537,
-    -63527,
-    -63516,
-    -63506,
-    -63495,
-    -63484,
-    -63474,
-    -63463,
-    -63453,
-    -63442,
     -63432,
-    -63421,
-    -63411,
-    -63400,
-    -63390,
-    -63379,
-    -63369,
-    -63358,
-    -63348,
-    -63337,
-    -63327,
-    -63316,
-    -63306,
-    -63295,
-    -63285,
-    -63274,
     -63264,
-    -63253,
-    -63243,
-    -63232,
-    -63222,
-    -63211,
-    -63201,
-    -63190,
-    -63180,
-    -63169,
-    -63159,
-    -63148,
-    -63138,
-    -63127,
-    -63117,
-    -63106,
     -63096,
-    -63085,
-    -63075,
-    -63064,
-    -63054,
-    -63043,
-    -63033,
-    -63022,
-    -63012,
-    -63002,
-    -62991,
-    -62981,
-    -62970,
-    -62960,
-    -62949,
-    -62939,
     -62928,
-    -62918,
-    -62907,
-    -62897,
-    -62887,
-    -62876,
-    -62866,
-    -62855,
-    -62845,
-    -62834,
-    -62824,
-    -62813,
-    -62803,
-    -62793,
-    -62782,
-    -62772,
     -62761,
-    -62751,
-    -62741,
-    -62730,
-    -62720,
-    -62709,
-    -62699,
-    -62688,
-    -62678,
-    -62668,
-    -62657,
-    -62647,
-    -62636,
-    -62626,
-    -62616,
-    -62605,
     -62595,
-    -62584,
-    -62574,
-    -62564,
-    -62553,
-    -62543,
-    -62532,
-    -62522,
-    -62512,
-    -62501,
-    -62491,
-    -62481,
-    -62470,
-    -62460,
-    -62449,
-    -62439,
     -62429,
-    -62418,
-    -62408,
-    -62398,
-    -62387,
-    -62377,
-    -62366,
-    -62356,
-    -62346,
-    -62335,
-    -62325,
-    -62315,
-    -62304,
-    -62294,
-    -62284,
-    -62273,
     -62263,
-    -62253,
-    -62242,
-    -62232,
-    -62222,
-    -62211,
-    -62201,
-    -62191,
-    -62180,
-    -62170,
-    -62160,
-    -62149,
-    -62139,
-    -62129,
-    -62118,
-    -62108,
     -62098,
-    -62087,
-    -62077,
-    -62067,
-    -62056,
-    -62046,
-    -62036,
-    -62026,
-    -62015,
-    -62005,
-    -61995,
-    -61984,
-    -61974,
-    -61964,
-    -61953,
-    -61943,
     -61933,
-    -61923,
-    -61912,
-    -61902,
-    -61892,
-    -61881,
-    -61871,
-    -61861,
-    -61851,
-    -61840,
-    -61830,
-    -61820,
-    -61809,
-    -61799,
-    -61789,
-    -61779,
     -61768,
-    -61758,
-    -61748,
-    -61738,
-    -61727,
-    -61717,
-    -61707,
-    -61697,
-    -61686,
-    -61676,
-    -61666,
-    -61656,
-    -61645,
-    -61635,
-    -61625,
-    -61615,
     -61604,
-    -61594,
-    -61584,
-    -61574,
-    -61563,
-    -61553,
-    -61543,
-    -61533,
-    -61522,
-    -61512,
-    -61502,
-    -61492,
-    -61482,
-    -61471,
-    -61461,
-    -61451,
     -61441,
-    -61430,
-    -61420,
-    -61410,
-    -61400,
-    -61390,
-    -61379,
-    -61369,
-    -61359,
-    -61349,
-    -61339,
-    -61328,
-    -61318,
-    -61308,
-    -61298,
-    -61288,
     -61277,
-    -61267,
-    -61257,
-    -61247,
-    -61237,
-    -61227,
-    -61216,
-    -61206,
-    -61196,
-    -61186,
-    -61176,
-    -61165,
-    -61155,
-    -61145,
-    -61135,
-    -61125,
     -61115,
-    -61104,
-    -61094,
-    -61084,
-    -61074,
-    -61064,
-    -61054,
-    -61044,
-    -61033,
-    -61023,
-    -61013,
-    -61003,
-    -60993,
-    -60983,
-    -60972,
-    -60962,
     -60952,
-    -60942,
-    -60932,
-    -60922,
-    -60912,
-    -60902,
-    -60891,
-    -60881,
-    -60871,
-    -60861,
-    -60851,
-    -60841,
-    -60831,
-    -60821,
-    -60810,
-    -60800,
     -60790,
-    -60780,
-    -60770,
-    -60760,
-    -60750,
-    -60740,
-    -60730,
-    -60719,
-    -60709,
-    -60699,
-    -60689,
-    -60679,
-    -60669,
-    -60659,
-    -60649,
-    -60639,
     -60629,
-    -60618,
-    -60608,
-    -60598,
-    -60588,
-    -60578,
-    -60568,
-    -60558,
-    -60548,
-    -60538,
-    -60528,
-    -60518,
-    -60508,
-    -60498,
-    -60487,
-    -60477,
     -60467,
-    -60457,
-    -60447,
-    -60437,
-    -60427,
-    -60417,
-    -60407,
-    -60397,
-    -60387,
-    -60377,
-    -60367,
-    -60357,
-    -60347,
-    -60337,
-    -60327,
-    -60317,
     -60307,
-    -60296,
-    -60286,
-    -60276,
-    -60266,
-    -60256,
-    -60246,
-    -60236,
-    -60226,
-    -60216,
-    -60206,
-    -60196,
-    -60186,
-    -60176,
-    -60166,
-    -60156,
     -60146,
-    -60136,
-    -60126,
-    -60116,
-    -60106,
-    -60096,
-    -60086,
-    -60076,
-    -60066,
-    -60056,
-    -60046,
-    -60036,
-    -60026,
-    -60016,
-    -60006,
-    -59996,
     -59986,
-    -59976,
-    -59966,
-    -59956,
-    -59946,
-    -59936,
-    -59926,
-    -59916,
-    -59906,
-    -59896,
-    -59886,
-    -59876,
-    -59866,
-    -59856,
-    -59846,
-    -59836,
     -59826,
-    -59816,
-    -59806,
-    -59797,
-    -59787,
-    -59777,
-    -59767,
-    -59757,
-    -59747,
-    -59737,
-    -59727,
-    -59717,
-    -59707,
-    -59697,
-    -59687,
-    -59677,
     -59667,
-    -59657,
-    -59647,
-    -59637,
-    -59627,
-    -59617,
-    -59608,
-    -59598,
-    -59588,
-    -59578,
-    -59568,
-    -59558,
-    -59548,
-    -59538,
-    -59528,
-    -59518,
     -59508,
-    -59498,
-    -59488,
-    -59479,
-    -59469,
-    -59459,
-    -59449,
-    -59439,
-    -59429,
-    -59419,
-    -59409,
-    -59399,
-    -59389,
-    -59379,
-    -59370,
-    -59360,
     -59350,
-    -59340,
-    -59330,
-    -59320,
-    -59310,
-    -59300,
-    -59290,
-    -59281,
-    -59271,
-    -59261,
-    -59251,
-    -59241,
-    -59231,
-    -59221,
-    -59211,
-    -59202,
     -59192,
-    -59182,
-    -59172,
-    -59162,
-    -59152,
-    -59142,
-    -59132,
-    -59123,
-    -59113,
-    -59103,
-    -59093,
-    -59083,
-    -59073,
-    -59063,
-    -59054,
-    -59044,
     -59034,
-    -59024,
-    -59014,
-    -59004,
-    -58995,
-    -58985,
-    -58975,
-    -58965,
-    -58955,
-    -58945,
-    -58936,
-    -58926,
-    -58916,
-    -58906,
-    -58896,
-    -58886,
     -58877,
-    -58867,
-    -58857,
-    -58847,
-    -58837,
-    -58828,
-    -58818,
-    -58808,
-    -58798,
-    -58788,
-    -58778,
-    -58769,
-    -58759,
-    -58749,
-    -58739,
-    -58729,
     -58720,
-    -58710,
-    -58700,
-    -58690,
-    -58680,
-    -58671,
-    -58661,
-    -58651,
-    -58641,
-    -58631,
-    -58622,
-    -58612,
-    -58602,
-    -58592,
-    -58583,
-    -58573,
     -58563,
-    -58553,
-    -58543,
-    -58534,
-    -58524,
-    -58514,
-    -58504,
-    -58495,
-    -58485,
-    -58475,
-    -58465,
-    -58456,
-    -58446,
-    -58436,
-    -58426,
-    -58417,
     -58407,
-    -58397,
-    -58387,
-    -58378,
-    -58368,
-    -58358,
-    -58348,
-    -58339,
-    -58329,
-    -58319,
-    -58309,
-    -58300,
-    -58290,
-    -58280,
-    -58270,
-    -58261,
     -58251,
-    -58241,
-    -58231,
-    -58222,
-    -58212,
-    -58202,
-    -58193,
-    -58183,
-    -58173,
-    -58163,
-    -58154,
-    -58144,
-    -58134,
-    -58125,
-    -58115,
-    -58105,
     -58095,
-    -58086,
-    -58076,
-    -58066,
-    -58057,
-    -58047,
-    -58037,
-    -58028,
-    -58018,
-    -58008,
-    -57998,
-    -57989,
-    -57979,
-    -57969,
-    -57960,
-    -57950,
     -57940,
-    -57931,
-    -57921,
-    -57911,
-    -57902,
-    -57892,
-    -57882,
-    -57873,
-    -57863,
-    -57853,
-    -57844,
-    -57834,
-    -57824,
-    -57815,
-    -57805,
-    -57795,
     -57786,
-    -57776,
-    -57766,
-    -57757,
-    -57747,
-    -57737,
-    -57728,
-    -57718,
-    -57708,
-    -57699,
-    -57689,
-    -57679,
-    -57670,
-    -57660,
-    -57650,
-    -57641,
     -57631,
-    -57622,
-    -57612,
-    -57602,
-    -57593,
-    -57583,
-    -57573,
-    -57564,
-    -57554,
-    -57545,
-    -57535,
-    -57525,
-    -57516,
-    -57506,
-    -57496,
-    -57487,
     -57477,
-    -57468,
-    -57458,
-    -57448,
-    -57439,
-    -57429,
-    -57420,
-    -57410,
-    -57400,
-    -57391,
-    -57381,
-    -57372,
-    -57362,
-    -57352,
-    -57343,
-    -57333,
     -57324,
-    -57314,
-    -57304,
-    -57295,
-    -57285,
-    -57276,
-    -57266,
-    -57256,
-    -57247,
-    -57237,
-    -57228,
-    -57218,
-    -57209,
-    -57199,
-    -57189,
-    -57180,
     -57170,
-    -57161,
-    -57151,
-    -57142,
-    -57132,
-    -57122,
-    -57113,
-    -57103,
-    -57094,
-    -57084,
-    -57075,
-    -57065,
-    -57055,
-    -57046,
-    -57036,
-    -57027,
     -57017,
-    -57008,
-    -56998,
-    -56989,
-    -56979,
-    -56970,
-    -56960,
-    -56950,
-    -56941,
-    -56931,
-    -56922,
-    -56912,
-    -56903,
-    -56893,
-    -56884,
-    -56874,
     -56865,
-    -56855,
-    -56846,
-    -56836,
-    -56827,
-    -56817,
-    -56808,
-    -56798,
-    -56789,
-    -56779,
-    -56770,
-    -56760,
-    -56751,
-    -56741,
-    -56731,
-    -56722,
     -56712,
-    -56703,
-    -56693,
-    -56684,
-    -56674,
-    -56665,
-    -56655,
-    -56646,
-    -56636,
-    -56627,
-    -56618,
-    -56608,
-    -56599,
-    -56589,
-    -56580,
-    -56570,
     -56561,
-    -56551,
-    -56542,
-    -56532,
-    -56523,
-    -56513,
-    -56504,
-    -56494,
-    -56485,
-    -56475,
-    -56466,
-    -56456,
-    -56447,
-    -56437,
-    -56428,
-    -56419,
     -56409,
-    -56400,
-    -56390,
-    -56381,
-    -56371,
-    -56362,
-    -56352,
-    -56343,
-    -56333,
-    -56324,
-    -56315,
-    -56305,
-    -56296,
-    -56286,
-    -56277,
-    -56267,
     -56258,
-    -56248,
-    -56239,
-    -56230,
-    -56220,
-    -56211,
-    -56201,
-    -56192,
-    -56182,
-    -56173,
-    -56164,
-    -56154,
-    -56145,
-    -56135,
-    -56126,
-    -56116,
     -56107,
-    -56098,
-    -56088,
-    -56079,
-    -56069,
-    -56060,
-    -56051,
-    -56041,
-    -56032,
-    -56022,
-    -56013,
-    -56004,
-    -55994,
-    -55985,
-    -55975,
-    -55966,
     -55957,
-    -55947,
-    -55938,
-    -55928,
-    -55919,
-    -55910,
-    -55900,
-    -55891,
-    -55881,
-    -55872,
-    -55863,
-    -55853,
-    -55844,
-    -55835,
-    -55825,
-    -55816,
     -55806,
-    -55797,
-    -55788,
-    -55778,
-    -55769,
-    -55760,
-    -55750,
-    -55741,
-    -55731,
-    -55722,
-    -55713,
-    -55703,
-    -55694,
-    -55685,
-    -55675,
-    -55666,
     -55657,
-    -55647,
-    -55638,
-    -55629,
-    -55619,
-    -55610,
-    -55601,
-    -55591,
-    -55582,
-    -55573,
-    -55563,
-    -55554,
-    -55545,
-    -55535,
-    -55526,
-    -55517,
     -55507,
-    -55498,
-    -55489,
-    -55479,
-    -55470,
-    -55461,
-    -55451,
-    -55442,
-    -55433,
-    -55423,
-    -55414,
-    -55405,
-    -55395,
-    -55386,
-    -55377,
-    -55367,
     -55358,
-    -55349,
-    -55339,
-    -55330,
-    -55321,
-    -55312,
-    -55302,
-    -55293,
-    -55284,
-    -55274,
-    -55265,
-    -55256,
-    -55246,
-    -55237,
-    -55228,
-    -55219,
     -55209,
-    -55200,
-    -55191,
-    -55181,
-    -55172,
-    -55163,
-    -55154,
-    -55144,
-    -55135,
-    -55126,
-    -55116,
-    -55107,
-    -55098,
-    -55089,
-    -55079,
-    -55070,
     -55061,
-    -55052,
-    -55042,
-    -55033,
-    -55024,
-    -55015,
-    -55005,
-    -54996,
-    -54987,
-    -54978,
-    -54968,
-    -54959,
-    -54950,
-    -54940,
-    -54931,
-    -54922,
     -54913,
-    -54904,
-    -54894,
-    -54885,
-    -54876,
-    -54867,
-    -54857,
-    -54848,
-    -54839,
-    -54830,
-    -54820,
-    -54811,
-    -54802,
-    -54793,
-    -54783,
-    -54774,
     -54765,
-    -54756,
-    -54747,
-    -54737,
-    -54728,
-    -54719,
-    -54710,
-    -54700,
-    -54691,
-    -54682,
-    -54673,
-    -54664,
-    -54654,
-    -54645,
-    -54636,
-    -54627,
     -54618,
-    -54608,
-    -54599,
-    -54590,
-    -54581,
-    -54572,
-    -54562,
-    -54553,
-    -54544,
-    -54535,
-    -54526,
-    -54516,
-    -54507,
-    -54498,
-    -54489,
-    -54480,
     -54470,
-    -54461,
-    -54452,
-    -54443,
-    -54434,
-    -54425,
-    -54415,
-    -54406,
-    -54397,
-    -54388,
-    -54379,
-    -54369,
-    -54360,
-    -54351,
-    -54342,
-    -54333,
     -54324,
-    -54314,
-    -54305,
-    -54296,
-    -54287,
-    -54278,
-    -54269,
-    -54260,
-    -54250,
-    -54241,
-    -54232,
-    -54223,
-    -54214,
-    -54205,
-    -54195,
-    -54186,
     -54177,
-    -54168,
-    -54159,
-    -54150,
-    -54141,
-    -54132,
-    -54122,
-    -54113,
-    -54104,
-    -54095,
-    -54086,
-    -54077,
-    -54068,
-    -54058,
-    -54049,
-    -54040,
     -54031,
-    -54022,
-    -54013,
-    -54004,
-    -53995,
-    -53985,
-    -53976,
-    -53967,
-    -53958,
-    -53949,
-    -53940,
-    -53931,
-    -53922,
-    -53913,
-    -53903,
-    -53894,
     -53885,
-    -53876,
-    -53867,
-    -53858,
-    -53849,
-    -53840,
-    -53831,
-    -53822,
-    -53813,
-    -53803,
-    -53794,
-    -53785,
-    -53776,
-    -53767,
-    -53758,
-    -53749,
     -53740,
-    -53731,
-    -53722,
-    -53713,
-    -53703,
-    -53694,
-    -53685,
-    -53676,
-    -53667,
-    -53658,
-    -53649,
-    -53640,
-    -53631,
-    -53622,
-    -53613,
-    -53604,
     -53595,
-    -53586,
-    -53577,
-    -53567,
-    -53558,
-    -53549,
-    -53540,
-    -53531,
-    -53522,
-    -53513,
-    -53504,
-    -53495,
-    -53486,
-    -53477,
-    -53468,
-    -53459,
     -53450,
-    -53441,
-    -53432,
-    -53423,
-    -53414,
-    -53405,
-    -53396,
-    -53387,
-    -53378,
-    -53369,
-    -53359,
-    -53350,
-    -53341,
-    -53332,
-    -53323,
-    -53314,
     -53305,
-    -53296,
-    -53287,
-    -53278,
-    -53269,
-    -53260,
-    -53251,
-    -53242,
-    -53233,
-    -53224,
-    -53215,
-    -53206,
-    -53197,
-    -53188,
-    -53179,
-    -53170,
     -53161,
-    -53152,
-    -53143,
-    -53134,
-    -53125,
-    -53116,
-    -53107,
-    -53098,
-    -53089,
-    -53080,
-    -53071,
-    -53062,
-    -53053,
-    -53044,
-    -53035,
-    -53026,
     -53017,
-    -53008,
-    -52999,
-    -52990,
-    -52981,
-    -52972,
-    -52963,
-    -52954,
-    -52945,
-    -52936,
-    -52927,
-    -52919,
-    -52910,
-    -52901,
-    -52892,
-    -52883,
     -52874,
-    -52865,
-    -52856,
-    -52847,
-    -52838,
-    -52829,
-    -52820,
-    -52811,
-    -52802,
-    -52793,
-    -52784,
-    -52775,
-    -52766,
-    -52757,
-    -52748,
-    -52739,
     -52730,
-    -52721,
-    -52713,
-    -52704,
-    -52695,
-    -52686,
-    -52677,
-    -52668,
-    -52659,
-    -52650,
-    -52641,
-    -52632,
-    -52623,
-    -52614,
-    -52605,
-    -52596,
     -52588,
-    -52579,
-    -52570,
-    -52561,
-    -52552,
-    -52543,
-    -52534,
-    -52525,
-    -52516,
-    -52507,
-    -52498,
-    -52489,
-    -52481,
-    -52472,
-    -52463,
-    -52454,
     -52445,
-    -52436,
-    -52427,
-    -52418,
-    -52409,
-    -52400,
-    -52391,
-    -52383,
-    -52374,
-    -52365,
-    -52356,
-    -52347,
-    -52338,
-    -52329,
-    -52320,
-    -52311,
     -52303,
-    -52294,
-    -52285,
-    -52276,
-    -52267,
-    -52258,
-    -52249,
-    -52240,
-    -52232,
-    -52223,
-    -52214,
-    -52205,
-    -52196,
-    -52187,
-    -52178,
-    -52169,
     -52161,
-    -52152,
-    -52143,
-    -52134,
-    -52125,
-    -52116,
-    -52107,
-    -52099,
-    -52090,
-    -52081,
-    -52072,
-    -52063,
-    -52054,
-    -52045,
-    -52037,
-    -52028,
     -52019,
-    -52010,
-    -52001,
-    -51992,
-    -51983,
-    -51975,
-    -51966,
-    -51957,
-    -51948,
-    -51939,
-    -51930,
-    -51922,
-    -51913,
-    -51904,
-    -51895,
-    -51886,
     -51877,
-    -51869,
-    -51860,
-    -51851,
-    -51842,
-    -51833,
-    -51825,
-    -51816,
-    -51807,
-    -51798,
-    -51789,
-    -51780,
-    -51772,
-    -51763,
-    -51754,
-    -51745,
     -51736,
-    -51728,
-    -51719,
-    -51710,
-    -51701,
-    -51692,
-    -51684,
-    -51675,
-    -51666,
-    -51657,
-    -51648,
-    -51640,
-    -51631,
-    -51622,
-    -51613,
-    -51604,
     -51596,
-    -51587,
-    -51578,
-    -51569,
-    -51560,
-    -51552,
-    -51543,
-    -51534,
-    -51525,
-    -51517,
-    -51508,
-    -51499,
-    -51490,
-    -51481,
-    -51473,
-    -51464,
     -51455,
-    -51446,
-    -51438,
-    -51429,
-    -51420,
-    -51411,
-    -51402,
-    -51394,
-    -51385,
-    -51376,
-    -51367,
-    -51359,
-    -51350,
-    -51341,
-    -51332,
-    -51324,
     -51315,
-    -51306,
-    -51297,
-    -51289,
-    -51280,
-    -51271,
-    -51262,
-    -51254,
-    -51245,
-    -51236,
-    -51227,
-    -51219,
-    -51210,
-    -51201,
-    -51193,
-    -51184,
     -51175,
-    -51166,
-    -51158,
-    -51149,
-    -51140,
-    -51131,
-    -51123,
-    -51114,
-    -51105,
-    -51096,
-    -51088,
-    -51079,
-    -51070,
-    -51062,
-    -51053,
-    -51044,
     -51035,
-    -51027,
-    -51018,
-    -51009,
-    -51001,
-    -50992,
-    -50983,
-    -50974,
-    -50966,
-    -50957,
-    -50948,
-    -50940,
-    -50931,
-    -50922,
-    -50914,
-    -50905,
     -50896,
-    -50887,
-    -50879,
-    -50870,
-    -50861,
-    -50853,
-    -50844,
-    -50835,
-    -50827,
-    -50818,
-    -50809,
-    -50801,
-    -50792,
-    -50783,
-    -50775,
-    -50766,
     -50757,
-    -50748,
-    -50740,
-    -50731,
-    -50722,
-    -50714,
-    -50705,
-    -50696,
-    -50688,
-    -50679,
-    -50670,
-    -50662,
-    -50653,
-    -50644,
-    -50636,
-    -50627,
     -50618,
-    -50610,
-    -50601,
-    -50592,
-    -50584,
-    -50575,
-    -50567,
-    -50558,
-    -50549,
-    -50541,
-    -50532,
-    -50523,
-    -50515,
-    -50506,
-    -50497,
-    -50489,
     -50480,
-    -50471,
-    -50463,
-    -50454,
-    -50445,
-    -50437,
-    -50428,
-    -50420,
-    -50411,
-    -50402,
-    -50394,
-    -50385,
-    -50376,
-    -50368,
-    -50359,
-    -50351,
     -50342,
-    -50333,
-    -50325,
-    -50316,
-    -50307,
-    -50299,
-    -50290,
-    -50282,
-    -50273,
-    -50264,
-    -50256,
-    -50247,
-    -50239,
-    -50230,
-    -50221,
-    -50213,
     -50204,
-    -50196,
-    -50187,
-    -50178,
-    -50170,
-    -50161,
-    -50153,
-    -50144,
-    -50135,
-    -50127,
-    -50118,
-    -50110,
-    -50101,
-    -50092,
-    -50084,
-    -50075,
     -50067,
-    -50058,
-    -50049,
-    -50041,
-    -50032,
-    -50024,
-    -50015,
-    -50006,
-    -49998,
-    -49989,
-    -49981,
-    -49972,
-    -49964,
-    -49955,
-    -49946,
-    -49938,
     -49929,
-    -49921,
-    -49912,
-    -49904,
-    -49895,
-    -49886,
-    -49878,
-    -49869,
-    -49861,
-    -49852,
-    -49844,
-    -49835,
-    -49827,
-    -49818,
-    -49809,
-    -49801,
     -49792,
-    -49784,
-    -49775,
-    -49767,
-    -49758,
-    -49750,
-    -49741,
-    -49733,
-    -49724,
-    -49715,
-    -49707,
-    -49698,
-    -49690,
-    -49681,
-    -49673,
-    -49664,
     -49656,
-    -49647,
-    -49639,
-    -49630,
-    -49622,
-    -49613,
-    -49605,
-    -49596,
-    -49587,
-    -49579,
-    -49570,
-    -49562,
-    -49553,
-    -49545,
-    -49536,
-    -49528,
     -49519,
-    -49511,
-    -49502,
-    -49494,
-    -49485,
-    -49477,
-    -49468,
-    -49460,
-    -49451,
-    -49443,
-    -49434,
-    -49426,
-    -49417,
-    -49409,
-    -49400,
-    -49392,
     -49383,
-    -49375,
-    -49366,
-    -49358,
-    -49349,
-    -49341,
-    -49332,
-    -49324,
-    -49315,
-    -49307,
-    -49298,
-    -49290,
-    -49281,
-    -49273,
-    -49264,
-    -49256,
     -49247,
-    -49239,
-    -49230,
-    -49222,
-    -49213,
-    -49205,
-    -49197,
-    -49188,
-    -49180,
-    -49171,
-    -49163,
-    -49154,
-    -49146,
-    -49137,
-    -49129,
-    -49120,
     -49112,
-    -49103,
-    -49095,
-    -49086,
-    -49078,
-    -49070,
-    -49061,
-    -49053,
-    -49044,
-    -49036,
-    -49027,
-    -49019,
-    -49010,
-    -49002,
-    -48993,
-    -48985,
     -48977,
-    -48968,
-    -48960,
-    -48951,
-    -48943,
-    -48934,
-    -48926,
-    -48917,
-    -48909,
-    -48901,
-    -48892,
-    -48884,
-    -48875,
-    -48867,
-    -48858,
-    -48850,
     -48842,
-    -48833,
-    -48825,
-    -48816,
-    -48808,
-    -48799,
-    -48791,
-    -48783,
-    -48774,
-    -48766,
-    -48757,
-    -48749,
-    -48741,
-    -48732,
-    -48724,
-    -48715,
     -48707,
-    -48698,
-    -48690,
-    -48682,
-    -48673,
-    -48665,
-    -48656,
-    -48648,
-    -48640,
-    -48631,
-    -48623,
-    -48614,
-    -48606,
-    -48598,
-    -48589,
-    -48581,
     -48572,
-    -48564,
-    -48556,
-    -48547,
-    -48539,
-    -48530,
-    -48522,
-    -48514,
-    -48505,
-    -48497,
-    -48489,
-    -48480,
-    -48472,
-    -48463,
-    -48455,
-    -48447,
     -48438,
-    -48430,
-    -48422,
-    -48413,
-    -48405,
-    -48396,
-    -48388,
-    -48380,
-    -48371,
-    -48363,
-    -48355,
-    -48346,
-    -48338,
-    -48329,
-    -48321,
-    -48313,
     -48304,
-    -48296,
-    -48288,
-    -48279,
-    -48271,
-    -48263,
-    -48254,
-    -48246,
-    -48238,
-    -48229,
-    -48221,
-    -48212,
-    -48204,
-    -48196,
-    -48187,
-    -48179,
     -48171,
-    -48162,
-    -48154,
-    -48146,
-    -48137,
-    -48129,
-    -48121,
-    -48112,
-    -48104,
-    -48096,
-    -48087,
-    -48079,
-    -48071,
-    -48062,
-    -48054,
-    -48046,
     -48037,
-    -48029,
-    -48021,
-    -48012,
-    -48004,
-    -47996,
-    -47988,
-    -47979,
-    -47971,
-    -47963,
-    -47954,
-    -47946,
-    -47938,
-    -47929,
-    -47921,
-    -47913,
     -47904,
-    -47896,
-    -47888,
-    -47879,
-    -47871,
-    -47863,
-    -47855,
-    -47846,
-    -47838,
-    -47830,
-    -47821,
-    -47813,
-    -47805,
-    -47796,
-    -47788,
-    -47780,
     -47772,
-    -47763,
-    -47755,
-    -47747,
-    -47738,
-    -47730,
-    -47722,
-    -47714,
-    -47705,
-    -47697,
-    -47689,
-    -47680,
-    -47672,
-    -47664,
-    -47656,
-    -47647,
     -47639,
-    -47631,
-    -47622,
-    -47614,
-    -47606,
-    -47598,
-    -47589,
-    -47581,
-    -47573,
-    -47565,
-    -47556,
-    -47548,
-    -47540,
-    -47532,
-    -47523,
-    -47515,
     -47507,
-    -47499,
-    -47490,
-    -47482,
-    -47474,
-    -47465,
-    -47457,
-    -47449,
-    -47441,
-    -47432,
-    -47424,
-    -47416,
-    -47408,
-    -47400,
-    -47391,
-    -47383,
     -47375,
-    -47367,
-    -47358,
-    -47350,
-    -47342,
-    -47334,
-    -47325,
-    -47317,
-    -47309,
-    -47301,
-    -47292,
-    -47284,
-    -47276,
-    -47268,
-    -47260,
-    -47251,
     -47243,
-    -47235,
-    -47227,
-    -47218,
-    -47210,
-    -47202,
-    -47194,
-    -47186,
-    -47177,
-    -47169,
-    -47161,
-    -47153,
-    -47144,
-    -47136,
-    -47128,
-    -47120,
     -47112,
-    -47103,
-    -47095,
-    -47087,
-    -47079,
-    -47071,
-    -47062,
-    -47054,
-    -47046,
-    -47038,
-    -47030,
-    -47021,
-    -47013,
-    -47005,
-    -46997,
-    -46989,
     -46980,
-    -46972,
-    -46964,
-    -46956,
-    -46948,
-    -46939,
-    -46931,
-    -46923,
-    -46915,
-    -46907,
-    -46899,
-    -46890,
-    -46882,
-    -46874,
-    -46866,
-    -46858,
     -46849,
-    -46841,
-    -46833,
-    -46825,
-    -46817,
-    -46809,
-    -46800,
-    -46792,
-    -46784,
-    -46776,
-    -46768,
-    -46760,
-    -46751,
-    -46743,
-    -46735,
-    -46727,
     -46719,
-    -46711,
-    -46702,
-    -46694,
-    -46686,
-    -46678,
-    -46670,
-    -46662,
-    -46654,
-    -46645,
-    -46637,
-    -46629,
-    -46621,
-    -46613,
-    -46605,
-    -46596,
     -46588,
-    -46580,
-    -46572,
-    -46564,
-    -46556,
-    -46548,
-    -46539,
-    -46531,
-    -46523,
-    -46515,
-    -46507,
-    -46499,
-    -46491,
-    -46483,
-    -46474,
-    -46466,
     -46458,
-    -46450,
-    -46442,
-    -46434,
-    -46426,
-    -46418,
-    -46409,
-    -46401,
-    -46393,
-    -46385,
-    -46377,
-    -46369,
-    -46361,
-    -46353,
-    -46344,
-    -46336,
     -46328,
-    -46320,
-    -46312,
-    -46304,
-    -46296,
-    -46288,
-    -46280,
-    -46272,
-    -46263,
-    -46255,
-    -46247,
-    -46239,
-    -46231,
-    -46223,
-    -46215,
-    -46207,
     -46199,
-    -46191,
-    -46182,
-    -46174,
-    -46166,
-    -46158,
-    -46150,
-    -46142,
-    -46134,
-    -46126,
-    -46118,
-    -46110,
-    -46102,
-    -46093,
-    -46085,
-    -46077,
     -46069,
-    -46061,
-    -46053,
-    -46045,
-    -46037,
-    -46029,
-    -46021,
-    -46013,
-    -46005,
-    -45997,
-    -45988,
-    -45980,
-    -45972,
-    -45964,
-    -45956,
-    -45948,
     -45940,
-    -45932,
-    -45924,
-    -45916,
-    -45908,
-    -45900,
-    -45892,
-    -45884,
-    -45876,
-    -45868,
-    -45860,
-    -45851,
-    -45843,
-    -45835,
-    -45827,
-    -45819,
     -45811,
-    -45803,
-    -45795,
-    -45787,
-    -45779,
-    -45771,
-    -45763,
-    -45755,
-    -45747,
-    -45739,
-    -45731,
-    -45723,
-    -45715,
-    -45707,
-    -45699,
-    -45691,
     -45683,
-    -45675,
-    -45667,
-    -45659,
-    -45650,
-    -45642,
-    -45634,
-    -45626,
-    -45618,
-    -45610,
-    -45602,
-    -45594,
-    -45586,
-    -45578,
-    -45570,
-    -45562,
     -45554,
-    -45546,
-    -45538,
-    -45530,
-    -45522,
-    -45514,
-    -45506,
-    -45498,
-    -45490,
-    -45482,
-    -45474,
-    -45466,
-    -45458,
-    -45450,
-    -45442,
-    -45434,
     -45426,
-    -45418,
-    -45410,
-    -45402,
-    -45394,
-    -45386,
-    -45378,
-    -45370,
-    -45362,
-    -45354,
-    -45346,
-    -45338,
-    -45330,
-    -45322,
-    -45314,
-    -45306,
     -45298,
-    -45290,
-    -45282,
-    -45274,
-    -45266,
-    -45258,
-    -45250,
-    -45242,
-    -45234,
-    -45226,
-    -45218,
-    -45210,
-    -45202,
-    -45195,
-    -45187,
-    -45179,
     -45171,
-    -45163,
-    -45155,
-    -45147,
-    -45139,
-    -45131,
-    -45123,
-    -45115,
-    -45107,
-    -45099,
-    -45091,
-    -45083,
-    -45075,
-    -45067,
-    -45059,
-    -45051,
     -45043,
-    -45035,
-    -45027,
-    -45019,
-    -45011,
-    -45003,
-    -44996,
-    -44988,
-    -44980,
-    -44972,
-    -44964,
-    -44956,
-    -44948,
-    -44940,
-    -44932,
-    -44924,
     -44916,
-    -44908,
-    -44900,
-    -44892,
-    -44884,
-    -44876,
-    -44868,
-    -44861,
-    -44853,
-    -44845,
-    -44837,
-    -44829,
-    -44821,
-    -44813,
-    -44805,
-    -44797,
     -44789,
-    -44781,
-    -44773,
-    -44765,
-    -44758,
-    -44750,
-    -44742,
-    -44734,
-    -44726,
-    -44718,
-    -44710,
-    -44702,
-    -44694,
-    -44686,
-    -44678,
-    -44670,
     -44663,
-    -44655,
-    -44647,
-    -44639,
-    -44631,
-    -44623,
-    -44615,
-    -44607,
-    -44599,
-    -44591,
-    -44584,
-    -44576,
-    -44568,
-    -44560,
-    -44552,
-    -44544,
     -44536,
-    -44528,
-    -44520,
-    -44512,
-    -44505,
-    -44497,
-    -44489,
-    -44481,
-    -44473,
-    -44465,
-    -44457,
-    -44449,
-    -44442,
-    -44434,
-    -44426,
-    -44418,
     -44410,
-    -44402,
-    -44394,
-    -44386,
-    -44379,
-    -44371,
-    -44363,
-    -44355,
-    -44347,
-    -44339,
-    -44331,
-    -44323,
-    -44316,
-    -44308,
-    -44300,
-    -44292,
     -44284,
-    -44276,
-    -44268,
-    -44261,
-    -44253,
-    -44245,
-    -44237,
-    -44229,
-    -44221,
-    -44213,
-    -44206,
-    -44198,
-    -44190,
-    -44182,
-    -44174,
-    -44166,
     -44158,
-    -44151,
-    -44143,
-    -44135,
-    -44127,
-    -44119,
-    -44111,
-    -44104,
-    -44096,
-    -44088,
-    -44080,
-    -44072,
-    -44064,
-    -44057,
-    -44049,
-    -44041,
     -44033,
-    -44025,
-    -44017,
-    -44010,
-    -44002,
-    -43994,
-    -43986,
-    -43978,
-    -43970,
-    -43963,
-    -43955,
-    -43947,
-    -43939,
-    -43931,
-    -43923,
-    -43916,
     -43908,
-    -43900,
-    -43892,
-    -43884,
-    -43877,
-    -43869,
-    -43861,
-    -43853,
-    -43845,
-    -43838,
-    -43830,
-    -43822,
-    -43814,
-    -43806,
-    -43798,
-    -43791,
     -43783,
-    -43775,
-    -43767,
-    -43759,
-    -43752,
-    -43744,
-    -43736,
-    -43728,
-    -43720,
-    -43713,
-    -43705,
-    -43697,
-    -43689,
-    -43682,
-    -43674,
-    -43666,
     -43658,
-    -43650,
-    -43643,
-    -43635,
-    -43627,
-    -43619,
-    -43611,
-    -43604,
-    -43596,
-    -43588,
-    -43580,
-    -43573,
-    -43565,
-    -43557,
-    -43549,
-    -43541,
     -43534,
-    -43526,
-    -43518,
-    -43510,
-    -43503,
-    -43495,
-    -43487,
-    -43479,
-    -43472,
-    -43464,
-    -43456,
-    -43448,
-    -43440,
-    -43433,
-    -43425,
-    -43417,
     -43409,
-    -43402,
-    -43394,
-    -43386,
-    -43378,
-    -43371,
-    -43363,
-    -43355,
-    -43347,
-    -43340,
-    -43332,
-    -43324,
-    -43316,
-    -43309,
-    -43301,
-    -43293,
     -43285,
-    -43278,
-    -43270,
-    -43262,
-    -43254,
-    -43247,
-    -43239,
-    -43231,
-    -43224,
-    -43216,
-    -43208,
-    -43200,
-    -43193,
-    -43185,
-    -43177,
-    -43169,
     -43162,
-    -43154,
-    -43146,
-    -43138,
-    -43131,
-    -43123,
-    -43115,
-    -43108,
-    -43100,
-    -43092,
-    -43084,
-    -43077,
-    -43069,
-    -43061,
-    -43054,
-    -43046,
     -43038,
-    -43030,
-    -43023,
-    -43015,
-    -43007,
-    -43000,
-    -42992,
-    -42984,
-    -42976,
-    -42969,
-    -42961,
-    -42953,
-    -42946,
-    -42938,
-    -42930,
-    -42923,
     -42915,
-    -42907,
-    -42899,
-    -42892,
-    -42884,
-    -42876,
-    -42869,
-    -42861,
-    -42853,
-    -42846,
-    -42838,
-    -42830,
-    -42823,
-    -42815,
-    -42807,
-    -42799,
     -42792,
-    -42784,
-    -42776,
-    -42769,
-    -42761,
-    -42753,
-    -42746,
-    -42738,
-    -42730,
-    -42723,
-    -42715,
-    -42707,
-    -42700,
-    -42692,
-    -42684,
-    -42677,
     -42669,
-    -42661,
-    -42654,
-    -42646,
-    -42638,
-    -42631,
-    -42623,
-    -42615,
-    -42608,
-    -42600,
-    -42592,
-    -42585,
-    -42577,
-    -42569,
-    -42562,
-    -42554,
     -42546,
-    -42539,
-    -42531,
-    -42523,
-    -42516,
-    -42508,
-    -42500,
-    -42493,
-    -42485,
-    -42477,
-    -42470,
-    -42462,
-    -42454,
-    -42447,
-    -42439,
-    -42432,
     -42424,
-    -42416,
-    -42409,
-    -42401,
-    -42393,
-    -42386,
-    -42378,
-    -42370,
-    -42363,
-    -42355,
-    -42348,
-    -42340,
-    -42332,
-    -42325,
-    -42317,
-    -42309,
     -42302,
-    -42294,
-    -42287,
-    -42279,
-    -42271,
-    -42264,
-    -42256,
-    -42248,
-    -42241,
-    -42233,
-    -42226,
-    -42218,
-    -42210,
-    -42203,
-    -42195,
-    -42187,
     -42180,
-    -42172,
-    -42165,
-    -42157,
-    -42149,
-    -42142,
-    -42134,
-    -42127,
-    -42119,
-    -42111,
-    -42104,
-    -42096,
-    -42089,
-    -42081,
-    -42073,
-    -42066,
     -42058,
-    -42051,
-    -42043,
-    -42035,
-    -42028,
-    -42020,
-    -42013,
-    -42005,
-    -41997,
-    -41990,
-    -41982,
-    -41975,
-    -41967,
-    -41959,
-    -41952,
-    -41944,
     -41937,
-    -41929,
-    -41921,
-    -41914,
-    -41906,
-    -41899,
-    -41891,
-    -41884,
-    -41876,
-    -41868,
-    -41861,
-    -41853,
-    -41846,
-    -41838,
-    -41831,
-    -41823,
     -41815,
-    -41808,
-    -41800,
-    -41793,
-    -41785,
-    -41778,
-    -41770,
-    -41762,
-    -41755,
-    -41747,
-    -41740,
-    -41732,
-    -41725,
-    -41717,
-    -41709,
-    -41702,
     -41694,
-    -41687,
-    -41679,
-    -41672,
-    -41664,
-    -41657,
-    -41649,
-    -41642,
-    -41634,
-    -41626,
-    -41619,
-    -41611,
-    -41604,
-    -41596,
-    -41589,
-    -41581,
     -41574,
-    -41566,
-    -41558,
-    -41551,
-    -41543,
-    -41536,
-    -41528,
-    -41521,
-    -41513,
-    -41506,
-    -41498,
-    -41491,
-    -41483,
-    -41476,
-    -41468,
-    -41461,
     -41453,
-    -41445,
-    -41438,
-    -41430,
-    -41423,
-    -41415,
-    -41408,
-    -41400,
-    -41393,
-    -41385,
-    -41378,
-    -41370,
-    -41363,
-    -41355,
-    -41348,
-    -41340,
     -41333,
-    -41325,
-    -41318,
-    -41310,
-    -41303,
-    -41295,
-    -41288,
-    -41280,
-    -41273,
-    -41265,
-    -41258,
-    -41250,
-    -41243,
-    -41235,
-    -41228,
-    -41220,
     -41212,
-    -41205,
-    -41197,
-    -41190,
-    -41182,
-    -41175,
-    -41168,
-    -41160,
-    -41153,
-    -41145,
-    -41138,
-    -41130,
-    -41123,
-    -41115,
-    -41108,
-    -41100,
     -41093,
-    -41085,
-    -41078,
-    -41070,
-    -41063,
-    -41055,
-    -41048,
-    -41040,
-    -41033,
-    -41025,
-    -41018,
-    -41010,
-    -41003,
-    -40995,
-    -40988,
-    -40980,
     -40973,
-    -40965,
-    -40958,
-    -40950,
-    -40943,
-    -40936,
-    -40928,
-    -40921,
-    -40913,
-    -40906,
-    -40898,
-    -40891,
-    -40883,
-    -40876,
-    -40868,
-    -40861,
     -40853,
-    -40846,
-    -40838,
-    -40831,
-    -40824,
-    -40816,
-    -40809,
-    -40801,
-    -40794,
-    -40786,
-    -40779,
-    -40771,
-    -40764,
-    -40756,
-    -40749,
-    -40742,
     -40734,
-    -40727,
-    -40719,
-    -40712,
-    -40704,
-    -40697,
-    -40689,
-    -40682,
-    -40675,
-    -40667,
-    -40660,
-    -40652,
-    -40645,
-    -40637,
-    -40630,
-    -40623,
     -40615,
-    -40608,
-    -40600,
-    -40593,
-    -40585,
-    -40578,
-    -40570,
-    -40563,
-    -40556,
-    -40548,
-    -40541,
-    -40533,
-    -40526,
-    -40519,
-    -40511,
-    -40504,
     -40496,
-    -40489,
-    -40481,
-    -40474,
-    -40467,
-    -40459,
-    -40452,
-    -40444,
-    -40437,
-    -40430,
-    -40422,
-    -40415,
-    -40407,
-    -40400,
-    -40392,
-    -40385,
     -40378,
-    -40370,
-    -40363,
-    -40355,
-    -40348,
-    -40341,
-    -40333,
-    -40326,
-    -40318,
-    -40311,
-    -40304,
-    -40296,
-    -40289,
-    -40281,
-    -40274,
-    -40267,
     -40259,
-    -40252,
-    -40244,
-    -40237,
-    -40230,
-    -40222,
-    -40215,
-    -40207,
-    -40200,
-    -40193,
-    -40185,
-    -40178,
-    -40171,
-    -40163,
-    -40156,
-    -40148,
     -40141,
-    -40134,
-    -40126,
-    -40119,
-    -40112,
-    -40104,
-    -40097,
-    -40089,
-    -40082,
-    -40075,
-    -40067,
-    -40060,
-    -40053,
-    -40045,
-    -40038,
-    -40030,
     -40023,
-    -40016,
-    -40008,
-    -40001,
-    -39994,
-    -39986,
-    -39979,
-    -39972,
-    -39964,
-    -39957,
-    -39949,
-    -39942,
-    -39935,
-    -39927,
-    -39920,
-    -39913,
     -39905,
-    -39898,
-    -39891,
-    -39883,
-    -39876,
-    -39869,
-    -39861,
-    -39854,
-    -39846,
-    -39839,
-    -39832,
-    -39824,
-    -39817,
-    -39810,
-    -39802,
-    -39795,
     -39788,
-    -39780,
-    -39773,
-    -39766,
-    -39758,
-    -39751,
-    -39744,
-    -39736,
-    -39729,
-    -39722,
-    -39714,
-    -39707,
-    -39700,
-    -39692,
-    -39685,
-    -39678,
     -39670,
-    -39663,
-    -39656,
-    -39648,
-    -39641,
-    -39634,
-    -39626,
-    -39619,
-    -39612,
-    -39604,
-    -39597,
-    -39590,
-    -39583,
-    -39575,
-    -39568,
-    -39561,
     -39553,
-    -39546,
-    -39539,
-    -39531,
-    -39524,
-    -39517,
-    -39509,
-    -39502,
-    -39495,
-    -39487,
-    -39480,
-    -39473,
-    -39466,
-    -39458,
-    -39451,
-    -39444,
     -39436,
-    -39429,
-    -39422,
-    -39414,
-    -39407,
-    -39400,
-    -39393,
-    -39385,
-    -39378,
-    -39371,
-    -39363,
-    -39356,
-    -39349,
-    -39341,
-    -39334,
-    -39327,
     -39320,
-    -39312,
-    -39305,
-    -39298,
-    -39290,
-    -39283,
-    -39276,
-    -39269,
-    -39261,
-    -39254,
-    -39247,
-    -39240,
-    -39232,
-    -39225,
-    -39218,
-    -39210,
     -39203,
-    -39196,
-    -39189,
-    -39181,
-    -39174,
-    -39167,
-    -39159,
-    -39152,
-    -39145,
-    -39138,
-    -39130,
-    -39123,
-    -39116,
-    -39109,
-    -39101,
-    -39094,
     -39087,
-    -39080,
-    -39072,
-    -39065,
-    -39058,
-    -39051,
-    -39043,
-    -39036,
-    -39029,
-    -39021,
-    -39014,
-    -39007,
-    -39000,
-    -38992,
-    -38985,
-    -38978,
     -38971,
-    -38963,
-    -38956,
-    -38949,
-    -38942,
-    -38934,
-    -38927,
-    -38920,
-    -38913,
-    -38906,
-    -38898,
-    -38891,
-    -38884,
-    -38877,
-    -38869,
-    -38862,
     -38855,
-    -38848,
-    -38840,
-    -38833,
-    -38826,
-    -38819,
-    -38811,
-    -38804,
-    -38797,
-    -38790,
-    -38783,
-    -38775,
-    -38768,
-    -38761,
-    -38754,
-    -38746,
     -38739,
-    -38732,
-    -38725,
-    -38717,
-    -38710,
-    -38703,
-    -38696,
-    -38689,
-    -38681,
-    -38674,
-    -38667,
-    -38660,
-    -38653,
-    -38645,
-    -38638,
-    -38631,
     -38624,
-    -38616,
-    -38609,
-    -38602,
-    -38595,
-    -38588,
-    -38580,
-    -38573,
-    -38566,
-    -38559,
-    -38552,
-    -38544,
-    -38537,
-    -38530,
-    -38523,
-    -38516,
     -38508,
-    -38501,
-    -38494,
-    -38487,
-    -38480,
-    -38472,
-    -38465,
-    -38458,
-    -38451,
-    -38444,
-    -38436,
-    -38429,
-    -38422,
-    -38415,
-    -38408,
-    -38400,
     -38393,
-    -38386,
-    -38379,
-    -38372,
-    -38365,
-    -38357,
-    -38350,
-    -38343,
-    -38336,
-    -38329,
-    -38321,
-    -38314,
-    -38307,
-    -38300,
-    -38293,
-    -38286,
     -38278,
-    -38271,
-    -38264,
-    -38257,
-    -38250,
-    -38243,
-    -38235,
-    -38228,
-    -38221,
-    -38214,
-    -38207,
-    -38200,
-    -38192,
-    -38185,
-    -38178,
-    -38171,
     -38164,
-    -38157,
-    -38149,
-    -38142,
-    -38135,
-    -38128,
-    -38121,
-    -38114,
-    -38107,
-    -38099,
-    -38092,
-    -38085,
-    -38078,
-    -38071,
-    -38064,
-    -38056,
     -38049,
-    -38042,
-    -38035,
-    -38028,
-    -38021,
-    -38014,
-    -38006,
-    -37999,
-    -37992,
-    -37985,
-    -37978,
-    -37971,
-    -37964,
-    -37956,
-    -37949,
-    -37942,
     -37935,
-    -37928,
-    -37921,
-    -37914,
-    -37906,
-    -37899,
-    -37892,
-    -37885,
-    -37878,
-    -37871,
-    -37864,
-    -37857,
-    -37849,
-    -37842,
-    -37835,
-    -37828,
     -37821,
-    -37814,
-    -37807,
-    -37800,
-    -37792,
-    -37785,
-    -37778,
-    -37771,
-    -37764,
-    -37757,
-    -37750,
-    -37743,
-    -37736,
-    -37728,
-    -37721,
-    -37714,
     -37707,
-    -37700,
-    -37693,
-    -37686,
-    -37679,
-    -37672,
-    -37664,
-    -37657,
-    -37650,
-    -37643,
-    -37636,
-    -37629,
-    -37622,
-    -37615,
-    -37608,
-    -37600,
     -37593,
-    -37586,
-    -37579,
-    -37572,
-    -37565,
-    -37558,
-    -37551,
-    -37544,
-    -37537,
-    -37530,
-    -37522,
-    -37515,
-    -37508,
-    -37501,
-    -37494,
-    -37487,
     -37480,
-    -37473,
-    -37466,
-    -37459,
-    -37452,
-    -37444,
-    -37437,
-    -37430,
-    -37423,
-    -37416,
-    -37409,
-    -37402,
-    -37395,
-    -37388,
-    -37381,
-    -37374,
     -37367,
-    -37360,
-    -37352,
-    -37345,
-    -37338,
-    -37331,
-    -37324,
-    -37317,
-    -37310,
-    -37303,
-    -37296,
-    -37289,
-    -37282,
-    -37275,
-    -37268,
-    -37261,
     -37254,
-    -37246,
-    -37239,
-    -37232,
-    -37225,
-    -37218,
-    -37211,
-    -37204,
-    -37197,
-    -37190,
-    -37183,
-    -37176,
-    -37169,
-    -37162,
-    -37155,
-    -37148,
     -37141,
-    -37134,
-    -37127,
-    -37119,
-    -37112,
-    -37105,
-    -37098,
-    -37091,
-    -37084,
-    -37077,
-    -37070,
-    -37063,
-    -37056,
-    -37049,
-    -37042,
-    -37035,
     -37028,
-    -37021,
-    -37014,
-    -37007,
-    -37000,
-    -36993,
-    -36986,
-    -36979,
-    -36972,
-    -36965,
-    -36958,
-    -36951,
-    -36944,
-    -36937,
-    -36929,
-    -36922,
     -36915,
-    -36908,
-    -36901,
-    -36894,
-    -36887,
-    -36880,
-    -36873,
-    -36866,
-    -36859,
-    -36852,
-    -36845,
-    -36838,
-    -36831,
-    -36824,
-    -36817,
-    -36810,
     -36803,
-    -36796,
-    -36789,
-    -36782,
-    -36775,
-    -36768,
-    -36761,
-    -36754,
-    -36747,
-    -36740,
-    -36733,
-    -36726,
-    -36719,
-    -36712,
-    -36705,
-    -36698,
     -36691,
-    -36684,
-    -36677,
-    -36670,
-    -36663,
-    -36656,
-    -36649,
-    -36642,
-    -36635,
-    -36628,
-    -36621,
-    -36614,
-    -36607,
-    -36600,
-    -36593,
-    -36586,
     -36579,
-    -36572,
-    -36565,
-    -36558,
-    -36551,
-    -36544,
-    -36537,
-    -36530,
-    -36523,
-    -36516,
-    -36509,
-    -36502,
-    -36495,
-    -36488,
-    -36481,
-    -36474,
     -36467,
-    -36460,
-    -36453,
-    -36446,
-    -36439,
-    -36432,
-    -36425,
-    -36418,
-    -36412,
-    -36405,
-    -36398,
-    -36391,
-    -36384,
-    -36377,
-    -36370,
-    -36363,
     -36356,
-    -36349,
-    -36342,
-    -36335,
-    -36328,
-    -36321,
-    -36314,
-    -36307,
-    -36300,
-    -36293,
-    -36286,
-    -36279,
-    -36272,
-    -36265,
-    -36258,
-    -36251,
     -36244,
-    -36237,
-    -36230,
-    -36224,
-    -36217,
-    -36210,
-    -36203,
-    -36196,
-    -36189,
-    -36182,
-    -36175,
-    -36168,
-    -36161,
-    -36154,
-    -36147,
-    -36140,
     -36133,
-    -36126,
-    -36119,
-    -36112,
-    -36105,
-    -36099,
-    -36092,
-    -36085,
-    -36078,
-    -36071,
-    -36064,
-    -36057,
-    -36050,
-    -36043,
-    -36036,
-    -36029,
     -36022,
-    -36015,
-    -36008,
-    -36001,
-    -35995,
-    -35988,
-    -35981,
-    -35974,
-    -35967,
-    -35960,
-    -35953,
-    -35946,
-    -35939,
-    -35932,
-    -35925,
-    -35918,
     -35911,
-    -35905,
-    -35898,
-    -35891,
-    -35884,
-    -35877,
-    -35870,
-    -35863,
-    -35856,
-    -35849,
-    -35842,
-    -35835,
-    -35828,
-    -35822,
-    -35815,
-    -35808,
     -35801,
-    -35794,
-    -35787,
-    -35780,
-    -35773,
-    -35766,
-    -35759,
-    -35753,
-    -35746,
-    -35739,
-    -35732,
-    -35725,
-    -35718,
-    -35711,
-    -35704,
-    -35697,
     -35690,
-    -35684,
-    -35677,
-    -35670,
-    -35663,
-    -35656,
-    -35649,
-    -35642,
-    -35635,
-    -35628,
-    -35621,
-    -35615,
-    -35608,
-    -35601,
-    -35594,
-    -35587,
     -35580,
-    -35573,
-    -35566,
-    -35560,
-    -35553,
-    -35546,
-    -35539,
-    -35532,
-    -35525,
-    -35518,
-    -35511,
-    -35504,
-    -35498,
-    -35491,
-    -35484,
-    -35477,
     -35470,
-    -35463,
-    -35456,
-    -35450,
-    -35443,
-    -35436,
-    -35429,
-    -35422,
-    -35415,
-    -35408,
-    -35401,
-    -35395,
-    -35388,
-    -35381,
-    -35374,
-    -35367,
     -35360,
-    -35353,
-    -35347,
-    -35340,
-    -35333,
-    -35326,
-    -35319,
-    -35312,
-    -35305,
-    -35299,
-    -35292,
-    -35285,
-    -35278,
-    -35271,
-    -35264,
-    -35257,
     -35251,
-    -35244,
-    -35237,
-    -35230,
-    -35223,
-    -35216,
-    -35209,
-    -35203,
-    -35196,
-    -35189,
-    -35182,
-    -35175,
-    -35168,
-    -35162,
-    -35155,
-    -35148,
     -35141,
-    -35134,
-    -35127,
-    -35121,
-    -35114,
-    -35107,
-    -35100,
-    -35093,
-    -35086,
-    -35080,
-    -35073,
-    -35066,
-    -35059,
-    -35052,
-    -35045,
-    -35039,
     -35032,
-    -35025,
-    -35018,
-    -35011,
-    -35004,
-    -34998,
-    -34991,
-    -34984,
-    -34977,
-    -34970,
-    -34964,
-    -34957,
-    -34950,
-    -34943,
-    -34936,
-    -34929,
     -34923,
-    -34916,
-    -34909,
-    -34902,
-    -34895,
-    -34889,
-    -34882,
-    -34875,
-    -34868,
-    -34861,
-    -34855,
-    -34848,
-    -34841,
-    -34834,
-    -34827,
-    -34820,
     -34814,
-    -34807,
-    -34800,
-    -34793,
-    -34786,
-    -34780,
-    -34773,
-    -34766,
-    -34759,
-    -34752,
-    -34746,
-    -34739,
-    -34732,
-    -34725,
-    -34718,
-    -34712,
     -34705,
-    -34698,
-    -34691,
-    -34685,
-    -34678,
-    -34671,
-    -34664,
-    -34657,
-    -34651,
-    -34644,
-    -34637,
-    -34630,
-    -34623,
-    -34617,
-    -34610,
-    -34603,
     -34596,
-    -34590,
-    -34583,
-    -34576,
-    -34569,
-    -34562,
-    -34556,
-    -34549,
-    -34542,
-    -34535,
-    -34529,
-    -34522,
-    -34515,
-    -34508,
-    -34501,
-    -34495,
     -34488,
-    -34481,
-    -34474,
-    -34468,
-    -34461,
-    -34454,
-    -34447,
-    -34441,
-    -34434,
-    -34427,
-    -34420,
-    -34413,
-    -34407,
-    -34400,
-    -34393,
-    -34386,
     -34380,
-    -34373,
-    -34366,
-    -34359,
-    -34353,
-    -34346,
-    -34339,
-    -34332,
-    -34326,
-    -34319,
-    -34312,
-    -34305,
-    -34299,
-    -34292,
-    -34285,
-    -34278,
     -34272,
-    -34265,
-    -34258,
-    -34251,
-    -34245,
-    -34238,
-    -34231,
-    -34224,
-    -34218,
-    -34211,
-    -34204,
-    -34197,
-    -34191,
-    -34184,
-    -34177,
-    -34170,
     -34164,
-    -34157,
-    -34150,
-    -34144,
-    -34137,
-    -34130,
-    -34123,
-    -34117,
-    -34110,
-    -34103,
-    -34096,
-    -34090,
-    -34083,
-    -34076,
-    -34069,
-    -34063,
     -34056,
-    -34049,
-    -34043,
-    -34036,
-    -34029,
-    -34022,
-    -34016,
-    -34009,
-    -34002,
-    -33996,
-    -33989,
-    -33982,
-    -33975,
-    -33969,
-    -33962,
-    -33955,
     -33948,
-    -33942,
-    -33935,
-    -33928,
-    -33922,
-    -33915,
-    -33908,
-    -33902,
-    -33895,
-    -33888,
-    -33881,
-    -33875,
-    -33868,
-    -33861,
-    -33855,
-    -33848,
     -33841,
-    -33834,
-    -33828,
-    -33821,
-    -33814,
-    -33808,
-    -33801,
-    -33794,
-    -33788,
-    -33781,
-    -33774,
-    -33767,
-    -33761,
-    -33754,
-    -33747,
-    -33741,
     -33734,
-    -33727,
-    -33721,
-    -33714,
-    -33707,
-    -33701,
-    -33694,
-    -33687,
-    -33680,
-    -33674,
-    -33667,
-    -33660,
-    -33654,
-    -33647,
-    -33640,
-    -33634,
     -33627,
-    -33620,
-    -33614,
-    -33607,
-    -33600,
-    -33594,
-    -33587,
-    -33580,
-    -33574,
-    -33567,
-    -33560,
-    -33554,
-    -33547,
-    -33540,
-    -33533,
-    -33527,
     -33520,
-    -33513,
-    -33507,
-    -33500,
-    -33493,
-    -33487,
-    -33480,
-    -33473,
-    -33467,
-    -33460,
-    -33453,
-    -33447,
-    -33440,
-    -33433,
-    -33427,
-    -33420,
     -33413,
-    -33407,
-    -33400,
-    -33394,
-    -33387,
-    -33380,
-    -33374,
-    -33367,
-    -33360,
-    -33354,
-    -33347,
-    -33340,
-    -33334,
-    -33327,
-    -33320,
-    -33314,
     -33307,
-    -33300,
-    -33294,
-    -33287,
-    -33280,
-    -33274,
-    -33267,
-    -33260,
-    -33254,
-    -33247,
-    -33241,
-    -33234,
-    -33227,
-    -33221,
-    -33214,
-    -33207,
     -33201,
-    -33194,
-    -33187,
-    -33181,
-    -33174,
-    -33168,
-    -33161,
-    -33154,
-    -33148,
-    -33141,
-    -33134,
-    -33128,
-    -33121,
-    -33114,
-    -33108,
-    -33101,
     -33095,
-    -33088,
-    -33081,
-    -33075,
-    -33068,
-    -33061,
-    -33055,
-    -33048,
-    -33042,
-    -33035,
-    -33028,
-    -33022,
-    -33015,
-    -33008,
-    -33002,
-    -32995,
     -32989,
-    -32982,
-    -32975,
-    -32969,
-    -32962,
-    -32956,
-    -32949,
-    -32942,
-    -32936,
-    -32929,
-    -32922,
-    -32916,
-    -32909,
-    -32903,
-    -32896,
-    -32889,
     -32883,
-    -32876,
-    -32870,
-    -32863,
-    -32856,
-    -32850,
-    -32843,
-    -32837,
-    -32830,
-    -32823,
-    -32817,
-    -32810,
-    -32804,
-    -32797,
-    -32790,
-    -32784,
     -32777,
-    -32771,
-    -32764,
-    -32757,
-    -32751,
-    -32744,
-    -32738,
-    -32731,
-    -32724,
-    -32718,
-    -32711,
-    -32705,
-    -32698,
-    -32692,
-    -32685,
-    -32678,
     -32672,
-    -32665,
-    -32659,
-    -32652,
-    -32645,
-    -32639,
-    -32632,
-    -32626,
-    -32619,
-    -32613,
-    -32606,
-    -32599,
-    -32593,
-    -32586,
-    -32580,
-    -32573,
     -32566,
-    -32560,
-    -32553,
-    -32547,
-    -32540,
-    -32534,
-    -32527,
-    -32520,
-    -32514,
-    -32507,
-    -32501,
-    -32494,
-    -32488,
-    -32481,
-    -32475,
-    -32468,
     -32461,
-    -32455,
-    -32448,
-    -32442,
-    -32435,
-    -32429,
-    -32422,
-    -32415,
-    -32409,
-    -32402,
-    -32396,
-    -32389,
-    -32383,
-    -32376,
-    -32370,
-    -32363,
     -32356,
-    -32350,
-    -32343,
-    -32337,
-    -32330,
-    -32324,
-    -32317,
-    -32311,
-    -32304,
-    -32297,
-    -32291,
-    -32284,
-    -32278,
-    -32271,
-    -32265,
-    -32258,
     -32252,
-    -32245,
-    -32239,
-    -32232,
-    -32226,
-    -32219,
-    -32212,
-    -32206,
-    -32199,
-    -32193,
-    -32186,
-    -32180,
-    -32173,
-    -32167,
-    -32160,
-    -32154,
     -32147,
-    -32141,
-    -32134,
-    -32127,
-    -32121,
-    -32114,
-    -32108,
-    -32101,
-    -32095,
-    -32088,
-    -32082,
-    -32075,
-    -32069,
-    -32062,
-    -32056,
-    -32049,
     -32043,
-    -32036,
-    -32030,
-    -32023,
-    -32017,
-    -32010,
-    -32004,
-    -31997,
-    -31990,
-    -31984,
-    -31977,
-    -31971,
-    -31964,
-    -31958,
-    -31951,
-    -31945,
     -31938,
-    -31932,
-    -31925,
-    -31919,
-    -31912,
-    -31906,
-    -31899,
-    -31893,
-    -31886,
-    -31880,
-    -31873,
-    -31867,
-    -31860,
-    -31854,
-    -31847,
-    -31841,
     -31834,
-    -31828,
-    -31821,
-    -31815,
-    -31808,
-    -31802,
-    -31795,
-    -31789,
-    -31782,
-    -31776,
-    -31769,
-    -31763,
-    -31756,
-    -31750,
-    -31743,
-    -31737,
     -31730,
-    -31724,
-    -31717,
-    -31711,
-    -31704,
-    -31698,
-    -31691,
-    -31685,
-    -31678,
-    -31672,
-    -31665,
-    -31659,
-    -31652,
-    -31646,
-    -31639,
-    -31633,
     -31627,
-    -31620,
-    -31614,
-    -31607,
-    -31601,
-    -31594,
-    -31588,
-    -31581,
-    -31575,
-    -31568,
-    -31562,
-    -31555,
-    -31549,
-    -31542,
-    -31536,
-    -31529,
     -31523,
-    -31516,
-    -31510,
-    -31503,
-    -31497,
-    -31491,
-    -31484,
-    -31478,
-    -31471,
-    -31465,
-    -31458,
-    -31452,
-    -31445,
-    -31439,
-    -31432,
-    -31426,
     -31419,
-    -31413,
-    -31407,
-    -31400,
-    -31394,
-    -31387,
-    -31381,
-    -31374,
-    -31368,
-    -31361,
-    -31355,
-    -31348,
-    -31342,
-    -31336,
-    -31329,
-    -31323,
     -31316,
-    -31310,
-    -31303,
-    -31297,
-    -31290,
-    -31284,
-    -31277,
-    -31271,
-    -31265,
-    -31258,
-    -31252,
-    -31245,
-    -31239,
-    -31232,
-    -31226,
-    -31219,
     -31213,
-    -31207,
-    -31200,
-    -31194,
-    -31187,
-    -31181,
-    -31174,
-    -31168,
-    -31162,
-    -31155,
-    -31149,
-    -31142,
-    -31136,
-    -31129,
-    -31123,
-    -31117,
     -31110,
-    -31104,
-    -31097,
-    -31091,
-    -31084,
-    -31078,
-    -31072,
-    -31065,
-    -31059,
-    -31052,
-    -31046,
-    -31039,
-    -31033,
-    -31027,
-    -31020,
-    -31014,
     -31007,
-    -31001,
-    -30994,
-    -30988,
-    -30982,
-    -30975,
-    -30969,
-    -30962,
-    -30956,
-    -30950,
-    -30943,
-    -30937,
-    -30930,
-    -30924,
-    -30917,
-    -30911,
     -30905,
-    -30898,
-    -30892,
-    -30885,
-    -30879,
-    -30873,
-    -30866,
-    -30860,
-    -30853,
-    -30847,
-    -30841,
-    -30834,
-    -30828,
-    -30821,
-    -30815,
-    -30809,
     -30802,
-    -30796,
-    -30789,
-    -30783,
-    -30777,
-    -30770,
-    -30764,
-    -30757,
-    -30751,
-    -30745,
-    -30738,
-    -30732,
-    -30725,
-    -30719,
-    -30713,
-    -30706,
     -30700,
-    -30693,
-    -30687,
-    -30681,
-    -30674,
-    -30668,
-    -30662,
-    -30655,
-    -30649,
-    -30642,
-    -30636,
-    -30630,
-    -30623,
-    -30617,
-    -30610,
-    -30604,
     -30598,
-    -30591,
-    -30585,
-    -30579,
-    -30572,
-    -30566,
-    -30559,
-    -30553,
-    -30547,
-    -30540,
-    -30534,
-    -30528,
-    -30521,
-    -30515,
-    -30508,
-    -30502,
     -30496,
-    -30489,
-    -30483,
-    -30477,
-    -30470,
-    -30464,
-    -30457,
-    -30451,
-    -30445,
-    -30438,
-    -30432,
-    -30426,
-    -30419,
-    -30413,
-    -30407,
-    -30400,
     -30394,
-    -30387,
-    -30381,
-    -30375,
-    -30368,
-    -30362,
-    -30356,
-    -30349,
-    -30343,
-    -30337,
-    -30330,
-    -30324,
-    -30318,
-    -30311,
-    -30305,
-    -30298,
     -30292,
-    -30286,
-    -30279,
-    -30273,
-    -30267,
-    -30260,
-    -30254,
-    -30248,
-    -30241,
-    -30235,
-    -30229,
-    -30222,
-    -30216,
-    -30210,
-    -30203,
-    -30197,
     -30191,
-    -30184,
-    -30178,
-    -30172,
-    -30165,
-    -30159,
-    -30153,
-    -30146,
-    -30140,
-    -30134,
-    -30127,
-    -30121,
-    -30115,
-    -30108,
-    -30102,
-    -30096,
     -30089,
-    -30083,
-    -30077,
-    -30070,
-    -30064,
-    -30058,
-    -30051,
-    -30045,
-    -30039,
-    -30032,
-    -30026,
-    -30020,
-    -30013,
-    -30007,
-    -30001,
-    -29994,
     -29988,
-    -29982,
-    -29975,
-    -29969,
-    -29963,
-    -29956,
-    -29950,
-    -29944,
-    -29937,
-    -29931,
-    -29925,
-    -29919,
-    -29912,
-    -29906,
-    -29900,
-    -29893,
     -29887,
-    -29881,
-    -29874,
-    -29868,
-    -29862,
-    -29855,
-    -29849,
-    -29843,
-    -29837,
-    -29830,
-    -29824,
-    -29818,
-    -29811,
-    -29805,
-    -29799,
-    -29792,
     -29786,
-    -29780,
-    -29773,
-    -29767,
-    -29761,
-    -29755,
-    -29748,
-    -29742,
-    -29736,
-    -29729,
-    -29723,
-    -29717,
-    -29711,
-    -29704,
-    -29698,
-    -29692,
     -29685,
-    -29679,
-    -29673,
-    -29666,
-    -29660,
-    -29654,
-    -29648,
-    -29641,
-    -29635,
-    -29629,
-    -29622,
-    -29616,
-    -29610,
-    -29604,
-    -29597,
-    -29591,
     -29585,
-    -29578,
-    -29572,
-    -29566,
-    -29560,
-    -29553,
-    -29547,
-    -29541,
-    -29534,
-    -29528,
-    -29522,
-    -29516,
-    -29509,
-    -29503,
-    -29497,
-    -29491,
     -29484,
-    -29478,
-    -29472,
-    -29465,
-    -29459,
-    -29453,
-    -29447,
-    -29440,
-    -29434,
-    -29428,
-    -29422,
-    -29415,
-    -29409,
-    -29403,
-    -29397,
-    -29390,
     -29384,
-    -29378,
-    -29371,
-    -29365,
-    -29359,
-    -29353,
-    -29346,
-    -29340,
-    -29334,
-    -29328,
-    -29321,
-    -29315,
-    -29309,
-    -29303,
-    -29296,
-    -29290,
     -29284,
-    -29278,
-    -29271,
-    -29265,
-    -29259,
-    -29253,
-    -29246,
-    -29240,
-    -29234,
-    -29228,
-    -29221,
-    -29215,
-    -29209,
-    -29203,
-    -29196,
-    -29190,
     -29184,
-    -29178,
-    -29171,
-    -29165,
-    -29159,
-    -29153,
-    -29146,
-    -29140,
-    -29134,
-    -29128,
-    -29121,
-    -29115,
-    -29109,
-    -29103,
-    -29097,
-    -29090,
     -29084,
-    -29078,
-    -29072,
-    -29065,
-    -29059,
-    -29053,
-    -29047,
-    -29040,
-    -29034,
-    -29028,
-    -29022,
-    -29016,
-    -29009,
-    -29003,
-    -28997,
-    -28991,
     -28984,
-    -28978,
-    -28972,
-    -28966,
-    -28960,
-    -28953,
-    -28947,
-    -28941,
-    -28935,
-    -28928,
-    -28922,
-    -28916,
-    -28910,
-    -28904,
-    -28897,
-    -28891,
     -28885,
-    -28879,
-    -28872,
-    -28866,
-    -28860,
-    -28854,
-    -28848,
-    -28841,
-    -28835,
-    -28829,
-    -28823,
-    -28817,
-    -28810,
-    -28804,
-    -28798,
-    -28792,
     -28786,
-    -28779,
-    -28773,
-    -28767,
-    -28761,
-    -28754,
-    -28748,
-    -28742,
-    -28736,
-    -28730,
-    -28723,
-    -28717,
-    -28711,
-    -28705,
-    -28699,
-    -28692,
     -28686,
-    -28680,
-    -28674,
-    -28668,
-    -28662,
-    -28655,
-    -28649,
-    -28643,
-    -28637,
-    -28631,
-    -28624,
-    -28618,
-    -28612,
-    -28606,
-    -28600,
-    -28593,
     -28587,
-    -28581,
-    -28575,
-    -28569,
-    -28562,
-    -28556,
-    -28550,
-    -28544,
-    -28538,
-    -28532,
-    -28525,
-    -28519,
-    -28513,
-    -28507,
-    -28501,
-    -28494,
     -28488,
-    -28482,
-    -28476,
-    -28470,
-    -28464,
-    -28457,
-    -28451,
-    -28445,
-    -28439,
-    -28433,
-    -28427,
-    -28420,
-    -28414,
-    -28408,
-    -28402,
-    -28396,
     -28390,
-    -28383,
-    -28377,
-    -28371,
-    -28365,
-    -28359,
-    -28353,
-    -28346,
-    -28340,
-    -28334,
-    -28328,
-    -28322,
-    -28316,
-    -28309,
-    -28303,
-    -28297,
     -28291,
-    -28285,
-    -28279,
-    -28272,
-    -28266,
-    -28260,
-    -28254,
-    -28248,
-    -28242,
-    -28235,
-    -28229,
-    -28223,
-    -28217,
-    -28211,
-    -28205,
-    -28199,
     -28192,
-    -28186,
-    -28180,
-    -28174,
-    -28168,
-    -28162,
-    -28156,
-    -28149,
-    -28143,
-    -28137,
-    -28131,
-    -28125,
-    -28119,
-    -28113,
-    -28106,
-    -28100,
     -28094,
-    -28088,
-    -28082,
-    -28076,
-    -28070,
-    -28063,
-    -28057,
-    -28051,
-    -28045,
-    -28039,
-    -28033,
-    -28027,
-    -28020,
-    -28014,
-    -28008,
-    -28002,
     -27996,
-    -27990,
-    -27984,
-    -27978,
-    -27971,
-    -27965,
-    -27959,
-    -27953,
-    -27947,
-    -27941,
-    -27935,
-    -27928,
-    -27922,
-    -27916,
-    -27910,
-    -27904,
     -27898,
-    -27892,
-    -27886,
-    -27880,
-    -27873,
-    -27867,
-    -27861,
-    -27855,
-    -27849,
-    -27843,
-    -27837,
-    -27831,
-    -27824,
-    -27818,
-    -27812,
-    -27806,
     -27800,
-    -27794,
-    -27788,
-    -27782,
-    -27776,
-    -27769,
-    -27763,
-    -27757,
-    -27751,
-    -27745,
-    -27739,
-    -27733,
-    -27727,
-    -27721,
-    -27714,
-    -27708,
     -27702,
-    -27696,
-    -27690,
-    -27684,
-    -27678,
-    -27672,
-    -27666,
-    -27660,
-    -27653,
-    -27647,
-    -27641,
-    -27635,
-    -27629,
-    -27623,
-    -27617,
-    -27611,
     -27605,
-    -27599,
-    -27592,
-    -27586,
-    -27580,
-    -27574,
-    -27568,
-    -27562,
-    -27556,
-    -27550,
-    -27544,
-    -27538,
-    -27532,
-    -27525,
-    -27519,
-    -27513,
     -27507,
-    -27501,
-    -27495,
-    -27489,
-    -27483,
-    -27477,
-    -27471,
-    -27465,
-    -27459,
-    -27452,
-    -27446,
-    -27440,
-    -27434,
-    -27428,
-    -27422,
-    -27416,
     -27410,
-    -27404,
-    -27398,
-    -27392,
-    -27386,
-    -27380,
-    -27373,
-    -27367,
-    -27361,
-    -27355,
-    -27349,
-    -27343,
-    -27337,
-    -27331,
-    -27325,
-    -27319,
     -27313,
-    -27307,
-    -27301,
-    -27295,
-    -27288,
-    -27282,
-    -27276,
-    -27270,
-    -27264,
-    -27258,
-    -27252,
-    -27246,
-    -27240,
-    -27234,
-    -27228,
-    -27222,
     -27216,
-    -27210,
-    -27204,
-    -27198,
-    -27191,
-    -27185,
-    -27179,
-    -27173,
-    -27167,
-    -27161,
-    -27155,
-    -27149,
-    -27143,
-    -27137,
-    -27131,
-    -27125,
     -27119,
-    -27113,
-    -27107,
-    -27101,
-    -27095,
-    -27089,
-    -27083,
-    -27076,
-    -27070,
-    -27064,
-    -27058,
-    -27052,
-    -27046,
-    -27040,
-    -27034,
-    -27028,
     -27022,
-    -27016,
-    -27010,
-    -27004,
-    -26998,
-    -26992,
-    -26986,
-    -26980,
-    -26974,
-    -26968,
-    -26962,
-    -26956,
-    -26950,
-    -26944,
-    -26938,
-    -26932,
     -26926,
-    -26919,
-    -26913,
-    -26907,
-    -26901,
-    -26895,
-    -26889,
-    -26883,
-    -26877,
-    -26871,
-    -26865,
-    -26859,
-    -26853,
-    -26847,
-    -26841,
-    -26835,
     -26829,
-    -26823,
-    -26817,
-    -26811,
-    -26805,
-    -26799,
-    -26793,
-    -26787,
-    -26781,
-    -26775,
-    -26769,
-    -26763,
-    -26757,
-    -26751,
-    -26745,
-    -26739,
     -26733,
-    -26727,
-    -26721,
-    -26715,
-    -26709,
-    -26703,
-    -26697,
-    -26691,
-    -26685,
-    -26679,
-    -26673,
-    -26667,
-    -26661,
-    -26655,
-    -26649,
-    -26643,
     -26637,
-    -26631,
-    -26625,
-    -26619,
-    -26613,
-    -26607,
-    -26601,
-    -26595,
-    -26589,
-    -26583,
-    -26577,
-    -26571,
-    -26565,
-    -26559,
-    -26553,
-    -26547,
     -26541,
-    -26535,
-    -26529,
-    -26523,
-    -26517,
-    -26511,
-    -26505,
-    -26499,
-    -26493,
-    -26487,
-    -26481,
-    -26475,
-    -26469,
-    -26463,
-    -26457,
-    -26451,
     -26445,
-    -26439,
-    -26433,
-    -26427,
-    -26421,
-    -26415,
-    -26409,
-    -26403,
-    -26397,
-    -26391,
-    -26385,
-    -26379,
-    -26373,
-    -26367,
-    -26361,
-    -26355,
     -26349,
-    -26343,
-    -26337,
-    -26331,
-    -26325,
-    -26319,
-    -26313,
-    -26307,
-    -26301,
-    -26295,
-    -26289,
-    -26283,
-    -26277,
-    -26271,
-    -26265,
-    -26259,
     -26253,
-    -26247,
-    -26241,
-    -26235,
-    -26229,
-    -26223,
-    -26218,
-    -26212,
-    -26206,
-    -26200,
-    -26194,
-    -26188,
-    -26182,
-    -26176,
-    -26170,
-    -26164,
     -26158,
-    -26152,
-    -26146,
-    -26140,
-    -26134,
-    -26128,
-    -26122,
-    -26116,
-    -26110,
-    -26104,
-    -26098,
-    -26092,
-    -26086,
-    -26080,
-    -26074,
-    -26069,
     -26063,
-    -26057,
-    -26051,
-    -26045,
-    -26039,
-    -26033,
-    -26027,
-    -26021,
-    -26015,
-    -26009,
-    -26003,
-    -25997,
-    -25991,
-    -25985,
-    -25979,
-    -25973,
     -25967,
-    -25961,
-    -25955,
-    -25950,
-    -25944,
-    -25938,
-    -25932,
-    -25926,
-    -25920,
-    -25914,
-    -25908,
-    -25902,
-    -25896,
-    -25890,
-    -25884,
-    -25878,
     -25872,
-    -25866,
-    -25860,
-    -25855,
-    -25849,
-    -25843,
-    -25837,
-    -25831,
-    -25825,
-    -25819,
-    -25813,
-    -25807,
-    -25801,
-    -25795,
-    -25789,
-    -25783,
     -25777,
-    -25771,
-    -25766,
-    -25760,
-    -25754,
-    -25748,
-    -25742,
-    -25736,
-    -25730,
-    -25724,
-    -25718,
-    -25712,
-    -25706,
-    -25700,
-    -25694,
-    -25689,
     -25683,
-    -25677,
-    -25671,
-    -25665,
-    -25659,
-    -25653,
-    -25647,
-    -25641,
-    -25635,
-    -25629,
-    -25623,
-    -25618,
-    -25612,
-    -25606,
-    -25600,
-    -25594,
     -25588,
-    -25582,
-    -25576,
-    -25570,
-    -25564,
-    -25558,
-    -25553,
-    -25547,
-    -25541,
-    -25535,
-    -25529,
-    -25523,
-    -25517,
-    -25511,
-    -25505,
-    -25499,
     -25493,
-    -25488,
-    -25482,
-    -25476,
-    -25470,
-    -25464,
-    -25458,
-    -25452,
-    -25446,
-    -25440,
-    -25435,
-    -25429,
-    -25423,
-    -25417,
-    -25411,
-    -25405,
     -25399,
-    -25393,
-    -25387,
-    -25381,
-    -25376,
-    -25370,
-    -25364,
-    -25358,
-    -25352,
-    -25346,
-    -25340,
-    -25334,
-    -25328,
-    -25323,
-    -25317,
-    -25311,
     -25305,
-    -25299,
-    -25293,
-    -25287,
-    -25281,
-    -25275,
-    -25270,
-    -25264,
-    -25258,
-    -25252,
-    -25246,
-    -25240,
-    -25234,
-    -25228,
-    -25223,
-    -25217,
     -25211,
-    -25205,
-    -25199,
-    -25193,
-    -25187,
-    -25181,
-    -25176,
-    -25170,
-    -25164,
-    -25158,
-    -25152,
-    -25146,
-    -25140,
-    -25134,
-    -25129,
-    -25123,
     -25117,
-    -25111,
-    -25105,
-    -25099,
-    -25093,
-    -25088,
-    -25082,
-    -25076,
-    -25070,
-    -25064,
-    -25058,
-    -25052,
-    -25046,
-    -25041,
-    -25035,
-    -25029,
     -25023,
-    -25017,
-    -25011,
-    -25005,
-    -25000,
-    -24994,
-    -24988,
-    -24982,
-    -24976,
-    -24970,
-    -24964,
-    -24959,
-    -24953,
-    -24947,
-    -24941,
-    -24935,
     -24929,
-    -24923,
-    -24918,
-    -24912,
-    -24906,
-    -24900,
-    -24894,
-    -24888,
-    -24883,
-    -24877,
-    -24871,
-    -24865,
-    -24859,
-    -24853,
-    -24847,
-    -24842,
     -24836,
-    -24830,
-    -24824,
-    -24818,
-    -24812,
-    -24807,
-    -24801,
-    -24795,
-    -24789,
-    -24783,
-    -24777,
-    -24772,
-    -24766,
-    -24760,
-    -24754,
-    -24748,
     -24742,
-    -24737,
-    -24731,
-    -24725,
-    -24719,
-    -24713,
-    -24707,
-    -24702,
-    -24696,
-    -24690,
-    -24684,
-    -24678,
-    -24672,
-    -24667,
-    -24661,
-    -24655,
     -24649,
-    -24643,
-    -24637,
-    -24632,
-    -24626,
-    -24620,
-    -24614,
-    -24608,
-    -24602,
-    -24597,
-    -24591,
-    -24585,
-    -24579,
-    -24573,
-    -24568,
-    -24562,
     -24556,
-    -24550,
-    -24544,
-    -24538,
-    -24533,
-    -24527,
-    -24521,
-    -24515,
-    -24509,
-    -24504,
-    -24498,
-    -24492,
-    -24486,
-    -24480,
-    -24475,
-    -24469,
     -24463,
-    -24457,
-    -24451,
-    -24445,
-    -24440,
-    -24434,
-    -24428,
-    -24422,
-    -24416,
-    -24411,
-    -24405,
-    -24399,
-    -24393,
-    -24387,
-    -24382,
-    -24376,
     -24370,
-    -24364,
-    -24358,
-    -24353,
-    -24347,
-    -24341,
-    -24335,
-    -24329,
-    -24324,
-    -24318,
-    -24312,
-    -24306,
-    -24300,
-    -24295,
-    -24289,
-    -24283,
     -24277,
-    -24271,
-    -24266,
-    -24260,
-    -24254,
-    -24248,
-    -24242,
-    -24237,
-    -24231,
-    -24225,
-    -24219,
-    -24214,
-    -24208,
-    -24202,
-    -24196,
-    -24190,
     -24185,
-    -24179,
-    -24173,
-    -24167,
-    -24161,
-    -24156,
-    -24150,
-    -24144,
-    -24138,
-    -24133,
-    -24127,
-    -24121,
-    -24115,
-    -24109,
-    -24104,
-    -24098,
     -24092,
-    -24086,
-    -24081,
-    -24075,
-    -24069,
-    -24063,
-    -24057,
-    -24052,
-    -24046,
-    -24040,
-    -24034,
-    -24029,
-    -24023,
-    -24017,
-    -24011,
-    -24006,
     -24000,
-    -23994,
-    -23988,
-    -23982,
-    -23977,
-    -23971,
-    -23965,
-    -23959,
-    -23954,
-    -23948,
-    -23942,
-    -23936,
-    -23931,
-    -23925,
-    -23919,
-    -23913,
     -23907,
-    -23902,
-    -23896,
-    -23890,
-    -23884,
-    -23879,
-    -23873,
-    -23867,
-    -23861,
-    -23856,
-    -23850,
-    -23844,
-    -23838,
-    -23833,
-    -23827,
-    -23821,
     -23815,
-    -23810,
-    -23804,
-    -23798,
-    -23792,
-    -23787,
-    -23781,
-    -23775,
-    -23769,
-    -23764,
-    -23758,
-    -23752,
-    -23746,
-    -23741,
-    -23735,
-    -23729,
     -23723,
-    -23718,
-    -23712,
-    -23706,
-    -23700,
-    -23695,
-    -23689,
-    -23683,
-    -23677,
-    -23672,
-    -23666,
-    -23660,
-    -23655,
-    -23649,
-    -23643,
-    -23637,
     -23632,
-    -23626,
-    -23620,
-    -23614,
-    -23609,
-    -23603,
-    -23597,
-    -23591,
-    -23586,
-    -23580,
-    -23574,
-    -23568,
-    -23563,
-    -23557,
-    -23551,
-    -23546,
     -23540,
-    -23534,
-    -23528,
-    -23523,
-    -23517,
-    -23511,
-    -23505,
-    -23500,
-    -23494,
-    -23488,
-    -23483,
-    -23477,
-    -23471,
-    -23465,
-    -23460,
-    -23454,
     -23448,
-    -23443,
-    -23437,
-    -23431,
-    -23425,
-    -23420,
-    -23414,
-    -23408,
-    -23402,
-    -23397,
-    -23391,
-    -23385,
-    -23380,
-    -23374,
-    -23368,
-    -23362,
     -23357,
-    -23351,
-    -23345,
-    -23340,
-    -23334,
-    -23328,
-    -23322,
-    -23317,
-    -23311,
-    -23305,
-    -23300,
-    -23294,
-    -23288,
-    -23283,
-    -23277,
-    -23271,
     -23265,
-    -23260,
-    -23254,
-    -23248,
-    -23243,
-    -23237,
-    -23231,
-    -23226,
-    -23220,
-    -23214,
-    -23208,
-    -23203,
-    -23197,
-    -23191,
-    -23186,
-    -23180,
     -23174,
-    -23169,
-    -23163,
-    -23157,
-    -23151,
-    -23146,
-    -23140,
-    -23134,
-    -23129,
-    -23123,
-    -23117,
-    -23112,
-    -23106,
-    -23100,
-    -23095,
-    -23089,
     -23083,
-    -23077,
-    -23072,
-    -23066,
-    -23060,
-    -23055,
-    -23049,
-    -23043,
-    -23038,
-    -23032,
-    -23026,
-    -23021,
-    -23015,
-    -23009,
-    -23004,
-    -22998,
     -22992,
-    -22986,
-    -22981,
-    -22975,
-    -22969,
-    -22964,
-    -22958,
-    -22952,
-    -22947,
-    -22941,
-    -22935,
-    -22930,
-    -22924,
-    -22918,
-    -22913,
-    -22907,
     -22901,
-    -22896,
-    -22890,
-    -22884,
-    -22879,
-    -22873,
-    -22867,
-    -22862,
-    -22856,
-    -22850,
-    -22845,
-    -22839,
-    -22833,
-    -22828,
-    -22822,
-    -22816,
     -22811,
-    -22805,
-    -22799,
-    -22794,
-    -22788,
-    -22782,
-    -22777,
-    -22771,
-    -22765,
-    -22760,
-    -22754,
-    -22748,
-    -22743,
-    -22737,
-    -22731,
-    -22726,
     -22720,
-    -22714,
-    -22709,
-    -22703,
-    -22697,
-    -22692,
-    -22686,
-    -22680,
-    -22675,
-    -22669,
-    -22663,
-    -22658,
-    -22652,
-    -22647,
-    -22641,
-    -22635,
     -22630,
-    -22624,
-    -22618,
-    -22613,
-    -22607,
-    -22601,
-    -22596,
-    -22590,
-    -22584,
-    -22579,
-    -22573,
-    -22567,
-    -22562,
-    -22556,
-    -22551,
-    -22545,
     -22539,
-    -22534,
-    -22528,
-    -22522,
-    -22517,
-    -22511,
-    -22505,
-    -22500,
-    -22494,
-    -22489,
-    -22483,
-    -22477,
-    -22472,
-    -22466,
-    -22460,
-    -22455,
     -22449,
-    -22443,
-    -22438,
-    -22432,
-    -22427,
-    -22421,
-    -22415,
-    -22410,
-    -22404,
-    -22398,
-    -22393,
-    -22387,
-    -22381,
-    -22376,
-    -22370,
-    -22365,
     -22359,
-    -22353,
-    -22348,
-    -22342,
-    -22336,
-    -22331,
-    -22325,
-    -22320,
-    -22314,
-    -22308,
-    -22303,
-    -22297,
-    -22291,
-    -22286,
-    -22280,
-    -22275,
     -22269,
-    -22263,
-    -22258,
-    -22252,
-    -22247,
-    -22241,
-    -22235,
-    -22230,
-    -22224,
-    -22218,
-    -22213,
-    -22207,
-    -22202,
-    -22196,
-    -22190,
-    -22185,
     -22179,
-    -22174,
-    -22168,
-    -22162,
-    -22157,
-    -22151,
-    -22146,
-    -22140,
-    -22134,
-    -22129,
-    -22123,
-    -22117,
-    -22112,
-    -22106,
-    -22101,
-    -22095,
     -22089,
-    -22084,
-    -22078,
-    -22073,
-    -22067,
-    -22061,
-    -22056,
-    -22050,
-    -22045,
-    -22039,
-    -22033,
-    -22028,
-    -22022,
-    -22017,
-    -22011,
-    -22005,
     -22000,
-    -21994,
-    -21989,
-    -21983,
-    -21977,
-    -21972,
-    -21966,
-    -21961,
-    -21955,
-    -21950,
-    -21944,
-    -21938,
-    -21933,
-    -21927,
-    -21922,
-    -21916,
     -21910,
-    -21905,
-    -21899,
-    -21894,
-    -21888,
-    -21882,
-    -21877,
-    -21871,
-    -21866,
-    -21860,
-    -21855,
-    -21849,
-    -21843,
-    -21838,
-    -21832,
-    -21827,
     -21821,
-    -21815,
-    -21810,
-    -21804,
-    -21799,
-    -21793,
-    -21788,
-    -21782,
-    -21776,
-    -21771,
-    -21765,
-    -21760,
-    -21754,
-    -21749,
-    -21743,
-    -21737,
     -21732,
-    -21726,
-    -21721,
-    -21715,
-    -21710,
-    -21704,
-    -21698,
-    -21693,
-    -21687,
-    -21682,
-    -21676,
-    -21671,
-    -21665,
-    -21659,
-    -21654,
-    -21648,
     -21643,
-    -21637,
-    -21632,
-    -21626,
-    -21620,
-    -21615,
-    -21609,
-    -21604,
-    -21598,
-    -21593,
-    -21587,
-    -21582,
-    -21576,
-    -21570,
-    -21565,
-    -21559,
     -21554,
-    -21548,
-    -21543,
-    -21537,
-    -21532,
-    -21526,
-    -21520,
-    -21515,
-    -21509,
-    -21504,
-    -21498,
-    -21493,
-    -21487,
-    -21482,
-    -21476,
-    -21470,
     -21465,
-    -21459,
-    -21454,
-    -21448,
-    -21443,
-    -21437,
-    -21432,
-    -21426,
-    -21420,
-    -21415,
-    -21409,
-    -21404,
-    -21398,
-    -21393,
-    -21387,
-    -21382,
     -21376,
-    -21371,
-    -21365,
-    -21360,
-    -21354,
-    -21348,
-    -21343,
-    -21337,
-    -21332,
-    -21326,
-    -21321,
-    -21315,
-    -21310,
-    -21304,
-    -21299,
-    -21293,
     -21288,
-    -21282,
-    -21276,
-    -21271,
-    -21265,
-    -21260,
-    -21254,
-    -21249,
-    -21243,
-    -21238,
-    -21232,
-    -21227,
-    -21221,
-    -21216,
-    -21210,
-    -21205,
     -21199,
-    -21193,
-    -21188,
-    -21182,
-    -21177,
-    -21171,
-    -21166,
-    -21160,
-    -21155,
-    -21149,
-    -21144,
-    -21138,
-    -21133,
-    -21127,
-    -21122,
-    -21116,
     -21111,
-    -21105,
-    -21100,
-    -21094,
-    -21089,
-    -21083,
-    -21078,
-    -21072,
-    -21066,
-    -21061,
-    -21055,
-    -21050,
-    -21044,
-    -21039,
-    -21033,
-    -21028,
     -21022,
-    -21017,
-    -21011,
-    -21006,
-    -21000,
-    -20995,
-    -20989,
-    -20984,
-    -20978,
-    -20973,
-    -20967,
-    -20962,
-    -20956,
-    -20951,
-    -20945,
-    -20940,
     -20934,
-    -20929,
-    -20923,
-    -20918,
-    -20912,
-    -20907,
-    -20901,
-    -20896,
-    -20890,
-    -20885,
-    -20879,
-    -20874,
-    -20868,
-    -20863,
-    -20857,
-    -20852,
     -20846,
-    -20841,
-    -20835,
-    -20830,
-    -20824,
-    -20819,
-    -20813,
-    -20808,
-    -20802,
-    -20797,
-    -20791,
-    -20786,
-    -20780,
-    -20775,
-    -20769,
-    -20764,
     -20758,
-    -20753,
-    -20747,
-    -20742,
-    -20736,
-    -20731,
-    -20725,
-    -20720,
-    -20714,
-    -20709,
-    -20703,
-    -20698,
-    -20692,
-    -20687,
-    -20681,
-    -20676,
     -20670,
-    -20665,
-    -20660,
-    -20654,
-    -20649,
-    -20643,
-    -20638,
-    -20632,
-    -20627,
-    -20621,
-    -20616,
-    -20610,
-    -20605,
-    -20599,
-    -20594,
-    -20588,
     -20583,
-    -20577,
-    -20572,
-    -20566,
-    -20561,
-    -20555,
-    -20550,
-    -20544,
-    -20539,
-    -20534,
-    -20528,
-    -20523,
-    -20517,
-    -20512,
-    -20506,
-    -20501,
     -20495,
-    -20490,
-    -20484,
-    -20479,
-    -20473,
-    -20468,
-    -20462,
-    -20457,
-    -20452,
-    -20446,
-    -20441,
-    -20435,
-    -20430,
-    -20424,
-    -20419,
-    -20413,
     -20408,
-    -20402,
-    -20397,
-    -20391,
-    -20386,
-    -20381,
-    -20375,
-    -20370,
-    -20364,
-    -20359,
-    -20353,
-    -20348,
-    -20342,
-    -20337,
-    -20331,
-    -20326,
     -20320,
-    -20315,
-    -20310,
-    -20304,
-    -20299,
-    -20293,
-    -20288,
-    -20282,
-    -20277,
-    -20271,
-    -20266,
-    -20261,
-    -20255,
-    -20250,
-    -20244,
-    -20239,
     -20233,
-    -20228,
-    -20222,
-    -20217,
-    -20212,
-    -20206,
-    -20201,
-    -20195,
-    -20190,
-    -20184,
-    -20179,
-    -20173,
-    -20168,
-    -20163,
-    -20157,
-    -20152,
     -20146,
-    -20141,
-    -20135,
-    -20130,
-    -20124,
-    -20119,
-    -20114,
-    -20108,
-    -20103,
-    -20097,
-    -20092,
-    -20086,
-    -20081,
-    -20076,
-    -20070,
-    -20065,
     -20059,
-    -20054,
-    -20048,
-    -20043,
-    -20037,
-    -20032,
-    -20027,
-    -20021,
-    -20016,
-    -20010,
-    -20005,
-    -19999,
-    -19994,
-    -19989,
-    -19983,
-    -19978,
     -19972,
-    -19967,
-    -19962,
-    -19956,
-    -19951,
-    -19945,
-    -19940,
-    -19934,
-    -19929,
-    -19924,
-    -19918,
-    -19913,
-    -19907,
-    -19902,
-    -19896,
-    -19891,
     -19886,
-    -19880,
-    -19875,
-    -19869,
-    -19864,
-    -19859,
-    -19853,
-    -19848,
-    -19842,
-    -19837,
-    -19831,
-    -19826,
-    -19821,
-    -19815,
-    -19810,
-    -19804,
     -19799,
-    -19794,
-    -19788,
-    -19783,
-    -19777,
-    -19772,
-    -19767,
-    -19761,
-    -19756,
-    -19750,
-    -19745,
-    -19739,
-    -19734,
-    -19729,
-    -19723,
-    -19718,
     -19712,
-    -19707,
-    -19702,
-    -19696,
-    -19691,
-    -19685,
-    -19680,
-    -19675,
-    -19669,
-    -19664,
-    -19658,
-    -19653,
-    -19648,
-    -19642,
-    -19637,
-    -19631,
     -19626,
-    -19621,
-    -19615,
-    -19610,
-    -19604,
-    -19599,
-    -19594,
-    -19588,
-    -19583,
-    -19578,
-    -19572,
-    -19567,
-    -19561,
-    -19556,
-    -19551,
-    -19545,
     -19540,
-    -19534,
-    -19529,
-    -19524,
-    -19518,
-    -19513,
-    -19507,
-    -19502,
-    -19497,
-    -19491,
-    -19486,
-    -19481,
-    -19475,
-    -19470,
-    -19464,
-    -19459,
     -19454,
-    -19448,
-    -19443,
-    -19437,
-    -19432,
-    -19427,
-    -19421,
-    -19416,
-    -19411,
-    -19405,
-    -19400,
-    -19394,
-    -19389,
-    -19384,
-    -19378,
-    -19373,
     -19368,
-    -19362,
-    -19357,
-    -19351,
-    -19346,
-    -19341,
-    -19335,
-    -19330,
-    -19325,
-    -19319,
-    -19314,
-    -19308,
-    -19303,
-    -19298,
-    -19292,
-    -19287,
     -19282,
-    -19276,
-    -19271,
-    -19265,
-    -19260,
-    -19255,
-    -19249,
-    -19244,
-    -19239,
-    -19233,
-    -19228,
-    -19223,
-    -19217,
-    -19212,
-    -19206,
-    -19201,
     -19196,
-    -19190,
-    -19185,
-    -19180,
-    -19174,
-    -19169,
-    -19164,
-    -19158,
-    -19153,
-    -19148,
-    -19142,
-    -19137,
-    -19131,
-    -19126,
-    -19121,
-    -19115,
     -19110,
-    -19105,
-    -19099,
-    -19094,
-    -19089,
-    -19083,
-    -19078,
-    -19073,
-    -19067,
-    -19062,
-    -19057,
-    -19051,
-    -19046,
-    -19040,
-    -19035,
-    -19030,
     -19024,
-    -19019,
-    -19014,
-    -19008,
-    -19003,
-    -18998,
-    -18992,
-    -18987,
-    -18982,
-    -18976,
-    -18971,
-    -18966,
-    -18960,
-    -18955,
-    -18950,
-    -18944,
     -18939,
-    -18934,
-    -18928,
-    -18923,
-    -18918,
-    -18912,
-    -18907,
-    -18902,
-    -18896,
-    -18891,
-    -18886,
-    -18880,
-    -18875,
-    -18870,
-    -18864,
-    -18859,
     -18854,
-    -18848,
-    -18843,
-    -18838,
-    -18832,
-    -18827,
-    -18822,
-    -18816,
-    -18811,
-    -18806,
-    -18800,
-    -18795,
-    -18790,
-    -18784,
-    -18779,
-    -18774,
     -18768,
-    -18763,
-    -18758,
-    -18752,
-    -18747,
-    -18742,
-    -18736,
-    -18731,
-    -18726,
-    -18720,
-    -18715,
-    -18710,
-    -18704,
-    -18699,
-    -18694,
-    -18688,
     -18683,
-    -18678,
-    -18672,
-    -18667,
-    -18662,
-    -18656,
-    -18651,
-    -18646,
-    -18641,
-    -18635,
-    -18630,
-    -18625,
-    -18619,
-    -18614,
-    -18609,
-    -18603,
     -18598,
-    -18593,
-    -18587,
-    -18582,
-    -18577,
-    -18571,
-    -18566,
-    -18561,
-    -18556,
-    -18550,
-    -18545,
-    -18540,
-    -18534,
-    -18529,
-    -18524,
-    -18518,
     -18513,
-    -18508,
-    -18502,
-    -18497,
-    -18492,
-    -18487,
-    -18481,
-    -18476,
-    -18471,
-    -18465,
-    -18460,
-    -18455,
-    -18449,
-    -18444,
-    -18439,
-    -18434,
     -18428,
-    -18423,
-    -18418,
-    -18412,
-    -18407,
-    -18402,
-    -18396,
-    -18391,
-    -18386,
-    -18381,
-    -18375,
-    -18370,
-    -18365,
-    -18359,
-    -18354,
-    -18349,
     -18344,
-    -18338,
-    -18333,
-    -18328,
-    -18322,
-    -18317,
-    -18312,
-    -18306,
-    -18301,
-    -18296,
-    -18291,
-    -18285,
-    -18280,
-    -18275,
-    -18269,
-    -18264,
     -18259,
-    -18254,
-    -18248,
-    -18243,
-    -18238,
-    -18232,
-    -18227,
-    -18222,
-    -18217,
-    -18211,
-    -18206,
-    -18201,
-    -18196,
-    -18190,
-    -18185,
-    -18180,
     -18174,
-    -18169,
-    -18164,
-    -18159,
-    -18153,
-    -18148,
-    -18143,
-    -18137,
-    -18132,
-    -18127,
-    -18122,
-    -18116,
-    -18111,
-    -18106,
-    -18101,
-    -18095,
     -18090,
-    -18085,
-    -18079,
-    -18074,
-    -18069,
-    -18064,
-    -18058,
-    -18053,
-    -18048,
-    -18043,
-    -18037,
-    -18032,
-    -18027,
-    -18022,
-    -18016,
-    -18011,
     -18006,
-    -18000,
-    -17995,
-    -17990,
-    -17985,
-    -17979,
-    -17974,
-    -17969,
-    -17964,
-    -17958,
-    -17953,
-    -17948,
-    -17943,
-    -17937,
-    -17932,
-    -17927,
     -17922,
-    -17916,
-    -17911,
-    -17906,
-    -17900,
-    -17895,
-    -17890,
-    -17885,
-    -17879,
-    -17874,
-    -17869,
-    -17864,
-    -17858,
-    -17853,
-    -17848,
-    -17843,
     -17837,
-    -17832,
-    -17827,
-    -17822,
-    -17816,
-    -17811,
-    -17806,
-    -17801,
-    -17795,
-    -17790,
-    -17785,
-    -17780,
-    -17774,
-    -17769,
-    -17764,
-    -17759,
     -17753,
-    -17748,
-    -17743,
-    -17738,
-    -17733,
-    -17727,
-    -17722,
-    -17717,
-    -17712,
-    -17706,
-    -17701,
-    -17696,
-    -17691,
-    -17685,
-    -17680,
-    -17675,
     -17670,
-    -17664,
-    -17659,
-    -17654,
-    -17649,
-    -17643,
-    -17638,
-    -17633,
-    -17628,
-    -17623,
-    -17617,
-    -17612,
-    -17607,
-    -17602,
-    -17596,
-    -17591,
     -17586,
-    -17581,
-    -17575,
-    -17570,
-    -17565,
-    -17560,
-    -17554,
-    -17549,
-    -17544,
-    -17539,
-    -17534,
-    -17528,
-    -17523,
-    -17518,
-    -17513,
-    -17507,
     -17502,
-    -17497,
-    -17492,
-    -17487,
-    -17481,
-    -17476,
-    -17471,
-    -17466,
-    -17460,
-    -17455,
-    -17450,
-    -17445,
-    -17440,
-    -17434,
-    -17429,
-    -17424,
     -17419,
-    -17413,
-    -17408,
-    -17403,
-    -17398,
-    -17393,
-    -17387,
-    -17382,
-    -17377,
-    -17372,
-    -17367,
-    -17361,
-    -17356,
-    -17351,
-    -17346,
-    -17340,
     -17335,
-    -17330,
-    -17325,
-    -17320,
-    -17314,
-    -17309,
-    -17304,
-    -17299,
-    -17294,
-    -17288,
-    -17283,
-    -17278,
-    -17273,
-    -17268,
-    -17262,
-    -17257,
     -17252,
-    -17247,
-    -17242,
-    -17236,
-    -17231,
-    -17226,
-    -17221,
-    -17216,
-    -17210,
-    -17205,
-    -17200,
-    -17195,
-    -17190,
-    -17184,
-    -17179,
-    -17174,
     -17169,
-    -17164,
-    -17158,
-    -17153,
-    -17148,
-    -17143,
-    -17138,
-    -17132,
-    -17127,
-    -17122,
-    -17117,
-    -17112,
-    -17106,
-    -17101,
-    -17096,
-    -17091,
     -17086,
-    -17080,
-    -17075,
-    -17070,
-    -17065,
-    -17060,
-    -17054,
-    -17049,
-    -17044,
-    -17039,
-    -17034,
-    -17029,
-    -17023,
-    -17018,
-    -17013,
-    -17008,
     -17003,
-    -16997,
-    -16992,
-    -16987,
-    -16982,
-    -16977,
-    -16971,
-    -16966,
-    -16961,
-    -16956,
-    -16951,
-    -16946,
-    -16940,
-    -16935,
-    -16930,
-    -16925,
     -16920,
-    -16915,
-    -16909,
-    -16904,
-    -16899,
-    -16894,
-    -16889,
-    -16883,
-    -16878,
-    -16873,
-    -16868,
-    -16863,
-    -16858,
-    -16852,
-    -16847,
-    -16842,
     -16837,
-    -16832,
-    -16827,
-    -16821,
-    -16816,
-    -16811,
-    -16806,
-    -16801,
-    -16796,
-    -16790,
-    -16785,
-    -16780,
-    -16775,
-    -16770,
-    -16765,
-    -16759,
     -16754,
-    -16749,
-    -16744,
-    -16739,
-    -16734,
-    -16728,
-    -16723,
-    -16718,
-    -16713,
-    -16708,
-    -16703,
-    -16697,
-    -16692,
-    -16687,
-    -16682,
-    -16677,
     -16672,
-    -16666,
-    -16661,
-    -16656,
-    -16651,
-    -16646,
-    -16641,
-    -16635,
-    -16630,
-    -16625,
-    -16620,
-    -16615,
-    -16610,
-    -16605,
-    -16599,
-    -16594,
     -16589,
-    -16584,
-    -16579,
-    -16574,
-    -16569,
-    -16563,
-    -16558,
-    -16553,
-    -16548,
-    -16543,
-    -16538,
-    -16532,
-    -16527,
-    -16522,
-    -16517,
-    -16512,
     -16507,
-    -16502,
-    -16496,
-    -16491,
-    -16486,
-    -16481,
-    -16476,
-    -16471,
-    -16466,
-    -16460,
-    -16455,
-    -16450,
-    -16445,
-    -16440,
-    -16435,
-    -16430,
     -16424,
-    -16419,
-    -16414,
-    -16409,
-    -16404,
-    -16399,
-    -16394,
-    -16388,
-    -16383,
-    -16378,
-    -16373,
-    -16368,
-    -16363,
-    -16358,
-    -16353,
-    -16347,
     -16342,
-    -16337,
-    -16332,
-    -16327,
-    -16322,
-    -16317,
-    -16311,
-    -16306,
-    -16301,
-    -16296,
-    -16291,
-    -16286,
-    -16281,
-    -16276,
-    -16270,
-    -16265,
     -16260,
-    -16255,
-    -16250,
-    -16245,
-    -16240,
-    -16235,
-    -16229,
-    -16224,
-    -16219,
-    -16214,
-    -16209,
-    -16204,
-    -16199,
-    -16194,
-    -16188,
-    -16183,
     -16178,
-    -16173,
-    -16168,
-    -16163,
-    -16158,
-    -16153,
-    -16148,
-    -16142,
-    -16137,
-    -16132,
-    -16127,
-    -16122,
-    -16117,
-    -16112,
-    -16107,
-    -16101,
     -16096,
-    -16091,
-    -16086,
-    -16081,
-    -16076,
-    -16071,
-    -16066,
-    -16061,
-    -16055,
-    -16050,
-    -16045,
-    -16040,
-    -16035,
-    -16030,
-    -16025,
-    -16020,
     -16015,
-    -16009,
-    -16004,
-    -15999,
-    -15994,
-    -15989,
-    -15984,
-    -15979,
-    -15974,
-    -15969,
-    -15964,
-    -15958,
-    -15953,
-    -15948,
-    -15943,
-    -15938,
     -15933,
-    -15928,
-    -15923,
-    -15918,
-    -15913,
-    -15907,
-    -15902,
-    -15897,
-    -15892,
-    -15887,
-    -15882,
-    -15877,
-    -15872,
-    -15867,
-    -15862,
-    -15856,
     -15851,
-    -15846,
-    -15841,
-    -15836,
-    -15831,
-    -15826,
-    -15821,
-    -15816,
-    -15811,
-    -15806,
-    -15800,
-    -15795,
-    -15790,
-    -15785,
-    -15780,
-    -15775,
     -15770,
-    -15765,
-    -15760,
-    -15755,
-    -15750,
-    -15744,
-    -15739,
-    -15734,
-    -15729,
-    -15724,
-    -15719,
-    -15714,
-    -15709,
-    -15704,
-    -15699,
-    -15694,
     -15689,
-    -15683,
-    -15678,
-    -15673,
-    -15668,
-    -15663,
-    -15658,
-    -15653,
-    -15648,
-    -15643,
-    -15638,
-    -15633,
-    -15628,
-    -15623,
-    -15617,
-    -15612,
     -15607,
-    -15602,
-    -15597,
-    -15592,
-    -15587,
-    -15582,
-    -15577,
-    -15572,
-    -15567,
-    -15562,
-    -15557,
-    -15551,
-    -15546,
-    -15541,
-    -15536,
-    -15531,
     -15526,
-    -15521,
-    -15516,
-    -15511,
-    -15506,
-    -15501,
-    -15496,
-    -15491,
-    -15486,
-    -15481,
-    -15475,
-    -15470,
-    -15465,
-    -15460,
-    -15455,
-    -15450,
     -15445,
-    -15440,
-    -15435,
-    -15430,
-    -15425,
-    -15420,
-    -15415,
-    -15410,
-    -15405,
-    -15400,
-    -15394,
-    -15389,
-    -15384,
-    -15379,
-    -15374,
-    -15369,
     -15364,
-    -15359,
-    -15354,
-    -15349,
-    -15344,
-    -15339,
-    -15334,
-    -15329,
-    -15324,
-    -15319,
-    -15314,
-    -15308,
-    -15303,
-    -15298,
-    -15293,
-    -15288,
     -15283,
-    -15278,
-    -15273,
-    -15268,
-    -15263,
-    -15258,
-    -15253,
-    -15248,
-    -15243,
-    -15238,
-    -15233,
-    -15228,
-    -15223,
-    -15218,
-    -15213,
-    -15208,
     -15202,
-    -15197,
-    -15192,
-    -15187,
-    -15182,
-    -15177,
-    -15172,
-    -15167,
-    -15162,
-    -15157,
-    -15152,
-    -15147,
-    -15142,
-    -15137,
-    -15132,
-    -15127,
     -15122,
-    -15117,
-    -15112,
-    -15107,
-    -15102,
-    -15097,
-    -15092,
-    -15087,
-    -15082,
-    -15076,
-    -15071,
-    -15066,
-    -15061,
-    -15056,
-    -15051,
-    -15046,
     -15041,
-    -15036,
-    -15031,
-    -15026,
-    -15021,
-    -15016,
-    -15011,
-    -15006,
-    -15001,
-    -14996,
-    -14991,
-    -14986,
-    -14981,
-    -14976,
-    -14971,
-    -14966,
     -14961,
-    -14956,
-    -14951,
-    -14946,
-    -14941,
-    -14936,
-    -14931,
-    -14926,
-    -14921,
-    -14916,
-    -14911,
-    -14906,
-    -14901,
-    -14895,
-    -14890,
-    -14885,
     -14880,
-    -14875,
-    -14870,
-    -14865,
-    -14860,
-    -14855,
-    -14850,
-    -14845,
-    -14840,
-    -14835,
-    -14830,
-    -14825,
-    -14820,
-    -14815,
-    -14810,
-    -14805,
     -14800,
-    -14795,
-    -14790,
-    -14785,
-    -14780,
-    -14775,
-    -14770,
-    -14765,
-    -14760,
-    -14755,
-    -14750,
-    -14745,
-    -14740,
-    -14735,
-    -14730,
-    -14725,
     -14720,
-    -14715,
-    -14710,
-    -14705,
-    -14700,
-    -14695,
-    -14690,
-    -14685,
-    -14680,
-    -14675,
-    -14670,
-    -14665,
-    -14660,
-    -14655,
-    -14650,
-    -14645,
     -14640,
-    -14635,
-    -14630,
-    -14625,
-    -14620,
-    -14615,
-    -14610,
-    -14605,
-    -14600,
-    -14595,
-    -14590,
-    -14585,
-    -14580,
-    -14575,
-    -14570,
-    -14565,
     -14560,
-    -14555,
-    -14550,
-    -14545,
-    -14540,
-    -14535,
-    -14530,
-    -14525,
-    -14520,
-    -14515,
-    -14510,
-    -14505,
-    -14500,
-    -14495,
-    -14490,
-    -14485,
     -14480,
-    -14475,
-    -14470,
-    -14465,
-    -14460,
-    -14455,
-    -14450,
-    -14445,
-    -14440,
-    -14435,
-    -14430,
-    -14425,
-    -14420,
-    -14415,
-    -14410,
-    -14405,
     -14400,
-    -14395,
-    -14390,
-    -14385,
-    -14380,
-    -14375,
-    -14370,
-    -14365,
-    -14360,
-    -14355,
-    -14351,
-    -14346,
-    -14341,
-    -14336,
-    -14331,
-    -14326,
     -14321,
-    -14316,
-    -14311,
-    -14306,
-    -14301,
-    -14296,
-    -14291,
-    -14286,
-    -14281,
-    -14276,
-    -14271,
-    -14266,
-    -14261,
-    -14256,
-    -14251,
-    -14246,
     -14241,
-    -14236,
-    -14231,
-    -14226,
-    -14221,
-    -14216,
-    -14211,
-    -14206,
-    -14201,
-    -14196,
-    -14191,
-    -14186,
-    -14181,
-    -14176,
-    -14172,
-    -14167,
     -14162,
-    -14157,
-    -14152,
-    -14147,
-    -14142,
-    -14137,
-    -14132,
-    -14127,
-    -14122,
-    -14117,
-    -14112,
-    -14107,
-    -14102,
-    -14097,
-    -14092,
-    -14087,
     -14082,
-    -14077,
-    -14072,
-    -14067,
-    -14062,
-    -14057,
-    -14052,
-    -14047,
-    -14043,
-    -14038,
-    -14033,
-    -14028,
-    -14023,
-    -14018,
-    -14013,
-    -14008,
     -14003,
-    -13998,
-    -13993,
-    -13988,
-    -13983,
-    -13978,
-    -13973,
-    -13968,
-    -13963,
-    -13958,
-    -13953,
-    -13948,
-    -13943,
-    -13939,
-    -13934,
-    -13929,
     -13924,
-    -13919,
-    -13914,
-    -13909,
-    -13904,
-    -13899,
-    -13894,
-    -13889,
-    -13884,
-    -13879,
-    -13874,
-    -13869,
-    -13864,
-    -13859,
-    -13854,
-    -13850,
     -13845,
-    -13840,
-    -13835,
-    -13830,
-    -13825,
-    -13820,
-    -13815,
-    -13810,
-    -13805,
-    -13800,
-    -13795,
-    -13790,
-    -13785,
-    -13780,
-    -13775,
-    -13771,
     -13766,
-    -13761,
-    -13756,
-    -13751,
-    -13746,
-    -13741,
-    -13736,
-    -13731,
-    -13726,
-    -13721,
-    -13716,
-    -13711,
-    -13706,
-    -13701,
-    -13697,
-    -13692,
     -13687,
-    -13682,
-    -13677,
-    -13672,
-    -13667,
-    -13662,
-    -13657,
-    -13652,
-    -13647,
-    -13642,
-    -13637,
-    -13632,
-    -13628,
-    -13623,
-    -13618,
-    -13613,
     -13608,
-    -13603,
-    -13598,
-    -13593,
-    -13588,
-    -13583,
-    -13578,
-    -13573,
-    -13568,
-    -13564,
-    -13559,
-    -13554,
-    -13549,
-    -13544,
-    -13539,
-    -13534,
     -13529,
-    -13524,
-    -13519,
-    -13514,
-    -13509,
-    -13505,
-    -13500,
-    -13495,
-    -13490,
-    -13485,
-    -13480,
-    -13475,
-    -13470,
-    -13465,
-    -13460,
-    -13455,
     -13451,
-    -13446,
-    -13441,
-    -13436,
-    -13431,
-    -13426,
-    -13421,
-    -13416,
-    -13411,
-    -13406,
-    -13401,
-    -13397,
-    -13392,
-    -13387,
-    -13382,
-    -13377,
     -13372,
-    -13367,
-    -13362,
-    -13357,
-    -13352,
-    -13347,
-    -13343,
-    -13338,
-    -13333,
-    -13328,
-    -13323,
-    -13318,
-    -13313,
-    -13308,
-    -13303,
-    -13298,
     -13294,
-    -13289,
-    -13284,
-    -13279,
-    -13274,
-    -13269,
-    -13264,
-    -13259,
-    -13254,
-    -13249,
-    -13245,
-    -13240,
-    -13235,
-    -13230,
-    -13225,
-    -13220,
     -13215,
-    -13210,
-    -13205,
-    -13201,
-    -13196,
-    -13191,
-    -13186,
-    -13181,
-    -13176,
-    -13171,
-    -13166,
-    -13161,
-    -13156,
-    -13152,
-    -13147,
-    -13142,
     -13137,
-    -13132,
-    -13127,
-    -13122,
-    -13117,
-    -13112,
-    -13108,
-    -13103,
-    -13098,
-    -13093,
-    -13088,
-    -13083,
-    -13078,
-    -13073,
-    -13069,
-    -13064,
     -13059,
-    -13054,
-    -13049,
-    -13044,
-    -13039,
-    -13034,
-    -13029,
-    -13025,
-    -13020,
-    -13015,
-    -13010,
-    -13005,
-    -13000,
-    -12995,
-    -12990,
-    -12986,
     -12981,
-    -12976,
-    -12971,
-    -12966,
-    -12961,
-    -12956,
-    -12951,
-    -12947,
-    -12942,
-    -12937,
-    -12932,
-    -12927,
-    -12922,
-    -12917,
-    -12912,
-    -12908,
     -12903,
-    -12898,
-    -12893,
-    -12888,
-    -12883,
-    -12878,
-    -12874,
-    -12869,
-    -12864,
-    -12859,
-    -12854,
-    -12849,
-    -12844,
-    -12839,
-    -12835,
-    -12830,
     -12825,
-    -12820,
-    -12815,
-    -12810,
-    -12805,
-    -12801,
-    -12796,
-    -12791,
-    -12786,
-    -12781,
-    -12776,
-    -12771,
-    -12767,
-    -12762,
-    -12757,
-    -12752,
     -12747,
-    -12742,
-    -12737,
-    -12732,
-    -12728,
-    -12723,
-    -12718,
-    -12713,
-    -12708,
-    -12703,
-    -12698,
-    -12694,
-    -12689,
-    -12684,
-    -12679,
-    -12674,
     -12669,
-    -12665,
-    -12660,
-    -12655,
-    -12650,
-    -12645,
-    -12640,
-    -12635,
-    -12631,
-    -12626,
-    -12621,
-    -12616,
-    -12611,
-    -12606,
-    -12601,
-    -12597,
     -12592,
-    -12587,
-    -12582,
-    -12577,
-    -12572,
-    -12568,
-    -12563,
-    -12558,
-    -12553,
-    -12548,
-    -12543,
-    -12538,
-    -12534,
-    -12529,
-    -12524,
-    -12519,
     -12514,
-    -12509,
-    -12505,
-    -12500,
-    -12495,
-    -12490,
-    -12485,
-    -12480,
-    -12476,
-    -12471,
-    -12466,
-    -12461,
-    -12456,
-    -12451,
-    -12447,
-    -12442,
     -12437,
-    -12432,
-    -12427,
-    -12422,
-    -12417,
-    -12413,
-    -12408,
-    -12403,
-    -12398,
-    -12393,
-    -12388,
-    -12384,
-    -12379,
-    -12374,
-    -12369,
-    -12364,
     -12360,
-    -12355,
-    -12350,
-    -12345,
-    -12340,
-    -12335,
-    -12331,
-    -12326,
-    -12321,
-    -12316,
-    -12311,
-    -12306,
-    -12302,
-    -12297,
-    -12292,
-    -12287,
     -12282,
-    -12277,
-    -12273,
-    -12268,
-    -12263,
-    -12258,
-    -12253,
-    -12249,
-    -12244,
-    -12239,
-    -12234,
-    -12229,
-    -12224,
-    -12220,
-    -12215,
-    -12210,
     -12205,
-    -12200,
-    -12195,
-    -12191,
-    -12186,
-    -12181,
-    -12176,
-    -12171,
-    -12167,
-    -12162,
-    -12157,
-    -12152,
-    -12147,
-    -12143,
-    -12138,
-    -12133,
     -12128,
-    -12123,
-    -12118,
-    -12114,
-    -12109,
-    -12104,
-    -12099,
-    -12094,
-    -12090,
-    -12085,
-    -12080,
-    -12075,
-    -12070,
-    -12066,
-    -12061,
-    -12056,
     -12051,
-    -12046,
-    -12041,
-    -12037,
-    -12032,
-    -12027,
-    -12022,
-    -12017,
-    -12013,
-    -12008,
-    -12003,
-    -11998,
-    -11993,
-    -11989,
-    -11984,
-    -11979,
     -11974,
-    -11969,
-    -11965,
-    -11960,
-    -11955,
-    -11950,
-    -11945,
-    -11941,
-    -11936,
-    -11931,
-    -11926,
-    -11921,
-    -11917,
-    -11912,
-    -11907,
-    -11902,
     -11897,
-    -11893,
-    -11888,
-    -11883,
-    -11878,
-    -11873,
-    -11869,
-    -11864,
-    -11859,
-    -11854,
-    -11850,
-    -11845,
-    -11840,
-    -11835,
-    -11830,
-    -11826,
     -11821,
-    -11816,
-    -11811,
-    -11806,
-    -11802,
-    -11797,
-    -11792,
-    -11787,
-    -11782,
-    -11778,
-    -11773,
-    -11768,
-    -11763,
-    -11759,
-    -11754,
-    -11749,
     -11744,
-    -11739,
-    -11735,
-    -11730,
-    -11725,
-    -11720,
-    -11715,
-    -11711,
-    -11706,
-    -11701,
-    -11696,
-    -11692,
-    -11687,
-    -11682,
-    -11677,
-    -11672,
     -11668,
-    -11663,
-    -11658,
-    -11653,
-    -11649,
-    -11644,
-    -11639,
-    -11634,
-    -11629,
-    -11625,
-    -11620,
-    -11615,
-    -11610,
-    -11606,
-    -11601,
-    -11596,
     -11591,
-    -11586,
-    -11582,
-    -11577,
-    -11572,
-    -11567,
-    -11563,
-    -11558,
-    -11553,
-    -11548,
-    -11543,
-    -11539,
-    -11534,
-    -11529,
-    -11524,
-    -11520,
     -11515,
-    -11510,
-    -11505,
-    -11501,
-    -11496,
-    -11491,
-    -11486,
-    -11481,
-    -11477,
-    -11472,
-    -11467,
-    -11462,
-    -11458,
-    -11453,
-    -11448,
-    -11443,
     -11439,
-    -11434,
-    -11429,
-    -11424,
-    -11420,
-    -11415,
-    -11410,
-    -11405,
-    -11401,
-    -11396,
-    -11391,
-    -11386,
-    -11381,
-    -11377,
-    -11372,
-    -11367,
     -11362,
-    -11358,
-    -11353,
-    -11348,
-    -11343,
-    -11339,
-    -11334,
-    -11329,
-    -11324,
-    -11320,
-    -11315,
-    -11310,
-    -11305,
-    -11301,
-    -11296,
-    -11291,
     -11286,
-    -11282,
-    -11277,
-    -11272,
-    -11267,
-    -11263,
-    -11258,
-    -11253,
-    -11248,
-    -11244,
-    -11239,
-    -11234,
-    -11229,
-    -11225,
-    -11220,
-    -11215,
     -11210,
-    -11206,
-    -11201,
-    -11196,
-    -11191,
-    -11187,
-    -11182,
-    -11177,
-    -11172,
-    -11168,
-    -11163,
-    -11158,
-    -11153,
-    -11149,
-    -11144,
-    -11139,
     -11135,
-    -11130,
-    -11125,
-    -11120,
-    -11116,
-    -11111,
-    -11106,
-    -11101,
-    -11097,
-    -11092,
-    -11087,
-    -11082,
-    -11078,
-    -11073,
-    -11068,
-    -11063,
     -11059,
-    -11054,
-    -11049,
-    -11044,
-    -11040,
-    -11035,
-    -11030,
-    -11026,
-    -11021,
-    -11016,
-    -11011,
-    -11007,
-    -11002,
-    -10997,
-    -10992,
-    -10988,
     -10983,
-    -10978,
-    -10974,
-    -10969,
-    -10964,
-    -10959,
-    -10955,
-    -10950,
-    -10945,
-    -10940,
-    -10936,
-    -10931,
-    -10926,
-    -10922,
-    -10917,
-    -10912,
     -10907,
-    -10903,
-    -10898,
-    -10893,
-    -10888,
-    -10884,
-    -10879,
-    -10874,
-    -10870,
-    -10865,
-    -10860,
-    -10855,
-    -10851,
-    -10846,
-    -10841,
-    -10837,
     -10832,
-    -10827,
-    -10822,
-    -10818,
-    -10813,
-    -10808,
-    -10803,
-    -10799,
-    -10794,
-    -10789,
-    -10785,
-    -10780,
-    -10775,
-    -10770,
-    -10766,
-    -10761,
     -10756,
-    -10752,
-    -10747,
-    -10742,
-    -10737,
-    -10733,
-    -10728,
-    -10723,
-    -10719,
-    -10714,
-    -10709,
-    -10705,
-    -10700,
-    -10695,
-    -10690,
-    -10686,
     -10681,
-    -10676,
-    -10672,
-    -10667,
-    -10662,
-    -10657,
-    -10653,
-    -10648,
-    -10643,
-    -10639,
-    -10634,
-    -10629,
-    -10624,
-    -10620,
-    -10615,
-    -10610,
     -10606,
-    -10601,
-    -10596,
-    -10592,
-    -10587,
-    -10582,
-    -10577,
-    -10573,
-    -10568,
-    -10563,
-    -10559,
-    -10554,
-    -10549,
-    -10545,
-    -10540,
-    -10535,
     -10530,
-    -10526,
-    -10521,
-    -10516,
-    -10512,
-    -10507,
-    -10502,
-    -10498,
-    -10493,
-    -10488,
-    -10484,
-    -10479,
-    -10474,
-    -10469,
-    -10465,
-    -10460,
     -10455,
-    -10451,
-    -10446,
-    -10441,
-    -10437,
-    -10432,
-    -10427,
-    -10423,
-    -10418,
-    -10413,
-    -10408,
-    -10404,
-    -10399,
-    -10394,
-    -10390,
-    -10385,
     -10380,
-    -10376,
-    -10371,
-    -10366,
-    -10362,
-    -10357,
-    -10352,
-    -10348,
-    -10343,
-    -10338,
-    -10333,
-    -10329,
-    -10324,
-    -10319,
-    -10315,
-    -10310,
     -10305,
-    -10301,
-    -10296,
-    -10291,
-    -10287,
-    -10282,
-    -10277,
-    -10273,
-    -10268,
-    -10263,
-    -10259,
-    -10254,
-    -10249,
-    -10245,
-    -10240,
-    -10235,
     -10231,
-    -10226,
-    -10221,
-    -10217,
-    -10212,
-    -10207,
-    -10202,
-    -10198,
-    -10193,
-    -10188,
-    -10184,
-    -10179,
-    -10174,
-    -10170,
-    -10165,
-    -10160,
     -10156,
-    -10151,
-    -10146,
-    -10142,
-    -10137,
-    -10132,
-    -10128,
-    -10123,
-    -10118,
-    -10114,
-    -10109,
-    -10104,
-    -10100,
-    -10095,
-    -10090,
-    -10086,
     -10081,
-    -10076,
-    -10072,
-    -10067,
-    -10062,
-    -10058,
-    -10053,
-    -10048,
-    -10044,
-    -10039,
-    -10034,
-    -10030,
-    -10025,
-    -10020,
-    -10016,
-    -10011,
     -10006,
-    -10002,
-    -9997,
-    -9993,
-    -9988,
-    -9983,
-    -9979,
-    -9974,
-    -9969,
-    -9965,
-    -9960,
-    -9955,
-    -9951,
-    -9946,
-    -9941,
-    -9937,
     -9932,
-    -9927,
-    -9923,
-    -9918,
-    -9913,
-    -9909,
-    -9904,
-    -9899,
-    -9895,
-    -9890,
-    -9885,
-    -9881,
-    -9876,
-    -9871,
-    -9867,
-    -9862,
     -9858,
-    -9853,
-    -9848,
-    -9844,
-    -9839,
-    -9834,
-    -9830,
-    -9825,
-    -9820,
-    -9816,
-    -9811,
-    -9806,
-    -9802,
-    -9797,
-    -9792,
-    -9788,
     -9783,
-    -9779,
-    -9774,
-    -9769,
-    -9765,
-    -9760,
-    -9755,
-    -9751,
-    -9746,
-    -9741,
-    -9737,
-    -9732,
-    -9727,
-    -9723,
-    -9718,
-    -9714,
     -9709,
-    -9704,
-    -9700,
-    -9695,
-    -9690,
-    -9686,
-    -9681,
-    -9676,
-    -9672,
-    -9667,
-    -9663,
-    -9658,
-    -9653,
-    -9649,
-    -9644,
-    -9639,
     -9635,
-    -9630,
-    -9625,
-    -9621,
-    -9616,
-    -9612,
-    -9607,
-    -9602,
-    -9598,
-    -9593,
-    -9588,
-    -9584,
-    -9579,
-    -9575,
-    -9570,
-    -9565,
     -9561,
-    -9556,
-    -9551,
-    -9547,
-    -9542,
-    -9538,
-    -9533,
-    -9528,
-    -9524,
-    -9519,
-    -9514,
-    -9510,
-    -9505,
-    -9501,
-    -9496,
-    -9491,
     -9487,
-    -9482,
-    -9477,
-    -9473,
-    -9468,
-    -9464,
-    -9459,
-    -9454,
-    -9450,
-    -9445,
-    -9440,
-    -9436,
-    -9431,
-    -9427,
-    -9422,
-    -9417,
     -9413,
-    -9408,
-    -9403,
-    -9399,
-    -9394,
-    -9390,
-    -9385,
-    -9380,
-    -9376,
-    -9371,
-    -9367,
-    -9362,
-    -9357,
-    -9353,
-    -9348,
-    -9343,
     -9339,
-    -9334,
-    -9330,
-    -9325,
-    -9320,
-    -9316,
-    -9311,
-    -9307,
-    -9302,
-    -9297,
-    -9293,
-    -9288,
-    -9284,
-    -9279,
-    -9274,
-    -9270,
     -9265,
-    -9261,
-    -9256,
-    -9251,
-    -9247,
-    -9242,
-    -9237,
-    -9233,
-    -9228,
-    -9224,
-    -9219,
-    -9214,
-    -9210,
-    -9205,
-    -9201,
-    -9196,
     -9191,
-    -9187,
-    -9182,
-    -9178,
-    -9173,
-    -9168,
-    -9164,
-    -9159,
-    -9155,
-    -9150,
-    -9145,
-    -9141,
-    -9136,
-    -9132,
-    -9127,
-    -9122,
     -9118,
-    -9113,
-    -9109,
-    -9104,
-    -9099,
-    -9095,
-    -9090,
-    -9086,
-    -9081,
-    -9076,
-    -9072,
-    -9067,
-    -9063,
-    -9058,
-    -9054,
-    -9049,
     -9044,
-    -9040,
-    -9035,
-    -9031,
-    -9026,
-    -9021,
-    -9017,
-    -9012,
-    -9008,
-    -9003,
-    -8998,
-    -8994,
-    -8989,
-    -8985,
-    -8980,
-    -8975,
     -8971,
-    -8966,
-    -8962,
-    -8957,
-    -8953,
-    -8948,
-    -8943,
-    -8939,
-    -8934,
-    -8930,
-    -8925,
-    -8920,
-    -8916,
-    -8911,
-    -8907,
-    -8902,
     -8898,
-    -8893,
-    -8888,
-    -8884,
-    -8879,
-    -8875,
-    -8870,
-    -8865,
-    -8861,
-    -8856,
-    -8852,
-    -8847,
-    -8843,
-    -8838,
-    -8833,
-    -8829,
     -8824,
-    -8820,
-    -8815,
-    -8811,
-    -8806,
-    -8801,
-    -8797,
-    -8792,
-    -8788,
-    -8783,
-    -8779,
-    -8774,
-    -8769,
-    -8765,
-    -8760,
-    -8756,
     -8751,
-    -8747,
-    -8742,
-    -8737,
-    -8733,
-    -8728,
-    -8724,
-    -8719,
-    -8715,
-    -8710,
-    -8705,
-    -8701,
-    -8696,
-    -8692,
-    -8687,
-    -8683,
     -8678,
-    -8673,
-    -8669,
-    -8664,
-    -8660,
-    -8655,
-    -8651,
-    -8646,
-    -8641,
-    -8637,
-    -8632,
-    -8628,
-    -8623,
-    -8619,
-    -8614,
-    -8610,
     -8605,
-    -8600,
-    -8596,
-    -8591,
-    -8587,
-    -8582,
-    -8578,
-    -8573,
-    -8569,
-    -8564,
-    -8559,
-    -8555,
-    -8550,
-    -8546,
-    -8541,
-    -8537,
     -8532,
-    -8527,
-    -8523,
-    -8518,
-    -8514,
-    -8509,
-    -8505,
-    -8500,
-    -8496,
-    -8491,
-    -8487,
-    -8482,
-    -8477,
-    -8473,
-    -8468,
-    -8464,
     -8459,
-    -8455,
-    -8450,
-    -8446,
-    -8441,
-    -8436,
-    -8432,
-    -8427,
-    -8423,
-    -8418,
-    -8414,
-    -8409,
-    -8405,
-    -8400,
-    -8396,
-    -8391,
     -8386,
-    -8382,
-    -8377,
-    -8373,
-    -8368,
-    -8364,
-    -8359,
-    -8355,
-    -8350,
-    -8346,
-    -8341,
-    -8336,
-    -8332,
-    -8327,
-    -8323,
-    -8318,
     -8314,
-    -8309,
-    -8305,
-    -8300,
-    -8296,
-    -8291,
-    -8286,
-    -8282,
-    -8277,
-    -8273,
-    -8268,
-    -8264,
-    -8259,
-    -8255,
-    -8250,
-    -8246,
     -8241,
-    -8237,
-    -8232,
-    -8227,
-    -8223,
-    -8218,
-    -8214,
-    -8209,
-    -8205,
-    -8200,
-    -8196,
-    -8191,
-    -8187,
-    -8182,
-    -8178,
-    -8173,
     -8169,
-    -8164,
-    -8160,
-    -8155,
-    -8150,
-    -8146,
-    -8141,
-    -8137,
-    -8132,
-    -8128,
-    -8123,
-    -8119,
-    -8114,
-    -8110,
-    -8105,
-    -8101,
     -8096,
-    -8092,
-    -8087,
-    -8083,
-    -8078,
-    -8073,
-    -8069,
-    -8064,
-    -8060,
-    -8055,
-    -8051,
-    -8046,
-    -8042,
-    -8037,
-    -8033,
-    -8028,
     -8024,
-    -8019,
-    -8015,
-    -8010,
-    -8006,
-    -8001,
-    -7997,
-    -7992,
-    -7988,
-    -7983,
-    -7979,
-    -7974,
-    -7970,
-    -7965,
-    -7960,
-    -7956,
     -7951,
-    -7947,
-    -7942,
-    -7938,
-    -7933,
-    -7929,
-    -7924,
-    -7920,
-    -7915,
-    -7911,
-    -7906,
-    -7902,
-    -7897,
-    -7893,
-    -7888,
-    -7884,
     -7879,
-    -7875,
-    -7870,
-    -7866,
-    -7861,
-    -7857,
-    -7852,
-    -7848,
-    -7843,
-    -7839,
-    -7834,
-    -7830,
-    -7825,
-    -7821,
-    -7816,
-    -7812,
     -7807,
-    -7803,
-    -7798,
-    -7794,
-    -7789,
-    -7785,
-    -7780,
-    -7776,
-    -7771,
-    -7767,
-    -7762,
-    -7758,
-    -7753,
-    -7749,
-    -7744,
-    -7740,
     -7735,
-    -7731,
-    -7726,
-    -7722,
-    -7717,
-    -7713,
-    -7708,
-    -7704,
-    -7699,
-    -7695,
-    -7690,
-    -7686,
-    -7681,
-    -7677,
-    -7672,
-    -7668,
     -7663,
-    -7659,
-    -7654,
-    -7650,
-    -7645,
-    -7641,
-    -7636,
-    -7632,
-    -7627,
-    -7623,
-    -7618,
-    -7614,
-    -7609,
-    -7605,
-    -7600,
-    -7596,
     -7591,
-    -7587,
-    -7582,
-    -7578,
-    -7573,
-    -7569,
-    -7564,
-    -7560,
-    -7555,
-    -7551,
-    -7546,
-    -7542,
-    -7537,
-    -7533,
-    -7528,
-    -7524,
     -7519,
-    -7515,
-    -7510,
-    -7506,
-    -7501,
-    -7497,
-    -7492,
-    -7488,
-    -7483,
-    -7479,
-    -7474,
-    -7470,
-    -7466,
-    -7461,
-    -7457,
-    -7452,
     -7448,
-    -7443,
-    -7439,
-    -7434,
-    -7430,
-    -7425,
-    -7421,
-    -7416,
-    -7412,
-    -7407,
-    -7403,
-    -7398,
-    -7394,
-    -7389,
-    -7385,
-    -7380,
     -7376,
-    -7371,
-    -7367,
-    -7363,
-    -7358,
-    -7354,
-    -7349,
-    -7345,
-    -7340,
-    -7336,
-    -7331,
-    -7327,
-    -7322,
-    -7318,
-    -7313,
-    -7309,
     -7304,
-    -7300,
-    -7295,
-    -7291,
-    -7286,
-    -7282,
-    -7278,
-    -7273,
-    -7269,
-    -7264,
-    -7260,
-    -7255,
-    -7251,
-    -7246,
-    -7242,
-    -7237,
     -7233,
-    -7228,
-    -7224,
-    -7219,
-    -7215,
-    -7211,
-    -7206,
-    -7202,
-    -7197,
-    -7193,
-    -7188,
-    -7184,
-    -7179,
-    -7175,
-    -7170,
-    -7166,
     -7161,
-    -7157,
-    -7152,
-    -7148,
-    -7144,
-    -7139,
-    -7135,
-    -7130,
-    -7126,
-    -7121,
-    -7117,
-    -7112,
-    -7108,
-    -7103,
-    -7099,
-    -7095,
     -7090,
-    -7086,
-    -7081,
-    -7077,
-    -7072,
-    -7068,
-    -7063,
-    -7059,
-    -7054,
-    -7050,
-    -7046,
-    -7041,
-    -7037,
-    -7032,
-    -7028,
-    -7023,
     -7019,
-    -7014,
-    -7010,
-    -7005,
-    -7001,
-    -6997,
-    -6992,
-    -6988,
-    -6983,
-    -6979,
-    -6974,
-    -6970,
-    -6965,
-    -6961,
-    -6956,
-    -6952,
     -6948,
-    -6943,
-    -6939,
-    -6934,
-    -6930,
-    -6925,
-    -6921,
-    -6916,
-    -6912,
-    -6908,
-    -6903,
-    -6899,
-    -6894,
-    -6890,
-    -6885,
-    -6881,
     -6876,
-    -6872,
-    -6868,
-    -6863,
-    -6859,
-    -6854,
-    -6850,
-    -6845,
-    -6841,
-    -6836,
-    -6832,
-    -6828,
-    -6823,
-    -6819,
-    -6814,
-    -6810,
     -6805,
-    -6801,
-    -6797,
-    -6792,
-    -6788,
-    -6783,
-    -6779,
-    -6774,
-    -6770,
-    -6765,
-    -6761,
-    -6757,
-    -6752,
-    -6748,
-    -6743,
-    -6739,
     -6734,
-    -6730,
-    -6726,
-    -6721,
-    -6717,
-    -6712,
-    -6708,
-    -6703,
-    -6699,
-    -6695,
-    -6690,
-    -6686,
-    -6681,
-    -6677,
-    -6672,
-    -6668,
     -6664,
-    -6659,
-    -6655,
-    -6650,
-    -6646,
-    -6641,
-    -6637,
-    -6633,
-    -6628,
-    -6624,
-    -6619,
-    -6615,
-    -6610,
-    -6606,
-    -6602,
-    -6597,
     -6593,
-    -6588,
-    -6584,
-    -6579,
-    -6575,
-    -6571,
-    -6566,
-    -6562,
-    -6557,
-    -6553,
-    -6549,
-    -6544,
-    -6540,
-    -6535,
-    -6531,
-    -6526,
     -6522,
-    -6518,
-    -6513,
-    -6509,
-    -6504,
-    -6500,
-    -6496,
-    -6491,
-    -6487,
-    -6482,
-    -6478,
-    -6473,
-    -6469,
-    -6465,
-    -6460,
-    -6456,
     -6451,
-    -6447,
-    -6443,
-    -6438,
-    -6434,
-    -6429,
-    -6425,
-    -6420,
-    -6416,
-    -6412,
-    -6407,
-    -6403,
-    -6398,
-    -6394,
-    -6390,
-    -6385,
     -6381,
-    -6376,
-    -6372,
-    -6368,
-    -6363,
-    -6359,
-    -6354,
-    -6350,
-    -6346,
-    -6341,
-    -6337,
-    -6332,
-    -6328,
-    -6323,
-    -6319,
-    -6315,
     -6310,
-    -6306,
-    -6301,
-    -6297,
-    -6293,
-    -6288,
-    -6284,
-    -6279,
-    -6275,
-    -6271,
-    -6266,
-    -6262,
-    -6257,
-    -6253,
-    -6249,
-    -6244,
     -6240,
-    -6235,
-    -6231,
-    -6227,
-    -6222,
-    -6218,
-    -6213,
-    -6209,
-    -6205,
-    -6200,
-    -6196,
-    -6191,
-    -6187,
-    -6183,
-    -6178,
-    -6174,
     -6169,
-    -6165,
-    -6161,
-    -6156,
-    -6152,
-    -6148,
-    -6143,
-    -6139,
-    -6134,
-    -6130,
-    -6126,
-    -6121,
-    -6117,
-    -6112,
-    -6108,
-    -6104,
     -6099,
-    -6095,
-    -6090,
-    -6086,
-    -6082,
-    -6077,
-    -6073,
-    -6068,
-    -6064,
-    -6060,
-    -6055,
-    -6051,
-    -6047,
-    -6042,
-    -6038,
-    -6033,
     -6029,
-    -6025,
-    -6020,
-    -6016,
-    -6011,
-    -6007,
-    -6003,
-    -5998,
-    -5994,
-    -5990,
-    -5985,
-    -5981,
-    -5976,
-    -5972,
-    -5968,
-    -5963,
     -5959,
-    -5954,
-    -5950,
-    -5946,
-    -5941,
-    -5937,
-    -5933,
-    -5928,
-    -5924,
-    -5919,
-    -5915,
-    -5911,
-    -5906,
-    -5902,
-    -5898,
-    -5893,
     -5889,
-    -5884,
-    -5880,
-    -5876,
-    -5871,
-    -5867,
-    -5863,
-    -5858,
-    -5854,
-    -5849,
-    -5845,
-    -5841,
-    -5836,
-    -5832,
-    -5828,
-    -5823,
     -5819,
-    -5814,
-    -5810,
-    -5806,
-    -5801,
-    -5797,
-    -5793,
-    -5788,
-    -5784,
-    -5780,
-    -5775,
-    -5771,
-    -5766,
-    -5762,
-    -5758,
-    -5753,
     -5749,
-    -5745,
-    -5740,
-    -5736,
-    -5731,
-    -5727,
-    -5723,
-    -5718,
-    -5714,
-    -5710,
-    -5705,
-    -5701,
-    -5697,
-    -5692,
-    -5688,
-    -5683,
     -5679,
-    -5675,
-    -5670,
-    -5666,
-    -5662,
-    -5657,
-    -5653,
-    -5649,
-    -5644,
-    -5640,
-    -5636,
-    -5631,
-    -5627,
-    -5622,
-    -5618,
-    -5614,
     -5609,
-    -5605,
-    -5601,
-    -5596,
-    -5592,
-    -5588,
-    -5583,
-    -5579,
-    -5575,
-    -5570,
-    -5566,
-    -5561,
-    -5557,
-    -5553,
-    -5548,
-    -5544,
     -5540,
-    -5535,
-    -5531,
-    -5527,
-    -5522,
-    -5518,
-    -5514,
-    -5509,
-    -5505,
-    -5501,
-    -5496,
-    -5492,
-    -5487,
-    -5483,
-    -5479,
-    -5474,
     -5470,
-    -5466,
-    -5461,
-    -5457,
-    -5453,
-    -5448,
-    -5444,
-    -5440,
-    -5435,
-    -5431,
-    -5427,
-    -5422,
-    -5418,
-    -5414,
-    -5409,
-    -5405,
     -5401,
-    -5396,
-    -5392,
-    -5387,
-    -5383,
-    -5379,
-    -5374,
-    -5370,
-    -5366,
-    -5361,
-    -5357,
-    -5353,
-    -5348,
-    -5344,
-    -5340,
-    -5335,
     -5331,
-    -5327,
-    -5322,
-    -5318,
-    -5314,
-    -5309,
-    -5305,
-    -5301,
-    -5296,
-    -5292,
-    -5288,
-    -5283,
-    -5279,
-    -5275,
-    -5270,
-    -5266,
     -5262,
-    -5257,
-    -5253,
-    -5249,
-    -5244,
-    -5240,
-    -5236,
-    -5231,
-    -5227,
-    -5223,
-    -5218,
-    -5214,
-    -5210,
-    -5205,
-    -5201,
-    -5197,
     -5192,
-    -5188,
-    -5184,
-    -5179,
-    -5175,
-    -5171,
-    -5166,
-    -5162,
-    -5158,
-    -5153,
-    -5149,
-    -5145,
-    -5140,
-    -5136,
-    -5132,
-    -5127,
     -5123,
-    -5119,
-    -5114,
-    -5110,
-    -5106,
-    -5102,
-    -5097,
-    -5093,
-    -5089,
-    -5084,
-    -5080,
-    -5076,
-    -5071,
-    -5067,
-    -5063,
-    -5058,
     -5054,
-    -5050,
-    -5045,
-    -5041,
-    -5037,
-    -5032,
-    -5028,
-    -5024,
-    -5019,
-    -5015,
-    -5011,
-    -5006,
-    -5002,
-    -4998,
-    -4993,
-    -4989,
     -4985,
-    -4981,
-    -4976,
-    -4972,
-    -4968,
-    -4963,
-    -4959,
-    -4955,
-    -4950,
-    -4946,
-    -4942,
-    -4937,
-    -4933,
-    -4929,
-    -4924,
-    -4920,
     -4916,
-    -4912,
-    -4907,
-    -4903,
-    -4899,
-    -4894,
-    -4890,
-    -4886,
-    -4881,
-    -4877,
-    -4873,
-    -4868,
-    -4864,
-    -4860,
-    -4856,
-    -4851,
     -4847,
-    -4843,
-    -4838,
-    -4834,
-    -4830,
-    -4825,
-    -4821,
-    -4817,
-    -4812,
-    -4808,
-    -4804,
-    -4800,
-    -4795,
-    -4791,
-    -4787,
-    -4782,
     -4778,
-    -4774,
-    -4769,
-    -4765,
-    -4761,
-    -4757,
-    -4752,
-    -4748,
-    -4744,
-    -4739,
-    -4735,
-    -4731,
-    -4726,
-    -4722,
-    -4718,
-    -4714,
     -4709,
-    -4705,
-    -4701,
-    -4696,
-    -4692,
-    -4688,
-    -4683,
-    -4679,
-    -4675,
-    -4671,
-    -4666,
-    -4662,
-    -4658,
-    -4653,
-    -4649,
-    -4645,
     -4640,
-    -4636,
-    -4632,
-    -4628,
-    -4623,
-    -4619,
-    -4615,
-    -4610,
-    -4606,
-    -4602,
-    -4598,
-    -4593,
-    -4589,
-    -4585,
-    -4580,
-    -4576,
     -4572,
-    -4568,
-    -4563,
-    -4559,
-    -4555,
-    -4550,
-    -4546,
-    -4542,
-    -4538,
-    -4533,
-    -4529,
-    -4525,
-    -4520,
-    -4516,
-    -4512,
-    -4508,
     -4503,
-    -4499,
-    -4495,
-    -4490,
-    -4486,
-    -4482,
-    -4478,
-    -4473,
-    -4469,
-    -4465,
-    -4460,
-    -4456,
-    -4452,
-    -4448,
-    -4443,
-    -4439,
     -4435,
-    -4430,
-    -4426,
-    -4422,
-    -4418,
-    -4413,
-    -4409,
-    -4405,
-    -4400,
-    -4396,
-    -4392,
-    -4388,
-    -4383,
-    -4379,
-    -4375,
-    -4371,
     -4366,
-    -4362,
-    -4358,
-    -4353,
-    -4349,
-    -4345,
-    -4341,
-    -4336,
-    -4332,
-    -4328,
-    -4324,
-    -4319,
-    -4315,
-    -4311,
-    -4306,
-    -4302,
     -4298,
-    -4294,
-    -4289,
-    -4285,
-    -4281,
-    -4277,
-    -4272,
-    -4268,
-    -4264,
-    -4259,
-    -4255,
-    -4251,
-    -4247,
-    -4242,
-    -4238,
-    -4234,
     -4230,
-    -4225,
-    -4221,
-    -4217,
-    -4213,
-    -4208,
-    -4204,
-    -4200,
-    -4195,
-    -4191,
-    -4187,
-    -4183,
-    -4178,
-    -4174,
-    -4170,
-    -4166,
     -4161,
-    -4157,
-    -4153,
-    -4149,
-    -4144,
-    -4140,
-    -4136,
-    -4132,
-    -4127,
-    -4123,
-    -4119,
-    -4114,
-    -4110,
-    -4106,
-    -4102,
-    -4097,
     -4093,
-    -4089,
-    -4085,
-    -4080,
-    -4076,
-    -4072,
-    -4068,
-    -4063,
-    -4059,
-    -4055,
-    -4051,
-    -4046,
-    -4042,
-    -4038,
-    -4034,
-    -4029,
     -4025,
-    -4021,
-    -4017,
-    -4012,
-    -4008,
-    -4004,
-    -4000,
-    -3995,
-    -3991,
-    -3987,
-    -3983,
-    -3978,
-    -3974,
-    -3970,
-    -3966,
-    -3961,
     -3957,
-    -3953,
-    -3949,
-    -3944,
-    -3940,
-    -3936,
-    -3932,
-    -3927,
-    -3923,
-    -3919,
-    -3915,
-    -3910,
-    -3906,
-    -3902,
-    -3898,
-    -3893,
     -3889,
-    -3885,
-    -3881,
-    -3876,
-    -3872,
-    -3868,
-    -3864,
-    -3859,
-    -3855,
-    -3851,
-    -3847,
-    -3842,
-    -3838,
-    -3834,
-    -3830,
-    -3826,
     -3821,
-    -3817,
-    -3813,
-    -3809,
-    -3804,
-    -3800,
-    -3796,
-    -3792,
-    -3787,
-    -3783,
-    -3779,
-    -3775,
-    -3770,
-    -3766,
-    -3762,
-    -3758,
     -3753,
-    -3749,
-    -3745,
-    -3741,
-    -3737,
-    -3732,
-    -3728,
-    -3724,
-    -3720,
-    -3715,
-    -3711,
-    -3707,
-    -3703,
-    -3698,
-    -3694,
-    -3690,
     -3686,
-    -3681,
-    -3677,
-    -3673,
-    -3669,
-    -3665,
-    -3660,
-    -3656,
-    -3652,
-    -3648,
-    -3643,
-    -3639,
-    -3635,
-    -3631,
-    -3627,
-    -3622,
     -3618,
-    -3614,
-    -3610,
-    -3605,
-    -3601,
-    -3597,
-    -3593,
-    -3588,
-    -3584,
-    -3580,
-    -3576,
-    -3572,
-    -3567,
-    -3563,
-    -3559,
-    -3555,
     -3550,
-    -3546,
-    -3542,
-    -3538,
-    -3534,
-    -3529,
-    -3525,
-    -3521,
-    -3517,
-    -3512,
-    -3508,
-    -3504,
-    -3500,
-    -3496,
-    -3491,
-    -3487,
     -3483,
-    -3479,
-    -3474,
-    -3470,
-    -3466,
-    -3462,
-    -3458,
-    -3453,
-    -3449,
-    -3445,
-    -3441,
-    -3437,
-    -3432,
-    -3428,
-    -3424,
-    -3420,
     -3415,
-    -3411,
-    -3407,
-    -3403,
-    -3399,
-    -3394,
-    -3390,
-    -3386,
-    -3382,
-    -3378,
-    -3373,
-    -3369,
-    -3365,
-    -3361,
-    -3357,
-    -3352,
     -3348,
-    -3344,
-    -3340,
-    -3335,
-    -3331,
-    -3327,
-    -3323,
-    -3319,
-    -3314,
-    -3310,
-    -3306,
-    -3302,
-    -3298,
-    -3293,
-    -3289,
-    -3285,
     -3281,
-    -3277,
-    -3272,
-    -3268,
-    -3264,
-    -3260,
-    -3256,
-    -3251,
-    -3247,
-    -3243,
-    -3239,
-    -3235,
-    -3230,
-    -3226,
-    -3222,
-    -3218,
     -3214,
-    -3209,
-    -3205,
-    -3201,
-    -3197,
-    -3193,
-    -3188,
-    -3184,
-    -3180,
-    -3176,
-    -3172,
-    -3167,
-    -3163,
-    -3159,
-    -3155,
-    -3151,
     -3146,
-    -3142,
-    -3138,
-    -3134,
-    -3130,
-    -3125,
-    -3121,
-    -3117,
-    -3113,
-    -3109,
-    -3104,
-    -3100,
-    -3096,
-    -3092,
-    -3088,
-    -3083,
     -3079,
-    -3075,
-    -3071,
-    -3067,
-    -3062,
-    -3058,
-    -3054,
-    -3050,
-    -3046,
-    -3041,
-    -3037,
-    -3033,
-    -3029,
-    -3025,
-    -3021,
-    -3016,
     -3012,
-    -3008,
-    -3004,
-    -3000,
-    -2995,
-    -2991,
-    -2987,
-    -2983,
-    -2979,
-    -2974,
-    -2970,
-    -2966,
-    -2962,
-    -2958,
-    -2954,
-    -2949,
     -2945,
-    -2941,
-    -2937,
-    -2933,
-    -2928,
-    -2924,
-    -2920,
-    -2916,
-    -2912,
-    -2908,
-    -2903,
-    -2899,
-    -2895,
-    -2891,
-    -2887,
-    -2882,
     -2878,
-    -2874,
-    -2870,
-    -2866,
-    -2862,
-    -2857,
-    -2853,
-    -2849,
-    -2845,
-    -2841,
-    -2837,
-    -2832,
-    -2828,
-    -2824,
-    -2820,
-    -2816,
     -2811,
-    -2807,
-    -2803,
-    -2799,
-    -2795,
-    -2791,
-    -2786,
-    -2782,
-    -2778,
-    -2774,
-    -2770,
-    -2766,
-    -2761,
-    -2757,
-    -2753,
-    -2749,
     -2745,
-    -2741,
-    -2736,
-    -2732,
-    -2728,
-    -2724,
-    -2720,
-    -2715,
-    -2711,
-    -2707,
-    -2703,
-    -2699,
-    -2695,
-    -2690,
-    -2686,
-    -2682,
     -2678,
-    -2674,
-    -2670,
-    -2665,
-    -2661,
-    -2657,
-    -2653,
-    -2649,
-    -2645,
-    -2640,
-    -2636,
-    -2632,
-    -2628,
-    -2624,
-    -2620,
-    -2616,
     -2611,
-    -2607,
-    -2603,
-    -2599,
-    -2595,
-    -2591,
-    -2586,
-    -2582,
-    -2578,
-    -2574,
-    -2570,
-    -2566,
-    -2561,
-    -2557,
-    -2553,
-    -2549,
     -2545,
-    -2541,
-    -2536,
-    -2532,
-    -2528,
-    -2524,
-    -2520,
-    -2516,
-    -2512,
-    -2507,
-    -2503,
-    -2499,
-    -2495,
-    -2491,
-    -2487,
-    -2482,
     -2478,
-    -2474,
-    -2470,
-    -2466,
-    -2462,
-    -2458,
-    -2453,
-    -2449,
-    -2445,
-    -2441,
-    -2437,
-    -2433,
-    -2428,
-    -2424,
-    -2420,
-    -2416,
     -2412,
-    -2408,
-    -2404,
-    -2399,
-    -2395,
-    -2391,
-    -2387,
-    -2383,
-    -2379,
-    -2375,
-    -2370,
-    -2366,
-    -2362,
-    -2358,
-    -2354,
-    -2350,
     -2345,
-    -2341,
-    -2337,
-    -2333,
-    -2329,
-    -2325,
-    -2321,
-    -2316,
-    -2312,
-    -2308,
-    -2304,
-    -2300,
-    -2296,
-    -2292,
-    -2287,
-    -2283,
     -2279,
-    -2275,
-    -2271,
-    -2267,
-    -2263,
-    -2258,
-    -2254,
-    -2250,
-    -2246,
-    -2242,
-    -2238,
-    -2234,
-    -2229,
-    -2225,
-    -2221,
-    -2217,
     -2213,
-    -2209,
-    -2205,
-    -2201,
-    -2196,
-    -2192,
-    -2188,
-    -2184,
-    -2180,
-    -2176,
-    -2172,
-    -2167,
-    -2163,
-    -2159,
-    -2155,
-    -2151,
     -2147,
-    -2143,
-    -2139,
-    -2134,
-    -2130,
-    -2126,
-    -2122,
-    -2118,
-    -2114,
-    -2110,
-    -2105,
-    -2101,
-    -2097,
-    -2093,
-    -2089,
-    -2085,
     -2081,
-    -2077,
-    -2072,
-    -2068,
-    -2064,
-    -2060,
-    -2056,
-    -2052,
-    -2048,
-    -2044,
-    -2039,
-    -2035,
-    -2031,
-    -2027,
-    -2023,
-    -2019,
     -2015,
-    -2011,
-    -2006,
-    -2002,
-    -1998,
-    -1994,
-    -1990,
-    -1986,
-    -1982,
-    -1978,
-    -1973,
-    -1969,
-    -1965,
-    -1961,
-    -1957,
-    -1953,
     -1949,
-    -1945,
-    -1940,
-    -1936,
-    -1932,
-    -1928,
-    -1924,
-    -1920,
-    -1916,
-    -1912,
-    -1907,
-    -1903,
-    -1899,
-    -1895,
-    -1891,
-    -1887,
     -1883,
-    -1879,
-    -1875,
-    -1870,
-    -1866,
-    -1862,
-    -1858,
-    -1854,
-    -1850,
-    -1846,
-    -1842,
-    -1838,
-    -1833,
-    -1829,
-    -1825,
-    -1821,
     -1817,
-    -1813,
-    -1809,
-    -1805,
-    -1801,
-    -1796,
-    -1792,
-    -1788,
-    -1784,
-    -1780,
-    -1776,
-    -1772,
-    -1768,
-    -1764,
-    -1759,
-    -1755,
     -1751,
-    -1747,
-    -1743,
-    -1739,
-    -1735,
-    -1731,
-    -1727,
-    -1722,
-    -1718,
-    -1714,
-    -1710,
-    -1706,
-    -1702,
-    -1698,
-    -1694,
-    -1690,
     -1685,
-    -1681,
-    -1677,
-    -1673,
-    -1669,
-    -1665,
-    -1661,
-    -1657,
-    -1653,
-    -1649,
-    -1644,
-    -1640,
-    -1636,
-    -1632,
-    -1628,
-    -1624,
     -1620,
-    -1616,
-    -1612,
-    -1608,
-    -1603,
-    -1599,
-    -1595,
-    -1591,
-    -1587,
-    -1583,
-    -1579,
-    -1575,
-    -1571,
-    -1567,
-    -1562,
-    -1558,
     -1554,
-    -1550,
-    -1546,
-    -1542,
-    -1538,
-    -1534,
-    -1530,
-    -1526,
-    -1522,
-    -1517,
-    -1513,
-    -1509,
-    -1505,
-    -1501,
-    -1497,
-    -1493,
     -1489,
-    -1485,
-    -1481,
-    -1477,
-    -1472,
-    -1468,
-    -1464,
-    -1460,
-    -1456,
-    -1452,
-    -1448,
-    -1444,
-    -1440,
-    -1436,
-    -1432,
-    -1427,
     -1423,
-    -1419,
-    -1415,
-    -1411,
-    -1407,
-    -1403,
-    -1399,
-    -1395,
-    -1391,
-    -1387,
-    -1382,
-    -1378,
-    -1374,
-    -1370,
-    -1366,
-    -1362,
     -1358,
-    -1354,
-    -1350,
-    -1346,
-    -1342,
-    -1338,
-    -1333,
-    -1329,
-    -1325,
-    -1321,
-    -1317,
-    -1313,
-    -1309,
-    -1305,
-    -1301,
-    -1297,
     -1293,
-    -1289,
-    -1285,
-    -1280,
-    -1276,
-    -1272,
-    -1268,
-    -1264,
-    -1260,
-    -1256,
-    -1252,
-    -1248,
-    -1244,
-    -1240,
-    -1236,
-    -1231,
     -1227,
-    -1223,
-    -1219,
-    -1215,
-    -1211,
-    -1207,
-    -1203,
-    -1199,
-    -1195,
-    -1191,
-    -1187,
-    -1183,
-    -1179,
-    -1174,
-    -1170,
-    -1166,
     -1162,
-    -1158,
-    -1154,
-    -1150,
-    -1146,
-    -1142,
-    -1138,
-    -1134,
-    -1130,
-    -1126,
-    -1122,
-    -1117,
-    -1113,
-    -1109,
-    -1105,
-    -1101,
     -1097,
-    -1093,
-    -1089,
-    -1085,
-    -1081,
-    -1077,
-    -1073,
-    -1069,
-    -1065,
-    -1061,
-    -1056,
-    -1052,
-    -1048,
-    -1044,
-    -1040,
-    -1036,
     -1032,
-    -1028,
-    -1024,
-    -1020,
-    -1016,
-    -1012,
-    -1008,
-    -1004,
-    -1000,
-    -996,
-    -991,
-    -987,
-    -983,
-    -979,
-    -975,
-    -971,
     -967,
-    -963,
-    -959,
-    -955,
-    -951,
-    -947,
-    -943,
-    -939,
-    -935,
-    -931,
-    -927,
-    -922,
-    -918,
-    -914,
-    -910,
-    -906,
     -902,
-    -898,
-    -894,
-    -890,
-    -886,
-    -882,
-    -878,
-    -874,
-    -870,
-    -866,
-    -862,
-    -858,
-    -854,
-    -849,
-    -845,
-    -841,
     -837,
-    -833,
-    -829,
-    -825,
-    -821,
-    -817,
-    -813,
-    -809,
-    -805,
-    -801,
-    -797,
-    -793,
-    -789,
-    -785,
-    -781,
-    -777,
     -773,
-    -768,
-    -764,
-    -760,
-    -756,
-    -752,
-    -748,
-    -744,
-    -740,
-    -736,
-    -732,
-    -728,
-    -724,
-    -720,
-    -716,
-    -712,
     -708,
-    -704,
-    -700,
-    -696,
-    -692,
-    -688,
-    -684,
-    -680,
-    -675,
-    -671,
-    -667,
-    -663,
-    -659,
-    -655,
-    -651,
-    -647,
     -643,
-    -639,
-    -635,
-    -631,
-    -627,
-    -623,
-    -619,
-    -615,
-    -611,
-    -607,
-    -603,
-    -599,
-    -595,
-    -591,
-    -587,
-    -583,
     -579,
-    -575,
-    -570,
-    -566,
-    -562,
-    -558,
-    -554,
-    -550,
-    -546,
-    -542,
-    -538,
-    -534,
-    -530,
-    -526,
-    -522,
-    -518,
     -514,
-    -510,
-    -506,
-    -502,
-    -498,
-    -494,
-    -490,
-    -486,
-    -482,
-    -478,
-    -474,
-    -470,
-    -466,
-    -462,
-    -458,
-    -454,
     -450,
-    -446,
-    -441,
-    -437,
-    -433,
-    -429,
-    -425,
-    -421,
-    -417,
-    -413,
-    -409,
-    -405,
-    -401,
-    -397,
-    -393,
-    -389,
     -385,
-    -381,
-    -377,
-    -373,
-    -369,
-    -365,
-    -361,
-    -357,
-    -353,
-    -349,
-    -345,
-    -341,
-    -337,
-    -333,
-    -329,
-    -325,
     -321,
-    -317,
-    -313,
-    -309,
-    -305,
-    -301,
-    -297,
-    -293,
-    -289,
-    -285,
-    -281,
-    -277,
-    -273,
-    -269,
-    -265,
-    -261,
     -257,
-    -252,
-    -248,
-    -244,
-    -240,
-    -236,
-    -232,
-    -228,
-    -224,
-    -220,
-    -216,
-    -212,
-    -208,
-    -204,
-    -200,
-    -196,
     -192,
-    -188,
-    -184,
-    -180,
-    -176,
-    -172,
-    -168,
-    -164,
-    -160,
-    -156,
-    -152,
-    -148,
-    -144,
-    -140,
-    -136,
-    -132,
     -128,
-    -124,
-    -120,
-    -116,
-    -112,
-    -108,
-    -104,
-    -100,
-    -96,
-    -92,
-    -88,
-    -84,
-    -80,
-    -76,
-    -72,
-    -68,
     -64,
-    -60,
-    -56,
-    -52,
-    -48,
-    -44,
-    -40,
-    -36,
-    -32,
-    -28,
-    -24,
-    -20,
-    -16,
-    -12,
-    -8,
-    -4,
     0
 };
 
 real_32_t faac_table_sqrt[FAAC_SAMPLES+1] = {
     0,
-    512,
-    724,
-    887,
-    1024,
-    1145,
-    1254,
-    1355,
-    1448,
-    1536,
-    1619,
-    1698,
-    1774,
-    1846,
-    1916,
-    1983,
     2048,
-    2111,
-    2172,
-    2232,
-    2290,
-    2346,
-    2401,
-    2455,
-    2508,
-    2560,
-    2611,
-    2660,
-    2709,
-    2757,
-    2804,
-    2851,
     2896,
-    2941,
-    2985,
-    3029,
-    3072,
-    3114,
-    3156,
-    3197,
-    3238,
-    3278,
-    3318,
-    3357,
-    3396,
-    3435,
-    3473,
-    3510,
     3547,
-    3584,
-    3620,
-    3656,
-    3692,
-    3727,
-    3762,
-    3797,
-    3831,
-    3866,
-    3899,
-    3933,
-    3966,
-    3999,
-    4031,
-    4064,
     4096,
-    4128,
-    4160,
-    4191,
-    4222,
-    4253,
-    4284,
-    4314,
-    4344,
-    4375,
-    4404,
-    4434,
-    4464,
-    4493,
-    4522,
-    4551,
     4579,
-    4608,
-    4636,
-    4665,
-    4693,
-    4720,
-    4748,
-    4776,
-    4803,
-    4830,
-    4857,
-    4884,
-    4911,
-    4938,
-    4964,
-    4990,
     5017,
-    5043,
-    5069,
-    5094,
-    5120,
-    5146,
-    5171,
-    5196,
-    5221,
-    5246,
-    5271,
-    5296,
-    5321,
-    5345,
-    5370,
-    5394,
     5418,
-    5443,
-    5467,
-    5491,
-    5514,
-    5538,
-    5562,
-    5585,
-    5609,
-    5632,
-    5655,
-    5678,
-    5701,
-    5724,
-    5747,
-    5770,
     5793,
-    5815,
-    5838,
-    5860,
-    5882,
-    5905,
-    5927,
-    5949,
-    5971,
-    5993,
-    6015,
-    6036,
-    6058,
-    6080,
-    6101,
-    6123,
     6144,
-    6165,
-    6187,
-    6208,
-    6229,
-    6250,
-    6271,
-    6292,
-    6312,
-    6333,
-    6354,
-    6374,
-    6395,
-    6415,
-    6436,
-    6456,
     6476,
-    6497,
-    6517,
-    6537,
-    6557,
-    6577,
-    6597,
-    6616,
-    6636,
-    6656,
-    6676,
-    6695,
-    6715,
-    6734,
-    6754,
-    6773,
     6792,
-    6812,
-    6831,
-    6850,
-    6869,
-    6888,
-    6907,
-    6926,
-    6945,
-    6964,
-    6983,
-    7001,
-    7020,
-    7039,
-    7057,
-    7076,
     7094,
-    7113,
-    7131,
-    7150,
-    7168,
-    7186,
-    7204,
-    7223,
-    7241,
-    7259,
-    7277,
-    7295,
-    7313,
-    7331,
-    7349,
-    7366,
     7384,
-    7402,
-    7420,
-    7437,
-    7455,
-    7472,
-    7490,
-    7507,
-    7525,
-    7542,
-    7560,
-    7577,
-    7594,
-    7611,
-    7629,
-    7646,
     7663,
-    7680,
-    7697,
-    7714,
-    7731,
-    7748,
-    7765,
-    7782,
-    7799,
-    7815,
-    7832,
-    7849,
-    7865,
-    7882,
-    7899,
-    7915,
     7932,
-    7948,
-    7965,
-    7981,
-    7998,
-    8014,
-    8030,
-    8047,
-    8063,
-    8079,
-    8095,
-    8112,
-    8128,
-    8144,
-    8160,
-    8176,
     8192,
-    8208,
-    8224,
-    8240,
-    8256,
-    8272,
-    8287,
-    8303,
-    8319,
-    8335,
-    8350,
-    8366,
-    8382,
-    8397,
-    8413,
-    8429,
     8444,
-    8460,
-    8475,
-    8491,
-    8506,
-    8521,
-    8537,
-    8552,
-    8567,
-    8583,
-    8598,
-    8613,
-    8628,
-    8644,
-    8659,
-    8674,
     8689,
-    8704,
-    8719,
-    8734,
-    8749,
-    8764,
-    8779,
-    8794,
-    8809,
-    8824,
-    8838,
-    8853,
-    8868,
-    8883,
-    8898,
-    8912,
     8927,
-    8942,
-    8956,
-    8971,
-    8986,
-    9000,
-    9015,
-    9029,
-    9044,
-    9058,
-    9073,
-    9087,
-    9102,
-    9116,
-    9130,
-    9145,
     9159,
-    9173,
-    9188,
-    9202,
-    9216,
-    9230,
-    9244,
-    9259,
-    9273,
-    9287,
-    9301,
-    9315,
-    9329,
-    9343,
-    9357,
-    9371,
     9385,
-    9399,
-    9413,
-    9427,
-    9441,
-    9455,
-    9469,
-    9482,
-    9496,
-    9510,
-    9524,
-    9538,
-    9551,
-    9565,
-    9579,
-    9592,
     9606,
-    9620,
-    9633,
-    9647,
-    9660,
-    9674,
-    9687,
-    9701,
-    9715,
-    9728,
-    9741,
-    9755,
-    9768,
-    9782,
-    9795,
-    9809,
     9822,
-    9835,
-    9849,
-    9862,
-    9875,
-    9888,
-    9902,
-    9915,
-    9928,
-    9941,
-    9954,
-    9968,
-    9981,
-    9994,
-    10007,
-    10020,
     10033,
-    10046,
-    10059,
-    10072,
-    10085,
-    10098,
-    10111,
-    10124,
-    10137,
-    10150,
-    10163,
-    10176,
-    10189,
-    10202,
-    10214,
-    10227,
     10240,
-    10253,
-    10266,
-    10278,
-    10291,
-    10304,
-    10317,
-    10329,
-    10342,
-    10355,
-    10367,
-    10380,
-    10392,
-    10405,
-    10418,
-    10430,
     10443,
-    10455,
-    10468,
-    10480,
-    10493,
-    10505,
-    10518,
-    10530,
-    10543,
-    10555,
-    10568,
-    10580,
-    10592,
-    10605,
-    10617,
-    10629,
     10642,
-    10654,
-    10666,
-    10679,
-    10691,
-    10703,
-    10715,
-    10728,
-    10740,
-    10752,
-    10764,
-    10776,
-    10789,
-    10801,
-    10813,
-    10825,
     10837,
-    10849,
-    10861,
-    10873,
-    10885,
-    10897,
-    10909,
-    10921,
-    10933,
-    10945,
-    10957,
-    10969,
-    10981,
-    10993,
-    11005,
-    11017,
     11029,
-    11041,
-    11053,
-    11064,
-    11076,
-    11088,
-    11100,
-    11112,
-    11123,
-    11135,
-    11147,
-    11159,
-    11171,
-    11182,
-    11194,
-    11206,
     11217,
-    11229,
-    11241,
-    11252,
-    11264,
-    11276,
-    11287,
-    11299,
-    11310,
-    11322,
-    11334,
-    11345,
-    11357,
-    11368,
-    11380,
-    11391,
     11403,
-    11414,
-    11426,
-    11437,
-    11449,
-    11460,
-    11472,
-    11483,
-    11494,
-    11506,
-    11517,
-    11529,
-    11540,
-    11551,
-    11563,
-    11574,
     11585,
-    11597,
-    11608,
-    11619,
-    11630,
-    11642,
-    11653,
-    11664,
-    11675,
-    11687,
-    11698,
-    11709,
-    11720,
-    11731,
-    11743,
-    11754,
     11765,
-    11776,
-    11787,
-    11798,
-    11809,
-    11820,
-    11832,
-    11843,
-    11854,
-    11865,
-    11876,
-    11887,
-    11898,
-    11909,
-    11920,
-    11931,
     11942,
-    11953,
-    11964,
-    11975,
-    11986,
-    11997,
-    12007,
-    12018,
-    12029,
-    12040,
-    12051,
-    12062,
-    12073,
-    12084,
-    12094,
-    12105,
     12116,
-    12127,
-    12138,
-    12149,
-    12159,
-    12170,
-    12181,
-    12192,
-    12202,
-    12213,
-    12224,
-    12235,
-    12245,
-    12256,
-    12267,
-    12277,
     12288,
-    12299,
-    12309,
-    12320,
-    12331,
-    12341,
-    12352,
-    12362,
-    12373,
-    12384,
-    12394,
-    12405,
-    12415,
-    12426,
-    12436,
-    12447,
     12457,
-    12468,
-    12479,
-    12489,
-    12500,
-    12510,
-    12520,
-    12531,
-    12541,
-    12552,
-    12562,
-    12573,
-    12583,
-    12594,
-    12604,
-    12614,
     12625,
-    12635,
-    12645,
-    12656,
-    12666,
-    12677,
-    12687,
-    12697,
-    12708,
-    12718,
-    12728,
-    12738,
-    12749,
-    12759,
-    12769,
-    12780,
     12790,
-    12800,
-    12810,
-    12820,
-    12831,
-    12841,
-    12851,
-    12861,
-    12871,
-    12882,
-    12892,
-    12902,
-    12912,
-    12922,
-    12932,
-    12943,
     12953,
-    12963,
-    12973,
-    12983,
-    12993,
-    13003,
-    13013,
-    13023,
-    13033,
-    13043,
-    13053,
-    13064,
-    13074,
-    13084,
-    13094,
-    13104,
     13114,
-    13124,
-    13134,
-    13144,
-    13154,
-    13163,
-    13173,
-    13183,
-    13193,
-    13203,
-    13213,
-    13223,
-    13233,
-    13243,
-    13253,
-    13263,
     13273,
-    13282,
-    13292,
-    13302,
-    13312,
-    13322,
-    13332,
-    13342,
-    13351,
-    13361,
-    13371,
-    13381,
-    13391,
-    13400,
-    13410,
-    13420,
     13430,
-    13439,
-    13449,
-    13459,
-    13469,
-    13478,
-    13488,
-    13498,
-    13507,
-    13517,
-    13527,
-    13537,
-    13546,
-    13556,
-    13566,
-    13575,
     13585,
-    13595,
-    13604,
-    13614,
-    13623,
-    13633,
-    13643,
-    13652,
-    13662,
-    13671,
-    13681,
-    13691,
-    13700,
-    13710,
-    13719,
-    13729,
     13738,
-    13748,
-    13757,
-    13767,
-    13777,
-    13786,
-    13796,
-    13805,
-    13815,
-    13824,
-    13833,
-    13843,
-    13852,
-    13862,
-    13871,
-    13881,
     13890,
-    13900,
-    13909,
-    13918,
-    13928,
-    13937,
-    13947,
-    13956,
-    13965,
-    13975,
-    13984,
-    13994,
-    14003,
-    14012,
-    14022,
-    14031,
     14040,
-    14050,
-    14059,
-    14068,
-    14078,
-    14087,
-    14096,
-    14106,
-    14115,
-    14124,
-    14133,
-    14143,
-    14152,
-    14161,
-    14170,
-    14180,
     14189,
-    14198,
-    14207,
-    14217,
-    14226,
-    14235,
-    14244,
-    14253,
-    14263,
-    14272,
-    14281,
-    14290,
-    14299,
-    14309,
-    14318,
-    14327,
     14336,
-    14345,
-    14354,
-    14363,
-    14373,
-    14382,
-    14391,
-    14400,
-    14409,
-    14418,
-    14427,
-    14436,
-    14445,
-    14454,
-    14463,
-    14472,
     14482,
-    14491,
-    14500,
-    14509,
-    14518,
-    14527,
-    14536,
-    14545,
-    14554,
-    14563,
-    14572,
-    14581,
-    14590,
-    14599,
-    14608,
-    14617,
     14626,
-    14635,
-    14644,
-    14653,
-    14661,
-    14670,
-    14679,
-    14688,
-    14697,
-    14706,
-    14715,
-    14724,
-    14733,
-    14742,
-    14751,
-    14759,
     14768,
-    14777,
-    14786,
-    14795,
-    14804,
-    14813,
-    14821,
-    14830,
-    14839,
-    14848,
-    14857,
-    14866,
-    14874,
-    14883,
-    14892,
-    14901,
     14910,
-    14918,
-    14927,
-    14936,
-    14945,
-    14954,
-    14962,
-    14971,
-    14980,
-    14989,
-    14997,
-    15006,
-    15015,
-    15024,
-    15032,
-    15041,
     15050,
-    15058,
-    15067,
-    15076,
-    15084,
-    15093,
-    15102,
-    15111,
-    15119,
-    15128,
-    15137,
-    15145,
-    15154,
-    15162,
-    15171,
-    15180,
     15188,
-    15197,
-    15206,
-    15214,
-    15223,
-    15231,
-    15240,
-    15249,
-    15257,
-    15266,
-    15274,
-    15283,
-    15292,
-    15300,
-    15309,
-    15317,
     15326,
-    15334,
-    15343,
-    15351,
-    15360,
-    15369,
-    15377,
-    15386,
-    15394,
-    15403,
-    15411,
-    15420,
-    15428,
-    15437,
-    15445,
-    15454,
     15462,
-    15471,
-    15479,
-    15487,
-    15496,
-    15504,
-    15513,
-    15521,
-    15530,
-    15538,
-    15547,
-    15555,
-    15563,
-    15572,
-    15580,
-    15589,
     15597,
-    15606,
-    15614,
-    15622,
-    15631,
-    15639,
-    15647,
-    15656,
-    15664,
-    15673,
-    15681,
-    15689,
-    15698,
-    15706,
-    15714,
-    15723,
     15731,
-    15739,
-    15748,
-    15756,
-    15764,
-    15773,
-    15781,
-    15789,
-    15798,
-    15806,
-    15814,
-    15822,
-    15831,
-    15839,
-    15847,
-    15855,
     15864,
-    15872,
-    15880,
-    15889,
-    15897,
-    15905,
-    15913,
-    15921,
-    15930,
-    15938,
-    15946,
-    15954,
-    15963,
-    15971,
-    15979,
-    15987,
     15995,
-    16004,
-    16012,
-    16020,
-    16028,
-    16036,
-    16044,
-    16053,
-    16061,
-    16069,
-    16077,
-    16085,
-    16093,
-    16102,
-    16110,
-    16118,
     16126,
-    16134,
-    16142,
-    16150,
-    16158,
-    16167,
-    16175,
-    16183,
-    16191,
-    16199,
-    16207,
-    16215,
-    16223,
-    16231,
-    16239,
-    16247,
     16255,
-    16264,
-    16272,
-    16280,
-    16288,
-    16296,
-    16304,
-    16312,
-    16320,
-    16328,
-    16336,
-    16344,
-    16352,
-    16360,
-    16368,
-    16376,
     16384,
-    16392,
-    16400,
-    16408,
-    16416,
-    16424,
-    16432,
-    16440,
-    16448,
-    16456,
-    16464,
-    16472,
-    16480,
-    16488,
-    16496,
-    16504,
     16512,
-    16519,
-    16527,
-    16535,
-    16543,
-    16551,
-    16559,
-    16567,
-    16575,
-    16583,
-    16591,
-    16599,
-    16606,
-    16614,
-    16622,
-    16630,
     16638,
-    16646,
-    16654,
-    16662,
-    16670,
-    16677,
-    16685,
-    16693,
-    16701,
-    16709,
-    16717,
-    16724,
-    16732,
-    16740,
-    16748,
-    16756,
     16764,
-    16771,
-    16779,
-    16787,
-    16795,
-    16803,
-    16810,
-    16818,
-    16826,
-    16834,
-    16842,
-    16849,
-    16857,
-    16865,
-    16873,
-    16880,
     16888,
-    16896,
-    16904,
-    16912,
-    16919,
-    16927,
-    16935,
-    16942,
-    16950,
-    16958,
-    16966,
-    16973,
-    16981,
-    16989,
-    16997,
-    17004,
     17012,
-    17020,
-    17027,
-    17035,
-    17043,
-    17050,
-    17058,
-    17066,
-    17073,
-    17081,
-    17089,
-    17097,
-    17104,
-    17112,
-    17119,
-    17127,
     17135,
-    17142,
-    17150,
-    17158,
-    17165,
-    17173,
-    17181,
-    17188,
-    17196,
-    17204,
-    17211,
-    17219,
-    17226,
-    17234,
-    17242,
-    17249,
     17257,
-    17264,
-    17272,
-    17280,
-    17287,
-    17295,
-    17302,
-    17310,
-    17317,
-    17325,
-    17333,
-    17340,
-    17348,
-    17355,
-    17363,
-    17370,
     17378,
-    17385,
-    17393,
-    17400,
-    17408,
-    17416,
-    17423,
-    17431,
-    17438,
-    17446,
-    17453,
-    17461,
-    17468,
-    17476,
-    17483,
-    17491,
     17498,
-    17506,
-    17513,
-    17521,
-    17528,
-    17536,
-    17543,
-    17550,
-    17558,
-    17565,
-    17573,
-    17580,
-    17588,
-    17595,
-    17603,
-    17610,
     17618,
-    17625,
-    17632,
-    17640,
-    17647,
-    17655,
-    17662,
-    17670,
-    17677,
-    17684,
-    17692,
-    17699,
-    17707,
-    17714,
-    17721,
-    17729,
     17736,
-    17744,
-    17751,
-    17758,
-    17766,
-    17773,
-    17780,
-    17788,
-    17795,
-    17803,
-    17810,
-    17817,
-    17825,
-    17832,
-    17839,
-    17847,
     17854,
-    17861,
-    17869,
-    17876,
-    17883,
-    17891,
-    17898,
-    17905,
-    17913,
-    17920,
-    17927,
-    17935,
-    17942,
-    17949,
-    17957,
-    17964,
     17971,
-    17978,
-    17986,
-    17993,
-    18000,
-    18008,
-    18015,
-    18022,
-    18029,
-    18037,
-    18044,
-    18051,
-    18058,
-    18066,
-    18073,
-    18080,
     18087,
-    18095,
-    18102,
-    18109,
-    18116,
-    18124,
-    18131,
-    18138,
-    18145,
-    18153,
-    18160,
-    18167,
-    18174,
-    18181,
-    18189,
-    18196,
     18203,
-    18210,
-    18217,
-    18225,
-    18232,
-    18239,
-    18246,
-    18253,
-    18261,
-    18268,
-    18275,
-    18282,
-    18289,
-    18296,
-    18304,
-    18311,
     18318,
-    18325,
-    18332,
-    18339,
-    18346,
-    18354,
-    18361,
-    18368,
-    18375,
-    18382,
-    18389,
-    18396,
-    18404,
-    18411,
-    18418,
-    18425,
     18432,
-    18439,
-    18446,
-    18453,
-    18460,
-    18468,
-    18475,
-    18482,
-    18489,
-    18496,
-    18503,
-    18510,
-    18517,
-    18524,
-    18531,
-    18538,
     18545,
-    18552,
-    18560,
-    18567,
-    18574,
-    18581,
-    18588,
-    18595,
-    18602,
-    18609,
-    18616,
-    18623,
-    18630,
-    18637,
-    18644,
-    18651,
     18658,
-    18665,
-    18672,
-    18679,
-    18686,
-    18693,
-    18700,
-    18707,
-    18714,
-    18721,
-    18728,
-    18735,
-    18742,
-    18749,
-    18756,
-    18763,
     18770,
-    18777,
-    18784,
-    18791,
-    18798,
-    18805,
-    18812,
-    18819,
-    18826,
-    18833,
-    18840,
-    18847,
-    18854,
-    18861,
-    18868,
-    18875,
     18882,
-    18889,
-    18896,
-    18902,
-    18909,
-    18916,
-    18923,
-    18930,
-    18937,
-    18944,
-    18951,
-    18958,
-    18965,
-    18972,
-    18979,
-    18985,
     18992,
-    18999,
-    19006,
-    19013,
-    19020,
-    19027,
-    19034,
-    19041,
-    19048,
-    19054,
-    19061,
-    19068,
-    19075,
-    19082,
-    19089,
-    19096,
     19102,
-    19109,
-    19116,
-    19123,
-    19130,
-    19137,
-    19144,
-    19150,
-    19157,
-    19164,
-    19171,
-    19178,
-    19185,
-    19191,
-    19198,
-    19205,
     19212,
-    19219,
-    19226,
-    19232,
-    19239,
-    19246,
-    19253,
-    19260,
-    19266,
-    19273,
-    19280,
-    19287,
-    19294,
-    19300,
-    19307,
-    19314,
     19321,
-    19328,
-    19334,
-    19341,
-    19348,
-    19355,
-    19361,
-    19368,
-    19375,
-    19382,
-    19389,
-    19395,
-    19402,
-    19409,
-    19416,
-    19422,
     19429,
-    19436,
-    19443,
-    19449,
-    19456,
-    19463,
-    19469,
-    19476,
-    19483,
-    19490,
-    19496,
-    19503,
-    19510,
-    19517,
-    19523,
-    19530,
     19537,
-    19543,
-    19550,
-    19557,
-    19563,
-    19570,
-    19577,
-    19584,
-    19590,
-    19597,
-    19604,
-    19610,
-    19617,
-    19624,
-    19630,
-    19637,
     19644,
-    19650,
-    19657,
-    19664,
-    19670,
-    19677,
-    19684,
-    19690,
-    19697,
-    19704,
-    19710,
-    19717,
-    19724,
-    19730,
-    19737,
-    19744,
     19750,
-    19757,
-    19763,
-    19770,
-    19777,
-    19783,
-    19790,
-    19797,
-    19803,
-    19810,
-    19816,
-    19823,
-    19830,
-    19836,
-    19843,
-    19849,
     19856,
-    19863,
-    19869,
-    19876,
-    19882,
-    19889,
-    19896,
-    19902,
-    19909,
-    19915,
-    19922,
-    19929,
-    19935,
-    19942,
-    19948,
-    19955,
     19961,
-    19968,
-    19975,
-    19981,
-    19988,
-    19994,
-    20001,
-    20007,
-    20014,
-    20020,
-    20027,
-    20034,
-    20040,
-    20047,
-    20053,
-    20060,
     20066,
-    20073,
-    20079,
-    20086,
-    20092,
-    20099,
-    20105,
-    20112,
-    20118,
-    20125,
-    20131,
-    20138,
-    20144,
-    20151,
-    20157,
-    20164,
     20170,
-    20177,
-    20183,
-    20190,
-    20196,
-    20203,
-    20209,
-    20216,
-    20222,
-    20229,
-    20235,
-    20242,
-    20248,
-    20255,
-    20261,
-    20268,
     20274,
-    20281,
-    20287,
-    20294,
-    20300,
-    20306,
-    20313,
-    20319,
-    20326,
-    20332,
-    20339,
-    20345,
-    20352,
-    20358,
-    20364,
-    20371,
     20377,
-    20384,
-    20390,
-    20397,
-    20403,
-    20409,
-    20416,
-    20422,
-    20429,
-    20435,
-    20442,
-    20448,
-    20454,
-    20461,
-    20467,
-    20474,
     20480,
-    20486,
-    20493,
-    20499,
-    20506,
-    20512,
-    20518,
-    20525,
-    20531,
-    20538,
-    20544,
-    20550,
-    20557,
-    20563,
-    20569,
-    20576,
     20582,
-    20589,
-    20595,
-    20601,
-    20608,
-    20614,
-    20620,
-    20627,
-    20633,
-    20639,
-    20646,
-    20652,
-    20658,
-    20665,
-    20671,
-    20677,
     20684,
-    20690,
-    20696,
-    20703,
-    20709,
-    20715,
-    20722,
-    20728,
-    20734,
-    20741,
-    20747,
-    20753,
-    20760,
-    20766,
-    20772,
-    20779,
     20785,
-    20791,
-    20798,
-    20804,
-    20810,
-    20816,
-    20823,
-    20829,
-    20835,
-    20842,
-    20848,
-    20854,
-    20860,
-    20867,
-    20873,
-    20879,
     20886,
-    20892,
-    20898,
-    20904,
-    20911,
-    20917,
-    20923,
-    20929,
-    20936,
-    20942,
-    20948,
-    20955,
-    20961,
-    20967,
-    20973,
-    20980,
     20986,
-    20992,
-    20998,
-    21004,
-    21011,
-    21017,
-    21023,
-    21029,
-    21036,
-    21042,
-    21048,
-    21054,
-    21061,
-    21067,
-    21073,
-    21079,
     21085,
-    21092,
-    21098,
-    21104,
-    21110,
-    21117,
-    21123,
-    21129,
-    21135,
-    21141,
-    21148,
-    21154,
-    21160,
-    21166,
-    21172,
-    21178,
     21185,
-    21191,
-    21197,
-    21203,
-    21209,
-    21216,
-    21222,
-    21228,
-    21234,
-    21240,
-    21246,
-    21253,
-    21259,
-    21265,
-    21271,
-    21277,
     21283,
-    21290,
-    21296,
-    21302,
-    21308,
-    21314,
-    21320,
-    21327,
-    21333,
-    21339,
-    21345,
-    21351,
-    21357,
-    21363,
-    21369,
-    21376,
     21382,
-    21388,
-    21394,
-    21400,
-    21406,
-    21412,
-    21418,
-    21425,
-    21431,
-    21437,
-    21443,
-    21449,
-    21455,
-    21461,
-    21467,
-    21474,
     21480,
-    21486,
-    21492,
-    21498,
-    21504,
-    21510,
-    21516,
-    21522,
-    21528,
-    21534,
-    21541,
-    21547,
-    21553,
-    21559,
-    21565,
-    21571,
     21577,
-    21583,
-    21589,
-    21595,
-    21601,
-    21607,
-    21613,
-    21619,
-    21626,
-    21632,
-    21638,
-    21644,
-    21650,
-    21656,
-    21662,
-    21668,
     21674,
-    21680,
-    21686,
-    21692,
-    21698,
-    21704,
-    21710,
-    21716,
-    21722,
-    21728,
-    21734,
-    21740,
-    21746,
-    21752,
-    21758,
-    21765,
     21771,
-    21777,
-    21783,
-    21789,
-    21795,
-    21801,
-    21807,
-    21813,
-    21819,
-    21825,
-    21831,
-    21837,
-    21843,
-    21849,
-    21855,
-    21861,
     21867,
-    21873,
-    21879,
-    21885,
-    21891,
-    21897,
-    21903,
-    21909,
-    21915,
-    21921,
-    21927,
-    21932,
-    21938,
-    21944,
-    21950,
-    21956,
     21962,
-    21968,
-    21974,
-    21980,
-    21986,
-    21992,
-    21998,
-    22004,
-    22010,
-    22016,
-    22022,
-    22028,
-    22034,
-    22040,
-    22046,
-    22052,
     22058,
-    22064,
-    22070,
-    22075,
-    22081,
-    22087,
-    22093,
-    22099,
-    22105,
-    22111,
-    22117,
-    22123,
-    22129,
-    22135,
-    22141,
-    22147,
     22153,
-    22158,
-    22164,
-    22170,
-    22176,
-    22182,
-    22188,
-    22194,
-    22200,
-    22206,
-    22212,
-    22217,
-    22223,
-    22229,
-    22235,
-    22241,
     22247,
-    22253,
-    22259,
-    22265,
-    22271,
-    22276,
-    22282,
-    22288,
-    22294,
-    22300,
-    22306,
-    22312,
-    22318,
-    22323,
-    22329,
-    22335,
     22341,
-    22347,
-    22353,
-    22359,
-    22364,
-    22370,
-    22376,
-    22382,
-    22388,
-    22394,
-    22400,
-    22405,
-    22411,
-    22417,
-    22423,
-    22429,
     22435,
-    22441,
-    22446,
-    22452,
-    22458,
-    22464,
-    22470,
-    22476,
-    22481,
-    22487,
-    22493,
-    22499,
-    22505,
-    22511,
-    22516,
-    22522,
     22528,
-    22534,
-    22540,
-    22545,
-    22551,
-    22557,
-    22563,
-    22569,
-    22574,
-    22580,
-    22586,
-    22592,
-    22598,
-    22604,
-    22609,
-    22615,
     22621,
-    22627,
-    22632,
-    22638,
-    22644,
-    22650,
-    22656,
-    22661,
-    22667,
-    22673,
-    22679,
-    22685,
-    22690,
-    22696,
-    22702,
-    22708,
     22713,
-    22719,
-    22725,
-    22731,
-    22736,
-    22742,
-    22748,
-    22754,
-    22760,
-    22765,
-    22771,
-    22777,
-    22783,
-    22788,
-    22794,
-    22800,
     22806,
-    22811,
-    22817,
-    22823,
-    22829,
-    22834,
-    22840,
-    22846,
-    22851,
-    22857,
-    22863,
-    22869,
-    22874,
-    22880,
-    22886,
-    22892,
     22897,
-    22903,
-    22909,
-    22915,
-    22920,
-    22926,
-    22932,
-    22937,
-    22943,
-    22949,
-    22955,
-    22960,
-    22966,
-    22972,
-    22977,
-    22983,
     22989,
-    22994,
-    23000,
-    23006,
-    23012,
-    23017,
-    23023,
-    23029,
-    23034,
-    23040,
-    23046,
-    23051,
-    23057,
-    23063,
-    23068,
-    23074,
     23080,
-    23085,
-    23091,
-    23097,
-    23102,
-    23108,
-    23114,
-    23120,
-    23125,
-    23131,
-    23137,
-    23142,
-    23148,
-    23153,
-    23159,
-    23165,
     23170,
-    23176,
-    23182,
-    23187,
-    23193,
-    23199,
-    23204,
-    23210,
-    23216,
-    23221,
-    23227,
-    23233,
-    23238,
-    23244,
-    23250,
-    23255,
     23261,
-    23266,
-    23272,
-    23278,
-    23283,
-    23289,
-    23295,
-    23300,
-    23306,
-    23311,
-    23317,
-    23323,
-    23328,
-    23334,
-    23340,
-    23345,
     23351,
-    23356,
-    23362,
-    23368,
-    23373,
-    23379,
-    23384,
-    23390,
-    23396,
-    23401,
-    23407,
-    23412,
-    23418,
-    23424,
-    23429,
-    23435,
     23440,
-    23446,
-    23452,
-    23457,
-    23463,
-    23468,
-    23474,
-    23480,
-    23485,
-    23491,
-    23496,
-    23502,
-    23507,
-    23513,
-    23519,
-    23524,
     23530,
-    23535,
-    23541,
-    23546,
-    23552,
-    23558,
-    23563,
-    23569,
-    23574,
-    23580,
-    23585,
-    23591,
-    23596,
-    23602,
-    23608,
-    23613,
     23619,
-    23624,
-    23630,
-    23635,
-    23641,
-    23646,
-    23652,
-    23658,
-    23663,
-    23669,
-    23674,
-    23680,
-    23685,
-    23691,
-    23696,
-    23702,
     23707,
-    23713,
-    23718,
-    23724,
-    23729,
-    23735,
-    23740,
-    23746,
-    23752,
-    23757,
-    23763,
-    23768,
-    23774,
-    23779,
-    23785,
-    23790,
     23796,
-    23801,
-    23807,
-    23812,
-    23818,
-    23823,
-    23829,
-    23834,
-    23840,
-    23845,
-    23851,
-    23856,
-    23862,
-    23867,
-    23873,
-    23878,
     23884,
-    23889,
-    23895,
-    23900,
-    23906,
-    23911,
-    23916,
-    23922,
-    23927,
-    23933,
-    23938,
-    23944,
-    23949,
-    23955,
-    23960,
-    23966,
     23971,
-    23977,
-    23982,
-    23988,
-    23993,
-    23999,
-    24004,
-    24009,
-    24015,
-    24020,
-    24026,
-    24031,
-    24037,
-    24042,
-    24048,
-    24053,
     24059,
-    24064,
-    24069,
-    24075,
-    24080,
-    24086,
-    24091,
-    24097,
-    24102,
-    24108,
-    24113,
-    24118,
-    24124,
-    24129,
-    24135,
-    24140,
     24146,
-    24151,
-    24156,
-    24162,
-    24167,
-    24173,
-    24178,
-    24184,
-    24189,
-    24194,
-    24200,
-    24205,
-    24211,
-    24216,
-    24221,
-    24227,
     24232,
-    24238,
-    24243,
-    24248,
-    24254,
-    24259,
-    24265,
-    24270,
-    24275,
-    24281,
-    24286,
-    24292,
-    24297,
-    24302,
-    24308,
-    24313,
     24319,
-    24324,
-    24329,
-    24335,
-    24340,
-    24346,
-    24351,
-    24356,
-    24362,
-    24367,
-    24372,
-    24378,
-    24383,
-    24389,
-    24394,
-    24399,
     24405,
-    24410,
-    24415,
-    24421,
-    24426,
-    24432,
-    24437,
-    24442,
-    24448,
-    24453,
-    24458,
-    24464,
-    24469,
-    24474,
-    24480,
-    24485,
     24491,
-    24496,
-    24501,
-    24507,
-    24512,
-    24517,
-    24523,
-    24528,
-    24533,
-    24539,
-    24544,
-    24549,
-    24555,
-    24560,
-    24565,
-    24571,
     24576,
-    24581,
-    24587,
-    24592,
-    24597,
-    24603,
-    24608,
-    24613,
-    24619,
-    24624,
-    24629,
-    24635,
-    24640,
-    24645,
-    24651,
-    24656,
     24661,
-    24667,
-    24672,
-    24677,
-    24682,
-    24688,
-    24693,
-    24698,
-    24704,
-    24709,
-    24714,
-    24720,
-    24725,
-    24730,
-    24735,
-    24741,
     24746,
-    24751,
-    24757,
-    24762,
-    24767,
-    24773,
-    24778,
-    24783,
-    24788,
-    24794,
-    24799,
-    24804,
-    24810,
-    24815,
-    24820,
-    24825,
     24831,
-    24836,
-    24841,
-    24847,
-    24852,
-    24857,
-    24862,
-    24868,
-    24873,
-    24878,
-    24883,
-    24889,
-    24894,
-    24899,
-    24904,
-    24910,
     24915,
-    24920,
-    24926,
-    24931,
-    24936,
-    24941,
-    24947,
-    24952,
-    24957,
-    24962,
-    24968,
-    24973,
-    24978,
-    24983,
-    24989,
-    24994,
     24999,
-    25004,
-    25010,
-    25015,
-    25020,
-    25025,
-    25030,
-    25036,
-    25041,
-    25046,
-    25051,
-    25057,
-    25062,
-    25067,
-    25072,
-    25078,
     25083,
-    25088,
-    25093,
-    25098,
-    25104,
-    25109,
-    25114,
-    25119,
-    25125,
-    25130,
-    25135,
-    25140,
-    25145,
-    25151,
-    25156,
-    25161,
     25166,
-    25171,
-    25177,
-    25182,
-    25187,
-    25192,
-    25197,
-    25203,
-    25208,
-    25213,
-    25218,
-    25223,
-    25229,
-    25234,
-    25239,
-    25244,
     25249,
-    25255,
-    25260,
-    25265,
-    25270,
-    25275,
-    25281,
-    25286,
-    25291,
-    25296,
-    25301,
-    25306,
-    25312,
-    25317,
-    25322,
-    25327,
     25332,
-    25338,
-    25343,
-    25348,
-    25353,
-    25358,
-    25363,
-    25369,
-    25374,
-    25379,
-    25384,
-    25389,
-    25394,
-    25400,
-    25405,
-    25410,
     25415,
-    25420,
-    25425,
-    25430,
-    25436,
-    25441,
-    25446,
-    25451,
-    25456,
-    25461,
-    25467,
-    25472,
-    25477,
-    25482,
-    25487,
-    25492,
     25497,
-    25503,
-    25508,
-    25513,
-    25518,
-    25523,
-    25528,
-    25533,
-    25538,
-    25544,
-    25549,
-    25554,
-    25559,
-    25564,
-    25569,
-    25574,
     25580,
-    25585,
-    25590,
-    25595,
-    25600,
-    25605,
-    25610,
-    25615,
-    25620,
-    25626,
-    25631,
-    25636,
-    25641,
-    25646,
-    25651,
-    25656,
     25661,
-    25666,
-    25672,
-    25677,
-    25682,
-    25687,
-    25692,
-    25697,
-    25702,
-    25707,
-    25712,
-    25717,
-    25723,
-    25728,
-    25733,
-    25738,
     25743,
-    25748,
-    25753,
-    25758,
-    25763,
-    25768,
-    25773,
-    25779,
-    25784,
-    25789,
-    25794,
-    25799,
-    25804,
-    25809,
-    25814,
-    25819,
     25824,
-    25829,
-    25834,
-    25840,
-    25845,
-    25850,
-    25855,
-    25860,
-    25865,
-    25870,
-    25875,
-    25880,
-    25885,
-    25890,
-    25895,
-    25900,
     25905,
-    25910,
-    25915,
-    25921,
-    25926,
-    25931,
-    25936,
-    25941,
-    25946,
-    25951,
-    25956,
-    25961,
-    25966,
-    25971,
-    25976,
-    25981,
     25986,
-    25991,
-    25996,
-    26001,
-    26006,
-    26011,
-    26016,
-    26021,
-    26027,
-    26032,
-    26037,
-    26042,
-    26047,
-    26052,
-    26057,
-    26062,
     26067,
-    26072,
-    26077,
-    26082,
-    26087,
-    26092,
-    26097,
-    26102,
-    26107,
-    26112,
-    26117,
-    26122,
-    26127,
-    26132,
-    26137,
-    26142,
     26147,
-    26152,
-    26157,
-    26162,
-    26167,
-    26172,
-    26177,
-    26182,
-    26187,
-    26192,
-    26197,
-    26202,
-    26207,
-    26212,
-    26217,
-    26222,
     26227,
-    26232,
-    26237,
-    26242,
-    26247,
-    26252,
-    26257,
-    26262,
-    26267,
-    26272,
-    26277,
-    26282,
-    26287,
-    26292,
-    26297,
-    26302,
     26307,
-    26312,
-    26317,
-    26322,
-    26327,
-    26332,
-    26337,
-    26342,
-    26347,
-    26352,
-    26357,
-    26362,
-    26367,
-    26372,
-    26377,
-    26382,
     26387,
-    26392,
-    26397,
-    26402,
-    26406,
-    26411,
-    26416,
-    26421,
-    26426,
-    26431,
-    26436,
-    26441,
-    26446,
-    26451,
-    26456,
-    26461,
     26466,
-    26471,
-    26476,
-    26481,
-    26486,
-    26491,
-    26496,
-    26501,
-    26506,
-    26511,
-    26515,
-    26520,
-    26525,
-    26530,
-    26535,
-    26540,
     26545,
-    26550,
-    26555,
-    26560,
-    26565,
-    26570,
-    26575,
-    26580,
-    26585,
-    26590,
-    26594,
-    26599,
-    26604,
-    26609,
-    26614,
-    26619,
     26624,
-    26629,
-    26634,
-    26639,
-    26644,
-    26649,
-    26654,
-    26658,
-    26663,
-    26668,
-    26673,
-    26678,
-    26683,
-    26688,
-    26693,
-    26698,
     26703,
-    26708,
-    26712,
-    26717,
-    26722,
-    26727,
-    26732,
-    26737,
-    26742,
-    26747,
-    26752,
-    26757,
-    26761,
-    26766,
-    26771,
-    26776,
     26781,
-    26786,
-    26791,
-    26796,
-    26801,
-    26806,
-    26810,
-    26815,
-    26820,
-    26825,
-    26830,
-    26835,
-    26840,
-    26845,
-    26850,
-    26854,
     26859,
-    26864,
-    26869,
-    26874,
-    26879,
-    26884,
-    26889,
-    26893,
-    26898,
-    26903,
-    26908,
-    26913,
-    26918,
-    26923,
-    26928,
-    26932,
     26937,
-    26942,
-    26947,
-    26952,
-    26957,
-    26962,
-    26966,
-    26971,
-    26976,
-    26981,
-    26986,
-    26991,
-    26996,
-    27000,
-    27005,
-    27010,
     27015,
-    27020,
-    27025,
-    27030,
-    27034,
-    27039,
-    27044,
-    27049,
-    27054,
-    27059,
-    27063,
-    27068,
-    27073,
-    27078,
-    27083,
-    27088,
     27092,
-    27097,
-    27102,
-    27107,
-    27112,
-    27117,
-    27122,
-    27126,
-    27131,
-    27136,
-    27141,
-    27146,
-    27150,
-    27155,
-    27160,
-    27165,
     27170,
-    27175,
-    27179,
-    27184,
-    27189,
-    27194,
-    27199,
-    27204,
-    27208,
-    27213,
-    27218,
-    27223,
-    27228,
-    27232,
-    27237,
-    27242,
     27247,
-    27252,
-    27256,
-    27261,
-    27266,
-    27271,
-    27276,
-    27281,
-    27285,
-    27290,
-    27295,
-    27300,
-    27305,
-    27309,
-    27314,
-    27319,
     27324,
-    27329,
-    27333,
-    27338,
-    27343,
-    27348,
-    27352,
-    27357,
-    27362,
-    27367,
-    27372,
-    27376,
-    27381,
-    27386,
-    27391,
-    27396,
     27400,
-    27405,
-    27410,
-    27415,
-    27420,
-    27424,
-    27429,
-    27434,
-    27439,
-    27443,
-    27448,
-    27453,
-    27458,
-    27462,
-    27467,
-    27472,
     27477,
-    27482,
-    27486,
-    27491,
-    27496,
-    27501,
-    27505,
-    27510,
-    27515,
-    27520,
-    27524,
-    27529,
-    27534,
-    27539,
-    27544,
-    27548,
     27553,
-    27558,
-    27563,
-    27567,
-    27572,
-    27577,
-    27582,
-    27586,
-    27591,
-    27596,
-    27601,
-    27605,
-    27610,
-    27615,
-    27620,
-    27624,
     27629,
-    27634,
-    27639,
-    27643,
-    27648,
-    27653,
-    27657,
-    27662,
-    27667,
-    27672,
-    27676,
-    27681,
-    27686,
-    27691,
-    27695,
-    27700,
     27705,
-    27710,
-    27714,
-    27719,
-    27724,
-    27728,
-    27733,
-    27738,
-    27743,
-    27747,
-    27752,
-    27757,
-    27762,
-    27766,
-    27771,
-    27776,
     27780,
-    27785,
-    27790,
-    27795,
-    27799,
-    27804,
-    27809,
-    27813,
-    27818,
-    27823,
-    27828,
-    27832,
-    27837,
-    27842,
-    27846,
-    27851,
     27856,
-    27861,
-    27865,
-    27870,
-    27875,
-    27879,
-    27884,
-    27889,
-    27893,
-    27898,
-    27903,
-    27908,
-    27912,
-    27917,
-    27922,
-    27926,
     27931,
-    27936,
-    27940,
-    27945,
-    27950,
-    27954,
-    27959,
-    27964,
-    27969,
-    27973,
-    27978,
-    27983,
-    27987,
-    27992,
-    27997,
-    28001,
     28006,
-    28011,
-    28015,
-    28020,
-    28025,
-    28029,
-    28034,
-    28039,
-    28043,
-    28048,
-    28053,
-    28057,
-    28062,
-    28067,
-    28071,
-    28076,
     28081,
-    28085,
-    28090,
-    28095,
-    28099,
-    28104,
-    28109,
-    28113,
-    28118,
-    28123,
-    28127,
-    28132,
-    28137,
-    28141,
-    28146,
-    28151,
     28155,
-    28160,
-    28165,
-    28169,
-    28174,
-    28179,
-    28183,
-    28188,
-    28193,
-    28197,
-    28202,
-    28207,
-    28211,
-    28216,
-    28220,
-    28225,
     28230,
-    28234,
-    28239,
-    28244,
-    28248,
-    28253,
-    28258,
-    28262,
-    28267,
-    28271,
-    28276,
-    28281,
-    28285,
-    28290,
-    28295,
-    28299,
     28304,
-    28309,
-    28313,
-    28318,
-    28322,
-    28327,
-    28332,
-    28336,
-    28341,
-    28346,
-    28350,
-    28355,
-    28359,
-    28364,
-    28369,
-    28373,
     28378,
-    28383,
-    28387,
-    28392,
-    28396,
-    28401,
-    28406,
-    28410,
-    28415,
-    28419,
-    28424,
-    28429,
-    28433,
-    28438,
-    28443,
-    28447,
     28452,
-    28456,
-    28461,
-    28466,
-    28470,
-    28475,
-    28479,
-    28484,
-    28489,
-    28493,
-    28498,
-    28502,
-    28507,
-    28512,
-    28516,
-    28521,
     28525,
-    28530,
-    28535,
-    28539,
-    28544,
-    28548,
-    28553,
-    28557,
-    28562,
-    28567,
-    28571,
-    28576,
-    28580,
-    28585,
-    28590,
-    28594,
     28599,
-    28603,
-    28608,
-    28613,
-    28617,
-    28622,
-    28626,
-    28631,
-    28635,
-    28640,
-    28645,
-    28649,
-    28654,
-    28658,
-    28663,
-    28667,
     28672,
-    28677,
-    28681,
-    28686,
-    28690,
-    28695,
-    28699,
-    28704,
-    28709,
-    28713,
-    28718,
-    28722,
-    28727,
-    28731,
-    28736,
-    28740,
     28745,
-    28750,
-    28754,
-    28759,
-    28763,
-    28768,
-    28772,
-    28777,
-    28782,
-    28786,
-    28791,
-    28795,
-    28800,
-    28804,
-    28809,
-    28813,
     28818,
-    28822,
-    28827,
-    28832,
-    28836,
-    28841,
-    28845,
-    28850,
-    28854,
-    28859,
-    28863,
-    28868,
-    28872,
-    28877,
-    28882,
-    28886,
     28891,
-    28895,
-    28900,
-    28904,
-    28909,
-    28913,
-    28918,
-    28922,
-    28927,
-    28931,
-    28936,
-    28940,
-    28945,
-    28950,
-    28954,
-    28959,
     28963,
-    28968,
-    28972,
-    28977,
-    28981,
-    28986,
-    28990,
-    28995,
-    28999,
-    29004,
-    29008,
-    29013,
-    29017,
-    29022,
-    29026,
-    29031,
     29035,
-    29040,
-    29044,
-    29049,
-    29053,
-    29058,
-    29062,
-    29067,
-    29072,
-    29076,
-    29081,
-    29085,
-    29090,
-    29094,
-    29099,
-    29103,
     29108,
-    29112,
-    29117,
-    29121,
-    29126,
-    29130,
-    29135,
-    29139,
-    29144,
-    29148,
-    29153,
-    29157,
-    29162,
-    29166,
-    29171,
-    29175,
     29180,
-    29184,
-    29188,
-    29193,
-    29197,
-    29202,
-    29206,
-    29211,
-    29215,
-    29220,
-    29224,
-    29229,
-    29233,
-    29238,
-    29242,
-    29247,
     29251,
-    29256,
-    29260,
-    29265,
-    29269,
-    29274,
-    29278,
-    29283,
-    29287,
-    29292,
-    29296,
-    29301,
-    29305,
-    29309,
-    29314,
-    29318,
     29323,
-    29327,
-    29332,
-    29336,
-    29341,
-    29345,
-    29350,
-    29354,
-    29359,
-    29363,
-    29368,
-    29372,
-    29376,
-    29381,
-    29385,
-    29390,
     29394,
-    29399,
-    29403,
-    29408,
-    29412,
-    29417,
-    29421,
-    29426,
-    29430,
-    29434,
-    29439,
-    29443,
-    29448,
-    29452,
-    29457,
-    29461,
     29466,
-    29470,
-    29474,
-    29479,
-    29483,
-    29488,
-    29492,
-    29497,
-    29501,
-    29506,
-    29510,
-    29514,
-    29519,
-    29523,
-    29528,
-    29532,
     29537,
-    29541,
-    29546,
-    29550,
-    29554,
-    29559,
-    29563,
-    29568,
-    29572,
-    29577,
-    29581,
-    29585,
-    29590,
-    29594,
-    29599,
-    29603,
     29608,
-    29612,
-    29616,
-    29621,
-    29625,
-    29630,
-    29634,
-    29639,
-    29643,
-    29647,
-    29652,
-    29656,
-    29661,
-    29665,
-    29670,
-    29674,
     29678,
-    29683,
-    29687,
-    29692,
-    29696,
-    29700,
-    29705,
-    29709,
-    29714,
-    29718,
-    29722,
-    29727,
-    29731,
-    29736,
-    29740,
-    29745,
     29749,
-    29753,
-    29758,
-    29762,
-    29767,
-    29771,
-    29775,
-    29780,
-    29784,
-    29789,
-    29793,
-    29797,
-    29802,
-    29806,
-    29811,
-    29815,
     29819,
-    29824,
-    29828,
-    29833,
-    29837,
-    29841,
-    29846,
-    29850,
-    29854,
-    29859,
-    29863,
-    29868,
-    29872,
-    29876,
-    29881,
-    29885,
     29890,
-    29894,
-    29898,
-    29903,
-    29907,
-    29911,
-    29916,
-    29920,
-    29925,
-    29929,
-    29933,
-    29938,
-    29942,
-    29947,
-    29951,
-    29955,
     29960,
-    29964,
-    29968,
-    29973,
-    29977,
-    29982,
-    29986,
-    29990,
-    29995,
-    29999,
-    30003,
-    30008,
-    30012,
-    30016,
-    30021,
-    30025,
     30030,
-    30034,
-    30038,
-    30043,
-    30047,
-    30051,
-    30056,
-    30060,
-    30064,
-    30069,
-    30073,
-    30078,
-    30082,
-    30086,
-    30091,
-    30095,
     30099,
-    30104,
-    30108,
-    30112,
-    30117,
-    30121,
-    30125,
-    30130,
-    30134,
-    30138,
-    30143,
-    30147,
-    30152,
-    30156,
-    30160,
-    30165,
     30169,
-    30173,
-    30178,
-    30182,
-    30186,
-    30191,
-    30195,
-    30199,
-    30204,
-    30208,
-    30212,
-    30217,
-    30221,
-    30225,
-    30230,
-    30234,
     30238,
-    30243,
-    30247,
-    30251,
-    30256,
-    30260,
-    30264,
-    30269,
-    30273,
-    30277,
-    30282,
-    30286,
-    30290,
-    30295,
-    30299,
-    30303,
     30308,
-    30312,
-    30316,
-    30321,
-    30325,
-    30329,
-    30334,
-    30338,
-    30342,
-    30347,
-    30351,
-    30355,
-    30359,
-    30364,
-    30368,
-    30372,
     30377,
-    30381,
-    30385,
-    30390,
-    30394,
-    30398,
-    30403,
-    30407,
-    30411,
-    30416,
-    30420,
-    30424,
-    30428,
-    30433,
-    30437,
-    30441,
     30446,
-    30450,
-    30454,
-    30459,
-    30463,
-    30467,
-    30472,
-    30476,
-    30480,
-    30484,
-    30489,
-    30493,
-    30497,
-    30502,
-    30506,
-    30510,
     30515,
-    30519,
-    30523,
-    30527,
-    30532,
-    30536,
-    30540,
-    30545,
-    30549,
-    30553,
-    30557,
-    30562,
-    30566,
-    30570,
-    30575,
-    30579,
     30583,
-    30587,
-    30592,
-    30596,
-    30600,
-    30605,
-    30609,
-    30613,
-    30617,
-    30622,
-    30626,
-    30630,
-    30635,
-    30639,
-    30643,
-    30647,
     30652,
-    30656,
-    30660,
-    30664,
-    30669,
-    30673,
-    30677,
-    30682,
-    30686,
-    30690,
-    30694,
-    30699,
-    30703,
-    30707,
-    30711,
-    30716,
     30720,
-    30724,
-    30729,
-    30733,
-    30737,
-    30741,
-    30746,
-    30750,
-    30754,
-    30758,
-    30763,
-    30767,
-    30771,
-    30775,
-    30780,
-    30784,
     30788,
-    30792,
-    30797,
-    30801,
-    30805,
-    30809,
-    30814,
-    30818,
-    30822,
-    30826,
-    30831,
-    30835,
-    30839,
-    30843,
-    30848,
-    30852,
     30856,
-    30860,
-    30865,
-    30869,
-    30873,
-    30877,
-    30882,
-    30886,
-    30890,
-    30894,
-    30899,
-    30903,
-    30907,
-    30911,
-    30916,
-    30920,
     30924,
-    30928,
-    30933,
-    30937,
-    30941,
-    30945,
-    30950,
-    30954,
-    30958,
-    30962,
-    30966,
-    30971,
-    30975,
-    30979,
-    30983,
-    30988,
     30992,
-    30996,
-    31000,
-    31005,
-    31009,
-    31013,
-    31017,
-    31021,
-    31026,
-    31030,
-    31034,
-    31038,
-    31043,
-    31047,
-    31051,
-    31055,
     31059,
-    31064,
-    31068,
-    31072,
-    31076,
-    31081,
-    31085,
-    31089,
-    31093,
-    31097,
-    31102,
-    31106,
-    31110,
-    31114,
-    31118,
-    31123,
     31127,
-    31131,
-    31135,
-    31140,
-    31144,
-    31148,
-    31152,
-    31156,
-    31161,
-    31165,
-    31169,
-    31173,
-    31177,
-    31182,
-    31186,
-    31190,
     31194,
-    31198,
-    31203,
-    31207,
-    31211,
-    31215,
-    31219,
-    31224,
-    31228,
-    31232,
-    31236,
-    31240,
-    31245,
-    31249,
-    31253,
-    31257,
     31261,
-    31266,
-    31270,
-    31274,
-    31278,
-    31282,
-    31287,
-    31291,
-    31295,
-    31299,
-    31303,
-    31307,
-    31312,
-    31316,
-    31320,
-    31324,
     31328,
-    31333,
-    31337,
-    31341,
-    31345,
-    31349,
-    31353,
-    31358,
-    31362,
-    31366,
-    31370,
-    31374,
-    31379,
-    31383,
-    31387,
-    31391,
     31395,
-    31399,
-    31404,
-    31408,
-    31412,
-    31416,
-    31420,
-    31424,
-    31429,
-    31433,
-    31437,
-    31441,
-    31445,
-    31449,
-    31454,
-    31458,
     31462,
-    31466,
-    31470,
-    31474,
-    31479,
-    31483,
-    31487,
-    31491,
-    31495,
-    31499,
-    31504,
-    31508,
-    31512,
-    31516,
-    31520,
-    31524,
     31529,
-    31533,
-    31537,
-    31541,
-    31545,
-    31549,
-    31553,
-    31558,
-    31562,
-    31566,
-    31570,
-    31574,
-    31578,
-    31583,
-    31587,
-    31591,
     31595,
-    31599,
-    31603,
-    31607,
-    31612,
-    31616,
-    31620,
-    31624,
-    31628,
-    31632,
-    31636,
-    31641,
-    31645,
-    31649,
-    31653,
-    31657,
     31661,
-    31665,
-    31670,
-    31674,
-    31678,
-    31682,
-    31686,
-    31690,
-    31694,
-    31699,
-    31703,
-    31707,
-    31711,
-    31715,
-    31719,
-    31723,
     31727,
-    31732,
-    31736,
-    31740,
-    31744,
-    31748,
-    31752,
-    31756,
-    31761,
-    31765,
-    31769,
-    31773,
-    31777,
-    31781,
-    31785,
-    31789,
     31794,
-    31798,
-    31802,
-    31806,
-    31810,
-    31814,
-    31818,
-    31822,
-    31826,
-    31831,
-    31835,
-    31839,
-    31843,
-    31847,
-    31851,
-    31855,
     31859,
-    31864,
-    31868,
-    31872,
-    31876,
-    31880,
-    31884,
-    31888,
-    31892,
-    31896,
-    31901,
-    31905,
-    31909,
-    31913,
-    31917,
-    31921,
     31925,
-    31929,
-    31933,
-    31937,
-    31942,
-    31946,
-    31950,
-    31954,
-    31958,
-    31962,
-    31966,
-    31970,
-    31974,
-    31978,
-    31983,
-    31987,
     31991,
-    31995,
-    31999,
-    32003,
-    32007,
-    32011,
-    32015,
-    32019,
-    32024,
-    32028,
-    32032,
-    32036,
-    32040,
-    32044,
-    32048,
-    32052,
     32056,
-    32060,
-    32064,
-    32069,
-    32073,
-    32077,
-    32081,
-    32085,
-    32089,
-    32093,
-    32097,
-    32101,
-    32105,
-    32109,
-    32113,
-    32118,
     32122,
-    32126,
-    32130,
-    32134,
-    32138,
-    32142,
-    32146,
-    32150,
-    32154,
-    32158,
-    32162,
-    32166,
-    32171,
-    32175,
-    32179,
-    32183,
     32187,
-    32191,
-    32195,
-    32199,
-    32203,
-    32207,
-    32211,
-    32215,
-    32219,
-    32223,
-    32228,
-    32232,
-    32236,
-    32240,
-    32244,
-    32248,
     32252,
-    32256,
-    32260,
-    32264,
-    32268,
-    32272,
-    32276,
-    32280,
-    32284,
-    32288,
-    32293,
-    32297,
-    32301,
-    32305,
-    32309,
-    32313,
     32317,
-    32321,
-    32325,
-    32329,
-    32333,
-    32337,
-    32341,
-    32345,
-    32349,
-    32353,
-    32357,
-    32361,
-    32366,
-    32370,
-    32374,
-    32378,
     32382,
-    32386,
-    32390,
-    32394,
-    32398,
-    32402,
-    32406,
-    32410,
-    32414,
-    32418,
-    32422,
-    32426,
-    32430,
-    32434,
-    32438,
-    32442,
     32446,
-    32450,
-    32455,
-    32459,
-    32463,
-    32467,
-    32471,
-    32475,
-    32479,
-    32483,
-    32487,
-    32491,
-    32495,
-    32499,
-    32503,
-    32507,
     32511,
-    32515,
-    32519,
-    32523,
-    32527,
-    32531,
-    32535,
-    32539,
-    32543,
-    32547,
-    32551,
-    32555,
-    32559,
-    32563,
-    32567,
-    32571,
     32575,
-    32579,
-    32583,
-    32588,
-    32592,
-    32596,
-    32600,
-    32604,
-    32608,
-    32612,
-    32616,
-    32620,
-    32624,
-    32628,
-    32632,
-    32636,
     32640,
-    32644,
-    32648,
-    32652,
-    32656,
-    32660,
-    32664,
-    32668,
-    32672,
-    32676,
-    32680,
-    32684,
-    32688,
-    32692,
-    32696,
-    32700,
     32704,
-    32708,
-    32712,
-    32716,
-    32720,
-    32724,
-    32728,
-    32732,
-    32736,
-    32740,
-    32744,
-    32748,
-    32752,
-    32756,
-    32760,
-    32764,
     32768,
-    32772,
-    32776,
-    32780,
-    32784,
-    32788,
-    32792,
-    32796,
-    32800,
-    32804,
-    32808,
-    32812,
-    32816,
-    32820,
-    32824,
-    32828,
     32832,
-    32836,
-    32840,
-    32844,
-    32848,
-    32852,
-    32856,
-    32860,
-    32864,
-    32868,
-    32872,
-    32876,
-    32880,
-    32884,
-    32888,
-    32892,
     32896,
-    32900,
-    32904,
-    32908,
-    32912,
-    32916,
-    32920,
-    32924,
-    32928,
-    32932,
-    32936,
-    32940,
-    32944,
-    32948,
-    32951,
-    32955,
     32959,
-    32963,
-    32967,
-    32971,
-    32975,
-    32979,
-    32983,
-    32987,
-    32991,
-    32995,
-    32999,
-    33003,
-    33007,
-    33011,
-    33015,
-    33019,
     33023,
-    33027,
-    33031,
-    33035,
-    33039,
-    33043,
-    33047,
-    33051,
-    33055,
-    33059,
-    33063,
-    33067,
-    33071,
-    33075,
-    33079,
-    33082,
     33086,
-    33090,
-    33094,
-    33098,
-    33102,
-    33106,
-    33110,
-    33114,
-    33118,
-    33122,
-    33126,
-    33130,
-    33134,
-    33138,
-    33142,
-    33146,
     33150,
-    33154,
-    33158,
-    33162,
-    33166,
-    33170,
-    33173,
-    33177,
-    33181,
-    33185,
-    33189,
-    33193,
-    33197,
-    33201,
-    33205,
-    33209,
     33213,
-    33217,
-    33221,
-    33225,
-    33229,
-    33233,
-    33237,
-    33241,
-    33245,
-    33248,
-    33252,
-    33256,
-    33260,
-    33264,
-    33268,
-    33272,
     33276,
-    33280,
-    33284,
-    33288,
-    33292,
-    33296,
-    33300,
-    33304,
-    33308,
-    33311,
-    33315,
-    33319,
-    33323,
-    33327,
-    33331,
-    33335,
     33339,
-    33343,
-    33347,
-    33351,
-    33355,
-    33359,
-    33363,
-    33367,
-    33370,
-    33374,
-    33378,
-    33382,
-    33386,
-    33390,
-    33394,
-    33398,
     33402,
-    33406,
-    33410,
-    33414,
-    33418,
-    33421,
-    33425,
-    33429,
-    33433,
-    33437,
-    33441,
-    33445,
-    33449,
-    33453,
-    33457,
-    33461,
     33465,
-    33469,
-    33472,
-    33476,
-    33480,
-    33484,
-    33488,
-    33492,
-    33496,
-    33500,
-    33504,
-    33508,
-    33512,
-    33515,
-    33519,
-    33523,
     33527,
-    33531,
-    33535,
-    33539,
-    33543,
-    33547,
-    33551,
-    33555,
-    33558,
-    33562,
-    33566,
-    33570,
-    33574,
-    33578,
-    33582,
-    33586,
     33590,
-    33594,
-    33598,
-    33601,
-    33605,
-    33609,
-    33613,
-    33617,
-    33621,
-    33625,
-    33629,
-    33633,
-    33636,
-    33640,
-    33644,
-    33648,
     33652,
-    33656,
-    33660,
-    33664,
-    33668,
-    33672,
-    33675,
-    33679,
-    33683,
-    33687,
-    33691,
-    33695,
-    33699,
-    33703,
-    33707,
-    33710,
     33714,
-    33718,
-    33722,
-    33726,
-    33730,
-    33734,
-    33738,
-    33742,
-    33745,
-    33749,
-    33753,
-    33757,
-    33761,
-    33765,
-    33769,
-    33773,
     33776,
-    33780,
-    33784,
-    33788,
-    33792,
-    33796,
-    33800,
-    33804,
-    33808,
-    33811,
-    33815,
-    33819,
-    33823,
-    33827,
-    33831,
-    33835,
     33839,
-    33842,
-    33846,
-    33850,
-    33854,
-    33858,
-    33862,
-    33866,
-    33869,
-    33873,
-    33877,
-    33881,
-    33885,
-    33889,
-    33893,
-    33897,
     33900,
-    33904,
-    33908,
-    33912,
-    33916,
-    33920,
-    33924,
-    33927,
-    33931,
-    33935,
-    33939,
-    33943,
-    33947,
-    33951,
-    33955,
-    33958,
     33962,
-    33966,
-    33970,
-    33974,
-    33978,
-    33982,
-    33985,
-    33989,
-    33993,
-    33997,
-    34001,
-    34005,
-    34009,
-    34012,
-    34016,
-    34020,
     34024,
-    34028,
-    34032,
-    34035,
-    34039,
-    34043,
-    34047,
-    34051,
-    34055,
-    34059,
-    34062,
-    34066,
-    34070,
-    34074,
-    34078,
-    34082,
     34086,
-    34089,
-    34093,
-    34097,
-    34101,
-    34105,
-    34109,
-    34112,
-    34116,
-    34120,
-    34124,
-    34128,
-    34132,
-    34135,
-    34139,
-    34143,
     34147,
-    34151,
-    34155,
-    34158,
-    34162,
-    34166,
-    34170,
-    34174,
-    34178,
-    34182,
-    34185,
-    34189,
-    34193,
-    34197,
-    34201,
-    34205,
     34208,
-    34212,
-    34216,
-    34220,
-    34224,
-    34227,
-    34231,
-    34235,
-    34239,
-    34243,
-    34247,
-    34250,
-    34254,
-    34258,
-    34262,
-    34266,
     34270,
-    34273,
-    34277,
-    34281,
-    34285,
-    34289,
-    34293,
-    34296,
-    34300,
-    34304,
-    34308,
-    34312,
-    34315,
-    34319,
-    34323,
-    34327,
     34331,
-    34335,
-    34338,
-    34342,
-    34346,
-    34350,
-    34354,
-    34357,
-    34361,
-    34365,
-    34369,
-    34373,
-    34377,
-    34380,
-    34384,
-    34388,
     34392,
-    34396,
-    34399,
-    34403,
-    34407,
-    34411,
-    34415,
-    34418,
-    34422,
-    34426,
-    34430,
-    34434,
-    34437,
-    34441,
-    34445,
-    34449,
     34453,
-    34456,
-    34460,
-    34464,
-    34468,
-    34472,
-    34476,
-    34479,
-    34483,
-    34487,
-    34491,
-    34495,
-    34498,
-    34502,
-    34506,
-    34510,
     34514,
-    34517,
-    34521,
-    34525,
-    34529,
-    34532,
-    34536,
-    34540,
-    34544,
-    34548,
-    34551,
-    34555,
-    34559,
-    34563,
-    34567,
-    34570,
     34574,
-    34578,
-    34582,
-    34586,
-    34589,
-    34593,
-    34597,
-    34601,
-    34605,
-    34608,
-    34612,
-    34616,
-    34620,
-    34623,
-    34627,
-    34631,
     34635,
-    34639,
-    34642,
-    34646,
-    34650,
-    34654,
-    34658,
-    34661,
-    34665,
-    34669,
-    34673,
-    34676,
-    34680,
-    34684,
-    34688,
-    34692,
     34695,
-    34699,
-    34703,
-    34707,
-    34710,
-    34714,
-    34718,
-    34722,
-    34726,
-    34729,
-    34733,
-    34737,
-    34741,
-    34744,
-    34748,
-    34752,
     34756,
-    34759,
-    34763,
-    34767,
-    34771,
-    34775,
-    34778,
-    34782,
-    34786,
-    34790,
-    34793,
-    34797,
-    34801,
-    34805,
-    34808,
-    34812,
     34816,
-    34820,
-    34824,
-    34827,
-    34831,
-    34835,
-    34839,
-    34842,
-    34846,
-    34850,
-    34854,
-    34857,
-    34861,
-    34865,
-    34869,
-    34872,
     34876,
-    34880,
-    34884,
-    34887,
-    34891,
-    34895,
-    34899,
-    34902,
-    34906,
-    34910,
-    34914,
-    34917,
-    34921,
-    34925,
-    34929,
-    34933,
     34936,
-    34940,
-    34944,
-    34948,
-    34951,
-    34955,
-    34959,
-    34963,
-    34966,
-    34970,
-    34974,
-    34978,
-    34981,
-    34985,
-    34989,
-    34992,
     34996,
-    35000,
-    35004,
-    35007,
-    35011,
-    35015,
-    35019,
-    35022,
-    35026,
-    35030,
-    35034,
-    35037,
-    35041,
-    35045,
-    35049,
-    35052,
     35056,
-    35060,
-    35064,
-    35067,
-    35071,
-    35075,
-    35079,
-    35082,
-    35086,
-    35090,
-    35093,
-    35097,
-    35101,
-    35105,
-    35108,
-    35112,
     35116,
-    35120,
-    35123,
-    35127,
-    35131,
-    35135,
-    35138,
-    35142,
-    35146,
-    35149,
-    35153,
-    35157,
-    35161,
-    35164,
-    35168,
-    35172,
     35176,
-    35179,
-    35183,
-    35187,
-    35190,
-    35194,
-    35198,
-    35202,
-    35205,
-    35209,
-    35213,
-    35217,
-    35220,
-    35224,
-    35228,
-    35231,
     35235,
-    35239,
-    35243,
-    35246,
-    35250,
-    35254,
-    35257,
-    35261,
-    35265,
-    35269,
-    35272,
-    35276,
-    35280,
-    35283,
-    35287,
-    35291,
     35295,
-    35298,
-    35302,
-    35306,
-    35309,
-    35313,
-    35317,
-    35321,
-    35324,
-    35328,
-    35332,
-    35335,
-    35339,
-    35343,
-    35347,
-    35350,
     35354,
-    35358,
-    35361,
-    35365,
-    35369,
-    35372,
-    35376,
-    35380,
-    35384,
-    35387,
-    35391,
-    35395,
-    35398,
-    35402,
-    35406,
-    35410,
     35413,
-    35417,
-    35421,
-    35424,
-    35428,
-    35432,
-    35435,
-    35439,
-    35443,
-    35447,
-    35450,
-    35454,
-    35458,
-    35461,
-    35465,
-    35469,
     35472,
-    35476,
-    35480,
-    35483,
-    35487,
-    35491,
-    35495,
-    35498,
-    35502,
-    35506,
-    35509,
-    35513,
-    35517,
-    35520,
-    35524,
-    35528,
     35531,
-    35535,
-    35539,
-    35543,
-    35546,
-    35550,
-    35554,
-    35557,
-    35561,
-    35565,
-    35568,
-    35572,
-    35576,
-    35579,
-    35583,
-    35587,
     35590,
-    35594,
-    35598,
-    35601,
-    35605,
-    35609,
-    35613,
-    35616,
-    35620,
-    35624,
-    35627,
-    35631,
-    35635,
-    35638,
-    35642,
-    35646,
     35649,
-    35653,
-    35657,
-    35660,
-    35664,
-    35668,
-    35671,
-    35675,
-    35679,
-    35682,
-    35686,
-    35690,
-    35693,
-    35697,
-    35701,
-    35704,
     35708,
-    35712,
-    35715,
-    35719,
-    35723,
-    35726,
-    35730,
-    35734,
-    35737,
-    35741,
-    35745,
-    35748,
-    35752,
-    35756,
-    35759,
-    35763,
     35767,
-    35770,
-    35774,
-    35778,
-    35781,
-    35785,
-    35789,
-    35792,
-    35796,
-    35800,
-    35803,
-    35807,
-    35811,
-    35814,
-    35818,
-    35822,
     35825,
-    35829,
-    35833,
-    35836,
-    35840,
-    35844,
-    35847,
-    35851,
-    35855,
-    35858,
-    35862,
-    35866,
-    35869,
-    35873,
-    35877,
-    35880,
     35884,
-    35888,
-    35891,
-    35895,
-    35898,
-    35902,
-    35906,
-    35909,
-    35913,
-    35917,
-    35920,
-    35924,
-    35928,
-    35931,
-    35935,
-    35939,
     35942,
-    35946,
-    35950,
-    35953,
-    35957,
-    35960,
-    35964,
-    35968,
-    35971,
-    35975,
-    35979,
-    35982,
-    35986,
-    35990,
-    35993,
-    35997,
     36001,
-    36004,
-    36008,
-    36011,
-    36015,
-    36019,
-    36022,
-    36026,
-    36030,
-    36033,
-    36037,
-    36041,
-    36044,
-    36048,
-    36051,
-    36055,
     36059,
-    36062,
-    36066,
-    36070,
-    36073,
-    36077,
-    36081,
-    36084,
-    36088,
-    36091,
-    36095,
-    36099,
-    36102,
-    36106,
-    36110,
-    36113,
     36117,
-    36121,
-    36124,
-    36128,
-    36131,
-    36135,
-    36139,
-    36142,
-    36146,
-    36150,
-    36153,
-    36157,
-    36160,
-    36164,
-    36168,
-    36171,
     36175,
-    36179,
-    36182,
-    36186,
-    36189,
-    36193,
-    36197,
-    36200,
-    36204,
-    36207,
-    36211,
-    36215,
-    36218,
-    36222,
-    36226,
-    36229,
     36233,
-    36236,
-    36240,
-    36244,
-    36247,
-    36251,
-    36255,
-    36258,
-    36262,
-    36265,
-    36269,
-    36273,
-    36276,
-    36280,
-    36283,
-    36287,
     36291,
-    36294,
-    36298,
-    36301,
-    36305,
-    36309,
-    36312,
-    36316,
-    36320,
-    36323,
-    36327,
-    36330,
-    36334,
-    36338,
-    36341,
-    36345,
     36348,
-    36352,
-    36356,
-    36359,
-    36363,
-    36366,
-    36370,
-    36374,
-    36377,
-    36381,
-    36384,
-    36388,
-    36392,
-    36395,
-    36399,
-    36402,
     36406,
-    36410,
-    36413,
-    36417,
-    36420,
-    36424,
-    36428,
-    36431,
-    36435,
-    36438,
-    36442,
-    36446,
-    36449,
-    36453,
-    36456,
-    36460,
     36464,
-    36467,
-    36471,
-    36474,
-    36478,
-    36482,
-    36485,
-    36489,
-    36492,
-    36496,
-    36500,
-    36503,
-    36507,
-    36510,
-    36514,
-    36517,
     36521,
-    36525,
-    36528,
-    36532,
-    36535,
-    36539,
-    36543,
-    36546,
-    36550,
-    36553,
-    36557,
-    36561,
-    36564,
-    36568,
-    36571,
-    36575,
     36578,
-    36582,
-    36586,
-    36589,
-    36593,
-    36596,
-    36600,
-    36604,
-    36607,
-    36611,
-    36614,
-    36618,
-    36621,
-    36625,
-    36629,
-    36632,
     36636,
-    36639,
-    36643,
-    36646,
-    36650,
-    36654,
-    36657,
-    36661,
-    36664,
-    36668,
-    36671,
-    36675,
-    36679,
-    36682,
-    36686,
-    36689,
     36693,
-    36697,
-    36700,
-    36704,
-    36707,
-    36711,
-    36714,
-    36718,
-    36722,
-    36725,
-    36729,
-    36732,
-    36736,
-    36739,
-    36743,
-    36746,
     36750,
-    36754,
-    36757,
-    36761,
-    36764,
-    36768,
-    36771,
-    36775,
-    36779,
-    36782,
-    36786,
-    36789,
-    36793,
-    36796,
-    36800,
-    36804,
     36807,
-    36811,
-    36814,
-    36818,
-    36821,
-    36825,
-    36828,
-    36832,
-    36836,
-    36839,
-    36843,
-    36846,
-    36850,
-    36853,
-    36857,
-    36860,
     36864,
-    36868,
-    36871,
-    36875,
-    36878,
-    36882,
-    36885,
-    36889,
-    36892,
-    36896,
-    36900,
-    36903,
-    36907,
-    36910,
-    36914,
-    36917,
     36921,
-    36924,
-    36928,
-    36931,
-    36935,
-    36939,
-    36942,
-    36946,
-    36949,
-    36953,
-    36956,
-    36960,
-    36963,
-    36967,
-    36971,
-    36974,
     36978,
-    36981,
-    36985,
-    36988,
-    36992,
-    36995,
-    36999,
-    37002,
-    37006,
-    37009,
-    37013,
-    37017,
-    37020,
-    37024,
-    37027,
-    37031,
     37034,
-    37038,
-    37041,
-    37045,
-    37048,
-    37052,
-    37056,
-    37059,
-    37063,
-    37066,
-    37070,
-    37073,
-    37077,
-    37080,
-    37084,
-    37087,
     37091,
-    37094,
-    37098,
-    37101,
-    37105,
-    37109,
-    37112,
-    37116,
-    37119,
-    37123,
-    37126,
-    37130,
-    37133,
-    37137,
-    37140,
-    37144,
     37147,
-    37151,
-    37154,
-    37158,
-    37161,
-    37165,
-    37169,
-    37172,
-    37176,
-    37179,
-    37183,
-    37186,
-    37190,
-    37193,
-    37197,
-    37200,
     37204,
-    37207,
-    37211,
-    37214,
-    37218,
-    37221,
-    37225,
-    37228,
-    37232,
-    37235,
-    37239,
-    37243,
-    37246,
-    37250,
-    37253,
-    37257,
     37260,
-    37264,
-    37267,
-    37271,
-    37274,
-    37278,
-    37281,
-    37285,
-    37288,
-    37292,
-    37295,
-    37299,
-    37302,
-    37306,
-    37309,
-    37313,
     37316,
-    37320,
-    37323,
-    37327,
-    37330,
-    37334,
-    37337,
-    37341,
-    37344,
-    37348,
-    37351,
-    37355,
-    37358,
-    37362,
-    37365,
-    37369,
     37372,
-    37376,
-    37380,
-    37383,
-    37387,
-    37390,
-    37394,
-    37397,
-    37401,
-    37404,
-    37408,
-    37411,
-    37415,
-    37418,
-    37422,
-    37425,
     37429,
-    37432,
-    37436,
-    37439,
-    37443,
-    37446,
-    37450,
-    37453,
-    37457,
-    37460,
-    37464,
-    37467,
-    37471,
-    37474,
-    37478,
-    37481,
     37485,
-    37488,
-    37492,
-    37495,
-    37499,
-    37502,
-    37506,
-    37509,
-    37513,
-    37516,
-    37520,
-    37523,
-    37526,
-    37530,
-    37533,
-    37537,
     37540,
-    37544,
-    37547,
-    37551,
-    37554,
-    37558,
-    37561,
-    37565,
-    37568,
-    37572,
-    37575,
-    37579,
-    37582,
-    37586,
-    37589,
-    37593,
     37596,
-    37600,
-    37603,
-    37607,
-    37610,
-    37614,
-    37617,
-    37621,
-    37624,
-    37628,
-    37631,
-    37635,
-    37638,
-    37642,
-    37645,
-    37649,
     37652,
-    37656,
-    37659,
-    37662,
-    37666,
-    37669,
-    37673,
-    37676,
-    37680,
-    37683,
-    37687,
-    37690,
-    37694,
-    37697,
-    37701,
-    37704,
     37708,
-    37711,
-    37715,
-    37718,
-    37722,
-    37725,
-    37729,
-    37732,
-    37735,
-    37739,
-    37742,
-    37746,
-    37749,
-    37753,
-    37756,
-    37760,
     37763,
-    37767,
-    37770,
-    37774,
-    37777,
-    37781,
-    37784,
-    37788,
-    37791,
-    37794,
-    37798,
-    37801,
-    37805,
-    37808,
-    37812,
-    37815,
     37819,
-    37822,
-    37826,
-    37829,
-    37833,
-    37836,
-    37840,
-    37843,
-    37846,
-    37850,
-    37853,
-    37857,
-    37860,
-    37864,
-    37867,
-    37871,
     37874,
-    37878,
-    37881,
-    37885,
-    37888,
-    37891,
-    37895,
-    37898,
-    37902,
-    37905,
-    37909,
-    37912,
-    37916,
-    37919,
-    37923,
-    37926,
     37929,
-    37933,
-    37936,
-    37940,
-    37943,
-    37947,
-    37950,
-    37954,
-    37957,
-    37961,
-    37964,
-    37967,
-    37971,
-    37974,
-    37978,
-    37981,
     37985,
-    37988,
-    37992,
-    37995,
-    37999,
-    38002,
-    38005,
-    38009,
-    38012,
-    38016,
-    38019,
-    38023,
-    38026,
-    38030,
-    38033,
-    38036,
     38040,
-    38043,
-    38047,
-    38050,
-    38054,
-    38057,
-    38061,
-    38064,
-    38067,
-    38071,
-    38074,
-    38078,
-    38081,
-    38085,
-    38088,
-    38092,
     38095,
-    38098,
-    38102,
-    38105,
-    38109,
-    38112,
-    38116,
-    38119,
-    38123,
-    38126,
-    38129,
-    38133,
-    38136,
-    38140,
-    38143,
-    38147,
     38150,
-    38153,
-    38157,
-    38160,
-    38164,
-    38167,
-    38171,
-    38174,
-    38177,
-    38181,
-    38184,
-    38188,
-    38191,
-    38195,
-    38198,
-    38202,
     38205,
-    38208,
-    38212,
-    38215,
-    38219,
-    38222,
-    38226,
-    38229,
-    38232,
-    38236,
-    38239,
-    38243,
-    38246,
-    38250,
-    38253,
-    38256,
     38260,
-    38263,
-    38267,
-    38270,
-    38273,
-    38277,
-    38280,
-    38284,
-    38287,
-    38291,
-    38294,
-    38297,
-    38301,
-    38304,
-    38308,
-    38311,
     38315,
-    38318,
-    38321,
-    38325,
-    38328,
-    38332,
-    38335,
-    38339,
-    38342,
-    38345,
-    38349,
-    38352,
-    38356,
-    38359,
-    38362,
-    38366,
     38369,
-    38373,
-    38376,
-    38380,
-    38383,
-    38386,
-    38390,
-    38393,
-    38397,
-    38400,
-    38403,
-    38407,
-    38410,
-    38414,
-    38417,
-    38420,
     38424,
-    38427,
-    38431,
-    38434,
-    38438,
-    38441,
-    38444,
-    38448,
-    38451,
-    38455,
-    38458,
-    38461,
-    38465,
-    38468,
-    38472,
-    38475,
     38478,
-    38482,
-    38485,
-    38489,
-    38492,
-    38495,
-    38499,
-    38502,
-    38506,
-    38509,
-    38512,
-    38516,
-    38519,
-    38523,
-    38526,
-    38529,
     38533,
-    38536,
-    38540,
-    38543,
-    38546,
-    38550,
-    38553,
-    38557,
-    38560,
-    38563,
-    38567,
-    38570,
-    38574,
-    38577,
-    38580,
-    38584,
     38587,
-    38591,
-    38594,
-    38597,
-    38601,
-    38604,
-    38608,
-    38611,
-    38614,
-    38618,
-    38621,
-    38625,
-    38628,
-    38631,
-    38635,
-    38638,
     38642,
-    38645,
-    38648,
-    38652,
-    38655,
-    38659,
-    38662,
-    38665,
-    38669,
-    38672,
-    38675,
-    38679,
-    38682,
-    38686,
-    38689,
-    38692,
     38696,
-    38699,
-    38703,
-    38706,
-    38709,
-    38713,
-    38716,
-    38720,
-    38723,
-    38726,
-    38730,
-    38733,
-    38736,
-    38740,
-    38743,
-    38747,
     38750,
-    38753,
-    38757,
-    38760,
-    38764,
-    38767,
-    38770,
-    38774,
-    38777,
-    38780,
-    38784,
-    38787,
-    38791,
-    38794,
-    38797,
-    38801,
     38804,
-    38807,
-    38811,
-    38814,
-    38818,
-    38821,
-    38824,
-    38828,
-    38831,
-    38834,
-    38838,
-    38841,
-    38845,
-    38848,
-    38851,
-    38855,
     38858,
-    38861,
-    38865,
-    38868,
-    38872,
-    38875,
-    38878,
-    38882,
-    38885,
-    38888,
-    38892,
-    38895,
-    38899,
-    38902,
-    38905,
-    38909,
     38912,
-    38915,
-    38919,
-    38922,
-    38925,
-    38929,
-    38932,
-    38936,
-    38939,
-    38942,
-    38946,
-    38949,
-    38952,
-    38956,
-    38959,
-    38962,
     38966,
-    38969,
-    38973,
-    38976,
-    38979,
-    38983,
-    38986,
-    38989,
-    38993,
-    38996,
-    38999,
-    39003,
-    39006,
-    39010,
-    39013,
-    39016,
     39020,
-    39023,
-    39026,
-    39030,
-    39033,
-    39036,
-    39040,
-    39043,
-    39047,
-    39050,
-    39053,
-    39057,
-    39060,
-    39063,
-    39067,
-    39070,
     39073,
-    39077,
-    39080,
-    39083,
-    39087,
-    39090,
-    39093,
-    39097,
-    39100,
-    39104,
-    39107,
-    39110,
-    39114,
-    39117,
-    39120,
-    39124,
     39127,
-    39130,
-    39134,
-    39137,
-    39140,
-    39144,
-    39147,
-    39150,
-    39154,
-    39157,
-    39160,
-    39164,
-    39167,
-    39171,
-    39174,
-    39177,
     39181,
-    39184,
-    39187,
-    39191,
-    39194,
-    39197,
-    39201,
-    39204,
-    39207,
-    39211,
-    39214,
-    39217,
-    39221,
-    39224,
-    39227,
-    39231,
     39234,
-    39237,
-    39241,
-    39244,
-    39247,
-    39251,
-    39254,
-    39257,
-    39261,
-    39264,
-    39267,
-    39271,
-    39274,
-    39277,
-    39281,
-    39284,
     39287,
-    39291,
-    39294,
-    39297,
-    39301,
-    39304,
-    39307,
-    39311,
-    39314,
-    39317,
-    39321,
-    39324,
-    39327,
-    39331,
-    39334,
-    39337,
     39341,
-    39344,
-    39347,
-    39351,
-    39354,
-    39357,
-    39361,
-    39364,
-    39367,
-    39371,
-    39374,
-    39377,
-    39381,
-    39384,
-    39387,
-    39391,
     39394,
-    39397,
-    39401,
-    39404,
-    39407,
-    39411,
-    39414,
-    39417,
-    39421,
-    39424,
-    39427,
-    39431,
-    39434,
-    39437,
-    39441,
-    39444,
     39447,
-    39451,
-    39454,
-    39457,
-    39461,
-    39464,
-    39467,
-    39471,
-    39474,
-    39477,
-    39480,
-    39484,
-    39487,
-    39490,
-    39494,
-    39497,
     39500,
-    39504,
-    39507,
-    39510,
-    39514,
-    39517,
-    39520,
-    39524,
-    39527,
-    39530,
-    39534,
-    39537,
-    39540,
-    39544,
-    39547,
-    39550,
     39553,
-    39557,
-    39560,
-    39563,
-    39567,
-    39570,
-    39573,
-    39577,
-    39580,
-    39583,
-    39587,
-    39590,
-    39593,
-    39597,
-    39600,
-    39603,
     39606,
-    39610,
-    39613,
-    39616,
-    39620,
-    39623,
-    39626,
-    39630,
-    39633,
-    39636,
-    39640,
-    39643,
-    39646,
-    39649,
-    39653,
-    39656,
     39659,
-    39663,
-    39666,
-    39669,
-    39673,
-    39676,
-    39679,
-    39682,
-    39686,
-    39689,
-    39692,
-    39696,
-    39699,
-    39702,
-    39706,
-    39709,
     39712,
-    39715,
-    39719,
-    39722,
-    39725,
-    39729,
-    39732,
-    39735,
-    39739,
-    39742,
-    39745,
-    39748,
-    39752,
-    39755,
-    39758,
-    39762,
     39765,
-    39768,
-    39772,
-    39775,
-    39778,
-    39781,
-    39785,
-    39788,
-    39791,
-    39795,
-    39798,
-    39801,
-    39805,
-    39808,
-    39811,
-    39814,
     39818,
-    39821,
-    39824,
-    39828,
-    39831,
-    39834,
-    39837,
-    39841,
-    39844,
-    39847,
-    39851,
-    39854,
-    39857,
-    39860,
-    39864,
-    39867,
     39870,
-    39874,
-    39877,
-    39880,
-    39883,
-    39887,
-    39890,
-    39893,
-    39897,
-    39900,
-    39903,
-    39906,
-    39910,
-    39913,
-    39916,
-    39920,
     39923,
-    39926,
-    39929,
-    39933,
-    39936,
-    39939,
-    39943,
-    39946,
-    39949,
-    39952,
-    39956,
-    39959,
-    39962,
-    39966,
-    39969,
-    39972,
     39975,
-    39979,
-    39982,
-    39985,
-    39988,
-    39992,
-    39995,
-    39998,
-    40002,
-    40005,
-    40008,
-    40011,
-    40015,
-    40018,
-    40021,
-    40025,
     40028,
-    40031,
-    40034,
-    40038,
-    40041,
-    40044,
-    40047,
-    40051,
-    40054,
-    40057,
-    40061,
-    40064,
-    40067,
-    40070,
-    40074,
-    40077,
     40080,
-    40083,
-    40087,
-    40090,
-    40093,
-    40096,
-    40100,
-    40103,
-    40106,
-    40110,
-    40113,
-    40116,
-    40119,
-    40123,
-    40126,
-    40129,
     40132,
-    40136,
-    40139,
-    40142,
-    40146,
-    40149,
-    40152,
-    40155,
-    40159,
-    40162,
-    40165,
-    40168,
-    40172,
-    40175,
-    40178,
-    40181,
     40185,
-    40188,
-    40191,
-    40194,
-    40198,
-    40201,
-    40204,
-    40207,
-    40211,
-    40214,
-    40217,
-    40221,
-    40224,
-    40227,
-    40230,
-    40234,
     40237,
-    40240,
-    40243,
-    40247,
-    40250,
-    40253,
-    40256,
-    40260,
-    40263,
-    40266,
-    40269,
-    40273,
-    40276,
-    40279,
-    40282,
-    40286,
     40289,
-    40292,
-    40295,
-    40299,
-    40302,
-    40305,
-    40308,
-    40312,
-    40315,
-    40318,
-    40321,
-    40325,
-    40328,
-    40331,
-    40334,
-    40338,
     40341,
-    40344,
-    40347,
-    40351,
-    40354,
-    40357,
-    40360,
-    40364,
-    40367,
-    40370,
-    40373,
-    40377,
-    40380,
-    40383,
-    40386,
-    40390,
     40393,
-    40396,
-    40399,
-    40403,
-    40406,
-    40409,
-    40412,
-    40416,
-    40419,
-    40422,
-    40425,
-    40429,
-    40432,
-    40435,
-    40438,
-    40442,
     40445,
-    40448,
-    40451,
-    40454,
-    40458,
-    40461,
-    40464,
-    40467,
-    40471,
-    40474,
-    40477,
-    40480,
-    40484,
-    40487,
-    40490,
-    40493,
     40497,
-    40500,
-    40503,
-    40506,
-    40510,
-    40513,
-    40516,
-    40519,
-    40522,
-    40526,
-    40529,
-    40532,
-    40535,
-    40539,
-    40542,
-    40545,
     40548,
-    40552,
-    40555,
-    40558,
-    40561,
-    40564,
-    40568,
-    40571,
-    40574,
-    40577,
-    40581,
-    40584,
-    40587,
-    40590,
-    40594,
-    40597,
     40600,
-    40603,
-    40606,
-    40610,
-    40613,
-    40616,
-    40619,
-    40623,
-    40626,
-    40629,
-    40632,
-    40636,
-    40639,
-    40642,
-    40645,
-    40648,
     40652,
-    40655,
-    40658,
-    40661,
-    40665,
-    40668,
-    40671,
-    40674,
-    40677,
-    40681,
-    40684,
-    40687,
-    40690,
-    40694,
-    40697,
-    40700,
     40703,
-    40706,
-    40710,
-    40713,
-    40716,
-    40719,
-    40723,
-    40726,
-    40729,
-    40732,
-    40735,
-    40739,
-    40742,
-    40745,
-    40748,
-    40751,
     40755,
-    40758,
-    40761,
-    40764,
-    40768,
-    40771,
-    40774,
-    40777,
-    40780,
-    40784,
-    40787,
-    40790,
-    40793,
-    40796,
-    40800,
-    40803,
     40806,
-    40809,
-    40813,
-    40816,
-    40819,
-    40822,
-    40825,
-    40829,
-    40832,
-    40835,
-    40838,
-    40841,
-    40845,
-    40848,
-    40851,
-    40854,
     40857,
-    40861,
-    40864,
-    40867,
-    40870,
-    40874,
-    40877,
-    40880,
-    40883,
-    40886,
-    40890,
-    40893,
-    40896,
-    40899,
-    40902,
-    40906,
     40909,
-    40912,
-    40915,
-    40918,
-    40922,
-    40925,
-    40928,
-    40931,
-    40934,
-    40938,
-    40941,
-    40944,
-    40947,
-    40950,
-    40954,
-    40957,
     40960,
-    40963,
-    40966,
-    40970,
-    40973,
-    40976,
-    40979,
-    40982,
-    40986,
-    40989,
-    40992,
-    40995,
-    40998,
-    41002,
-    41005,
-    41008,
     41011,
-    41014,
-    41018,
-    41021,
-    41024,
-    41027,
-    41030,
-    41034,
-    41037,
-    41040,
-    41043,
-    41046,
-    41050,
-    41053,
-    41056,
-    41059,
     41062,
-    41065,
-    41069,
-    41072,
-    41075,
-    41078,
-    41081,
-    41085,
-    41088,
-    41091,
-    41094,
-    41097,
-    41101,
-    41104,
-    41107,
-    41110,
     41113,
-    41117,
-    41120,
-    41123,
-    41126,
-    41129,
-    41132,
-    41136,
-    41139,
-    41142,
-    41145,
-    41148,
-    41152,
-    41155,
-    41158,
-    41161,
     41164,
-    41167,
-    41171,
-    41174,
-    41177,
-    41180,
-    41183,
-    41187,
-    41190,
-    41193,
-    41196,
-    41199,
-    41202,
-    41206,
-    41209,
-    41212,
     41215,
-    41218,
-    41222,
-    41225,
-    41228,
-    41231,
-    41234,
-    41237,
-    41241,
-    41244,
-    41247,
-    41250,
-    41253,
-    41257,
-    41260,
-    41263,
     41266,
-    41269,
-    41272,
-    41276,
-    41279,
-    41282,
-    41285,
-    41288,
-    41291,
-    41295,
-    41298,
-    41301,
-    41304,
-    41307,
-    41311,
-    41314,
     41317,
-    41320,
-    41323,
-    41326,
-    41330,
-    41333,
-    41336,
-    41339,
-    41342,
-    41345,
-    41349,
-    41352,
-    41355,
-    41358,
-    41361,
-    41364,
     41368,
-    41371,
-    41374,
-    41377,
-    41380,
-    41383,
-    41387,
-    41390,
-    41393,
-    41396,
-    41399,
-    41402,
-    41406,
-    41409,
-    41412,
-    41415,
     41418,
-    41421,
-    41425,
-    41428,
-    41431,
-    41434,
-    41437,
-    41440,
-    41444,
-    41447,
-    41450,
-    41453,
-    41456,
-    41459,
-    41463,
-    41466,
     41469,
-    41472,
-    41475,
-    41478,
-    41481,
-    41485,
-    41488,
-    41491,
-    41494,
-    41497,
-    41500,
-    41504,
-    41507,
-    41510,
-    41513,
-    41516,
     41519,
-    41523,
-    41526,
-    41529,
-    41532,
-    41535,
-    41538,
-    41541,
-    41545,
-    41548,
-    41551,
-    41554,
-    41557,
-    41560,
-    41564,
-    41567,
     41570,
-    41573,
-    41576,
-    41579,
-    41582,
-    41586,
-    41589,
-    41592,
-    41595,
-    41598,
-    41601,
-    41605,
-    41608,
-    41611,
-    41614,
-    41617,
     41620,
-    41623,
-    41627,
-    41630,
-    41633,
-    41636,
-    41639,
-    41642,
-    41645,
-    41649,
-    41652,
-    41655,
-    41658,
-    41661,
-    41664,
-    41667,
     41671,
-    41674,
-    41677,
-    41680,
-    41683,
-    41686,
-    41690,
-    41693,
-    41696,
-    41699,
-    41702,
-    41705,
-    41708,
-    41712,
-    41715,
-    41718,
     41721,
-    41724,
-    41727,
-    41730,
-    41733,
-    41737,
-    41740,
-    41743,
-    41746,
-    41749,
-    41752,
-    41755,
-    41759,
-    41762,
-    41765,
-    41768,
     41771,
-    41774,
-    41777,
-    41781,
-    41784,
-    41787,
-    41790,
-    41793,
-    41796,
-    41799,
-    41803,
-    41806,
-    41809,
-    41812,
-    41815,
-    41818,
     41821,
-    41824,
-    41828,
-    41831,
-    41834,
-    41837,
-    41840,
-    41843,
-    41846,
-    41850,
-    41853,
-    41856,
-    41859,
-    41862,
-    41865,
-    41868,
     41871,
-    41875,
-    41878,
-    41881,
-    41884,
-    41887,
-    41890,
-    41893,
-    41896,
-    41900,
-    41903,
-    41906,
-    41909,
-    41912,
-    41915,
-    41918,
     41922,
-    41925,
-    41928,
-    41931,
-    41934,
-    41937,
-    41940,
-    41943,
-    41947,
-    41950,
-    41953,
-    41956,
-    41959,
-    41962,
-    41965,
-    41968,
     41972,
-    41975,
-    41978,
-    41981,
-    41984,
-    41987,
-    41990,
-    41993,
-    41996,
-    42000,
-    42003,
-    42006,
-    42009,
-    42012,
-    42015,
-    42018,
     42021,
-    42025,
-    42028,
-    42031,
-    42034,
-    42037,
-    42040,
-    42043,
-    42046,
-    42050,
-    42053,
-    42056,
-    42059,
-    42062,
-    42065,
-    42068,
     42071,
-    42074,
-    42078,
-    42081,
-    42084,
-    42087,
-    42090,
-    42093,
-    42096,
-    42099,
-    42102,
-    42106,
-    42109,
-    42112,
-    42115,
-    42118,
     42121,
-    42124,
-    42127,
-    42130,
-    42134,
-    42137,
-    42140,
-    42143,
-    42146,
-    42149,
-    42152,
-    42155,
-    42158,
-    42162,
-    42165,
-    42168,
     42171,
-    42174,
-    42177,
-    42180,
-    42183,
-    42186,
-    42190,
-    42193,
-    42196,
-    42199,
-    42202,
-    42205,
-    42208,
-    42211,
-    42214,
-    42217,
     42221,
-    42224,
-    42227,
-    42230,
-    42233,
-    42236,
-    42239,
-    42242,
-    42245,
-    42249,
-    42252,
-    42255,
-    42258,
-    42261,
-    42264,
-    42267,
     42270,
-    42273,
-    42276,
-    42280,
-    42283,
-    42286,
-    42289,
-    42292,
-    42295,
-    42298,
-    42301,
-    42304,
-    42307,
-    42311,
-    42314,
-    42317,
     42320,
-    42323,
-    42326,
-    42329,
-    42332,
-    42335,
-    42338,
-    42342,
-    42345,
-    42348,
-    42351,
-    42354,
-    42357,
-    42360,
-    42363,
-    42366,
     42369,
-    42372,
-    42376,
-    42379,
-    42382,
-    42385,
-    42388,
-    42391,
-    42394,
-    42397,
-    42400,
-    42403,
-    42406,
-    42410,
-    42413,
-    42416,
     42419,
-    42422,
-    42425,
-    42428,
-    42431,
-    42434,
-    42437,
-    42440,
-    42444,
-    42447,
-    42450,
-    42453,
-    42456,
-    42459,
-    42462,
-    42465,
     42468,
-    42471,
-    42474,
-    42477,
-    42481,
-    42484,
-    42487,
-    42490,
-    42493,
-    42496,
-    42499,
-    42502,
-    42505,
-    42508,
-    42511,
-    42515,
     42518,
-    42521,
-    42524,
-    42527,
-    42530,
-    42533,
-    42536,
-    42539,
-    42542,
-    42545,
-    42548,
-    42551,
-    42555,
-    42558,
-    42561,
-    42564,
     42567,
-    42570,
-    42573,
-    42576,
-    42579,
-    42582,
-    42585,
-    42588,
-    42592,
-    42595,
-    42598,
-    42601,
-    42604,
-    42607,
-    42610,
-    42613,
     42616,
-    42619,
-    42622,
-    42625,
-    42628,
-    42631,
-    42635,
-    42638,
-    42641,
-    42644,
-    42647,
-    42650,
-    42653,
-    42656,
-    42659,
-    42662,
     42665,
-    42668,
-    42671,
-    42675,
-    42678,
-    42681,
-    42684,
-    42687,
-    42690,
-    42693,
-    42696,
-    42699,
-    42702,
-    42705,
-    42708,
-    42711,
     42714,
-    42717,
-    42721,
-    42724,
-    42727,
-    42730,
-    42733,
-    42736,
-    42739,
-    42742,
-    42745,
-    42748,
-    42751,
-    42754,
-    42757,
-    42760,
     42763,
-    42767,
-    42770,
-    42773,
-    42776,
-    42779,
-    42782,
-    42785,
-    42788,
-    42791,
-    42794,
-    42797,
-    42800,
-    42803,
-    42806,
-    42809,
     42813,
-    42816,
-    42819,
-    42822,
-    42825,
-    42828,
-    42831,
-    42834,
-    42837,
-    42840,
-    42843,
-    42846,
-    42849,
-    42852,
-    42855,
-    42858,
     42861,
-    42865,
-    42868,
-    42871,
-    42874,
-    42877,
-    42880,
-    42883,
-    42886,
-    42889,
-    42892,
-    42895,
-    42898,
-    42901,
-    42904,
-    42907,
     42910,
-    42913,
-    42916,
-    42920,
-    42923,
-    42926,
-    42929,
-    42932,
-    42935,
-    42938,
-    42941,
-    42944,
-    42947,
-    42950,
-    42953,
-    42956,
     42959,
-    42962,
-    42965,
-    42968,
-    42971,
-    42974,
-    42978,
-    42981,
-    42984,
-    42987,
-    42990,
-    42993,
-    42996,
-    42999,
-    43002,
-    43005,
     43008,
-    43011,
-    43014,
-    43017,
-    43020,
-    43023,
-    43026,
-    43029,
-    43032,
-    43035,
-    43038,
-    43042,
-    43045,
-    43048,
-    43051,
-    43054,
     43057,
-    43060,
-    43063,
-    43066,
-    43069,
-    43072,
-    43075,
-    43078,
-    43081,
-    43084,
-    43087,
-    43090,
-    43093,
-    43096,
-    43099,
-    43102,
     43105,
-    43108,
-    43111,
-    43115,
-    43118,
-    43121,
-    43124,
-    43127,
-    43130,
-    43133,
-    43136,
-    43139,
-    43142,
-    43145,
-    43148,
-    43151,
     43154,
-    43157,
-    43160,
-    43163,
-    43166,
-    43169,
-    43172,
-    43175,
-    43178,
-    43181,
-    43184,
-    43187,
-    43190,
-    43194,
-    43197,
-    43200,
     43203,
-    43206,
-    43209,
-    43212,
-    43215,
-    43218,
-    43221,
-    43224,
-    43227,
-    43230,
-    43233,
-    43236,
-    43239,
-    43242,
-    43245,
-    43248,
     43251,
-    43254,
-    43257,
-    43260,
-    43263,
-    43266,
-    43269,
-    43272,
-    43275,
-    43278,
-    43281,
-    43284,
-    43287,
-    43291,
-    43294,
-    43297,
     43300,
-    43303,
-    43306,
-    43309,
-    43312,
-    43315,
-    43318,
-    43321,
-    43324,
-    43327,
-    43330,
-    43333,
-    43336,
-    43339,
-    43342,
-    43345,
     43348,
-    43351,
-    43354,
-    43357,
-    43360,
-    43363,
-    43366,
-    43369,
-    43372,
-    43375,
-    43378,
-    43381,
-    43384,
-    43387,
-    43390,
-    43393,
     43396,
-    43399,
-    43402,
-    43405,
-    43408,
-    43411,
-    43414,
-    43417,
-    43420,
-    43424,
-    43427,
-    43430,
-    43433,
-    43436,
-    43439,
-    43442,
     43445,
-    43448,
-    43451,
-    43454,
-    43457,
-    43460,
-    43463,
-    43466,
-    43469,
-    43472,
-    43475,
-    43478,
-    43481,
-    43484,
-    43487,
-    43490,
     43493,
-    43496,
-    43499,
-    43502,
-    43505,
-    43508,
-    43511,
-    43514,
-    43517,
-    43520,
-    43523,
-    43526,
-    43529,
-    43532,
-    43535,
-    43538,
     43541,
-    43544,
-    43547,
-    43550,
-    43553,
-    43556,
-    43559,
-    43562,
-    43565,
-    43568,
-    43571,
-    43574,
-    43577,
-    43580,
-    43583,
-    43586,
     43589,
-    43592,
-    43595,
-    43598,
-    43601,
-    43604,
-    43607,
-    43610,
-    43613,
-    43616,
-    43619,
-    43622,
-    43625,
-    43628,
-    43631,
-    43634,
     43637,
-    43640,
-    43643,
-    43646,
-    43649,
-    43652,
-    43655,
-    43658,
-    43661,
-    43664,
-    43667,
-    43670,
-    43673,
-    43676,
-    43679,
-    43682,
     43685,
-    43688,
-    43691,
-    43694,
-    43697,
-    43700,
-    43703,
-    43706,
-    43709,
-    43712,
-    43715,
-    43718,
-    43721,
-    43724,
-    43727,
-    43730,
     43733,
-    43736,
-    43739,
-    43742,
-    43745,
-    43748,
-    43751,
-    43754,
-    43757,
-    43760,
-    43763,
-    43766,
-    43769,
-    43772,
-    43775,
-    43778,
     43781,
-    43784,
-    43787,
-    43790,
-    43793,
-    43796,
-    43799,
-    43802,
-    43805,
-    43808,
-    43811,
-    43814,
-    43817,
-    43820,
-    43823,
-    43826,
     43829,
-    43832,
-    43835,
-    43838,
-    43841,
-    43844,
-    43847,
-    43850,
-    43853,
-    43856,
-    43859,
-    43862,
-    43865,
-    43868,
-    43871,
-    43874,
     43877,
-    43880,
-    43883,
-    43886,
-    43889,
-    43892,
-    43895,
-    43898,
-    43901,
-    43904,
-    43907,
-    43910,
-    43913,
-    43916,
-    43919,
-    43922,
     43925,
-    43928,
-    43931,
-    43934,
-    43937,
-    43940,
-    43943,
-    43946,
-    43949,
-    43952,
-    43955,
-    43958,
-    43961,
-    43963,
-    43966,
-    43969,
     43972,
-    43975,
-    43978,
-    43981,
-    43984,
-    43987,
-    43990,
-    43993,
-    43996,
-    43999,
-    44002,
-    44005,
-    44008,
-    44011,
-    44014,
-    44017,
     44020,
-    44023,
-    44026,
-    44029,
-    44032,
-    44035,
-    44038,
-    44041,
-    44044,
-    44047,
-    44050,
-    44053,
-    44056,
-    44059,
-    44062,
-    44065,
     44068,
-    44071,
-    44074,
-    44077,
-    44080,
-    44083,
-    44086,
-    44089,
-    44091,
-    44094,
-    44097,
-    44100,
-    44103,
-    44106,
-    44109,
-    44112,
     44115,
-    44118,
-    44121,
-    44124,
-    44127,
-    44130,
-    44133,
-    44136,
-    44139,
-    44142,
-    44145,
-    44148,
-    44151,
-    44154,
-    44157,
-    44160,
     44163,
-    44166,
-    44169,
-    44172,
-    44175,
-    44178,
-    44181,
-    44184,
-    44187,
-    44189,
-    44192,
-    44195,
-    44198,
-    44201,
-    44204,
-    44207,
     44210,
-    44213,
-    44216,
-    44219,
-    44222,
-    44225,
-    44228,
-    44231,
-    44234,
-    44237,
-    44240,
-    44243,
-    44246,
-    44249,
-    44252,
-    44255,
     44258,
-    44261,
-    44264,
-    44267,
-    44269,
-    44272,
-    44275,
-    44278,
-    44281,
-    44284,
-    44287,
-    44290,
-    44293,
-    44296,
-    44299,
-    44302,
     44305,
-    44308,
-    44311,
-    44314,
-    44317,
-    44320,
-    44323,
-    44326,
-    44329,
-    44332,
-    44335,
-    44338,
-    44341,
-    44343,
-    44346,
-    44349,
     44352,
-    44355,
-    44358,
-    44361,
-    44364,
-    44367,
-    44370,
-    44373,
-    44376,
-    44379,
-    44382,
-    44385,
-    44388,
-    44391,
-    44394,
-    44397,
     44400,
-    44403,
-    44405,
-    44408,
-    44411,
-    44414,
-    44417,
-    44420,
-    44423,
-    44426,
-    44429,
-    44432,
-    44435,
-    44438,
-    44441,
-    44444,
     44447,
-    44450,
-    44453,
-    44456,
-    44459,
-    44462,
-    44464,
-    44467,
-    44470,
-    44473,
-    44476,
-    44479,
-    44482,
-    44485,
-    44488,
-    44491,
     44494,
-    44497,
-    44500,
-    44503,
-    44506,
-    44509,
-    44512,
-    44515,
-    44518,
-    44520,
-    44523,
-    44526,
-    44529,
-    44532,
-    44535,
-    44538,
     44541,
-    44544,
-    44547,
-    44550,
-    44553,
-    44556,
-    44559,
-    44562,
-    44565,
-    44568,
-    44570,
-    44573,
-    44576,
-    44579,
-    44582,
-    44585,
     44588,
-    44591,
-    44594,
-    44597,
-    44600,
-    44603,
-    44606,
-    44609,
-    44612,
-    44615,
-    44618,
-    44620,
-    44623,
-    44626,
-    44629,
-    44632,
     44635,
-    44638,
-    44641,
-    44644,
-    44647,
-    44650,
-    44653,
-    44656,
-    44659,
-    44662,
-    44664,
-    44667,
-    44670,
-    44673,
-    44676,
-    44679,
     44682,
-    44685,
-    44688,
-    44691,
-    44694,
-    44697,
-    44700,
-    44703,
-    44706,
-    44708,
-    44711,
-    44714,
-    44717,
-    44720,
-    44723,
-    44726,
     44729,
-    44732,
-    44735,
-    44738,
-    44741,
-    44744,
-    44747,
-    44750,
-    44752,
-    44755,
-    44758,
-    44761,
-    44764,
-    44767,
-    44770,
-    44773,
     44776,
-    44779,
-    44782,
-    44785,
-    44788,
-    44790,
-    44793,
-    44796,
-    44799,
-    44802,
-    44805,
-    44808,
-    44811,
-    44814,
-    44817,
-    44820,
     44823,
-    44826,
-    44829,
-    44831,
-    44834,
-    44837,
-    44840,
-    44843,
-    44846,
-    44849,
-    44852,
-    44855,
-    44858,
-    44861,
-    44864,
-    44867,
     44869,
-    44872,
-    44875,
-    44878,
-    44881,
-    44884,
-    44887,
-    44890,
-    44893,
-    44896,
-    44899,
-    44902,
-    44904,
-    44907,
-    44910,
-    44913,
     44916,
-    44919,
-    44922,
-    44925,
-    44928,
-    44931,
-    44934,
-    44937,
-    44939,
-    44942,
-    44945,
-    44948,
-    44951,
-    44954,
-    44957,
-    44960,
     44963,
-    44966,
-    44969,
-    44972,
-    44974,
-    44977,
-    44980,
-    44983,
-    44986,
-    44989,
-    44992,
-    44995,
-    44998,
-    45001,
-    45004,
-    45007,
     45009,
-    45012,
-    45015,
-    45018,
-    45021,
-    45024,
-    45027,
-    45030,
-    45033,
-    45036,
-    45039,
-    45041,
-    45044,
-    45047,
-    45050,
-    45053,
     45056,
-    45059,
-    45062,
-    45065,
-    45068,
-    45071,
-    45073,
-    45076,
-    45079,
-    45082,
-    45085,
-    45088,
-    45091,
-    45094,
-    45097,
-    45100,
     45103,
-    45105,
-    45108,
-    45111,
-    45114,
-    45117,
-    45120,
-    45123,
-    45126,
-    45129,
-    45132,
-    45134,
-    45137,
-    45140,
-    45143,
-    45146,
     45149,
-    45152,
-    45155,
-    45158,
-    45161,
-    45164,
-    45166,
-    45169,
-    45172,
-    45175,
-    45178,
-    45181,
-    45184,
-    45187,
-    45190,
-    45193,
     45195,
-    45198,
-    45201,
-    45204,
-    45207,
-    45210,
-    45213,
-    45216,
-    45219,
-    45222,
-    45224,
-    45227,
-    45230,
-    45233,
-    45236,
-    45239,
     45242,
-    45245,
-    45248,
-    45250,
-    45253,
-    45256,
-    45259,
-    45262,
-    45265,
-    45268,
-    45271,
-    45274,
-    45277,
-    45279,
-    45282,
-    45285,
     45288,
-    45291,
-    45294,
-    45297,
-    45300,
-    45303,
-    45305,
-    45308,
-    45311,
-    45314,
-    45317,
-    45320,
-    45323,
-    45326,
-    45329,
-    45332,
     45334,
-    45337,
-    45340,
-    45343,
-    45346,
-    45349,
-    45352,
-    45355,
-    45358,
-    45360,
-    45363,
-    45366,
-    45369,
-    45372,
-    45375,
-    45378,
     45381,
-    45384,
-    45386,
-    45389,
-    45392,
-    45395,
-    45398,
-    45401,
-    45404,
-    45407,
-    45410,
-    45412,
-    45415,
-    45418,
-    45421,
-    45424,
     45427,
-    45430,
-    45433,
-    45435,
-    45438,
-    45441,
-    45444,
-    45447,
-    45450,
-    45453,
-    45456,
-    45459,
-    45461,
-    45464,
-    45467,
-    45470,
     45473,
-    45476,
-    45479,
-    45482,
-    45485,
-    45487,
-    45490,
-    45493,
-    45496,
-    45499,
-    45502,
-    45505,
-    45508,
-    45510,
-    45513,
-    45516,
     45519,
-    45522,
-    45525,
-    45528,
-    45531,
-    45533,
-    45536,
-    45539,
-    45542,
-    45545,
-    45548,
-    45551,
-    45554,
-    45556,
-    45559,
-    45562,
     45565,
-    45568,
-    45571,
-    45574,
-    45577,
-    45580,
-    45582,
-    45585,
-    45588,
-    45591,
-    45594,
-    45597,
-    45600,
-    45603,
-    45605,
-    45608,
     45611,
-    45614,
-    45617,
-    45620,
-    45623,
-    45625,
-    45628,
-    45631,
-    45634,
-    45637,
-    45640,
-    45643,
-    45646,
-    45648,
-    45651,
-    45654,
     45657,
-    45660,
-    45663,
-    45666,
-    45669,
-    45671,
-    45674,
-    45677,
-    45680,
-    45683,
-    45686,
-    45689,
-    45692,
-    45694,
-    45697,
-    45700,
     45703,
-    45706,
-    45709,
-    45712,
-    45714,
-    45717,
-    45720,
-    45723,
-    45726,
-    45729,
-    45732,
-    45735,
-    45737,
-    45740,
-    45743,
-    45746,
     45749,
-    45752,
-    45755,
-    45757,
-    45760,
-    45763,
-    45766,
-    45769,
-    45772,
-    45775,
-    45777,
-    45780,
-    45783,
-    45786,
-    45789,
-    45792,
     45795,
-    45798,
-    45800,
-    45803,
-    45806,
-    45809,
-    45812,
-    45815,
-    45818,
-    45820,
-    45823,
-    45826,
-    45829,
-    45832,
-    45835,
-    45838,
     45840,
-    45843,
-    45846,
-    45849,
-    45852,
-    45855,
-    45858,
-    45860,
-    45863,
-    45866,
-    45869,
-    45872,
-    45875,
-    45878,
-    45880,
-    45883,
     45886,
-    45889,
-    45892,
-    45895,
-    45898,
-    45900,
-    45903,
-    45906,
-    45909,
-    45912,
-    45915,
-    45918,
-    45920,
-    45923,
-    45926,
-    45929,
     45932,
-    45935,
-    45938,
-    45940,
-    45943,
-    45946,
-    45949,
-    45952,
-    45955,
-    45958,
-    45960,
-    45963,
-    45966,
-    45969,
-    45972,
-    45975,
     45977,
-    45980,
-    45983,
-    45986,
-    45989,
-    45992,
-    45995,
-    45997,
-    46000,
-    46003,
-    46006,
-    46009,
-    46012,
-    46015,
-    46017,
-    46020,
     46023,
-    46026,
-    46029,
-    46032,
-    46034,
-    46037,
-    46040,
-    46043,
-    46046,
-    46049,
-    46052,
-    46054,
-    46057,
-    46060,
-    46063,
-    46066,
     46069,
-    46071,
-    46074,
-    46077,
-    46080,
-    46083,
-    46086,
-    46089,
-    46091,
-    46094,
-    46097,
-    46100,
-    46103,
-    46106,
-    46108,
-    46111,
     46114,
-    46117,
-    46120,
-    46123,
-    46125,
-    46128,
-    46131,
-    46134,
-    46137,
-    46140,
-    46143,
-    46145,
-    46148,
-    46151,
-    46154,
-    46157,
     46160,
-    46162,
-    46165,
-    46168,
-    46171,
-    46174,
-    46177,
-    46179,
-    46182,
-    46185,
-    46188,
-    46191,
-    46194,
-    46196,
-    46199,
-    46202,
     46205,
-    46208,
-    46211,
-    46213,
-    46216,
-    46219,
-    46222,
-    46225,
-    46228,
-    46231,
-    46233,
-    46236,
-    46239,
-    46242,
-    46245,
-    46248,
     46250,
-    46253,
-    46256,
-    46259,
-    46262,
-    46265,
-    46267,
-    46270,
-    46273,
-    46276,
-    46279,
-    46282,
-    46284,
-    46287,
-    46290,
-    46293,
     46296,
-    46299,
-    46301,
-    46304,
-    46307,
-    46310,
-    46313,
-    46315,
-    46318,
-    46321,
-    46324,
-    46327,
-    46330,
-    46332,
-    46335,
-    46338,
     46341,
-    46344,
-    46347,
-    46349,
-    46352,
-    46355,
-    46358,
-    46361,
-    46364,
-    46366,
-    46369,
-    46372,
-    46375,
-    46378,
-    46381,
-    46383,
     46386,
-    46389,
-    46392,
-    46395,
-    46397,
-    46400,
-    46403,
-    46406,
-    46409,
-    46412,
-    46414,
-    46417,
-    46420,
-    46423,
-    46426,
-    46429,
     46431,
-    46434,
-    46437,
-    46440,
-    46443,
-    46445,
-    46448,
-    46451,
-    46454,
-    46457,
-    46460,
-    46462,
-    46465,
-    46468,
-    46471,
-    46474,
     46477,
-    46479,
-    46482,
-    46485,
-    46488,
-    46491,
-    46493,
-    46496,
-    46499,
-    46502,
-    46505,
-    46508,
-    46510,
-    46513,
-    46516,
-    46519,
     46522,
-    46524,
-    46527,
-    46530,
-    46533,
-    46536,
-    46539,
-    46541,
-    46544,
-    46547,
-    46550,
-    46553,
-    46555,
-    46558,
-    46561,
-    46564,
     46567,
-    46569,
-    46572,
-    46575,
-    46578,
-    46581,
-    46584,
-    46586,
-    46589,
-    46592,
-    46595,
-    46598,
-    46600,
-    46603,
-    46606,
-    46609,
     46612,
-    46615,
-    46617,
-    46620,
-    46623,
-    46626,
-    46629,
-    46631,
-    46634,
-    46637,
-    46640,
-    46643,
-    46645,
-    46648,
-    46651,
-    46654,
     46657,
-    46659,
-    46662,
-    46665,
-    46668,
-    46671,
-    46674,
-    46676,
-    46679,
-    46682,
-    46685,
-    46688,
-    46690,
-    46693,
-    46696,
-    46699,
     46702,
-    46704,
-    46707,
-    46710,
-    46713,
-    46716,
-    46718,
-    46721,
-    46724,
-    46727,
-    46730,
-    46732,
-    46735,
-    46738,
-    46741,
-    46744,
     46746,
-    46749,
-    46752,
-    46755,
-    46758,
-    46760,
-    46763,
-    46766,
-    46769,
-    46772,
-    46774,
-    46777,
-    46780,
-    46783,
-    46786,
-    46789,
     46791,
-    46794,
-    46797,
-    46800,
-    46803,
-    46805,
-    46808,
-    46811,
-    46814,
-    46817,
-    46819,
-    46822,
-    46825,
-    46828,
-    46831,
-    46833,
     46836,
-    46839,
-    46842,
-    46845,
-    46847,
-    46850,
-    46853,
-    46856,
-    46858,
-    46861,
-    46864,
-    46867,
-    46870,
-    46872,
-    46875,
-    46878,
     46881,
-    46884,
-    46886,
-    46889,
-    46892,
-    46895,
-    46898,
-    46900,
-    46903,
-    46906,
-    46909,
-    46912,
-    46914,
-    46917,
-    46920,
-    46923,
     46926,
-    46928,
-    46931,
-    46934,
-    46937,
-    46940,
-    46942,
-    46945,
-    46948,
-    46951,
-    46953,
-    46956,
-    46959,
-    46962,
-    46965,
-    46967,
     46970,
-    46973,
-    46976,
-    46979,
-    46981,
-    46984,
-    46987,
-    46990,
-    46993,
-    46995,
-    46998,
-    47001,
-    47004,
-    47007,
-    47009,
-    47012,
     47015,
-    47018,
-    47020,
-    47023,
-    47026,
-    47029,
-    47032,
-    47034,
-    47037,
-    47040,
-    47043,
-    47046,
-    47048,
-    47051,
-    47054,
-    47057,
     47059,
-    47062,
-    47065,
-    47068,
-    47071,
-    47073,
-    47076,
-    47079,
-    47082,
-    47085,
-    47087,
-    47090,
-    47093,
-    47096,
-    47098,
-    47101,
     47104,
-    47107,
-    47110,
-    47112,
-    47115,
-    47118,
-    47121,
-    47123,
-    47126,
-    47129,
-    47132,
-    47135,
-    47137,
-    47140,
-    47143,
-    47146,
     47149,
-    47151,
-    47154,
-    47157,
-    47160,
-    47162,
-    47165,
-    47168,
-    47171,
-    47174,
-    47176,
-    47179,
-    47182,
-    47185,
-    47187,
-    47190,
     47193,
-    47196,
-    47199,
-    47201,
-    47204,
-    47207,
-    47210,
-    47212,
-    47215,
-    47218,
-    47221,
-    47224,
-    47226,
-    47229,
-    47232,
-    47235,
     47237,
-    47240,
-    47243,
-    47246,
-    47248,
-    47251,
-    47254,
-    47257,
-    47260,
-    47262,
-    47265,
-    47268,
-    47271,
-    47273,
-    47276,
-    47279,
     47282,
-    47285,
-    47287,
-    47290,
-    47293,
-    47296,
-    47298,
-    47301,
-    47304,
-    47307,
-    47309,
-    47312,
-    47315,
-    47318,
-    47321,
-    47323,
     47326,
-    47329,
-    47332,
-    47334,
-    47337,
-    47340,
-    47343,
-    47345,
-    47348,
-    47351,
-    47354,
-    47357,
-    47359,
-    47362,
-    47365,
-    47368,
     47370,
-    47373,
-    47376,
-    47379,
-    47381,
-    47384,
-    47387,
-    47390,
-    47393,
-    47395,
-    47398,
-    47401,
-    47404,
-    47406,
-    47409,
-    47412,
     47415,
-    47417,
-    47420,
-    47423,
-    47426,
-    47428,
-    47431,
-    47434,
-    47437,
-    47440,
-    47442,
-    47445,
-    47448,
-    47451,
-    47453,
-    47456,
     47459,
-    47462,
-    47464,
-    47467,
-    47470,
-    47473,
-    47475,
-    47478,
-    47481,
-    47484,
-    47486,
-    47489,
-    47492,
-    47495,
-    47497,
-    47500,
     47503,
-    47506,
-    47509,
-    47511,
-    47514,
-    47517,
-    47520,
-    47522,
-    47525,
-    47528,
-    47531,
-    47533,
-    47536,
-    47539,
-    47542,
-    47544,
     47547,
-    47550,
-    47553,
-    47555,
-    47558,
-    47561,
-    47564,
-    47566,
-    47569,
-    47572,
-    47575,
-    47577,
-    47580,
-    47583,
-    47586,
-    47588,
     47591,
-    47594,
-    47597,
-    47599,
-    47602,
-    47605,
-    47608,
-    47610,
-    47613,
-    47616,
-    47619,
-    47622,
-    47624,
-    47627,
-    47630,
-    47633,
     47635,
-    47638,
-    47641,
-    47644,
-    47646,
-    47649,
-    47652,
-    47655,
-    47657,
-    47660,
-    47663,
-    47666,
-    47668,
-    47671,
-    47674,
-    47677,
     47679,
-    47682,
-    47685,
-    47688,
-    47690,
-    47693,
-    47696,
-    47699,
-    47701,
-    47704,
-    47707,
-    47709,
-    47712,
-    47715,
-    47718,
-    47720,
     47723,
-    47726,
-    47729,
-    47731,
-    47734,
-    47737,
-    47740,
-    47742,
-    47745,
-    47748,
-    47751,
-    47753,
-    47756,
-    47759,
-    47762,
-    47764,
     47767,
-    47770,
-    47773,
-    47775,
-    47778,
-    47781,
-    47784,
-    47786,
-    47789,
-    47792,
-    47795,
-    47797,
-    47800,
-    47803,
-    47806,
-    47808,
     47811,
-    47814,
-    47817,
-    47819,
-    47822,
-    47825,
-    47827,
-    47830,
-    47833,
-    47836,
-    47838,
-    47841,
-    47844,
-    47847,
-    47849,
-    47852,
     47855,
-    47858,
-    47860,
-    47863,
-    47866,
-    47869,
-    47871,
-    47874,
-    47877,
-    47880,
-    47882,
-    47885,
-    47888,
-    47890,
-    47893,
-    47896,
     47899,
-    47901,
-    47904,
-    47907,
-    47910,
-    47912,
-    47915,
-    47918,
-    47921,
-    47923,
-    47926,
-    47929,
-    47932,
-    47934,
-    47937,
-    47940,
     47942,
-    47945,
-    47948,
-    47951,
-    47953,
-    47956,
-    47959,
-    47962,
-    47964,
-    47967,
-    47970,
-    47973,
-    47975,
-    47978,
-    47981,
-    47983,
     47986,
-    47989,
-    47992,
-    47994,
-    47997,
-    48000,
-    48003,
-    48005,
-    48008,
-    48011,
-    48013,
-    48016,
-    48019,
-    48022,
-    48024,
-    48027,
     48030,
-    48033,
-    48035,
-    48038,
-    48041,
-    48044,
-    48046,
-    48049,
-    48052,
-    48054,
-    48057,
-    48060,
-    48063,
-    48065,
-    48068,
-    48071,
     48074,
-    48076,
-    48079,
-    48082,
-    48084,
-    48087,
-    48090,
-    48093,
-    48095,
-    48098,
-    48101,
-    48103,
-    48106,
-    48109,
-    48112,
-    48114,
     48117,
-    48120,
-    48123,
-    48125,
-    48128,
-    48131,
-    48133,
-    48136,
-    48139,
-    48142,
-    48144,
-    48147,
-    48150,
-    48153,
-    48155,
-    48158,
     48161,
-    48163,
-    48166,
-    48169,
-    48172,
-    48174,
-    48177,
-    48180,
-    48182,
-    48185,
-    48188,
-    48191,
-    48193,
-    48196,
-    48199,
-    48201,
     48204,
-    48207,
-    48210,
-    48212,
-    48215,
-    48218,
-    48221,
-    48223,
-    48226,
-    48229,
-    48231,
-    48234,
-    48237,
-    48240,
-    48242,
-    48245,
     48248,
-    48250,
-    48253,
-    48256,
-    48259,
-    48261,
-    48264,
-    48267,
-    48269,
-    48272,
-    48275,
-    48278,
-    48280,
-    48283,
-    48286,
-    48288,
     48291,
-    48294,
-    48297,
-    48299,
-    48302,
-    48305,
-    48307,
-    48310,
-    48313,
-    48316,
-    48318,
-    48321,
-    48324,
-    48326,
-    48329,
-    48332,
     48335,
-    48337,
-    48340,
-    48343,
-    48345,
-    48348,
-    48351,
-    48354,
-    48356,
-    48359,
-    48362,
-    48364,
-    48367,
-    48370,
-    48372,
-    48375,
     48378,
-    48381,
-    48383,
-    48386,
-    48389,
-    48391,
-    48394,
-    48397,
-    48400,
-    48402,
-    48405,
-    48408,
-    48410,
-    48413,
-    48416,
-    48419,
     48421,
-    48424,
-    48427,
-    48429,
-    48432,
-    48435,
-    48437,
-    48440,
-    48443,
-    48446,
-    48448,
-    48451,
-    48454,
-    48456,
-    48459,
-    48462,
     48465,
-    48467,
-    48470,
-    48473,
-    48475,
-    48478,
-    48481,
-    48483,
-    48486,
-    48489,
-    48492,
-    48494,
-    48497,
-    48500,
-    48502,
-    48505,
     48508,
-    48510,
-    48513,
-    48516,
-    48519,
-    48521,
-    48524,
-    48527,
-    48529,
-    48532,
-    48535,
-    48537,
-    48540,
-    48543,
-    48546,
-    48548,
     48551,
-    48554,
-    48556,
-    48559,
-    48562,
-    48564,
-    48567,
-    48570,
-    48573,
-    48575,
-    48578,
-    48581,
-    48583,
-    48586,
-    48589,
-    48591,
     48594,
-    48597,
-    48600,
-    48602,
-    48605,
-    48608,
-    48610,
-    48613,
-    48616,
-    48618,
-    48621,
-    48624,
-    48627,
-    48629,
-    48632,
-    48635,
     48637,
-    48640,
-    48643,
-    48645,
-    48648,
-    48651,
-    48653,
-    48656,
-    48659,
-    48662,
-    48664,
-    48667,
-    48670,
-    48672,
-    48675,
-    48678,
     48680,
-    48683,
-    48686,
-    48688,
-    48691,
-    48694,
-    48697,
-    48699,
-    48702,
-    48705,
-    48707,
-    48710,
-    48713,
-    48715,
-    48718,
-    48721,
     48723,
-    48726,
-    48729,
-    48732,
-    48734,
-    48737,
-    48740,
-    48742,
-    48745,
-    48748,
-    48750,
-    48753,
-    48756,
-    48758,
-    48761,
-    48764,
     48766,
-    48769,
-    48772,
-    48775,
-    48777,
-    48780,
-    48783,
-    48785,
-    48788,
-    48791,
-    48793,
-    48796,
-    48799,
-    48801,
-    48804,
-    48807,
     48809,
-    48812,
-    48815,
-    48818,
-    48820,
-    48823,
-    48826,
-    48828,
-    48831,
-    48834,
-    48836,
-    48839,
-    48842,
-    48844,
-    48847,
-    48850,
     48852,
-    48855,
-    48858,
-    48860,
-    48863,
-    48866,
-    48869,
-    48871,
-    48874,
-    48877,
-    48879,
-    48882,
-    48885,
-    48887,
-    48890,
-    48893,
     48895,
-    48898,
-    48901,
-    48903,
-    48906,
-    48909,
-    48911,
-    48914,
-    48917,
-    48919,
-    48922,
-    48925,
-    48927,
-    48930,
-    48933,
-    48936,
     48938,
-    48941,
-    48944,
-    48946,
-    48949,
-    48952,
-    48954,
-    48957,
-    48960,
-    48962,
-    48965,
-    48968,
-    48970,
-    48973,
-    48976,
-    48978,
     48981,
-    48984,
-    48986,
-    48989,
-    48992,
-    48994,
-    48997,
-    49000,
-    49002,
-    49005,
-    49008,
-    49010,
-    49013,
-    49016,
-    49018,
-    49021,
     49024,
-    49027,
-    49029,
-    49032,
-    49035,
-    49037,
-    49040,
-    49043,
-    49045,
-    49048,
-    49051,
-    49053,
-    49056,
-    49059,
-    49061,
-    49064,
     49067,
-    49069,
-    49072,
-    49075,
-    49077,
-    49080,
-    49083,
-    49085,
-    49088,
-    49091,
-    49093,
-    49096,
-    49099,
-    49101,
-    49104,
-    49107,
     49109,
-    49112,
-    49115,
-    49117,
-    49120,
-    49123,
-    49125,
-    49128,
-    49131,
-    49133,
-    49136,
-    49139,
-    49141,
-    49144,
-    49147,
-    49149,
     49152,
-    49155,
-    49157,
-    49160,
-    49163,
-    49165,
-    49168,
-    49171,
-    49173,
-    49176,
-    49179,
-    49181,
-    49184,
-    49187,
-    49189,
-    49192,
     49195,
-    49197,
-    49200,
-    49203,
-    49205,
-    49208,
-    49211,
-    49213,
-    49216,
-    49219,
-    49221,
-    49224,
-    49227,
-    49229,
-    49232,
-    49235,
     49237,
-    49240,
-    49243,
-    49245,
-    49248,
-    49251,
-    49253,
-    49256,
-    49259,
-    49261,
-    49264,
-    49267,
-    49269,
-    49272,
-    49275,
-    49277,
     49280,
-    49282,
-    49285,
-    49288,
-    49290,
-    49293,
-    49296,
-    49298,
-    49301,
-    49304,
-    49306,
-    49309,
-    49312,
-    49314,
-    49317,
-    49320,
     49322,
-    49325,
-    49328,
-    49330,
-    49333,
-    49336,
-    49338,
-    49341,
-    49344,
-    49346,
-    49349,
-    49352,
-    49354,
-    49357,
-    49360,
-    49362,
     49365,
-    49368,
-    49370,
-    49373,
-    49375,
-    49378,
-    49381,
-    49383,
-    49386,
-    49389,
-    49391,
-    49394,
-    49397,
-    49399,
-    49402,
-    49405,
     49407,
-    49410,
-    49413,
-    49415,
-    49418,
-    49421,
-    49423,
-    49426,
-    49429,
-    49431,
-    49434,
-    49437,
-    49439,
-    49442,
-    49444,
-    49447,
     49450,
-    49452,
-    49455,
-    49458,
-    49460,
-    49463,
-    49466,
-    49468,
-    49471,
-    49474,
-    49476,
-    49479,
-    49482,
-    49484,
-    49487,
-    49490,
     49492,
-    49495,
-    49497,
-    49500,
-    49503,
-    49505,
-    49508,
-    49511,
-    49513,
-    49516,
-    49519,
-    49521,
-    49524,
-    49527,
-    49529,
-    49532,
     49535,
-    49537,
-    49540,
-    49542,
-    49545,
-    49548,
-    49550,
-    49553,
-    49556,
-    49558,
-    49561,
-    49564,
-    49566,
-    49569,
-    49572,
-    49574,
     49577,
-    49579,
-    49582,
-    49585,
-    49587,
-    49590,
-    49593,
-    49595,
-    49598,
-    49601,
-    49603,
-    49606,
-    49609,
-    49611,
-    49614,
-    49616,
     49619,
-    49622,
-    49624,
-    49627,
-    49630,
-    49632,
-    49635,
-    49638,
-    49640,
-    49643,
-    49646,
-    49648,
-    49651,
-    49653,
-    49656,
-    49659,
     49661,
-    49664,
-    49667,
-    49669,
-    49672,
-    49675,
-    49677,
-    49680,
-    49682,
-    49685,
-    49688,
-    49690,
-    49693,
-    49696,
-    49698,
-    49701,
     49704,
-    49706,
-    49709,
-    49711,
-    49714,
-    49717,
-    49719,
-    49722,
-    49725,
-    49727,
-    49730,
-    49733,
-    49735,
-    49738,
-    49740,
-    49743,
     49746,
-    49748,
-    49751,
-    49754,
-    49756,
-    49759,
-    49762,
-    49764,
-    49767,
-    49769,
-    49772,
-    49775,
-    49777,
-    49780,
-    49783,
-    49785,
     49788,
-    49791,
-    49793,
-    49796,
-    49798,
-    49801,
-    49804,
-    49806,
-    49809,
-    49812,
-    49814,
-    49817,
-    49819,
-    49822,
-    49825,
-    49827,
     49830,
-    49833,
-    49835,
-    49838,
-    49841,
-    49843,
-    49846,
-    49848,
-    49851,
-    49854,
-    49856,
-    49859,
-    49862,
-    49864,
-    49867,
-    49869,
     49872,
-    49875,
-    49877,
-    49880,
-    49883,
-    49885,
-    49888,
-    49890,
-    49893,
-    49896,
-    49898,
-    49901,
-    49904,
-    49906,
-    49909,
-    49911,
     49914,
-    49917,
-    49919,
-    49922,
-    49925,
-    49927,
-    49930,
-    49932,
-    49935,
-    49938,
-    49940,
-    49943,
-    49946,
-    49948,
-    49951,
-    49953,
     49956,
-    49959,
-    49961,
-    49964,
-    49967,
-    49969,
-    49972,
-    49974,
-    49977,
-    49980,
-    49982,
-    49985,
-    49988,
-    49990,
-    49993,
-    49995,
     49998,
-    50001,
-    50003,
-    50006,
-    50009,
-    50011,
-    50014,
-    50016,
-    50019,
-    50022,
-    50024,
-    50027,
-    50030,
-    50032,
-    50035,
-    50037,
     50040,
-    50043,
-    50045,
-    50048,
-    50050,
-    50053,
-    50056,
-    50058,
-    50061,
-    50064,
-    50066,
-    50069,
-    50071,
-    50074,
-    50077,
-    50079,
     50082,
-    50084,
-    50087,
-    50090,
-    50092,
-    50095,
-    50098,
-    50100,
-    50103,
-    50105,
-    50108,
-    50111,
-    50113,
-    50116,
-    50118,
-    50121,
     50124,
-    50126,
-    50129,
-    50132,
-    50134,
-    50137,
-    50139,
-    50142,
-    50145,
-    50147,
-    50150,
-    50152,
-    50155,
-    50158,
-    50160,
-    50163,
     50166,
-    50168,
-    50171,
-    50173,
-    50176,
-    50179,
-    50181,
-    50184,
-    50186,
-    50189,
-    50192,
-    50194,
-    50197,
-    50200,
-    50202,
-    50205,
     50207,
-    50210,
-    50213,
-    50215,
-    50218,
-    50220,
-    50223,
-    50226,
-    50228,
-    50231,
-    50233,
-    50236,
-    50239,
-    50241,
-    50244,
-    50246,
     50249,
-    50252,
-    50254,
-    50257,
-    50260,
-    50262,
-    50265,
-    50267,
-    50270,
-    50273,
-    50275,
-    50278,
-    50280,
-    50283,
-    50286,
-    50288,
     50291,
-    50293,
-    50296,
-    50299,
-    50301,
-    50304,
-    50306,
-    50309,
-    50312,
-    50314,
-    50317,
-    50319,
-    50322,
-    50325,
-    50327,
-    50330,
     50332,
-    50335,
-    50338,
-    50340,
-    50343,
-    50346,
-    50348,
-    50351,
-    50353,
-    50356,
-    50359,
-    50361,
-    50364,
-    50366,
-    50369,
-    50372,
     50374,
-    50377,
-    50379,
-    50382,
-    50385,
-    50387,
-    50390,
-    50392,
-    50395,
-    50398,
-    50400,
-    50403,
-    50405,
-    50408,
-    50411,
-    50413,
     50416,
-    50418,
-    50421,
-    50424,
-    50426,
-    50429,
-    50431,
-    50434,
-    50437,
-    50439,
-    50442,
-    50444,
-    50447,
-    50450,
-    50452,
-    50455,
     50457,
-    50460,
-    50463,
-    50465,
-    50468,
-    50470,
-    50473,
-    50476,
-    50478,
-    50481,
-    50483,
-    50486,
-    50488,
-    50491,
-    50494,
-    50496,
     50499,
-    50501,
-    50504,
-    50507,
-    50509,
-    50512,
-    50514,
-    50517,
-    50520,
-    50522,
-    50525,
-    50527,
-    50530,
-    50533,
-    50535,
-    50538,
     50540,
-    50543,
-    50546,
-    50548,
-    50551,
-    50553,
-    50556,
-    50559,
-    50561,
-    50564,
-    50566,
-    50569,
-    50572,
-    50574,
-    50577,
-    50579,
     50582,
-    50584,
-    50587,
-    50590,
-    50592,
-    50595,
-    50597,
-    50600,
-    50603,
-    50605,
-    50608,
-    50610,
-    50613,
-    50616,
-    50618,
-    50621,
     50623,
-    50626,
-    50628,
-    50631,
-    50634,
-    50636,
-    50639,
-    50641,
-    50644,
-    50647,
-    50649,
-    50652,
-    50654,
-    50657,
-    50660,
-    50662,
     50665,
-    50667,
-    50670,
-    50672,
-    50675,
-    50678,
-    50680,
-    50683,
-    50685,
-    50688,
-    50691,
-    50693,
-    50696,
-    50698,
-    50701,
-    50704,
     50706,
-    50709,
-    50711,
-    50714,
-    50716,
-    50719,
-    50722,
-    50724,
-    50727,
-    50729,
-    50732,
-    50735,
-    50737,
-    50740,
-    50742,
-    50745,
     50747,
-    50750,
-    50753,
-    50755,
-    50758,
-    50760,
-    50763,
-    50766,
-    50768,
-    50771,
-    50773,
-    50776,
-    50778,
-    50781,
-    50784,
-    50786,
     50789,
-    50791,
-    50794,
-    50796,
-    50799,
-    50802,
-    50804,
-    50807,
-    50809,
-    50812,
-    50815,
-    50817,
-    50820,
-    50822,
-    50825,
-    50827,
     50830,
-    50833,
-    50835,
-    50838,
-    50840,
-    50843,
-    50845,
-    50848,
-    50851,
-    50853,
-    50856,
-    50858,
-    50861,
-    50864,
-    50866,
-    50869,
     50871,
-    50874,
-    50876,
-    50879,
-    50882,
-    50884,
-    50887,
-    50889,
-    50892,
-    50894,
-    50897,
-    50900,
-    50902,
-    50905,
-    50907,
-    50910,
     50912,
-    50915,
-    50918,
-    50920,
-    50923,
-    50925,
-    50928,
-    50930,
-    50933,
-    50936,
-    50938,
-    50941,
-    50943,
-    50946,
-    50949,
-    50951,
     50954,
-    50956,
-    50959,
-    50961,
-    50964,
-    50967,
-    50969,
-    50972,
-    50974,
-    50977,
-    50979,
-    50982,
-    50985,
-    50987,
-    50990,
-    50992,
     50995,
-    50997,
-    51000,
-    51002,
-    51005,
-    51008,
-    51010,
-    51013,
-    51015,
-    51018,
-    51020,
-    51023,
-    51026,
-    51028,
-    51031,
-    51033,
     51036,
-    51038,
-    51041,
-    51044,
-    51046,
-    51049,
-    51051,
-    51054,
-    51056,
-    51059,
-    51062,
-    51064,
-    51067,
-    51069,
-    51072,
-    51074,
     51077,
-    51080,
-    51082,
-    51085,
-    51087,
-    51090,
-    51092,
-    51095,
-    51097,
-    51100,
-    51103,
-    51105,
-    51108,
-    51110,
-    51113,
-    51115,
     51118,
-    51121,
-    51123,
-    51126,
-    51128,
-    51131,
-    51133,
-    51136,
-    51139,
-    51141,
-    51144,
-    51146,
-    51149,
-    51151,
-    51154,
-    51156,
     51159,
-    51162,
-    51164,
-    51167,
-    51169,
-    51172,
-    51174,
-    51177,
-    51180,
-    51182,
-    51185,
-    51187,
-    51190,
-    51192,
-    51195,
-    51197,
     51200,
-    51203,
-    51205,
-    51208,
-    51210,
-    51213,
-    51215,
-    51218,
-    51220,
-    51223,
-    51226,
-    51228,
-    51231,
-    51233,
-    51236,
-    51238,
     51241,
-    51244,
-    51246,
-    51249,
-    51251,
-    51254,
-    51256,
-    51259,
-    51261,
-    51264,
-    51267,
-    51269,
-    51272,
-    51274,
-    51277,
-    51279,
     51282,
-    51284,
-    51287,
-    51290,
-    51292,
-    51295,
-    51297,
-    51300,
-    51302,
-    51305,
-    51307,
-    51310,
-    51313,
-    51315,
-    51318,
-    51320,
     51323,
-    51325,
-    51328,
-    51330,
-    51333,
-    51336,
-    51338,
-    51341,
-    51343,
-    51346,
-    51348,
-    51351,
-    51353,
-    51356,
-    51358,
-    51361,
     51364,
-    51366,
-    51369,
-    51371,
-    51374,
-    51376,
-    51379,
-    51381,
-    51384,
-    51387,
-    51389,
-    51392,
-    51394,
-    51397,
-    51399,
-    51402,
     51404,
-    51407,
-    51409,
-    51412,
-    51415,
-    51417,
-    51420,
-    51422,
-    51425,
-    51427,
-    51430,
-    51432,
-    51435,
-    51438,
-    51440,
-    51443,
     51445,
-    51448,
-    51450,
-    51453,
-    51455,
-    51458,
-    51460,
-    51463,
-    51466,
-    51468,
-    51471,
-    51473,
-    51476,
-    51478,
-    51481,
-    51483,
     51486,
-    51488,
-    51491,
-    51494,
-    51496,
-    51499,
-    51501,
-    51504,
-    51506,
-    51509,
-    51511,
-    51514,
-    51516,
-    51519,
-    51522,
-    51524,
     51527,
-    51529,
-    51532,
-    51534,
-    51537,
-    51539,
-    51542,
-    51544,
-    51547,
-    51550,
-    51552,
-    51555,
-    51557,
-    51560,
-    51562,
-    51565,
     51567,
-    51570,
-    51572,
-    51575,
-    51577,
-    51580,
-    51583,
-    51585,
-    51588,
-    51590,
-    51593,
-    51595,
-    51598,
-    51600,
-    51603,
-    51605,
     51608,
-    51611,
-    51613,
-    51616,
-    51618,
-    51621,
-    51623,
-    51626,
-    51628,
-    51631,
-    51633,
-    51636,
-    51638,
-    51641,
-    51644,
-    51646,
     51649,
-    51651,
-    51654,
-    51656,
-    51659,
-    51661,
-    51664,
-    51666,
-    51669,
-    51671,
-    51674,
-    51677,
-    51679,
-    51682,
-    51684,
-    51687,
     51689,
-    51692,
-    51694,
-    51697,
-    51699,
-    51702,
-    51704,
-    51707,
-    51709,
-    51712,
-    51715,
-    51717,
-    51720,
-    51722,
-    51725,
-    51727,
     51730,
-    51732,
-    51735,
-    51737,
-    51740,
-    51742,
-    51745,
-    51747,
-    51750,
-    51753,
-    51755,
-    51758,
-    51760,
-    51763,
-    51765,
-    51768,
     51770,
-    51773,
-    51775,
-    51778,
-    51780,
-    51783,
-    51785,
-    51788,
-    51791,
-    51793,
-    51796,
-    51798,
-    51801,
-    51803,
-    51806,
-    51808,
     51811,
-    51813,
-    51816,
-    51818,
-    51821,
-    51823,
-    51826,
-    51828,
-    51831,
-    51834,
-    51836,
-    51839,
-    51841,
-    51844,
-    51846,
-    51849,
     51851,
-    51854,
-    51856,
-    51859,
-    51861,
-    51864,
-    51866,
-    51869,
-    51871,
-    51874,
-    51876,
-    51879,
-    51882,
-    51884,
-    51887,
-    51889,
     51892,
-    51894,
-    51897,
-    51899,
-    51902,
-    51904,
-    51907,
-    51909,
-    51912,
-    51914,
-    51917,
-    51919,
-    51922,
-    51924,
-    51927,
-    51930,
     51932,
-    51935,
-    51937,
-    51940,
-    51942,
-    51945,
-    51947,
-    51950,
-    51952,
-    51955,
-    51957,
-    51960,
-    51962,
-    51965,
-    51967,
-    51970,
     51972,
-    51975,
-    51977,
-    51980,
-    51983,
-    51985,
-    51988,
-    51990,
-    51993,
-    51995,
-    51998,
-    52000,
-    52003,
-    52005,
-    52008,
-    52010,
     52013,
-    52015,
-    52018,
-    52020,
-    52023,
-    52025,
-    52028,
-    52030,
-    52033,
-    52035,
-    52038,
-    52040,
-    52043,
-    52045,
-    52048,
-    52051,
     52053,
-    52056,
-    52058,
-    52061,
-    52063,
-    52066,
-    52068,
-    52071,
-    52073,
-    52076,
-    52078,
-    52081,
-    52083,
-    52086,
-    52088,
-    52091,
     52093,
-    52096,
-    52098,
-    52101,
-    52103,
-    52106,
-    52108,
-    52111,
-    52113,
-    52116,
-    52118,
-    52121,
-    52124,
-    52126,
-    52129,
-    52131,
     52134,
-    52136,
-    52139,
-    52141,
-    52144,
-    52146,
-    52149,
-    52151,
-    52154,
-    52156,
-    52159,
-    52161,
-    52164,
-    52166,
-    52169,
-    52171,
     52174,
-    52176,
-    52179,
-    52181,
-    52184,
-    52186,
-    52189,
-    52191,
-    52194,
-    52196,
-    52199,
-    52201,
-    52204,
-    52206,
-    52209,
-    52211,
     52214,
-    52216,
-    52219,
-    52221,
-    52224,
-    52227,
-    52229,
-    52232,
-    52234,
-    52237,
-    52239,
-    52242,
-    52244,
-    52247,
-    52249,
-    52252,
     52254,
-    52257,
-    52259,
-    52262,
-    52264,
-    52267,
-    52269,
-    52272,
-    52274,
-    52277,
-    52279,
-    52282,
-    52284,
-    52287,
-    52289,
-    52292,
     52294,
-    52297,
-    52299,
-    52302,
-    52304,
-    52307,
-    52309,
-    52312,
-    52314,
-    52317,
-    52319,
-    52322,
-    52324,
-    52327,
-    52329,
-    52332,
     52334,
-    52337,
-    52339,
-    52342,
-    52344,
-    52347,
-    52349,
-    52352,
-    52354,
-    52357,
-    52359,
-    52362,
-    52364,
-    52367,
-    52369,
-    52372,
     52374,
-    52377,
-    52379,
-    52382,
-    52384,
-    52387,
-    52389,
-    52392,
-    52394,
-    52397,
-    52399,
-    52402,
-    52404,
-    52407,
-    52409,
-    52412,
     52414,
-    52417,
-    52419,
-    52422,
-    52424,
-    52427,
-    52429,
-    52432,
-    52434,
-    52437,
-    52439,
-    52442,
-    52444,
-    52447,
-    52449,
-    52452,
     52454,
-    52457,
-    52459,
-    52462,
-    52464,
-    52467,
-    52469,
-    52472,
-    52474,
-    52477,
-    52479,
-    52482,
-    52484,
-    52487,
-    52489,
-    52492,
     52494,
-    52497,
-    52499,
-    52502,
-    52504,
-    52507,
-    52509,
-    52512,
-    52514,
-    52517,
-    52519,
-    52522,
-    52524,
-    52527,
-    52529,
-    52532,
     52534,
-    52537,
-    52539,
-    52542,
-    52544,
-    52547,
-    52549,
-    52552,
-    52554,
-    52557,
-    52559,
-    52562,
-    52564,
-    52567,
-    52569,
-    52572,
     52574,
-    52577,
-    52579,
-    52582,
-    52584,
-    52587,
-    52589,
-    52592,
-    52594,
-    52597,
-    52599,
-    52602,
-    52604,
-    52607,
-    52609,
-    52612,
     52614,
-    52617,
-    52619,
-    52622,
-    52624,
-    52627,
-    52629,
-    52632,
-    52634,
-    52636,
-    52639,
-    52641,
-    52644,
-    52646,
-    52649,
-    52651,
     52654,
-    52656,
-    52659,
-    52661,
-    52664,
-    52666,
-    52669,
-    52671,
-    52674,
-    52676,
-    52679,
-    52681,
-    52684,
-    52686,
-    52689,
-    52691,
     52694,
-    52696,
-    52699,
-    52701,
-    52704,
-    52706,
-    52709,
-    52711,
-    52714,
-    52716,
-    52719,
-    52721,
-    52724,
-    52726,
-    52729,
-    52731,
     52734,
-    52736,
-    52738,
-    52741,
-    52743,
-    52746,
-    52748,
-    52751,
-    52753,
-    52756,
-    52758,
-    52761,
-    52763,
-    52766,
-    52768,
-    52771,
     52773,
-    52776,
-    52778,
-    52781,
-    52783,
-    52786,
-    52788,
-    52791,
-    52793,
-    52796,
-    52798,
-    52801,
-    52803,
-    52806,
-    52808,
-    52811,
     52813,
-    52815,
-    52818,
-    52820,
-    52823,
-    52825,
-    52828,
-    52830,
-    52833,
-    52835,
-    52838,
-    52840,
-    52843,
-    52845,
-    52848,
-    52850,
     52853,
-    52855,
-    52858,
-    52860,
-    52863,
-    52865,
-    52868,
-    52870,
-    52873,
-    52875,
-    52877,
-    52880,
-    52882,
-    52885,
-    52887,
-    52890,
     52892,
-    52895,
-    52897,
-    52900,
-    52902,
-    52905,
-    52907,
-    52910,
-    52912,
-    52915,
-    52917,
-    52920,
-    52922,
-    52925,
-    52927,
-    52930,
     52932,
-    52934,
-    52937,
-    52939,
-    52942,
-    52944,
-    52947,
-    52949,
-    52952,
-    52954,
-    52957,
-    52959,
-    52962,
-    52964,
-    52967,
-    52969,
     52972,
-    52974,
-    52977,
-    52979,
-    52981,
-    52984,
-    52986,
-    52989,
-    52991,
-    52994,
-    52996,
-    52999,
-    53001,
-    53004,
-    53006,
-    53009,
     53011,
-    53014,
-    53016,
-    53019,
-    53021,
-    53024,
-    53026,
-    53028,
-    53031,
-    53033,
-    53036,
-    53038,
-    53041,
-    53043,
-    53046,
-    53048,
     53051,
-    53053,
-    53056,
-    53058,
-    53061,
-    53063,
-    53066,
-    53068,
-    53070,
-    53073,
-    53075,
-    53078,
-    53080,
-    53083,
-    53085,
-    53088,
     53090,
-    53093,
-    53095,
-    53098,
-    53100,
-    53103,
-    53105,
-    53108,
-    53110,
-    53112,
-    53115,
-    53117,
-    53120,
-    53122,
-    53125,
-    53127,
     53130,
-    53132,
-    53135,
-    53137,
-    53140,
-    53142,
-    53145,
-    53147,
-    53149,
-    53152,
-    53154,
-    53157,
-    53159,
-    53162,
-    53164,
-    53167,
     53169,
-    53172,
-    53174,
-    53177,
-    53179,
-    53181,
-    53184,
-    53186,
-    53189,
-    53191,
-    53194,
-    53196,
-    53199,
-    53201,
-    53204,
-    53206,
     53209,
-    53211,
-    53214,
-    53216,
-    53218,
-    53221,
-    53223,
-    53226,
-    53228,
-    53231,
-    53233,
-    53236,
-    53238,
-    53241,
-    53243,
-    53246,
     53248,
-    53250,
-    53253,
-    53255,
-    53258,
-    53260,
-    53263,
-    53265,
-    53268,
-    53270,
-    53273,
-    53275,
-    53278,
-    53280,
-    53282,
-    53285,
     53287,
-    53290,
-    53292,
-    53295,
-    53297,
-    53300,
-    53302,
-    53305,
-    53307,
-    53310,
-    53312,
-    53314,
-    53317,
-    53319,
-    53322,
-    53324,
     53327,
-    53329,
-    53332,
-    53334,
-    53337,
-    53339,
-    53341,
-    53344,
-    53346,
-    53349,
-    53351,
-    53354,
-    53356,
-    53359,
-    53361,
-    53364,
     53366,
-    53368,
-    53371,
-    53373,
-    53376,
-    53378,
-    53381,
-    53383,
-    53386,
-    53388,
-    53391,
-    53393,
-    53395,
-    53398,
-    53400,
-    53403,
     53405,
-    53408,
-    53410,
-    53413,
-    53415,
-    53418,
-    53420,
-    53422,
-    53425,
-    53427,
-    53430,
-    53432,
-    53435,
-    53437,
-    53440,
-    53442,
     53445,
-    53447,
-    53449,
-    53452,
-    53454,
-    53457,
-    53459,
-    53462,
-    53464,
-    53467,
-    53469,
-    53472,
-    53474,
-    53476,
-    53479,
-    53481,
     53484,
-    53486,
-    53489,
-    53491,
-    53494,
-    53496,
-    53498,
-    53501,
-    53503,
-    53506,
-    53508,
-    53511,
-    53513,
-    53516,
-    53518,
-    53521,
     53523,
-    53525,
-    53528,
-    53530,
-    53533,
-    53535,
-    53538,
-    53540,
-    53543,
-    53545,
-    53547,
-    53550,
-    53552,
-    53555,
-    53557,
-    53560,
     53562,
-    53565,
-    53567,
-    53569,
-    53572,
-    53574,
-    53577,
-    53579,
-    53582,
-    53584,
-    53587,
-    53589,
-    53592,
-    53594,
-    53596,
-    53599,
     53601,
-    53604,
-    53606,
-    53609,
-    53611,
-    53614,
-    53616,
-    53618,
-    53621,
-    53623,
-    53626,
-    53628,
-    53631,
-    53633,
-    53636,
-    53638,
     53640,
-    53643,
-    53645,
-    53648,
-    53650,
-    53653,
-    53655,
-    53658,
-    53660,
-    53662,
-    53665,
-    53667,
-    53670,
-    53672,
-    53675,
-    53677,
     53679,
-    53682,
-    53684,
-    53687,
-    53689,
-    53692,
-    53694,
-    53697,
-    53699,
-    53701,
-    53704,
-    53706,
-    53709,
-    53711,
-    53714,
-    53716,
     53719,
-    53721,
-    53723,
-    53726,
-    53728,
-    53731,
-    53733,
-    53736,
-    53738,
-    53740,
-    53743,
-    53745,
-    53748,
-    53750,
-    53753,
-    53755,
     53758,
-    53760,
-    53762,
-    53765,
-    53767,
-    53770,
-    53772,
-    53775,
-    53777,
-    53780,
-    53782,
-    53784,
-    53787,
-    53789,
-    53792,
-    53794,
     53797,
-    53799,
-    53801,
-    53804,
-    53806,
-    53809,
-    53811,
-    53814,
-    53816,
-    53818,
-    53821,
-    53823,
-    53826,
-    53828,
-    53831,
-    53833,
     53836,
-    53838,
-    53840,
-    53843,
-    53845,
-    53848,
-    53850,
-    53853,
-    53855,
-    53857,
-    53860,
-    53862,
-    53865,
-    53867,
-    53870,
-    53872,
     53874,
-    53877,
-    53879,
-    53882,
-    53884,
-    53887,
-    53889,
-    53891,
-    53894,
-    53896,
-    53899,
-    53901,
-    53904,
-    53906,
-    53909,
-    53911,
     53913,
-    53916,
-    53918,
-    53921,
-    53923,
-    53926,
-    53928,
-    53930,
-    53933,
-    53935,
-    53938,
-    53940,
-    53943,
-    53945,
-    53947,
-    53950,
     53952,
-    53955,
-    53957,
-    53960,
-    53962,
-    53964,
-    53967,
-    53969,
-    53972,
-    53974,
-    53977,
-    53979,
-    53981,
-    53984,
-    53986,
-    53989,
     53991,
-    53994,
-    53996,
-    53998,
-    54001,
-    54003,
-    54006,
-    54008,
-    54011,
-    54013,
-    54015,
-    54018,
-    54020,
-    54023,
-    54025,
-    54028,
     54030,
-    54032,
-    54035,
-    54037,
-    54040,
-    54042,
-    54045,
-    54047,
-    54049,
-    54052,
-    54054,
-    54057,
-    54059,
-    54061,
-    54064,
-    54066,
     54069,
-    54071,
-    54074,
-    54076,
-    54078,
-    54081,
-    54083,
-    54086,
-    54088,
-    54091,
-    54093,
-    54095,
-    54098,
-    54100,
-    54103,
-    54105,
     54108,
-    54110,
-    54112,
-    54115,
-    54117,
-    54120,
-    54122,
-    54124,
-    54127,
-    54129,
-    54132,
-    54134,
-    54137,
-    54139,
-    54141,
-    54144,
     54146,
-    54149,
-    54151,
-    54154,
-    54156,
-    54158,
-    54161,
-    54163,
-    54166,
-    54168,
-    54170,
-    54173,
-    54175,
-    54178,
-    54180,
-    54183,
     54185,
-    54187,
-    54190,
-    54192,
-    54195,
-    54197,
-    54199,
-    54202,
-    54204,
-    54207,
-    54209,
-    54212,
-    54214,
-    54216,
-    54219,
-    54221,
     54224,
-    54226,
-    54229,
-    54231,
-    54233,
-    54236,
-    54238,
-    54241,
-    54243,
-    54245,
-    54248,
-    54250,
-    54253,
-    54255,
-    54258,
-    54260,
     54262,
-    54265,
-    54267,
-    54270,
-    54272,
-    54274,
-    54277,
-    54279,
-    54282,
-    54284,
-    54286,
-    54289,
-    54291,
-    54294,
-    54296,
-    54299,
     54301,
-    54303,
-    54306,
-    54308,
-    54311,
-    54313,
-    54315,
-    54318,
-    54320,
-    54323,
-    54325,
-    54328,
-    54330,
-    54332,
-    54335,
-    54337,
     54340,
-    54342,
-    54344,
-    54347,
-    54349,
-    54352,
-    54354,
-    54356,
-    54359,
-    54361,
-    54364,
-    54366,
-    54369,
-    54371,
-    54373,
-    54376,
     54378,
-    54381,
-    54383,
-    54385,
-    54388,
-    54390,
-    54393,
-    54395,
-    54397,
-    54400,
-    54402,
-    54405,
-    54407,
-    54409,
-    54412,
-    54414,
     54417,
-    54419,
-    54422,
-    54424,
-    54426,
-    54429,
-    54431,
-    54434,
-    54436,
-    54438,
-    54441,
-    54443,
-    54446,
-    54448,
-    54450,
-    54453,
     54455,
-    54458,
-    54460,
-    54462,
-    54465,
-    54467,
-    54470,
-    54472,
-    54474,
-    54477,
-    54479,
-    54482,
-    54484,
-    54487,
-    54489,
-    54491,
     54494,
-    54496,
-    54499,
-    54501,
-    54503,
-    54506,
-    54508,
-    54511,
-    54513,
-    54515,
-    54518,
-    54520,
-    54523,
-    54525,
-    54527,
-    54530,
     54532,
-    54535,
-    54537,
-    54539,
-    54542,
-    54544,
-    54547,
-    54549,
-    54551,
-    54554,
-    54556,
-    54559,
-    54561,
-    54563,
-    54566,
-    54568,
     54571,
-    54573,
-    54575,
-    54578,
-    54580,
-    54583,
-    54585,
-    54587,
-    54590,
-    54592,
-    54595,
-    54597,
-    54599,
-    54602,
-    54604,
-    54607,
     54609,
-    54611,
-    54614,
-    54616,
-    54619,
-    54621,
-    54623,
-    54626,
-    54628,
-    54631,
-    54633,
-    54635,
-    54638,
-    54640,
-    54643,
-    54645,
     54647,
-    54650,
-    54652,
-    54655,
-    54657,
-    54659,
-    54662,
-    54664,
-    54667,
-    54669,
-    54671,
-    54674,
-    54676,
-    54679,
-    54681,
-    54683,
     54686,
-    54688,
-    54691,
-    54693,
-    54695,
-    54698,
-    54700,
-    54703,
-    54705,
-    54707,
-    54710,
-    54712,
-    54715,
-    54717,
-    54719,
-    54722,
     54724,
-    54727,
-    54729,
-    54731,
-    54734,
-    54736,
-    54739,
-    54741,
-    54743,
-    54746,
-    54748,
-    54750,
-    54753,
-    54755,
-    54758,
-    54760,
     54762,
-    54765,
-    54767,
-    54770,
-    54772,
-    54774,
-    54777,
-    54779,
-    54782,
-    54784,
-    54786,
-    54789,
-    54791,
-    54794,
-    54796,
-    54798,
     54801,
-    54803,
-    54806,
-    54808,
-    54810,
-    54813,
-    54815,
-    54817,
-    54820,
-    54822,
-    54825,
-    54827,
-    54829,
-    54832,
-    54834,
-    54837,
     54839,
-    54841,
-    54844,
-    54846,
-    54849,
-    54851,
-    54853,
-    54856,
-    54858,
-    54861,
-    54863,
-    54865,
-    54868,
-    54870,
-    54872,
-    54875,
     54877,
-    54880,
-    54882,
-    54884,
-    54887,
-    54889,
-    54892,
-    54894,
-    54896,
-    54899,
-    54901,
-    54903,
-    54906,
-    54908,
-    54911,
-    54913,
     54915,
-    54918,
-    54920,
-    54923,
-    54925,
-    54927,
-    54930,
-    54932,
-    54935,
-    54937,
-    54939,
-    54942,
-    54944,
-    54946,
-    54949,
-    54951,
     54954,
-    54956,
-    54958,
-    54961,
-    54963,
-    54966,
-    54968,
-    54970,
-    54973,
-    54975,
-    54977,
-    54980,
-    54982,
-    54985,
-    54987,
-    54989,
     54992,
-    54994,
-    54997,
-    54999,
-    55001,
-    55004,
-    55006,
-    55008,
-    55011,
-    55013,
-    55016,
-    55018,
-    55020,
-    55023,
-    55025,
-    55027,
     55030,
-    55032,
-    55035,
-    55037,
-    55039,
-    55042,
-    55044,
-    55047,
-    55049,
-    55051,
-    55054,
-    55056,
-    55058,
-    55061,
-    55063,
-    55066,
     55068,
-    55070,
-    55073,
-    55075,
-    55077,
-    55080,
-    55082,
-    55085,
-    55087,
-    55089,
-    55092,
-    55094,
-    55097,
-    55099,
-    55101,
-    55104,
     55106,
-    55108,
-    55111,
-    55113,
-    55116,
-    55118,
-    55120,
-    55123,
-    55125,
-    55127,
-    55130,
-    55132,
-    55135,
-    55137,
-    55139,
-    55142,
     55144,
-    55146,
-    55149,
-    55151,
-    55154,
-    55156,
-    55158,
-    55161,
-    55163,
-    55165,
-    55168,
-    55170,
-    55173,
-    55175,
-    55177,
-    55180,
     55182,
-    55184,
-    55187,
-    55189,
-    55192,
-    55194,
-    55196,
-    55199,
-    55201,
-    55203,
-    55206,
-    55208,
-    55211,
-    55213,
-    55215,
-    55218,
     55220,
-    55222,
-    55225,
-    55227,
-    55230,
-    55232,
-    55234,
-    55237,
-    55239,
-    55241,
-    55244,
-    55246,
-    55249,
-    55251,
-    55253,
-    55256,
     55258,
-    55260,
-    55263,
-    55265,
-    55268,
-    55270,
-    55272,
-    55275,
-    55277,
-    55279,
-    55282,
-    55284,
-    55287,
-    55289,
-    55291,
-    55294,
     55296,
-    55298,
-    55301,
-    55303,
-    55305,
-    55308,
-    55310,
-    55313,
-    55315,
-    55317,
-    55320,
-    55322,
-    55324,
-    55327,
-    55329,
-    55332,
     55334,
-    55336,
-    55339,
-    55341,
-    55343,
-    55346,
-    55348,
-    55350,
-    55353,
-    55355,
-    55358,
-    55360,
-    55362,
-    55365,
-    55367,
-    55369,
     55372,
-    55374,
-    55377,
-    55379,
-    55381,
-    55384,
-    55386,
-    55388,
-    55391,
-    55393,
-    55395,
-    55398,
-    55400,
-    55403,
-    55405,
-    55407,
     55410,
-    55412,
-    55414,
-    55417,
-    55419,
-    55421,
-    55424,
-    55426,
-    55429,
-    55431,
-    55433,
-    55436,
-    55438,
-    55440,
-    55443,
-    55445,
     55447,
-    55450,
-    55452,
-    55455,
-    55457,
-    55459,
-    55462,
-    55464,
-    55466,
-    55469,
-    55471,
-    55473,
-    55476,
-    55478,
-    55481,
-    55483,
     55485,
-    55488,
-    55490,
-    55492,
-    55495,
-    55497,
-    55499,
-    55502,
-    55504,
-    55507,
-    55509,
-    55511,
-    55514,
-    55516,
-    55518,
-    55521,
     55523,
-    55525,
-    55528,
-    55530,
-    55533,
-    55535,
-    55537,
-    55540,
-    55542,
-    55544,
-    55547,
-    55549,
-    55551,
-    55554,
-    55556,
-    55558,
     55561,
-    55563,
-    55566,
-    55568,
-    55570,
-    55573,
-    55575,
-    55577,
-    55580,
-    55582,
-    55584,
-    55587,
-    55589,
-    55592,
-    55594,
-    55596,
     55599,
-    55601,
-    55603,
-    55606,
-    55608,
-    55610,
-    55613,
-    55615,
-    55617,
-    55620,
-    55622,
-    55625,
-    55627,
-    55629,
-    55632,
-    55634,
     55636,
-    55639,
-    55641,
-    55643,
-    55646,
-    55648,
-    55650,
-    55653,
-    55655,
-    55657,
-    55660,
-    55662,
-    55665,
-    55667,
-    55669,
-    55672,
     55674,
-    55676,
-    55679,
-    55681,
-    55683,
-    55686,
-    55688,
-    55690,
-    55693,
-    55695,
-    55698,
-    55700,
-    55702,
-    55705,
-    55707,
-    55709,
     55712,
-    55714,
-    55716,
-    55719,
-    55721,
-    55723,
-    55726,
-    55728,
-    55730,
-    55733,
-    55735,
-    55737,
-    55740,
-    55742,
-    55745,
-    55747,
     55749,
-    55752,
-    55754,
-    55756,
-    55759,
-    55761,
-    55763,
-    55766,
-    55768,
-    55770,
-    55773,
-    55775,
-    55777,
-    55780,
-    55782,
-    55785,
     55787,
-    55789,
-    55792,
-    55794,
-    55796,
-    55799,
-    55801,
-    55803,
-    55806,
-    55808,
-    55810,
-    55813,
-    55815,
-    55817,
-    55820,
-    55822,
     55824,
-    55827,
-    55829,
-    55831,
-    55834,
-    55836,
-    55839,
-    55841,
-    55843,
-    55846,
-    55848,
-    55850,
-    55853,
-    55855,
-    55857,
-    55860,
     55862,
-    55864,
-    55867,
-    55869,
-    55871,
-    55874,
-    55876,
-    55878,
-    55881,
-    55883,
-    55885,
-    55888,
-    55890,
-    55892,
-    55895,
-    55897,
     55900,
-    55902,
-    55904,
-    55907,
-    55909,
-    55911,
-    55914,
-    55916,
-    55918,
-    55921,
-    55923,
-    55925,
-    55928,
-    55930,
-    55932,
-    55935,
     55937,
-    55939,
-    55942,
-    55944,
-    55946,
-    55949,
-    55951,
-    55953,
-    55956,
-    55958,
-    55960,
-    55963,
-    55965,
-    55967,
-    55970,
-    55972,
     55975,
-    55977,
-    55979,
-    55982,
-    55984,
-    55986,
-    55989,
-    55991,
-    55993,
-    55996,
-    55998,
-    56000,
-    56003,
-    56005,
-    56007,
-    56010,
     56012,
-    56014,
-    56017,
-    56019,
-    56021,
-    56024,
-    56026,
-    56028,
-    56031,
-    56033,
-    56035,
-    56038,
-    56040,
-    56042,
-    56045,
-    56047,
     56049,
-    56052,
-    56054,
-    56056,
-    56059,
-    56061,
-    56063,
-    56066,
-    56068,
-    56070,
-    56073,
-    56075,
-    56077,
-    56080,
-    56082,
-    56084,
     56087,
-    56089,
-    56091,
-    56094,
-    56096,
-    56098,
-    56101,
-    56103,
-    56105,
-    56108,
-    56110,
-    56112,
-    56115,
-    56117,
-    56119,
-    56122,
     56124,
-    56127,
-    56129,
-    56131,
-    56134,
-    56136,
-    56138,
-    56141,
-    56143,
-    56145,
-    56148,
-    56150,
-    56152,
-    56155,
-    56157,
-    56159,
     56162,
-    56164,
-    56166,
-    56169,
-    56171,
-    56173,
-    56176,
-    56178,
-    56180,
-    56183,
-    56185,
-    56187,
-    56190,
-    56192,
-    56194,
-    56197,
     56199,
-    56201,
-    56204,
-    56206,
-    56208,
-    56211,
-    56213,
-    56215,
-    56218,
-    56220,
-    56222,
-    56225,
-    56227,
-    56229,
-    56231,
-    56234,
     56236,
-    56238,
-    56241,
-    56243,
-    56245,
-    56248,
-    56250,
-    56252,
-    56255,
-    56257,
-    56259,
-    56262,
-    56264,
-    56266,
-    56269,
-    56271,
     56273,
-    56276,
-    56278,
-    56280,
-    56283,
-    56285,
-    56287,
-    56290,
-    56292,
-    56294,
-    56297,
-    56299,
-    56301,
-    56304,
-    56306,
-    56308,
     56311,
-    56313,
-    56315,
-    56318,
-    56320,
-    56322,
-    56325,
-    56327,
-    56329,
-    56332,
-    56334,
-    56336,
-    56339,
-    56341,
-    56343,
-    56346,
     56348,
-    56350,
-    56353,
-    56355,
-    56357,
-    56360,
-    56362,
-    56364,
-    56367,
-    56369,
-    56371,
-    56374,
-    56376,
-    56378,
-    56380,
-    56383,
     56385,
-    56387,
-    56390,
-    56392,
-    56394,
-    56397,
-    56399,
-    56401,
-    56404,
-    56406,
-    56408,
-    56411,
-    56413,
-    56415,
-    56418,
-    56420,
     56422,
-    56425,
-    56427,
-    56429,
-    56432,
-    56434,
-    56436,
-    56439,
-    56441,
-    56443,
-    56446,
-    56448,
-    56450,
-    56452,
-    56455,
-    56457,
     56459,
-    56462,
-    56464,
-    56466,
-    56469,
-    56471,
-    56473,
-    56476,
-    56478,
-    56480,
-    56483,
-    56485,
-    56487,
-    56490,
-    56492,
-    56494,
     56497,
-    56499,
-    56501,
-    56504,
-    56506,
-    56508,
-    56511,
-    56513,
-    56515,
-    56517,
-    56520,
-    56522,
-    56524,
-    56527,
-    56529,
-    56531,
     56534,
-    56536,
-    56538,
-    56541,
-    56543,
-    56545,
-    56548,
-    56550,
-    56552,
-    56555,
-    56557,
-    56559,
-    56562,
-    56564,
-    56566,
-    56568,
     56571,
-    56573,
-    56575,
-    56578,
-    56580,
-    56582,
-    56585,
-    56587,
-    56589,
-    56592,
-    56594,
-    56596,
-    56599,
-    56601,
-    56603,
-    56606,
     56608,
-    56610,
-    56612,
-    56615,
-    56617,
-    56619,
-    56622,
-    56624,
-    56626,
-    56629,
-    56631,
-    56633,
-    56636,
-    56638,
-    56640,
-    56643,
     56645,
-    56647,
-    56650,
-    56652,
-    56654,
-    56656,
-    56659,
-    56661,
-    56663,
-    56666,
-    56668,
-    56670,
-    56673,
-    56675,
-    56677,
-    56680,
     56682,
-    56684,
-    56687,
-    56689,
-    56691,
-    56693,
-    56696,
-    56698,
-    56700,
-    56703,
-    56705,
-    56707,
-    56710,
-    56712,
-    56714,
-    56717,
     56719,
-    56721,
-    56724,
-    56726,
-    56728,
-    56730,
-    56733,
-    56735,
-    56737,
-    56740,
-    56742,
-    56744,
-    56747,
-    56749,
-    56751,
-    56754,
     56756,
-    56758,
-    56760,
-    56763,
-    56765,
-    56767,
-    56770,
-    56772,
-    56774,
-    56777,
-    56779,
-    56781,
-    56784,
-    56786,
-    56788,
-    56790,
     56793,
-    56795,
-    56797,
-    56800,
-    56802,
-    56804,
-    56807,
-    56809,
-    56811,
-    56814,
-    56816,
-    56818,
-    56820,
-    56823,
-    56825,
-    56827,
     56830,
-    56832,
-    56834,
-    56837,
-    56839,
-    56841,
-    56844,
-    56846,
-    56848,
-    56850,
-    56853,
-    56855,
-    56857,
-    56860,
-    56862,
-    56864,
     56867,
-    56869,
-    56871,
-    56873,
-    56876,
-    56878,
-    56880,
-    56883,
-    56885,
-    56887,
-    56890,
-    56892,
-    56894,
-    56897,
-    56899,
-    56901,
     56903,
-    56906,
-    56908,
-    56910,
-    56913,
-    56915,
-    56917,
-    56920,
-    56922,
-    56924,
-    56926,
-    56929,
-    56931,
-    56933,
-    56936,
-    56938,
     56940,
-    56943,
-    56945,
-    56947,
-    56950,
-    56952,
-    56954,
-    56956,
-    56959,
-    56961,
-    56963,
-    56966,
-    56968,
-    56970,
-    56973,
-    56975,
     56977,
-    56979,
-    56982,
-    56984,
-    56986,
-    56989,
-    56991,
-    56993,
-    56996,
-    56998,
-    57000,
-    57002,
-    57005,
-    57007,
-    57009,
-    57012,
     57014,
-    57016,
-    57019,
-    57021,
-    57023,
-    57025,
-    57028,
-    57030,
-    57032,
-    57035,
-    57037,
-    57039,
-    57041,
-    57044,
-    57046,
-    57048,
     57051,
-    57053,
-    57055,
-    57058,
-    57060,
-    57062,
-    57064,
-    57067,
-    57069,
-    57071,
-    57074,
-    57076,
-    57078,
-    57081,
-    57083,
-    57085,
     57087,
-    57090,
-    57092,
-    57094,
-    57097,
-    57099,
-    57101,
-    57103,
-    57106,
-    57108,
-    57110,
-    57113,
-    57115,
-    57117,
-    57120,
-    57122,
     57124,
-    57126,
-    57129,
-    57131,
-    57133,
-    57136,
-    57138,
-    57140,
-    57143,
-    57145,
-    57147,
-    57149,
-    57152,
-    57154,
-    57156,
-    57159,
     57161,
-    57163,
-    57165,
-    57168,
-    57170,
-    57172,
-    57175,
-    57177,
-    57179,
-    57181,
-    57184,
-    57186,
-    57188,
-    57191,
-    57193,
-    57195,
     57198,
-    57200,
-    57202,
-    57204,
-    57207,
-    57209,
-    57211,
-    57214,
-    57216,
-    57218,
-    57220,
-    57223,
-    57225,
-    57227,
-    57230,
-    57232,
     57234,
-    57236,
-    57239,
-    57241,
-    57243,
-    57246,
-    57248,
-    57250,
-    57252,
-    57255,
-    57257,
-    57259,
-    57262,
-    57264,
-    57266,
-    57269,
     57271,
-    57273,
-    57275,
-    57278,
-    57280,
-    57282,
-    57285,
-    57287,
-    57289,
-    57291,
-    57294,
-    57296,
-    57298,
-    57301,
-    57303,
-    57305,
     57307,
-    57310,
-    57312,
-    57314,
-    57317,
-    57319,
-    57321,
-    57323,
-    57326,
-    57328,
-    57330,
-    57333,
-    57335,
-    57337,
-    57339,
-    57342,
     57344,
-    57346,
-    57349,
-    57351,
-    57353,
-    57355,
-    57358,
-    57360,
-    57362,
-    57365,
-    57367,
-    57369,
-    57371,
-    57374,
-    57376,
-    57378,
     57381,
-    57383,
-    57385,
-    57387,
-    57390,
-    57392,
-    57394,
-    57397,
-    57399,
-    57401,
-    57403,
-    57406,
-    57408,
-    57410,
-    57413,
-    57415,
     57417,
-    57419,
-    57422,
-    57424,
-    57426,
-    57429,
-    57431,
-    57433,
-    57435,
-    57438,
-    57440,
-    57442,
-    57444,
-    57447,
-    57449,
-    57451,
     57454,
-    57456,
-    57458,
-    57460,
-    57463,
-    57465,
-    57467,
-    57470,
-    57472,
-    57474,
-    57476,
-    57479,
-    57481,
-    57483,
-    57486,
-    57488,
     57490,
-    57492,
-    57495,
-    57497,
-    57499,
-    57501,
-    57504,
-    57506,
-    57508,
-    57511,
-    57513,
-    57515,
-    57517,
-    57520,
-    57522,
-    57524,
     57527,
-    57529,
-    57531,
-    57533,
-    57536,
-    57538,
-    57540,
-    57543,
-    57545,
-    57547,
-    57549,
-    57552,
-    57554,
-    57556,
-    57558,
-    57561,
     57563,
-    57565,
-    57568,
-    57570,
-    57572,
-    57574,
-    57577,
-    57579,
-    57581,
-    57583,
-    57586,
-    57588,
-    57590,
-    57593,
-    57595,
-    57597,
     57599,
-    57602,
-    57604,
-    57606,
-    57609,
-    57611,
-    57613,
-    57615,
-    57618,
-    57620,
-    57622,
-    57624,
-    57627,
-    57629,
-    57631,
-    57634,
     57636,
-    57638,
-    57640,
-    57643,
-    57645,
-    57647,
-    57649,
-    57652,
-    57654,
-    57656,
-    57659,
-    57661,
-    57663,
-    57665,
-    57668,
-    57670,
     57672,
-    57674,
-    57677,
-    57679,
-    57681,
-    57684,
-    57686,
-    57688,
-    57690,
-    57693,
-    57695,
-    57697,
-    57699,
-    57702,
-    57704,
-    57706,
     57709,
-    57711,
-    57713,
-    57715,
-    57718,
-    57720,
-    57722,
-    57724,
-    57727,
-    57729,
-    57731,
-    57734,
-    57736,
-    57738,
-    57740,
-    57743,
     57745,
-    57747,
-    57749,
-    57752,
-    57754,
-    57756,
-    57759,
-    57761,
-    57763,
-    57765,
-    57768,
-    57770,
-    57772,
-    57774,
-    57777,
-    57779,
     57781,
-    57783,
-    57786,
-    57788,
-    57790,
-    57793,
-    57795,
-    57797,
-    57799,
-    57802,
-    57804,
-    57806,
-    57808,
-    57811,
-    57813,
-    57815,
     57817,
-    57820,
-    57822,
-    57824,
-    57827,
-    57829,
-    57831,
-    57833,
-    57836,
-    57838,
-    57840,
-    57842,
-    57845,
-    57847,
-    57849,
-    57851,
     57854,
-    57856,
-    57858,
-    57861,
-    57863,
-    57865,
-    57867,
-    57870,
-    57872,
-    57874,
-    57876,
-    57879,
-    57881,
-    57883,
-    57885,
-    57888,
     57890,
-    57892,
-    57895,
-    57897,
-    57899,
-    57901,
-    57904,
-    57906,
-    57908,
-    57910,
-    57913,
-    57915,
-    57917,
-    57919,
-    57922,
-    57924,
     57926,
-    57928,
-    57931,
-    57933,
-    57935,
-    57938,
-    57940,
-    57942,
-    57944,
-    57947,
-    57949,
-    57951,
-    57953,
-    57956,
-    57958,
-    57960,
     57962,
-    57965,
-    57967,
-    57969,
-    57971,
-    57974,
-    57976,
-    57978,
-    57980,
-    57983,
-    57985,
-    57987,
-    57990,
-    57992,
-    57994,
-    57996,
     57999,
-    58001,
-    58003,
-    58005,
-    58008,
-    58010,
-    58012,
-    58014,
-    58017,
-    58019,
-    58021,
-    58023,
-    58026,
-    58028,
-    58030,
-    58032,
     58035,
-    58037,
-    58039,
-    58041,
-    58044,
-    58046,
-    58048,
-    58051,
-    58053,
-    58055,
-    58057,
-    58060,
-    58062,
-    58064,
-    58066,
-    58069,
     58071,
-    58073,
-    58075,
-    58078,
-    58080,
-    58082,
-    58084,
-    58087,
-    58089,
-    58091,
-    58093,
-    58096,
-    58098,
-    58100,
-    58102,
-    58105,
     58107,
-    58109,
-    58111,
-    58114,
-    58116,
-    58118,
-    58120,
-    58123,
-    58125,
-    58127,
-    58129,
-    58132,
-    58134,
-    58136,
-    58138,
-    58141,
     58143,
-    58145,
-    58148,
-    58150,
-    58152,
-    58154,
-    58157,
-    58159,
-    58161,
-    58163,
-    58166,
-    58168,
-    58170,
-    58172,
-    58175,
-    58177,
     58179,
-    58181,
-    58184,
-    58186,
-    58188,
-    58190,
-    58193,
-    58195,
-    58197,
-    58199,
-    58202,
-    58204,
-    58206,
-    58208,
-    58211,
-    58213,
     58215,
-    58217,
-    58220,
-    58222,
-    58224,
-    58226,
-    58229,
-    58231,
-    58233,
-    58235,
-    58238,
-    58240,
-    58242,
-    58244,
-    58247,
-    58249,
     58251,
-    58253,
-    58256,
-    58258,
-    58260,
-    58262,
-    58265,
-    58267,
-    58269,
-    58271,
-    58274,
-    58276,
-    58278,
-    58280,
-    58283,
-    58285,
     58287,
-    58289,
-    58292,
-    58294,
-    58296,
-    58298,
-    58301,
-    58303,
-    58305,
-    58307,
-    58310,
-    58312,
-    58314,
-    58316,
-    58319,
-    58321,
     58323,
-    58325,
-    58328,
-    58330,
-    58332,
-    58334,
-    58337,
-    58339,
-    58341,
-    58343,
-    58346,
-    58348,
-    58350,
-    58352,
-    58355,
-    58357,
     58359,
-    58361,
-    58364,
-    58366,
-    58368,
-    58370,
-    58372,
-    58375,
-    58377,
-    58379,
-    58381,
-    58384,
-    58386,
-    58388,
-    58390,
-    58393,
     58395,
-    58397,
-    58399,
-    58402,
-    58404,
-    58406,
-    58408,
-    58411,
-    58413,
-    58415,
-    58417,
-    58420,
-    58422,
-    58424,
-    58426,
-    58429,
     58431,
-    58433,
-    58435,
-    58438,
-    58440,
-    58442,
-    58444,
-    58447,
-    58449,
-    58451,
-    58453,
-    58456,
-    58458,
-    58460,
-    58462,
-    58464,
     58467,
-    58469,
-    58471,
-    58473,
-    58476,
-    58478,
-    58480,
-    58482,
-    58485,
-    58487,
-    58489,
-    58491,
-    58494,
-    58496,
-    58498,
-    58500,
     58503,
-    58505,
-    58507,
-    58509,
-    58512,
-    58514,
-    58516,
-    58518,
-    58521,
-    58523,
-    58525,
-    58527,
-    58529,
-    58532,
-    58534,
-    58536,
     58538,
-    58541,
-    58543,
-    58545,
-    58547,
-    58550,
-    58552,
-    58554,
-    58556,
-    58559,
-    58561,
-    58563,
-    58565,
-    58568,
-    58570,
-    58572,
     58574,
-    58576,
-    58579,
-    58581,
-    58583,
-    58585,
-    58588,
-    58590,
-    58592,
-    58594,
-    58597,
-    58599,
-    58601,
-    58603,
-    58606,
-    58608,
     58610,
-    58612,
-    58614,
-    58617,
-    58619,
-    58621,
-    58623,
-    58626,
-    58628,
-    58630,
-    58632,
-    58635,
-    58637,
-    58639,
-    58641,
-    58644,
     58646,
-    58648,
-    58650,
-    58652,
-    58655,
-    58657,
-    58659,
-    58661,
-    58664,
-    58666,
-    58668,
-    58670,
-    58673,
-    58675,
-    58677,
-    58679,
     58682,
-    58684,
-    58686,
-    58688,
-    58690,
-    58693,
-    58695,
-    58697,
-    58699,
-    58702,
-    58704,
-    58706,
-    58708,
-    58711,
-    58713,
-    58715,
     58717,
-    58720,
-    58722,
-    58724,
-    58726,
-    58728,
-    58731,
-    58733,
-    58735,
-    58737,
-    58740,
-    58742,
-    58744,
-    58746,
-    58749,
-    58751,
     58753,
-    58755,
-    58757,
-    58760,
-    58762,
-    58764,
-    58766,
-    58769,
-    58771,
-    58773,
-    58775,
-    58778,
-    58780,
-    58782,
-    58784,
-    58786,
     58789,
-    58791,
-    58793,
-    58795,
-    58798,
-    58800,
-    58802,
-    58804,
-    58806,
-    58809,
-    58811,
-    58813,
-    58815,
-    58818,
-    58820,
-    58822,
     58824,
-    58827,
-    58829,
-    58831,
-    58833,
-    58835,
-    58838,
-    58840,
-    58842,
-    58844,
-    58847,
-    58849,
-    58851,
-    58853,
-    58856,
-    58858,
     58860,
-    58862,
-    58864,
-    58867,
-    58869,
-    58871,
-    58873,
-    58876,
-    58878,
-    58880,
-    58882,
-    58884,
-    58887,
-    58889,
-    58891,
-    58893,
     58896,
-    58898,
-    58900,
-    58902,
-    58904,
-    58907,
-    58909,
-    58911,
-    58913,
-    58916,
-    58918,
-    58920,
-    58922,
-    58925,
-    58927,
-    58929,
     58931,
-    58933,
-    58936,
-    58938,
-    58940,
-    58942,
-    58945,
-    58947,
-    58949,
-    58951,
-    58953,
-    58956,
-    58958,
-    58960,
-    58962,
-    58965,
     58967,
-    58969,
-    58971,
-    58973,
-    58976,
-    58978,
-    58980,
-    58982,
-    58985,
-    58987,
-    58989,
-    58991,
-    58993,
-    58996,
-    58998,
-    59000,
     59002,
-    59005,
-    59007,
-    59009,
-    59011,
-    59013,
-    59016,
-    59018,
-    59020,
-    59022,
-    59025,
-    59027,
-    59029,
-    59031,
-    59033,
-    59036,
     59038,
-    59040,
-    59042,
-    59045,
-    59047,
-    59049,
-    59051,
-    59053,
-    59056,
-    59058,
-    59060,
-    59062,
-    59064,
-    59067,
-    59069,
-    59071,
     59073,
-    59076,
-    59078,
-    59080,
-    59082,
-    59084,
-    59087,
-    59089,
-    59091,
-    59093,
-    59096,
-    59098,
-    59100,
-    59102,
-    59104,
-    59107,
     59109,
-    59111,
-    59113,
-    59115,
-    59118,
-    59120,
-    59122,
-    59124,
-    59127,
-    59129,
-    59131,
-    59133,
-    59135,
-    59138,
-    59140,
-    59142,
     59144,
-    59147,
-    59149,
-    59151,
-    59153,
-    59155,
-    59158,
-    59160,
-    59162,
-    59164,
-    59166,
-    59169,
-    59171,
-    59173,
-    59175,
-    59178,
     59180,
-    59182,
-    59184,
-    59186,
-    59189,
-    59191,
-    59193,
-    59195,
-    59197,
-    59200,
-    59202,
-    59204,
-    59206,
-    59209,
-    59211,
-    59213,
     59215,
-    59217,
-    59220,
-    59222,
-    59224,
-    59226,
-    59228,
-    59231,
-    59233,
-    59235,
-    59237,
-    59240,
-    59242,
-    59244,
-    59246,
-    59248,
     59251,
-    59253,
-    59255,
-    59257,
-    59259,
-    59262,
-    59264,
-    59266,
-    59268,
-    59270,
-    59273,
-    59275,
-    59277,
-    59279,
-    59282,
-    59284,
     59286,
-    59288,
-    59290,
-    59293,
-    59295,
-    59297,
-    59299,
-    59301,
-    59304,
-    59306,
-    59308,
-    59310,
-    59312,
-    59315,
-    59317,
-    59319,
     59321,
-    59324,
-    59326,
-    59328,
-    59330,
-    59332,
-    59335,
-    59337,
-    59339,
-    59341,
-    59343,
-    59346,
-    59348,
-    59350,
-    59352,
-    59354,
     59357,
-    59359,
-    59361,
-    59363,
-    59366,
-    59368,
-    59370,
-    59372,
-    59374,
-    59377,
-    59379,
-    59381,
-    59383,
-    59385,
-    59388,
-    59390,
     59392,
-    59394,
-    59396,
-    59399,
-    59401,
-    59403,
-    59405,
-    59407,
-    59410,
-    59412,
-    59414,
-    59416,
-    59418,
-    59421,
-    59423,
-    59425,
     59427,
-    59430,
-    59432,
-    59434,
-    59436,
-    59438,
-    59441,
-    59443,
-    59445,
-    59447,
-    59449,
-    59452,
-    59454,
-    59456,
-    59458,
-    59460,
     59463,
-    59465,
-    59467,
-    59469,
-    59471,
-    59474,
-    59476,
-    59478,
-    59480,
-    59482,
-    59485,
-    59487,
-    59489,
-    59491,
-    59493,
-    59496,
     59498,
-    59500,
-    59502,
-    59504,
-    59507,
-    59509,
-    59511,
-    59513,
-    59515,
-    59518,
-    59520,
-    59522,
-    59524,
-    59526,
-    59529,
-    59531,
     59533,
-    59535,
-    59537,
-    59540,
-    59542,
-    59544,
-    59546,
-    59548,
-    59551,
-    59553,
-    59555,
-    59557,
-    59559,
-    59562,
-    59564,
-    59566,
     59568,
-    59570,
-    59573,
-    59575,
-    59577,
-    59579,
-    59581,
-    59584,
-    59586,
-    59588,
-    59590,
-    59592,
-    59595,
-    59597,
-    59599,
-    59601,
     59603,
-    59606,
-    59608,
-    59610,
-    59612,
-    59614,
-    59617,
-    59619,
-    59621,
-    59623,
-    59625,
-    59628,
-    59630,
-    59632,
-    59634,
-    59636,
     59639,
-    59641,
-    59643,
-    59645,
-    59647,
-    59650,
-    59652,
-    59654,
-    59656,
-    59658,
-    59661,
-    59663,
-    59665,
-    59667,
-    59669,
-    59672,
     59674,
-    59676,
-    59678,
-    59680,
-    59683,
-    59685,
-    59687,
-    59689,
-    59691,
-    59694,
-    59696,
-    59698,
-    59700,
-    59702,
-    59705,
-    59707,
     59709,
-    59711,
-    59713,
-    59716,
-    59718,
-    59720,
-    59722,
-    59724,
-    59727,
-    59729,
-    59731,
-    59733,
-    59735,
-    59737,
-    59740,
-    59742,
     59744,
-    59746,
-    59748,
-    59751,
-    59753,
-    59755,
-    59757,
-    59759,
-    59762,
-    59764,
-    59766,
-    59768,
-    59770,
-    59773,
-    59775,
-    59777,
     59779,
-    59781,
-    59784,
-    59786,
-    59788,
-    59790,
-    59792,
-    59794,
-    59797,
-    59799,
-    59801,
-    59803,
-    59805,
-    59808,
-    59810,
-    59812,
     59814,
-    59816,
-    59819,
-    59821,
-    59823,
-    59825,
-    59827,
-    59830,
-    59832,
-    59834,
-    59836,
-    59838,
-    59841,
-    59843,
-    59845,
-    59847,
     59849,
-    59851,
-    59854,
-    59856,
-    59858,
-    59860,
-    59862,
-    59865,
-    59867,
-    59869,
-    59871,
-    59873,
-    59876,
-    59878,
-    59880,
-    59882,
     59884,
-    59886,
-    59889,
-    59891,
-    59893,
-    59895,
-    59897,
-    59900,
-    59902,
-    59904,
-    59906,
-    59908,
-    59911,
-    59913,
-    59915,
-    59917,
     59919,
-    59922,
-    59924,
-    59926,
-    59928,
-    59930,
-    59932,
-    59935,
-    59937,
-    59939,
-    59941,
-    59943,
-    59946,
-    59948,
-    59950,
-    59952,
     59954,
-    59956,
-    59959,
-    59961,
-    59963,
-    59965,
-    59967,
-    59970,
-    59972,
-    59974,
-    59976,
-    59978,
-    59981,
-    59983,
-    59985,
-    59987,
     59989,
-    59991,
-    59994,
-    59996,
-    59998,
-    60000,
-    60002,
-    60005,
-    60007,
-    60009,
-    60011,
-    60013,
-    60015,
-    60018,
-    60020,
-    60022,
     60024,
-    60026,
-    60029,
-    60031,
-    60033,
-    60035,
-    60037,
-    60040,
-    60042,
-    60044,
-    60046,
-    60048,
-    60050,
-    60053,
-    60055,
-    60057,
     60059,
-    60061,
-    60064,
-    60066,
-    60068,
-    60070,
-    60072,
-    60074,
-    60077,
-    60079,
-    60081,
-    60083,
-    60085,
-    60088,
-    60090,
-    60092,
     60094,
-    60096,
-    60098,
-    60101,
-    60103,
-    60105,
-    60107,
-    60109,
-    60112,
-    60114,
-    60116,
-    60118,
-    60120,
-    60122,
-    60125,
-    60127,
     60129,
-    60131,
-    60133,
-    60135,
-    60138,
-    60140,
-    60142,
-    60144,
-    60146,
-    60149,
-    60151,
-    60153,
-    60155,
-    60157,
-    60159,
-    60162,
     60164,
-    60166,
-    60168,
-    60170,
-    60173,
-    60175,
-    60177,
-    60179,
-    60181,
-    60183,
-    60186,
-    60188,
-    60190,
-    60192,
-    60194,
-    60196,
     60199,
-    60201,
-    60203,
-    60205,
-    60207,
-    60210,
-    60212,
-    60214,
-    60216,
-    60218,
-    60220,
-    60223,
-    60225,
-    60227,
-    60229,
-    60231,
     60233,
-    60236,
-    60238,
-    60240,
-    60242,
-    60244,
-    60247,
-    60249,
-    60251,
-    60253,
-    60255,
-    60257,
-    60260,
-    60262,
-    60264,
-    60266,
     60268,
-    60270,
-    60273,
-    60275,
-    60277,
-    60279,
-    60281,
-    60284,
-    60286,
-    60288,
-    60290,
-    60292,
-    60294,
-    60297,
-    60299,
-    60301,
     60303,
-    60305,
-    60307,
-    60310,
-    60312,
-    60314,
-    60316,
-    60318,
-    60320,
-    60323,
-    60325,
-    60327,
-    60329,
-    60331,
-    60334,
-    60336,
     60338,
-    60340,
-    60342,
-    60344,
-    60347,
-    60349,
-    60351,
-    60353,
-    60355,
-    60357,
-    60360,
-    60362,
-    60364,
-    60366,
-    60368,
-    60370,
     60373,
-    60375,
-    60377,
-    60379,
-    60381,
-    60383,
-    60386,
-    60388,
-    60390,
-    60392,
-    60394,
-    60396,
-    60399,
-    60401,
-    60403,
-    60405,
     60407,
-    60409,
-    60412,
-    60414,
-    60416,
-    60418,
-    60420,
-    60423,
-    60425,
-    60427,
-    60429,
-    60431,
-    60433,
-    60436,
-    60438,
-    60440,
     60442,
-    60444,
-    60446,
-    60449,
-    60451,
-    60453,
-    60455,
-    60457,
-    60459,
-    60462,
-    60464,
-    60466,
-    60468,
-    60470,
-    60472,
-    60475,
     60477,
-    60479,
-    60481,
-    60483,
-    60485,
-    60488,
-    60490,
-    60492,
-    60494,
-    60496,
-    60498,
-    60501,
-    60503,
-    60505,
-    60507,
-    60509,
     60511,
-    60514,
-    60516,
-    60518,
-    60520,
-    60522,
-    60524,
-    60527,
-    60529,
-    60531,
-    60533,
-    60535,
-    60537,
-    60540,
-    60542,
-    60544,
     60546,
-    60548,
-    60550,
-    60553,
-    60555,
-    60557,
-    60559,
-    60561,
-    60563,
-    60566,
-    60568,
-    60570,
-    60572,
-    60574,
-    60576,
-    60578,
     60581,
-    60583,
-    60585,
-    60587,
-    60589,
-    60591,
-    60594,
-    60596,
-    60598,
-    60600,
-    60602,
-    60604,
-    60607,
-    60609,
-    60611,
-    60613,
     60615,
-    60617,
-    60620,
-    60622,
-    60624,
-    60626,
-    60628,
-    60630,
-    60633,
-    60635,
-    60637,
-    60639,
-    60641,
-    60643,
-    60646,
-    60648,
     60650,
-    60652,
-    60654,
-    60656,
-    60658,
-    60661,
-    60663,
-    60665,
-    60667,
-    60669,
-    60671,
-    60674,
-    60676,
-    60678,
-    60680,
-    60682,
     60684,
-    60687,
-    60689,
-    60691,
-    60693,
-    60695,
-    60697,
-    60700,
-    60702,
-    60704,
-    60706,
-    60708,
-    60710,
-    60712,
-    60715,
-    60717,
     60719,
-    60721,
-    60723,
-    60725,
-    60728,
-    60730,
-    60732,
-    60734,
-    60736,
-    60738,
-    60741,
-    60743,
-    60745,
-    60747,
-    60749,
-    60751,
     60753,
-    60756,
-    60758,
-    60760,
-    60762,
-    60764,
-    60766,
-    60769,
-    60771,
-    60773,
-    60775,
-    60777,
-    60779,
-    60782,
-    60784,
-    60786,
     60788,
-    60790,
-    60792,
-    60794,
-    60797,
-    60799,
-    60801,
-    60803,
-    60805,
-    60807,
-    60810,
-    60812,
-    60814,
-    60816,
-    60818,
-    60820,
     60822,
-    60825,
-    60827,
-    60829,
-    60831,
-    60833,
-    60835,
-    60838,
-    60840,
-    60842,
-    60844,
-    60846,
-    60848,
-    60851,
-    60853,
-    60855,
     60857,
-    60859,
-    60861,
-    60863,
-    60866,
-    60868,
-    60870,
-    60872,
-    60874,
-    60876,
-    60879,
-    60881,
-    60883,
-    60885,
-    60887,
-    60889,
     60891,
-    60894,
-    60896,
-    60898,
-    60900,
-    60902,
-    60904,
-    60906,
-    60909,
-    60911,
-    60913,
-    60915,
-    60917,
-    60919,
-    60922,
-    60924,
     60926,
-    60928,
-    60930,
-    60932,
-    60934,
-    60937,
-    60939,
-    60941,
-    60943,
-    60945,
-    60947,
-    60950,
-    60952,
-    60954,
-    60956,
-    60958,
     60960,
-    60962,
-    60965,
-    60967,
-    60969,
-    60971,
-    60973,
-    60975,
-    60977,
-    60980,
-    60982,
-    60984,
-    60986,
-    60988,
-    60990,
-    60993,
     60995,
-    60997,
-    60999,
-    61001,
-    61003,
-    61005,
-    61008,
-    61010,
-    61012,
-    61014,
-    61016,
-    61018,
-    61020,
-    61023,
-    61025,
-    61027,
     61029,
-    61031,
-    61033,
-    61035,
-    61038,
-    61040,
-    61042,
-    61044,
-    61046,
-    61048,
-    61050,
-    61053,
-    61055,
-    61057,
-    61059,
-    61061,
     61063,
-    61066,
-    61068,
-    61070,
-    61072,
-    61074,
-    61076,
-    61078,
-    61081,
-    61083,
-    61085,
-    61087,
-    61089,
-    61091,
-    61093,
-    61096,
     61098,
-    61100,
-    61102,
-    61104,
-    61106,
-    61108,
-    61111,
-    61113,
-    61115,
-    61117,
-    61119,
-    61121,
-    61123,
-    61126,
-    61128,
-    61130,
     61132,
-    61134,
-    61136,
-    61138,
-    61141,
-    61143,
-    61145,
-    61147,
-    61149,
-    61151,
-    61153,
-    61156,
-    61158,
-    61160,
-    61162,
-    61164,
     61166,
-    61168,
-    61171,
-    61173,
-    61175,
-    61177,
-    61179,
-    61181,
-    61183,
-    61186,
-    61188,
-    61190,
-    61192,
-    61194,
-    61196,
-    61198,
     61201,
-    61203,
-    61205,
-    61207,
-    61209,
-    61211,
-    61213,
-    61216,
-    61218,
-    61220,
-    61222,
-    61224,
-    61226,
-    61228,
-    61231,
-    61233,
     61235,
-    61237,
-    61239,
-    61241,
-    61243,
-    61246,
-    61248,
-    61250,
-    61252,
-    61254,
-    61256,
-    61258,
-    61261,
-    61263,
-    61265,
-    61267,
     61269,
-    61271,
-    61273,
-    61276,
-    61278,
-    61280,
-    61282,
-    61284,
-    61286,
-    61288,
-    61290,
-    61293,
-    61295,
-    61297,
-    61299,
-    61301,
     61303,
-    61305,
-    61308,
-    61310,
-    61312,
-    61314,
-    61316,
-    61318,
-    61320,
-    61323,
-    61325,
-    61327,
-    61329,
-    61331,
-    61333,
-    61335,
     61338,
-    61340,
-    61342,
-    61344,
-    61346,
-    61348,
-    61350,
-    61352,
-    61355,
-    61357,
-    61359,
-    61361,
-    61363,
-    61365,
-    61367,
-    61370,
     61372,
-    61374,
-    61376,
-    61378,
-    61380,
-    61382,
-    61385,
-    61387,
-    61389,
-    61391,
-    61393,
-    61395,
-    61397,
-    61399,
-    61402,
-    61404,
     61406,
-    61408,
-    61410,
-    61412,
-    61414,
-    61417,
-    61419,
-    61421,
-    61423,
-    61425,
-    61427,
-    61429,
-    61431,
-    61434,
-    61436,
-    61438,
     61440,
-    61442,
-    61444,
-    61446,
-    61449,
-    61451,
-    61453,
-    61455,
-    61457,
-    61459,
-    61461,
-    61463,
-    61466,
-    61468,
-    61470,
-    61472,
     61474,
-    61476,
-    61478,
-    61481,
-    61483,
-    61485,
-    61487,
-    61489,
-    61491,
-    61493,
-    61495,
-    61498,
-    61500,
-    61502,
-    61504,
-    61506,
     61508,
-    61510,
-    61512,
-    61515,
-    61517,
-    61519,
-    61521,
-    61523,
-    61525,
-    61527,
-    61530,
-    61532,
-    61534,
-    61536,
-    61538,
-    61540,
     61542,
-    61544,
-    61547,
-    61549,
-    61551,
-    61553,
-    61555,
-    61557,
-    61559,
-    61561,
-    61564,
-    61566,
-    61568,
-    61570,
-    61572,
-    61574,
     61576,
-    61579,
-    61581,
-    61583,
-    61585,
-    61587,
-    61589,
-    61591,
-    61593,
-    61596,
-    61598,
-    61600,
-    61602,
-    61604,
-    61606,
-    61608,
     61610,
-    61613,
-    61615,
-    61617,
-    61619,
-    61621,
-    61623,
-    61625,
-    61627,
-    61630,
-    61632,
-    61634,
-    61636,
-    61638,
-    61640,
-    61642,
     61644,
-    61647,
-    61649,
-    61651,
-    61653,
-    61655,
-    61657,
-    61659,
-    61661,
-    61664,
-    61666,
-    61668,
-    61670,
-    61672,
-    61674,
-    61676,
     61678,
-    61681,
-    61683,
-    61685,
-    61687,
-    61689,
-    61691,
-    61693,
-    61695,
-    61698,
-    61700,
-    61702,
-    61704,
-    61706,
-    61708,
-    61710,
     61712,
-    61715,
-    61717,
-    61719,
-    61721,
-    61723,
-    61725,
-    61727,
-    61729,
-    61732,
-    61734,
-    61736,
-    61738,
-    61740,
-    61742,
-    61744,
     61746,
-    61749,
-    61751,
-    61753,
-    61755,
-    61757,
-    61759,
-    61761,
-    61763,
-    61766,
-    61768,
-    61770,
-    61772,
-    61774,
-    61776,
-    61778,
     61780,
-    61783,
-    61785,
-    61787,
-    61789,
-    61791,
-    61793,
-    61795,
-    61797,
-    61799,
-    61802,
-    61804,
-    61806,
-    61808,
-    61810,
-    61812,
     61814,
-    61816,
-    61819,
-    61821,
-    61823,
-    61825,
-    61827,
-    61829,
-    61831,
-    61833,
-    61836,
-    61838,
-    61840,
-    61842,
-    61844,
-    61846,
     61848,
-    61850,
-    61852,
-    61855,
-    61857,
-    61859,
-    61861,
-    61863,
-    61865,
-    61867,
-    61869,
-    61872,
-    61874,
-    61876,
-    61878,
-    61880,
     61882,
-    61884,
-    61886,
-    61888,
-    61891,
-    61893,
-    61895,
-    61897,
-    61899,
-    61901,
-    61903,
-    61905,
-    61908,
-    61910,
-    61912,
-    61914,
     61916,
-    61918,
-    61920,
-    61922,
-    61924,
-    61927,
-    61929,
-    61931,
-    61933,
-    61935,
-    61937,
-    61939,
-    61941,
-    61944,
-    61946,
-    61948,
     61950,
-    61952,
-    61954,
-    61956,
-    61958,
-    61960,
-    61963,
-    61965,
-    61967,
-    61969,
-    61971,
-    61973,
-    61975,
-    61977,
-    61979,
-    61982,
     61984,
-    61986,
-    61988,
-    61990,
-    61992,
-    61994,
-    61996,
-    61999,
-    62001,
-    62003,
-    62005,
-    62007,
-    62009,
-    62011,
-    62013,
-    62015,
     62018,
-    62020,
-    62022,
-    62024,
-    62026,
-    62028,
-    62030,
-    62032,
-    62034,
-    62037,
-    62039,
-    62041,
-    62043,
-    62045,
-    62047,
-    62049,
     62051,
-    62053,
-    62056,
-    62058,
-    62060,
-    62062,
-    62064,
-    62066,
-    62068,
-    62070,
-    62072,
-    62075,
-    62077,
-    62079,
-    62081,
-    62083,
     62085,
-    62087,
-    62089,
-    62091,
-    62094,
-    62096,
-    62098,
-    62100,
-    62102,
-    62104,
-    62106,
-    62108,
-    62110,
-    62113,
-    62115,
-    62117,
     62119,
-    62121,
-    62123,
-    62125,
-    62127,
-    62129,
-    62132,
-    62134,
-    62136,
-    62138,
-    62140,
-    62142,
-    62144,
-    62146,
-    62148,
-    62151,
     62153,
-    62155,
-    62157,
-    62159,
-    62161,
-    62163,
-    62165,
-    62167,
-    62170,
-    62172,
-    62174,
-    62176,
-    62178,
-    62180,
-    62182,
-    62184,
     62186,
-    62189,
-    62191,
-    62193,
-    62195,
-    62197,
-    62199,
-    62201,
-    62203,
-    62205,
-    62207,
-    62210,
-    62212,
-    62214,
-    62216,
-    62218,
     62220,
-    62222,
-    62224,
-    62226,
-    62229,
-    62231,
-    62233,
-    62235,
-    62237,
-    62239,
-    62241,
-    62243,
-    62245,
-    62247,
-    62250,
-    62252,
     62254,
-    62256,
-    62258,
-    62260,
-    62262,
-    62264,
-    62266,
-    62269,
-    62271,
-    62273,
-    62275,
-    62277,
-    62279,
-    62281,
-    62283,
-    62285,
     62287,
-    62290,
-    62292,
-    62294,
-    62296,
-    62298,
-    62300,
-    62302,
-    62304,
-    62306,
-    62309,
-    62311,
-    62313,
-    62315,
-    62317,
-    62319,
     62321,
-    62323,
-    62325,
-    62327,
-    62330,
-    62332,
-    62334,
-    62336,
-    62338,
-    62340,
-    62342,
-    62344,
-    62346,
-    62348,
-    62351,
-    62353,
     62355,
-    62357,
-    62359,
-    62361,
-    62363,
-    62365,
-    62367,
-    62370,
-    62372,
-    62374,
-    62376,
-    62378,
-    62380,
-    62382,
-    62384,
-    62386,
     62388,
-    62391,
-    62393,
-    62395,
-    62397,
-    62399,
-    62401,
-    62403,
-    62405,
-    62407,
-    62409,
-    62412,
-    62414,
-    62416,
-    62418,
-    62420,
     62422,
-    62424,
-    62426,
-    62428,
-    62430,
-    62433,
-    62435,
-    62437,
-    62439,
-    62441,
-    62443,
-    62445,
-    62447,
-    62449,
-    62451,
-    62454,
     62456,
-    62458,
-    62460,
-    62462,
-    62464,
-    62466,
-    62468,
-    62470,
-    62472,
-    62474,
-    62477,
-    62479,
-    62481,
-    62483,
-    62485,
-    62487,
     62489,
-    62491,
-    62493,
-    62495,
-    62498,
-    62500,
-    62502,
-    62504,
-    62506,
-    62508,
-    62510,
-    62512,
-    62514,
-    62516,
-    62519,
-    62521,
     62523,
-    62525,
-    62527,
-    62529,
-    62531,
-    62533,
-    62535,
-    62537,
-    62539,
-    62542,
-    62544,
-    62546,
-    62548,
-    62550,
-    62552,
-    62554,
     62556,
-    62558,
-    62560,
-    62563,
-    62565,
-    62567,
-    62569,
-    62571,
-    62573,
-    62575,
-    62577,
-    62579,
-    62581,
-    62583,
-    62586,
-    62588,
     62590,
-    62592,
-    62594,
-    62596,
-    62598,
-    62600,
-    62602,
-    62604,
-    62607,
-    62609,
-    62611,
-    62613,
-    62615,
-    62617,
-    62619,
-    62621,
     62623,
-    62625,
-    62627,
-    62630,
-    62632,
-    62634,
-    62636,
-    62638,
-    62640,
-    62642,
-    62644,
-    62646,
-    62648,
-    62650,
-    62653,
-    62655,
     62657,
-    62659,
-    62661,
-    62663,
-    62665,
-    62667,
-    62669,
-    62671,
-    62673,
-    62676,
-    62678,
-    62680,
-    62682,
-    62684,
-    62686,
-    62688,
     62690,
-    62692,
-    62694,
-    62696,
-    62699,
-    62701,
-    62703,
-    62705,
-    62707,
-    62709,
-    62711,
-    62713,
-    62715,
-    62717,
-    62719,
-    62722,
     62724,
-    62726,
-    62728,
-    62730,
-    62732,
-    62734,
-    62736,
-    62738,
-    62740,
-    62742,
-    62745,
-    62747,
-    62749,
-    62751,
-    62753,
-    62755,
     62757,
-    62759,
-    62761,
-    62763,
-    62765,
-    62768,
-    62770,
-    62772,
-    62774,
-    62776,
-    62778,
-    62780,
-    62782,
-    62784,
-    62786,
-    62788,
     62790,
-    62793,
-    62795,
-    62797,
-    62799,
-    62801,
-    62803,
-    62805,
-    62807,
-    62809,
-    62811,
-    62813,
-    62816,
-    62818,
-    62820,
-    62822,
     62824,
-    62826,
-    62828,
-    62830,
-    62832,
-    62834,
-    62836,
-    62838,
-    62841,
-    62843,
-    62845,
-    62847,
-    62849,
-    62851,
-    62853,
-    62855,
     62857,
-    62859,
-    62861,
-    62864,
-    62866,
-    62868,
-    62870,
-    62872,
-    62874,
-    62876,
-    62878,
-    62880,
-    62882,
-    62884,
-    62886,
-    62889,
     62891,
-    62893,
-    62895,
-    62897,
-    62899,
-    62901,
-    62903,
-    62905,
-    62907,
-    62909,
-    62911,
-    62914,
-    62916,
-    62918,
-    62920,
-    62922,
     62924,
-    62926,
-    62928,
-    62930,
-    62932,
-    62934,
-    62936,
-    62939,
-    62941,
-    62943,
-    62945,
-    62947,
-    62949,
-    62951,
-    62953,
-    62955,
     62957,
-    62959,
-    62961,
-    62964,
-    62966,
-    62968,
-    62970,
-    62972,
-    62974,
-    62976,
-    62978,
-    62980,
-    62982,
-    62984,
-    62986,
-    62988,
     62991,
-    62993,
-    62995,
-    62997,
-    62999,
-    63001,
-    63003,
-    63005,
-    63007,
-    63009,
-    63011,
-    63013,
-    63016,
-    63018,
-    63020,
-    63022,
     63024,
-    63026,
-    63028,
-    63030,
-    63032,
-    63034,
-    63036,
-    63038,
-    63040,
-    63043,
-    63045,
-    63047,
-    63049,
-    63051,
-    63053,
-    63055,
     63057,
-    63059,
-    63061,
-    63063,
-    63065,
-    63068,
-    63070,
-    63072,
-    63074,
-    63076,
-    63078,
-    63080,
-    63082,
-    63084,
-    63086,
-    63088,
     63090,
-    63092,
-    63095,
-    63097,
-    63099,
-    63101,
-    63103,
-    63105,
-    63107,
-    63109,
-    63111,
-    63113,
-    63115,
-    63117,
-    63119,
-    63122,
     63124,
-    63126,
-    63128,
-    63130,
-    63132,
-    63134,
-    63136,
-    63138,
-    63140,
-    63142,
-    63144,
-    63146,
-    63149,
-    63151,
-    63153,
-    63155,
     63157,
-    63159,
-    63161,
-    63163,
-    63165,
-    63167,
-    63169,
-    63171,
-    63173,
-    63175,
-    63178,
-    63180,
-    63182,
-    63184,
-    63186,
-    63188,
     63190,
-    63192,
-    63194,
-    63196,
-    63198,
-    63200,
-    63202,
-    63205,
-    63207,
-    63209,
-    63211,
-    63213,
-    63215,
-    63217,
-    63219,
-    63221,
     63223,
-    63225,
-    63227,
-    63229,
-    63231,
-    63234,
-    63236,
-    63238,
-    63240,
-    63242,
-    63244,
-    63246,
-    63248,
-    63250,
-    63252,
-    63254,
     63256,
-    63258,
-    63260,
-    63263,
-    63265,
-    63267,
-    63269,
-    63271,
-    63273,
-    63275,
-    63277,
-    63279,
-    63281,
-    63283,
-    63285,
-    63287,
     63289,
-    63292,
-    63294,
-    63296,
-    63298,
-    63300,
-    63302,
-    63304,
-    63306,
-    63308,
-    63310,
-    63312,
-    63314,
-    63316,
-    63318,
-    63321,
     63323,
-    63325,
-    63327,
-    63329,
-    63331,
-    63333,
-    63335,
-    63337,
-    63339,
-    63341,
-    63343,
-    63345,
-    63347,
-    63350,
-    63352,
-    63354,
     63356,
-    63358,
-    63360,
-    63362,
-    63364,
-    63366,
-    63368,
-    63370,
-    63372,
-    63374,
-    63376,
-    63378,
-    63381,
-    63383,
-    63385,
-    63387,
     63389,
-    63391,
-    63393,
-    63395,
-    63397,
-    63399,
-    63401,
-    63403,
-    63405,
-    63407,
-    63409,
-    63412,
-    63414,
-    63416,
-    63418,
-    63420,
     63422,
-    63424,
-    63426,
-    63428,
-    63430,
-    63432,
-    63434,
-    63436,
-    63438,
-    63440,
-    63443,
-    63445,
-    63447,
-    63449,
-    63451,
-    63453,
     63455,
-    63457,
-    63459,
-    63461,
-    63463,
-    63465,
-    63467,
-    63469,
-    63471,
-    63474,
-    63476,
-    63478,
-    63480,
-    63482,
-    63484,
-    63486,
     63488,
-    63490,
-    63492,
-    63494,
-    63496,
-    63498,
-    63500,
-    63502,
-    63505,
-    63507,
-    63509,
-    63511,
-    63513,
-    63515,
-    63517,
-    63519,
     63521,
-    63523,
-    63525,
-    63527,
-    63529,
-    63531,
-    63533,
-    63535,
-    63538,
-    63540,
-    63542,
-    63544,
-    63546,
-    63548,
-    63550,
-    63552,
     63554,
-    63556,
-    63558,
-    63560,
-    63562,
-    63564,
-    63566,
-    63568,
-    63571,
-    63573,
-    63575,
-    63577,
-    63579,
-    63581,
-    63583,
-    63585,
     63587,
-    63589,
-    63591,
-    63593,
-    63595,
-    63597,
-    63599,
-    63601,
-    63604,
-    63606,
-    63608,
-    63610,
-    63612,
-    63614,
-    63616,
-    63618,
     63620,
-    63622,
-    63624,
-    63626,
-    63628,
-    63630,
-    63632,
-    63634,
-    63636,
-    63639,
-    63641,
-    63643,
-    63645,
-    63647,
-    63649,
-    63651,
     63653,
-    63655,
-    63657,
-    63659,
-    63661,
-    63663,
-    63665,
-    63667,
-    63669,
-    63671,
-    63674,
-    63676,
-    63678,
-    63680,
-    63682,
-    63684,
     63686,
-    63688,
-    63690,
-    63692,
-    63694,
-    63696,
-    63698,
-    63700,
-    63702,
-    63704,
-    63706,
-    63709,
-    63711,
-    63713,
-    63715,
-    63717,
     63719,
-    63721,
-    63723,
-    63725,
-    63727,
-    63729,
-    63731,
-    63733,
-    63735,
-    63737,
-    63739,
-    63741,
-    63743,
-    63746,
-    63748,
-    63750,
     63752,
-    63754,
-    63756,
-    63758,
-    63760,
-    63762,
-    63764,
-    63766,
-    63768,
-    63770,
-    63772,
-    63774,
-    63776,
-    63778,
-    63780,
-    63783,
     63785,
-    63787,
-    63789,
-    63791,
-    63793,
-    63795,
-    63797,
-    63799,
-    63801,
-    63803,
-    63805,
-    63807,
-    63809,
-    63811,
-    63813,
-    63815,
     63817,
-    63820,
-    63822,
-    63824,
-    63826,
-    63828,
-    63830,
-    63832,
-    63834,
-    63836,
-    63838,
-    63840,
-    63842,
-    63844,
-    63846,
-    63848,
     63850,
-    63852,
-    63854,
-    63856,
-    63859,
-    63861,
-    63863,
-    63865,
-    63867,
-    63869,
-    63871,
-    63873,
-    63875,
-    63877,
-    63879,
-    63881,
     63883,
-    63885,
-    63887,
-    63889,
-    63891,
-    63893,
-    63895,
-    63898,
-    63900,
-    63902,
-    63904,
-    63906,
-    63908,
-    63910,
-    63912,
-    63914,
     63916,
-    63918,
-    63920,
-    63922,
-    63924,
-    63926,
-    63928,
-    63930,
-    63932,
-    63934,
-    63936,
-    63939,
-    63941,
-    63943,
-    63945,
-    63947,
     63949,
-    63951,
-    63953,
-    63955,
-    63957,
-    63959,
-    63961,
-    63963,
-    63965,
-    63967,
-    63969,
-    63971,
-    63973,
-    63975,
-    63977,
-    63980,
     63982,
-    63984,
-    63986,
-    63988,
-    63990,
-    63992,
-    63994,
-    63996,
-    63998,
-    64000,
-    64002,
-    64004,
-    64006,
-    64008,
-    64010,
-    64012,
     64014,
-    64016,
-    64018,
-    64020,
-    64023,
-    64025,
-    64027,
-    64029,
-    64031,
-    64033,
-    64035,
-    64037,
-    64039,
-    64041,
-    64043,
-    64045,
     64047,
-    64049,
-    64051,
-    64053,
-    64055,
-    64057,
-    64059,
-    64061,
-    64063,
-    64066,
-    64068,
-    64070,
-    64072,
-    64074,
-    64076,
-    64078,
     64080,
-    64082,
-    64084,
-    64086,
-    64088,
-    64090,
-    64092,
-    64094,
-    64096,
-    64098,
-    64100,
-    64102,
-    64104,
-    64106,
-    64108,
-    64110,
     64113,
-    64115,
-    64117,
-    64119,
-    64121,
-    64123,
-    64125,
-    64127,
-    64129,
-    64131,
-    64133,
-    64135,
-    64137,
-    64139,
-    64141,
-    64143,
     64145,
-    64147,
-    64149,
-    64151,
-    64153,
-    64155,
-    64158,
-    64160,
-    64162,
-    64164,
-    64166,
-    64168,
-    64170,
-    64172,
-    64174,
-    64176,
     64178,
-    64180,
-    64182,
-    64184,
-    64186,
-    64188,
-    64190,
-    64192,
-    64194,
-    64196,
-    64198,
-    64200,
-    64202,
-    64204,
-    64207,
-    64209,
     64211,
-    64213,
-    64215,
-    64217,
-    64219,
-    64221,
-    64223,
-    64225,
-    64227,
-    64229,
-    64231,
-    64233,
-    64235,
-    64237,
-    64239,
-    64241,
     64243,
-    64245,
-    64247,
-    64249,
-    64251,
-    64253,
-    64255,
-    64258,
-    64260,
-    64262,
-    64264,
-    64266,
-    64268,
-    64270,
-    64272,
-    64274,
     64276,
-    64278,
-    64280,
-    64282,
-    64284,
-    64286,
-    64288,
-    64290,
-    64292,
-    64294,
-    64296,
-    64298,
-    64300,
-    64302,
-    64304,
-    64306,
     64309,
-    64311,
-    64313,
-    64315,
-    64317,
-    64319,
-    64321,
-    64323,
-    64325,
-    64327,
-    64329,
-    64331,
-    64333,
-    64335,
-    64337,
-    64339,
     64341,
-    64343,
-    64345,
-    64347,
-    64349,
-    64351,
-    64353,
-    64355,
-    64357,
-    64359,
-    64361,
-    64364,
-    64366,
-    64368,
-    64370,
-    64372,
     64374,
-    64376,
-    64378,
-    64380,
-    64382,
-    64384,
-    64386,
-    64388,
-    64390,
-    64392,
-    64394,
-    64396,
-    64398,
-    64400,
-    64402,
-    64404,
     64406,
-    64408,
-    64410,
-    64412,
-    64414,
-    64416,
-    64418,
-    64421,
-    64423,
-    64425,
-    64427,
-    64429,
-    64431,
-    64433,
-    64435,
-    64437,
     64439,
-    64441,
-    64443,
-    64445,
-    64447,
-    64449,
-    64451,
-    64453,
-    64455,
-    64457,
-    64459,
-    64461,
-    64463,
-    64465,
-    64467,
-    64469,
     64471,
-    64473,
-    64475,
-    64477,
-    64479,
-    64482,
-    64484,
-    64486,
-    64488,
-    64490,
-    64492,
-    64494,
-    64496,
-    64498,
-    64500,
-    64502,
     64504,
-    64506,
-    64508,
-    64510,
-    64512,
-    64514,
-    64516,
-    64518,
-    64520,
-    64522,
-    64524,
-    64526,
-    64528,
-    64530,
-    64532,
-    64534,
     64536,
-    64538,
-    64540,
-    64542,
-    64544,
-    64547,
-    64549,
-    64551,
-    64553,
-    64555,
-    64557,
-    64559,
-    64561,
-    64563,
-    64565,
-    64567,
     64569,
-    64571,
-    64573,
-    64575,
-    64577,
-    64579,
-    64581,
-    64583,
-    64585,
-    64587,
-    64589,
-    64591,
-    64593,
-    64595,
-    64597,
-    64599,
     64601,
-    64603,
-    64605,
-    64607,
-    64609,
-    64611,
-    64614,
-    64616,
-    64618,
-    64620,
-    64622,
-    64624,
-    64626,
-    64628,
-    64630,
-    64632,
     64634,
-    64636,
-    64638,
-    64640,
-    64642,
-    64644,
-    64646,
-    64648,
-    64650,
-    64652,
-    64654,
-    64656,
-    64658,
-    64660,
-    64662,
-    64664,
     64666,
-    64668,
-    64670,
-    64672,
-    64674,
-    64676,
-    64678,
-    64680,
-    64682,
-    64684,
-    64686,
-    64689,
-    64691,
-    64693,
-    64695,
-    64697,
     64699,
-    64701,
-    64703,
-    64705,
-    64707,
-    64709,
-    64711,
-    64713,
-    64715,
-    64717,
-    64719,
-    64721,
-    64723,
-    64725,
-    64727,
-    64729,
     64731,
-    64733,
-    64735,
-    64737,
-    64739,
-    64741,
-    64743,
-    64745,
-    64747,
-    64749,
-    64751,
-    64753,
-    64755,
-    64757,
-    64759,
-    64761,
     64763,
-    64765,
-    64767,
-    64770,
-    64772,
-    64774,
-    64776,
-    64778,
-    64780,
-    64782,
-    64784,
-    64786,
-    64788,
-    64790,
-    64792,
-    64794,
     64796,
-    64798,
-    64800,
-    64802,
-    64804,
-    64806,
-    64808,
-    64810,
-    64812,
-    64814,
-    64816,
-    64818,
-    64820,
-    64822,
-    64824,
-    64826,
     64828,
-    64830,
-    64832,
-    64834,
-    64836,
-    64838,
-    64840,
-    64842,
-    64844,
-    64846,
-    64848,
-    64850,
-    64852,
-    64854,
-    64856,
-    64858,
     64861,
-    64863,
-    64865,
-    64867,
-    64869,
-    64871,
-    64873,
-    64875,
-    64877,
-    64879,
-    64881,
-    64883,
-    64885,
-    64887,
-    64889,
-    64891,
     64893,
-    64895,
-    64897,
-    64899,
-    64901,
-    64903,
-    64905,
-    64907,
-    64909,
-    64911,
-    64913,
-    64915,
-    64917,
-    64919,
-    64921,
-    64923,
     64925,
-    64927,
-    64929,
-    64931,
-    64933,
-    64935,
-    64937,
-    64939,
-    64941,
-    64943,
-    64945,
-    64947,
-    64949,
-    64951,
-    64953,
-    64955,
     64957,
-    64959,
-    64961,
-    64963,
-    64966,
-    64968,
-    64970,
-    64972,
-    64974,
-    64976,
-    64978,
-    64980,
-    64982,
-    64984,
-    64986,
-    64988,
     64990,
-    64992,
-    64994,
-    64996,
-    64998,
-    65000,
-    65002,
-    65004,
-    65006,
-    65008,
-    65010,
-    65012,
-    65014,
-    65016,
-    65018,
-    65020,
     65022,
-    65024,
-    65026,
-    65028,
-    65030,
-    65032,
-    65034,
-    65036,
-    65038,
-    65040,
-    65042,
-    65044,
-    65046,
-    65048,
-    65050,
-    65052,
     65054,
-    65056,
-    65058,
-    65060,
-    65062,
-    65064,
-    65066,
-    65068,
-    65070,
-    65072,
-    65074,
-    65076,
-    65078,
-    65080,
-    65082,
-    65084,
     65086,
-    65088,
-    65090,
-    65092,
-    65095,
-    65097,
-    65099,
-    65101,
-    65103,
-    65105,
-    65107,
-    65109,
-    65111,
-    65113,
-    65115,
-    65117,
     65119,
-    65121,
-    65123,
-    65125,
-    65127,
-    65129,
-    65131,
-    65133,
-    65135,
-    65137,
-    65139,
-    65141,
-    65143,
-    65145,
-    65147,
-    65149,
     65151,
-    65153,
-    65155,
-    65157,
-    65159,
-    65161,
-    65163,
-    65165,
-    65167,
-    65169,
-    65171,
-    65173,
-    65175,
-    65177,
-    65179,
-    65181,
     65183,
-    65185,
-    65187,
-    65189,
-    65191,
-    65193,
-    65195,
-    65197,
-    65199,
-    65201,
-    65203,
-    65205,
-    65207,
-    65209,
-    65211,
-    65213,
     65215,
-    65217,
-    65219,
-    65221,
-    65223,
-    65225,
-    65227,
-    65229,
-    65231,
-    65233,
-    65235,
-    65237,
-    65239,
-    65241,
-    65243,
-    65245,
     65247,
-    65249,
-    65251,
-    65253,
-    65255,
-    65257,
-    65259,
-    65261,
-    65263,
-    65265,
-    65267,
-    65269,
-    65271,
-    65273,
-    65275,
-    65277,
     65279,
-    65282,
-    65284,
-    65286,
-    65288,
-    65290,
-    65292,
-    65294,
-    65296,
-    65298,
-    65300,
-    65302,
-    65304,
-    65306,
-    65308,
-    65310,
     65312,
-    65314,
-    65316,
-    65318,
-    65320,
-    65322,
-    65324,
-    65326,
-    65328,
-    65330,
-    65332,
-    65334,
-    65336,
-    65338,
-    65340,
-    65342,
     65344,
-    65346,
-    65348,
-    65350,
-    65352,
-    65354,
-    65356,
-    65358,
-    65360,
-    65362,
-    65364,
-    65366,
-    65368,
-    65370,
-    65372,
-    65374,
     65376,
-    65378,
-    65380,
-    65382,
-    65384,
-    65386,
-    65388,
-    65390,
-    65392,
-    65394,
-    65396,
-    65398,
-    65400,
-    65402,
-    65404,
-    65406,
     65408,
-    65410,
-    65412,
-    65414,
-    65416,
-    65418,
-    65420,
-    65422,
-    65424,
-    65426,
-    65428,
-    65430,
-    65432,
-    65434,
-    65436,
-    65438,
     65440,
-    65442,
-    65444,
-    65446,
-    65448,
-    65450,
-    65452,
-    65454,
-    65456,
-    65458,
-    65460,
-    65462,
-    65464,
-    65466,
-    65468,
-    65470,
     65472,
-    65474,
-    65476,
-    65478,
-    65480,
-    65482,
-    65484,
-    65486,
-    65488,
-    65490,
-    65492,
-    65494,
-    65496,
-    65498,
-    65500,
-    65502,
     65504,
-    65506,
-    65508,
-    65510,
-    65512,
-    65514,
-    65516,
-    65518,
-    65520,
-    65522,
-    65524,
-    65526,
-    65528,
-    65530,
-    65532,
-    65534,
     65536
 };
 
 real_32_t faac_table_pow[FAAC_SAMPLES+1] = {
     65536,
-    65539,
-    65542,
-    65544,
-    65547,
-    65550,
-    65553,
-    65555,
-    65558,
-    65561,
-    65564,
-    65567,
-    65569,
-    65572,
-    65575,
-    65578,
     65580,
-    65583,
-    65586,
-    65589,
-    65591,
-    65594,
-    65597,
-    65600,
-    65603,
-    65605,
-    65608,
-    65611,
-    65614,
-    65616,
-    65619,
-    65622,
     65625,
-    65628,
-    65630,
-    65633,
-    65636,
-    65639,
-    65641,
-    65644,
-    65647,
-    65650,
-    65653,
-    65655,
-    65658,
-    65661,
-    65664,
-    65666,
     65669,
-    65672,
-    65675,
-    65678,
-    65680,
-    65683,
-    65686,
-    65689,
-    65691,
-    65694,
-    65697,
-    65700,
-    65703,
-    65705,
-    65708,
-    65711,
     65714,
-    65716,
-    65719,
-    65722,
-    65725,
-    65728,
-    65730,
-    65733,
-    65736,
-    65739,
-    65741,
-    65744,
-    65747,
-    65750,
-    65753,
-    65755,
     65758,
-    65761,
-    65764,
-    65767,
-    65769,
-    65772,
-    65775,
-    65778,
-    65780,
-    65783,
-    65786,
-    65789,
-    65792,
-    65794,
-    65797,
-    65800,
     65803,
-    65805,
-    65808,
-    65811,
-    65814,
-    65817,
-    65819,
-    65822,
-    65825,
-    65828,
-    65831,
-    65833,
-    65836,
-    65839,
-    65842,
-    65844,
     65847,
-    65850,
-    65853,
-    65856,
-    65858,
-    65861,
-    65864,
-    65867,
-    65870,
-    65872,
-    65875,
-    65878,
-    65881,
-    65883,
-    65886,
-    65889,
     65892,
-    65895,
-    65897,
-    65900,
-    65903,
-    65906,
-    65909,
-    65911,
-    65914,
-    65917,
-    65920,
-    65923,
-    65925,
-    65928,
-    65931,
-    65934,
     65936,
-    65939,
-    65942,
-    65945,
-    65948,
-    65950,
-    65953,
-    65956,
-    65959,
-    65962,
-    65964,
-    65967,
-    65970,
-    65973,
-    65976,
-    65978,
     65981,
-    65984,
-    65987,
-    65989,
-    65992,
-    65995,
-    65998,
-    66001,
-    66003,
-    66006,
-    66009,
-    66012,
-    66015,
-    66017,
-    66020,
-    66023,
     66026,
-    66029,
-    66031,
-    66034,
-    66037,
-    66040,
-    66043,
-    66045,
-    66048,
-    66051,
-    66054,
-    66057,
-    66059,
-    66062,
-    66065,
-    66068,
     66071,
-    66073,
-    66076,
-    66079,
-    66082,
-    66084,
-    66087,
-    66090,
-    66093,
-    66096,
-    66098,
-    66101,
-    66104,
-    66107,
-    66110,
-    66112,
     66115,
-    66118,
-    66121,
-    66124,
-    66126,
-    66129,
-    66132,
-    66135,
-    66138,
-    66140,
-    66143,
-    66146,
-    66149,
-    66152,
-    66154,
-    66157,
     66160,
-    66163,
-    66166,
-    66168,
-    66171,
-    66174,
-    66177,
-    66180,
-    66182,
-    66185,
-    66188,
-    66191,
-    66194,
-    66196,
-    66199,
-    66202,
     66205,
-    66208,
-    66210,
-    66213,
-    66216,
-    66219,
-    66222,
-    66224,
-    66227,
-    66230,
-    66233,
-    66236,
-    66238,
-    66241,
-    66244,
-    66247,
     66250,
-    66252,
-    66255,
-    66258,
-    66261,
-    66264,
-    66266,
-    66269,
-    66272,
-    66275,
-    66278,
-    66280,
-    66283,
-    66286,
-    66289,
-    66292,
     66294,
-    66297,
-    66300,
-    66303,
-    66306,
-    66309,
-    66311,
-    66314,
-    66317,
-    66320,
-    66323,
-    66325,
-    66328,
-    66331,
-    66334,
-    66337,
     66339,
-    66342,
-    66345,
-    66348,
-    66351,
-    66353,
-    66356,
-    66359,
-    66362,
-    66365,
-    66367,
-    66370,
-    66373,
-    66376,
-    66379,
-    66382,
     66384,
-    66387,
-    66390,
-    66393,
-    66396,
-    66398,
-    66401,
-    66404,
-    66407,
-    66410,
-    66412,
-    66415,
-    66418,
-    66421,
-    66424,
-    66426,
     66429,
-    66432,
-    66435,
-    66438,
-    66441,
-    66443,
-    66446,
-    66449,
-    66452,
-    66455,
-    66457,
-    66460,
-    66463,
-    66466,
-    66469,
-    66471,
     66474,
-    66477,
-    66480,
-    66483,
-    66485,
-    66488,
-    66491,
-    66494,
-    66497,
-    66500,
-    66502,
-    66505,
-    66508,
-    66511,
-    66514,
-    66516,
     66519,
-    66522,
-    66525,
-    66528,
-    66531,
-    66533,
-    66536,
-    66539,
-    66542,
-    66545,
-    66547,
-    66550,
-    66553,
-    66556,
-    66559,
-    66561,
     66564,
-    66567,
-    66570,
-    66573,
-    66576,
-    66578,
-    66581,
-    66584,
-    66587,
-    66590,
-    66592,
-    66595,
-    66598,
-    66601,
-    66604,
-    66607,
     66609,
-    66612,
-    66615,
-    66618,
-    66621,
-    66623,
-    66626,
-    66629,
-    66632,
-    66635,
-    66638,
-    66640,
-    66643,
-    66646,
-    66649,
-    66652,
     66654,
-    66657,
-    66660,
-    66663,
-    66666,
-    66669,
-    66671,
-    66674,
-    66677,
-    66680,
-    66683,
-    66685,
-    66688,
-    66691,
-    66694,
-    66697,
     66700,
-    66702,
-    66705,
-    66708,
-    66711,
-    66714,
-    66717,
-    66719,
-    66722,
-    66725,
-    66728,
-    66731,
-    66733,
-    66736,
-    66739,
-    66742,
     66745,
-    66748,
-    66750,
-    66753,
-    66756,
-    66759,
-    66762,
-    66765,
-    66767,
-    66770,
-    66773,
-    66776,
-    66779,
-    66781,
-    66784,
-    66787,
     66790,
-    66793,
-    66796,
-    66798,
-    66801,
-    66804,
-    66807,
-    66810,
-    66813,
-    66815,
-    66818,
-    66821,
-    66824,
-    66827,
-    66830,
-    66832,
     66835,
-    66838,
-    66841,
-    66844,
-    66847,
-    66849,
-    66852,
-    66855,
-    66858,
-    66861,
-    66863,
-    66866,
-    66869,
-    66872,
-    66875,
-    66878,
     66880,
-    66883,
-    66886,
-    66889,
-    66892,
-    66895,
-    66897,
-    66900,
-    66903,
-    66906,
-    66909,
-    66912,
-    66914,
-    66917,
-    66920,
-    66923,
     66926,
-    66929,
-    66931,
-    66934,
-    66937,
-    66940,
-    66943,
-    66946,
-    66948,
-    66951,
-    66954,
-    66957,
-    66960,
-    66963,
-    66965,
-    66968,
     66971,
-    66974,
-    66977,
-    66980,
-    66982,
-    66985,
-    66988,
-    66991,
-    66994,
-    66997,
-    66999,
-    67002,
-    67005,
-    67008,
-    67011,
-    67014,
     67016,
-    67019,
-    67022,
-    67025,
-    67028,
-    67031,
-    67033,
-    67036,
-    67039,
-    67042,
-    67045,
-    67048,
-    67050,
-    67053,
-    67056,
-    67059,
     67062,
-    67065,
-    67067,
-    67070,
-    67073,
-    67076,
-    67079,
-    67082,
-    67084,
-    67087,
-    67090,
-    67093,
-    67096,
-    67099,
-    67102,
-    67104,
     67107,
-    67110,
-    67113,
-    67116,
-    67119,
-    67121,
-    67124,
-    67127,
-    67130,
-    67133,
-    67136,
-    67138,
-    67141,
-    67144,
-    67147,
-    67150,
     67153,
-    67155,
-    67158,
-    67161,
-    67164,
-    67167,
-    67170,
-    67173,
-    67175,
-    67178,
-    67181,
-    67184,
-    67187,
-    67190,
-    67192,
-    67195,
     67198,
-    67201,
-    67204,
-    67207,
-    67209,
-    67212,
-    67215,
-    67218,
-    67221,
-    67224,
-    67227,
-    67229,
-    67232,
-    67235,
-    67238,
-    67241,
     67244,
-    67246,
-    67249,
-    67252,
-    67255,
-    67258,
-    67261,
-    67264,
-    67266,
-    67269,
-    67272,
-    67275,
-    67278,
-    67281,
-    67283,
-    67286,
     67289,
-    67292,
-    67295,
-    67298,
-    67301,
-    67303,
-    67306,
-    67309,
-    67312,
-    67315,
-    67318,
-    67320,
-    67323,
-    67326,
-    67329,
-    67332,
     67335,
-    67338,
-    67340,
-    67343,
-    67346,
-    67349,
-    67352,
-    67355,
-    67357,
-    67360,
-    67363,
-    67366,
-    67369,
-    67372,
-    67375,
-    67377,
     67380,
-    67383,
-    67386,
-    67389,
-    67392,
-    67395,
-    67397,
-    67400,
-    67403,
-    67406,
-    67409,
-    67412,
-    67415,
-    67417,
-    67420,
-    67423,
     67426,
-    67429,
-    67432,
-    67434,
-    67437,
-    67440,
-    67443,
-    67446,
-    67449,
-    67452,
-    67454,
-    67457,
-    67460,
-    67463,
-    67466,
-    67469,
     67472,
-    67474,
-    67477,
-    67480,
-    67483,
-    67486,
-    67489,
-    67492,
-    67494,
-    67497,
-    67500,
-    67503,
-    67506,
-    67509,
-    67512,
-    67514,
     67517,
-    67520,
-    67523,
-    67526,
-    67529,
-    67532,
-    67534,
-    67537,
-    67540,
-    67543,
-    67546,
-    67549,
-    67552,
-    67554,
-    67557,
-    67560,
     67563,
-    67566,
-    67569,
-    67572,
-    67574,
-    67577,
-    67580,
-    67583,
-    67586,
-    67589,
-    67592,
-    67594,
-    67597,
-    67600,
-    67603,
-    67606,
     67609,
-    67612,
-    67614,
-    67617,
-    67620,
-    67623,
-    67626,
-    67629,
-    67632,
-    67634,
-    67637,
-    67640,
-    67643,
-    67646,
-    67649,
-    67652,
     67655,
-    67657,
-    67660,
-    67663,
-    67666,
-    67669,
-    67672,
-    67675,
-    67677,
-    67680,
-    67683,
-    67686,
-    67689,
-    67692,
-    67695,
-    67697,
     67700,
-    67703,
-    67706,
-    67709,
-    67712,
-    67715,
-    67718,
-    67720,
-    67723,
-    67726,
-    67729,
-    67732,
-    67735,
-    67738,
-    67740,
-    67743,
     67746,
-    67749,
-    67752,
-    67755,
-    67758,
-    67760,
-    67763,
-    67766,
-    67769,
-    67772,
-    67775,
-    67778,
-    67781,
-    67783,
-    67786,
-    67789,
     67792,
-    67795,
-    67798,
-    67801,
-    67804,
-    67806,
-    67809,
-    67812,
-    67815,
-    67818,
-    67821,
-    67824,
-    67826,
-    67829,
-    67832,
-    67835,
     67838,
-    67841,
-    67844,
-    67847,
-    67849,
-    67852,
-    67855,
-    67858,
-    67861,
-    67864,
-    67867,
-    67870,
-    67872,
-    67875,
-    67878,
-    67881,
     67884,
-    67887,
-    67890,
-    67892,
-    67895,
-    67898,
-    67901,
-    67904,
-    67907,
-    67910,
-    67913,
-    67915,
-    67918,
-    67921,
-    67924,
-    67927,
     67930,
-    67933,
-    67936,
-    67938,
-    67941,
-    67944,
-    67947,
-    67950,
-    67953,
-    67956,
-    67959,
-    67961,
-    67964,
-    67967,
-    67970,
-    67973,
     67976,
-    67979,
-    67982,
-    67984,
-    67987,
-    67990,
-    67993,
-    67996,
-    67999,
-    68002,
-    68005,
-    68007,
-    68010,
-    68013,
-    68016,
-    68019,
     68022,
-    68025,
-    68028,
-    68030,
-    68033,
-    68036,
-    68039,
-    68042,
-    68045,
-    68048,
-    68051,
-    68054,
-    68056,
-    68059,
-    68062,
-    68065,
     68068,
-    68071,
-    68074,
-    68077,
-    68079,
-    68082,
-    68085,
-    68088,
-    68091,
-    68094,
-    68097,
-    68100,
-    68102,
-    68105,
-    68108,
-    68111,
     68114,
-    68117,
-    68120,
-    68123,
-    68126,
-    68128,
-    68131,
-    68134,
-    68137,
-    68140,
-    68143,
-    68146,
-    68149,
-    68151,
-    68154,
-    68157,
     68160,
-    68163,
-    68166,
-    68169,
-    68172,
-    68175,
-    68177,
-    68180,
-    68183,
-    68186,
-    68189,
-    68192,
-    68195,
-    68198,
-    68201,
-    68203,
     68206,
-    68209,
-    68212,
-    68215,
-    68218,
-    68221,
-    68224,
-    68226,
-    68229,
-    68232,
-    68235,
-    68238,
-    68241,
-    68244,
-    68247,
-    68250,
     68252,
-    68255,
-    68258,
-    68261,
-    68264,
-    68267,
-    68270,
-    68273,
-    68276,
-    68278,
-    68281,
-    68284,
-    68287,
-    68290,
-    68293,
-    68296,
     68299,
-    68302,
-    68304,
-    68307,
-    68310,
-    68313,
-    68316,
-    68319,
-    68322,
-    68325,
-    68328,
-    68330,
-    68333,
-    68336,
-    68339,
-    68342,
     68345,
-    68348,
-    68351,
-    68354,
-    68357,
-    68359,
-    68362,
-    68365,
-    68368,
-    68371,
-    68374,
-    68377,
-    68380,
-    68383,
-    68385,
-    68388,
     68391,
-    68394,
-    68397,
-    68400,
-    68403,
-    68406,
-    68409,
-    68411,
-    68414,
-    68417,
-    68420,
-    68423,
-    68426,
-    68429,
-    68432,
-    68435,
     68438,
-    68440,
-    68443,
-    68446,
-    68449,
-    68452,
-    68455,
-    68458,
-    68461,
-    68464,
-    68466,
-    68469,
-    68472,
-    68475,
-    68478,
-    68481,
     68484,
-    68487,
-    68490,
-    68493,
-    68495,
-    68498,
-    68501,
-    68504,
-    68507,
-    68510,
-    68513,
-    68516,
-    68519,
-    68522,
-    68524,
-    68527,
     68530,
-    68533,
-    68536,
-    68539,
-    68542,
-    68545,
-    68548,
-    68551,
-    68553,
-    68556,
-    68559,
-    68562,
-    68565,
-    68568,
-    68571,
-    68574,
     68577,
-    68580,
-    68582,
-    68585,
-    68588,
-    68591,
-    68594,
-    68597,
-    68600,
-    68603,
-    68606,
-    68609,
-    68611,
-    68614,
-    68617,
-    68620,
     68623,
-    68626,
-    68629,
-    68632,
-    68635,
-    68638,
-    68641,
-    68643,
-    68646,
-    68649,
-    68652,
-    68655,
-    68658,
-    68661,
-    68664,
-    68667,
     68670,
-    68672,
-    68675,
-    68678,
-    68681,
-    68684,
-    68687,
-    68690,
-    68693,
-    68696,
-    68699,
-    68702,
-    68704,
-    68707,
-    68710,
-    68713,
     68716,
-    68719,
-    68722,
-    68725,
-    68728,
-    68731,
-    68733,
-    68736,
-    68739,
-    68742,
-    68745,
-    68748,
-    68751,
-    68754,
-    68757,
-    68760,
     68763,
-    68765,
-    68768,
-    68771,
-    68774,
-    68777,
-    68780,
-    68783,
-    68786,
-    68789,
-    68792,
-    68795,
-    68797,
-    68800,
-    68803,
-    68806,
     68809,
-    68812,
-    68815,
-    68818,
-    68821,
-    68824,
-    68827,
-    68830,
-    68832,
-    68835,
-    68838,
-    68841,
-    68844,
-    68847,
-    68850,
-    68853,
     68856,
-    68859,
-    68862,
-    68864,
-    68867,
-    68870,
-    68873,
-    68876,
-    68879,
-    68882,
-    68885,
-    68888,
-    68891,
-    68894,
-    68897,
-    68899,
     68902,
-    68905,
-    68908,
-    68911,
-    68914,
-    68917,
-    68920,
-    68923,
-    68926,
-    68929,
-    68932,
-    68934,
-    68937,
-    68940,
-    68943,
-    68946,
     68949,
-    68952,
-    68955,
-    68958,
-    68961,
-    68964,
-    68967,
-    68969,
-    68972,
-    68975,
-    68978,
-    68981,
-    68984,
-    68987,
-    68990,
-    68993,
     68996,
-    68999,
-    69002,
-    69004,
-    69007,
-    69010,
-    69013,
-    69016,
-    69019,
-    69022,
-    69025,
-    69028,
-    69031,
-    69034,
-    69037,
-    69039,
     69042,
-    69045,
-    69048,
-    69051,
-    69054,
-    69057,
-    69060,
-    69063,
-    69066,
-    69069,
-    69072,
-    69075,
-    69077,
-    69080,
-    69083,
-    69086,
     69089,
-    69092,
-    69095,
-    69098,
-    69101,
-    69104,
-    69107,
-    69110,
-    69113,
-    69115,
-    69118,
-    69121,
-    69124,
-    69127,
-    69130,
-    69133,
     69136,
-    69139,
-    69142,
-    69145,
-    69148,
-    69151,
-    69153,
-    69156,
-    69159,
-    69162,
-    69165,
-    69168,
-    69171,
-    69174,
-    69177,
-    69180,
     69183,
-    69186,
-    69189,
-    69192,
-    69194,
-    69197,
-    69200,
-    69203,
-    69206,
-    69209,
-    69212,
-    69215,
-    69218,
-    69221,
-    69224,
-    69227,
     69230,
-    69233,
-    69235,
-    69238,
-    69241,
-    69244,
-    69247,
-    69250,
-    69253,
-    69256,
-    69259,
-    69262,
-    69265,
-    69268,
-    69271,
-    69274,
     69276,
-    69279,
-    69282,
-    69285,
-    69288,
-    69291,
-    69294,
-    69297,
-    69300,
-    69303,
-    69306,
-    69309,
-    69312,
-    69315,
-    69318,
-    69320,
     69323,
-    69326,
-    69329,
-    69332,
-    69335,
-    69338,
-    69341,
-    69344,
-    69347,
-    69350,
-    69353,
-    69356,
-    69359,
-    69362,
-    69364,
-    69367,
     69370,
-    69373,
-    69376,
-    69379,
-    69382,
-    69385,
-    69388,
-    69391,
-    69394,
-    69397,
-    69400,
-    69403,
-    69406,
-    69408,
-    69411,
-    69414,
     69417,
-    69420,
-    69423,
-    69426,
-    69429,
-    69432,
-    69435,
-    69438,
-    69441,
-    69444,
-    69447,
-    69450,
-    69453,
-    69455,
-    69458,
-    69461,
     69464,
-    69467,
-    69470,
-    69473,
-    69476,
-    69479,
-    69482,
-    69485,
-    69488,
-    69491,
-    69494,
-    69497,
-    69500,
-    69503,
-    69505,
-    69508,
     69511,
-    69514,
-    69517,
-    69520,
-    69523,
-    69526,
-    69529,
-    69532,
-    69535,
-    69538,
-    69541,
-    69544,
-    69547,
-    69550,
-    69553,
-    69555,
     69558,
-    69561,
-    69564,
-    69567,
-    69570,
-    69573,
-    69576,
-    69579,
-    69582,
-    69585,
-    69588,
-    69591,
-    69594,
-    69597,
-    69600,
-    69603,
     69606,
-    69608,
-    69611,
-    69614,
-    69617,
-    69620,
-    69623,
-    69626,
-    69629,
-    69632,
-    69635,
-    69638,
-    69641,
-    69644,
-    69647,
-    69650,
     69653,
-    69656,
-    69659,
-    69661,
-    69664,
-    69667,
-    69670,
-    69673,
-    69676,
-    69679,
-    69682,
-    69685,
-    69688,
-    69691,
-    69694,
-    69697,
     69700,
-    69703,
-    69706,
-    69709,
-    69712,
-    69715,
-    69718,
-    69720,
-    69723,
-    69726,
-    69729,
-    69732,
-    69735,
-    69738,
-    69741,
-    69744,
     69747,
-    69750,
-    69753,
-    69756,
-    69759,
-    69762,
-    69765,
-    69768,
-    69771,
-    69774,
-    69777,
-    69779,
-    69782,
-    69785,
-    69788,
-    69791,
     69794,
-    69797,
-    69800,
-    69803,
-    69806,
-    69809,
-    69812,
-    69815,
-    69818,
-    69821,
-    69824,
-    69827,
-    69830,
-    69833,
-    69836,
-    69839,
     69841,
-    69844,
-    69847,
-    69850,
-    69853,
-    69856,
-    69859,
-    69862,
-    69865,
-    69868,
-    69871,
-    69874,
-    69877,
-    69880,
-    69883,
-    69886,
     69889,
-    69892,
-    69895,
-    69898,
-    69901,
-    69904,
-    69907,
-    69909,
-    69912,
-    69915,
-    69918,
-    69921,
-    69924,
-    69927,
-    69930,
-    69933,
     69936,
-    69939,
-    69942,
-    69945,
-    69948,
-    69951,
-    69954,
-    69957,
-    69960,
-    69963,
-    69966,
-    69969,
-    69972,
-    69975,
-    69978,
-    69981,
     69983,
-    69986,
-    69989,
-    69992,
-    69995,
-    69998,
-    70001,
-    70004,
-    70007,
-    70010,
-    70013,
-    70016,
-    70019,
-    70022,
-    70025,
-    70028,
     70031,
-    70034,
-    70037,
-    70040,
-    70043,
-    70046,
-    70049,
-    70052,
-    70055,
-    70058,
-    70060,
-    70063,
-    70066,
-    70069,
-    70072,
-    70075,
     70078,
-    70081,
-    70084,
-    70087,
-    70090,
-    70093,
-    70096,
-    70099,
-    70102,
-    70105,
-    70108,
-    70111,
-    70114,
-    70117,
-    70120,
-    70123,
     70126,
-    70129,
-    70132,
-    70135,
-    70138,
-    70141,
-    70144,
-    70146,
-    70149,
-    70152,
-    70155,
-    70158,
-    70161,
-    70164,
-    70167,
-    70170,
     70173,
-    70176,
-    70179,
-    70182,
-    70185,
-    70188,
-    70191,
-    70194,
-    70197,
-    70200,
-    70203,
-    70206,
-    70209,
-    70212,
-    70215,
-    70218,
     70221,
-    70224,
-    70227,
-    70230,
-    70233,
-    70236,
-    70239,
-    70242,
-    70245,
-    70247,
-    70250,
-    70253,
-    70256,
-    70259,
-    70262,
-    70265,
     70268,
-    70271,
-    70274,
-    70277,
-    70280,
-    70283,
-    70286,
-    70289,
-    70292,
-    70295,
-    70298,
-    70301,
-    70304,
-    70307,
-    70310,
-    70313,
     70316,
-    70319,
-    70322,
-    70325,
-    70328,
-    70331,
-    70334,
-    70337,
-    70340,
-    70343,
-    70346,
-    70349,
-    70352,
-    70355,
-    70358,
-    70360,
     70363,
-    70366,
-    70369,
-    70372,
-    70375,
-    70378,
-    70381,
-    70384,
-    70387,
-    70390,
-    70393,
-    70396,
-    70399,
-    70402,
-    70405,
-    70408,
     70411,
-    70414,
-    70417,
-    70420,
-    70423,
-    70426,
-    70429,
-    70432,
-    70435,
-    70438,
-    70441,
-    70444,
-    70447,
-    70450,
-    70453,
-    70456,
     70459,
-    70462,
-    70465,
-    70468,
-    70471,
-    70474,
-    70477,
-    70480,
-    70483,
-    70486,
-    70489,
-    70492,
-    70495,
-    70498,
-    70501,
-    70504,
     70507,
-    70509,
-    70512,
-    70515,
-    70518,
-    70521,
-    70524,
-    70527,
-    70530,
-    70533,
-    70536,
-    70539,
-    70542,
-    70545,
-    70548,
-    70551,
     70554,
-    70557,
-    70560,
-    70563,
-    70566,
-    70569,
-    70572,
-    70575,
-    70578,
-    70581,
-    70584,
-    70587,
-    70590,
-    70593,
-    70596,
-    70599,
     70602,
-    70605,
-    70608,
-    70611,
-    70614,
-    70617,
-    70620,
-    70623,
-    70626,
-    70629,
-    70632,
-    70635,
-    70638,
-    70641,
-    70644,
-    70647,
     70650,
-    70653,
-    70656,
-    70659,
-    70662,
-    70665,
-    70668,
-    70671,
-    70674,
-    70677,
-    70680,
-    70683,
-    70686,
-    70689,
-    70692,
-    70695,
     70698,
-    70701,
-    70704,
-    70707,
-    70710,
-    70713,
-    70716,
-    70719,
-    70722,
-    70725,
-    70728,
-    70731,
-    70734,
-    70737,
-    70740,
-    70743,
     70746,
-    70749,
-    70752,
-    70755,
-    70758,
-    70761,
-    70763,
-    70766,
-    70769,
-    70772,
-    70775,
-    70778,
-    70781,
-    70784,
-    70787,
-    70790,
     70793,
-    70796,
-    70799,
-    70802,
-    70805,
-    70808,
-    70811,
-    70814,
-    70817,
-    70820,
-    70823,
-    70826,
-    70829,
-    70832,
-    70835,
-    70838,
     70841,
-    70844,
-    70847,
-    70850,
-    70853,
-    70856,
-    70859,
-    70862,
-    70865,
-    70868,
-    70871,
-    70874,
-    70877,
-    70880,
-    70883,
-    70886,
     70889,
-    70892,
-    70895,
-    70898,
-    70901,
-    70904,
-    70907,
-    70910,
-    70913,
-    70916,
-    70919,
-    70922,
-    70925,
-    70928,
-    70931,
-    70934,
     70937,
-    70940,
-    70943,
-    70946,
-    70949,
-    70952,
-    70955,
-    70958,
-    70961,
-    70964,
-    70967,
-    70970,
-    70973,
-    70976,
-    70979,
-    70982,
     70985,
-    70988,
-    70991,
-    70994,
-    70997,
-    71000,
-    71003,
-    71006,
-    71009,
-    71012,
-    71015,
-    71018,
-    71021,
-    71024,
-    71027,
-    71030,
     71033,
-    71036,
-    71039,
-    71042,
-    71045,
-    71048,
-    71051,
-    71054,
-    71057,
-    71061,
-    71064,
-    71067,
-    71070,
-    71073,
-    71076,
-    71079,
     71082,
-    71085,
-    71088,
-    71091,
-    71094,
-    71097,
-    71100,
-    71103,
-    71106,
-    71109,
-    71112,
-    71115,
-    71118,
-    71121,
-    71124,
-    71127,
     71130,
-    71133,
-    71136,
-    71139,
-    71142,
-    71145,
-    71148,
-    71151,
-    71154,
-    71157,
-    71160,
-    71163,
-    71166,
-    71169,
-    71172,
-    71175,
     71178,
-    71181,
-    71184,
-    71187,
-    71190,
-    71193,
-    71196,
-    71199,
-    71202,
-    71205,
-    71208,
-    71211,
-    71214,
-    71217,
-    71220,
-    71223,
     71226,
-    71229,
-    71232,
-    71235,
-    71238,
-    71241,
-    71244,
-    71247,
-    71250,
-    71253,
-    71256,
-    71259,
-    71262,
-    71265,
-    71268,
-    71271,
     71274,
-    71277,
-    71280,
-    71283,
-    71286,
-    71289,
-    71292,
-    71295,
-    71298,
-    71301,
-    71304,
-    71307,
-    71310,
-    71313,
-    71316,
-    71320,
     71323,
-    71326,
-    71329,
-    71332,
-    71335,
-    71338,
-    71341,
-    71344,
-    71347,
-    71350,
-    71353,
-    71356,
-    71359,
-    71362,
-    71365,
-    71368,
     71371,
-    71374,
-    71377,
-    71380,
-    71383,
-    71386,
-    71389,
-    71392,
-    71395,
-    71398,
-    71401,
-    71404,
-    71407,
-    71410,
-    71413,
-    71416,
     71419,
-    71422,
-    71425,
-    71428,
-    71431,
-    71434,
-    71437,
-    71440,
-    71443,
-    71446,
-    71449,
-    71452,
-    71455,
-    71458,
-    71461,
-    71464,
     71468,
-    71471,
-    71474,
-    71477,
-    71480,
-    71483,
-    71486,
-    71489,
-    71492,
-    71495,
-    71498,
-    71501,
-    71504,
-    71507,
-    71510,
-    71513,
     71516,
-    71519,
-    71522,
-    71525,
-    71528,
-    71531,
-    71534,
-    71537,
-    71540,
-    71543,
-    71546,
-    71549,
-    71552,
-    71555,
-    71558,
-    71561,
     71564,
-    71567,
-    71570,
-    71573,
-    71576,
-    71579,
-    71583,
-    71586,
-    71589,
-    71592,
-    71595,
-    71598,
-    71601,
-    71604,
-    71607,
-    71610,
     71613,
-    71616,
-    71619,
-    71622,
-    71625,
-    71628,
-    71631,
-    71634,
-    71637,
-    71640,
-    71643,
-    71646,
-    71649,
-    71652,
-    71655,
-    71658,
     71661,
-    71664,
-    71667,
-    71670,
-    71673,
-    71676,
-    71679,
-    71683,
-    71686,
-    71689,
-    71692,
-    71695,
-    71698,
-    71701,
-    71704,
-    71707,
     71710,
-    71713,
-    71716,
-    71719,
-    71722,
-    71725,
-    71728,
-    71731,
-    71734,
-    71737,
-    71740,
-    71743,
-    71746,
-    71749,
-    71752,
-    71755,
     71758,
-    71761,
-    71764,
-    71767,
-    71771,
-    71774,
-    71777,
-    71780,
-    71783,
-    71786,
-    71789,
-    71792,
-    71795,
-    71798,
-    71801,
-    71804,
     71807,
-    71810,
-    71813,
-    71816,
-    71819,
-    71822,
-    71825,
-    71828,
-    71831,
-    71834,
-    71837,
-    71840,
-    71843,
-    71846,
-    71849,
-    71853,
     71856,
-    71859,
-    71862,
-    71865,
-    71868,
-    71871,
-    71874,
-    71877,
-    71880,
-    71883,
-    71886,
-    71889,
-    71892,
-    71895,
-    71898,
-    71901,
     71904,
-    71907,
-    71910,
-    71913,
-    71916,
-    71919,
-    71922,
-    71926,
-    71929,
-    71932,
-    71935,
-    71938,
-    71941,
-    71944,
-    71947,
-    71950,
     71953,
-    71956,
-    71959,
-    71962,
-    71965,
-    71968,
-    71971,
-    71974,
-    71977,
-    71980,
-    71983,
-    71986,
-    71989,
-    71993,
-    71996,
-    71999,
     72002,
-    72005,
-    72008,
-    72011,
-    72014,
-    72017,
-    72020,
-    72023,
-    72026,
-    72029,
-    72032,
-    72035,
-    72038,
-    72041,
-    72044,
-    72047,
     72050,
-    72053,
-    72056,
-    72060,
-    72063,
-    72066,
-    72069,
-    72072,
-    72075,
-    72078,
-    72081,
-    72084,
-    72087,
-    72090,
-    72093,
-    72096,
     72099,
-    72102,
-    72105,
-    72108,
-    72111,
-    72114,
-    72117,
-    72121,
-    72124,
-    72127,
-    72130,
-    72133,
-    72136,
-    72139,
-    72142,
-    72145,
     72148,
-    72151,
-    72154,
-    72157,
-    72160,
-    72163,
-    72166,
-    72169,
-    72172,
-    72175,
-    72179,
-    72182,
-    72185,
-    72188,
-    72191,
-    72194,
     72197,
-    72200,
-    72203,
-    72206,
-    72209,
-    72212,
-    72215,
-    72218,
-    72221,
-    72224,
-    72227,
-    72230,
-    72234,
-    72237,
-    72240,
-    72243,
     72246,
-    72249,
-    72252,
-    72255,
-    72258,
-    72261,
-    72264,
-    72267,
-    72270,
-    72273,
-    72276,
-    72279,
-    72282,
-    72285,
-    72289,
-    72292,
     72295,
-    72298,
-    72301,
-    72304,
-    72307,
-    72310,
-    72313,
-    72316,
-    72319,
-    72322,
-    72325,
-    72328,
-    72331,
-    72334,
-    72337,
-    72341,
     72344,
-    72347,
-    72350,
-    72353,
-    72356,
-    72359,
-    72362,
-    72365,
-    72368,
-    72371,
-    72374,
-    72377,
-    72380,
-    72383,
-    72386,
-    72390,
     72393,
-    72396,
-    72399,
-    72402,
-    72405,
-    72408,
-    72411,
-    72414,
-    72417,
-    72420,
-    72423,
-    72426,
-    72429,
-    72432,
-    72435,
-    72439,
     72442,
-    72445,
-    72448,
-    72451,
-    72454,
-    72457,
-    72460,
-    72463,
-    72466,
-    72469,
-    72472,
-    72475,
-    72478,
-    72481,
-    72485,
-    72488,
     72491,
-    72494,
-    72497,
-    72500,
-    72503,
-    72506,
-    72509,
-    72512,
-    72515,
-    72518,
-    72521,
-    72524,
-    72527,
-    72531,
-    72534,
-    72537,
     72540,
-    72543,
-    72546,
-    72549,
-    72552,
-    72555,
-    72558,
-    72561,
-    72564,
-    72567,
-    72570,
-    72574,
-    72577,
-    72580,
-    72583,
-    72586,
     72589,
-    72592,
-    72595,
-    72598,
-    72601,
-    72604,
-    72607,
-    72610,
-    72613,
-    72617,
-    72620,
-    72623,
-    72626,
-    72629,
-    72632,
-    72635,
     72638,
-    72641,
-    72644,
-    72647,
-    72650,
-    72653,
-    72656,
-    72660,
-    72663,
-    72666,
-    72669,
-    72672,
-    72675,
-    72678,
-    72681,
-    72684,
     72687,
-    72690,
-    72693,
-    72696,
-    72700,
-    72703,
-    72706,
-    72709,
-    72712,
-    72715,
-    72718,
-    72721,
-    72724,
-    72727,
-    72730,
-    72733,
     72736,
-    72740,
-    72743,
-    72746,
-    72749,
-    72752,
-    72755,
-    72758,
-    72761,
-    72764,
-    72767,
-    72770,
-    72773,
-    72776,
-    72780,
-    72783,
     72786,
-    72789,
-    72792,
-    72795,
-    72798,
-    72801,
-    72804,
-    72807,
-    72810,
-    72813,
-    72816,
-    72820,
-    72823,
-    72826,
-    72829,
-    72832,
     72835,
-    72838,
-    72841,
-    72844,
-    72847,
-    72850,
-    72853,
-    72857,
-    72860,
-    72863,
-    72866,
-    72869,
-    72872,
-    72875,
-    72878,
-    72881,
     72884,
-    72887,
-    72890,
-    72894,
-    72897,
-    72900,
-    72903,
-    72906,
-    72909,
-    72912,
-    72915,
-    72918,
-    72921,
-    72924,
-    72927,
-    72931,
     72934,
-    72937,
-    72940,
-    72943,
-    72946,
-    72949,
-    72952,
-    72955,
-    72958,
-    72961,
-    72965,
-    72968,
-    72971,
-    72974,
-    72977,
-    72980,
     72983,
-    72986,
-    72989,
-    72992,
-    72995,
-    72998,
-    73002,
-    73005,
-    73008,
-    73011,
-    73014,
-    73017,
-    73020,
-    73023,
-    73026,
-    73029,
     73032,
-    73036,
-    73039,
-    73042,
-    73045,
-    73048,
-    73051,
-    73054,
-    73057,
-    73060,
-    73063,
-    73066,
-    73070,
-    73073,
-    73076,
-    73079,
     73082,
-    73085,
-    73088,
-    73091,
-    73094,
-    73097,
-    73100,
-    73104,
-    73107,
-    73110,
-    73113,
-    73116,
-    73119,
-    73122,
-    73125,
-    73128,
     73131,
-    73134,
-    73138,
-    73141,
-    73144,
-    73147,
-    73150,
-    73153,
-    73156,
-    73159,
-    73162,
-    73165,
-    73169,
-    73172,
-    73175,
-    73178,
     73181,
-    73184,
-    73187,
-    73190,
-    73193,
-    73196,
-    73199,
-    73203,
-    73206,
-    73209,
-    73212,
-    73215,
-    73218,
-    73221,
-    73224,
-    73227,
     73230,
-    73234,
-    73237,
-    73240,
-    73243,
-    73246,
-    73249,
-    73252,
-    73255,
-    73258,
-    73261,
-    73265,
-    73268,
-    73271,
-    73274,
-    73277,
     73280,
-    73283,
-    73286,
-    73289,
-    73292,
-    73296,
-    73299,
-    73302,
-    73305,
-    73308,
-    73311,
-    73314,
-    73317,
-    73320,
-    73323,
-    73327,
     73330,
-    73333,
-    73336,
-    73339,
-    73342,
-    73345,
-    73348,
-    73351,
-    73354,
-    73358,
-    73361,
-    73364,
-    73367,
-    73370,
-    73373,
-    73376,
     73379,
-    73382,
-    73386,
-    73389,
-    73392,
-    73395,
-    73398,
-    73401,
-    73404,
-    73407,
-    73410,
-    73413,
-    73417,
-    73420,
-    73423,
-    73426,
     73429,
-    73432,
-    73435,
-    73438,
-    73441,
-    73445,
-    73448,
-    73451,
-    73454,
-    73457,
-    73460,
-    73463,
-    73466,
-    73469,
-    73473,
-    73476,
     73479,
-    73482,
-    73485,
-    73488,
-    73491,
-    73494,
-    73497,
-    73500,
-    73504,
-    73507,
-    73510,
-    73513,
-    73516,
-    73519,
-    73522,
-    73525,
     73528,
-    73532,
-    73535,
-    73538,
-    73541,
-    73544,
-    73547,
-    73550,
-    73553,
-    73556,
-    73560,
-    73563,
-    73566,
-    73569,
-    73572,
-    73575,
     73578,
-    73581,
-    73584,
-    73588,
-    73591,
-    73594,
-    73597,
-    73600,
-    73603,
-    73606,
-    73609,
-    73613,
-    73616,
-    73619,
-    73622,
-    73625,
     73628,
-    73631,
-    73634,
-    73637,
-    73641,
-    73644,
-    73647,
-    73650,
-    73653,
-    73656,
-    73659,
-    73662,
-    73665,
-    73669,
-    73672,
-    73675,
     73678,
-    73681,
-    73684,
-    73687,
-    73690,
-    73694,
-    73697,
-    73700,
-    73703,
-    73706,
-    73709,
-    73712,
-    73715,
-    73718,
-    73722,
-    73725,
     73728,
-    73731,
-    73734,
-    73737,
-    73740,
-    73743,
-    73747,
-    73750,
-    73753,
-    73756,
-    73759,
-    73762,
-    73765,
-    73768,
-    73772,
-    73775,
     73778,
-    73781,
-    73784,
-    73787,
-    73790,
-    73793,
-    73796,
-    73800,
-    73803,
-    73806,
-    73809,
-    73812,
-    73815,
-    73818,
-    73821,
-    73825,
     73828,
-    73831,
-    73834,
-    73837,
-    73840,
-    73843,
-    73846,
-    73850,
-    73853,
-    73856,
-    73859,
-    73862,
-    73865,
-    73868,
-    73871,
-    73875,
     73878,
-    73881,
-    73884,
-    73887,
-    73890,
-    73893,
-    73896,
-    73900,
-    73903,
-    73906,
-    73909,
-    73912,
-    73915,
-    73918,
-    73921,
-    73925,
     73928,
-    73931,
-    73934,
-    73937,
-    73940,
-    73943,
-    73947,
-    73950,
-    73953,
-    73956,
-    73959,
-    73962,
-    73965,
-    73968,
-    73972,
-    73975,
     73978,
-    73981,
-    73984,
-    73987,
-    73990,
-    73993,
-    73997,
-    74000,
-    74003,
-    74006,
-    74009,
-    74012,
-    74015,
-    74018,
-    74022,
-    74025,
     74028,
-    74031,
-    74034,
-    74037,
-    74040,
-    74044,
-    74047,
-    74050,
-    74053,
-    74056,
-    74059,
-    74062,
-    74065,
-    74069,
-    74072,
-    74075,
     74078,
-    74081,
-    74084,
-    74087,
-    74091,
-    74094,
-    74097,
-    74100,
-    74103,
-    74106,
-    74109,
-    74112,
-    74116,
-    74119,
-    74122,
-    74125,
     74128,
-    74131,
-    74134,
-    74138,
-    74141,
-    74144,
-    74147,
-    74150,
-    74153,
-    74156,
-    74160,
-    74163,
-    74166,
-    74169,
-    74172,
-    74175,
     74178,
-    74182,
-    74185,
-    74188,
-    74191,
-    74194,
-    74197,
-    74200,
-    74203,
-    74207,
-    74210,
-    74213,
-    74216,
-    74219,
-    74222,
-    74225,
     74229,
-    74232,
-    74235,
-    74238,
-    74241,
-    74244,
-    74247,
-    74251,
-    74254,
-    74257,
-    74260,
-    74263,
-    74266,
-    74269,
-    74273,
-    74276,
     74279,
-    74282,
-    74285,
-    74288,
-    74291,
-    74295,
-    74298,
-    74301,
-    74304,
-    74307,
-    74310,
-    74313,
-    74317,
-    74320,
-    74323,
-    74326,
     74329,
-    74332,
-    74335,
-    74339,
-    74342,
-    74345,
-    74348,
-    74351,
-    74354,
-    74357,
-    74361,
-    74364,
-    74367,
-    74370,
-    74373,
-    74376,
     74379,
-    74383,
-    74386,
-    74389,
-    74392,
-    74395,
-    74398,
-    74402,
-    74405,
-    74408,
-    74411,
-    74414,
-    74417,
-    74420,
-    74424,
-    74427,
     74430,
-    74433,
-    74436,
-    74439,
-    74442,
-    74446,
-    74449,
-    74452,
-    74455,
-    74458,
-    74461,
-    74464,
-    74468,
-    74471,
-    74474,
-    74477,
     74480,
-    74483,
-    74487,
-    74490,
-    74493,
-    74496,
-    74499,
-    74502,
-    74505,
-    74509,
-    74512,
-    74515,
-    74518,
-    74521,
-    74524,
-    74528,
     74531,
-    74534,
-    74537,
-    74540,
-    74543,
-    74546,
-    74550,
-    74553,
-    74556,
-    74559,
-    74562,
-    74565,
-    74569,
-    74572,
-    74575,
-    74578,
     74581,
-    74584,
-    74587,
-    74591,
-    74594,
-    74597,
-    74600,
-    74603,
-    74606,
-    74610,
-    74613,
-    74616,
-    74619,
-    74622,
-    74625,
-    74628,
     74632,
-    74635,
-    74638,
-    74641,
-    74644,
-    74647,
-    74651,
-    74654,
-    74657,
-    74660,
-    74663,
-    74666,
-    74670,
-    74673,
-    74676,
-    74679,
     74682,
-    74685,
-    74689,
-    74692,
-    74695,
-    74698,
-    74701,
-    74704,
-    74707,
-    74711,
-    74714,
-    74717,
-    74720,
-    74723,
-    74726,
-    74730,
     74733,
-    74736,
-    74739,
-    74742,
-    74745,
-    74749,
-    74752,
-    74755,
-    74758,
-    74761,
-    74764,
-    74768,
-    74771,
-    74774,
-    74777,
-    74780,
     74783,
-    74787,
-    74790,
-    74793,
-    74796,
-    74799,
-    74802,
-    74806,
-    74809,
-    74812,
-    74815,
-    74818,
-    74821,
-    74825,
-    74828,
-    74831,
     74834,
-    74837,
-    74840,
-    74843,
-    74847,
-    74850,
-    74853,
-    74856,
-    74859,
-    74862,
-    74866,
-    74869,
-    74872,
-    74875,
-    74878,
-    74882,
     74885,
-    74888,
-    74891,
-    74894,
-    74897,
-    74901,
-    74904,
-    74907,
-    74910,
-    74913,
-    74916,
-    74920,
-    74923,
-    74926,
-    74929,
-    74932,
     74935,
-    74939,
-    74942,
-    74945,
-    74948,
-    74951,
-    74954,
-    74958,
-    74961,
-    74964,
-    74967,
-    74970,
-    74973,
-    74977,
-    74980,
-    74983,
     74986,
-    74989,
-    74992,
-    74996,
-    74999,
-    75002,
-    75005,
-    75008,
-    75012,
-    75015,
-    75018,
-    75021,
-    75024,
-    75027,
-    75031,
-    75034,
     75037,
-    75040,
-    75043,
-    75046,
-    75050,
-    75053,
-    75056,
-    75059,
-    75062,
-    75065,
-    75069,
-    75072,
-    75075,
-    75078,
-    75081,
-    75085,
     75088,
-    75091,
-    75094,
-    75097,
-    75100,
-    75104,
-    75107,
-    75110,
-    75113,
-    75116,
-    75119,
-    75123,
-    75126,
-    75129,
-    75132,
-    75135,
     75139,
-    75142,
-    75145,
-    75148,
-    75151,
-    75154,
-    75158,
-    75161,
-    75164,
-    75167,
-    75170,
-    75174,
-    75177,
-    75180,
-    75183,
-    75186,
     75189,
-    75193,
-    75196,
-    75199,
-    75202,
-    75205,
-    75209,
-    75212,
-    75215,
-    75218,
-    75221,
-    75224,
-    75228,
-    75231,
-    75234,
-    75237,
     75240,
-    75244,
-    75247,
-    75250,
-    75253,
-    75256,
-    75259,
-    75263,
-    75266,
-    75269,
-    75272,
-    75275,
-    75279,
-    75282,
-    75285,
-    75288,
     75291,
-    75294,
-    75298,
-    75301,
-    75304,
-    75307,
-    75310,
-    75314,
-    75317,
-    75320,
-    75323,
-    75326,
-    75330,
-    75333,
-    75336,
-    75339,
     75342,
-    75345,
-    75349,
-    75352,
-    75355,
-    75358,
-    75361,
-    75365,
-    75368,
-    75371,
-    75374,
-    75377,
-    75381,
-    75384,
-    75387,
-    75390,
     75393,
-    75396,
-    75400,
-    75403,
-    75406,
-    75409,
-    75412,
-    75416,
-    75419,
-    75422,
-    75425,
-    75428,
-    75432,
-    75435,
-    75438,
-    75441,
     75444,
-    75448,
-    75451,
-    75454,
-    75457,
-    75460,
-    75463,
-    75467,
-    75470,
-    75473,
-    75476,
-    75479,
-    75483,
-    75486,
-    75489,
-    75492,
     75495,
-    75499,
-    75502,
-    75505,
-    75508,
-    75511,
-    75515,
-    75518,
-    75521,
-    75524,
-    75527,
-    75531,
-    75534,
-    75537,
-    75540,
-    75543,
     75547,
-    75550,
-    75553,
-    75556,
-    75559,
-    75563,
-    75566,
-    75569,
-    75572,
-    75575,
-    75579,
-    75582,
-    75585,
-    75588,
-    75591,
-    75595,
     75598,
-    75601,
-    75604,
-    75607,
-    75610,
-    75614,
-    75617,
-    75620,
-    75623,
-    75626,
-    75630,
-    75633,
-    75636,
-    75639,
-    75642,
-    75646,
     75649,
-    75652,
-    75655,
-    75658,
-    75662,
-    75665,
-    75668,
-    75671,
-    75674,
-    75678,
-    75681,
-    75684,
-    75687,
-    75691,
-    75694,
-    75697,
     75700,
-    75703,
-    75707,
-    75710,
-    75713,
-    75716,
-    75719,
-    75723,
-    75726,
-    75729,
-    75732,
-    75735,
-    75739,
-    75742,
-    75745,
-    75748,
     75751,
-    75755,
-    75758,
-    75761,
-    75764,
-    75767,
-    75771,
-    75774,
-    75777,
-    75780,
-    75783,
-    75787,
-    75790,
-    75793,
-    75796,
-    75799,
     75803,
-    75806,
-    75809,
-    75812,
-    75815,
-    75819,
-    75822,
-    75825,
-    75828,
-    75832,
-    75835,
-    75838,
-    75841,
-    75844,
-    75848,
-    75851,
     75854,
-    75857,
-    75860,
-    75864,
-    75867,
-    75870,
-    75873,
-    75876,
-    75880,
-    75883,
-    75886,
-    75889,
-    75893,
-    75896,
-    75899,
-    75902,
     75905,
-    75909,
-    75912,
-    75915,
-    75918,
-    75921,
-    75925,
-    75928,
-    75931,
-    75934,
-    75937,
-    75941,
-    75944,
-    75947,
-    75950,
-    75954,
     75957,
-    75960,
-    75963,
-    75966,
-    75970,
-    75973,
-    75976,
-    75979,
-    75982,
-    75986,
-    75989,
-    75992,
-    75995,
-    75999,
-    76002,
-    76005,
     76008,
-    76011,
-    76015,
-    76018,
-    76021,
-    76024,
-    76027,
-    76031,
-    76034,
-    76037,
-    76040,
-    76044,
-    76047,
-    76050,
-    76053,
-    76056,
     76060,
-    76063,
-    76066,
-    76069,
-    76073,
-    76076,
-    76079,
-    76082,
-    76085,
-    76089,
-    76092,
-    76095,
-    76098,
-    76101,
-    76105,
-    76108,
     76111,
-    76114,
-    76118,
-    76121,
-    76124,
-    76127,
-    76130,
-    76134,
-    76137,
-    76140,
-    76143,
-    76147,
-    76150,
-    76153,
-    76156,
-    76159,
     76163,
-    76166,
-    76169,
-    76172,
-    76176,
-    76179,
-    76182,
-    76185,
-    76188,
-    76192,
-    76195,
-    76198,
-    76201,
-    76205,
-    76208,
-    76211,
     76214,
-    76217,
-    76221,
-    76224,
-    76227,
-    76230,
-    76234,
-    76237,
-    76240,
-    76243,
-    76247,
-    76250,
-    76253,
-    76256,
-    76259,
-    76263,
     76266,
-    76269,
-    76272,
-    76276,
-    76279,
-    76282,
-    76285,
-    76288,
-    76292,
-    76295,
-    76298,
-    76301,
-    76305,
-    76308,
-    76311,
-    76314,
     76318,
-    76321,
-    76324,
-    76327,
-    76330,
-    76334,
-    76337,
-    76340,
-    76343,
-    76347,
-    76350,
-    76353,
-    76356,
-    76359,
-    76363,
-    76366,
     76369,
-    76372,
-    76376,
-    76379,
-    76382,
-    76385,
-    76389,
-    76392,
-    76395,
-    76398,
-    76402,
-    76405,
-    76408,
-    76411,
-    76414,
-    76418,
     76421,
-    76424,
-    76427,
-    76431,
-    76434,
-    76437,
-    76440,
-    76444,
-    76447,
-    76450,
-    76453,
-    76456,
-    76460,
-    76463,
-    76466,
-    76469,
     76473,
-    76476,
-    76479,
-    76482,
-    76486,
-    76489,
-    76492,
-    76495,
-    76499,
-    76502,
-    76505,
-    76508,
-    76511,
-    76515,
-    76518,
-    76521,
     76524,
-    76528,
-    76531,
-    76534,
-    76537,
-    76541,
-    76544,
-    76547,
-    76550,
-    76554,
-    76557,
-    76560,
-    76563,
-    76567,
-    76570,
-    76573,
     76576,
-    76579,
-    76583,
-    76586,
-    76589,
-    76592,
-    76596,
-    76599,
-    76602,
-    76605,
-    76609,
-    76612,
-    76615,
-    76618,
-    76622,
-    76625,
     76628,
-    76631,
-    76635,
-    76638,
-    76641,
-    76644,
-    76648,
-    76651,
-    76654,
-    76657,
-    76661,
-    76664,
-    76667,
-    76670,
-    76674,
-    76677,
     76680,
-    76683,
-    76686,
-    76690,
-    76693,
-    76696,
-    76699,
-    76703,
-    76706,
-    76709,
-    76712,
-    76716,
-    76719,
-    76722,
-    76725,
-    76729,
     76732,
-    76735,
-    76738,
-    76742,
-    76745,
-    76748,
-    76751,
-    76755,
-    76758,
-    76761,
-    76764,
-    76768,
-    76771,
-    76774,
-    76777,
-    76781,
     76784,
-    76787,
-    76790,
-    76794,
-    76797,
-    76800,
-    76803,
-    76807,
-    76810,
-    76813,
-    76816,
-    76820,
-    76823,
-    76826,
-    76829,
-    76833,
     76836,
-    76839,
-    76842,
-    76846,
-    76849,
-    76852,
-    76855,
-    76859,
-    76862,
-    76865,
-    76868,
-    76872,
-    76875,
-    76878,
-    76881,
-    76885,
     76888,
-    76891,
-    76894,
-    76898,
-    76901,
-    76904,
-    76907,
-    76911,
-    76914,
-    76917,
-    76920,
-    76924,
-    76927,
-    76930,
-    76933,
-    76937,
     76940,
-    76943,
-    76946,
-    76950,
-    76953,
-    76956,
-    76959,
-    76963,
-    76966,
-    76969,
-    76973,
-    76976,
-    76979,
-    76982,
-    76986,
-    76989,
     76992,
-    76995,
-    76999,
-    77002,
-    77005,
-    77008,
-    77012,
-    77015,
-    77018,
-    77021,
-    77025,
-    77028,
-    77031,
-    77034,
-    77038,
-    77041,
     77044,
-    77047,
-    77051,
-    77054,
-    77057,
-    77060,
-    77064,
-    77067,
-    77070,
-    77074,
-    77077,
-    77080,
-    77083,
-    77087,
-    77090,
-    77093,
     77096,
-    77100,
-    77103,
-    77106,
-    77109,
-    77113,
-    77116,
-    77119,
-    77122,
-    77126,
-    77129,
-    77132,
-    77136,
-    77139,
-    77142,
-    77145,
     77149,
-    77152,
-    77155,
-    77158,
-    77162,
-    77165,
-    77168,
-    77171,
-    77175,
-    77178,
-    77181,
-    77184,
-    77188,
-    77191,
-    77194,
-    77198,
     77201,
-    77204,
-    77207,
-    77211,
-    77214,
-    77217,
-    77220,
-    77224,
-    77227,
-    77230,
-    77233,
-    77237,
-    77240,
-    77243,
-    77247,
-    77250,
     77253,
-    77256,
-    77260,
-    77263,
-    77266,
-    77269,
-    77273,
-    77276,
-    77279,
-    77282,
-    77286,
-    77289,
-    77292,
-    77296,
-    77299,
-    77302,
     77305,
-    77309,
-    77312,
-    77315,
-    77318,
-    77322,
-    77325,
-    77328,
-    77332,
-    77335,
-    77338,
-    77341,
-    77345,
-    77348,
-    77351,
-    77354,
     77358,
-    77361,
-    77364,
-    77368,
-    77371,
-    77374,
-    77377,
-    77381,
-    77384,
-    77387,
-    77390,
-    77394,
-    77397,
-    77400,
-    77404,
-    77407,
     77410,
-    77413,
-    77417,
-    77420,
-    77423,
-    77426,
-    77430,
-    77433,
-    77436,
-    77440,
-    77443,
-    77446,
-    77449,
-    77453,
-    77456,
-    77459,
     77463,
-    77466,
-    77469,
-    77472,
-    77476,
-    77479,
-    77482,
-    77485,
-    77489,
-    77492,
-    77495,
-    77499,
-    77502,
-    77505,
-    77508,
-    77512,
     77515,
-    77518,
-    77522,
-    77525,
-    77528,
-    77531,
-    77535,
-    77538,
-    77541,
-    77544,
-    77548,
-    77551,
-    77554,
-    77558,
-    77561,
-    77564,
     77567,
-    77571,
-    77574,
-    77577,
-    77581,
-    77584,
-    77587,
-    77590,
-    77594,
-    77597,
-    77600,
-    77604,
-    77607,
-    77610,
-    77613,
-    77617,
     77620,
-    77623,
-    77627,
-    77630,
-    77633,
-    77636,
-    77640,
-    77643,
-    77646,
-    77650,
-    77653,
-    77656,
-    77659,
-    77663,
-    77666,
-    77669,
     77673,
-    77676,
-    77679,
-    77682,
-    77686,
-    77689,
-    77692,
-    77696,
-    77699,
-    77702,
-    77705,
-    77709,
-    77712,
-    77715,
-    77719,
-    77722,
     77725,
-    77728,
-    77732,
-    77735,
-    77738,
-    77742,
-    77745,
-    77748,
-    77751,
-    77755,
-    77758,
-    77761,
-    77765,
-    77768,
-    77771,
-    77774,
     77778,
-    77781,
-    77784,
-    77788,
-    77791,
-    77794,
-    77798,
-    77801,
-    77804,
-    77807,
-    77811,
-    77814,
-    77817,
-    77821,
-    77824,
-    77827,
     77830,
-    77834,
-    77837,
-    77840,
-    77844,
-    77847,
-    77850,
-    77853,
-    77857,
-    77860,
-    77863,
-    77867,
-    77870,
-    77873,
-    77877,
-    77880,
     77883,
-    77886,
-    77890,
-    77893,
-    77896,
-    77900,
-    77903,
-    77906,
-    77910,
-    77913,
-    77916,
-    77919,
-    77923,
-    77926,
-    77929,
-    77933,
     77936,
-    77939,
-    77942,
-    77946,
-    77949,
-    77952,
-    77956,
-    77959,
-    77962,
-    77966,
-    77969,
-    77972,
-    77975,
-    77979,
-    77982,
-    77985,
     77989,
-    77992,
-    77995,
-    77999,
-    78002,
-    78005,
-    78008,
-    78012,
-    78015,
-    78018,
-    78022,
-    78025,
-    78028,
-    78032,
-    78035,
-    78038,
     78041,
-    78045,
-    78048,
-    78051,
-    78055,
-    78058,
-    78061,
-    78065,
-    78068,
-    78071,
-    78074,
-    78078,
-    78081,
-    78084,
-    78088,
-    78091,
     78094,
-    78098,
-    78101,
-    78104,
-    78108,
-    78111,
-    78114,
-    78117,
-    78121,
-    78124,
-    78127,
-    78131,
-    78134,
-    78137,
-    78141,
-    78144,
     78147,
-    78150,
-    78154,
-    78157,
-    78160,
-    78164,
-    78167,
-    78170,
-    78174,
-    78177,
-    78180,
-    78184,
-    78187,
-    78190,
-    78193,
-    78197,
     78200,
-    78203,
-    78207,
-    78210,
-    78213,
-    78217,
-    78220,
-    78223,
-    78227,
-    78230,
-    78233,
-    78236,
-    78240,
-    78243,
-    78246,
-    78250,
     78253,
-    78256,
-    78260,
-    78263,
-    78266,
-    78270,
-    78273,
-    78276,
-    78280,
-    78283,
-    78286,
-    78289,
-    78293,
-    78296,
-    78299,
-    78303,
     78306,
-    78309,
-    78313,
-    78316,
-    78319,
-    78323,
-    78326,
-    78329,
-    78333,
-    78336,
-    78339,
-    78342,
-    78346,
-    78349,
-    78352,
-    78356,
     78359,
-    78362,
-    78366,
-    78369,
-    78372,
-    78376,
-    78379,
-    78382,
-    78386,
-    78389,
-    78392,
-    78396,
-    78399,
-    78402,
-    78405,
-    78409,
     78412,
-    78415,
-    78419,
-    78422,
-    78425,
-    78429,
-    78432,
-    78435,
-    78439,
-    78442,
-    78445,
-    78449,
-    78452,
-    78455,
-    78459,
-    78462,
     78465,
-    78469,
-    78472,
-    78475,
-    78478,
-    78482,
-    78485,
-    78488,
-    78492,
-    78495,
-    78498,
-    78502,
-    78505,
-    78508,
-    78512,
-    78515,
     78518,
-    78522,
-    78525,
-    78528,
-    78532,
-    78535,
-    78538,
-    78542,
-    78545,
-    78548,
-    78552,
-    78555,
-    78558,
-    78562,
-    78565,
-    78568,
     78572,
-    78575,
-    78578,
-    78581,
-    78585,
-    78588,
-    78591,
-    78595,
-    78598,
-    78601,
-    78605,
-    78608,
-    78611,
-    78615,
-    78618,
-    78621,
     78625,
-    78628,
-    78631,
-    78635,
-    78638,
-    78641,
-    78645,
-    78648,
-    78651,
-    78655,
-    78658,
-    78661,
-    78665,
-    78668,
-    78671,
-    78675,
     78678,
-    78681,
-    78685,
-    78688,
-    78691,
-    78695,
-    78698,
-    78701,
-    78705,
-    78708,
-    78711,
-    78715,
-    78718,
-    78721,
-    78725,
-    78728,
     78731,
-    78735,
-    78738,
-    78741,
-    78745,
-    78748,
-    78751,
-    78755,
-    78758,
-    78761,
-    78765,
-    78768,
-    78771,
-    78775,
-    78778,
-    78781,
     78785,
-    78788,
-    78791,
-    78795,
-    78798,
-    78801,
-    78805,
-    78808,
-    78811,
-    78815,
-    78818,
-    78821,
-    78825,
-    78828,
-    78831,
-    78835,
     78838,
-    78841,
-    78845,
-    78848,
-    78851,
-    78855,
-    78858,
-    78861,
-    78865,
-    78868,
-    78871,
-    78875,
-    78878,
-    78881,
-    78885,
-    78888,
     78891,
-    78895,
-    78898,
-    78901,
-    78905,
-    78908,
-    78911,
-    78915,
-    78918,
-    78921,
-    78925,
-    78928,
-    78931,
-    78935,
-    78938,
-    78941,
     78945,
-    78948,
-    78951,
-    78955,
-    78958,
-    78961,
-    78965,
-    78968,
-    78971,
-    78975,
-    78978,
-    78981,
-    78985,
-    78988,
-    78991,
-    78995,
     78998,
-    79001,
-    79005,
-    79008,
-    79012,
-    79015,
-    79018,
-    79022,
-    79025,
-    79028,
-    79032,
-    79035,
-    79038,
-    79042,
-    79045,
-    79048,
     79052,
-    79055,
-    79058,
-    79062,
-    79065,
-    79068,
-    79072,
-    79075,
-    79078,
-    79082,
-    79085,
-    79088,
-    79092,
-    79095,
-    79098,
-    79102,
     79105,
-    79109,
-    79112,
-    79115,
-    79119,
-    79122,
-    79125,
-    79129,
-    79132,
-    79135,
-    79139,
-    79142,
-    79145,
-    79149,
-    79152,
-    79155,
     79159,
-    79162,
-    79165,
-    79169,
-    79172,
-    79175,
-    79179,
-    79182,
-    79186,
-    79189,
-    79192,
-    79196,
-    79199,
-    79202,
-    79206,
-    79209,
     79212,
-    79216,
-    79219,
-    79222,
-    79226,
-    79229,
-    79232,
-    79236,
-    79239,
-    79243,
-    79246,
-    79249,
-    79253,
-    79256,
-    79259,
-    79263,
     79266,
-    79269,
-    79273,
-    79276,
-    79279,
-    79283,
-    79286,
-    79289,
-    79293,
-    79296,
-    79300,
-    79303,
-    79306,
-    79310,
-    79313,
-    79316,
     79320,
-    79323,
-    79326,
-    79330,
-    79333,
-    79336,
-    79340,
-    79343,
-    79346,
-    79350,
-    79353,
-    79357,
-    79360,
-    79363,
-    79367,
-    79370,
     79373,
-    79377,
-    79380,
-    79383,
-    79387,
-    79390,
-    79394,
-    79397,
-    79400,
-    79404,
-    79407,
-    79410,
-    79414,
-    79417,
-    79420,
-    79424,
     79427,
-    79430,
-    79434,
-    79437,
-    79441,
-    79444,
-    79447,
-    79451,
-    79454,
-    79457,
-    79461,
-    79464,
-    79467,
-    79471,
-    79474,
-    79478,
     79481,
-    79484,
-    79488,
-    79491,
-    79494,
-    79498,
-    79501,
-    79504,
-    79508,
-    79511,
-    79515,
-    79518,
-    79521,
-    79525,
-    79528,
-    79531,
     79535,
-    79538,
-    79541,
-    79545,
-    79548,
-    79552,
-    79555,
-    79558,
-    79562,
-    79565,
-    79568,
-    79572,
-    79575,
-    79578,
-    79582,
-    79585,
     79589,
-    79592,
-    79595,
-    79599,
-    79602,
-    79605,
-    79609,
-    79612,
-    79616,
-    79619,
-    79622,
-    79626,
-    79629,
-    79632,
-    79636,
-    79639,
     79642,
-    79646,
-    79649,
-    79653,
-    79656,
-    79659,
-    79663,
-    79666,
-    79669,
-    79673,
-    79676,
-    79680,
-    79683,
-    79686,
-    79690,
-    79693,
     79696,
-    79700,
-    79703,
-    79706,
-    79710,
-    79713,
-    79717,
-    79720,
-    79723,
-    79727,
-    79730,
-    79733,
-    79737,
-    79740,
-    79744,
-    79747,
     79750,
-    79754,
-    79757,
-    79760,
-    79764,
-    79767,
-    79771,
-    79774,
-    79777,
-    79781,
-    79784,
-    79787,
-    79791,
-    79794,
-    79798,
-    79801,
     79804,
-    79808,
-    79811,
-    79814,
-    79818,
-    79821,
-    79825,
-    79828,
-    79831,
-    79835,
-    79838,
-    79841,
-    79845,
-    79848,
-    79852,
-    79855,
     79858,
-    79862,
-    79865,
-    79869,
-    79872,
-    79875,
-    79879,
-    79882,
-    79885,
-    79889,
-    79892,
-    79896,
-    79899,
-    79902,
-    79906,
-    79909,
     79912,
-    79916,
-    79919,
-    79923,
-    79926,
-    79929,
-    79933,
-    79936,
-    79940,
-    79943,
-    79946,
-    79950,
-    79953,
-    79956,
-    79960,
-    79963,
     79967,
-    79970,
-    79973,
-    79977,
-    79980,
-    79983,
-    79987,
-    79990,
-    79994,
-    79997,
-    80000,
-    80004,
-    80007,
-    80011,
-    80014,
-    80017,
     80021,
-    80024,
-    80027,
-    80031,
-    80034,
-    80038,
-    80041,
-    80044,
-    80048,
-    80051,
-    80055,
-    80058,
-    80061,
-    80065,
-    80068,
-    80072,
     80075,
-    80078,
-    80082,
-    80085,
-    80088,
-    80092,
-    80095,
-    80099,
-    80102,
-    80105,
-    80109,
-    80112,
-    80116,
-    80119,
-    80122,
-    80126,
     80129,
-    80133,
-    80136,
-    80139,
-    80143,
-    80146,
-    80149,
-    80153,
-    80156,
-    80160,
-    80163,
-    80166,
-    80170,
-    80173,
-    80177,
-    80180,
     80183,
-    80187,
-    80190,
-    80194,
-    80197,
-    80200,
-    80204,
-    80207,
-    80211,
-    80214,
-    80217,
-    80221,
-    80224,
-    80227,
-    80231,
-    80234,
     80238,
-    80241,
-    80244,
-    80248,
-    80251,
-    80255,
-    80258,
-    80261,
-    80265,
-    80268,
-    80272,
-    80275,
-    80278,
-    80282,
-    80285,
-    80289,
     80292,
-    80295,
-    80299,
-    80302,
-    80306,
-    80309,
-    80312,
-    80316,
-    80319,
-    80323,
-    80326,
-    80329,
-    80333,
-    80336,
-    80340,
-    80343,
     80346,
-    80350,
-    80353,
-    80357,
-    80360,
-    80363,
-    80367,
-    80370,
-    80374,
-    80377,
-    80380,
-    80384,
-    80387,
-    80391,
-    80394,
-    80397,
     80401,
-    80404,
-    80408,
-    80411,
-    80414,
-    80418,
-    80421,
-    80425,
-    80428,
-    80431,
-    80435,
-    80438,
-    80442,
-    80445,
-    80448,
-    80452,
     80455,
-    80459,
-    80462,
-    80465,
-    80469,
-    80472,
-    80476,
-    80479,
-    80482,
-    80486,
-    80489,
-    80493,
-    80496,
-    80499,
-    80503,
-    80506,
     80510,
-    80513,
-    80517,
-    80520,
-    80523,
-    80527,
-    80530,
-    80534,
-    80537,
-    80540,
-    80544,
-    80547,
-    80551,
-    80554,
-    80557,
-    80561,
     80564,
-    80568,
-    80571,
-    80574,
-    80578,
-    80581,
-    80585,
-    80588,
-    80591,
-    80595,
-    80598,
-    80602,
-    80605,
-    80609,
-    80612,
-    80615,
     80619,
-    80622,
-    80626,
-    80629,
-    80632,
-    80636,
-    80639,
-    80643,
-    80646,
-    80649,
-    80653,
-    80656,
-    80660,
-    80663,
-    80667,
-    80670,
     80673,
-    80677,
-    80680,
-    80684,
-    80687,
-    80690,
-    80694,
-    80697,
-    80701,
-    80704,
-    80707,
-    80711,
-    80714,
-    80718,
-    80721,
-    80725,
     80728,
-    80731,
-    80735,
-    80738,
-    80742,
-    80745,
-    80748,
-    80752,
-    80755,
-    80759,
-    80762,
-    80766,
-    80769,
-    80772,
-    80776,
-    80779,
     80783,
-    80786,
-    80789,
-    80793,
-    80796,
-    80800,
-    80803,
-    80807,
-    80810,
-    80813,
-    80817,
-    80820,
-    80824,
-    80827,
-    80831,
-    80834,
     80837,
-    80841,
-    80844,
-    80848,
-    80851,
-    80854,
-    80858,
-    80861,
-    80865,
-    80868,
-    80872,
-    80875,
-    80878,
-    80882,
-    80885,
-    80889,
     80892,
-    80896,
-    80899,
-    80902,
-    80906,
-    80909,
-    80913,
-    80916,
-    80919,
-    80923,
-    80926,
-    80930,
-    80933,
-    80937,
-    80940,
-    80943,
     80947,
-    80950,
-    80954,
-    80957,
-    80961,
-    80964,
-    80967,
-    80971,
-    80974,
-    80978,
-    80981,
-    80985,
-    80988,
-    80991,
-    80995,
-    80998,
     81002,
-    81005,
-    81009,
-    81012,
-    81015,
-    81019,
-    81022,
-    81026,
-    81029,
-    81033,
-    81036,
-    81039,
-    81043,
-    81046,
-    81050,
-    81053,
     81057,
-    81060,
-    81063,
-    81067,
-    81070,
-    81074,
-    81077,
-    81081,
-    81084,
-    81087,
-    81091,
-    81094,
-    81098,
-    81101,
-    81105,
-    81108,
     81111,
-    81115,
-    81118,
-    81122,
-    81125,
-    81129,
-    81132,
-    81135,
-    81139,
-    81142,
-    81146,
-    81149,
-    81153,
-    81156,
-    81159,
-    81163,
     81166,
-    81170,
-    81173,
-    81177,
-    81180,
-    81184,
-    81187,
-    81190,
-    81194,
-    81197,
-    81201,
-    81204,
-    81208,
-    81211,
-    81214,
-    81218,
     81221,
-    81225,
-    81228,
-    81232,
-    81235,
-    81238,
-    81242,
-    81245,
-    81249,
-    81252,
-    81256,
-    81259,
-    81263,
-    81266,
-    81269,
-    81273,
     81276,
-    81280,
-    81283,
-    81287,
-    81290,
-    81293,
-    81297,
-    81300,
-    81304,
-    81307,
-    81311,
-    81314,
-    81318,
-    81321,
-    81324,
-    81328,
     81331,
-    81335,
-    81338,
-    81342,
-    81345,
-    81349,
-    81352,
-    81355,
-    81359,
-    81362,
-    81366,
-    81369,
-    81373,
-    81376,
-    81380,
-    81383,
     81386,
-    81390,
-    81393,
-    81397,
-    81400,
-    81404,
-    81407,
-    81410,
-    81414,
-    81417,
-    81421,
-    81424,
-    81428,
-    81431,
-    81435,
-    81438,
     81442,
-    81445,
-    81448,
-    81452,
-    81455,
-    81459,
-    81462,
-    81466,
-    81469,
-    81473,
-    81476,
-    81479,
-    81483,
-    81486,
-    81490,
-    81493,
     81497,
-    81500,
-    81504,
-    81507,
-    81510,
-    81514,
-    81517,
-    81521,
-    81524,
-    81528,
-    81531,
-    81535,
-    81538,
-    81541,
-    81545,
-    81548,
     81552,
-    81555,
-    81559,
-    81562,
-    81566,
-    81569,
-    81573,
-    81576,
-    81579,
-    81583,
-    81586,
-    81590,
-    81593,
-    81597,
-    81600,
-    81604,
     81607,
-    81611,
-    81614,
-    81617,
-    81621,
-    81624,
-    81628,
-    81631,
-    81635,
-    81638,
-    81642,
-    81645,
-    81648,
-    81652,
-    81655,
-    81659,
     81662,
-    81666,
-    81669,
-    81673,
-    81676,
-    81680,
-    81683,
-    81687,
-    81690,
-    81693,
-    81697,
-    81700,
-    81704,
-    81707,
-    81711,
-    81714,
     81718,
-    81721,
-    81725,
-    81728,
-    81731,
-    81735,
-    81738,
-    81742,
-    81745,
-    81749,
-    81752,
-    81756,
-    81759,
-    81763,
-    81766,
-    81769,
     81773,
-    81776,
-    81780,
-    81783,
-    81787,
-    81790,
-    81794,
-    81797,
-    81801,
-    81804,
-    81808,
-    81811,
-    81814,
-    81818,
-    81821,
-    81825,
     81828,
-    81832,
-    81835,
-    81839,
-    81842,
-    81846,
-    81849,
-    81853,
-    81856,
-    81859,
-    81863,
-    81866,
-    81870,
-    81873,
-    81877,
-    81880,
     81884,
-    81887,
-    81891,
-    81894,
-    81898,
-    81901,
-    81905,
-    81908,
-    81911,
-    81915,
-    81918,
-    81922,
-    81925,
-    81929,
-    81932,
-    81936,
     81939,
-    81943,
-    81946,
-    81950,
-    81953,
-    81957,
-    81960,
-    81963,
-    81967,
-    81970,
-    81974,
-    81977,
-    81981,
-    81984,
-    81988,
-    81991,
     81995,
-    81998,
-    82002,
-    82005,
-    82009,
-    82012,
-    82015,
-    82019,
-    82022,
-    82026,
-    82029,
-    82033,
-    82036,
-    82040,
-    82043,
-    82047,
     82050,
-    82054,
-    82057,
-    82061,
-    82064,
-    82068,
-    82071,
-    82074,
-    82078,
-    82081,
-    82085,
-    82088,
-    82092,
-    82095,
-    82099,
-    82102,
     82106,
-    82109,
-    82113,
-    82116,
-    82120,
-    82123,
-    82127,
-    82130,
-    82134,
-    82137,
-    82140,
-    82144,
-    82147,
-    82151,
-    82154,
-    82158,
     82161,
-    82165,
-    82168,
-    82172,
-    82175,
-    82179,
-    82182,
-    82186,
-    82189,
-    82193,
-    82196,
-    82200,
-    82203,
-    82207,
-    82210,
-    82213,
     82217,
-    82220,
-    82224,
-    82227,
-    82231,
-    82234,
-    82238,
-    82241,
-    82245,
-    82248,
-    82252,
-    82255,
-    82259,
-    82262,
-    82266,
-    82269,
     82273,
-    82276,
-    82280,
-    82283,
-    82287,
-    82290,
-    82294,
-    82297,
-    82300,
-    82304,
-    82307,
-    82311,
-    82314,
-    82318,
-    82321,
-    82325,
     82328,
-    82332,
-    82335,
-    82339,
-    82342,
-    82346,
-    82349,
-    82353,
-    82356,
-    82360,
-    82363,
-    82367,
-    82370,
-    82374,
-    82377,
-    82381,
     82384,
-    82388,
-    82391,
-    82395,
-    82398,
-    82402,
-    82405,
-    82408,
-    82412,
-    82415,
-    82419,
-    82422,
-    82426,
-    82429,
-    82433,
-    82436,
     82440,
-    82443,
-    82447,
-    82450,
-    82454,
-    82457,
-    82461,
-    82464,
-    82468,
-    82471,
-    82475,
-    82478,
-    82482,
-    82485,
-    82489,
-    82492,
     82496,
-    82499,
-    82503,
-    82506,
-    82510,
-    82513,
-    82517,
-    82520,
-    82524,
-    82527,
-    82531,
-    82534,
-    82538,
-    82541,
-    82545,
-    82548,
     82552,
-    82555,
-    82559,
-    82562,
-    82566,
-    82569,
-    82573,
-    82576,
-    82580,
-    82583,
-    82586,
-    82590,
-    82593,
-    82597,
-    82600,
-    82604,
     82607,
-    82611,
-    82614,
-    82618,
-    82621,
-    82625,
-    82628,
-    82632,
-    82635,
-    82639,
-    82642,
-    82646,
-    82649,
-    82653,
-    82656,
-    82660,
     82663,
-    82667,
-    82670,
-    82674,
-    82677,
-    82681,
-    82684,
-    82688,
-    82691,
-    82695,
-    82698,
-    82702,
-    82705,
-    82709,
-    82712,
-    82716,
     82719,
-    82723,
-    82726,
-    82730,
-    82733,
-    82737,
-    82740,
-    82744,
-    82747,
-    82751,
-    82754,
-    82758,
-    82761,
-    82765,
-    82768,
-    82772,
     82775,
-    82779,
-    82782,
-    82786,
-    82789,
-    82793,
-    82796,
-    82800,
-    82803,
-    82807,
-    82810,
-    82814,
-    82817,
-    82821,
-    82824,
-    82828,
     82831,
-    82835,
-    82838,
-    82842,
-    82845,
-    82849,
-    82852,
-    82856,
-    82859,
-    82863,
-    82866,
-    82870,
-    82873,
-    82877,
-    82881,
-    82884,
     82888,
-    82891,
-    82895,
-    82898,
-    82902,
-    82905,
-    82909,
-    82912,
-    82916,
-    82919,
-    82923,
-    82926,
-    82930,
-    82933,
-    82937,
-    82940,
     82944,
-    82947,
-    82951,
-    82954,
-    82958,
-    82961,
-    82965,
-    82968,
-    82972,
-    82975,
-    82979,
-    82982,
-    82986,
-    82989,
-    82993,
-    82996,
     83000,
-    83003,
-    83007,
-    83010,
-    83014,
-    83017,
-    83021,
-    83024,
-    83028,
-    83031,
-    83035,
-    83038,
-    83042,
-    83045,
-    83049,
-    83052,
     83056,
-    83060,
-    83063,
-    83067,
-    83070,
-    83074,
-    83077,
-    83081,
-    83084,
-    83088,
-    83091,
-    83095,
-    83098,
-    83102,
-    83105,
-    83109,
     83112,
-    83116,
-    83119,
-    83123,
-    83126,
-    83130,
-    83133,
-    83137,
-    83140,
-    83144,
-    83147,
-    83151,
-    83154,
-    83158,
-    83161,
-    83165,
     83169,
-    83172,
-    83176,
-    83179,
-    83183,
-    83186,
-    83190,
-    83193,
-    83197,
-    83200,
-    83204,
-    83207,
-    83211,
-    83214,
-    83218,
-    83221,
     83225,
-    83228,
-    83232,
-    83235,
-    83239,
-    83242,
-    83246,
-    83249,
-    83253,
-    83257,
-    83260,
-    83264,
-    83267,
-    83271,
-    83274,
-    83278,
     83281,
-    83285,
-    83288,
-    83292,
-    83295,
-    83299,
-    83302,
-    83306,
-    83309,
-    83313,
-    83316,
-    83320,
-    83323,
-    83327,
-    83331,
-    83334,
     83338,
-    83341,
-    83345,
-    83348,
-    83352,
-    83355,
-    83359,
-    83362,
-    83366,
-    83369,
-    83373,
-    83376,
-    83380,
-    83383,
-    83387,
-    83390,
     83394,
-    83398,
-    83401,
-    83405,
-    83408,
-    83412,
-    83415,
-    83419,
-    83422,
-    83426,
-    83429,
-    83433,
-    83436,
-    83440,
-    83443,
-    83447,
     83450,
-    83454,
-    83458,
-    83461,
-    83465,
-    83468,
-    83472,
-    83475,
-    83479,
-    83482,
-    83486,
-    83489,
-    83493,
-    83496,
-    83500,
-    83503,
     83507,
-    83511,
-    83514,
-    83518,
-    83521,
-    83525,
-    83528,
-    83532,
-    83535,
-    83539,
-    83542,
-    83546,
-    83549,
-    83553,
-    83556,
-    83560,
     83564,
-    83567,
-    83571,
-    83574,
-    83578,
-    83581,
-    83585,
-    83588,
-    83592,
-    83595,
-    83599,
-    83602,
-    83606,
-    83610,
-    83613,
-    83617,
     83620,
-    83624,
-    83627,
-    83631,
-    83634,
-    83638,
-    83641,
-    83645,
-    83648,
-    83652,
-    83656,
-    83659,
-    83663,
-    83666,
-    83670,
-    83673,
     83677,
-    83680,
-    83684,
-    83687,
-    83691,
-    83694,
-    83698,
-    83702,
-    83705,
-    83709,
-    83712,
-    83716,
-    83719,
-    83723,
-    83726,
-    83730,
     83733,
-    83737,
-    83740,
-    83744,
-    83748,
-    83751,
-    83755,
-    83758,
-    83762,
-    83765,
-    83769,
-    83772,
-    83776,
-    83779,
-    83783,
-    83787,
     83790,
-    83794,
-    83797,
-    83801,
-    83804,
-    83808,
-    83811,
-    83815,
-    83818,
-    83822,
-    83826,
-    83829,
-    83833,
-    83836,
-    83840,
-    83843,
     83847,
-    83850,
-    83854,
-    83857,
-    83861,
-    83865,
-    83868,
-    83872,
-    83875,
-    83879,
-    83882,
-    83886,
-    83889,
-    83893,
-    83897,
-    83900,
     83904,
-    83907,
-    83911,
-    83914,
-    83918,
-    83921,
-    83925,
-    83928,
-    83932,
-    83936,
-    83939,
-    83943,
-    83946,
-    83950,
-    83953,
-    83957,
     83960,
-    83964,
-    83968,
-    83971,
-    83975,
-    83978,
-    83982,
-    83985,
-    83989,
-    83992,
-    83996,
-    84000,
-    84003,
-    84007,
-    84010,
-    84014,
     84017,
-    84021,
-    84024,
-    84028,
-    84031,
-    84035,
-    84039,
-    84042,
-    84046,
-    84049,
-    84053,
-    84056,
-    84060,
-    84063,
-    84067,
-    84071,
     84074,
-    84078,
-    84081,
-    84085,
-    84088,
-    84092,
-    84096,
-    84099,
-    84103,
-    84106,
-    84110,
-    84113,
-    84117,
-    84120,
-    84124,
-    84128,
     84131,
-    84135,
-    84138,
-    84142,
-    84145,
-    84149,
-    84152,
-    84156,
-    84160,
-    84163,
-    84167,
-    84170,
-    84174,
-    84177,
-    84181,
-    84185,
     84188,
-    84192,
-    84195,
-    84199,
-    84202,
-    84206,
-    84209,
-    84213,
-    84217,
-    84220,
-    84224,
-    84227,
-    84231,
-    84234,
-    84238,
-    84242,
     84245,
-    84249,
-    84252,
-    84256,
-    84259,
-    84263,
-    84266,
-    84270,
-    84274,
-    84277,
-    84281,
-    84284,
-    84288,
-    84291,
-    84295,
-    84299,
     84302,
-    84306,
-    84309,
-    84313,
-    84316,
-    84320,
-    84324,
-    84327,
-    84331,
-    84334,
-    84338,
-    84341,
-    84345,
-    84348,
-    84352,
-    84356,
     84359,
-    84363,
-    84366,
-    84370,
-    84373,
-    84377,
-    84381,
-    84384,
-    84388,
-    84391,
-    84395,
-    84398,
-    84402,
-    84406,
-    84409,
-    84413,
     84416,
-    84420,
-    84423,
-    84427,
-    84431,
-    84434,
-    84438,
-    84441,
-    84445,
-    84448,
-    84452,
-    84456,
-    84459,
-    84463,
-    84466,
-    84470,
     84473,
-    84477,
-    84481,
-    84484,
-    84488,
-    84491,
-    84495,
-    84499,
-    84502,
-    84506,
-    84509,
-    84513,
-    84516,
-    84520,
-    84524,
-    84527,
     84531,
-    84534,
-    84538,
-    84541,
-    84545,
-    84549,
-    84552,
-    84556,
-    84559,
-    84563,
-    84566,
-    84570,
-    84574,
-    84577,
-    84581,
-    84584,
     84588,
-    84592,
-    84595,
-    84599,
-    84602,
-    84606,
-    84609,
-    84613,
-    84617,
-    84620,
-    84624,
-    84627,
-    84631,
-    84634,
-    84638,
-    84642,
     84645,
-    84649,
-    84652,
-    84656,
-    84660,
-    84663,
-    84667,
-    84670,
-    84674,
-    84677,
-    84681,
-    84685,
-    84688,
-    84692,
-    84695,
-    84699,
     84703,
-    84706,
-    84710,
-    84713,
-    84717,
-    84720,
-    84724,
-    84728,
-    84731,
-    84735,
-    84738,
-    84742,
-    84746,
-    84749,
-    84753,
-    84756,
     84760,
-    84763,
-    84767,
-    84771,
-    84774,
-    84778,
-    84781,
-    84785,
-    84789,
-    84792,
-    84796,
-    84799,
-    84803,
-    84806,
-    84810,
-    84814,
     84817,
-    84821,
-    84824,
-    84828,
-    84832,
-    84835,
-    84839,
-    84842,
-    84846,
-    84850,
-    84853,
-    84857,
-    84860,
-    84864,
-    84868,
-    84871,
     84875,
-    84878,
-    84882,
-    84885,
-    84889,
-    84893,
-    84896,
-    84900,
-    84903,
-    84907,
-    84911,
-    84914,
-    84918,
-    84921,
-    84925,
-    84929,
     84932,
-    84936,
-    84939,
-    84943,
-    84947,
-    84950,
-    84954,
-    84957,
-    84961,
-    84965,
-    84968,
-    84972,
-    84975,
-    84979,
-    84982,
-    84986,
     84990,
-    84993,
-    84997,
-    85000,
-    85004,
-    85008,
-    85011,
-    85015,
-    85018,
-    85022,
-    85026,
-    85029,
-    85033,
-    85036,
-    85040,
-    85044,
     85047,
-    85051,
-    85054,
-    85058,
-    85062,
-    85065,
-    85069,
-    85072,
-    85076,
-    85080,
-    85083,
-    85087,
-    85090,
-    85094,
-    85098,
-    85101,
     85105,
-    85108,
-    85112,
-    85116,
-    85119,
-    85123,
-    85126,
-    85130,
-    85134,
-    85137,
-    85141,
-    85144,
-    85148,
-    85152,
-    85155,
-    85159,
     85162,
-    85166,
-    85170,
-    85173,
-    85177,
-    85180,
-    85184,
-    85188,
-    85191,
-    85195,
-    85198,
-    85202,
-    85206,
-    85209,
-    85213,
-    85217,
     85220,
-    85224,
-    85227,
-    85231,
-    85235,
-    85238,
-    85242,
-    85245,
-    85249,
-    85253,
-    85256,
-    85260,
-    85263,
-    85267,
-    85271,
-    85274,
     85278,
-    85281,
-    85285,
-    85289,
-    85292,
-    85296,
-    85299,
-    85303,
-    85307,
-    85310,
-    85314,
-    85318,
-    85321,
-    85325,
-    85328,
-    85332,
     85336,
-    85339,
-    85343,
-    85346,
-    85350,
-    85354,
-    85357,
-    85361,
-    85364,
-    85368,
-    85372,
-    85375,
-    85379,
-    85383,
-    85386,
-    85390,
     85393,
-    85397,
-    85401,
-    85404,
-    85408,
-    85411,
-    85415,
-    85419,
-    85422,
-    85426,
-    85429,
-    85433,
-    85437,
-    85440,
-    85444,
-    85448,
     85451,
-    85455,
-    85458,
-    85462,
-    85466,
-    85469,
-    85473,
-    85476,
-    85480,
-    85484,
-    85487,
-    85491,
-    85495,
-    85498,
-    85502,
-    85505,
     85509,
-    85513,
-    85516,
-    85520,
-    85523,
-    85527,
-    85531,
-    85534,
-    85538,
-    85542,
-    85545,
-    85549,
-    85552,
-    85556,
-    85560,
-    85563,
     85567,
-    85571,
-    85574,
-    85578,
-    85581,
-    85585,
-    85589,
-    85592,
-    85596,
-    85600,
-    85603,
-    85607,
-    85610,
-    85614,
-    85618,
-    85621,
     85625,
-    85628,
-    85632,
-    85636,
-    85639,
-    85643,
-    85647,
-    85650,
-    85654,
-    85657,
-    85661,
-    85665,
-    85668,
-    85672,
-    85676,
-    85679,
     85683,
-    85686,
-    85690,
-    85694,
-    85697,
-    85701,
-    85705,
-    85708,
-    85712,
-    85715,
-    85719,
-    85723,
-    85726,
-    85730,
-    85734,
-    85737,
     85741,
-    85744,
-    85748,
-    85752,
-    85755,
-    85759,
-    85763,
-    85766,
-    85770,
-    85774,
-    85777,
-    85781,
-    85784,
-    85788,
-    85792,
-    85795,
     85799,
-    85803,
-    85806,
-    85810,
-    85813,
-    85817,
-    85821,
-    85824,
-    85828,
-    85832,
-    85835,
-    85839,
-    85842,
-    85846,
-    85850,
-    85853,
     85857,
-    85861,
-    85864,
-    85868,
-    85872,
-    85875,
-    85879,
-    85882,
-    85886,
-    85890,
-    85893,
-    85897,
-    85901,
-    85904,
-    85908,
-    85912,
     85915,
-    85919,
-    85922,
-    85926,
-    85930,
-    85933,
-    85937,
-    85941,
-    85944,
-    85948,
-    85952,
-    85955,
-    85959,
-    85962,
-    85966,
-    85970,
     85973,
-    85977,
-    85981,
-    85984,
-    85988,
-    85992,
-    85995,
-    85999,
-    86002,
-    86006,
-    86010,
-    86013,
-    86017,
-    86021,
-    86024,
-    86028,
     86032,
-    86035,
-    86039,
-    86042,
-    86046,
-    86050,
-    86053,
-    86057,
-    86061,
-    86064,
-    86068,
-    86072,
-    86075,
-    86079,
-    86083,
-    86086,
     86090,
-    86093,
-    86097,
-    86101,
-    86104,
-    86108,
-    86112,
-    86115,
-    86119,
-    86123,
-    86126,
-    86130,
-    86134,
-    86137,
-    86141,
-    86144,
     86148,
-    86152,
-    86155,
-    86159,
-    86163,
-    86166,
-    86170,
-    86174,
-    86177,
-    86181,
-    86185,
-    86188,
-    86192,
-    86195,
-    86199,
-    86203,
     86206,
-    86210,
-    86214,
-    86217,
-    86221,
-    86225,
-    86228,
-    86232,
-    86236,
-    86239,
-    86243,
-    86247,
-    86250,
-    86254,
-    86258,
-    86261,
     86265,
-    86268,
-    86272,
-    86276,
-    86279,
-    86283,
-    86287,
-    86290,
-    86294,
-    86298,
-    86301,
-    86305,
-    86309,
-    86312,
-    86316,
-    86320,
     86323,
-    86327,
-    86331,
-    86334,
-    86338,
-    86341,
-    86345,
-    86349,
-    86352,
-    86356,
-    86360,
-    86363,
-    86367,
-    86371,
-    86374,
-    86378,
     86382,
-    86385,
-    86389,
-    86393,
-    86396,
-    86400,
-    86404,
-    86407,
-    86411,
-    86415,
-    86418,
-    86422,
-    86426,
-    86429,
-    86433,
-    86436,
     86440,
-    86444,
-    86447,
-    86451,
-    86455,
-    86458,
-    86462,
-    86466,
-    86469,
-    86473,
-    86477,
-    86480,
-    86484,
-    86488,
-    86491,
-    86495,
     86499,
-    86502,
-    86506,
-    86510,
-    86513,
-    86517,
-    86521,
-    86524,
-    86528,
-    86532,
-    86535,
-    86539,
-    86543,
-    86546,
-    86550,
-    86554,
     86557,
-    86561,
-    86565,
-    86568,
-    86572,
-    86576,
-    86579,
-    86583,
-    86587,
-    86590,
-    86594,
-    86598,
-    86601,
-    86605,
-    86609,
-    86612,
     86616,
-    86620,
-    86623,
-    86627,
-    86631,
-    86634,
-    86638,
-    86642,
-    86645,
-    86649,
-    86653,
-    86656,
-    86660,
-    86664,
-    86667,
-    86671,
     86675,
-    86678,
-    86682,
-    86686,
-    86689,
-    86693,
-    86697,
-    86700,
-    86704,
-    86708,
-    86711,
-    86715,
-    86719,
-    86722,
-    86726,
-    86730,
     86733,
-    86737,
-    86741,
-    86744,
-    86748,
-    86752,
-    86755,
-    86759,
-    86763,
-    86766,
-    86770,
-    86774,
-    86777,
-    86781,
-    86785,
-    86788,
     86792,
-    86796,
-    86799,
-    86803,
-    86807,
-    86810,
-    86814,
-    86818,
-    86821,
-    86825,
-    86829,
-    86832,
-    86836,
-    86840,
-    86843,
-    86847,
     86851,
-    86854,
-    86858,
-    86862,
-    86865,
-    86869,
-    86873,
-    86876,
-    86880,
-    86884,
-    86887,
-    86891,
-    86895,
-    86898,
-    86902,
-    86906,
     86910,
-    86913,
-    86917,
-    86921,
-    86924,
-    86928,
-    86932,
-    86935,
-    86939,
-    86943,
-    86946,
-    86950,
-    86954,
-    86957,
-    86961,
-    86965,
     86968,
-    86972,
-    86976,
-    86979,
-    86983,
-    86987,
-    86990,
-    86994,
-    86998,
-    87001,
-    87005,
-    87009,
-    87013,
-    87016,
-    87020,
-    87024,
     87027,
-    87031,
-    87035,
-    87038,
-    87042,
-    87046,
-    87049,
-    87053,
-    87057,
-    87060,
-    87064,
-    87068,
-    87071,
-    87075,
-    87079,
-    87083,
     87086,
-    87090,
-    87094,
-    87097,
-    87101,
-    87105,
-    87108,
-    87112,
-    87116,
-    87119,
-    87123,
-    87127,
-    87130,
-    87134,
-    87138,
-    87141,
     87145,
-    87149,
-    87153,
-    87156,
-    87160,
-    87164,
-    87167,
-    87171,
-    87175,
-    87178,
-    87182,
-    87186,
-    87189,
-    87193,
-    87197,
-    87200,
     87204,
-    87208,
-    87212,
-    87215,
-    87219,
-    87223,
-    87226,
-    87230,
-    87234,
-    87237,
-    87241,
-    87245,
-    87248,
-    87252,
-    87256,
-    87260,
     87263,
-    87267,
-    87271,
-    87274,
-    87278,
-    87282,
-    87285,
-    87289,
-    87293,
-    87296,
-    87300,
-    87304,
-    87308,
-    87311,
-    87315,
-    87319,
     87322,
-    87326,
-    87330,
-    87333,
-    87337,
-    87341,
-    87344,
-    87348,
-    87352,
-    87356,
-    87359,
-    87363,
-    87367,
-    87370,
-    87374,
-    87378,
     87381,
-    87385,
-    87389,
-    87393,
-    87396,
-    87400,
-    87404,
-    87407,
-    87411,
-    87415,
-    87418,
-    87422,
-    87426,
-    87429,
-    87433,
-    87437,
     87441,
-    87444,
-    87448,
-    87452,
-    87455,
-    87459,
-    87463,
-    87466,
-    87470,
-    87474,
-    87478,
-    87481,
-    87485,
-    87489,
-    87492,
-    87496,
     87500,
-    87504,
-    87507,
-    87511,
-    87515,
-    87518,
-    87522,
-    87526,
-    87529,
-    87533,
-    87537,
-    87541,
-    87544,
-    87548,
-    87552,
-    87555,
     87559,
-    87563,
-    87566,
-    87570,
-    87574,
-    87578,
-    87581,
-    87585,
-    87589,
-    87592,
-    87596,
-    87600,
-    87604,
-    87607,
-    87611,
-    87615,
     87618,
-    87622,
-    87626,
-    87629,
-    87633,
-    87637,
-    87641,
-    87644,
-    87648,
-    87652,
-    87655,
-    87659,
-    87663,
-    87667,
-    87670,
-    87674,
     87678,
-    87681,
-    87685,
-    87689,
-    87693,
-    87696,
-    87700,
-    87704,
-    87707,
-    87711,
-    87715,
-    87718,
-    87722,
-    87726,
-    87730,
-    87733,
     87737,
-    87741,
-    87744,
-    87748,
-    87752,
-    87756,
-    87759,
-    87763,
-    87767,
-    87770,
-    87774,
-    87778,
-    87782,
-    87785,
-    87789,
-    87793,
     87796,
-    87800,
-    87804,
-    87808,
-    87811,
-    87815,
-    87819,
-    87822,
-    87826,
-    87830,
-    87834,
-    87837,
-    87841,
-    87845,
-    87848,
-    87852,
     87856,
-    87860,
-    87863,
-    87867,
-    87871,
-    87874,
-    87878,
-    87882,
-    87886,
-    87889,
-    87893,
-    87897,
-    87901,
-    87904,
-    87908,
-    87912,
     87915,
-    87919,
-    87923,
-    87927,
-    87930,
-    87934,
-    87938,
-    87941,
-    87945,
-    87949,
-    87953,
-    87956,
-    87960,
-    87964,
-    87967,
-    87971,
     87975,
-    87979,
-    87982,
-    87986,
-    87990,
-    87994,
-    87997,
-    88001,
-    88005,
-    88008,
-    88012,
-    88016,
-    88020,
-    88023,
-    88027,
-    88031,
     88034,
-    88038,
-    88042,
-    88046,
-    88049,
-    88053,
-    88057,
-    88061,
-    88064,
-    88068,
-    88072,
-    88075,
-    88079,
-    88083,
-    88087,
-    88090,
     88094,
-    88098,
-    88102,
-    88105,
-    88109,
-    88113,
-    88116,
-    88120,
-    88124,
-    88128,
-    88131,
-    88135,
-    88139,
-    88143,
-    88146,
-    88150,
     88154,
-    88157,
-    88161,
-    88165,
-    88169,
-    88172,
-    88176,
-    88180,
-    88184,
-    88187,
-    88191,
-    88195,
-    88199,
-    88202,
-    88206,
-    88210,
     88213,
-    88217,
-    88221,
-    88225,
-    88228,
-    88232,
-    88236,
-    88240,
-    88243,
-    88247,
-    88251,
-    88255,
-    88258,
-    88262,
-    88266,
-    88269,
     88273,
-    88277,
-    88281,
-    88284,
-    88288,
-    88292,
-    88296,
-    88299,
-    88303,
-    88307,
-    88311,
-    88314,
-    88318,
-    88322,
-    88325,
-    88329,
     88333,
-    88337,
-    88340,
-    88344,
-    88348,
-    88352,
-    88355,
-    88359,
-    88363,
-    88367,
-    88370,
-    88374,
-    88378,
-    88382,
-    88385,
-    88389,
     88393,
-    88397,
-    88400,
-    88404,
-    88408,
-    88411,
-    88415,
-    88419,
-    88423,
-    88426,
-    88430,
-    88434,
-    88438,
-    88441,
-    88445,
-    88449,
     88453,
-    88456,
-    88460,
-    88464,
-    88468,
-    88471,
-    88475,
-    88479,
-    88483,
-    88486,
-    88490,
-    88494,
-    88498,
-    88501,
-    88505,
-    88509,
     88513,
-    88516,
-    88520,
-    88524,
-    88527,
-    88531,
-    88535,
-    88539,
-    88542,
-    88546,
-    88550,
-    88554,
-    88557,
-    88561,
-    88565,
-    88569,
     88572,
-    88576,
-    88580,
-    88584,
-    88587,
-    88591,
-    88595,
-    88599,
-    88602,
-    88606,
-    88610,
-    88614,
-    88617,
-    88621,
-    88625,
-    88629,
     88632,
-    88636,
-    88640,
-    88644,
-    88647,
-    88651,
-    88655,
-    88659,
-    88662,
-    88666,
-    88670,
-    88674,
-    88677,
-    88681,
-    88685,
-    88689,
     88692,
-    88696,
-    88700,
-    88704,
-    88707,
-    88711,
-    88715,
-    88719,
-    88722,
-    88726,
-    88730,
-    88734,
-    88737,
-    88741,
-    88745,
-    88749,
     88752,
-    88756,
-    88760,
-    88764,
-    88768,
-    88771,
-    88775,
-    88779,
-    88783,
-    88786,
-    88790,
-    88794,
-    88798,
-    88801,
-    88805,
-    88809,
     88813,
-    88816,
-    88820,
-    88824,
-    88828,
-    88831,
-    88835,
-    88839,
-    88843,
-    88846,
-    88850,
-    88854,
-    88858,
-    88861,
-    88865,
-    88869,
     88873,
-    88876,
-    88880,
-    88884,
-    88888,
-    88892,
-    88895,
-    88899,
-    88903,
-    88907,
-    88910,
-    88914,
-    88918,
-    88922,
-    88925,
-    88929,
     88933,
-    88937,
-    88940,
-    88944,
-    88948,
-    88952,
-    88955,
-    88959,
-    88963,
-    88967,
-    88971,
-    88974,
-    88978,
-    88982,
-    88986,
-    88989,
     88993,
-    88997,
-    89001,
-    89004,
-    89008,
-    89012,
-    89016,
-    89019,
-    89023,
-    89027,
-    89031,
-    89035,
-    89038,
-    89042,
-    89046,
-    89050,
     89053,
-    89057,
-    89061,
-    89065,
-    89068,
-    89072,
-    89076,
-    89080,
-    89084,
-    89087,
-    89091,
-    89095,
-    89099,
-    89102,
-    89106,
-    89110,
     89114,
-    89117,
-    89121,
-    89125,
-    89129,
-    89133,
-    89136,
-    89140,
-    89144,
-    89148,
-    89151,
-    89155,
-    89159,
-    89163,
-    89166,
-    89170,
     89174,
-    89178,
-    89182,
-    89185,
-    89189,
-    89193,
-    89197,
-    89200,
-    89204,
-    89208,
-    89212,
-    89216,
-    89219,
-    89223,
-    89227,
-    89231,
     89234,
-    89238,
-    89242,
-    89246,
-    89250,
-    89253,
-    89257,
-    89261,
-    89265,
-    89268,
-    89272,
-    89276,
-    89280,
-    89283,
-    89287,
-    89291,
     89295,
-    89299,
-    89302,
-    89306,
-    89310,
-    89314,
-    89318,
-    89321,
-    89325,
-    89329,
-    89333,
-    89336,
-    89340,
-    89344,
-    89348,
-    89352,
     89355,
-    89359,
-    89363,
-    89367,
-    89370,
-    89374,
-    89378,
-    89382,
-    89386,
-    89389,
-    89393,
-    89397,
-    89401,
-    89404,
-    89408,
-    89412,
     89416,
-    89420,
-    89423,
-    89427,
-    89431,
-    89435,
-    89439,
-    89442,
-    89446,
-    89450,
-    89454,
-    89457,
-    89461,
-    89465,
-    89469,
-    89473,
     89476,
-    89480,
-    89484,
-    89488,
-    89491,
-    89495,
-    89499,
-    89503,
-    89507,
-    89510,
-    89514,
-    89518,
-    89522,
-    89526,
-    89529,
-    89533,
     89537,
-    89541,
-    89545,
-    89548,
-    89552,
-    89556,
-    89560,
-    89563,
-    89567,
-    89571,
-    89575,
-    89579,
-    89582,
-    89586,
-    89590,
-    89594,
     89598,
-    89601,
-    89605,
-    89609,
-    89613,
-    89617,
-    89620,
-    89624,
-    89628,
-    89632,
-    89635,
-    89639,
-    89643,
-    89647,
-    89651,
-    89654,
     89658,
-    89662,
-    89666,
-    89670,
-    89673,
-    89677,
-    89681,
-    89685,
-    89689,
-    89692,
-    89696,
-    89700,
-    89704,
-    89708,
-    89711,
-    89715,
     89719,
-    89723,
-    89727,
-    89730,
-    89734,
-    89738,
-    89742,
-    89746,
-    89749,
-    89753,
-    89757,
-    89761,
-    89765,
-    89768,
-    89772,
-    89776,
     89780,
-    89783,
-    89787,
-    89791,
-    89795,
-    89799,
-    89802,
-    89806,
-    89810,
-    89814,
-    89818,
-    89821,
-    89825,
-    89829,
-    89833,
-    89837,
     89840,
-    89844,
-    89848,
-    89852,
-    89856,
-    89859,
-    89863,
-    89867,
-    89871,
-    89875,
-    89879,
-    89882,
-    89886,
-    89890,
-    89894,
-    89898,
     89901,
-    89905,
-    89909,
-    89913,
-    89917,
-    89920,
-    89924,
-    89928,
-    89932,
-    89936,
-    89939,
-    89943,
-    89947,
-    89951,
-    89955,
-    89958,
     89962,
-    89966,
-    89970,
-    89974,
-    89977,
-    89981,
-    89985,
-    89989,
-    89993,
-    89996,
-    90000,
-    90004,
-    90008,
-    90012,
-    90015,
-    90019,
     90023,
-    90027,
-    90031,
-    90035,
-    90038,
-    90042,
-    90046,
-    90050,
-    90054,
-    90057,
-    90061,
-    90065,
-    90069,
-    90073,
-    90076,
-    90080,
     90084,
-    90088,
-    90092,
-    90096,
-    90099,
-    90103,
-    90107,
-    90111,
-    90115,
-    90118,
-    90122,
-    90126,
-    90130,
-    90134,
-    90137,
-    90141,
     90145,
-    90149,
-    90153,
-    90157,
-    90160,
-    90164,
-    90168,
-    90172,
-    90176,
-    90179,
-    90183,
-    90187,
-    90191,
-    90195,
-    90198,
-    90202,
     90206,
-    90210,
-    90214,
-    90218,
-    90221,
-    90225,
-    90229,
-    90233,
-    90237,
-    90240,
-    90244,
-    90248,
-    90252,
-    90256,
-    90260,
-    90263,
     90267,
-    90271,
-    90275,
-    90279,
-    90282,
-    90286,
-    90290,
-    90294,
-    90298,
-    90302,
-    90305,
-    90309,
-    90313,
-    90317,
-    90321,
-    90324,
     90328,
-    90332,
-    90336,
-    90340,
-    90344,
-    90347,
-    90351,
-    90355,
-    90359,
-    90363,
-    90367,
-    90370,
-    90374,
-    90378,
-    90382,
-    90386,
     90389,
-    90393,
-    90397,
-    90401,
-    90405,
-    90409,
-    90412,
-    90416,
-    90420,
-    90424,
-    90428,
-    90432,
-    90435,
-    90439,
-    90443,
-    90447,
     90451,
-    90455,
-    90458,
-    90462,
-    90466,
-    90470,
-    90474,
-    90477,
-    90481,
-    90485,
-    90489,
-    90493,
-    90497,
-    90500,
-    90504,
-    90508,
     90512,
-    90516,
-    90520,
-    90523,
-    90527,
-    90531,
-    90535,
-    90539,
-    90543,
-    90546,
-    90550,
-    90554,
-    90558,
-    90562,
-    90566,
-    90569,
     90573,
-    90577,
-    90581,
-    90585,
-    90589,
-    90592,
-    90596,
-    90600,
-    90604,
-    90608,
-    90612,
-    90615,
-    90619,
-    90623,
-    90627,
-    90631,
     90635,
-    90638,
-    90642,
-    90646,
-    90650,
-    90654,
-    90658,
-    90661,
-    90665,
-    90669,
-    90673,
-    90677,
-    90681,
-    90684,
-    90688,
-    90692,
     90696,
-    90700,
-    90704,
-    90707,
-    90711,
-    90715,
-    90719,
-    90723,
-    90727,
-    90730,
-    90734,
-    90738,
-    90742,
-    90746,
-    90750,
-    90753,
     90757,
-    90761,
-    90765,
-    90769,
-    90773,
-    90777,
-    90780,
-    90784,
-    90788,
-    90792,
-    90796,
-    90800,
-    90803,
-    90807,
-    90811,
-    90815,
     90819,
-    90823,
-    90826,
-    90830,
-    90834,
-    90838,
-    90842,
-    90846,
-    90850,
-    90853,
-    90857,
-    90861,
-    90865,
-    90869,
-    90873,
-    90876,
     90880,
-    90884,
-    90888,
-    90892,
-    90896,
-    90900,
-    90903,
-    90907,
-    90911,
-    90915,
-    90919,
-    90923,
-    90926,
-    90930,
-    90934,
-    90938,
     90942,
-    90946,
-    90950,
-    90953,
-    90957,
-    90961,
-    90965,
-    90969,
-    90973,
-    90976,
-    90980,
-    90984,
-    90988,
-    90992,
-    90996,
-    91000,
     91003,
-    91007,
-    91011,
-    91015,
-    91019,
-    91023,
-    91027,
-    91030,
-    91034,
-    91038,
-    91042,
-    91046,
-    91050,
-    91053,
-    91057,
-    91061,
     91065,
-    91069,
-    91073,
-    91077,
-    91080,
-    91084,
-    91088,
-    91092,
-    91096,
-    91100,
-    91104,
-    91107,
-    91111,
-    91115,
-    91119,
-    91123,
     91127,
-    91131,
-    91134,
-    91138,
-    91142,
-    91146,
-    91150,
-    91154,
-    91158,
-    91161,
-    91165,
-    91169,
-    91173,
-    91177,
-    91181,
-    91185,
     91188,
-    91192,
-    91196,
-    91200,
-    91204,
-    91208,
-    91212,
-    91215,
-    91219,
-    91223,
-    91227,
-    91231,
-    91235,
-    91239,
-    91242,
-    91246,
     91250,
-    91254,
-    91258,
-    91262,
-    91266,
-    91269,
-    91273,
-    91277,
-    91281,
-    91285,
-    91289,
-    91293,
-    91296,
-    91300,
-    91304,
-    91308,
     91312,
-    91316,
-    91320,
-    91324,
-    91327,
-    91331,
-    91335,
-    91339,
-    91343,
-    91347,
-    91351,
-    91354,
-    91358,
-    91362,
-    91366,
-    91370,
     91374,
-    91378,
-    91381,
-    91385,
-    91389,
-    91393,
-    91397,
-    91401,
-    91405,
-    91409,
-    91412,
-    91416,
-    91420,
-    91424,
-    91428,
-    91432,
     91436,
-    91439,
-    91443,
-    91447,
-    91451,
-    91455,
-    91459,
-    91463,
-    91467,
-    91470,
-    91474,
-    91478,
-    91482,
-    91486,
-    91490,
-    91494,
     91498,
-    91501,
-    91505,
-    91509,
-    91513,
-    91517,
-    91521,
-    91525,
-    91529,
-    91532,
-    91536,
-    91540,
-    91544,
-    91548,
-    91552,
-    91556,
     91559,
-    91563,
-    91567,
-    91571,
-    91575,
-    91579,
-    91583,
-    91587,
-    91590,
-    91594,
-    91598,
-    91602,
-    91606,
-    91610,
-    91614,
-    91618,
     91621,
-    91625,
-    91629,
-    91633,
-    91637,
-    91641,
-    91645,
-    91649,
-    91653,
-    91656,
-    91660,
-    91664,
-    91668,
-    91672,
-    91676,
-    91680,
     91684,
-    91687,
-    91691,
-    91695,
-    91699,
-    91703,
-    91707,
-    91711,
-    91715,
-    91718,
-    91722,
-    91726,
-    91730,
-    91734,
-    91738,
-    91742,
     91746,
-    91749,
-    91753,
-    91757,
-    91761,
-    91765,
-    91769,
-    91773,
-    91777,
-    91781,
-    91784,
-    91788,
-    91792,
-    91796,
-    91800,
-    91804,
     91808,
-    91812,
-    91816,
-    91819,
-    91823,
-    91827,
-    91831,
-    91835,
-    91839,
-    91843,
-    91847,
-    91850,
-    91854,
-    91858,
-    91862,
-    91866,
     91870,
-    91874,
-    91878,
-    91882,
-    91885,
-    91889,
-    91893,
-    91897,
-    91901,
-    91905,
-    91909,
-    91913,
-    91917,
-    91920,
-    91924,
-    91928,
     91932,
-    91936,
-    91940,
-    91944,
-    91948,
-    91952,
-    91955,
-    91959,
-    91963,
-    91967,
-    91971,
-    91975,
-    91979,
-    91983,
-    91987,
-    91990,
     91994,
-    91998,
-    92002,
-    92006,
-    92010,
-    92014,
-    92018,
-    92022,
-    92026,
-    92029,
-    92033,
-    92037,
-    92041,
-    92045,
-    92049,
-    92053,
     92057,
-    92061,
-    92064,
-    92068,
-    92072,
-    92076,
-    92080,
-    92084,
-    92088,
-    92092,
-    92096,
-    92100,
-    92103,
-    92107,
-    92111,
-    92115,
     92119,
-    92123,
-    92127,
-    92131,
-    92135,
-    92138,
-    92142,
-    92146,
-    92150,
-    92154,
-    92158,
-    92162,
-    92166,
-    92170,
-    92174,
-    92177,
     92181,
-    92185,
-    92189,
-    92193,
-    92197,
-    92201,
-    92205,
-    92209,
-    92213,
-    92216,
-    92220,
-    92224,
-    92228,
-    92232,
-    92236,
-    92240,
     92244,
-    92248,
-    92252,
-    92255,
-    92259,
-    92263,
-    92267,
-    92271,
-    92275,
-    92279,
-    92283,
-    92287,
-    92291,
-    92295,
-    92298,
-    92302,
     92306,
-    92310,
-    92314,
-    92318,
-    92322,
-    92326,
-    92330,
-    92334,
-    92337,
-    92341,
-    92345,
-    92349,
-    92353,
-    92357,
-    92361,
-    92365,
     92369,
-    92373,
-    92377,
-    92380,
-    92384,
-    92388,
-    92392,
-    92396,
-    92400,
-    92404,
-    92408,
-    92412,
-    92416,
-    92420,
-    92423,
-    92427,
     92431,
-    92435,
-    92439,
-    92443,
-    92447,
-    92451,
-    92455,
-    92459,
-    92463,
-    92466,
-    92470,
-    92474,
-    92478,
-    92482,
-    92486,
-    92490,
     92494,
-    92498,
-    92502,
-    92506,
-    92510,
-    92513,
-    92517,
-    92521,
-    92525,
-    92529,
-    92533,
-    92537,
-    92541,
-    92545,
-    92549,
-    92553,
     92557,
-    92560,
-    92564,
-    92568,
-    92572,
-    92576,
-    92580,
-    92584,
-    92588,
-    92592,
-    92596,
-    92600,
-    92604,
-    92607,
-    92611,
-    92615,
     92619,
-    92623,
-    92627,
-    92631,
-    92635,
-    92639,
-    92643,
-    92647,
-    92651,
-    92654,
-    92658,
-    92662,
-    92666,
-    92670,
-    92674,
-    92678,
     92682,
-    92686,
-    92690,
-    92694,
-    92698,
-    92702,
-    92705,
-    92709,
-    92713,
-    92717,
-    92721,
-    92725,
-    92729,
-    92733,
-    92737,
-    92741,
     92745,
-    92749,
-    92753,
-    92756,
-    92760,
-    92764,
-    92768,
-    92772,
-    92776,
-    92780,
-    92784,
-    92788,
-    92792,
-    92796,
-    92800,
-    92804,
     92807,
-    92811,
-    92815,
-    92819,
-    92823,
-    92827,
-    92831,
-    92835,
-    92839,
-    92843,
-    92847,
-    92851,
-    92855,
-    92859,
-    92862,
-    92866,
     92870,
-    92874,
-    92878,
-    92882,
-    92886,
-    92890,
-    92894,
-    92898,
-    92902,
-    92906,
-    92910,
-    92914,
-    92917,
-    92921,
-    92925,
-    92929,
     92933,
-    92937,
-    92941,
-    92945,
-    92949,
-    92953,
-    92957,
-    92961,
-    92965,
-    92969,
-    92973,
-    92976,
-    92980,
-    92984,
-    92988,
-    92992,
     92996,
-    93000,
-    93004,
-    93008,
-    93012,
-    93016,
-    93020,
-    93024,
-    93028,
-    93032,
-    93035,
-    93039,
-    93043,
-    93047,
-    93051,
-    93055,
     93059,
-    93063,
-    93067,
-    93071,
-    93075,
-    93079,
-    93083,
-    93087,
-    93091,
-    93095,
-    93098,
-    93102,
-    93106,
-    93110,
-    93114,
-    93118,
     93122,
-    93126,
-    93130,
-    93134,
-    93138,
-    93142,
-    93146,
-    93150,
-    93154,
-    93158,
-    93162,
-    93165,
-    93169,
-    93173,
-    93177,
-    93181,
     93185,
-    93189,
-    93193,
-    93197,
-    93201,
-    93205,
-    93209,
-    93213,
-    93217,
-    93221,
-    93225,
-    93229,
-    93232,
-    93236,
-    93240,
-    93244,
     93248,
-    93252,
-    93256,
-    93260,
-    93264,
-    93268,
-    93272,
-    93276,
-    93280,
-    93284,
-    93288,
-    93292,
-    93296,
-    93300,
-    93303,
-    93307,
     93311,
-    93315,
-    93319,
-    93323,
-    93327,
-    93331,
-    93335,
-    93339,
-    93343,
-    93347,
-    93351,
-    93355,
-    93359,
-    93363,
-    93367,
-    93371,
     93375,
-    93379,
-    93382,
-    93386,
-    93390,
-    93394,
-    93398,
-    93402,
-    93406,
-    93410,
-    93414,
-    93418,
-    93422,
-    93426,
-    93430,
-    93434,
     93438,
-    93442,
-    93446,
-    93450,
-    93454,
-    93458,
-    93462,
-    93465,
-    93469,
-    93473,
-    93477,
-    93481,
-    93485,
-    93489,
-    93493,
-    93497,
     93501,
-    93505,
-    93509,
-    93513,
-    93517,
-    93521,
-    93525,
-    93529,
-    93533,
-    93537,
-    93541,
-    93545,
-    93549,
-    93553,
-    93556,
-    93560,
     93564,
-    93568,
-    93572,
-    93576,
-    93580,
-    93584,
-    93588,
-    93592,
-    93596,
-    93600,
-    93604,
-    93608,
-    93612,
-    93616,
-    93620,
-    93624,
     93628,
-    93632,
-    93636,
-    93640,
-    93644,
-    93648,
-    93652,
-    93655,
-    93659,
-    93663,
-    93667,
-    93671,
-    93675,
-    93679,
-    93683,
-    93687,
     93691,
-    93695,
-    93699,
-    93703,
-    93707,
-    93711,
-    93715,
-    93719,
-    93723,
-    93727,
-    93731,
-    93735,
-    93739,
-    93743,
-    93747,
-    93751,
     93755,
-    93759,
-    93763,
-    93766,
-    93770,
-    93774,
-    93778,
-    93782,
-    93786,
-    93790,
-    93794,
-    93798,
-    93802,
-    93806,
-    93810,
-    93814,
     93818,
-    93822,
-    93826,
-    93830,
-    93834,
-    93838,
-    93842,
-    93846,
-    93850,
-    93854,
-    93858,
-    93862,
-    93866,
-    93870,
-    93874,
-    93878,
     93882,
-    93886,
-    93890,
-    93894,
-    93897,
-    93901,
-    93905,
-    93909,
-    93913,
-    93917,
-    93921,
-    93925,
-    93929,
-    93933,
-    93937,
-    93941,
     93945,
-    93949,
-    93953,
-    93957,
-    93961,
-    93965,
-    93969,
-    93973,
-    93977,
-    93981,
-    93985,
-    93989,
-    93993,
-    93997,
-    94001,
-    94005,
     94009,
-    94013,
-    94017,
-    94021,
-    94025,
-    94029,
-    94033,
-    94037,
-    94041,
-    94045,
-    94049,
-    94053,
-    94057,
-    94060,
-    94064,
-    94068,
     94072,
-    94076,
-    94080,
-    94084,
-    94088,
-    94092,
-    94096,
-    94100,
-    94104,
-    94108,
-    94112,
-    94116,
-    94120,
-    94124,
-    94128,
-    94132,
     94136,
-    94140,
-    94144,
-    94148,
-    94152,
-    94156,
-    94160,
-    94164,
-    94168,
-    94172,
-    94176,
-    94180,
-    94184,
-    94188,
-    94192,
-    94196,
     94200,
-    94204,
-    94208,
-    94212,
-    94216,
-    94220,
-    94224,
-    94228,
-    94232,
-    94236,
-    94240,
-    94244,
-    94248,
-    94252,
-    94256,
-    94260,
     94264,
-    94268,
-    94272,
-    94276,
-    94280,
-    94284,
-    94288,
-    94292,
-    94296,
-    94300,
-    94304,
-    94308,
-    94312,
-    94316,
-    94320,
-    94323,
     94327,
-    94331,
-    94335,
-    94339,
-    94343,
-    94347,
-    94351,
-    94355,
-    94359,
-    94363,
-    94367,
-    94371,
-    94375,
-    94379,
-    94383,
-    94387,
     94391,
-    94395,
-    94399,
-    94403,
-    94407,
-    94411,
-    94415,
-    94419,
-    94423,
-    94427,
-    94431,
-    94435,
-    94439,
-    94443,
-    94447,
-    94451,
     94455,
-    94459,
-    94463,
-    94467,
-    94471,
-    94475,
-    94479,
-    94483,
-    94487,
-    94491,
-    94495,
-    94499,
-    94503,
-    94507,
-    94511,
-    94515,
     94519,
-    94523,
-    94527,
-    94531,
-    94535,
-    94539,
-    94543,
-    94547,
-    94551,
-    94555,
-    94559,
-    94563,
-    94567,
-    94571,
-    94575,
-    94579,
     94583,
-    94587,
-    94591,
-    94595,
-    94599,
-    94603,
-    94607,
-    94611,
-    94615,
-    94619,
-    94623,
-    94627,
-    94631,
-    94635,
-    94639,
-    94643,
     94647,
-    94651,
-    94655,
-    94659,
-    94663,
-    94667,
-    94671,
-    94675,
-    94679,
-    94683,
-    94687,
-    94691,
-    94695,
-    94699,
-    94703,
-    94707,
     94711,
-    94715,
-    94719,
-    94723,
-    94727,
-    94731,
-    94735,
-    94739,
-    94743,
-    94747,
-    94751,
-    94755,
-    94759,
-    94763,
-    94767,
-    94771,
     94776,
-    94780,
-    94784,
-    94788,
-    94792,
-    94796,
-    94800,
-    94804,
-    94808,
-    94812,
-    94816,
-    94820,
-    94824,
-    94828,
-    94832,
-    94836,
     94840,
-    94844,
-    94848,
-    94852,
-    94856,
-    94860,
-    94864,
-    94868,
-    94872,
-    94876,
-    94880,
-    94884,
-    94888,
-    94892,
-    94896,
-    94900,
     94904,
-    94908,
-    94912,
-    94916,
-    94920,
-    94924,
-    94928,
-    94932,
-    94936,
-    94940,
-    94944,
-    94948,
-    94952,
-    94956,
-    94960,
-    94964,
     94968,
-    94972,
-    94976,
-    94980,
-    94984,
-    94988,
-    94992,
-    94996,
-    95000,
-    95004,
-    95008,
-    95012,
-    95016,
-    95020,
-    95024,
-    95028,
     95032,
-    95036,
-    95041,
-    95045,
-    95049,
-    95053,
-    95057,
-    95061,
-    95065,
-    95069,
-    95073,
-    95077,
-    95081,
-    95085,
-    95089,
-    95093,
     95097,
-    95101,
-    95105,
-    95109,
-    95113,
-    95117,
-    95121,
-    95125,
-    95129,
-    95133,
-    95137,
-    95141,
-    95145,
-    95149,
-    95153,
-    95157,
     95161,
-    95165,
-    95169,
-    95173,
-    95177,
-    95181,
-    95185,
-    95189,
-    95193,
-    95197,
-    95201,
-    95206,
-    95210,
-    95214,
-    95218,
-    95222,
     95226,
-    95230,
-    95234,
-    95238,
-    95242,
-    95246,
-    95250,
-    95254,
-    95258,
-    95262,
-    95266,
-    95270,
-    95274,
-    95278,
-    95282,
-    95286,
     95290,
-    95294,
-    95298,
-    95302,
-    95306,
-    95310,
-    95314,
-    95318,
-    95322,
-    95326,
-    95330,
-    95334,
-    95339,
-    95343,
-    95347,
-    95351,
     95355,
-    95359,
-    95363,
-    95367,
-    95371,
-    95375,
-    95379,
-    95383,
-    95387,
-    95391,
-    95395,
-    95399,
-    95403,
-    95407,
-    95411,
-    95415,
     95419,
-    95423,
-    95427,
-    95431,
-    95435,
-    95439,
-    95443,
-    95447,
-    95452,
-    95456,
-    95460,
-    95464,
-    95468,
-    95472,
-    95476,
-    95480,
     95484,
-    95488,
-    95492,
-    95496,
-    95500,
-    95504,
-    95508,
-    95512,
-    95516,
-    95520,
-    95524,
-    95528,
-    95532,
-    95536,
-    95540,
-    95544,
     95548,
-    95553,
-    95557,
-    95561,
-    95565,
-    95569,
-    95573,
-    95577,
-    95581,
-    95585,
-    95589,
-    95593,
-    95597,
-    95601,
-    95605,
-    95609,
     95613,
-    95617,
-    95621,
-    95625,
-    95629,
-    95633,
-    95637,
-    95641,
-    95646,
-    95650,
-    95654,
-    95658,
-    95662,
-    95666,
-    95670,
-    95674,
     95678,
-    95682,
-    95686,
-    95690,
-    95694,
-    95698,
-    95702,
-    95706,
-    95710,
-    95714,
-    95718,
-    95722,
-    95727,
-    95731,
-    95735,
-    95739,
     95743,
-    95747,
-    95751,
-    95755,
-    95759,
-    95763,
-    95767,
-    95771,
-    95775,
-    95779,
-    95783,
-    95787,
-    95791,
-    95795,
-    95799,
-    95803,
     95808,
-    95812,
-    95816,
-    95820,
-    95824,
-    95828,
-    95832,
-    95836,
-    95840,
-    95844,
-    95848,
-    95852,
-    95856,
-    95860,
-    95864,
-    95868,
     95872,
-    95876,
-    95881,
-    95885,
-    95889,
-    95893,
-    95897,
-    95901,
-    95905,
-    95909,
-    95913,
-    95917,
-    95921,
-    95925,
-    95929,
-    95933,
     95937,
-    95941,
-    95945,
-    95950,
-    95954,
-    95958,
-    95962,
-    95966,
-    95970,
-    95974,
-    95978,
-    95982,
-    95986,
-    95990,
-    95994,
-    95998,
     96002,
-    96006,
-    96010,
-    96014,
-    96019,
-    96023,
-    96027,
-    96031,
-    96035,
-    96039,
-    96043,
-    96047,
-    96051,
-    96055,
-    96059,
-    96063,
     96067,
-    96071,
-    96075,
-    96079,
-    96084,
-    96088,
-    96092,
-    96096,
-    96100,
-    96104,
-    96108,
-    96112,
-    96116,
-    96120,
-    96124,
-    96128,
     96132,
-    96136,
-    96140,
-    96145,
-    96149,
-    96153,
-    96157,
-    96161,
-    96165,
-    96169,
-    96173,
-    96177,
-    96181,
-    96185,
-    96189,
-    96193,
     96197,
-    96202,
-    96206,
-    96210,
-    96214,
-    96218,
-    96222,
-    96226,
-    96230,
-    96234,
-    96238,
-    96242,
-    96246,
-    96250,
-    96254,
-    96259,
     96263,
-    96267,
-    96271,
-    96275,
-    96279,
-    96283,
-    96287,
-    96291,
-    96295,
-    96299,
-    96303,
-    96307,
-    96311,
-    96316,
-    96320,
-    96324,
     96328,
-    96332,
-    96336,
-    96340,
-    96344,
-    96348,
-    96352,
-    96356,
-    96360,
-    96364,
-    96369,
-    96373,
-    96377,
-    96381,
-    96385,
-    96389,
     96393,
-    96397,
-    96401,
-    96405,
-    96409,
-    96413,
-    96417,
-    96422,
-    96426,
-    96430,
-    96434,
-    96438,
-    96442,
-    96446,
-    96450,
-    96454,
     96458,
-    96462,
-    96466,
-    96471,
-    96475,
-    96479,
-    96483,
-    96487,
-    96491,
-    96495,
-    96499,
-    96503,
-    96507,
-    96511,
-    96515,
-    96519,
     96524,
-    96528,
-    96532,
-    96536,
-    96540,
-    96544,
-    96548,
-    96552,
-    96556,
-    96560,
-    96564,
-    96569,
-    96573,
-    96577,
-    96581,
-    96585,
     96589,
-    96593,
-    96597,
-    96601,
-    96605,
-    96609,
-    96613,
-    96618,
-    96622,
-    96626,
-    96630,
-    96634,
-    96638,
-    96642,
-    96646,
-    96650,
     96654,
-    96658,
-    96663,
-    96667,
-    96671,
-    96675,
-    96679,
-    96683,
-    96687,
-    96691,
-    96695,
-    96699,
-    96703,
-    96708,
-    96712,
-    96716,
     96720,
-    96724,
-    96728,
-    96732,
-    96736,
-    96740,
-    96744,
-    96748,
-    96753,
-    96757,
-    96761,
-    96765,
-    96769,
-    96773,
-    96777,
-    96781,
     96785,
-    96789,
-    96793,
-    96798,
-    96802,
-    96806,
-    96810,
-    96814,
-    96818,
-    96822,
-    96826,
-    96830,
-    96834,
-    96839,
-    96843,
-    96847,
     96851,
-    96855,
-    96859,
-    96863,
-    96867,
-    96871,
-    96875,
-    96880,
-    96884,
-    96888,
-    96892,
-    96896,
-    96900,
-    96904,
-    96908,
-    96912,
     96916,
-    96920,
-    96925,
-    96929,
-    96933,
-    96937,
-    96941,
-    96945,
-    96949,
-    96953,
-    96957,
-    96962,
-    96966,
-    96970,
-    96974,
-    96978,
     96982,
-    96986,
-    96990,
-    96994,
-    96998,
-    97003,
-    97007,
-    97011,
-    97015,
-    97019,
-    97023,
-    97027,
-    97031,
-    97035,
-    97039,
-    97044,
     97048,
-    97052,
-    97056,
-    97060,
-    97064,
-    97068,
-    97072,
-    97076,
-    97081,
-    97085,
-    97089,
-    97093,
-    97097,
-    97101,
-    97105,
-    97109,
     97113,
-    97118,
-    97122,
-    97126,
-    97130,
-    97134,
-    97138,
-    97142,
-    97146,
-    97150,
-    97154,
-    97159,
-    97163,
-    97167,
-    97171,
-    97175,
     97179,
-    97183,
-    97187,
-    97191,
-    97196,
-    97200,
-    97204,
-    97208,
-    97212,
-    97216,
-    97220,
-    97224,
-    97229,
-    97233,
-    97237,
-    97241,
     97245,
-    97249,
-    97253,
-    97257,
-    97261,
-    97266,
-    97270,
-    97274,
-    97278,
-    97282,
-    97286,
-    97290,
-    97294,
-    97298,
-    97303,
-    97307,
     97311,
-    97315,
-    97319,
-    97323,
-    97327,
-    97331,
-    97336,
-    97340,
-    97344,
-    97348,
-    97352,
-    97356,
-    97360,
-    97364,
-    97368,
-    97373,
     97377,
-    97381,
-    97385,
-    97389,
-    97393,
-    97397,
-    97401,
-    97406,
-    97410,
-    97414,
-    97418,
-    97422,
-    97426,
-    97430,
-    97434,
-    97439,
     97443,
-    97447,
-    97451,
-    97455,
-    97459,
-    97463,
-    97467,
-    97472,
-    97476,
-    97480,
-    97484,
-    97488,
-    97492,
-    97496,
-    97500,
-    97504,
     97509,
-    97513,
-    97517,
-    97521,
-    97525,
-    97529,
-    97533,
-    97538,
-    97542,
-    97546,
-    97550,
-    97554,
-    97558,
-    97562,
-    97566,
-    97571,
     97575,
-    97579,
-    97583,
-    97587,
-    97591,
-    97595,
-    97599,
-    97604,
-    97608,
-    97612,
-    97616,
-    97620,
-    97624,
-    97628,
-    97632,
-    97637,
     97641,
-    97645,
-    97649,
-    97653,
-    97657,
-    97661,
-    97666,
-    97670,
-    97674,
-    97678,
-    97682,
-    97686,
-    97690,
-    97694,
-    97699,
-    97703,
     97707,
-    97711,
-    97715,
-    97719,
-    97723,
-    97728,
-    97732,
-    97736,
-    97740,
-    97744,
-    97748,
-    97752,
-    97756,
-    97761,
-    97765,
-    97769,
     97773,
-    97777,
-    97781,
-    97785,
-    97790,
-    97794,
-    97798,
-    97802,
-    97806,
-    97810,
-    97814,
-    97819,
-    97823,
-    97827,
-    97831,
-    97835,
     97839,
-    97843,
-    97847,
-    97852,
-    97856,
-    97860,
-    97864,
-    97868,
-    97872,
-    97876,
-    97881,
-    97885,
-    97889,
-    97893,
-    97897,
-    97901,
     97905,
-    97910,
-    97914,
-    97918,
-    97922,
-    97926,
-    97930,
-    97934,
-    97939,
-    97943,
-    97947,
-    97951,
-    97955,
-    97959,
-    97963,
-    97968,
     97972,
-    97976,
-    97980,
-    97984,
-    97988,
-    97992,
-    97997,
-    98001,
-    98005,
-    98009,
-    98013,
-    98017,
-    98021,
-    98026,
-    98030,
-    98034,
     98038,
-    98042,
-    98046,
-    98051,
-    98055,
-    98059,
-    98063,
-    98067,
-    98071,
-    98075,
-    98080,
-    98084,
-    98088,
-    98092,
-    98096,
-    98100,
     98104,
-    98109,
-    98113,
-    98117,
-    98121,
-    98125,
-    98129,
-    98134,
-    98138,
-    98142,
-    98146,
-    98150,
-    98154,
-    98158,
-    98163,
-    98167,
     98171,
-    98175,
-    98179,
-    98183,
-    98188,
-    98192,
-    98196,
-    98200,
-    98204,
-    98208,
-    98212,
-    98217,
-    98221,
-    98225,
-    98229,
-    98233,
     98237,
-    98242,
-    98246,
-    98250,
-    98254,
-    98258,
-    98262,
-    98266,
-    98271,
-    98275,
-    98279,
-    98283,
-    98287,
-    98291,
-    98296,
-    98300,
     98304,
-    98308,
-    98312,
-    98316,
-    98321,
-    98325,
-    98329,
-    98333,
-    98337,
-    98341,
-    98345,
-    98350,
-    98354,
-    98358,
-    98362,
-    98366,
     98370,
-    98375,
-    98379,
-    98383,
-    98387,
-    98391,
-    98395,
-    98400,
-    98404,
-    98408,
-    98412,
-    98416,
-    98420,
-    98425,
-    98429,
-    98433,
     98437,
-    98441,
-    98445,
-    98450,
-    98454,
-    98458,
-    98462,
-    98466,
-    98470,
-    98475,
-    98479,
-    98483,
-    98487,
-    98491,
-    98495,
-    98500,
     98504,
-    98508,
-    98512,
-    98516,
-    98520,
-    98525,
-    98529,
-    98533,
-    98537,
-    98541,
-    98545,
-    98550,
-    98554,
-    98558,
-    98562,
-    98566,
     98570,
-    98575,
-    98579,
-    98583,
-    98587,
-    98591,
-    98595,
-    98600,
-    98604,
-    98608,
-    98612,
-    98616,
-    98620,
-    98625,
-    98629,
-    98633,
     98637,
-    98641,
-    98646,
-    98650,
-    98654,
-    98658,
-    98662,
-    98666,
-    98671,
-    98675,
-    98679,
-    98683,
-    98687,
-    98691,
-    98696,
-    98700,
     98704,
-    98708,
-    98712,
-    98716,
-    98721,
-    98725,
-    98729,
-    98733,
-    98737,
-    98742,
-    98746,
-    98750,
-    98754,
-    98758,
-    98762,
-    98767,
     98771,
-    98775,
-    98779,
-    98783,
-    98788,
-    98792,
-    98796,
-    98800,
-    98804,
-    98808,
-    98813,
-    98817,
-    98821,
-    98825,
-    98829,
-    98833,
     98838,
-    98842,
-    98846,
-    98850,
-    98854,
-    98859,
-    98863,
-    98867,
-    98871,
-    98875,
-    98879,
-    98884,
-    98888,
-    98892,
-    98896,
-    98900,
     98905,
-    98909,
-    98913,
-    98917,
-    98921,
-    98926,
-    98930,
-    98934,
-    98938,
-    98942,
-    98946,
-    98951,
-    98955,
-    98959,
-    98963,
-    98967,
     98972,
-    98976,
-    98980,
-    98984,
-    98988,
-    98993,
-    98997,
-    99001,
-    99005,
-    99009,
-    99013,
-    99018,
-    99022,
-    99026,
-    99030,
-    99034,
     99039,
-    99043,
-    99047,
-    99051,
-    99055,
-    99060,
-    99064,
-    99068,
-    99072,
-    99076,
-    99080,
-    99085,
-    99089,
-    99093,
-    99097,
-    99101,
     99106,
-    99110,
-    99114,
-    99118,
-    99122,
-    99127,
-    99131,
-    99135,
-    99139,
-    99143,
-    99148,
-    99152,
-    99156,
-    99160,
-    99164,
-    99169,
     99173,
-    99177,
-    99181,
-    99185,
-    99190,
-    99194,
-    99198,
-    99202,
-    99206,
-    99211,
-    99215,
-    99219,
-    99223,
-    99227,
-    99232,
-    99236,
     99240,
-    99244,
-    99248,
-    99253,
-    99257,
-    99261,
-    99265,
-    99269,
-    99274,
-    99278,
-    99282,
-    99286,
-    99290,
-    99295,
-    99299,
-    99303,
     99307,
-    99311,
-    99316,
-    99320,
-    99324,
-    99328,
-    99332,
-    99337,
-    99341,
-    99345,
-    99349,
-    99353,
-    99358,
-    99362,
-    99366,
-    99370,
     99374,
-    99379,
-    99383,
-    99387,
-    99391,
-    99395,
-    99400,
-    99404,
-    99408,
-    99412,
-    99416,
-    99421,
-    99425,
-    99429,
-    99433,
-    99437,
     99442,
-    99446,
-    99450,
-    99454,
-    99458,
-    99463,
-    99467,
-    99471,
-    99475,
-    99480,
-    99484,
-    99488,
-    99492,
-    99496,
-    99501,
-    99505,
     99509,
-    99513,
-    99517,
-    99522,
-    99526,
-    99530,
-    99534,
-    99538,
-    99543,
-    99547,
-    99551,
-    99555,
-    99560,
-    99564,
-    99568,
-    99572,
     99576,
-    99581,
-    99585,
-    99589,
-    99593,
-    99597,
-    99602,
-    99606,
-    99610,
-    99614,
-    99618,
-    99623,
-    99627,
-    99631,
-    99635,
-    99640,
     99644,
-    99648,
-    99652,
-    99656,
-    99661,
-    99665,
-    99669,
-    99673,
-    99678,
-    99682,
-    99686,
-    99690,
-    99694,
-    99699,
-    99703,
-    99707,
     99711,
-    99715,
-    99720,
-    99724,
-    99728,
-    99732,
-    99737,
-    99741,
-    99745,
-    99749,
-    99753,
-    99758,
-    99762,
-    99766,
-    99770,
-    99775,
     99779,
-    99783,
-    99787,
-    99791,
-    99796,
-    99800,
-    99804,
-    99808,
-    99813,
-    99817,
-    99821,
-    99825,
-    99829,
-    99834,
-    99838,
-    99842,
     99846,
-    99851,
-    99855,
-    99859,
-    99863,
-    99867,
-    99872,
-    99876,
-    99880,
-    99884,
-    99889,
-    99893,
-    99897,
-    99901,
-    99905,
-    99910,
     99914,
-    99918,
-    99922,
-    99927,
-    99931,
-    99935,
-    99939,
-    99944,
-    99948,
-    99952,
-    99956,
-    99960,
-    99965,
-    99969,
-    99973,
-    99977,
     99982,
-    99986,
-    99990,
-    99994,
-    99999,
-    100003,
-    100007,
-    100011,
-    100015,
-    100020,
-    100024,
-    100028,
-    100032,
-    100037,
-    100041,
-    100045,
     100049,
-    100054,
-    100058,
-    100062,
-    100066,
-    100070,
-    100075,
-    100079,
-    100083,
-    100087,
-    100092,
-    100096,
-    100100,
-    100104,
-    100109,
-    100113,
     100117,
-    100121,
-    100126,
-    100130,
-    100134,
-    100138,
-    100142,
-    100147,
-    100151,
-    100155,
-    100159,
-    100164,
-    100168,
-    100172,
-    100176,
-    100181,
     100185,
-    100189,
-    100193,
-    100198,
-    100202,
-    100206,
-    100210,
-    100215,
-    100219,
-    100223,
-    100227,
-    100231,
-    100236,
-    100240,
-    100244,
-    100248,
     100253,
-    100257,
-    100261,
-    100265,
-    100270,
-    100274,
-    100278,
-    100282,
-    100287,
-    100291,
-    100295,
-    100299,
-    100304,
-    100308,
-    100312,
-    100316,
     100321,
-    100325,
-    100329,
-    100333,
-    100338,
-    100342,
-    100346,
-    100350,
-    100355,
-    100359,
-    100363,
-    100367,
-    100372,
-    100376,
-    100380,
-    100384,
     100388,
-    100393,
-    100397,
-    100401,
-    100405,
-    100410,
-    100414,
-    100418,
-    100422,
-    100427,
-    100431,
-    100435,
-    100439,
-    100444,
-    100448,
-    100452,
     100456,
-    100461,
-    100465,
-    100469,
-    100473,
-    100478,
-    100482,
-    100486,
-    100490,
-    100495,
-    100499,
-    100503,
-    100507,
-    100512,
-    100516,
-    100520,
     100524,
-    100529,
-    100533,
-    100537,
-    100542,
-    100546,
-    100550,
-    100554,
-    100559,
-    100563,
-    100567,
-    100571,
-    100576,
-    100580,
-    100584,
-    100588,
     100593,
-    100597,
-    100601,
-    100605,
-    100610,
-    100614,
-    100618,
-    100622,
-    100627,
-    100631,
-    100635,
-    100639,
-    100644,
-    100648,
-    100652,
-    100656,
     100661,
-    100665,
-    100669,
-    100673,
-    100678,
-    100682,
-    100686,
-    100690,
-    100695,
-    100699,
-    100703,
-    100708,
-    100712,
-    100716,
-    100720,
-    100725,
     100729,
-    100733,
-    100737,
-    100742,
-    100746,
-    100750,
-    100754,
-    100759,
-    100763,
-    100767,
-    100771,
-    100776,
-    100780,
-    100784,
-    100789,
-    100793,
     100797,
-    100801,
-    100806,
-    100810,
-    100814,
-    100818,
-    100823,
-    100827,
-    100831,
-    100835,
-    100840,
-    100844,
-    100848,
-    100852,
-    100857,
-    100861,
     100865,
-    100870,
-    100874,
-    100878,
-    100882,
-    100887,
-    100891,
-    100895,
-    100899,
-    100904,
-    100908,
-    100912,
-    100917,
-    100921,
-    100925,
-    100929,
     100934,
-    100938,
-    100942,
-    100946,
-    100951,
-    100955,
-    100959,
-    100963,
-    100968,
-    100972,
-    100976,
-    100981,
-    100985,
-    100989,
-    100993,
-    100998,
     101002,
-    101006,
-    101010,
-    101015,
-    101019,
-    101023,
-    101028,
-    101032,
-    101036,
-    101040,
-    101045,
-    101049,
-    101053,
-    101058,
-    101062,
-    101066,
     101070,
-    101075,
-    101079,
-    101083,
-    101087,
-    101092,
-    101096,
-    101100,
-    101105,
-    101109,
-    101113,
-    101117,
-    101122,
-    101126,
-    101130,
-    101134,
     101139,
-    101143,
-    101147,
-    101152,
-    101156,
-    101160,
-    101164,
-    101169,
-    101173,
-    101177,
-    101182,
-    101186,
-    101190,
-    101194,
-    101199,
-    101203,
     101207,
-    101212,
-    101216,
-    101220,
-    101224,
-    101229,
-    101233,
-    101237,
-    101242,
-    101246,
-    101250,
-    101254,
-    101259,
-    101263,
-    101267,
-    101271,
     101276,
-    101280,
-    101284,
-    101289,
-    101293,
-    101297,
-    101301,
-    101306,
-    101310,
-    101314,
-    101319,
-    101323,
-    101327,
-    101331,
-    101336,
-    101340,
     101344,
-    101349,
-    101353,
-    101357,
-    101362,
-    101366,
-    101370,
-    101374,
-    101379,
-    101383,
-    101387,
-    101392,
-    101396,
-    101400,
-    101404,
-    101409,
     101413,
-    101417,
-    101422,
-    101426,
-    101430,
-    101434,
-    101439,
-    101443,
-    101447,
-    101452,
-    101456,
-    101460,
-    101464,
-    101469,
-    101473,
-    101477,
     101482,
-    101486,
-    101490,
-    101495,
-    101499,
-    101503,
-    101507,
-    101512,
-    101516,
-    101520,
-    101525,
-    101529,
-    101533,
-    101537,
-    101542,
-    101546,
     101550,
-    101555,
-    101559,
-    101563,
-    101568,
-    101572,
-    101576,
-    101580,
-    101585,
-    101589,
-    101593,
-    101598,
-    101602,
-    101606,
-    101611,
-    101615,
     101619,
-    101623,
-    101628,
-    101632,
-    101636,
-    101641,
-    101645,
-    101649,
-    101654,
-    101658,
-    101662,
-    101666,
-    101671,
-    101675,
-    101679,
-    101684,
     101688,
-    101692,
-    101697,
-    101701,
-    101705,
-    101709,
-    101714,
-    101718,
-    101722,
-    101727,
-    101731,
-    101735,
-    101740,
-    101744,
-    101748,
-    101752,
     101757,
-    101761,
-    101765,
-    101770,
-    101774,
-    101778,
-    101783,
-    101787,
-    101791,
-    101796,
-    101800,
-    101804,
-    101808,
-    101813,
-    101817,
-    101821,
     101826,
-    101830,
-    101834,
-    101839,
-    101843,
-    101847,
-    101852,
-    101856,
-    101860,
-    101864,
-    101869,
-    101873,
-    101877,
-    101882,
-    101886,
-    101890,
     101895,
-    101899,
-    101903,
-    101908,
-    101912,
-    101916,
-    101921,
-    101925,
-    101929,
-    101933,
-    101938,
-    101942,
-    101946,
-    101951,
-    101955,
-    101959,
     101964,
-    101968,
-    101972,
-    101977,
-    101981,
-    101985,
-    101990,
-    101994,
-    101998,
-    102002,
-    102007,
-    102011,
-    102015,
-    102020,
-    102024,
-    102028,
     102033,
-    102037,
-    102041,
-    102046,
-    102050,
-    102054,
-    102059,
-    102063,
-    102067,
-    102072,
-    102076,
-    102080,
-    102084,
-    102089,
-    102093,
-    102097,
     102102,
-    102106,
-    102110,
-    102115,
-    102119,
-    102123,
-    102128,
-    102132,
-    102136,
-    102141,
-    102145,
-    102149,
-    102154,
-    102158,
-    102162,
-    102167,
     102171,
-    102175,
-    102180,
-    102184,
-    102188,
-    102193,
-    102197,
-    102201,
-    102205,
-    102210,
-    102214,
-    102218,
-    102223,
-    102227,
-    102231,
-    102236,
     102240,
-    102244,
-    102249,
-    102253,
-    102257,
-    102262,
-    102266,
-    102270,
-    102275,
-    102279,
-    102283,
-    102288,
-    102292,
-    102296,
-    102301,
-    102305,
     102309,
-    102314,
-    102318,
-    102322,
-    102327,
-    102331,
-    102335,
-    102340,
-    102344,
-    102348,
-    102353,
-    102357,
-    102361,
-    102366,
-    102370,
-    102374,
     102379,
-    102383,
-    102387,
-    102392,
-    102396,
-    102400,
-    102405,
-    102409,
-    102413,
-    102418,
-    102422,
-    102426,
-    102431,
-    102435,
-    102439,
-    102444,
     102448,
-    102452,
-    102457,
-    102461,
-    102465,
-    102470,
-    102474,
-    102478,
-    102483,
-    102487,
-    102491,
-    102496,
-    102500,
-    102504,
-    102509,
-    102513,
     102517,
-    102522,
-    102526,
-    102530,
-    102535,
-    102539,
-    102543,
-    102548,
-    102552,
-    102556,
-    102561,
-    102565,
-    102569,
-    102574,
-    102578,
-    102582,
     102587,
-    102591,
-    102595,
-    102600,
-    102604,
-    102608,
-    102613,
-    102617,
-    102621,
-    102626,
-    102630,
-    102634,
-    102639,
-    102643,
-    102647,
-    102652,
     102656,
-    102661,
-    102665,
-    102669,
-    102674,
-    102678,
-    102682,
-    102687,
-    102691,
-    102695,
-    102700,
-    102704,
-    102708,
-    102713,
-    102717,
-    102721,
     102726,
-    102730,
-    102734,
-    102739,
-    102743,
-    102747,
-    102752,
-    102756,
-    102760,
-    102765,
-    102769,
-    102774,
-    102778,
-    102782,
-    102787,
-    102791,
     102795,
-    102800,
-    102804,
-    102808,
-    102813,
-    102817,
-    102821,
-    102826,
-    102830,
-    102834,
-    102839,
-    102843,
-    102847,
-    102852,
-    102856,
-    102861,
     102865,
-    102869,
-    102874,
-    102878,
-    102882,
-    102887,
-    102891,
-    102895,
-    102900,
-    102904,
-    102908,
-    102913,
-    102917,
-    102921,
-    102926,
-    102930,
     102935,
-    102939,
-    102943,
-    102948,
-    102952,
-    102956,
-    102961,
-    102965,
-    102969,
-    102974,
-    102978,
-    102982,
-    102987,
-    102991,
-    102995,
-    103000,
     103004,
-    103009,
-    103013,
-    103017,
-    103022,
-    103026,
-    103030,
-    103035,
-    103039,
-    103043,
-    103048,
-    103052,
-    103057,
-    103061,
-    103065,
-    103070,
     103074,
-    103078,
-    103083,
-    103087,
-    103091,
-    103096,
-    103100,
-    103104,
-    103109,
-    103113,
-    103118,
-    103122,
-    103126,
-    103131,
-    103135,
-    103139,
     103144,
-    103148,
-    103152,
-    103157,
-    103161,
-    103166,
-    103170,
-    103174,
-    103179,
-    103183,
-    103187,
-    103192,
-    103196,
-    103200,
-    103205,
-    103209,
     103214,
-    103218,
-    103222,
-    103227,
-    103231,
-    103235,
-    103240,
-    103244,
-    103249,
-    103253,
-    103257,
-    103262,
-    103266,
-    103270,
-    103275,
-    103279,
     103283,
-    103288,
-    103292,
-    103297,
-    103301,
-    103305,
-    103310,
-    103314,
-    103318,
-    103323,
-    103327,
-    103332,
-    103336,
-    103340,
-    103345,
-    103349,
     103353,
-    103358,
-    103362,
-    103367,
-    103371,
-    103375,
-    103380,
-    103384,
-    103388,
-    103393,
-    103397,
-    103402,
-    103406,
-    103410,
-    103415,
-    103419,
     103423,
-    103428,
-    103432,
-    103437,
-    103441,
-    103445,
-    103450,
-    103454,
-    103458,
-    103463,
-    103467,
-    103472,
-    103476,
-    103480,
-    103485,
-    103489,
     103493,
-    103498,
-    103502,
-    103507,
-    103511,
-    103515,
-    103520,
-    103524,
-    103528,
-    103533,
-    103537,
-    103542,
-    103546,
-    103550,
-    103555,
-    103559,
     103564,
-    103568,
-    103572,
-    103577,
-    103581,
-    103585,
-    103590,
-    103594,
-    103599,
-    103603,
-    103607,
-    103612,
-    103616,
-    103620,
-    103625,
-    103629,
     103634,
-    103638,
-    103642,
-    103647,
-    103651,
-    103656,
-    103660,
-    103664,
-    103669,
-    103673,
-    103677,
-    103682,
-    103686,
-    103691,
-    103695,
-    103699,
     103704,
-    103708,
-    103713,
-    103717,
-    103721,
-    103726,
-    103730,
-    103735,
-    103739,
-    103743,
-    103748,
-    103752,
-    103756,
-    103761,
-    103765,
-    103770,
     103774,
-    103778,
-    103783,
-    103787,
-    103792,
-    103796,
-    103800,
-    103805,
-    103809,
-    103814,
-    103818,
-    103822,
-    103827,
-    103831,
-    103836,
-    103840,
     103844,
-    103849,
-    103853,
-    103857,
-    103862,
-    103866,
-    103871,
-    103875,
-    103879,
-    103884,
-    103888,
-    103893,
-    103897,
-    103901,
-    103906,
-    103910,
     103915,
-    103919,
-    103923,
-    103928,
-    103932,
-    103937,
-    103941,
-    103945,
-    103950,
-    103954,
-    103959,
-    103963,
-    103967,
-    103972,
-    103976,
-    103981,
     103985,
-    103989,
-    103994,
-    103998,
-    104003,
-    104007,
-    104011,
-    104016,
-    104020,
-    104025,
-    104029,
-    104033,
-    104038,
-    104042,
-    104047,
-    104051,
     104055,
-    104060,
-    104064,
-    104069,
-    104073,
-    104077,
-    104082,
-    104086,
-    104091,
-    104095,
-    104099,
-    104104,
-    104108,
-    104113,
-    104117,
-    104121,
     104126,
-    104130,
-    104135,
-    104139,
-    104143,
-    104148,
-    104152,
-    104157,
-    104161,
-    104166,
-    104170,
-    104174,
-    104179,
-    104183,
-    104188,
-    104192,
     104196,
-    104201,
-    104205,
-    104210,
-    104214,
-    104218,
-    104223,
-    104227,
-    104232,
-    104236,
-    104240,
-    104245,
-    104249,
-    104254,
-    104258,
-    104263,
     104267,
-    104271,
-    104276,
-    104280,
-    104285,
-    104289,
-    104293,
-    104298,
-    104302,
-    104307,
-    104311,
-    104315,
-    104320,
-    104324,
-    104329,
-    104333,
     104338,
-    104342,
-    104346,
-    104351,
-    104355,
-    104360,
-    104364,
-    104368,
-    104373,
-    104377,
-    104382,
-    104386,
-    104390,
-    104395,
-    104399,
-    104404,
     104408,
-    104413,
-    104417,
-    104421,
-    104426,
-    104430,
-    104435,
-    104439,
-    104444,
-    104448,
-    104452,
-    104457,
-    104461,
-    104466,
-    104470,
-    104474,
     104479,
-    104483,
-    104488,
-    104492,
-    104497,
-    104501,
-    104505,
-    104510,
-    104514,
-    104519,
-    104523,
-    104527,
-    104532,
-    104536,
-    104541,
-    104545,
     104550,
-    104554,
-    104558,
-    104563,
-    104567,
-    104572,
-    104576,
-    104581,
-    104585,
-    104589,
-    104594,
-    104598,
-    104603,
-    104607,
-    104612,
-    104616,
     104620,
-    104625,
-    104629,
-    104634,
-    104638,
-    104643,
-    104647,
-    104651,
-    104656,
-    104660,
-    104665,
-    104669,
-    104674,
-    104678,
-    104682,
-    104687,
     104691,
-    104696,
-    104700,
-    104705,
-    104709,
-    104713,
-    104718,
-    104722,
-    104727,
-    104731,
-    104736,
-    104740,
-    104744,
-    104749,
-    104753,
-    104758,
     104762,
-    104767,
-    104771,
-    104775,
-    104780,
-    104784,
-    104789,
-    104793,
-    104798,
-    104802,
-    104806,
-    104811,
-    104815,
-    104820,
-    104824,
-    104829,
     104833,
-    104838,
-    104842,
-    104846,
-    104851,
-    104855,
-    104860,
-    104864,
-    104869,
-    104873,
-    104877,
-    104882,
-    104886,
-    104891,
-    104895,
-    104900,
     104904,
-    104908,
-    104913,
-    104917,
-    104922,
-    104926,
-    104931,
-    104935,
-    104940,
-    104944,
-    104948,
-    104953,
-    104957,
-    104962,
-    104966,
-    104971,
     104975,
-    104980,
-    104984,
-    104988,
-    104993,
-    104997,
-    105002,
-    105006,
-    105011,
-    105015,
-    105020,
-    105024,
-    105028,
-    105033,
-    105037,
-    105042,
     105046,
-    105051,
-    105055,
-    105060,
-    105064,
-    105068,
-    105073,
-    105077,
-    105082,
-    105086,
-    105091,
-    105095,
-    105100,
-    105104,
-    105108,
-    105113,
     105117,
-    105122,
-    105126,
-    105131,
-    105135,
-    105140,
-    105144,
-    105148,
-    105153,
-    105157,
-    105162,
-    105166,
-    105171,
-    105175,
-    105180,
-    105184,
     105188,
-    105193,
-    105197,
-    105202,
-    105206,
-    105211,
-    105215,
-    105220,
-    105224,
-    105229,
-    105233,
-    105237,
-    105242,
-    105246,
-    105251,
-    105255,
     105260,
-    105264,
-    105269,
-    105273,
-    105278,
-    105282,
-    105286,
-    105291,
-    105295,
-    105300,
-    105304,
-    105309,
-    105313,
-    105318,
-    105322,
-    105327,
     105331,
-    105335,
-    105340,
-    105344,
-    105349,
-    105353,
-    105358,
-    105362,
-    105367,
-    105371,
-    105376,
-    105380,
-    105384,
-    105389,
-    105393,
-    105398,
     105402,
-    105407,
-    105411,
-    105416,
-    105420,
-    105425,
-    105429,
-    105434,
-    105438,
-    105442,
-    105447,
-    105451,
-    105456,
-    105460,
-    105465,
-    105469,
     105474,
-    105478,
-    105483,
-    105487,
-    105492,
-    105496,
-    105500,
-    105505,
-    105509,
-    105514,
-    105518,
-    105523,
-    105527,
-    105532,
-    105536,
-    105541,
     105545,
-    105550,
-    105554,
-    105558,
-    105563,
-    105567,
-    105572,
-    105576,
-    105581,
-    105585,
-    105590,
-    105594,
-    105599,
-    105603,
-    105608,
-    105612,
     105617,
-    105621,
-    105625,
-    105630,
-    105634,
-    105639,
-    105643,
-    105648,
-    105652,
-    105657,
-    105661,
-    105666,
-    105670,
-    105675,
-    105679,
-    105684,
     105688,
-    105693,
-    105697,
-    105701,
-    105706,
-    105710,
-    105715,
-    105719,
-    105724,
-    105728,
-    105733,
-    105737,
-    105742,
-    105746,
-    105751,
-    105755,
     105760,
-    105764,
-    105769,
-    105773,
-    105778,
-    105782,
-    105786,
-    105791,
-    105795,
-    105800,
-    105804,
-    105809,
-    105813,
-    105818,
-    105822,
-    105827,
     105831,
-    105836,
-    105840,
-    105845,
-    105849,
-    105854,
-    105858,
-    105863,
-    105867,
-    105872,
-    105876,
-    105881,
-    105885,
-    105889,
-    105894,
-    105898,
     105903,
-    105907,
-    105912,
-    105916,
-    105921,
-    105925,
-    105930,
-    105934,
-    105939,
-    105943,
-    105948,
-    105952,
-    105957,
-    105961,
-    105966,
-    105970,
     105975,
-    105979,
-    105984,
-    105988,
-    105993,
-    105997,
-    106002,
-    106006,
-    106011,
-    106015,
-    106019,
-    106024,
-    106028,
-    106033,
-    106037,
-    106042,
     106046,
-    106051,
-    106055,
-    106060,
-    106064,
-    106069,
-    106073,
-    106078,
-    106082,
-    106087,
-    106091,
-    106096,
-    106100,
-    106105,
-    106109,
-    106114,
     106118,
-    106123,
-    106127,
-    106132,
-    106136,
-    106141,
-    106145,
-    106150,
-    106154,
-    106159,
-    106163,
-    106168,
-    106172,
-    106177,
-    106181,
-    106186,
     106190,
-    106195,
-    106199,
-    106204,
-    106208,
-    106213,
-    106217,
-    106222,
-    106226,
-    106230,
-    106235,
-    106239,
-    106244,
-    106248,
-    106253,
-    106257,
     106262,
-    106266,
-    106271,
-    106275,
-    106280,
-    106284,
-    106289,
-    106293,
-    106298,
-    106302,
-    106307,
-    106311,
-    106316,
-    106320,
-    106325,
-    106329,
     106334,
-    106338,
-    106343,
-    106347,
-    106352,
-    106356,
-    106361,
-    106365,
-    106370,
-    106374,
-    106379,
-    106383,
-    106388,
-    106392,
-    106397,
-    106401,
     106406,
-    106410,
-    106415,
-    106419,
-    106424,
-    106428,
-    106433,
-    106437,
-    106442,
-    106446,
-    106451,
-    106455,
-    106460,
-    106464,
-    106469,
-    106473,
     106478,
-    106482,
-    106487,
-    106491,
-    106496,
-    106500,
-    106505,
-    106509,
-    106514,
-    106519,
-    106523,
-    106528,
-    106532,
-    106537,
-    106541,
-    106546,
     106550,
-    106555,
-    106559,
-    106564,
-    106568,
-    106573,
-    106577,
-    106582,
-    106586,
-    106591,
-    106595,
-    106600,
-    106604,
-    106609,
-    106613,
-    106618,
     106622,
-    106627,
-    106631,
-    106636,
-    106640,
-    106645,
-    106649,
-    106654,
-    106658,
-    106663,
-    106667,
-    106672,
-    106676,
-    106681,
-    106685,
-    106690,
     106694,
-    106699,
-    106703,
-    106708,
-    106712,
-    106717,
-    106721,
-    106726,
-    106731,
-    106735,
-    106740,
-    106744,
-    106749,
-    106753,
-    106758,
-    106762,
     106767,
-    106771,
-    106776,
-    106780,
-    106785,
-    106789,
-    106794,
-    106798,
-    106803,
-    106807,
-    106812,
-    106816,
-    106821,
-    106825,
-    106830,
-    106834,
     106839,
-    106843,
-    106848,
-    106853,
-    106857,
-    106862,
-    106866,
-    106871,
-    106875,
-    106880,
-    106884,
-    106889,
-    106893,
-    106898,
-    106902,
-    106907,
     106911,
-    106916,
-    106920,
-    106925,
-    106929,
-    106934,
-    106938,
-    106943,
-    106947,
-    106952,
-    106957,
-    106961,
-    106966,
-    106970,
-    106975,
-    106979,
     106984,
-    106988,
-    106993,
-    106997,
-    107002,
-    107006,
-    107011,
-    107015,
-    107020,
-    107024,
-    107029,
-    107033,
-    107038,
-    107043,
-    107047,
-    107052,
     107056,
-    107061,
-    107065,
-    107070,
-    107074,
-    107079,
-    107083,
-    107088,
-    107092,
-    107097,
-    107101,
-    107106,
-    107110,
-    107115,
-    107120,
-    107124,
     107129,
-    107133,
-    107138,
-    107142,
-    107147,
-    107151,
-    107156,
-    107160,
-    107165,
-    107169,
-    107174,
-    107178,
-    107183,
-    107188,
-    107192,
-    107197,
     107201,
-    107206,
-    107210,
-    107215,
-    107219,
-    107224,
-    107228,
-    107233,
-    107237,
-    107242,
-    107247,
-    107251,
-    107256,
-    107260,
-    107265,
-    107269,
     107274,
-    107278,
-    107283,
-    107287,
-    107292,
-    107296,
-    107301,
-    107306,
-    107310,
-    107315,
-    107319,
-    107324,
-    107328,
-    107333,
-    107337,
-    107342,
     107346,
-    107351,
-    107355,
-    107360,
-    107365,
-    107369,
-    107374,
-    107378,
-    107383,
-    107387,
-    107392,
-    107396,
-    107401,
-    107405,
-    107410,
-    107415,
     107419,
-    107424,
-    107428,
-    107433,
-    107437,
-    107442,
-    107446,
-    107451,
-    107455,
-    107460,
-    107465,
-    107469,
-    107474,
-    107478,
-    107483,
-    107487,
     107492,
-    107496,
-    107501,
-    107505,
-    107510,
-    107515,
-    107519,
-    107524,
-    107528,
-    107533,
-    107537,
-    107542,
-    107546,
-    107551,
-    107555,
-    107560,
     107565,
-    107569,
-    107574,
-    107578,
-    107583,
-    107587,
-    107592,
-    107596,
-    107601,
-    107606,
-    107610,
-    107615,
-    107619,
-    107624,
-    107628,
-    107633,
     107637,
-    107642,
-    107647,
-    107651,
-    107656,
-    107660,
-    107665,
-    107669,
-    107674,
-    107678,
-    107683,
-    107688,
-    107692,
-    107697,
-    107701,
-    107706,
     107710,
-    107715,
-    107719,
-    107724,
-    107729,
-    107733,
-    107738,
-    107742,
-    107747,
-    107751,
-    107756,
-    107760,
-    107765,
-    107770,
-    107774,
-    107779,
     107783,
-    107788,
-    107792,
-    107797,
-    107801,
-    107806,
-    107811,
-    107815,
-    107820,
-    107824,
-    107829,
-    107833,
-    107838,
-    107843,
-    107847,
-    107852,
     107856,
-    107861,
-    107865,
-    107870,
-    107874,
-    107879,
-    107884,
-    107888,
-    107893,
-    107897,
-    107902,
-    107906,
-    107911,
-    107916,
-    107920,
-    107925,
     107929,
-    107934,
-    107938,
-    107943,
-    107948,
-    107952,
-    107957,
-    107961,
-    107966,
-    107970,
-    107975,
-    107980,
-    107984,
-    107989,
-    107993,
-    107998,
     108002,
-    108007,
-    108011,
-    108016,
-    108021,
-    108025,
-    108030,
-    108034,
-    108039,
-    108043,
-    108048,
-    108053,
-    108057,
-    108062,
-    108066,
-    108071,
     108075,
-    108080,
-    108085,
-    108089,
-    108094,
-    108098,
-    108103,
-    108107,
-    108112,
-    108117,
-    108121,
-    108126,
-    108130,
-    108135,
-    108140,
-    108144,
     108149,
-    108153,
-    108158,
-    108162,
-    108167,
-    108172,
-    108176,
-    108181,
-    108185,
-    108190,
-    108194,
-    108199,
-    108204,
-    108208,
-    108213,
-    108217,
     108222,
-    108226,
-    108231,
-    108236,
-    108240,
-    108245,
-    108249,
-    108254,
-    108259,
-    108263,
-    108268,
-    108272,
-    108277,
-    108281,
-    108286,
-    108291,
     108295,
-    108300,
-    108304,
-    108309,
-    108313,
-    108318,
-    108323,
-    108327,
-    108332,
-    108336,
-    108341,
-    108346,
-    108350,
-    108355,
-    108359,
-    108364,
     108369,
-    108373,
-    108378,
-    108382,
-    108387,
-    108391,
-    108396,
-    108401,
-    108405,
-    108410,
-    108414,
-    108419,
-    108424,
-    108428,
-    108433,
-    108437,
     108442,
-    108446,
-    108451,
-    108456,
-    108460,
-    108465,
-    108469,
-    108474,
-    108479,
-    108483,
-    108488,
-    108492,
-    108497,
-    108502,
-    108506,
-    108511,
     108515,
-    108520,
-    108524,
-    108529,
-    108534,
-    108538,
-    108543,
-    108547,
-    108552,
-    108557,
-    108561,
-    108566,
-    108570,
-    108575,
-    108580,
-    108584,
     108589,
-    108593,
-    108598,
-    108603,
-    108607,
-    108612,
-    108616,
-    108621,
-    108626,
-    108630,
-    108635,
-    108639,
-    108644,
-    108649,
-    108653,
-    108658,
     108662,
-    108667,
-    108672,
-    108676,
-    108681,
-    108685,
-    108690,
-    108695,
-    108699,
-    108704,
-    108708,
-    108713,
-    108717,
-    108722,
-    108727,
-    108731,
     108736,
-    108740,
-    108745,
-    108750,
-    108754,
-    108759,
-    108764,
-    108768,
-    108773,
-    108777,
-    108782,
-    108787,
-    108791,
-    108796,
-    108800,
-    108805,
     108810,
-    108814,
-    108819,
-    108823,
-    108828,
-    108833,
-    108837,
-    108842,
-    108846,
-    108851,
-    108856,
-    108860,
-    108865,
-    108869,
-    108874,
-    108879,
     108883,
-    108888,
-    108892,
-    108897,
-    108902,
-    108906,
-    108911,
-    108915,
-    108920,
-    108925,
-    108929,
-    108934,
-    108938,
-    108943,
-    108948,
-    108952,
     108957,
-    108962,
-    108966,
-    108971,
-    108975,
-    108980,
-    108985,
-    108989,
-    108994,
-    108998,
-    109003,
-    109008,
-    109012,
-    109017,
-    109021,
-    109026,
     109031,
-    109035,
-    109040,
-    109045,
-    109049,
-    109054,
-    109058,
-    109063,
-    109068,
-    109072,
-    109077,
-    109081,
-    109086,
-    109091,
-    109095,
-    109100,
     109105,
-    109109,
-    109114,
-    109118,
-    109123,
-    109128,
-    109132,
-    109137,
-    109141,
-    109146,
-    109151,
-    109155,
-    109160,
-    109165,
-    109169,
-    109174,
     109178,
-    109183,
-    109188,
-    109192,
-    109197,
-    109202,
-    109206,
-    109211,
-    109215,
-    109220,
-    109225,
-    109229,
-    109234,
-    109238,
-    109243,
-    109248,
     109252,
-    109257,
-    109262,
-    109266,
-    109271,
-    109275,
-    109280,
-    109285,
-    109289,
-    109294,
-    109299,
-    109303,
-    109308,
-    109312,
-    109317,
-    109322,
     109326,
-    109331,
-    109336,
-    109340,
-    109345,
-    109349,
-    109354,
-    109359,
-    109363,
-    109368,
-    109373,
-    109377,
-    109382,
-    109386,
-    109391,
-    109396,
     109400,
-    109405,
-    109410,
-    109414,
-    109419,
-    109423,
-    109428,
-    109433,
-    109437,
-    109442,
-    109447,
-    109451,
-    109456,
-    109461,
-    109465,
-    109470,
     109474,
-    109479,
-    109484,
-    109488,
-    109493,
-    109498,
-    109502,
-    109507,
-    109511,
-    109516,
-    109521,
-    109525,
-    109530,
-    109535,
-    109539,
-    109544,
     109549,
-    109553,
-    109558,
-    109562,
-    109567,
-    109572,
-    109576,
-    109581,
-    109586,
-    109590,
-    109595,
-    109600,
-    109604,
-    109609,
-    109613,
-    109618,
     109623,
-    109627,
-    109632,
-    109637,
-    109641,
-    109646,
-    109651,
-    109655,
-    109660,
-    109664,
-    109669,
-    109674,
-    109678,
-    109683,
-    109688,
-    109692,
     109697,
-    109702,
-    109706,
-    109711,
-    109716,
-    109720,
-    109725,
-    109729,
-    109734,
-    109739,
-    109743,
-    109748,
-    109753,
-    109757,
-    109762,
-    109767,
     109771,
-    109776,
-    109781,
-    109785,
-    109790,
-    109794,
-    109799,
-    109804,
-    109808,
-    109813,
-    109818,
-    109822,
-    109827,
-    109832,
-    109836,
-    109841,
     109846,
-    109850,
-    109855,
-    109860,
-    109864,
-    109869,
-    109873,
-    109878,
-    109883,
-    109887,
-    109892,
-    109897,
-    109901,
-    109906,
-    109911,
-    109915,
     109920,
-    109925,
-    109929,
-    109934,
-    109939,
-    109943,
-    109948,
-    109953,
-    109957,
-    109962,
-    109966,
-    109971,
-    109976,
-    109980,
-    109985,
-    109990,
     109994,
-    109999,
-    110004,
-    110008,
-    110013,
-    110018,
-    110022,
-    110027,
-    110032,
-    110036,
-    110041,
-    110046,
-    110050,
-    110055,
-    110060,
-    110064,
     110069,
-    110074,
-    110078,
-    110083,
-    110087,
-    110092,
-    110097,
-    110101,
-    110106,
-    110111,
-    110115,
-    110120,
-    110125,
-    110129,
-    110134,
-    110139,
     110143,
-    110148,
-    110153,
-    110157,
-    110162,
-    110167,
-    110171,
-    110176,
-    110181,
-    110185,
-    110190,
-    110195,
-    110199,
-    110204,
-    110209,
-    110213,
     110218,
-    110223,
-    110227,
-    110232,
-    110237,
-    110241,
-    110246,
-    110251,
-    110255,
-    110260,
-    110265,
-    110269,
-    110274,
-    110279,
-    110283,
-    110288,
     110293,
-    110297,
-    110302,
-    110307,
-    110311,
-    110316,
-    110321,
-    110325,
-    110330,
-    110335,
-    110339,
-    110344,
-    110349,
-    110353,
-    110358,
-    110363,
     110367,
-    110372,
-    110377,
-    110381,
-    110386,
-    110391,
-    110395,
-    110400,
-    110405,
-    110409,
-    110414,
-    110419,
-    110423,
-    110428,
-    110433,
-    110437,
     110442,
-    110447,
-    110451,
-    110456,
-    110461,
-    110465,
-    110470,
-    110475,
-    110479,
-    110484,
-    110489,
-    110493,
-    110498,
-    110503,
-    110507,
-    110512,
     110517,
-    110521,
-    110526,
-    110531,
-    110536,
-    110540,
-    110545,
-    110550,
-    110554,
-    110559,
-    110564,
-    110568,
-    110573,
-    110578,
-    110582,
-    110587,
     110592,
-    110596,
-    110601,
-    110606,
-    110610,
-    110615,
-    110620,
-    110624,
-    110629,
-    110634,
-    110638,
-    110643,
-    110648,
-    110652,
-    110657,
-    110662,
     110667,
-    110671,
-    110676,
-    110681,
-    110685,
-    110690,
-    110695,
-    110699,
-    110704,
-    110709,
-    110713,
-    110718,
-    110723,
-    110727,
-    110732,
-    110737,
     110741,
-    110746,
-    110751,
-    110756,
-    110760,
-    110765,
-    110770,
-    110774,
-    110779,
-    110784,
-    110788,
-    110793,
-    110798,
-    110802,
-    110807,
-    110812,
     110816,
-    110821,
-    110826,
-    110831,
-    110835,
-    110840,
-    110845,
-    110849,
-    110854,
-    110859,
-    110863,
-    110868,
-    110873,
-    110877,
-    110882,
-    110887,
     110891,
-    110896,
-    110901,
-    110906,
-    110910,
-    110915,
-    110920,
-    110924,
-    110929,
-    110934,
-    110938,
-    110943,
-    110948,
-    110952,
-    110957,
-    110962,
     110967,
-    110971,
-    110976,
-    110981,
-    110985,
-    110990,
-    110995,
-    110999,
-    111004,
-    111009,
-    111014,
-    111018,
-    111023,
-    111028,
-    111032,
-    111037,
     111042,
-    111046,
-    111051,
-    111056,
-    111061,
-    111065,
-    111070,
-    111075,
-    111079,
-    111084,
-    111089,
-    111093,
-    111098,
-    111103,
-    111108,
-    111112,
     111117,
-    111122,
-    111126,
-    111131,
-    111136,
-    111140,
-    111145,
-    111150,
-    111155,
-    111159,
-    111164,
-    111169,
-    111173,
-    111178,
-    111183,
-    111187,
     111192,
-    111197,
-    111202,
-    111206,
-    111211,
-    111216,
-    111220,
-    111225,
-    111230,
-    111234,
-    111239,
-    111244,
-    111249,
-    111253,
-    111258,
-    111263,
     111267,
-    111272,
-    111277,
-    111282,
-    111286,
-    111291,
-    111296,
-    111300,
-    111305,
-    111310,
-    111315,
-    111319,
-    111324,
-    111329,
-    111333,
-    111338,
     111343,
-    111347,
-    111352,
-    111357,
-    111362,
-    111366,
-    111371,
-    111376,
-    111380,
-    111385,
-    111390,
-    111395,
-    111399,
-    111404,
-    111409,
-    111413,
     111418,
-    111423,
-    111428,
-    111432,
-    111437,
-    111442,
-    111446,
-    111451,
-    111456,
-    111461,
-    111465,
-    111470,
-    111475,
-    111479,
-    111484,
-    111489,
     111494,
-    111498,
-    111503,
-    111508,
-    111512,
-    111517,
-    111522,
-    111527,
-    111531,
-    111536,
-    111541,
-    111546,
-    111550,
-    111555,
-    111560,
-    111564,
     111569,
-    111574,
-    111579,
-    111583,
-    111588,
-    111593,
-    111597,
-    111602,
-    111607,
-    111612,
-    111616,
-    111621,
-    111626,
-    111630,
-    111635,
-    111640,
     111645,
-    111649,
-    111654,
-    111659,
-    111664,
-    111668,
-    111673,
-    111678,
-    111682,
-    111687,
-    111692,
-    111697,
-    111701,
-    111706,
-    111711,
-    111716,
     111720,
-    111725,
-    111730,
-    111734,
-    111739,
-    111744,
-    111749,
-    111753,
-    111758,
-    111763,
-    111768,
-    111772,
-    111777,
-    111782,
-    111786,
-    111791,
     111796,
-    111801,
-    111805,
-    111810,
-    111815,
-    111820,
-    111824,
-    111829,
-    111834,
-    111838,
-    111843,
-    111848,
-    111853,
-    111857,
-    111862,
-    111867,
     111872,
-    111876,
-    111881,
-    111886,
-    111891,
-    111895,
-    111900,
-    111905,
-    111909,
-    111914,
-    111919,
-    111924,
-    111928,
-    111933,
-    111938,
-    111943,
     111947,
-    111952,
-    111957,
-    111962,
-    111966,
-    111971,
-    111976,
-    111981,
-    111985,
-    111990,
-    111995,
-    111999,
-    112004,
-    112009,
-    112014,
-    112018,
     112023,
-    112028,
-    112033,
-    112037,
-    112042,
-    112047,
-    112052,
-    112056,
-    112061,
-    112066,
-    112071,
-    112075,
-    112080,
-    112085,
-    112090,
-    112094,
     112099,
-    112104,
-    112108,
-    112113,
-    112118,
-    112123,
-    112127,
-    112132,
-    112137,
-    112142,
-    112146,
-    112151,
-    112156,
-    112161,
-    112165,
-    112170,
     112175,
-    112180,
-    112184,
-    112189,
-    112194,
-    112199,
-    112203,
-    112208,
-    112213,
-    112218,
-    112222,
-    112227,
-    112232,
-    112237,
-    112241,
-    112246,
     112251,
-    112256,
-    112260,
-    112265,
-    112270,
-    112275,
-    112279,
-    112284,
-    112289,
-    112294,
-    112298,
-    112303,
-    112308,
-    112313,
-    112317,
-    112322,
     112327,
-    112332,
-    112336,
-    112341,
-    112346,
-    112351,
-    112355,
-    112360,
-    112365,
-    112370,
-    112374,
-    112379,
-    112384,
-    112389,
-    112393,
-    112398,
     112403,
-    112408,
-    112412,
-    112417,
-    112422,
-    112427,
-    112431,
-    112436,
-    112441,
-    112446,
-    112451,
-    112455,
-    112460,
-    112465,
-    112470,
-    112474,
     112479,
-    112484,
-    112489,
-    112493,
-    112498,
-    112503,
-    112508,
-    112512,
-    112517,
-    112522,
-    112527,
-    112531,
-    112536,
-    112541,
-    112546,
-    112550,
     112555,
-    112560,
-    112565,
-    112570,
-    112574,
-    112579,
-    112584,
-    112589,
-    112593,
-    112598,
-    112603,
-    112608,
-    112612,
-    112617,
-    112622,
-    112627,
     112631,
-    112636,
-    112641,
-    112646,
-    112650,
-    112655,
-    112660,
-    112665,
-    112670,
-    112674,
-    112679,
-    112684,
-    112689,
-    112693,
-    112698,
-    112703,
     112708,
-    112712,
-    112717,
-    112722,
-    112727,
-    112732,
-    112736,
-    112741,
-    112746,
-    112751,
-    112755,
-    112760,
-    112765,
-    112770,
-    112774,
-    112779,
     112784,
-    112789,
-    112794,
-    112798,
-    112803,
-    112808,
-    112813,
-    112817,
-    112822,
-    112827,
-    112832,
-    112837,
-    112841,
-    112846,
-    112851,
-    112856,
     112860,
-    112865,
-    112870,
-    112875,
-    112879,
-    112884,
-    112889,
-    112894,
-    112899,
-    112903,
-    112908,
-    112913,
-    112918,
-    112922,
-    112927,
-    112932,
     112937,
-    112942,
-    112946,
-    112951,
-    112956,
-    112961,
-    112965,
-    112970,
-    112975,
-    112980,
-    112985,
-    112989,
-    112994,
-    112999,
-    113004,
-    113009,
     113013,
-    113018,
-    113023,
-    113028,
-    113032,
-    113037,
-    113042,
-    113047,
-    113052,
-    113056,
-    113061,
-    113066,
-    113071,
-    113075,
-    113080,
-    113085,
     113090,
-    113095,
-    113099,
-    113104,
-    113109,
-    113114,
-    113119,
-    113123,
-    113128,
-    113133,
-    113138,
-    113142,
-    113147,
-    113152,
-    113157,
-    113162,
     113166,
-    113171,
-    113176,
-    113181,
-    113186,
-    113190,
-    113195,
-    113200,
-    113205,
-    113209,
-    113214,
-    113219,
-    113224,
-    113229,
-    113233,
-    113238,
     113243,
-    113248,
-    113253,
-    113257,
-    113262,
-    113267,
-    113272,
-    113277,
-    113281,
-    113286,
-    113291,
-    113296,
-    113301,
-    113305,
-    113310,
-    113315,
     113320,
-    113324,
-    113329,
-    113334,
-    113339,
-    113344,
-    113348,
-    113353,
-    113358,
-    113363,
-    113368,
-    113372,
-    113377,
-    113382,
-    113387,
-    113392,
     113396,
-    113401,
-    113406,
-    113411,
-    113416,
-    113420,
-    113425,
-    113430,
-    113435,
-    113440,
-    113444,
-    113449,
-    113454,
-    113459,
-    113464,
-    113468,
     113473,
-    113478,
-    113483,
-    113488,
-    113492,
-    113497,
-    113502,
-    113507,
-    113512,
-    113516,
-    113521,
-    113526,
-    113531,
-    113536,
-    113540,
-    113545,
     113550,
-    113555,
-    113560,
-    113564,
-    113569,
-    113574,
-    113579,
-    113584,
-    113588,
-    113593,
-    113598,
-    113603,
-    113608,
-    113613,
-    113617,
-    113622,
     113627,
-    113632,
-    113637,
-    113641,
-    113646,
-    113651,
-    113656,
-    113661,
-    113665,
-    113670,
-    113675,
-    113680,
-    113685,
-    113689,
-    113694,
-    113699,
     113704,
-    113709,
-    113713,
-    113718,
-    113723,
-    113728,
-    113733,
-    113738,
-    113742,
-    113747,
-    113752,
-    113757,
-    113762,
-    113766,
-    113771,
-    113776,
     113781,
-    113786,
-    113790,
-    113795,
-    113800,
-    113805,
-    113810,
-    113815,
-    113819,
-    113824,
-    113829,
-    113834,
-    113839,
-    113843,
-    113848,
-    113853,
     113858,
-    113863,
-    113868,
-    113872,
-    113877,
-    113882,
-    113887,
-    113892,
-    113896,
-    113901,
-    113906,
-    113911,
-    113916,
-    113921,
-    113925,
-    113930,
     113935,
-    113940,
-    113945,
-    113949,
-    113954,
-    113959,
-    113964,
-    113969,
-    113974,
-    113978,
-    113983,
-    113988,
-    113993,
-    113998,
-    114003,
-    114007,
     114012,
-    114017,
-    114022,
-    114027,
-    114031,
-    114036,
-    114041,
-    114046,
-    114051,
-    114056,
-    114060,
-    114065,
-    114070,
-    114075,
-    114080,
-    114085,
     114089,
-    114094,
-    114099,
-    114104,
-    114109,
-    114113,
-    114118,
-    114123,
-    114128,
-    114133,
-    114138,
-    114142,
-    114147,
-    114152,
-    114157,
-    114162,
     114167,
-    114171,
-    114176,
-    114181,
-    114186,
-    114191,
-    114196,
-    114200,
-    114205,
-    114210,
-    114215,
-    114220,
-    114225,
-    114229,
-    114234,
-    114239,
     114244,
-    114249,
-    114254,
-    114258,
-    114263,
-    114268,
-    114273,
-    114278,
-    114283,
-    114287,
-    114292,
-    114297,
-    114302,
-    114307,
-    114312,
-    114316,
     114321,
-    114326,
-    114331,
-    114336,
-    114341,
-    114345,
-    114350,
-    114355,
-    114360,
-    114365,
-    114370,
-    114374,
-    114379,
-    114384,
-    114389,
-    114394,
     114399,
-    114404,
-    114408,
-    114413,
-    114418,
-    114423,
-    114428,
-    114433,
-    114437,
-    114442,
-    114447,
-    114452,
-    114457,
-    114462,
-    114466,
-    114471,
     114476,
-    114481,
-    114486,
-    114491,
-    114496,
-    114500,
-    114505,
-    114510,
-    114515,
-    114520,
-    114525,
-    114529,
-    114534,
-    114539,
-    114544,
-    114549,
     114554,
-    114559,
-    114563,
-    114568,
-    114573,
-    114578,
-    114583,
-    114588,
-    114592,
-    114597,
-    114602,
-    114607,
-    114612,
-    114617,
-    114622,
-    114626,
     114631,
-    114636,
-    114641,
-    114646,
-    114651,
-    114655,
-    114660,
-    114665,
-    114670,
-    114675,
-    114680,
-    114685,
-    114689,
-    114694,
-    114699,
-    114704,
     114709,
-    114714,
-    114719,
-    114723,
-    114728,
-    114733,
-    114738,
-    114743,
-    114748,
-    114753,
-    114757,
-    114762,
-    114767,
-    114772,
-    114777,
-    114782,
     114787,
-    114791,
-    114796,
-    114801,
-    114806,
-    114811,
-    114816,
-    114821,
-    114825,
-    114830,
-    114835,
-    114840,
-    114845,
-    114850,
-    114855,
-    114859,
     114864,
-    114869,
-    114874,
-    114879,
-    114884,
-    114889,
-    114893,
-    114898,
-    114903,
-    114908,
-    114913,
-    114918,
-    114923,
-    114927,
-    114932,
-    114937,
     114942,
-    114947,
-    114952,
-    114957,
-    114961,
-    114966,
-    114971,
-    114976,
-    114981,
-    114986,
-    114991,
-    114996,
-    115000,
-    115005,
-    115010,
-    115015,
     115020,
-    115025,
-    115030,
-    115034,
-    115039,
-    115044,
-    115049,
-    115054,
-    115059,
-    115064,
-    115069,
-    115073,
-    115078,
-    115083,
-    115088,
-    115093,
     115098,
-    115103,
-    115107,
-    115112,
-    115117,
-    115122,
-    115127,
-    115132,
-    115137,
-    115142,
-    115146,
-    115151,
-    115156,
-    115161,
-    115166,
-    115171,
     115176,
-    115181,
-    115185,
-    115190,
-    115195,
-    115200,
-    115205,
-    115210,
-    115215,
-    115220,
-    115224,
-    115229,
-    115234,
-    115239,
-    115244,
-    115249,
     115254,
-    115259,
-    115263,
-    115268,
-    115273,
-    115278,
-    115283,
-    115288,
-    115293,
-    115298,
-    115302,
-    115307,
-    115312,
-    115317,
-    115322,
-    115327,
     115332,
-    115337,
-    115341,
-    115346,
-    115351,
-    115356,
-    115361,
-    115366,
-    115371,
-    115376,
-    115381,
-    115385,
-    115390,
-    115395,
-    115400,
-    115405,
     115410,
-    115415,
-    115420,
-    115424,
-    115429,
-    115434,
-    115439,
-    115444,
-    115449,
-    115454,
-    115459,
-    115464,
-    115468,
-    115473,
-    115478,
-    115483,
     115488,
-    115493,
-    115498,
-    115503,
-    115507,
-    115512,
-    115517,
-    115522,
-    115527,
-    115532,
-    115537,
-    115542,
-    115547,
-    115551,
-    115556,
-    115561,
     115566,
-    115571,
-    115576,
-    115581,
-    115586,
-    115591,
-    115595,
-    115600,
-    115605,
-    115610,
-    115615,
-    115620,
-    115625,
-    115630,
-    115635,
-    115640,
     115644,
-    115649,
-    115654,
-    115659,
-    115664,
-    115669,
-    115674,
-    115679,
-    115684,
-    115688,
-    115693,
-    115698,
-    115703,
-    115708,
-    115713,
-    115718,
     115723,
-    115728,
-    115733,
-    115737,
-    115742,
-    115747,
-    115752,
-    115757,
-    115762,
-    115767,
-    115772,
-    115777,
-    115781,
-    115786,
-    115791,
-    115796,
     115801,
-    115806,
-    115811,
-    115816,
-    115821,
-    115826,
-    115830,
-    115835,
-    115840,
-    115845,
-    115850,
-    115855,
-    115860,
-    115865,
-    115870,
-    115875,
     115879,
-    115884,
-    115889,
-    115894,
-    115899,
-    115904,
-    115909,
-    115914,
-    115919,
-    115924,
-    115929,
-    115933,
-    115938,
-    115943,
-    115948,
-    115953,
     115958,
-    115963,
-    115968,
-    115973,
-    115978,
-    115982,
-    115987,
-    115992,
-    115997,
-    116002,
-    116007,
-    116012,
-    116017,
-    116022,
-    116027,
-    116032,
     116036,
-    116041,
-    116046,
-    116051,
-    116056,
-    116061,
-    116066,
-    116071,
-    116076,
-    116081,
-    116086,
-    116090,
-    116095,
-    116100,
-    116105,
-    116110,
     116115,
-    116120,
-    116125,
-    116130,
-    116135,
-    116140,
-    116145,
-    116149,
-    116154,
-    116159,
-    116164,
-    116169,
-    116174,
-    116179,
-    116184,
-    116189,
     116194,
-    116199,
-    116203,
-    116208,
-    116213,
-    116218,
-    116223,
-    116228,
-    116233,
-    116238,
-    116243,
-    116248,
-    116253,
-    116258,
-    116263,
-    116267,
     116272,
-    116277,
-    116282,
-    116287,
-    116292,
-    116297,
-    116302,
-    116307,
-    116312,
-    116317,
-    116322,
-    116326,
-    116331,
-    116336,
-    116341,
-    116346,
     116351,
-    116356,
-    116361,
-    116366,
-    116371,
-    116376,
-    116381,
-    116386,
-    116390,
-    116395,
-    116400,
-    116405,
-    116410,
-    116415,
-    116420,
-    116425,
     116430,
-    116435,
-    116440,
-    116445,
-    116450,
-    116454,
-    116459,
-    116464,
-    116469,
-    116474,
-    116479,
-    116484,
-    116489,
-    116494,
-    116499,
-    116504,
     116509,
-    116514,
-    116519,
-    116523,
-    116528,
-    116533,
-    116538,
-    116543,
-    116548,
-    116553,
-    116558,
-    116563,
-    116568,
-    116573,
-    116578,
-    116583,
     116588,
-    116593,
-    116597,
-    116602,
-    116607,
-    116612,
-    116617,
-    116622,
-    116627,
-    116632,
-    116637,
-    116642,
-    116647,
-    116652,
-    116657,
-    116662,
     116667,
-    116671,
-    116676,
-    116681,
-    116686,
-    116691,
-    116696,
-    116701,
-    116706,
-    116711,
-    116716,
-    116721,
-    116726,
-    116731,
-    116736,
-    116741,
     116746,
-    116750,
-    116755,
-    116760,
-    116765,
-    116770,
-    116775,
-    116780,
-    116785,
-    116790,
-    116795,
-    116800,
-    116805,
-    116810,
-    116815,
-    116820,
     116825,
-    116830,
-    116834,
-    116839,
-    116844,
-    116849,
-    116854,
-    116859,
-    116864,
-    116869,
-    116874,
-    116879,
-    116884,
-    116889,
-    116894,
-    116899,
     116904,
-    116909,
-    116914,
-    116919,
-    116923,
-    116928,
-    116933,
-    116938,
-    116943,
-    116948,
-    116953,
-    116958,
-    116963,
-    116968,
-    116973,
-    116978,
     116983,
-    116988,
-    116993,
-    116998,
-    117003,
-    117008,
-    117013,
-    117017,
-    117022,
-    117027,
-    117032,
-    117037,
-    117042,
-    117047,
-    117052,
-    117057,
     117062,
-    117067,
-    117072,
-    117077,
-    117082,
-    117087,
-    117092,
-    117097,
-    117102,
-    117107,
-    117112,
-    117117,
-    117122,
-    117126,
-    117131,
-    117136,
     117141,
-    117146,
-    117151,
-    117156,
-    117161,
-    117166,
-    117171,
-    117176,
-    117181,
-    117186,
-    117191,
-    117196,
-    117201,
-    117206,
-    117211,
-    117216,
     117221,
-    117226,
-    117231,
-    117236,
-    117240,
-    117245,
-    117250,
-    117255,
-    117260,
-    117265,
-    117270,
-    117275,
-    117280,
-    117285,
-    117290,
-    117295,
     117300,
-    117305,
-    117310,
-    117315,
-    117320,
-    117325,
-    117330,
-    117335,
-    117340,
-    117345,
-    117350,
-    117355,
-    117360,
-    117365,
-    117370,
-    117374,
     117379,
-    117384,
-    117389,
-    117394,
-    117399,
-    117404,
-    117409,
-    117414,
-    117419,
-    117424,
-    117429,
-    117434,
-    117439,
-    117444,
-    117449,
-    117454,
     117459,
-    117464,
-    117469,
-    117474,
-    117479,
-    117484,
-    117489,
-    117494,
-    117499,
-    117504,
-    117509,
-    117514,
-    117519,
-    117524,
-    117529,
-    117533,
     117538,
-    117543,
-    117548,
-    117553,
-    117558,
-    117563,
-    117568,
-    117573,
-    117578,
-    117583,
-    117588,
-    117593,
-    117598,
-    117603,
-    117608,
-    117613,
     117618,
-    117623,
-    117628,
-    117633,
-    117638,
-    117643,
-    117648,
-    117653,
-    117658,
-    117663,
-    117668,
-    117673,
-    117678,
-    117683,
-    117688,
-    117693,
     117698,
-    117703,
-    117708,
-    117713,
-    117718,
-    117723,
-    117728,
-    117733,
-    117738,
-    117743,
-    117748,
-    117752,
-    117757,
-    117762,
-    117767,
-    117772,
     117777,
-    117782,
-    117787,
-    117792,
-    117797,
-    117802,
-    117807,
-    117812,
-    117817,
-    117822,
-    117827,
-    117832,
-    117837,
-    117842,
-    117847,
-    117852,
     117857,
-    117862,
-    117867,
-    117872,
-    117877,
-    117882,
-    117887,
-    117892,
-    117897,
-    117902,
-    117907,
-    117912,
-    117917,
-    117922,
-    117927,
-    117932,
     117937,
-    117942,
-    117947,
-    117952,
-    117957,
-    117962,
-    117967,
-    117972,
-    117977,
-    117982,
-    117987,
-    117992,
-    117997,
-    118002,
-    118007,
-    118012,
     118017,
-    118022,
-    118027,
-    118032,
-    118037,
-    118042,
-    118047,
-    118052,
-    118057,
-    118062,
-    118067,
-    118072,
-    118077,
-    118082,
-    118087,
-    118092,
     118097,
-    118102,
-    118107,
-    118112,
-    118117,
-    118122,
-    118127,
-    118132,
-    118137,
-    118142,
-    118147,
-    118152,
-    118157,
-    118162,
-    118167,
-    118172,
     118177,
-    118182,
-    118187,
-    118192,
-    118197,
-    118202,
-    118207,
-    118212,
-    118217,
-    118222,
-    118227,
-    118232,
-    118237,
-    118242,
-    118247,
-    118252,
     118257,
-    118262,
-    118267,
-    118272,
-    118277,
-    118282,
-    118287,
-    118292,
-    118297,
-    118302,
-    118307,
-    118312,
-    118317,
-    118322,
-    118327,
-    118332,
     118337,
-    118342,
-    118347,
-    118352,
-    118357,
-    118362,
-    118367,
-    118372,
-    118377,
-    118382,
-    118387,
-    118392,
-    118397,
-    118402,
-    118407,
-    118412,
     118417,
-    118422,
-    118427,
-    118432,
-    118437,
-    118442,
-    118447,
-    118452,
-    118457,
-    118462,
-    118467,
-    118472,
-    118477,
-    118482,
-    118487,
-    118492,
     118497,
-    118502,
-    118507,
-    118512,
-    118517,
-    118522,
-    118527,
-    118532,
-    118537,
-    118542,
-    118547,
-    118552,
-    118557,
-    118562,
-    118567,
-    118572,
     118577,
-    118582,
-    118587,
-    118592,
-    118597,
-    118602,
-    118607,
-    118612,
-    118617,
-    118622,
-    118628,
-    118633,
-    118638,
-    118643,
-    118648,
-    118653,
     118658,
-    118663,
-    118668,
-    118673,
-    118678,
-    118683,
-    118688,
-    118693,
-    118698,
-    118703,
-    118708,
-    118713,
-    118718,
-    118723,
-    118728,
-    118733,
     118738,
-    118743,
-    118748,
-    118753,
-    118758,
-    118763,
-    118768,
-    118773,
-    118778,
-    118783,
-    118788,
-    118793,
-    118798,
-    118803,
-    118808,
-    118813,
     118818,
-    118823,
-    118828,
-    118833,
-    118838,
-    118844,
-    118849,
-    118854,
-    118859,
-    118864,
-    118869,
-    118874,
-    118879,
-    118884,
-    118889,
-    118894,
     118899,
-    118904,
-    118909,
-    118914,
-    118919,
-    118924,
-    118929,
-    118934,
-    118939,
-    118944,
-    118949,
-    118954,
-    118959,
-    118964,
-    118969,
-    118974,
     118979,
-    118984,
-    118989,
-    118994,
-    118999,
-    119005,
-    119010,
-    119015,
-    119020,
-    119025,
-    119030,
-    119035,
-    119040,
-    119045,
-    119050,
-    119055,
     119060,
-    119065,
-    119070,
-    119075,
-    119080,
-    119085,
-    119090,
-    119095,
-    119100,
-    119105,
-    119110,
-    119115,
-    119120,
-    119125,
-    119130,
-    119135,
     119141,
-    119146,
-    119151,
-    119156,
-    119161,
-    119166,
-    119171,
-    119176,
-    119181,
-    119186,
-    119191,
-    119196,
-    119201,
-    119206,
-    119211,
-    119216,
     119221,
-    119226,
-    119231,
-    119236,
-    119241,
-    119246,
-    119251,
-    119257,
-    119262,
-    119267,
-    119272,
-    119277,
-    119282,
-    119287,
-    119292,
-    119297,
     119302,
-    119307,
-    119312,
-    119317,
-    119322,
-    119327,
-    119332,
-    119337,
-    119342,
-    119347,
-    119352,
-    119357,
-    119363,
-    119368,
-    119373,
-    119378,
     119383,
-    119388,
-    119393,
-    119398,
-    119403,
-    119408,
-    119413,
-    119418,
-    119423,
-    119428,
-    119433,
-    119438,
-    119443,
-    119448,
-    119453,
-    119458,
     119464,
-    119469,
-    119474,
-    119479,
-    119484,
-    119489,
-    119494,
-    119499,
-    119504,
-    119509,
-    119514,
-    119519,
-    119524,
-    119529,
-    119534,
-    119539,
     119544,
-    119549,
-    119555,
-    119560,
-    119565,
-    119570,
-    119575,
-    119580,
-    119585,
-    119590,
-    119595,
-    119600,
-    119605,
-    119610,
-    119615,
-    119620,
     119625,
-    119630,
-    119636,
-    119641,
-    119646,
-    119651,
-    119656,
-    119661,
-    119666,
-    119671,
-    119676,
-    119681,
-    119686,
-    119691,
-    119696,
-    119701,
     119706,
-    119711,
-    119717,
-    119722,
-    119727,
-    119732,
-    119737,
-    119742,
-    119747,
-    119752,
-    119757,
-    119762,
-    119767,
-    119772,
-    119777,
-    119782,
     119787,
-    119793,
-    119798,
-    119803,
-    119808,
-    119813,
-    119818,
-    119823,
-    119828,
-    119833,
-    119838,
-    119843,
-    119848,
-    119853,
-    119858,
-    119863,
     119869,
-    119874,
-    119879,
-    119884,
-    119889,
-    119894,
-    119899,
-    119904,
-    119909,
-    119914,
-    119919,
-    119924,
-    119929,
-    119935,
-    119940,
-    119945,
     119950,
-    119955,
-    119960,
-    119965,
-    119970,
-    119975,
-    119980,
-    119985,
-    119990,
-    119995,
-    120000,
-    120006,
-    120011,
-    120016,
-    120021,
-    120026,
     120031,
-    120036,
-    120041,
-    120046,
-    120051,
-    120056,
-    120061,
-    120066,
-    120072,
-    120077,
-    120082,
-    120087,
-    120092,
-    120097,
-    120102,
-    120107,
     120112,
-    120117,
-    120122,
-    120127,
-    120133,
-    120138,
-    120143,
-    120148,
-    120153,
-    120158,
-    120163,
-    120168,
-    120173,
-    120178,
-    120183,
-    120188,
     120194,
-    120199,
-    120204,
-    120209,
-    120214,
-    120219,
-    120224,
-    120229,
-    120234,
-    120239,
-    120244,
-    120250,
-    120255,
-    120260,
-    120265,
-    120270,
     120275,
-    120280,
-    120285,
-    120290,
-    120295,
-    120300,
-    120305,
-    120311,
-    120316,
-    120321,
-    120326,
-    120331,
-    120336,
-    120341,
-    120346,
-    120351,
     120356,
-    120361,
-    120367,
-    120372,
-    120377,
-    120382,
-    120387,
-    120392,
-    120397,
-    120402,
-    120407,
-    120412,
-    120418,
-    120423,
-    120428,
-    120433,
     120438,
-    120443,
-    120448,
-    120453,
-    120458,
-    120463,
-    120468,
-    120474,
-    120479,
-    120484,
-    120489,
-    120494,
-    120499,
-    120504,
-    120509,
-    120514,
     120519,
-    120525,
-    120530,
-    120535,
-    120540,
-    120545,
-    120550,
-    120555,
-    120560,
-    120565,
-    120570,
-    120576,
-    120581,
-    120586,
-    120591,
-    120596,
     120601,
-    120606,
-    120611,
-    120616,
-    120621,
-    120627,
-    120632,
-    120637,
-    120642,
-    120647,
-    120652,
-    120657,
-    120662,
-    120667,
-    120672,
-    120678,
     120683,
-    120688,
-    120693,
-    120698,
-    120703,
-    120708,
-    120713,
-    120718,
-    120724,
-    120729,
-    120734,
-    120739,
-    120744,
-    120749,
-    120754,
-    120759,
     120764,
-    120770,
-    120775,
-    120780,
-    120785,
-    120790,
-    120795,
-    120800,
-    120805,
-    120810,
-    120816,
-    120821,
-    120826,
-    120831,
-    120836,
-    120841,
     120846,
-    120851,
-    120856,
-    120862,
-    120867,
-    120872,
-    120877,
-    120882,
-    120887,
-    120892,
-    120897,
-    120902,
-    120908,
-    120913,
-    120918,
-    120923,
     120928,
-    120933,
-    120938,
-    120943,
-    120948,
-    120954,
-    120959,
-    120964,
-    120969,
-    120974,
-    120979,
-    120984,
-    120989,
-    120995,
-    121000,
-    121005,
     121010,
-    121015,
-    121020,
-    121025,
-    121030,
-    121036,
-    121041,
-    121046,
-    121051,
-    121056,
-    121061,
-    121066,
-    121071,
-    121076,
-    121082,
-    121087,
     121092,
-    121097,
-    121102,
-    121107,
-    121112,
-    121117,
-    121123,
-    121128,
-    121133,
-    121138,
-    121143,
-    121148,
-    121153,
-    121158,
-    121164,
-    121169,
     121174,
-    121179,
-    121184,
-    121189,
-    121194,
-    121199,
-    121205,
-    121210,
-    121215,
-    121220,
-    121225,
-    121230,
-    121235,
-    121241,
-    121246,
-    121251,
     121256,
-    121261,
-    121266,
-    121271,
-    121276,
-    121282,
-    121287,
-    121292,
-    121297,
-    121302,
-    121307,
-    121312,
-    121317,
-    121323,
-    121328,
-    121333,
     121338,
-    121343,
-    121348,
-    121353,
-    121359,
-    121364,
-    121369,
-    121374,
-    121379,
-    121384,
-    121389,
-    121394,
-    121400,
-    121405,
-    121410,
-    121415,
     121420,
-    121425,
-    121430,
-    121436,
-    121441,
-    121446,
-    121451,
-    121456,
-    121461,
-    121466,
-    121472,
-    121477,
-    121482,
-    121487,
-    121492,
-    121497,
     121502,
-    121508,
-    121513,
-    121518,
-    121523,
-    121528,
-    121533,
-    121538,
-    121544,
-    121549,
-    121554,
-    121559,
-    121564,
-    121569,
-    121574,
-    121580,
     121585,
-    121590,
-    121595,
-    121600,
-    121605,
-    121610,
-    121616,
-    121621,
-    121626,
-    121631,
-    121636,
-    121641,
-    121646,
-    121652,
-    121657,
-    121662,
     121667,
-    121672,
-    121677,
-    121682,
-    121688,
-    121693,
-    121698,
-    121703,
-    121708,
-    121713,
-    121718,
-    121724,
-    121729,
-    121734,
-    121739,
-    121744,
     121749,
-    121755,
-    121760,
-    121765,
-    121770,
-    121775,
-    121780,
-    121785,
-    121791,
-    121796,
-    121801,
-    121806,
-    121811,
-    121816,
-    121821,
-    121827,
     121832,
-    121837,
-    121842,
-    121847,
-    121852,
-    121858,
-    121863,
-    121868,
-    121873,
-    121878,
-    121883,
-    121889,
-    121894,
-    121899,
-    121904,
-    121909,
     121914,
-    121919,
-    121925,
-    121930,
-    121935,
-    121940,
-    121945,
-    121950,
-    121956,
-    121961,
-    121966,
-    121971,
-    121976,
-    121981,
-    121987,
-    121992,
     121997,
-    122002,
-    122007,
-    122012,
-    122017,
-    122023,
-    122028,
-    122033,
-    122038,
-    122043,
-    122048,
-    122054,
-    122059,
-    122064,
-    122069,
-    122074,
     122079,
-    122085,
-    122090,
-    122095,
-    122100,
-    122105,
-    122110,
-    122116,
-    122121,
-    122126,
-    122131,
-    122136,
-    122141,
-    122147,
-    122152,
-    122157,
     122162,
-    122167,
-    122172,
-    122178,
-    122183,
-    122188,
-    122193,
-    122198,
-    122203,
-    122209,
-    122214,
-    122219,
-    122224,
-    122229,
-    122234,
-    122240,
     122245,
-    122250,
-    122255,
-    122260,
-    122266,
-    122271,
-    122276,
-    122281,
-    122286,
-    122291,
-    122297,
-    122302,
-    122307,
-    122312,
-    122317,
-    122322,
     122328,
-    122333,
-    122338,
-    122343,
-    122348,
-    122353,
-    122359,
-    122364,
-    122369,
-    122374,
-    122379,
-    122385,
-    122390,
-    122395,
-    122400,
-    122405,
     122410,
-    122416,
-    122421,
-    122426,
-    122431,
-    122436,
-    122442,
-    122447,
-    122452,
-    122457,
-    122462,
-    122467,
-    122473,
-    122478,
-    122483,
-    122488,
     122493,
-    122499,
-    122504,
-    122509,
-    122514,
-    122519,
-    122524,
-    122530,
-    122535,
-    122540,
-    122545,
-    122550,
-    122556,
-    122561,
-    122566,
-    122571,
     122576,
-    122581,
-    122587,
-    122592,
-    122597,
-    122602,
-    122607,
-    122613,
-    122618,
-    122623,
-    122628,
-    122633,
-    122639,
-    122644,
-    122649,
-    122654,
     122659,
-    122664,
-    122670,
-    122675,
-    122680,
-    122685,
-    122690,
-    122696,
-    122701,
-    122706,
-    122711,
-    122716,
-    122722,
-    122727,
-    122732,
-    122737,
     122742,
-    122748,
-    122753,
-    122758,
-    122763,
-    122768,
-    122773,
-    122779,
-    122784,
-    122789,
-    122794,
-    122799,
-    122805,
-    122810,
-    122815,
-    122820,
     122825,
-    122831,
-    122836,
-    122841,
-    122846,
-    122851,
-    122857,
-    122862,
-    122867,
-    122872,
-    122877,
-    122883,
-    122888,
-    122893,
-    122898,
-    122903,
     122909,
-    122914,
-    122919,
-    122924,
-    122929,
-    122935,
-    122940,
-    122945,
-    122950,
-    122955,
-    122961,
-    122966,
-    122971,
-    122976,
-    122981,
-    122987,
     122992,
-    122997,
-    123002,
-    123007,
-    123013,
-    123018,
-    123023,
-    123028,
-    123033,
-    123039,
-    123044,
-    123049,
-    123054,
-    123060,
-    123065,
-    123070,
     123075,
-    123080,
-    123086,
-    123091,
-    123096,
-    123101,
-    123106,
-    123112,
-    123117,
-    123122,
-    123127,
-    123132,
-    123138,
-    123143,
-    123148,
-    123153,
     123158,
-    123164,
-    123169,
-    123174,
-    123179,
-    123185,
-    123190,
-    123195,
-    123200,
-    123205,
-    123211,
-    123216,
-    123221,
-    123226,
-    123231,
-    123237,
     123242,
-    123247,
-    123252,
-    123258,
-    123263,
-    123268,
-    123273,
-    123278,
-    123284,
-    123289,
-    123294,
-    123299,
-    123304,
-    123310,
-    123315,
-    123320,
     123325,
-    123331,
-    123336,
-    123341,
-    123346,
-    123351,
-    123357,
-    123362,
-    123367,
-    123372,
-    123377,
-    123383,
-    123388,
-    123393,
-    123398,
-    123404,
     123409,
-    123414,
-    123419,
-    123424,
-    123430,
-    123435,
-    123440,
-    123445,
-    123451,
-    123456,
-    123461,
-    123466,
-    123471,
-    123477,
-    123482,
-    123487,
     123492,
-    123498,
-    123503,
-    123508,
-    123513,
-    123519,
-    123524,
-    123529,
-    123534,
-    123539,
-    123545,
-    123550,
-    123555,
-    123560,
-    123566,
-    123571,
     123576,
-    123581,
-    123586,
-    123592,
-    123597,
-    123602,
-    123607,
-    123613,
-    123618,
-    123623,
-    123628,
-    123634,
-    123639,
-    123644,
-    123649,
-    123654,
     123660,
-    123665,
-    123670,
-    123675,
-    123681,
-    123686,
-    123691,
-    123696,
-    123702,
-    123707,
-    123712,
-    123717,
-    123722,
-    123728,
-    123733,
-    123738,
     123743,
-    123749,
-    123754,
-    123759,
-    123764,
-    123770,
-    123775,
-    123780,
-    123785,
-    123791,
-    123796,
-    123801,
-    123806,
-    123811,
-    123817,
-    123822,
     123827,
-    123832,
-    123838,
-    123843,
-    123848,
-    123853,
-    123859,
-    123864,
-    123869,
-    123874,
-    123880,
-    123885,
-    123890,
-    123895,
-    123901,
-    123906,
     123911,
-    123916,
-    123922,
-    123927,
-    123932,
-    123937,
-    123943,
-    123948,
-    123953,
-    123958,
-    123963,
-    123969,
-    123974,
-    123979,
-    123984,
-    123990,
     123995,
-    124000,
-    124005,
-    124011,
-    124016,
-    124021,
-    124026,
-    124032,
-    124037,
-    124042,
-    124047,
-    124053,
-    124058,
-    124063,
-    124068,
-    124074,
     124079,
-    124084,
-    124089,
-    124095,
-    124100,
-    124105,
-    124110,
-    124116,
-    124121,
-    124126,
-    124131,
-    124137,
-    124142,
-    124147,
-    124152,
-    124158,
     124163,
-    124168,
-    124173,
-    124179,
-    124184,
-    124189,
-    124194,
-    124200,
-    124205,
-    124210,
-    124215,
-    124221,
-    124226,
-    124231,
-    124236,
-    124242,
     124247,
-    124252,
-    124258,
-    124263,
-    124268,
-    124273,
-    124279,
-    124284,
-    124289,
-    124294,
-    124300,
-    124305,
-    124310,
-    124315,
-    124321,
-    124326,
     124331,
-    124336,
-    124342,
-    124347,
-    124352,
-    124357,
-    124363,
-    124368,
-    124373,
-    124378,
-    124384,
-    124389,
-    124394,
-    124400,
-    124405,
-    124410,
     124415,
-    124421,
-    124426,
-    124431,
-    124436,
-    124442,
-    124447,
-    124452,
-    124457,
-    124463,
-    124468,
-    124473,
-    124479,
-    124484,
-    124489,
-    124494,
     124500,
-    124505,
-    124510,
-    124515,
-    124521,
-    124526,
-    124531,
-    124536,
-    124542,
-    124547,
-    124552,
-    124558,
-    124563,
-    124568,
-    124573,
-    124579,
     124584,
-    124589,
-    124594,
-    124600,
-    124605,
-    124610,
-    124616,
-    124621,
-    124626,
-    124631,
-    124637,
-    124642,
-    124647,
-    124652,
-    124658,
-    124663,
     124668,
-    124674,
-    124679,
-    124684,
-    124689,
-    124695,
-    124700,
-    124705,
-    124710,
-    124716,
-    124721,
-    124726,
-    124732,
-    124737,
-    124742,
-    124747,
     124753,
-    124758,
-    124763,
-    124768,
-    124774,
-    124779,
-    124784,
-    124790,
-    124795,
-    124800,
-    124805,
-    124811,
-    124816,
-    124821,
-    124827,
-    124832,
     124837,
-    124842,
-    124848,
-    124853,
-    124858,
-    124864,
-    124869,
-    124874,
-    124879,
-    124885,
-    124890,
-    124895,
-    124901,
-    124906,
-    124911,
-    124916,
     124922,
-    124927,
-    124932,
-    124938,
-    124943,
-    124948,
-    124953,
-    124959,
-    124964,
-    124969,
-    124975,
-    124980,
-    124985,
-    124990,
-    124996,
-    125001,
     125006,
-    125012,
-    125017,
-    125022,
-    125027,
-    125033,
-    125038,
-    125043,
-    125049,
-    125054,
-    125059,
-    125064,
-    125070,
-    125075,
-    125080,
-    125086,
     125091,
-    125096,
-    125101,
-    125107,
-    125112,
-    125117,
-    125123,
-    125128,
-    125133,
-    125139,
-    125144,
-    125149,
-    125154,
-    125160,
-    125165,
-    125170,
     125176,
-    125181,
-    125186,
-    125191,
-    125197,
-    125202,
-    125207,
-    125213,
-    125218,
-    125223,
-    125229,
-    125234,
-    125239,
-    125244,
-    125250,
-    125255,
     125260,
-    125266,
-    125271,
-    125276,
-    125282,
-    125287,
-    125292,
-    125297,
-    125303,
-    125308,
-    125313,
-    125319,
-    125324,
-    125329,
-    125335,
-    125340,
     125345,
-    125350,
-    125356,
-    125361,
-    125366,
-    125372,
-    125377,
-    125382,
-    125388,
-    125393,
-    125398,
-    125404,
-    125409,
-    125414,
-    125419,
-    125425,
     125430,
-    125435,
-    125441,
-    125446,
-    125451,
-    125457,
-    125462,
-    125467,
-    125473,
-    125478,
-    125483,
-    125488,
-    125494,
-    125499,
-    125504,
-    125510,
     125515,
-    125520,
-    125526,
-    125531,
-    125536,
-    125542,
-    125547,
-    125552,
-    125557,
-    125563,
-    125568,
-    125573,
-    125579,
-    125584,
-    125589,
-    125595,
     125600,
-    125605,
-    125611,
-    125616,
-    125621,
-    125627,
-    125632,
-    125637,
-    125642,
-    125648,
-    125653,
-    125658,
-    125664,
-    125669,
-    125674,
-    125680,
     125685,
-    125690,
-    125696,
-    125701,
-    125706,
-    125712,
-    125717,
-    125722,
-    125728,
-    125733,
-    125738,
-    125744,
-    125749,
-    125754,
-    125759,
-    125765,
     125770,
-    125775,
-    125781,
-    125786,
-    125791,
-    125797,
-    125802,
-    125807,
-    125813,
-    125818,
-    125823,
-    125829,
-    125834,
-    125839,
-    125845,
-    125850,
     125855,
-    125861,
-    125866,
-    125871,
-    125877,
-    125882,
-    125887,
-    125893,
-    125898,
-    125903,
-    125909,
-    125914,
-    125919,
-    125925,
-    125930,
-    125935,
     125941,
-    125946,
-    125951,
-    125956,
-    125962,
-    125967,
-    125972,
-    125978,
-    125983,
-    125988,
-    125994,
-    125999,
-    126004,
-    126010,
-    126015,
-    126020,
     126026,
-    126031,
-    126036,
-    126042,
-    126047,
-    126052,
-    126058,
-    126063,
-    126068,
-    126074,
-    126079,
-    126084,
-    126090,
-    126095,
-    126100,
-    126106,
     126111,
-    126116,
-    126122,
-    126127,
-    126132,
-    126138,
-    126143,
-    126148,
-    126154,
-    126159,
-    126164,
-    126170,
-    126175,
-    126180,
-    126186,
-    126191,
     126197,
-    126202,
-    126207,
-    126213,
-    126218,
-    126223,
-    126229,
-    126234,
-    126239,
-    126245,
-    126250,
-    126255,
-    126261,
-    126266,
-    126271,
-    126277,
     126282,
-    126287,
-    126293,
-    126298,
-    126303,
-    126309,
-    126314,
-    126319,
-    126325,
-    126330,
-    126335,
-    126341,
-    126346,
-    126351,
-    126357,
-    126362,
     126367,
-    126373,
-    126378,
-    126384,
-    126389,
-    126394,
-    126400,
-    126405,
-    126410,
-    126416,
-    126421,
-    126426,
-    126432,
-    126437,
-    126442,
-    126448,
     126453,
-    126458,
-    126464,
-    126469,
-    126474,
-    126480,
-    126485,
-    126490,
-    126496,
-    126501,
-    126507,
-    126512,
-    126517,
-    126523,
-    126528,
-    126533,
     126539,
-    126544,
-    126549,
-    126555,
-    126560,
-    126565,
-    126571,
-    126576,
-    126581,
-    126587,
-    126592,
-    126598,
-    126603,
-    126608,
-    126614,
-    126619,
     126624,
-    126630,
-    126635,
-    126640,
-    126646,
-    126651,
-    126656,
-    126662,
-    126667,
-    126673,
-    126678,
-    126683,
-    126689,
-    126694,
-    126699,
-    126705,
     126710,
-    126715,
-    126721,
-    126726,
-    126732,
-    126737,
-    126742,
-    126748,
-    126753,
-    126758,
-    126764,
-    126769,
-    126774,
-    126780,
-    126785,
-    126791,
     126796,
-    126801,
-    126807,
-    126812,
-    126817,
-    126823,
-    126828,
-    126833,
-    126839,
-    126844,
-    126850,
-    126855,
-    126860,
-    126866,
-    126871,
-    126876,
     126882,
-    126887,
-    126892,
-    126898,
-    126903,
-    126909,
-    126914,
-    126919,
-    126925,
-    126930,
-    126935,
-    126941,
-    126946,
-    126952,
-    126957,
-    126962,
     126968,
-    126973,
-    126978,
-    126984,
-    126989,
-    126995,
-    127000,
-    127005,
-    127011,
-    127016,
-    127021,
-    127027,
-    127032,
-    127038,
-    127043,
-    127048,
     127054,
-    127059,
-    127064,
-    127070,
-    127075,
-    127081,
-    127086,
-    127091,
-    127097,
-    127102,
-    127107,
-    127113,
-    127118,
-    127124,
-    127129,
-    127134,
     127140,
-    127145,
-    127150,
-    127156,
-    127161,
-    127167,
-    127172,
-    127177,
-    127183,
-    127188,
-    127193,
-    127199,
-    127204,
-    127210,
-    127215,
-    127220,
     127226,
-    127231,
-    127237,
-    127242,
-    127247,
-    127253,
-    127258,
-    127263,
-    127269,
-    127274,
-    127280,
-    127285,
-    127290,
-    127296,
-    127301,
-    127307,
     127312,
-    127317,
-    127323,
-    127328,
-    127333,
-    127339,
-    127344,
-    127350,
-    127355,
-    127360,
-    127366,
-    127371,
-    127377,
-    127382,
-    127387,
-    127393,
     127398,
-    127404,
-    127409,
-    127414,
-    127420,
-    127425,
-    127430,
-    127436,
-    127441,
-    127447,
-    127452,
-    127457,
-    127463,
-    127468,
-    127474,
-    127479,
     127484,
-    127490,
-    127495,
-    127501,
-    127506,
-    127511,
-    127517,
-    127522,
-    127528,
-    127533,
-    127538,
-    127544,
-    127549,
-    127555,
-    127560,
-    127565,
     127571,
-    127576,
-    127581,
-    127587,
-    127592,
-    127598,
-    127603,
-    127608,
-    127614,
-    127619,
-    127625,
-    127630,
-    127635,
-    127641,
-    127646,
-    127652,
     127657,
-    127662,
-    127668,
-    127673,
-    127679,
-    127684,
-    127689,
-    127695,
-    127700,
-    127706,
-    127711,
-    127717,
-    127722,
-    127727,
-    127733,
-    127738,
     127744,
-    127749,
-    127754,
-    127760,
-    127765,
-    127771,
-    127776,
-    127781,
-    127787,
-    127792,
-    127798,
-    127803,
-    127808,
-    127814,
-    127819,
-    127825,
     127830,
-    127835,
-    127841,
-    127846,
-    127852,
-    127857,
-    127862,
-    127868,
-    127873,
-    127879,
-    127884,
-    127890,
-    127895,
-    127900,
-    127906,
-    127911,
     127917,
-    127922,
-    127927,
-    127933,
-    127938,
-    127944,
-    127949,
-    127954,
-    127960,
-    127965,
-    127971,
-    127976,
-    127982,
-    127987,
-    127992,
-    127998,
     128003,
-    128009,
-    128014,
-    128019,
-    128025,
-    128030,
-    128036,
-    128041,
-    128047,
-    128052,
-    128057,
-    128063,
-    128068,
-    128074,
-    128079,
-    128084,
     128090,
-    128095,
-    128101,
-    128106,
-    128112,
-    128117,
-    128122,
-    128128,
-    128133,
-    128139,
-    128144,
-    128149,
-    128155,
-    128160,
-    128166,
-    128171,
     128177,
-    128182,
-    128187,
-    128193,
-    128198,
-    128204,
-    128209,
-    128215,
-    128220,
-    128225,
-    128231,
-    128236,
-    128242,
-    128247,
-    128253,
-    128258,
     128263,
-    128269,
-    128274,
-    128280,
-    128285,
-    128291,
-    128296,
-    128301,
-    128307,
-    128312,
-    128318,
-    128323,
-    128329,
-    128334,
-    128339,
-    128345,
     128350,
-    128356,
-    128361,
-    128367,
-    128372,
-    128377,
-    128383,
-    128388,
-    128394,
-    128399,
-    128405,
-    128410,
-    128415,
-    128421,
-    128426,
-    128432,
     128437,
-    128443,
-    128448,
-    128453,
-    128459,
-    128464,
-    128470,
-    128475,
-    128481,
-    128486,
-    128492,
-    128497,
-    128502,
-    128508,
-    128513,
-    128519,
     128524,
-    128530,
-    128535,
-    128540,
-    128546,
-    128551,
-    128557,
-    128562,
-    128568,
-    128573,
-    128579,
-    128584,
-    128589,
-    128595,
-    128600,
-    128606,
     128611,
-    128617,
-    128622,
-    128627,
-    128633,
-    128638,
-    128644,
-    128649,
-    128655,
-    128660,
-    128666,
-    128671,
-    128676,
-    128682,
-    128687,
-    128693,
     128698,
-    128704,
-    128709,
-    128715,
-    128720,
-    128725,
-    128731,
-    128736,
-    128742,
-    128747,
-    128753,
-    128758,
-    128764,
-    128769,
-    128774,
-    128780,
     128785,
-    128791,
-    128796,
-    128802,
-    128807,
-    128813,
-    128818,
-    128824,
-    128829,
-    128834,
-    128840,
-    128845,
-    128851,
-    128856,
-    128862,
-    128867,
     128873,
-    128878,
-    128883,
-    128889,
-    128894,
-    128900,
-    128905,
-    128911,
-    128916,
-    128922,
-    128927,
-    128933,
-    128938,
-    128943,
-    128949,
-    128954,
     128960,
-    128965,
-    128971,
-    128976,
-    128982,
-    128987,
-    128993,
-    128998,
-    129004,
-    129009,
-    129014,
-    129020,
-    129025,
-    129031,
-    129036,
-    129042,
     129047,
-    129053,
-    129058,
-    129064,
-    129069,
-    129074,
-    129080,
-    129085,
-    129091,
-    129096,
-    129102,
-    129107,
-    129113,
-    129118,
-    129124,
-    129129,
     129135,
-    129140,
-    129145,
-    129151,
-    129156,
-    129162,
-    129167,
-    129173,
-    129178,
-    129184,
-    129189,
-    129195,
-    129200,
-    129206,
-    129211,
-    129217,
     129222,
-    129227,
-    129233,
-    129238,
-    129244,
-    129249,
-    129255,
-    129260,
-    129266,
-    129271,
-    129277,
-    129282,
-    129288,
-    129293,
-    129299,
-    129304,
     129310,
-    129315,
-    129320,
-    129326,
-    129331,
-    129337,
-    129342,
-    129348,
-    129353,
-    129359,
-    129364,
-    129370,
-    129375,
-    129381,
-    129386,
-    129392,
     129397,
-    129403,
-    129408,
-    129413,
-    129419,
-    129424,
-    129430,
-    129435,
-    129441,
-    129446,
-    129452,
-    129457,
-    129463,
-    129468,
-    129474,
-    129479,
     129485,
-    129490,
-    129496,
-    129501,
-    129507,
-    129512,
-    129518,
-    129523,
-    129529,
-    129534,
-    129539,
-    129545,
-    129550,
-    129556,
-    129561,
-    129567,
     129572,
-    129578,
-    129583,
-    129589,
-    129594,
-    129600,
-    129605,
-    129611,
-    129616,
-    129622,
-    129627,
-    129633,
-    129638,
-    129644,
-    129649,
-    129655,
     129660,
-    129666,
-    129671,
-    129677,
-    129682,
-    129688,
-    129693,
-    129698,
-    129704,
-    129709,
-    129715,
-    129720,
-    129726,
-    129731,
-    129737,
-    129742,
     129748,
-    129753,
-    129759,
-    129764,
-    129770,
-    129775,
-    129781,
-    129786,
-    129792,
-    129797,
-    129803,
-    129808,
-    129814,
-    129819,
-    129825,
-    129830,
     129836,
-    129841,
-    129847,
-    129852,
-    129858,
-    129863,
-    129869,
-    129874,
-    129880,
-    129885,
-    129891,
-    129896,
-    129902,
-    129907,
-    129913,
-    129918,
     129924,
-    129929,
-    129935,
-    129940,
-    129946,
-    129951,
-    129957,
-    129962,
-    129968,
-    129973,
-    129979,
-    129984,
-    129990,
-    129995,
-    130001,
-    130006,
     130012,
-    130017,
-    130023,
-    130028,
-    130034,
-    130039,
-    130045,
-    130050,
-    130056,
-    130061,
-    130067,
-    130072,
-    130078,
-    130083,
-    130089,
-    130094,
     130100,
-    130105,
-    130111,
-    130116,
-    130122,
-    130127,
-    130133,
-    130138,
-    130144,
-    130149,
-    130155,
-    130160,
-    130166,
-    130171,
-    130177,
-    130182,
     130188,
-    130193,
-    130199,
-    130204,
-    130210,
-    130215,
-    130221,
-    130226,
-    130232,
-    130237,
-    130243,
-    130248,
-    130254,
-    130259,
-    130265,
-    130270,
     130276,
-    130281,
-    130287,
-    130292,
-    130298,
-    130303,
-    130309,
-    130315,
-    130320,
-    130326,
-    130331,
-    130337,
-    130342,
-    130348,
-    130353,
-    130359,
     130364,
-    130370,
-    130375,
-    130381,
-    130386,
-    130392,
-    130397,
-    130403,
-    130408,
-    130414,
-    130419,
-    130425,
-    130430,
-    130436,
-    130441,
-    130447,
     130452,
-    130458,
-    130463,
-    130469,
-    130474,
-    130480,
-    130486,
-    130491,
-    130497,
-    130502,
-    130508,
-    130513,
-    130519,
-    130524,
-    130530,
-    130535,
     130541,
-    130546,
-    130552,
-    130557,
-    130563,
-    130568,
-    130574,
-    130579,
-    130585,
-    130590,
-    130596,
-    130602,
-    130607,
-    130613,
-    130618,
-    130624,
     130629,
-    130635,
-    130640,
-    130646,
-    130651,
-    130657,
-    130662,
-    130668,
-    130673,
-    130679,
-    130684,
-    130690,
-    130695,
-    130701,
-    130707,
-    130712,
     130718,
-    130723,
-    130729,
-    130734,
-    130740,
-    130745,
-    130751,
-    130756,
-    130762,
-    130767,
-    130773,
-    130778,
-    130784,
-    130790,
-    130795,
-    130801,
     130806,
-    130812,
-    130817,
-    130823,
-    130828,
-    130834,
-    130839,
-    130845,
-    130850,
-    130856,
-    130861,
-    130867,
-    130873,
-    130878,
-    130884,
-    130889,
     130895,
-    130900,
-    130906,
-    130911,
-    130917,
-    130922,
-    130928,
-    130933,
-    130939,
-    130945,
-    130950,
-    130956,
-    130961,
-    130967,
-    130972,
-    130978,
     130983,
-    130989,
-    130994,
-    131000,
-    131005,
-    131011,
-    131017,
-    131022,
-    131028,
-    131033,
-    131039,
-    131044,
-    131050,
-    131055,
-    131061,
-    131066,
     131072
 };
 
+#ifndef FAAC_FLOAT
 coef_t faac_table_pow34[FAAC_SAMPLES_POW34+1] = {
     0,
-    128,
-    215,
-    292,
-    362,
-    428,
-    491,
-    551,
-    609,
-    665,
-    720,
-    773,
-    825,
-    876,
-    926,
-    976,
     1024,
-    1072,
-    1119,
-    1165,
-    1211,
-    1256,
-    1300,
-    1344,
-    1388,
-    1431,
-    1474,
-    1516,
-    1558,
-    1600,
-    1641,
-    1682,
     1722,
-    1762,
-    1802,
-    1842,
-    1881,
-    1920,
-    1959,
-    1998,
-    2036,
-    2074,
-    2112,
-    2149,
-    2187,
-    2224,
-    2261,
-    2298,
     2334,
-    2371,
-    2407,
-    2443,
-    2479,
-    2514,
-    2550,
-    2585,
-    2620,
-    2655,
-    2690,
-    2725,
-    2759,
-    2794,
-    2828,
-    2862,
     2896,
-    2930,
-    2964,
-    2998,
-    3031,
-    3064,
-    3098,
-    3131,
-    3164,
-    3197,
-    3229,
-    3262,
-    3295,
-    3327,
-    3360,
-    3392,
     3424,
-    3456,
-    3488,
-    3520,
-    3552,
-    3583,
-    3615,
-    3646,
-    3678,
-    3709,
-    3740,
-    3771,
-    3802,
-    3833,
-    3864,
-    3895,
     3926,
-    3956,
-    3987,
-    4017,
-    4048,
-    4078,
-    4108,
-    4138,
-    4169,
-    4199,
-    4229,
-    4258,
-    4288,
-    4318,
-    4348,
-    4377,
     4407,
-    4436,
-    4466,
-    4495,
-    4524,
-    4554,
-    4583,
-    4612,
-    4641,
-    4670,
-    4699,
-    4728,
-    4756,
-    4785,
-    4814,
-    4842,
     4871,
-    4900,
-    4928,
-    4956,
-    4985,
-    5013,
-    5041,
-    5069,
-    5098,
-    5126,
-    5154,
-    5182,
-    5210,
-    5238,
-    5265,
-    5293,
     5321,
-    5349,
-    5376,
-    5404,
-    5431,
-    5459,
-    5486,
-    5514,
-    5541,
-    5568,
-    5596,
-    5623,
-    5650,
-    5677,
-    5704,
-    5731,
     5758,
-    5785,
-    5812,
-    5839,
-    5866,
-    5893,
-    5920,
-    5946,
-    5973,
-    6000,
-    6026,
-    6053,
-    6079,
-    6106,
-    6132,
-    6159,
     6185,
-    6211,
-    6238,
-    6264,
-    6290,
-    6316,
-    6343,
-    6369,
-    6395,
-    6421,
-    6447,
-    6473,
-    6499,
-    6525,
-    6551,
-    6576,
     6602,
-    6628,
-    6654,
-    6679,
-    6705,
-    6731,
-    6756,
-    6782,
-    6807,
-    6833,
-    6858,
-    6884,
-    6909,
-    6935,
-    6960,
-    6985,
     7011,
-    7036,
-    7061,
-    7086,
-    7112,
-    7137,
-    7162,
-    7187,
-    7212,
-    7237,
-    7262,
-    7287,
-    7312,
-    7337,
-    7362,
-    7386,
     7411,
-    7436,
-    7461,
-    7486,
-    7510,
-    7535,
-    7560,
-    7584,
-    7609,
-    7634,
-    7658,
-    7683,
-    7707,
-    7732,
-    7756,
-    7781,
     7805,
-    7829,
-    7854,
-    7878,
-    7902,
-    7927,
-    7951,
-    7975,
-    7999,
-    8023,
-    8048,
-    8072,
-    8096,
-    8120,
-    8144,
-    8168,
     8192,
-    8216,
-    8240,
-    8264,
-    8288,
-    8312,
-    8336,
-    8359,
-    8383,
-    8407,
-    8431,
-    8455,
-    8478,
-    8502,
-    8526,
-    8549,
     8573,
-    8597,
-    8620,
-    8644,
-    8667,
-    8691,
-    8715,
-    8738,
-    8762,
-    8785,
-    8808,
-    8832,
-    8855,
-    8879,
-    8902,
-    8925,
     8949,
-    8972,
-    8995,
-    9018,
-    9042,
-    9065,
-    9088,
-    9111,
-    9134,
-    9158,
-    9181,
-    9204,
-    9227,
-    9250,
-    9273,
-    9296,
     9319,
-    9342,
-    9365,
-    9388,
-    9411,
-    9434,
-    9457,
-    9479,
-    9502,
-    9525,
-    9548,
-    9571,
-    9593,
-    9616,
-    9639,
-    9662,
     9684,
-    9707,
-    9730,
-    9752,
-    9775,
-    9798,
-    9820,
-    9843,
-    9865,
-    9888,
-    9910,
-    9933,
-    9956,
-    9978,
-    10000,
-    10023,
     10045,
-    10068,
-    10090,
-    10113,
-    10135,
-    10157,
-    10180,
-    10202,
-    10224,
-    10246,
-    10269,
-    10291,
-    10313,
-    10335,
-    10358,
-    10380,
     10402,
-    10424,
-    10446,
-    10468,
-    10491,
-    10513,
-    10535,
-    10557,
-    10579,
-    10601,
-    10623,
-    10645,
-    10667,
-    10689,
-    10711,
-    10733,
     10755,
-    10777,
-    10798,
-    10820,
-    10842,
-    10864,
-    10886,
-    10908,
-    10930,
-    10951,
-    10973,
-    10995,
-    11017,
-    11038,
-    11060,
-    11082,
     11103,
-    11125,
-    11147,
-    11168,
-    11190,
-    11212,
-    11233,
-    11255,
-    11277,
-    11298,
-    11320,
-    11341,
-    11363,
-    11384,
-    11406,
-    11427,
     11449,
-    11470,
-    11492,
-    11513,
-    11534,
-    11556,
-    11577,
-    11599,
-    11620,
-    11641,
-    11663,
-    11684,
-    11705,
-    11727,
-    11748,
-    11769,
     11790,
-    11812,
-    11833,
-    11854,
-    11875,
-    11897,
-    11918,
-    11939,
-    11960,
-    11981,
-    12002,
-    12023,
-    12045,
-    12066,
-    12087,
-    12108,
     12129,
-    12150,
-    12171,
-    12192,
-    12213,
-    12234,
-    12255,
-    12276,
-    12297,
-    12318,
-    12339,
-    12360,
-    12381,
-    12402,
-    12423,
-    12443,
     12464,
-    12485,
-    12506,
-    12527,
-    12548,
-    12569,
-    12589,
-    12610,
-    12631,
-    12652,
-    12672,
-    12693,
-    12714,
-    12735,
-    12755,
-    12776,
     12797,
-    12817,
-    12838,
-    12859,
-    12879,
-    12900,
-    12921,
-    12941,
-    12962,
-    12982,
-    13003,
-    13024,
-    13044,
-    13065,
-    13085,
-    13106,
     13126,
-    13147,
-    13167,
-    13188,
-    13208,
-    13229,
-    13249,
-    13270,
-    13290,
-    13310,
-    13331,
-    13351,
-    13372,
-    13392,
-    13412,
-    13433,
     13453,
-    13473,
-    13494,
-    13514,
-    13534,
-    13555,
-    13575,
-    13595,
-    13615,
-    13636,
-    13656,
-    13676,
-    13696,
-    13717,
-    13737,
-    13757,
     13777,
-    13797,
-    13818,
-    13838,
-    13858,
-    13878,
-    13898,
-    13918,
-    13938,
-    13958,
-    13979,
-    13999,
-    14019,
-    14039,
-    14059,
-    14079,
     14099,
-    14119,
-    14139,
-    14159,
-    14179,
-    14199,
-    14219,
-    14239,
-    14259,
-    14279,
-    14299,
-    14319,
-    14339,
-    14358,
-    14378,
-    14398,
     14418,
-    14438,
-    14458,
-    14478,
-    14498,
-    14517,
-    14537,
-    14557,
-    14577,
-    14597,
-    14616,
-    14636,
-    14656,
-    14676,
-    14696,
-    14715,
     14735,
-    14755,
-    14774,
-    14794,
-    14814,
-    14834,
-    14853,
-    14873,
-    14893,
-    14912,
-    14932,
-    14952,
-    14971,
-    14991,
-    15010,
-    15030,
     15050,
-    15069,
-    15089,
-    15108,
-    15128,
-    15148,
-    15167,
-    15187,
-    15206,
-    15226,
-    15245,
-    15265,
-    15284,
-    15304,
-    15323,
-    15343,
     15362,
-    15382,
-    15401,
-    15420,
-    15440,
-    15459,
-    15479,
-    15498,
-    15518,
-    15537,
-    15556,
-    15576,
-    15595,
-    15614,
-    15634,
-    15653,
     15672,
-    15692,
-    15711,
-    15730,
-    15750,
-    15769,
-    15788,
-    15808,
-    15827,
-    15846,
-    15865,
-    15885,
-    15904,
-    15923,
-    15942,
-    15962,
     15981,
-    16000,
-    16019,
-    16038,
-    16058,
-    16077,
-    16096,
-    16115,
-    16134,
-    16153,
-    16172,
-    16192,
-    16211,
-    16230,
-    16249,
-    16268,
     16287,
-    16306,
-    16325,
-    16344,
-    16363,
-    16382,
-    16402,
-    16421,
-    16440,
-    16459,
-    16478,
-    16497,
-    16516,
-    16535,
-    16554,
-    16573,
     16592,
-    16611,
-    16630,
-    16648,
-    16667,
-    16686,
-    16705,
-    16724,
-    16743,
-    16762,
-    16781,
-    16800,
-    16819,
-    16838,
-    16856,
-    16875,
     16894,
-    16913,
-    16932,
-    16951,
-    16970,
-    16988,
-    17007,
-    17026,
-    17045,
-    17064,
-    17082,
-    17101,
-    17120,
-    17139,
-    17157,
-    17176,
     17195,
-    17214,
-    17232,
-    17251,
-    17270,
-    17289,
-    17307,
-    17326,
-    17345,
-    17363,
-    17382,
-    17401,
-    17419,
-    17438,
-    17457,
-    17475,
     17494,
-    17513,
-    17531,
-    17550,
-    17569,
-    17587,
-    17606,
-    17624,
-    17643,
-    17661,
-    17680,
-    17699,
-    17717,
-    17736,
-    17754,
-    17773,
     17791,
-    17810,
-    17828,
-    17847,
-    17865,
-    17884,
-    17902,
-    17921,
-    17939,
-    17958,
-    17976,
-    17995,
-    18013,
-    18032,
-    18050,
-    18069,
     18087,
-    18106,
-    18124,
-    18142,
-    18161,
-    18179,
-    18198,
-    18216,
-    18234,
-    18253,
-    18271,
-    18289,
-    18308,
-    18326,
-    18345,
-    18363,
     18381,
-    18400,
-    18418,
-    18436,
-    18454,
-    18473,
-    18491,
-    18509,
-    18528,
-    18546,
-    18564,
-    18582,
-    18601,
-    18619,
-    18637,
-    18655,
     18674,
-    18692,
-    18710,
-    18728,
-    18747,
-    18765,
-    18783,
-    18801,
-    18819,
-    18838,
-    18856,
-    18874,
-    18892,
-    18910,
-    18928,
-    18947,
     18965,
-    18983,
-    19001,
-    19019,
-    19037,
-    19055,
-    19073,
-    19092,
-    19110,
-    19128,
-    19146,
-    19164,
-    19182,
-    19200,
-    19218,
-    19236,
     19254,
-    19272,
-    19290,
-    19308,
-    19326,
-    19344,
-    19362,
-    19381,
-    19399,
-    19417,
-    19435,
-    19453,
-    19470,
-    19488,
-    19506,
-    19524,
     19542,
-    19560,
-    19578,
-    19596,
-    19614,
-    19632,
-    19650,
-    19668,
-    19686,
-    19704,
-    19722,
-    19740,
-    19758,
-    19775,
-    19793,
-    19811,
     19829,
-    19847,
-    19865,
-    19883,
-    19901,
-    19918,
-    19936,
-    19954,
-    19972,
-    19990,
-    20008,
-    20025,
-    20043,
-    20061,
-    20079,
-    20097,
     20114,
-    20132,
-    20150,
-    20168,
-    20186,
-    20203,
-    20221,
-    20239,
-    20257,
-    20274,
-    20292,
-    20310,
-    20327,
-    20345,
-    20363,
-    20381,
     20398,
-    20416,
-    20434,
-    20451,
-    20469,
-    20487,
-    20505,
-    20522,
-    20540,
-    20558,
-    20575,
-    20593,
-    20610,
-    20628,
-    20646,
-    20663,
     20681,
-    20699,
-    20716,
-    20734,
-    20751,
-    20769,
-    20787,
-    20804,
-    20822,
-    20839,
-    20857,
-    20875,
-    20892,
-    20910,
-    20927,
-    20945,
     20962,
-    20980,
-    20997,
-    21015,
-    21033,
-    21050,
-    21068,
-    21085,
-    21103,
-    21120,
-    21138,
-    21155,
-    21173,
-    21190,
-    21208,
-    21225,
     21243,
-    21260,
-    21277,
-    21295,
-    21312,
-    21330,
-    21347,
-    21365,
-    21382,
-    21400,
-    21417,
-    21434,
-    21452,
-    21469,
-    21487,
-    21504,
     21521,
-    21539,
-    21556,
-    21574,
-    21591,
-    21608,
-    21626,
-    21643,
-    21660,
-    21678,
-    21695,
-    21712,
-    21730,
-    21747,
-    21764,
-    21782,
     21799,
-    21816,
-    21834,
-    21851,
-    21868,
-    21886,
-    21903,
-    21920,
-    21938,
-    21955,
-    21972,
-    21989,
-    22007,
-    22024,
-    22041,
-    22058,
     22076,
-    22093,
-    22110,
-    22127,
-    22145,
-    22162,
-    22179,
-    22196,
-    22213,
-    22231,
-    22248,
-    22265,
-    22282,
-    22299,
-    22317,
-    22334,
     22351,
-    22368,
-    22385,
-    22403,
-    22420,
-    22437,
-    22454,
-    22471,
-    22488,
-    22505,
-    22523,
-    22540,
-    22557,
-    22574,
-    22591,
-    22608,
     22625,
-    22642,
-    22659,
-    22677,
-    22694,
-    22711,
-    22728,
-    22745,
-    22762,
-    22779,
-    22796,
-    22813,
-    22830,
-    22847,
-    22864,
-    22881,
     22898,
-    22915,
-    22932,
-    22950,
-    22967,
-    22984,
-    23001,
-    23018,
-    23035,
-    23052,
-    23069,
-    23086,
-    23103,
-    23120,
-    23137,
-    23154,
     23170,
-    23187,
-    23204,
-    23221,
-    23238,
-    23255,
-    23272,
-    23289,
-    23306,
-    23323,
-    23340,
-    23357,
-    23374,
-    23391,
-    23408,
-    23425,
     23441,
-    23458,
-    23475,
-    23492,
-    23509,
-    23526,
-    23543,
-    23560,
-    23577,
-    23593,
-    23610,
-    23627,
-    23644,
-    23661,
-    23678,
-    23695,
     23711,
-    23728,
-    23745,
-    23762,
-    23779,
-    23796,
-    23812,
-    23829,
-    23846,
-    23863,
-    23880,
-    23896,
-    23913,
-    23930,
-    23947,
-    23964,
     23980,
-    23997,
-    24014,
-    24031,
-    24047,
-    24064,
-    24081,
-    24098,
-    24114,
-    24131,
-    24148,
-    24165,
-    24181,
-    24198,
-    24215,
-    24232,
     24248,
-    24265,
-    24282,
-    24298,
-    24315,
-    24332,
-    24349,
-    24365,
-    24382,
-    24399,
-    24415,
-    24432,
-    24449,
-    24465,
-    24482,
-    24499,
     24515,
-    24532,
-    24549,
-    24565,
-    24582,
-    24599,
-    24615,
-    24632,
-    24648,
-    24665,
-    24682,
-    24698,
-    24715,
-    24731,
-    24748,
-    24765,
     24781,
-    24798,
-    24814,
-    24831,
-    24848,
-    24864,
-    24881,
-    24897,
-    24914,
-    24930,
-    24947,
-    24964,
-    24980,
-    24997,
-    25013,
-    25030,
     25046,
-    25063,
-    25079,
-    25096,
-    25112,
-    25129,
-    25145,
-    25162,
-    25178,
-    25195,
-    25211,
-    25228,
-    25244,
-    25261,
-    25277,
-    25294,
     25310,
-    25327,
-    25343,
-    25360,
-    25376,
-    25393,
-    25409,
-    25426,
-    25442,
-    25459,
-    25475,
-    25491,
-    25508,
-    25524,
-    25541,
-    25557,
     25574,
-    25590,
-    25606,
-    25623,
-    25639,
-    25656,
-    25672,
-    25688,
-    25705,
-    25721,
-    25738,
-    25754,
-    25770,
-    25787,
-    25803,
-    25820,
     25836,
-    25852,
-    25869,
-    25885,
-    25901,
-    25918,
-    25934,
-    25950,
-    25967,
-    25983,
-    25999,
-    26016,
-    26032,
-    26048,
-    26065,
-    26081,
     26097,
-    26114,
-    26130,
-    26146,
-    26163,
-    26179,
-    26195,
-    26211,
-    26228,
-    26244,
-    26260,
-    26277,
-    26293,
-    26309,
-    26325,
-    26342,
     26358,
-    26374,
-    26390,
-    26407,
-    26423,
-    26439,
-    26455,
-    26472,
-    26488,
-    26504,
-    26520,
-    26536,
-    26553,
-    26569,
-    26585,
-    26601,
     26618,
-    26634,
-    26650,
-    26666,
-    26682,
-    26699,
-    26715,
-    26731,
-    26747,
-    26763,
-    26779,
-    26796,
-    26812,
-    26828,
-    26844,
-    26860,
     26876,
-    26893,
-    26909,
-    26925,
-    26941,
-    26957,
-    26973,
-    26989,
-    27005,
-    27022,
-    27038,
-    27054,
-    27070,
-    27086,
-    27102,
-    27118,
     27134,
-    27151,
-    27167,
-    27183,
-    27199,
-    27215,
-    27231,
-    27247,
-    27263,
-    27279,
-    27295,
-    27311,
-    27327,
-    27343,
-    27359,
-    27376,
     27392,
-    27408,
-    27424,
-    27440,
-    27456,
-    27472,
-    27488,
-    27504,
-    27520,
-    27536,
-    27552,
-    27568,
-    27584,
-    27600,
-    27616,
-    27632,
     27648,
-    27664,
-    27680,
-    27696,
-    27712,
-    27728,
-    27744,
-    27760,
-    27776,
-    27792,
-    27808,
-    27824,
-    27840,
-    27856,
-    27872,
-    27888,
     27904,
-    27920,
-    27936,
-    27951,
-    27967,
-    27983,
-    27999,
-    28015,
-    28031,
-    28047,
-    28063,
-    28079,
-    28095,
-    28111,
-    28127,
-    28143,
     28158,
-    28174,
-    28190,
-    28206,
-    28222,
-    28238,
-    28254,
-    28270,
-    28286,
-    28301,
-    28317,
-    28333,
-    28349,
-    28365,
-    28381,
-    28397,
     28412,
-    28428,
-    28444,
-    28460,
-    28476,
-    28492,
-    28508,
-    28523,
-    28539,
-    28555,
-    28571,
-    28587,
-    28603,
-    28618,
-    28634,
-    28650,
     28666,
-    28682,
-    28697,
-    28713,
-    28729,
-    28745,
-    28761,
-    28776,
-    28792,
-    28808,
-    28824,
-    28840,
-    28855,
-    28871,
-    28887,
-    28903,
     28918,
-    28934,
-    28950,
-    28966,
-    28981,
-    28997,
-    29013,
-    29029,
-    29044,
-    29060,
-    29076,
-    29092,
-    29107,
-    29123,
-    29139,
-    29154,
     29170,
-    29186,
-    29202,
-    29217,
-    29233,
-    29249,
-    29264,
-    29280,
-    29296,
-    29312,
-    29327,
-    29343,
-    29359,
-    29374,
-    29390,
-    29406,
     29421,
-    29437,
-    29453,
-    29468,
-    29484,
-    29500,
-    29515,
-    29531,
-    29547,
-    29562,
-    29578,
-    29594,
-    29609,
-    29625,
-    29640,
-    29656,
     29672,
-    29687,
-    29703,
-    29719,
-    29734,
-    29750,
-    29765,
-    29781,
-    29797,
-    29812,
-    29828,
-    29843,
-    29859,
-    29875,
-    29890,
-    29906,
     29921,
-    29937,
-    29953,
-    29968,
-    29984,
-    29999,
-    30015,
-    30030,
-    30046,
-    30062,
-    30077,
-    30093,
-    30108,
-    30124,
-    30139,
-    30155,
     30170,
-    30186,
-    30201,
-    30217,
-    30233,
-    30248,
-    30264,
-    30279,
-    30295,
-    30310,
-    30326,
-    30341,
-    30357,
-    30372,
-    30388,
-    30403,
     30419,
-    30434,
-    30450,
-    30465,
-    30481,
-    30496,
-    30512,
-    30527,
-    30543,
-    30558,
-    30574,
-    30589,
-    30605,
-    30620,
-    30635,
-    30651,
     30666,
-    30682,
-    30697,
-    30713,
-    30728,
-    30744,
-    30759,
-    30774,
-    30790,
-    30805,
-    30821,
-    30836,
-    30852,
-    30867,
-    30882,
-    30898,
     30913,
-    30929,
-    30944,
-    30960,
-    30975,
-    30990,
-    31006,
-    31021,
-    31037,
-    31052,
-    31067,
-    31083,
-    31098,
-    31114,
-    31129,
-    31144,
     31160,
-    31175,
-    31190,
-    31206,
-    31221,
-    31236,
-    31252,
-    31267,
-    31283,
-    31298,
-    31313,
-    31329,
-    31344,
-    31359,
-    31375,
-    31390,
     31405,
-    31421,
-    31436,
-    31451,
-    31467,
-    31482,
-    31497,
-    31513,
-    31528,
-    31543,
-    31559,
-    31574,
-    31589,
-    31604,
-    31620,
-    31635,
     31650,
-    31666,
-    31681,
-    31696,
-    31712,
-    31727,
-    31742,
-    31757,
-    31773,
-    31788,
-    31803,
-    31818,
-    31834,
-    31849,
-    31864,
-    31880,
     31895,
-    31910,
-    31925,
-    31941,
-    31956,
-    31971,
-    31986,
-    32002,
-    32017,
-    32032,
-    32047,
-    32062,
-    32078,
-    32093,
-    32108,
-    32123,
     32139,
-    32154,
-    32169,
-    32184,
-    32199,
-    32215,
-    32230,
-    32245,
-    32260,
-    32275,
-    32291,
-    32306,
-    32321,
-    32336,
-    32351,
-    32367,
     32382,
-    32397,
-    32412,
-    32427,
-    32442,
-    32458,
-    32473,
-    32488,
-    32503,
-    32518,
-    32533,
-    32549,
-    32564,
-    32579,
-    32594,
-    32609,
     32624,
-    32639,
-    32655,
-    32670,
-    32685,
-    32700,
-    32715,
-    32730,
-    32745,
-    32760,
-    32776,
-    32791,
-    32806,
-    32821,
-    32836,
-    32851,
     32866,
-    32881,
-    32896,
-    32912,
-    32927,
-    32942,
-    32957,
-    32972,
-    32987,
-    33002,
-    33017,
-    33032,
-    33047,
-    33062,
-    33077,
-    33093,
     33108,
-    33123,
-    33138,
-    33153,
-    33168,
-    33183,
-    33198,
-    33213,
-    33228,
-    33243,
-    33258,
-    33273,
-    33288,
-    33303,
-    33318,
-    33333,
     33348,
-    33363,
-    33378,
-    33393,
-    33409,
-    33424,
-    33439,
-    33454,
-    33469,
-    33484,
-    33499,
-    33514,
-    33529,
-    33544,
-    33559,
-    33574,
     33589,
-    33604,
-    33619,
-    33634,
-    33649,
-    33664,
-    33679,
-    33694,
-    33708,
-    33723,
-    33738,
-    33753,
-    33768,
-    33783,
-    33798,
-    33813,
     33828,
-    33843,
-    33858,
-    33873,
-    33888,
-    33903,
-    33918,
-    33933,
-    33948,
-    33963,
-    33978,
-    33993,
-    34008,
-    34023,
-    34037,
-    34052,
     34067,
-    34082,
-    34097,
-    34112,
-    34127,
-    34142,
-    34157,
-    34172,
-    34187,
-    34202,
-    34216,
-    34231,
-    34246,
-    34261,
-    34276,
-    34291,
     34306,
-    34321,
-    34336,
-    34350,
-    34365,
-    34380,
-    34395,
-    34410,
-    34425,
-    34440,
-    34455,
-    34469,
-    34484,
-    34499,
-    34514,
-    34529,
     34544,
-    34559,
-    34573,
-    34588,
-    34603,
-    34618,
-    34633,
-    34648,
-    34663,
-    34677,
-    34692,
-    34707,
-    34722,
-    34737,
-    34752,
-    34766,
     34781,
-    34796,
-    34811,
-    34826,
-    34840,
-    34855,
-    34870,
-    34885,
-    34900,
-    34915,
-    34929,
-    34944,
-    34959,
-    34974,
-    34988,
-    35003,
     35018,
-    35033,
-    35048,
-    35062,
-    35077,
-    35092,
-    35107,
-    35122,
-    35136,
-    35151,
-    35166,
-    35181,
-    35195,
-    35210,
-    35225,
-    35240,
     35254,
-    35269,
-    35284,
-    35299,
-    35313,
-    35328,
-    35343,
-    35358,
-    35372,
-    35387,
-    35402,
-    35417,
-    35431,
-    35446,
-    35461,
-    35476,
     35490,
-    35505,
-    35520,
-    35534,
-    35549,
-    35564,
-    35579,
-    35593,
-    35608,
-    35623,
-    35637,
-    35652,
-    35667,
-    35681,
-    35696,
-    35711,
     35726,
-    35740,
-    35755,
-    35770,
-    35784,
-    35799,
-    35814,
-    35828,
-    35843,
-    35858,
-    35872,
-    35887,
-    35902,
-    35916,
-    35931,
-    35946,
     35960,
-    35975,
-    35990,
-    36004,
-    36019,
-    36034,
-    36048,
-    36063,
-    36078,
-    36092,
-    36107,
-    36121,
-    36136,
-    36151,
-    36165,
-    36180,
     36195,
-    36209,
-    36224,
-    36238,
-    36253,
-    36268,
-    36282,
-    36297,
-    36312,
-    36326,
-    36341,
-    36355,
-    36370,
-    36385,
-    36399,
-    36414,
     36428,
-    36443,
-    36458,
-    36472,
-    36487,
-    36501,
-    36516,
-    36530,
-    36545,
-    36560,
-    36574,
-    36589,
-    36603,
-    36618,
-    36632,
-    36647,
     36662,
-    36676,
-    36691,
-    36705,
-    36720,
-    36734,
-    36749,
-    36764,
-    36778,
-    36793,
-    36807,
-    36822,
-    36836,
-    36851,
-    36865,
-    36880,
     36894,
-    36909,
-    36923,
-    36938,
-    36952,
-    36967,
-    36982,
-    36996,
-    37011,
-    37025,
-    37040,
-    37054,
-    37069,
-    37083,
-    37098,
-    37112,
     37127,
-    37141,
-    37156,
-    37170,
-    37185,
-    37199,
-    37214,
-    37228,
-    37243,
-    37257,
-    37272,
-    37286,
-    37301,
-    37315,
-    37330,
-    37344,
     37358,
-    37373,
-    37387,
-    37402,
-    37416,
-    37431,
-    37445,
-    37460,
-    37474,
-    37489,
-    37503,
-    37518,
-    37532,
-    37546,
-    37561,
-    37575,
     37590,
-    37604,
-    37619,
-    37633,
-    37648,
-    37662,
-    37676,
-    37691,
-    37705,
-    37720,
-    37734,
-    37749,
-    37763,
-    37777,
-    37792,
-    37806,
     37821,
-    37835,
-    37849,
-    37864,
-    37878,
-    37893,
-    37907,
-    37921,
-    37936,
-    37950,
-    37965,
-    37979,
-    37993,
-    38008,
-    38022,
-    38037,
     38051,
-    38065,
-    38080,
-    38094,
-    38109,
-    38123,
-    38137,
-    38152,
-    38166,
-    38180,
-    38195,
-    38209,
-    38223,
-    38238,
-    38252,
-    38267,
     38281,
-    38295,
-    38310,
-    38324,
-    38338,
-    38353,
-    38367,
-    38381,
-    38396,
-    38410,
-    38424,
-    38439,
-    38453,
-    38467,
-    38482,
-    38496,
     38510,
-    38525,
-    38539,
-    38553,
-    38568,
-    38582,
-    38596,
-    38611,
-    38625,
-    38639,
-    38654,
-    38668,
-    38682,
-    38696,
-    38711,
-    38725,
     38739,
-    38754,
-    38768,
-    38782,
-    38797,
-    38811,
-    38825,
-    38839,
-    38854,
-    38868,
-    38882,
-    38897,
-    38911,
-    38925,
-    38939,
-    38954,
     38968,
-    38982,
-    38996,
-    39011,
-    39025,
-    39039,
-    39054,
-    39068,
-    39082,
-    39096,
-    39111,
-    39125,
-    39139,
-    39153,
-    39168,
-    39182,
     39196,
-    39210,
-    39225,
-    39239,
-    39253,
-    39267,
-    39281,
-    39296,
-    39310,
-    39324,
-    39338,
-    39353,
-    39367,
-    39381,
-    39395,
-    39409,
     39424,
-    39438,
-    39452,
-    39466,
-    39481,
-    39495,
-    39509,
-    39523,
-    39537,
-    39552,
-    39566,
-    39580,
-    39594,
-    39608,
-    39623,
-    39637,
     39651,
-    39665,
-    39679,
-    39693,
-    39708,
-    39722,
-    39736,
-    39750,
-    39764,
-    39779,
-    39793,
-    39807,
-    39821,
-    39835,
-    39849,
-    39864,
     39878,
-    39892,
-    39906,
-    39920,
-    39934,
-    39949,
-    39963,
-    39977,
-    39991,
-    40005,
-    40019,
-    40033,
-    40048,
-    40062,
-    40076,
-    40090,
     40104,
-    40118,
-    40132,
-    40146,
-    40161,
-    40175,
-    40189,
-    40203,
-    40217,
-    40231,
-    40245,
-    40259,
-    40274,
-    40288,
-    40302,
-    40316,
     40330,
-    40344,
-    40358,
-    40372,
-    40386,
-    40401,
-    40415,
-    40429,
-    40443,
-    40457,
-    40471,
-    40485,
-    40499,
-    40513,
-    40527,
-    40541,
     40556,
-    40570,
-    40584,
-    40598,
-    40612,
-    40626,
-    40640,
-    40654,
-    40668,
-    40682,
-    40696,
-    40710,
-    40724,
-    40738,
-    40753,
-    40767,
     40781,
-    40795,
-    40809,
-    40823,
-    40837,
-    40851,
-    40865,
-    40879,
-    40893,
-    40907,
-    40921,
-    40935,
-    40949,
-    40963,
-    40977,
-    40991,
     41005,
-    41019,
-    41033,
-    41047,
-    41061,
-    41075,
-    41089,
-    41104,
-    41118,
-    41132,
-    41146,
-    41160,
-    41174,
-    41188,
-    41202,
-    41216,
     41230,
-    41244,
-    41258,
-    41272,
-    41286,
-    41300,
-    41314,
-    41328,
-    41342,
-    41356,
-    41370,
-    41384,
-    41398,
-    41412,
-    41426,
-    41440,
     41453,
-    41467,
-    41481,
-    41495,
-    41509,
-    41523,
-    41537,
-    41551,
-    41565,
-    41579,
-    41593,
-    41607,
-    41621,
-    41635,
-    41649,
-    41663,
     41677,
-    41691,
-    41705,
-    41719,
-    41733,
-    41747,
-    41761,
-    41775,
-    41789,
-    41802,
-    41816,
-    41830,
-    41844,
-    41858,
-    41872,
-    41886,
     41900,
-    41914,
-    41928,
-    41942,
-    41956,
-    41970,
-    41984,
-    41997,
-    42011,
-    42025,
-    42039,
-    42053,
-    42067,
-    42081,
-    42095,
-    42109,
     42123,
-    42137,
-    42151,
-    42164,
-    42178,
-    42192,
-    42206,
-    42220,
-    42234,
-    42248,
-    42262,
-    42276,
-    42289,
-    42303,
-    42317,
-    42331,
     42345,
-    42359,
-    42373,
-    42387,
-    42400,
-    42414,
-    42428,
-    42442,
-    42456,
-    42470,
-    42484,
-    42498,
-    42511,
-    42525,
-    42539,
-    42553,
     42567,
-    42581,
-    42595,
-    42608,
-    42622,
-    42636,
-    42650,
-    42664,
-    42678,
-    42692,
-    42705,
-    42719,
-    42733,
-    42747,
-    42761,
-    42775,
     42788,
-    42802,
-    42816,
-    42830,
-    42844,
-    42858,
-    42871,
-    42885,
-    42899,
-    42913,
-    42927,
-    42940,
-    42954,
-    42968,
-    42982,
-    42996,
     43010,
-    43023,
-    43037,
-    43051,
-    43065,
-    43079,
-    43092,
-    43106,
-    43120,
-    43134,
-    43148,
-    43161,
-    43175,
-    43189,
-    43203,
-    43216,
     43230,
-    43244,
-    43258,
-    43272,
-    43285,
-    43299,
-    43313,
-    43327,
-    43341,
-    43354,
-    43368,
-    43382,
-    43396,
-    43409,
-    43423,
-    43437,
     43451,
-    43464,
-    43478,
-    43492,
-    43506,
-    43519,
-    43533,
-    43547,
-    43561,
-    43574,
-    43588,
-    43602,
-    43616,
-    43629,
-    43643,
-    43657,
     43671,
-    43684,
-    43698,
-    43712,
-    43726,
-    43739,
-    43753,
-    43767,
-    43781,
-    43794,
-    43808,
-    43822,
-    43835,
-    43849,
-    43863,
-    43877,
     43890,
-    43904,
-    43918,
-    43931,
-    43945,
-    43959,
-    43973,
-    43986,
-    44000,
-    44014,
-    44027,
-    44041,
-    44055,
-    44068,
-    44082,
-    44096,
     44110,
-    44123,
-    44137,
-    44151,
-    44164,
-    44178,
-    44192,
-    44205,
-    44219,
-    44233,
-    44246,
-    44260,
-    44274,
-    44287,
-    44301,
-    44315,
     44328,
-    44342,
-    44356,
-    44369,
-    44383,
-    44397,
-    44410,
-    44424,
-    44438,
-    44451,
-    44465,
-    44479,
-    44492,
-    44506,
-    44520,
-    44533,
     44547,
-    44561,
-    44574,
-    44588,
-    44602,
-    44615,
-    44629,
-    44643,
-    44656,
-    44670,
-    44683,
-    44697,
-    44711,
-    44724,
-    44738,
-    44752,
     44765,
-    44779,
-    44792,
-    44806,
-    44820,
-    44833,
-    44847,
-    44861,
-    44874,
-    44888,
-    44901,
-    44915,
-    44929,
-    44942,
-    44956,
-    44969,
     44983,
-    44997,
-    45010,
-    45024,
-    45037,
-    45051,
-    45065,
-    45078,
-    45092,
-    45105,
-    45119,
-    45133,
-    45146,
-    45160,
-    45173,
-    45187,
     45201,
-    45214,
-    45228,
-    45241,
-    45255,
-    45268,
-    45282,
-    45296,
-    45309,
-    45323,
-    45336,
-    45350,
-    45363,
-    45377,
-    45391,
-    45404,
     45418,
-    45431,
-    45445,
-    45458,
-    45472,
-    45485,
-    45499,
-    45513,
-    45526,
-    45540,
-    45553,
-    45567,
-    45580,
-    45594,
-    45607,
-    45621,
     45634,
-    45648,
-    45662,
-    45675,
-    45689,
-    45702,
-    45716,
-    45729,
-    45743,
-    45756,
-    45770,
-    45783,
-    45797,
-    45810,
-    45824,
-    45837,
     45851,
-    45864,
-    45878,
-    45891,
-    45905,
-    45918,
-    45932,
-    45945,
-    45959,
-    45972,
-    45986,
-    46000,
-    46013,
-    46027,
-    46040,
-    46054,
     46067,
-    46080,
-    46094,
-    46107,
-    46121,
-    46134,
-    46148,
-    46161,
-    46175,
-    46188,
-    46202,
-    46215,
-    46229,
-    46242,
-    46256,
-    46269,
     46283,
-    46296,
-    46310,
-    46323,
-    46337,
-    46350,
-    46364,
-    46377,
-    46391,
-    46404,
-    46417,
-    46431,
-    46444,
-    46458,
-    46471,
-    46485,
     46498,
-    46512,
-    46525,
-    46539,
-    46552,
-    46565,
-    46579,
-    46592,
-    46606,
-    46619,
-    46633,
-    46646,
-    46660,
-    46673,
-    46686,
-    46700,
     46713,
-    46727,
-    46740,
-    46754,
-    46767,
-    46780,
-    46794,
-    46807,
-    46821,
-    46834,
-    46848,
-    46861,
-    46874,
-    46888,
-    46901,
-    46915,
     46928,
-    46941,
-    46955,
-    46968,
-    46982,
-    46995,
-    47009,
-    47022,
-    47035,
-    47049,
-    47062,
-    47076,
-    47089,
-    47102,
-    47116,
-    47129,
     47143,
-    47156,
-    47169,
-    47183,
-    47196,
-    47209,
-    47223,
-    47236,
-    47250,
-    47263,
-    47276,
-    47290,
-    47303,
-    47317,
-    47330,
-    47343,
     47357,
-    47370,
-    47383,
-    47397,
-    47410,
-    47424,
-    47437,
-    47450,
-    47464,
-    47477,
-    47490,
-    47504,
-    47517,
-    47530,
-    47544,
-    47557,
     47570,
-    47584,
-    47597,
-    47611,
-    47624,
-    47637,
-    47651,
-    47664,
-    47677,
-    47691,
-    47704,
-    47717,
-    47731,
-    47744,
-    47757,
-    47771,
     47784,
-    47797,
-    47811,
-    47824,
-    47837,
-    47851,
-    47864,
-    47877,
-    47891,
-    47904,
-    47917,
-    47931,
-    47944,
-    47957,
-    47970,
-    47984,
     47997,
-    48010,
-    48024,
-    48037,
-    48050,
-    48064,
-    48077,
-    48090,
-    48104,
-    48117,
-    48130,
-    48143,
-    48157,
-    48170,
-    48183,
-    48197,
     48210,
-    48223,
-    48237,
-    48250,
-    48263,
-    48276,
-    48290,
-    48303,
-    48316,
-    48330,
-    48343,
-    48356,
-    48369,
-    48383,
-    48396,
-    48409,
     48422,
-    48436,
-    48449,
-    48462,
-    48476,
-    48489,
-    48502,
-    48515,
-    48529,
-    48542,
-    48555,
-    48568,
-    48582,
-    48595,
-    48608,
-    48621,
     48635,
-    48648,
-    48661,
-    48674,
-    48688,
-    48701,
-    48714,
-    48727,
-    48741,
-    48754,
-    48767,
-    48780,
-    48794,
-    48807,
-    48820,
-    48833,
     48847,
-    48860,
-    48873,
-    48886,
-    48900,
-    48913,
-    48926,
-    48939,
-    48952,
-    48966,
-    48979,
-    48992,
-    49005,
-    49019,
-    49032,
-    49045,
     49058,
-    49071,
-    49085,
-    49098,
-    49111,
-    49124,
-    49138,
-    49151,
-    49164,
-    49177,
-    49190,
-    49204,
-    49217,
-    49230,
-    49243,
-    49256,
     49270,
-    49283,
-    49296,
-    49309,
-    49322,
-    49336,
-    49349,
-    49362,
-    49375,
-    49388,
-    49401,
-    49415,
-    49428,
-    49441,
-    49454,
-    49467,
     49481,
-    49494,
-    49507,
-    49520,
-    49533,
-    49546,
-    49560,
-    49573,
-    49586,
-    49599,
-    49612,
-    49625,
-    49639,
-    49652,
-    49665,
-    49678,
     49691,
-    49704,
-    49718,
-    49731,
-    49744,
-    49757,
-    49770,
-    49783,
-    49796,
-    49810,
-    49823,
-    49836,
-    49849,
-    49862,
-    49875,
-    49889,
     49902,
-    49915,
-    49928,
-    49941,
-    49954,
-    49967,
-    49980,
-    49994,
-    50007,
-    50020,
-    50033,
-    50046,
-    50059,
-    50072,
-    50086,
-    50099,
     50112,
-    50125,
-    50138,
-    50151,
-    50164,
-    50177,
-    50190,
-    50204,
-    50217,
-    50230,
-    50243,
-    50256,
-    50269,
-    50282,
-    50295,
-    50308,
     50322,
-    50335,
-    50348,
-    50361,
-    50374,
-    50387,
-    50400,
-    50413,
-    50426,
-    50439,
-    50453,
-    50466,
-    50479,
-    50492,
-    50505,
-    50518,
     50531,
-    50544,
-    50557,
-    50570,
-    50583,
-    50597,
-    50610,
-    50623,
-    50636,
-    50649,
-    50662,
-    50675,
-    50688,
-    50701,
-    50714,
-    50727,
     50740,
-    50753,
-    50766,
-    50780,
-    50793,
-    50806,
-    50819,
-    50832,
-    50845,
-    50858,
-    50871,
-    50884,
-    50897,
-    50910,
-    50923,
-    50936,
     50949,
-    50962,
-    50975,
-    50988,
-    51001,
-    51015,
-    51028,
-    51041,
-    51054,
-    51067,
-    51080,
-    51093,
-    51106,
-    51119,
-    51132,
-    51145,
     51158,
-    51171,
-    51184,
-    51197,
-    51210,
-    51223,
-    51236,
-    51249,
-    51262,
-    51275,
-    51288,
-    51301,
-    51314,
-    51327,
-    51340,
-    51353,
     51366,
-    51379,
-    51392,
-    51405,
-    51418,
-    51431,
-    51444,
-    51457,
-    51470,
-    51483,
-    51496,
-    51509,
-    51522,
-    51535,
-    51548,
-    51561,
     51574,
-    51587,
-    51600,
-    51613,
-    51626,
-    51639,
-    51652,
-    51665,
-    51678,
-    51691,
-    51704,
-    51717,
-    51730,
-    51743,
-    51756,
-    51769,
     51782,
-    51795,
-    51808,
-    51821,
-    51834,
-    51847,
-    51860,
-    51873,
-    51886,
-    51899,
-    51912,
-    51925,
-    51938,
-    51951,
-    51964,
-    51977,
     51990,
-    52003,
-    52016,
-    52029,
-    52042,
-    52055,
-    52068,
-    52081,
-    52093,
-    52106,
-    52119,
-    52132,
-    52145,
-    52158,
-    52171,
-    52184,
     52197,
-    52210,
-    52223,
-    52236,
-    52249,
-    52262,
-    52275,
-    52288,
-    52301,
-    52314,
-    52326,
-    52339,
-    52352,
-    52365,
-    52378,
-    52391,
     52404,
-    52417,
-    52430,
-    52443,
-    52456,
-    52469,
-    52482,
-    52495,
-    52507,
-    52520,
-    52533,
-    52546,
-    52559,
-    52572,
-    52585,
-    52598,
     52611,
-    52624,
-    52637,
-    52650,
-    52662,
-    52675,
-    52688,
-    52701,
-    52714,
-    52727,
-    52740,
-    52753,
-    52766,
-    52779,
-    52791,
-    52804,
     52817,
-    52830,
-    52843,
-    52856,
-    52869,
-    52882,
-    52895,
-    52907,
-    52920,
-    52933,
-    52946,
-    52959,
-    52972,
-    52985,
-    52998,
-    53011,
     53023,
-    53036,
-    53049,
-    53062,
-    53075,
-    53088,
-    53101,
-    53114,
-    53126,
-    53139,
-    53152,
-    53165,
-    53178,
-    53191,
-    53204,
-    53216,
     53229,
-    53242,
-    53255,
-    53268,
-    53281,
-    53294,
-    53307,
-    53319,
-    53332,
-    53345,
-    53358,
-    53371,
-    53384,
-    53396,
-    53409,
-    53422,
     53435,
-    53448,
-    53461,
-    53474,
-    53486,
-    53499,
-    53512,
-    53525,
-    53538,
-    53551,
-    53563,
-    53576,
-    53589,
-    53602,
-    53615,
-    53628,
     53640,
-    53653,
-    53666,
-    53679,
-    53692,
-    53705,
-    53717,
-    53730,
-    53743,
-    53756,
-    53769,
-    53781,
-    53794,
-    53807,
-    53820,
-    53833,
     53846,
-    53858,
-    53871,
-    53884,
-    53897,
-    53910,
-    53922,
-    53935,
-    53948,
-    53961,
-    53974,
-    53986,
-    53999,
-    54012,
-    54025,
-    54038,
     54050,
-    54063,
-    54076,
-    54089,
-    54102,
-    54114,
-    54127,
-    54140,
-    54153,
-    54166,
-    54178,
-    54191,
-    54204,
-    54217,
-    54229,
-    54242,
     54255,
-    54268,
-    54281,
-    54293,
-    54306,
-    54319,
-    54332,
-    54344,
-    54357,
-    54370,
-    54383,
-    54396,
-    54408,
-    54421,
-    54434,
-    54447,
     54459,
-    54472,
-    54485,
-    54498,
-    54510,
-    54523,
-    54536,
-    54549,
-    54561,
-    54574,
-    54587,
-    54600,
-    54612,
-    54625,
-    54638,
-    54651,
     54663,
-    54676,
-    54689,
-    54702,
-    54714,
-    54727,
-    54740,
-    54753,
-    54765,
-    54778,
-    54791,
-    54804,
-    54816,
-    54829,
-    54842,
-    54855,
     54867,
-    54880,
-    54893,
-    54905,
-    54918,
-    54931,
-    54944,
-    54956,
-    54969,
-    54982,
-    54995,
-    55007,
-    55020,
-    55033,
-    55045,
-    55058,
     55071,
-    55084,
-    55096,
-    55109,
-    55122,
-    55134,
-    55147,
-    55160,
-    55173,
-    55185,
-    55198,
-    55211,
-    55223,
-    55236,
-    55249,
-    55262,
     55274,
-    55287,
-    55300,
-    55312,
-    55325,
-    55338,
-    55350,
-    55363,
-    55376,
-    55388,
-    55401,
-    55414,
-    55427,
-    55439,
-    55452,
-    55465,
     55477,
-    55490,
-    55503,
-    55515,
-    55528,
-    55541,
-    55553,
-    55566,
-    55579,
-    55591,
-    55604,
-    55617,
-    55629,
-    55642,
-    55655,
-    55667,
     55680,
-    55693,
-    55705,
-    55718,
-    55731,
-    55743,
-    55756,
-    55769,
-    55781,
-    55794,
-    55807,
-    55819,
-    55832,
-    55845,
-    55857,
-    55870,
     55883,
-    55895,
-    55908,
-    55921,
-    55933,
-    55946,
-    55959,
-    55971,
-    55984,
-    55997,
-    56009,
-    56022,
-    56035,
-    56047,
-    56060,
-    56072,
     56085,
-    56098,
-    56110,
-    56123,
-    56136,
-    56148,
-    56161,
-    56174,
-    56186,
-    56199,
-    56211,
-    56224,
-    56237,
-    56249,
-    56262,
-    56275,
     56287,
-    56300,
-    56312,
-    56325,
-    56338,
-    56350,
-    56363,
-    56376,
-    56388,
-    56401,
-    56413,
-    56426,
-    56439,
-    56451,
-    56464,
-    56476,
     56489,
-    56502,
-    56514,
-    56527,
-    56539,
-    56552,
-    56565,
-    56577,
-    56590,
-    56603,
-    56615,
-    56628,
-    56640,
-    56653,
-    56666,
-    56678,
     56691,
-    56703,
-    56716,
-    56728,
-    56741,
-    56754,
-    56766,
-    56779,
-    56791,
-    56804,
-    56817,
-    56829,
-    56842,
-    56854,
-    56867,
-    56880,
     56892,
-    56905,
-    56917,
-    56930,
-    56942,
-    56955,
-    56968,
-    56980,
-    56993,
-    57005,
-    57018,
-    57030,
-    57043,
-    57056,
-    57068,
-    57081,
     57093,
-    57106,
-    57118,
-    57131,
-    57143,
-    57156,
-    57169,
-    57181,
-    57194,
-    57206,
-    57219,
-    57231,
-    57244,
-    57256,
-    57269,
-    57282,
     57294,
-    57307,
-    57319,
-    57332,
-    57344,
-    57357,
-    57369,
-    57382,
-    57395,
-    57407,
-    57420,
-    57432,
-    57445,
-    57457,
-    57470,
-    57482,
     57495,
-    57507,
-    57520,
-    57532,
-    57545,
-    57557,
-    57570,
-    57583,
-    57595,
-    57608,
-    57620,
-    57633,
-    57645,
-    57658,
-    57670,
-    57683,
     57695,
-    57708,
-    57720,
-    57733,
-    57745,
-    57758,
-    57770,
-    57783,
-    57795,
-    57808,
-    57820,
-    57833,
-    57845,
-    57858,
-    57870,
-    57883,
     57895,
-    57908,
-    57921,
-    57933,
-    57946,
-    57958,
-    57971,
-    57983,
-    57996,
-    58008,
-    58021,
-    58033,
-    58046,
-    58058,
-    58070,
-    58083,
     58095,
-    58108,
-    58120,
-    58133,
-    58145,
-    58158,
-    58170,
-    58183,
-    58195,
-    58208,
-    58220,
-    58233,
-    58245,
-    58258,
-    58270,
-    58283,
     58295,
-    58308,
-    58320,
-    58333,
-    58345,
-    58358,
-    58370,
-    58383,
-    58395,
-    58407,
-    58420,
-    58432,
-    58445,
-    58457,
-    58470,
-    58482,
     58495,
-    58507,
-    58520,
-    58532,
-    58545,
-    58557,
-    58570,
-    58582,
-    58594,
-    58607,
-    58619,
-    58632,
-    58644,
-    58657,
-    58669,
-    58682,
     58694,
-    58707,
-    58719,
-    58731,
-    58744,
-    58756,
-    58769,
-    58781,
-    58794,
-    58806,
-    58819,
-    58831,
-    58843,
-    58856,
-    58868,
-    58881,
     58893,
-    58906,
-    58918,
-    58930,
-    58943,
-    58955,
-    58968,
-    58980,
-    58993,
-    59005,
-    59017,
-    59030,
-    59042,
-    59055,
-    59067,
-    59080,
     59092,
-    59104,
-    59117,
-    59129,
-    59142,
-    59154,
-    59167,
-    59179,
-    59191,
-    59204,
-    59216,
-    59229,
-    59241,
-    59253,
-    59266,
-    59278,
     59291,
-    59303,
-    59315,
-    59328,
-    59340,
-    59353,
-    59365,
-    59377,
-    59390,
-    59402,
-    59415,
-    59427,
-    59439,
-    59452,
-    59464,
-    59477,
     59489,
-    59501,
-    59514,
-    59526,
-    59539,
-    59551,
-    59563,
-    59576,
-    59588,
-    59601,
-    59613,
-    59625,
-    59638,
-    59650,
-    59662,
-    59675,
     59687,
-    59700,
-    59712,
-    59724,
-    59737,
-    59749,
-    59761,
-    59774,
-    59786,
-    59799,
-    59811,
-    59823,
-    59836,
-    59848,
-    59860,
-    59873,
     59885,
-    59898,
-    59910,
-    59922,
-    59935,
-    59947,
-    59959,
-    59972,
-    59984,
-    59996,
-    60009,
-    60021,
-    60034,
-    60046,
-    60058,
-    60071,
     60083,
-    60095,
-    60108,
-    60120,
-    60132,
-    60145,
-    60157,
-    60169,
-    60182,
-    60194,
-    60206,
-    60219,
-    60231,
-    60243,
-    60256,
-    60268,
     60280,
-    60293,
-    60305,
-    60317,
-    60330,
-    60342,
-    60354,
-    60367,
-    60379,
-    60391,
-    60404,
-    60416,
-    60428,
-    60441,
-    60453,
-    60465,
     60478,
-    60490,
-    60502,
-    60515,
-    60527,
-    60539,
-    60552,
-    60564,
-    60576,
-    60589,
-    60601,
-    60613,
-    60626,
-    60638,
-    60650,
-    60663,
     60675,
-    60687,
-    60700,
-    60712,
-    60724,
-    60736,
-    60749,
-    60761,
-    60773,
-    60786,
-    60798,
-    60810,
-    60823,
-    60835,
-    60847,
-    60859,
     60872,
-    60884,
-    60896,
-    60909,
-    60921,
-    60933,
-    60946,
-    60958,
-    60970,
-    60982,
-    60995,
-    61007,
-    61019,
-    61032,
-    61044,
-    61056,
     61068,
-    61081,
-    61093,
-    61105,
-    61118,
-    61130,
-    61142,
-    61154,
-    61167,
-    61179,
-    61191,
-    61204,
-    61216,
-    61228,
-    61240,
-    61253,
     61265,
-    61277,
-    61289,
-    61302,
-    61314,
-    61326,
-    61339,
-    61351,
-    61363,
-    61375,
-    61388,
-    61400,
-    61412,
-    61424,
-    61437,
-    61449,
     61461,
-    61473,
-    61486,
-    61498,
-    61510,
-    61522,
-    61535,
-    61547,
-    61559,
-    61571,
-    61584,
-    61596,
-    61608,
-    61620,
-    61633,
-    61645,
     61657,
-    61669,
-    61682,
-    61694,
-    61706,
-    61718,
-    61731,
-    61743,
-    61755,
-    61767,
-    61780,
-    61792,
-    61804,
-    61816,
-    61829,
-    61841,
     61853,
-    61865,
-    61878,
-    61890,
-    61902,
-    61914,
-    61926,
-    61939,
-    61951,
-    61963,
-    61975,
-    61988,
-    62000,
-    62012,
-    62024,
-    62036,
     62049,
-    62061,
-    62073,
-    62085,
-    62098,
-    62110,
-    62122,
-    62134,
-    62146,
-    62159,
-    62171,
-    62183,
-    62195,
-    62207,
-    62220,
-    62232,
     62244,
-    62256,
-    62269,
-    62281,
-    62293,
-    62305,
-    62317,
-    62330,
-    62342,
-    62354,
-    62366,
-    62378,
-    62391,
-    62403,
-    62415,
-    62427,
     62439,
-    62452,
-    62464,
-    62476,
-    62488,
-    62500,
-    62513,
-    62525,
-    62537,
-    62549,
-    62561,
-    62573,
-    62586,
-    62598,
-    62610,
-    62622,
     62634,
-    62647,
-    62659,
-    62671,
-    62683,
-    62695,
-    62707,
-    62720,
-    62732,
-    62744,
-    62756,
-    62768,
-    62781,
-    62793,
-    62805,
-    62817,
     62829,
-    62841,
-    62854,
-    62866,
-    62878,
-    62890,
-    62902,
-    62914,
-    62927,
-    62939,
-    62951,
-    62963,
-    62975,
-    62987,
-    62999,
-    63012,
     63024,
-    63036,
-    63048,
-    63060,
-    63072,
-    63085,
-    63097,
-    63109,
-    63121,
-    63133,
-    63145,
-    63157,
-    63170,
-    63182,
-    63194,
-    63206,
     63218,
-    63230,
-    63243,
-    63255,
-    63267,
-    63279,
-    63291,
-    63303,
-    63315,
-    63328,
-    63340,
-    63352,
-    63364,
-    63376,
-    63388,
-    63400,
     63412,
-    63425,
-    63437,
-    63449,
-    63461,
-    63473,
-    63485,
-    63497,
-    63509,
-    63522,
-    63534,
-    63546,
-    63558,
-    63570,
-    63582,
-    63594,
     63606,
-    63619,
-    63631,
-    63643,
-    63655,
-    63667,
-    63679,
-    63691,
-    63703,
-    63716,
-    63728,
-    63740,
-    63752,
-    63764,
-    63776,
-    63788,
     63800,
-    63812,
-    63825,
-    63837,
-    63849,
-    63861,
-    63873,
-    63885,
-    63897,
-    63909,
-    63921,
-    63933,
-    63946,
-    63958,
-    63970,
-    63982,
     63994,
-    64006,
-    64018,
-    64030,
-    64042,
-    64054,
-    64066,
-    64079,
-    64091,
-    64103,
-    64115,
-    64127,
-    64139,
-    64151,
-    64163,
-    64175,
     64187,
-    64199,
-    64212,
-    64224,
-    64236,
-    64248,
-    64260,
-    64272,
-    64284,
-    64296,
-    64308,
-    64320,
-    64332,
-    64344,
-    64356,
-    64369,
     64381,
-    64393,
-    64405,
-    64417,
-    64429,
-    64441,
-    64453,
-    64465,
-    64477,
-    64489,
-    64501,
-    64513,
-    64525,
-    64537,
-    64550,
-    64562,
     64574,
-    64586,
-    64598,
-    64610,
-    64622,
-    64634,
-    64646,
-    64658,
-    64670,
-    64682,
-    64694,
-    64706,
-    64718,
-    64730,
-    64742,
-    64754,
     64766,
-    64779,
-    64791,
-    64803,
-    64815,
-    64827,
-    64839,
-    64851,
-    64863,
-    64875,
-    64887,
-    64899,
-    64911,
-    64923,
-    64935,
-    64947,
     64959,
-    64971,
-    64983,
-    64995,
-    65007,
-    65019,
-    65031,
-    65043,
-    65055,
-    65067,
-    65079,
-    65091,
-    65104,
-    65116,
-    65128,
-    65140,
     65152,
-    65164,
-    65176,
-    65188,
-    65200,
-    65212,
-    65224,
-    65236,
-    65248,
-    65260,
-    65272,
-    65284,
-    65296,
-    65308,
-    65320,
-    65332,
     65344,
-    65356,
-    65368,
-    65380,
-    65392,
-    65404,
-    65416,
-    65428,
-    65440,
-    65452,
-    65464,
-    65476,
-    65488,
-    65500,
-    65512,
-    65524,
     65536,
-    65548,
-    65560,
-    65572,
-    65584,
-    65596,
-    65608,
-    65620,
-    65632,
-    65644,
-    65656,
-    65668,
-    65680,
-    65692,
-    65704,
-    65716,
     65728,
-    65740,
-    65752,
-    65764,
-    65776,
-    65788,
-    65800,
-    65812,
-    65824,
-    65836,
-    65848,
-    65860,
-    65872,
-    65884,
-    65896,
-    65908,
     65920,
-    65932,
-    65944,
-    65956,
-    65968,
-    65980,
-    65991,
-    66003,
-    66015,
-    66027,
-    66039,
-    66051,
-    66063,
-    66075,
-    66087,
-    66099,
     66111,
-    66123,
-    66135,
-    66147,
-    66159,
-    66171,
-    66183,
-    66195,
-    66207,
-    66219,
-    66231,
-    66243,
-    66255,
-    66267,
-    66279,
-    66291,
     66303,
-    66314,
-    66326,
-    66338,
-    66350,
-    66362,
-    66374,
-    66386,
-    66398,
-    66410,
-    66422,
-    66434,
-    66446,
-    66458,
-    66470,
-    66482,
     66494,
-    66506,
-    66518,
-    66529,
-    66541,
-    66553,
-    66565,
-    66577,
-    66589,
-    66601,
-    66613,
-    66625,
-    66637,
-    66649,
-    66661,
-    66673,
     66685,
-    66697,
-    66709,
-    66720,
-    66732,
-    66744,
-    66756,
-    66768,
-    66780,
-    66792,
-    66804,
-    66816,
-    66828,
-    66840,
-    66852,
-    66864,
     66875,
-    66887,
-    66899,
-    66911,
-    66923,
-    66935,
-    66947,
-    66959,
-    66971,
-    66983,
-    66995,
-    67007,
-    67018,
-    67030,
-    67042,
-    67054,
     67066,
-    67078,
-    67090,
-    67102,
-    67114,
-    67126,
-    67138,
-    67149,
-    67161,
-    67173,
-    67185,
-    67197,
-    67209,
-    67221,
-    67233,
-    67245,
     67257,
-    67268,
-    67280,
-    67292,
-    67304,
-    67316,
-    67328,
-    67340,
-    67352,
-    67364,
-    67375,
-    67387,
-    67399,
-    67411,
-    67423,
-    67435,
     67447,
-    67459,
-    67471,
-    67482,
-    67494,
-    67506,
-    67518,
-    67530,
-    67542,
-    67554,
-    67566,
-    67577,
-    67589,
-    67601,
-    67613,
-    67625,
     67637,
-    67649,
-    67661,
-    67672,
-    67684,
-    67696,
-    67708,
-    67720,
-    67732,
-    67744,
-    67756,
-    67767,
-    67779,
-    67791,
-    67803,
-    67815,
     67827,
-    67839,
-    67850,
-    67862,
-    67874,
-    67886,
-    67898,
-    67910,
-    67922,
-    67933,
-    67945,
-    67957,
-    67969,
-    67981,
-    67993,
-    68005,
     68016,
-    68028,
-    68040,
-    68052,
-    68064,
-    68076,
-    68088,
-    68099,
-    68111,
-    68123,
-    68135,
-    68147,
-    68159,
-    68171,
-    68182,
-    68194,
     68206,
-    68218,
-    68230,
-    68242,
-    68253,
-    68265,
-    68277,
-    68289,
-    68301,
-    68313,
-    68324,
-    68336,
-    68348,
-    68360,
-    68372,
-    68384,
     68395,
-    68407,
-    68419,
-    68431,
-    68443,
-    68455,
-    68466,
-    68478,
-    68490,
-    68502,
-    68514,
-    68525,
-    68537,
-    68549,
-    68561,
-    68573,
     68585,
-    68596,
-    68608,
-    68620,
-    68632,
-    68644,
-    68656,
-    68667,
-    68679,
-    68691,
-    68703,
-    68715,
-    68726,
-    68738,
-    68750,
-    68762,
     68774,
-    68785,
-    68797,
-    68809,
-    68821,
-    68833,
-    68844,
-    68856,
-    68868,
-    68880,
-    68892,
-    68903,
-    68915,
-    68927,
-    68939,
-    68951,
     68962,
-    68974,
-    68986,
-    68998,
-    69010,
-    69021,
-    69033,
-    69045,
-    69057,
-    69069,
-    69080,
-    69092,
-    69104,
-    69116,
-    69128,
-    69139,
     69151,
-    69163,
-    69175,
-    69187,
-    69198,
-    69210,
-    69222,
-    69234,
-    69245,
-    69257,
-    69269,
-    69281,
-    69293,
-    69304,
-    69316,
-    69328,
     69340,
-    69351,
-    69363,
-    69375,
-    69387,
-    69399,
-    69410,
-    69422,
-    69434,
-    69446,
-    69457,
-    69469,
-    69481,
-    69493,
-    69504,
-    69516,
     69528,
-    69540,
-    69552,
-    69563,
-    69575,
-    69587,
-    69599,
-    69610,
-    69622,
-    69634,
-    69646,
-    69657,
-    69669,
-    69681,
-    69693,
-    69704,
     69716,
-    69728,
-    69740,
-    69751,
-    69763,
-    69775,
-    69787,
-    69798,
-    69810,
-    69822,
-    69834,
-    69845,
-    69857,
-    69869,
-    69881,
-    69892,
     69904,
-    69916,
-    69928,
-    69939,
-    69951,
-    69963,
-    69975,
-    69986,
-    69998,
-    70010,
-    70022,
-    70033,
-    70045,
-    70057,
-    70069,
-    70080,
     70092,
-    70104,
-    70115,
-    70127,
-    70139,
-    70151,
-    70162,
-    70174,
-    70186,
-    70198,
-    70209,
-    70221,
-    70233,
-    70244,
-    70256,
-    70268,
     70280,
-    70291,
-    70303,
-    70315,
-    70327,
-    70338,
-    70350,
-    70362,
-    70373,
-    70385,
-    70397,
-    70409,
-    70420,
-    70432,
-    70444,
-    70455,
     70467,
-    70479,
-    70491,
-    70502,
-    70514,
-    70526,
-    70537,
-    70549,
-    70561,
-    70573,
-    70584,
-    70596,
-    70608,
-    70619,
-    70631,
-    70643,
     70654,
-    70666,
-    70678,
-    70690,
-    70701,
-    70713,
-    70725,
-    70736,
-    70748,
-    70760,
-    70771,
-    70783,
-    70795,
-    70807,
-    70818,
-    70830,
     70842,
-    70853,
-    70865,
-    70877,
-    70888,
-    70900,
-    70912,
-    70923,
-    70935,
-    70947,
-    70959,
-    70970,
-    70982,
-    70994,
-    71005,
-    71017,
     71029,
-    71040,
-    71052,
-    71064,
-    71075,
-    71087,
-    71099,
-    71110,
-    71122,
-    71134,
-    71145,
-    71157,
-    71169,
-    71180,
-    71192,
-    71204,
     71215,
-    71227,
-    71239,
-    71251,
-    71262,
-    71274,
-    71286,
-    71297,
-    71309,
-    71321,
-    71332,
-    71344,
-    71356,
-    71367,
-    71379,
-    71391,
     71402,
-    71414,
-    71425,
-    71437,
-    71449,
-    71460,
-    71472,
-    71484,
-    71495,
-    71507,
-    71519,
-    71530,
-    71542,
-    71554,
-    71565,
-    71577,
     71589,
-    71600,
-    71612,
-    71624,
-    71635,
-    71647,
-    71659,
-    71670,
-    71682,
-    71694,
-    71705,
-    71717,
-    71728,
-    71740,
-    71752,
-    71763,
     71775,
-    71787,
-    71798,
-    71810,
-    71822,
-    71833,
-    71845,
-    71856,
-    71868,
-    71880,
-    71891,
-    71903,
-    71915,
-    71926,
-    71938,
-    71950,
     71961,
-    71973,
-    71984,
-    71996,
-    72008,
-    72019,
-    72031,
-    72043,
-    72054,
-    72066,
-    72077,
-    72089,
-    72101,
-    72112,
-    72124,
-    72136,
     72147,
-    72159,
-    72170,
-    72182,
-    72194,
-    72205,
-    72217,
-    72229,
-    72240,
-    72252,
-    72263,
-    72275,
-    72287,
-    72298,
-    72310,
-    72321,
     72333,
-    72345,
-    72356,
-    72368,
-    72380,
-    72391,
-    72403,
-    72414,
-    72426,
-    72438,
-    72449,
-    72461,
-    72472,
-    72484,
-    72496,
-    72507,
     72519,
-    72530,
-    72542,
-    72554,
-    72565,
-    72577,
-    72588,
-    72600,
-    72612,
-    72623,
-    72635,
-    72646,
-    72658,
-    72670,
-    72681,
-    72693,
     72704,
-    72716,
-    72728,
-    72739,
-    72751,
-    72762,
-    72774,
-    72785,
-    72797,
-    72809,
-    72820,
-    72832,
-    72843,
-    72855,
-    72867,
-    72878,
     72890,
-    72901,
-    72913,
-    72924,
-    72936,
-    72948,
-    72959,
-    72971,
-    72982,
-    72994,
-    73006,
-    73017,
-    73029,
-    73040,
-    73052,
-    73063,
     73075,
-    73087,
-    73098,
-    73110,
-    73121,
-    73133,
-    73144,
-    73156,
-    73168,
-    73179,
-    73191,
-    73202,
-    73214,
-    73225,
-    73237,
-    73249,
     73260,
-    73272,
-    73283,
-    73295,
-    73306,
-    73318,
-    73329,
-    73341,
-    73353,
-    73364,
-    73376,
-    73387,
-    73399,
-    73410,
-    73422,
-    73433,
     73445,
-    73457,
-    73468,
-    73480,
-    73491,
-    73503,
-    73514,
-    73526,
-    73537,
-    73549,
-    73560,
-    73572,
-    73584,
-    73595,
-    73607,
-    73618,
     73630,
-    73641,
-    73653,
-    73664,
-    73676,
-    73687,
-    73699,
-    73711,
-    73722,
-    73734,
-    73745,
-    73757,
-    73768,
-    73780,
-    73791,
-    73803,
     73814,
-    73826,
-    73837,
-    73849,
-    73860,
-    73872,
-    73884,
-    73895,
-    73907,
-    73918,
-    73930,
-    73941,
-    73953,
-    73964,
-    73976,
-    73987,
     73999,
-    74010,
-    74022,
-    74033,
-    74045,
-    74056,
-    74068,
-    74079,
-    74091,
-    74103,
-    74114,
-    74126,
-    74137,
-    74149,
-    74160,
-    74172,
     74183,
-    74195,
-    74206,
-    74218,
-    74229,
-    74241,
-    74252,
-    74264,
-    74275,
-    74287,
-    74298,
-    74310,
-    74321,
-    74333,
-    74344,
-    74356,
     74367,
-    74379,
-    74390,
-    74402,
-    74413,
-    74425,
-    74436,
-    74448,
-    74459,
-    74471,
-    74482,
-    74494,
-    74505,
-    74517,
-    74528,
-    74540,
     74551,
-    74563,
-    74574,
-    74586,
-    74597,
-    74609,
-    74620,
-    74632,
-    74643,
-    74655,
-    74666,
-    74678,
-    74689,
-    74701,
-    74712,
-    74724,
     74735,
-    74747,
-    74758,
-    74770,
-    74781,
-    74793,
-    74804,
-    74816,
-    74827,
-    74838,
-    74850,
-    74861,
-    74873,
-    74884,
-    74896,
-    74907,
     74919,
-    74930,
-    74942,
-    74953,
-    74965,
-    74976,
-    74988,
-    74999,
-    75011,
-    75022,
-    75034,
-    75045,
-    75057,
-    75068,
-    75079,
-    75091,
     75102,
-    75114,
-    75125,
-    75137,
-    75148,
-    75160,
-    75171,
-    75183,
-    75194,
-    75206,
-    75217,
-    75228,
-    75240,
-    75251,
-    75263,
-    75274,
     75286,
-    75297,
-    75309,
-    75320,
-    75332,
-    75343,
-    75355,
-    75366,
-    75377,
-    75389,
-    75400,
-    75412,
-    75423,
-    75435,
-    75446,
-    75458,
     75469,
-    75480,
-    75492,
-    75503,
-    75515,
-    75526,
-    75538,
-    75549,
-    75561,
-    75572,
-    75583,
-    75595,
-    75606,
-    75618,
-    75629,
-    75641,
     75652,
-    75664,
-    75675,
-    75686,
-    75698,
-    75709,
-    75721,
-    75732,
-    75744,
-    75755,
-    75767,
-    75778,
-    75789,
-    75801,
-    75812,
-    75824,
     75835,
-    75847,
-    75858,
-    75869,
-    75881,
-    75892,
-    75904,
-    75915,
-    75927,
-    75938,
-    75949,
-    75961,
-    75972,
-    75984,
-    75995,
-    76006,
     76018,
-    76029,
-    76041,
-    76052,
-    76064,
-    76075,
-    76086,
-    76098,
-    76109,
-    76121,
-    76132,
-    76144,
-    76155,
-    76166,
-    76178,
-    76189,
     76201,
-    76212,
-    76223,
-    76235,
-    76246,
-    76258,
-    76269,
-    76280,
-    76292,
-    76303,
-    76315,
-    76326,
-    76337,
-    76349,
-    76360,
-    76372,
     76383,
-    76394,
-    76406,
-    76417,
-    76429,
-    76440,
-    76451,
-    76463,
-    76474,
-    76486,
-    76497,
-    76508,
-    76520,
-    76531,
-    76543,
-    76554,
     76565,
-    76577,
-    76588,
-    76600,
-    76611,
-    76622,
-    76634,
-    76645,
-    76657,
-    76668,
-    76679,
-    76691,
-    76702,
-    76714,
-    76725,
-    76736,
     76748,
-    76759,
-    76770,
-    76782,
-    76793,
-    76805,
-    76816,
-    76827,
-    76839,
-    76850,
-    76862,
-    76873,
-    76884,
-    76896,
-    76907,
-    76918,
     76930,
-    76941,
-    76953,
-    76964,
-    76975,
-    76987,
-    76998,
-    77009,
-    77021,
-    77032,
-    77043,
-    77055,
-    77066,
-    77078,
-    77089,
-    77100,
     77112,
-    77123,
-    77134,
-    77146,
-    77157,
-    77169,
-    77180,
-    77191,
-    77203,
-    77214,
-    77225,
-    77237,
-    77248,
-    77259,
-    77271,
-    77282,
     77293,
-    77305,
-    77316,
-    77328,
-    77339,
-    77350,
-    77362,
-    77373,
-    77384,
-    77396,
-    77407,
-    77418,
-    77430,
-    77441,
-    77452,
-    77464,
     77475,
-    77487,
-    77498,
-    77509,
-    77521,
-    77532,
-    77543,
-    77555,
-    77566,
-    77577,
-    77589,
-    77600,
-    77611,
-    77623,
-    77634,
-    77645,
     77657,
-    77668,
-    77679,
-    77691,
-    77702,
-    77713,
-    77725,
-    77736,
-    77747,
-    77759,
-    77770,
-    77781,
-    77793,
-    77804,
-    77815,
-    77827,
     77838,
-    77849,
-    77861,
-    77872,
-    77883,
-    77895,
-    77906,
-    77917,
-    77929,
-    77940,
-    77951,
-    77963,
-    77974,
-    77985,
-    77997,
-    78008,
     78019,
-    78031,
-    78042,
-    78053,
-    78065,
-    78076,
-    78087,
-    78099,
-    78110,
-    78121,
-    78132,
-    78144,
-    78155,
-    78166,
-    78178,
-    78189,
     78200,
-    78212,
-    78223,
-    78234,
-    78246,
-    78257,
-    78268,
-    78280,
-    78291,
-    78302,
-    78313,
-    78325,
-    78336,
-    78347,
-    78359,
-    78370,
     78381,
-    78393,
-    78404,
-    78415,
-    78427,
-    78438,
-    78449,
-    78460,
-    78472,
-    78483,
-    78494,
-    78506,
-    78517,
-    78528,
-    78540,
-    78551,
     78562,
-    78573,
-    78585,
-    78596,
-    78607,
-    78619,
-    78630,
-    78641,
-    78652,
-    78664,
-    78675,
-    78686,
-    78698,
-    78709,
-    78720,
-    78731,
     78743,
-    78754,
-    78765,
-    78777,
-    78788,
-    78799,
-    78811,
-    78822,
-    78833,
-    78844,
-    78856,
-    78867,
-    78878,
-    78889,
-    78901,
-    78912,
     78923,
-    78935,
-    78946,
-    78957,
-    78968,
-    78980,
-    78991,
-    79002,
-    79014,
-    79025,
-    79036,
-    79047,
-    79059,
-    79070,
-    79081,
-    79092,
     79104,
-    79115,
-    79126,
-    79138,
-    79149,
-    79160,
-    79171,
-    79183,
-    79194,
-    79205,
-    79216,
-    79228,
-    79239,
-    79250,
-    79261,
-    79273,
     79284,
-    79295,
-    79306,
-    79318,
-    79329,
-    79340,
-    79352,
-    79363,
-    79374,
-    79385,
-    79397,
-    79408,
-    79419,
-    79430,
-    79442,
-    79453,
     79464,
-    79475,
-    79487,
-    79498,
-    79509,
-    79520,
-    79532,
-    79543,
-    79554,
-    79565,
-    79577,
-    79588,
-    79599,
-    79610,
-    79622,
-    79633,
     79644,
-    79655,
-    79667,
-    79678,
-    79689,
-    79700,
-    79712,
-    79723,
-    79734,
-    79745,
-    79757,
-    79768,
-    79779,
-    79790,
-    79801,
-    79813,
     79824,
-    79835,
-    79846,
-    79858,
-    79869,
-    79880,
-    79891,
-    79903,
-    79914,
-    79925,
-    79936,
-    79948,
-    79959,
-    79970,
-    79981,
-    79992,
     80004,
-    80015,
-    80026,
-    80037,
-    80049,
-    80060,
-    80071,
-    80082,
-    80093,
-    80105,
-    80116,
-    80127,
-    80138,
-    80150,
-    80161,
-    80172,
     80183,
-    80194,
-    80206,
-    80217,
-    80228,
-    80239,
-    80251,
-    80262,
-    80273,
-    80284,
-    80295,
-    80307,
-    80318,
-    80329,
-    80340,
-    80351,
     80363,
-    80374,
-    80385,
-    80396,
-    80408,
-    80419,
-    80430,
-    80441,
-    80452,
-    80464,
-    80475,
-    80486,
-    80497,
-    80508,
-    80520,
-    80531,
     80542,
-    80553,
-    80564,
-    80576,
-    80587,
-    80598,
-    80609,
-    80620,
-    80632,
-    80643,
-    80654,
-    80665,
-    80676,
-    80688,
-    80699,
-    80710,
     80721,
-    80732,
-    80744,
-    80755,
-    80766,
-    80777,
-    80788,
-    80800,
-    80811,
-    80822,
-    80833,
-    80844,
-    80855,
-    80867,
-    80878,
-    80889,
     80900,
-    80911,
-    80923,
-    80934,
-    80945,
-    80956,
-    80967,
-    80979,
-    80990,
-    81001,
-    81012,
-    81023,
-    81034,
-    81046,
-    81057,
-    81068,
     81079,
-    81090,
-    81101,
-    81113,
-    81124,
-    81135,
-    81146,
-    81157,
-    81169,
-    81180,
-    81191,
-    81202,
-    81213,
-    81224,
-    81236,
-    81247,
     81258,
-    81269,
-    81280,
-    81291,
-    81303,
-    81314,
-    81325,
-    81336,
-    81347,
-    81358,
-    81370,
-    81381,
-    81392,
-    81403,
-    81414,
-    81425,
     81437,
-    81448,
-    81459,
-    81470,
-    81481,
-    81492,
-    81504,
-    81515,
-    81526,
-    81537,
-    81548,
-    81559,
-    81570,
-    81582,
-    81593,
-    81604,
     81615,
-    81626,
-    81637,
-    81649,
-    81660,
-    81671,
-    81682,
-    81693,
-    81704,
-    81715,
-    81727,
-    81738,
-    81749,
-    81760,
-    81771,
-    81782,
     81793,
-    81805,
-    81816,
-    81827,
-    81838,
-    81849,
-    81860,
-    81872,
-    81883,
-    81894,
-    81905,
-    81916,
-    81927,
-    81938,
-    81949,
-    81961,
     81972,
-    81983,
-    81994,
-    82005,
-    82016,
-    82027,
-    82039,
-    82050,
-    82061,
-    82072,
-    82083,
-    82094,
-    82105,
-    82117,
-    82128,
-    82139,
     82150,
-    82161,
-    82172,
-    82183,
-    82194,
-    82206,
-    82217,
-    82228,
-    82239,
-    82250,
-    82261,
-    82272,
-    82283,
-    82295,
-    82306,
-    82317,
     82328,
-    82339,
-    82350,
-    82361,
-    82372,
-    82384,
-    82395,
-    82406,
-    82417,
-    82428,
-    82439,
-    82450,
-    82461,
-    82472,
-    82484,
-    82495,
     82506,
-    82517,
-    82528,
-    82539,
-    82550,
-    82561,
-    82572,
-    82584,
-    82595,
-    82606,
-    82617,
-    82628,
-    82639,
-    82650,
-    82661,
-    82672,
     82684,
-    82695,
-    82706,
-    82717,
-    82728,
-    82739,
-    82750,
-    82761,
-    82772,
-    82783,
-    82795,
-    82806,
-    82817,
-    82828,
-    82839,
-    82850,
     82861,
-    82872,
-    82883,
-    82894,
-    82906,
-    82917,
-    82928,
-    82939,
-    82950,
-    82961,
-    82972,
-    82983,
-    82994,
-    83005,
-    83016,
-    83028,
     83039,
-    83050,
-    83061,
-    83072,
-    83083,
-    83094,
-    83105,
-    83116,
-    83127,
-    83138,
-    83150,
-    83161,
-    83172,
-    83183,
-    83194,
-    83205,
     83216,
-    83227,
-    83238,
-    83249,
-    83260,
-    83271,
-    83283,
-    83294,
-    83305,
-    83316,
-    83327,
-    83338,
-    83349,
-    83360,
-    83371,
-    83382,
     83393,
-    83404,
-    83415,
-    83426,
-    83438,
-    83449,
-    83460,
-    83471,
-    83482,
-    83493,
-    83504,
-    83515,
-    83526,
-    83537,
-    83548,
-    83559,
     83570,
-    83581,
-    83593,
-    83604,
-    83615,
-    83626,
-    83637,
-    83648,
-    83659,
-    83670,
-    83681,
-    83692,
-    83703,
-    83714,
-    83725,
-    83736,
     83747,
-    83758,
-    83769,
-    83781,
-    83792,
-    83803,
-    83814,
-    83825,
-    83836,
-    83847,
-    83858,
-    83869,
-    83880,
-    83891,
-    83902,
-    83913,
     83924,
-    83935,
-    83946,
-    83957,
-    83968,
-    83979,
-    83991,
-    84002,
-    84013,
-    84024,
-    84035,
-    84046,
-    84057,
-    84068,
-    84079,
-    84090,
     84101,
-    84112,
-    84123,
-    84134,
-    84145,
-    84156,
-    84167,
-    84178,
-    84189,
-    84200,
-    84211,
-    84222,
-    84233,
-    84245,
-    84256,
-    84267,
     84278,
-    84289,
-    84300,
-    84311,
-    84322,
-    84333,
-    84344,
-    84355,
-    84366,
-    84377,
-    84388,
-    84399,
-    84410,
-    84421,
-    84432,
-    84443,
     84454,
-    84465,
-    84476,
-    84487,
-    84498,
-    84509,
-    84520,
-    84531,
-    84542,
-    84553,
-    84564,
-    84575,
-    84586,
-    84597,
-    84608,
-    84619,
     84630,
-    84642,
-    84653,
-    84664,
-    84675,
-    84686,
-    84697,
-    84708,
-    84719,
-    84730,
-    84741,
-    84752,
-    84763,
-    84774,
-    84785,
-    84796,
     84807,
-    84818,
-    84829,
-    84840,
-    84851,
-    84862,
-    84873,
-    84884,
-    84895,
-    84906,
-    84917,
-    84928,
-    84939,
-    84950,
-    84961,
-    84972,
     84983,
-    84994,
-    85005,
-    85016,
-    85027,
-    85038,
-    85049,
-    85060,
-    85071,
-    85082,
-    85093,
-    85104,
-    85115,
-    85126,
-    85137,
-    85148,
     85159,
-    85170,
-    85181,
-    85192,
-    85203,
-    85214,
-    85225,
-    85236,
-    85247,
-    85258,
-    85269,
-    85280,
-    85291,
-    85302,
-    85313,
-    85324,
     85335,
-    85346,
-    85357,
-    85368,
-    85379,
-    85390,
-    85401,
-    85412,
-    85423,
-    85434,
-    85445,
-    85456,
-    85467,
-    85478,
-    85489,
-    85500,
     85511,
-    85522,
-    85532,
-    85543,
-    85554,
-    85565,
-    85576,
-    85587,
-    85598,
-    85609,
-    85620,
-    85631,
-    85642,
-    85653,
-    85664,
-    85675,
     85686,
-    85697,
-    85708,
-    85719,
-    85730,
-    85741,
-    85752,
-    85763,
-    85774,
-    85785,
-    85796,
-    85807,
-    85818,
-    85829,
-    85840,
-    85851,
     85862,
-    85873,
-    85884,
-    85895,
-    85906,
-    85917,
-    85927,
-    85938,
-    85949,
-    85960,
-    85971,
-    85982,
-    85993,
-    86004,
-    86015,
-    86026,
     86037,
-    86048,
-    86059,
-    86070,
-    86081,
-    86092,
-    86103,
-    86114,
-    86125,
-    86136,
-    86147,
-    86158,
-    86169,
-    86180,
-    86190,
-    86201,
     86212,
-    86223,
-    86234,
-    86245,
-    86256,
-    86267,
-    86278,
-    86289,
-    86300,
-    86311,
-    86322,
-    86333,
-    86344,
-    86355,
-    86366,
-    86377,
     86388,
-    86399,
-    86409,
-    86420,
-    86431,
-    86442,
-    86453,
-    86464,
-    86475,
-    86486,
-    86497,
-    86508,
-    86519,
-    86530,
-    86541,
-    86552,
     86563,
-    86574,
-    86584,
-    86595,
-    86606,
-    86617,
-    86628,
-    86639,
-    86650,
-    86661,
-    86672,
-    86683,
-    86694,
-    86705,
-    86716,
-    86727,
     86738,
-    86748,
-    86759,
-    86770,
-    86781,
-    86792,
-    86803,
-    86814,
-    86825,
-    86836,
-    86847,
-    86858,
-    86869,
-    86880,
-    86891,
-    86901,
     86912,
-    86923,
-    86934,
-    86945,
-    86956,
-    86967,
-    86978,
-    86989,
-    87000,
-    87011,
-    87022,
-    87032,
-    87043,
-    87054,
-    87065,
-    87076,
     87087,
-    87098,
-    87109,
-    87120,
-    87131,
-    87142,
-    87153,
-    87163,
-    87174,
-    87185,
-    87196,
-    87207,
-    87218,
-    87229,
-    87240,
-    87251,
     87262,
-    87273,
-    87283,
-    87294,
-    87305,
-    87316,
-    87327,
-    87338,
-    87349,
-    87360,
-    87371,
-    87382,
-    87393,
-    87403,
-    87414,
-    87425,
     87436,
-    87447,
-    87458,
-    87469,
-    87480,
-    87491,
-    87502,
-    87512,
-    87523,
-    87534,
-    87545,
-    87556,
-    87567,
-    87578,
-    87589,
-    87600,
     87610,
-    87621,
-    87632,
-    87643,
-    87654,
-    87665,
-    87676,
-    87687,
-    87698,
-    87708,
-    87719,
-    87730,
-    87741,
-    87752,
-    87763,
-    87774,
     87785,
-    87796,
-    87806,
-    87817,
-    87828,
-    87839,
-    87850,
-    87861,
-    87872,
-    87883,
-    87894,
-    87904,
-    87915,
-    87926,
-    87937,
-    87948,
     87959,
-    87970,
-    87981,
-    87991,
-    88002,
-    88013,
-    88024,
-    88035,
-    88046,
-    88057,
-    88068,
-    88078,
-    88089,
-    88100,
-    88111,
-    88122,
     88133,
-    88144,
-    88155,
-    88165,
-    88176,
-    88187,
-    88198,
-    88209,
-    88220,
-    88231,
-    88242,
-    88252,
-    88263,
-    88274,
-    88285,
-    88296,
     88307,
-    88318,
-    88328,
-    88339,
-    88350,
-    88361,
-    88372,
-    88383,
-    88394,
-    88404,
-    88415,
-    88426,
-    88437,
-    88448,
-    88459,
-    88470,
     88480,
-    88491,
-    88502,
-    88513,
-    88524,
-    88535,
-    88546,
-    88556,
-    88567,
-    88578,
-    88589,
-    88600,
-    88611,
-    88622,
-    88632,
-    88643,
     88654,
-    88665,
-    88676,
-    88687,
-    88698,
-    88708,
-    88719,
-    88730,
-    88741,
-    88752,
-    88763,
-    88773,
-    88784,
-    88795,
-    88806,
-    88817,
     88828,
-    88839,
-    88849,
-    88860,
-    88871,
-    88882,
-    88893,
-    88904,
-    88914,
-    88925,
-    88936,
-    88947,
-    88958,
-    88969,
-    88979,
-    88990,
     89001,
-    89012,
-    89023,
-    89034,
-    89044,
-    89055,
-    89066,
-    89077,
-    89088,
-    89099,
-    89109,
-    89120,
-    89131,
-    89142,
-    89153,
-    89164,
     89174,
-    89185,
-    89196,
-    89207,
-    89218,
-    89229,
-    89239,
-    89250,
-    89261,
-    89272,
-    89283,
-    89294,
-    89304,
-    89315,
-    89326,
-    89337,
     89348,
-    89358,
-    89369,
-    89380,
-    89391,
-    89402,
-    89413,
-    89423,
-    89434,
-    89445,
-    89456,
-    89467,
-    89477,
-    89488,
-    89499,
-    89510,
     89521,
-    89532,
-    89542,
-    89553,
-    89564,
-    89575,
-    89586,
-    89596,
-    89607,
-    89618,
-    89629,
-    89640,
-    89651,
-    89661,
-    89672,
-    89683,
     89694,
-    89705,
-    89715,
-    89726,
-    89737,
-    89748,
-    89759,
-    89769,
-    89780,
-    89791,
-    89802,
-    89813,
-    89823,
-    89834,
-    89845,
-    89856,
     89867,
-    89877,
-    89888,
-    89899,
-    89910,
-    89921,
-    89931,
-    89942,
-    89953,
-    89964,
-    89975,
-    89985,
-    89996,
-    90007,
-    90018,
-    90029,
     90039,
-    90050,
-    90061,
-    90072,
-    90083,
-    90093,
-    90104,
-    90115,
-    90126,
-    90137,
-    90147,
-    90158,
-    90169,
-    90180,
-    90190,
-    90201,
     90212,
-    90223,
-    90234,
-    90244,
-    90255,
-    90266,
-    90277,
-    90288,
-    90298,
-    90309,
-    90320,
-    90331,
-    90341,
-    90352,
-    90363,
-    90374,
     90385,
-    90395,
-    90406,
-    90417,
-    90428,
-    90438,
-    90449,
-    90460,
-    90471,
-    90482,
-    90492,
-    90503,
-    90514,
-    90525,
-    90535,
-    90546,
     90557,
-    90568,
-    90579,
-    90589,
-    90600,
-    90611,
-    90622,
-    90632,
-    90643,
-    90654,
-    90665,
-    90676,
-    90686,
-    90697,
-    90708,
-    90719,
     90729,
-    90740,
-    90751,
-    90762,
-    90772,
-    90783,
-    90794,
-    90805,
-    90815,
-    90826,
-    90837,
-    90848,
-    90859,
-    90869,
-    90880,
-    90891,
     90902,
-    90912,
-    90923,
-    90934,
-    90945,
-    90955,
-    90966,
-    90977,
-    90988,
-    90998,
-    91009,
-    91020,
-    91031,
-    91041,
-    91052,
-    91063,
     91074,
-    91084,
-    91095,
-    91106,
-    91117,
-    91127,
-    91138,
-    91149,
-    91160,
-    91170,
-    91181,
-    91192,
-    91203,
-    91213,
-    91224,
-    91235,
     91246,
-    91256,
-    91267,
-    91278,
-    91289,
-    91299,
-    91310,
-    91321,
-    91332,
-    91342,
-    91353,
-    91364,
-    91375,
-    91385,
-    91396,
-    91407,
     91418,
-    91428,
-    91439,
-    91450,
-    91461,
-    91471,
-    91482,
-    91493,
-    91503,
-    91514,
-    91525,
-    91536,
-    91546,
-    91557,
-    91568,
-    91579,
     91589,
-    91600,
-    91611,
-    91622,
-    91632,
-    91643,
-    91654,
-    91664,
-    91675,
-    91686,
-    91697,
-    91707,
-    91718,
-    91729,
-    91740,
-    91750,
     91761,
-    91772,
-    91782,
-    91793,
-    91804,
-    91815,
-    91825,
-    91836,
-    91847,
-    91858,
-    91868,
-    91879,
-    91890,
-    91900,
-    91911,
-    91922,
     91933,
-    91943,
-    91954,
-    91965,
-    91975,
-    91986,
-    91997,
-    92008,
-    92018,
-    92029,
-    92040,
-    92050,
-    92061,
-    92072,
-    92083,
-    92093,
     92104,
-    92115,
-    92125,
-    92136,
-    92147,
-    92158,
-    92168,
-    92179,
-    92190,
-    92200,
-    92211,
-    92222,
-    92233,
-    92243,
-    92254,
-    92265,
     92275,
-    92286,
-    92297,
-    92308,
-    92318,
-    92329,
-    92340,
-    92350,
-    92361,
-    92372,
-    92382,
-    92393,
-    92404,
-    92415,
-    92425,
-    92436,
     92447,
-    92457,
-    92468,
-    92479,
-    92489,
-    92500,
-    92511,
-    92522,
-    92532,
-    92543,
-    92554,
-    92564,
-    92575,
-    92586,
-    92596,
-    92607,
     92618,
-    92628,
-    92639,
-    92650,
-    92661,
-    92671,
-    92682,
-    92693,
-    92703,
-    92714,
-    92725,
-    92735,
-    92746,
-    92757,
-    92767,
-    92778,
     92789,
-    92800,
-    92810,
-    92821,
-    92832,
-    92842,
-    92853,
-    92864,
-    92874,
-    92885,
-    92896,
-    92906,
-    92917,
-    92928,
-    92938,
-    92949,
     92960,
-    92970,
-    92981,
-    92992,
-    93002,
-    93013,
-    93024,
-    93035,
-    93045,
-    93056,
-    93067,
-    93077,
-    93088,
-    93099,
-    93109,
-    93120,
     93131,
-    93141,
-    93152,
-    93163,
-    93173,
-    93184,
-    93195,
-    93205,
-    93216,
-    93227,
-    93237,
-    93248,
-    93259,
-    93269,
-    93280,
-    93291,
     93301,
-    93312,
-    93323,
-    93333,
-    93344,
-    93355,
-    93365,
-    93376,
-    93387,
-    93397,
-    93408,
-    93419,
-    93429,
-    93440,
-    93451,
-    93461,
     93472,
-    93483,
-    93493,
-    93504,
-    93515,
-    93525,
-    93536,
-    93547,
-    93557,
-    93568,
-    93579,
-    93589,
-    93600,
-    93611,
-    93621,
-    93632,
     93642,
-    93653,
-    93664,
-    93674,
-    93685,
-    93696,
-    93706,
-    93717,
-    93728,
-    93738,
-    93749,
-    93760,
-    93770,
-    93781,
-    93792,
-    93802,
     93813,
-    93824,
-    93834,
-    93845,
-    93855,
-    93866,
-    93877,
-    93887,
-    93898,
-    93909,
-    93919,
-    93930,
-    93941,
-    93951,
-    93962,
-    93973,
     93983,
-    93994,
-    94004,
-    94015,
-    94026,
-    94036,
-    94047,
-    94058,
-    94068,
-    94079,
-    94090,
-    94100,
-    94111,
-    94121,
-    94132,
-    94143,
     94153,
-    94164,
-    94175,
-    94185,
-    94196,
-    94207,
-    94217,
-    94228,
-    94238,
-    94249,
-    94260,
-    94270,
-    94281,
-    94292,
-    94302,
-    94313,
     94324,
-    94334,
-    94345,
-    94355,
-    94366,
-    94377,
-    94387,
-    94398,
-    94409,
-    94419,
-    94430,
-    94440,
-    94451,
-    94462,
-    94472,
-    94483,
     94494,
-    94504,
-    94515,
-    94525,
-    94536,
-    94547,
-    94557,
-    94568,
-    94578,
-    94589,
-    94600,
-    94610,
-    94621,
-    94632,
-    94642,
-    94653,
     94663,
-    94674,
-    94685,
-    94695,
-    94706,
-    94716,
-    94727,
-    94738,
-    94748,
-    94759,
-    94770,
-    94780,
-    94791,
-    94801,
-    94812,
-    94823,
     94833,
-    94844,
-    94854,
-    94865,
-    94876,
-    94886,
-    94897,
-    94907,
-    94918,
-    94929,
-    94939,
-    94950,
-    94960,
-    94971,
-    94982,
-    94992,
     95003,
-    95014,
-    95024,
-    95035,
-    95045,
-    95056,
-    95067,
-    95077,
-    95088,
-    95098,
-    95109,
-    95120,
-    95130,
-    95141,
-    95151,
-    95162,
     95173,
-    95183,
-    95194,
-    95204,
-    95215,
-    95225,
-    95236,
-    95247,
-    95257,
-    95268,
-    95278,
-    95289,
-    95300,
-    95310,
-    95321,
-    95331,
     95342,
-    95353,
-    95363,
-    95374,
-    95384,
-    95395,
-    95406,
-    95416,
-    95427,
-    95437,
-    95448,
-    95458,
-    95469,
-    95480,
-    95490,
-    95501,
     95511,
-    95522,
-    95533,
-    95543,
-    95554,
-    95564,
-    95575,
-    95585,
-    95596,
-    95607,
-    95617,
-    95628,
-    95638,
-    95649,
-    95660,
-    95670,
     95681,
-    95691,
-    95702,
-    95712,
-    95723,
-    95734,
-    95744,
-    95755,
-    95765,
-    95776,
-    95786,
-    95797,
-    95808,
-    95818,
-    95829,
-    95839,
     95850,
-    95860,
-    95871,
-    95882,
-    95892,
-    95903,
-    95913,
-    95924,
-    95934,
-    95945,
-    95956,
-    95966,
-    95977,
-    95987,
-    95998,
-    96008,
     96019,
-    96030,
-    96040,
-    96051,
-    96061,
-    96072,
-    96082,
-    96093,
-    96104,
-    96114,
-    96125,
-    96135,
-    96146,
-    96156,
-    96167,
-    96177,
     96188,
-    96199,
-    96209,
-    96220,
-    96230,
-    96241,
-    96251,
-    96262,
-    96272,
-    96283,
-    96294,
-    96304,
-    96315,
-    96325,
-    96336,
-    96346,
     96357,
-    96367,
-    96378,
-    96389,
-    96399,
-    96410,
-    96420,
-    96431,
-    96441,
-    96452,
-    96462,
-    96473,
-    96484,
-    96494,
-    96505,
-    96515,
     96526,
-    96536,
-    96547,
-    96557,
-    96568,
-    96578,
-    96589,
-    96600,
-    96610,
-    96621,
-    96631,
-    96642,
-    96652,
-    96663,
-    96673,
-    96684,
     96694,
-    96705,
-    96715,
-    96726,
-    96737,
-    96747,
-    96758,
-    96768,
-    96779,
-    96789,
-    96800,
-    96810,
-    96821,
-    96831,
-    96842,
-    96852,
     96863,
-    96874,
-    96884,
-    96895,
-    96905,
-    96916,
-    96926,
-    96937,
-    96947,
-    96958,
-    96968,
-    96979,
-    96989,
-    97000,
-    97010,
-    97021,
     97032,
-    97042,
-    97053,
-    97063,
-    97074,
-    97084,
-    97095,
-    97105,
-    97116,
-    97126,
-    97137,
-    97147,
-    97158,
-    97168,
-    97179,
-    97189,
     97200,
-    97210,
-    97221,
-    97231,
-    97242,
-    97253,
-    97263,
-    97274,
-    97284,
-    97295,
-    97305,
-    97316,
-    97326,
-    97337,
-    97347,
-    97358,
     97368,
-    97379,
-    97389,
-    97400,
-    97410,
-    97421,
-    97431,
-    97442,
-    97452,
-    97463,
-    97473,
-    97484,
-    97494,
-    97505,
-    97515,
-    97526,
     97536,
-    97547,
-    97557,
-    97568,
-    97578,
-    97589,
-    97599,
-    97610,
-    97621,
-    97631,
-    97642,
-    97652,
-    97663,
-    97673,
-    97684,
-    97694,
     97705,
-    97715,
-    97726,
-    97736,
-    97747,
-    97757,
-    97768,
-    97778,
-    97789,
-    97799,
-    97810,
-    97820,
-    97831,
-    97841,
-    97852,
-    97862,
     97873,
-    97883,
-    97894,
-    97904,
-    97915,
-    97925,
-    97936,
-    97946,
-    97957,
-    97967,
-    97978,
-    97988,
-    97999,
-    98009,
-    98020,
-    98030,
     98041,
-    98051,
-    98061,
-    98072,
-    98082,
-    98093,
-    98103,
-    98114,
-    98124,
-    98135,
-    98145,
-    98156,
-    98166,
-    98177,
-    98187,
-    98198,
     98208,
-    98219,
-    98229,
-    98240,
-    98250,
-    98261,
-    98271,
-    98282,
-    98292,
-    98303,
-    98313,
-    98324,
-    98334,
-    98345,
-    98355,
-    98366,
     98376,
-    98387,
-    98397,
-    98408,
-    98418,
-    98428,
-    98439,
-    98449,
-    98460,
-    98470,
-    98481,
-    98491,
-    98502,
-    98512,
-    98523,
-    98533,
     98544,
-    98554,
-    98565,
-    98575,
-    98586,
-    98596,
-    98607,
-    98617,
-    98627,
-    98638,
-    98648,
-    98659,
-    98669,
-    98680,
-    98690,
-    98701,
     98711,
-    98722,
-    98732,
-    98743,
-    98753,
-    98764,
-    98774,
-    98785,
-    98795,
-    98805,
-    98816,
-    98826,
-    98837,
-    98847,
-    98858,
-    98868,
     98879,
-    98889,
-    98900,
-    98910,
-    98921,
-    98931,
-    98941,
-    98952,
-    98962,
-    98973,
-    98983,
-    98994,
-    99004,
-    99015,
-    99025,
-    99036,
     99046,
-    99057,
-    99067,
-    99077,
-    99088,
-    99098,
-    99109,
-    99119,
-    99130,
-    99140,
-    99151,
-    99161,
-    99172,
-    99182,
-    99192,
-    99203,
     99213,
-    99224,
-    99234,
-    99245,
-    99255,
-    99266,
-    99276,
-    99286,
-    99297,
-    99307,
-    99318,
-    99328,
-    99339,
-    99349,
-    99360,
-    99370,
     99380,
-    99391,
-    99401,
-    99412,
-    99422,
-    99433,
-    99443,
-    99454,
-    99464,
-    99474,
-    99485,
-    99495,
-    99506,
-    99516,
-    99527,
-    99537,
     99548,
-    99558,
-    99568,
-    99579,
-    99589,
-    99600,
-    99610,
-    99621,
-    99631,
-    99641,
-    99652,
-    99662,
-    99673,
-    99683,
-    99694,
-    99704,
     99715,
-    99725,
-    99735,
-    99746,
-    99756,
-    99767,
-    99777,
-    99788,
-    99798,
-    99808,
-    99819,
-    99829,
-    99840,
-    99850,
-    99861,
-    99871,
     99881,
-    99892,
-    99902,
-    99913,
-    99923,
-    99934,
-    99944,
-    99954,
-    99965,
-    99975,
-    99986,
-    99996,
-    100007,
-    100017,
-    100027,
-    100038,
     100048,
-    100059,
-    100069,
-    100079,
-    100090,
-    100100,
-    100111,
-    100121,
-    100132,
-    100142,
-    100152,
-    100163,
-    100173,
-    100184,
-    100194,
-    100204,
     100215,
-    100225,
-    100236,
-    100246,
-    100257,
-    100267,
-    100277,
-    100288,
-    100298,
-    100309,
-    100319,
-    100329,
-    100340,
-    100350,
-    100361,
-    100371,
     100382,
-    100392,
-    100402,
-    100413,
-    100423,
-    100434,
-    100444,
-    100454,
-    100465,
-    100475,
-    100486,
-    100496,
-    100506,
-    100517,
-    100527,
-    100538,
     100548,
-    100558,
-    100569,
-    100579,
-    100590,
-    100600,
-    100610,
-    100621,
-    100631,
-    100642,
-    100652,
-    100662,
-    100673,
-    100683,
-    100694,
-    100704,
     100714,
-    100725,
-    100735,
-    100746,
-    100756,
-    100766,
-    100777,
-    100787,
-    100798,
-    100808,
-    100818,
-    100829,
-    100839,
-    100850,
-    100860,
-    100870,
     100881,
-    100891,
-    100902,
-    100912,
-    100922,
-    100933,
-    100943,
-    100954,
-    100964,
-    100974,
-    100985,
-    100995,
-    101005,
-    101016,
-    101026,
-    101037,
     101047,
-    101057,
-    101068,
-    101078,
-    101089,
-    101099,
-    101109,
-    101120,
-    101130,
-    101141,
-    101151,
-    101161,
-    101172,
-    101182,
-    101192,
-    101203,
     101213,
-    101224,
-    101234,
-    101244,
-    101255,
-    101265,
-    101275,
-    101286,
-    101296,
-    101307,
-    101317,
-    101327,
-    101338,
-    101348,
-    101358,
-    101369,
     101379,
-    101390,
-    101400,
-    101410,
-    101421,
-    101431,
-    101441,
-    101452,
-    101462,
-    101473,
-    101483,
-    101493,
-    101504,
-    101514,
-    101524,
-    101535,
     101545,
-    101556,
-    101566,
-    101576,
-    101587,
-    101597,
-    101607,
-    101618,
-    101628,
-    101639,
-    101649,
-    101659,
-    101670,
-    101680,
-    101690,
-    101701,
     101711,
-    101721,
-    101732,
-    101742,
-    101753,
-    101763,
-    101773,
-    101784,
-    101794,
-    101804,
-    101815,
-    101825,
-    101835,
-    101846,
-    101856,
-    101867,
     101877,
-    101887,
-    101898,
-    101908,
-    101918,
-    101929,
-    101939,
-    101949,
-    101960,
-    101970,
-    101980,
-    101991,
-    102001,
-    102012,
-    102022,
-    102032,
     102043,
-    102053,
-    102063,
-    102074,
-    102084,
-    102094,
-    102105,
-    102115,
-    102125,
-    102136,
-    102146,
-    102156,
-    102167,
-    102177,
-    102187,
-    102198,
     102208,
-    102219,
-    102229,
-    102239,
-    102250,
-    102260,
-    102270,
-    102281,
-    102291,
-    102301,
-    102312,
-    102322,
-    102332,
-    102343,
-    102353,
-    102363,
     102374,
-    102384,
-    102394,
-    102405,
-    102415,
-    102425,
-    102436,
-    102446,
-    102456,
-    102467,
-    102477,
-    102487,
-    102498,
-    102508,
-    102518,
-    102529,
     102539,
-    102549,
-    102560,
-    102570,
-    102580,
-    102591,
-    102601,
-    102611,
-    102622,
-    102632,
-    102642,
-    102653,
-    102663,
-    102673,
-    102684,
-    102694,
     102704,
-    102715,
-    102725,
-    102735,
-    102746,
-    102756,
-    102766,
-    102777,
-    102787,
-    102797,
-    102808,
-    102818,
-    102828,
-    102839,
-    102849,
-    102859,
     102870,
-    102880,
-    102890,
-    102901,
-    102911,
-    102921,
-    102932,
-    102942,
-    102952,
-    102963,
-    102973,
-    102983,
-    102994,
-    103004,
-    103014,
-    103025,
     103035,
-    103045,
-    103056,
-    103066,
-    103076,
-    103086,
-    103097,
-    103107,
-    103117,
-    103128,
-    103138,
-    103148,
-    103159,
-    103169,
-    103179,
-    103190,
     103200,
-    103210,
-    103221,
-    103231,
-    103241,
-    103252,
-    103262,
-    103272,
-    103282,
-    103293,
-    103303,
-    103313,
-    103324,
-    103334,
-    103344,
-    103355,
     103365,
-    103375,
-    103386,
-    103396,
-    103406,
-    103417,
-    103427,
-    103437,
-    103447,
-    103458,
-    103468,
-    103478,
-    103489,
-    103499,
-    103509,
-    103520,
     103530,
-    103540,
-    103550,
-    103561,
-    103571,
-    103581,
-    103592,
-    103602,
-    103612,
-    103623,
-    103633,
-    103643,
-    103653,
-    103664,
-    103674,
-    103684,
     103695,
-    103705,
-    103715,
-    103726,
-    103736,
-    103746,
-    103756,
-    103767,
-    103777,
-    103787,
-    103798,
-    103808,
-    103818,
-    103829,
-    103839,
-    103849,
     103859,
-    103870,
-    103880,
-    103890,
-    103901,
-    103911,
-    103921,
-    103931,
-    103942,
-    103952,
-    103962,
-    103973,
-    103983,
-    103993,
-    104003,
-    104014,
     104024,
-    104034,
-    104045,
-    104055,
-    104065,
-    104075,
-    104086,
-    104096,
-    104106,
-    104117,
-    104127,
-    104137,
-    104147,
-    104158,
-    104168,
-    104178,
     104189,
-    104199,
-    104209,
-    104219,
-    104230,
-    104240,
-    104250,
-    104261,
-    104271,
-    104281,
-    104291,
-    104302,
-    104312,
-    104322,
-    104333,
-    104343,
     104353,
-    104363,
-    104374,
-    104384,
-    104394,
-    104404,
-    104415,
-    104425,
-    104435,
-    104446,
-    104456,
-    104466,
-    104476,
-    104487,
-    104497,
-    104507,
     104517,
-    104528,
-    104538,
-    104548,
-    104559,
-    104569,
-    104579,
-    104589,
-    104600,
-    104610,
-    104620,
-    104630,
-    104641,
-    104651,
-    104661,
-    104671,
     104682,
-    104692,
-    104702,
-    104713,
-    104723,
-    104733,
-    104743,
-    104754,
-    104764,
-    104774,
-    104784,
-    104795,
-    104805,
-    104815,
-    104825,
-    104836,
     104846,
-    104856,
-    104866,
-    104877,
-    104887,
-    104897,
-    104907,
-    104918,
-    104928,
-    104938,
-    104949,
-    104959,
-    104969,
-    104979,
-    104990,
-    105000,
     105010,
-    105020,
-    105031,
-    105041,
-    105051,
-    105061,
-    105072,
-    105082,
-    105092,
-    105102,
-    105113,
-    105123,
-    105133,
-    105143,
-    105154,
-    105164,
     105174,
-    105184,
-    105195,
-    105205,
-    105215,
-    105225,
-    105236,
-    105246,
-    105256,
-    105266,
-    105277,
-    105287,
-    105297,
-    105307,
-    105318,
-    105328,
     105338,
-    105348,
-    105359,
-    105369,
-    105379,
-    105389,
-    105399,
-    105410,
-    105420,
-    105430,
-    105440,
-    105451,
-    105461,
-    105471,
-    105481,
-    105492,
     105502,
-    105512,
-    105522,
-    105533,
-    105543,
-    105553,
-    105563,
-    105574,
-    105584,
-    105594,
-    105604,
-    105615,
-    105625,
-    105635,
-    105645,
-    105655,
     105666,
-    105676,
-    105686,
-    105696,
-    105707,
-    105717,
-    105727,
-    105737,
-    105748,
-    105758,
-    105768,
-    105778,
-    105788,
-    105799,
-    105809,
-    105819,
     105829,
-    105840,
-    105850,
-    105860,
-    105870,
-    105881,
-    105891,
-    105901,
-    105911,
-    105921,
-    105932,
-    105942,
-    105952,
-    105962,
-    105973,
-    105983,
     105993,
-    106003,
-    106013,
-    106024,
-    106034,
-    106044,
-    106054,
-    106065,
-    106075,
-    106085,
-    106095,
-    106105,
-    106116,
-    106126,
-    106136,
-    106146,
     106157,
-    106167,
-    106177,
-    106187,
-    106197,
-    106208,
-    106218,
-    106228,
-    106238,
-    106248,
-    106259,
-    106269,
-    106279,
-    106289,
-    106300,
-    106310,
     106320,
-    106330,
-    106340,
-    106351,
-    106361,
-    106371,
-    106381,
-    106391,
-    106402,
-    106412,
-    106422,
-    106432,
-    106442,
-    106453,
-    106463,
-    106473,
     106483,
-    106494,
-    106504,
-    106514,
-    106524,
-    106534,
-    106545,
-    106555,
-    106565,
-    106575,
-    106585,
-    106596,
-    106606,
-    106616,
-    106626,
-    106636,
     106647,
-    106657,
-    106667,
-    106677,
-    106687,
-    106698,
-    106708,
-    106718,
-    106728,
-    106738,
-    106749,
-    106759,
-    106769,
-    106779,
-    106789,
-    106800,
     106810,
-    106820,
-    106830,
-    106840,
-    106851,
-    106861,
-    106871,
-    106881,
-    106891,
-    106902,
-    106912,
-    106922,
-    106932,
-    106942,
-    106953,
-    106963,
     106973,
-    106983,
-    106993,
-    107003,
-    107014,
-    107024,
-    107034,
-    107044,
-    107054,
-    107065,
-    107075,
-    107085,
-    107095,
-    107105,
-    107116,
-    107126,
     107136,
-    107146,
-    107156,
-    107166,
-    107177,
-    107187,
-    107197,
-    107207,
-    107217,
-    107228,
-    107238,
-    107248,
-    107258,
-    107268,
-    107279,
-    107289,
     107299,
-    107309,
-    107319,
-    107329,
-    107340,
-    107350,
-    107360,
-    107370,
-    107380,
-    107390,
-    107401,
-    107411,
-    107421,
-    107431,
-    107441,
-    107452,
     107462,
-    107472,
-    107482,
-    107492,
-    107502,
-    107513,
-    107523,
-    107533,
-    107543,
-    107553,
-    107563,
-    107574,
-    107584,
-    107594,
-    107604,
-    107614,
     107625,
-    107635,
-    107645,
-    107655,
-    107665,
-    107675,
-    107686,
-    107696,
-    107706,
-    107716,
-    107726,
-    107736,
-    107747,
-    107757,
-    107767,
-    107777,
     107787,
-    107797,
-    107808,
-    107818,
-    107828,
-    107838,
-    107848,
-    107858,
-    107869,
-    107879,
-    107889,
-    107899,
-    107909,
-    107919,
-    107930,
-    107940,
     107950,
-    107960,
-    107970,
-    107980,
-    107990,
-    108001,
-    108011,
-    108021,
-    108031,
-    108041,
-    108051,
-    108062,
-    108072,
-    108082,
-    108092,
-    108102,
     108112,
-    108123,
-    108133,
-    108143,
-    108153,
-    108163,
-    108173,
-    108183,
-    108194,
-    108204,
-    108214,
-    108224,
-    108234,
-    108244,
-    108255,
-    108265,
     108275,
-    108285,
-    108295,
-    108305,
-    108315,
-    108326,
-    108336,
-    108346,
-    108356,
-    108366,
-    108376,
-    108386,
-    108397,
-    108407,
-    108417,
-    108427,
     108437,
-    108447,
-    108457,
-    108468,
-    108478,
-    108488,
-    108498,
-    108508,
-    108518,
-    108528,
-    108539,
-    108549,
-    108559,
-    108569,
-    108579,
-    108589,
     108599,
-    108610,
-    108620,
-    108630,
-    108640,
-    108650,
-    108660,
-    108670,
-    108681,
-    108691,
-    108701,
-    108711,
-    108721,
-    108731,
-    108741,
-    108752,
     108762,
-    108772,
-    108782,
-    108792,
-    108802,
-    108812,
-    108822,
-    108833,
-    108843,
-    108853,
-    108863,
-    108873,
-    108883,
-    108893,
-    108904,
-    108914,
     108924,
-    108934,
-    108944,
-    108954,
-    108964,
-    108974,
-    108985,
-    108995,
-    109005,
-    109015,
-    109025,
-    109035,
-    109045,
-    109055,
-    109066,
-    109076,
     109086,
-    109096,
-    109106,
-    109116,
-    109126,
-    109136,
-    109147,
-    109157,
-    109167,
-    109177,
-    109187,
-    109197,
-    109207,
-    109217,
-    109228,
-    109238,
     109248,
-    109258,
-    109268,
-    109278,
-    109288,
-    109298,
-    109309,
-    109319,
-    109329,
-    109339,
-    109349,
-    109359,
-    109369,
-    109379,
-    109389,
-    109400,
     109410,
-    109420,
-    109430,
-    109440,
-    109450,
-    109460,
-    109470,
-    109481,
-    109491,
-    109501,
-    109511,
-    109521,
-    109531,
-    109541,
-    109551,
-    109561,
     109572,
-    109582,
-    109592,
-    109602,
-    109612,
-    109622,
-    109632,
-    109642,
-    109652,
-    109663,
-    109673,
-    109683,
-    109693,
-    109703,
-    109713,
-    109723,
     109733,
-    109743,
-    109753,
-    109764,
-    109774,
-    109784,
-    109794,
-    109804,
-    109814,
-    109824,
-    109834,
-    109844,
-    109855,
-    109865,
-    109875,
-    109885,
     109895,
-    109905,
-    109915,
-    109925,
-    109935,
-    109945,
-    109956,
-    109966,
-    109976,
-    109986,
-    109996,
-    110006,
-    110016,
-    110026,
-    110036,
-    110046,
     110056,
-    110067,
-    110077,
-    110087,
-    110097,
-    110107,
-    110117,
-    110127,
-    110137,
-    110147,
-    110157,
-    110168,
-    110178,
-    110188,
-    110198,
-    110208,
     110218,
-    110228,
-    110238,
-    110248,
-    110258,
-    110268,
-    110279,
-    110289,
-    110299,
-    110309,
-    110319,
-    110329,
-    110339,
-    110349,
-    110359,
-    110369,
     110379,
-    110389,
-    110400,
-    110410,
-    110420,
-    110430,
-    110440,
-    110450,
-    110460,
-    110470,
-    110480,
-    110490,
-    110500,
-    110510,
-    110521,
-    110531,
     110541,
-    110551,
-    110561,
-    110571,
-    110581,
-    110591,
-    110601,
-    110611,
-    110621,
-    110631,
-    110642,
-    110652,
-    110662,
-    110672,
-    110682,
-    110692,
     110702,
-    110712,
-    110722,
-    110732,
-    110742,
-    110752,
-    110762,
-    110773,
-    110783,
-    110793,
-    110803,
-    110813,
-    110823,
-    110833,
-    110843,
-    110853,
     110863,
-    110873,
-    110883,
-    110893,
-    110903,
-    110914,
-    110924,
-    110934,
-    110944,
-    110954,
-    110964,
-    110974,
-    110984,
-    110994,
-    111004,
-    111014,
     111024,
-    111034,
-    111044,
-    111054,
-    111065,
-    111075,
-    111085,
-    111095,
-    111105,
-    111115,
-    111125,
-    111135,
-    111145,
-    111155,
-    111165,
-    111175,
     111185,
-    111195,
-    111205,
-    111215,
-    111226,
-    111236,
-    111246,
-    111256,
-    111266,
-    111276,
-    111286,
-    111296,
-    111306,
-    111316,
-    111326,
-    111336,
     111346,
-    111356,
-    111366,
-    111376,
-    111386,
-    111396,
-    111407,
-    111417,
-    111427,
-    111437,
-    111447,
-    111457,
-    111467,
-    111477,
-    111487,
-    111497,
     111507,
-    111517,
-    111527,
-    111537,
-    111547,
-    111557,
-    111567,
-    111577,
-    111587,
-    111598,
-    111608,
-    111618,
-    111628,
-    111638,
-    111648,
-    111658,
     111668,
-    111678,
-    111688,
-    111698,
-    111708,
-    111718,
-    111728,
-    111738,
-    111748,
-    111758,
-    111768,
-    111778,
-    111788,
-    111798,
-    111809,
-    111819,
     111829,
-    111839,
-    111849,
-    111859,
-    111869,
-    111879,
-    111889,
-    111899,
-    111909,
-    111919,
-    111929,
-    111939,
-    111949,
-    111959,
-    111969,
-    111979,
     111989,
-    111999,
-    112009,
-    112019,
-    112029,
-    112039,
-    112049,
-    112059,
-    112070,
-    112080,
-    112090,
-    112100,
-    112110,
-    112120,
-    112130,
-    112140,
     112150,
-    112160,
-    112170,
-    112180,
-    112190,
-    112200,
-    112210,
-    112220,
-    112230,
-    112240,
-    112250,
-    112260,
-    112270,
-    112280,
-    112290,
-    112300,
     112310,
-    112320,
-    112330,
-    112340,
-    112350,
-    112360,
-    112370,
-    112380,
-    112390,
-    112400,
-    112411,
-    112421,
-    112431,
-    112441,
-    112451,
-    112461,
     112471,
-    112481,
-    112491,
-    112501,
-    112511,
-    112521,
-    112531,
-    112541,
-    112551,
-    112561,
-    112571,
-    112581,
-    112591,
-    112601,
-    112611,
-    112621,
     112631,
-    112641,
-    112651,
-    112661,
-    112671,
-    112681,
-    112691,
-    112701,
-    112711,
-    112721,
-    112731,
-    112741,
-    112751,
-    112761,
-    112771,
-    112781,
     112791,
-    112801,
-    112811,
-    112821,
-    112831,
-    112841,
-    112851,
-    112861,
-    112871,
-    112881,
-    112891,
-    112901,
-    112911,
-    112921,
-    112931,
-    112941,
     112951,
-    112961,
-    112971,
-    112981,
-    112991,
-    113001,
-    113011,
-    113021,
-    113031,
-    113041,
-    113051,
-    113062,
-    113072,
-    113082,
-    113092,
-    113102,
     113112,
-    113122,
-    113132,
-    113142,
-    113152,
-    113162,
-    113172,
-    113182,
-    113192,
-    113202,
-    113212,
-    113222,
-    113232,
-    113242,
-    113252,
-    113262,
     113272,
-    113282,
-    113292,
-    113302,
-    113312,
-    113322,
-    113332,
-    113342,
-    113352,
-    113362,
-    113372,
-    113382,
-    113392,
-    113402,
-    113412,
-    113422,
     113432,
-    113441,
-    113451,
-    113461,
-    113471,
-    113481,
-    113491,
-    113501,
-    113511,
-    113521,
-    113531,
-    113541,
-    113551,
-    113561,
-    113571,
-    113581,
     113591,
-    113601,
-    113611,
-    113621,
-    113631,
-    113641,
-    113651,
-    113661,
-    113671,
-    113681,
-    113691,
-    113701,
-    113711,
-    113721,
-    113731,
-    113741,
     113751,
-    113761,
-    113771,
-    113781,
-    113791,
-    113801,
-    113811,
-    113821,
-    113831,
-    113841,
-    113851,
-    113861,
-    113871,
-    113881,
-    113891,
-    113901,
     113911,
-    113921,
-    113931,
-    113941,
-    113951,
-    113961,
-    113971,
-    113981,
-    113991,
-    114001,
-    114011,
-    114021,
-    114031,
-    114041,
-    114051,
-    114061,
     114071,
-    114081,
-    114091,
-    114100,
-    114110,
-    114120,
-    114130,
-    114140,
-    114150,
-    114160,
-    114170,
-    114180,
-    114190,
-    114200,
-    114210,
-    114220,
     114230,
-    114240,
-    114250,
-    114260,
-    114270,
-    114280,
-    114290,
-    114300,
-    114310,
-    114320,
-    114330,
-    114340,
-    114350,
-    114360,
-    114370,
-    114380,
     114390,
-    114400,
-    114410,
-    114420,
-    114429,
-    114439,
-    114449,
-    114459,
-    114469,
-    114479,
-    114489,
-    114499,
-    114509,
-    114519,
-    114529,
-    114539,
     114549,
-    114559,
-    114569,
-    114579,
-    114589,
-    114599,
-    114609,
-    114619,
-    114629,
-    114639,
-    114649,
-    114659,
-    114669,
-    114679,
-    114688,
-    114698,
     114708,
-    114718,
-    114728,
-    114738,
-    114748,
-    114758,
-    114768,
-    114778,
-    114788,
-    114798,
-    114808,
-    114818,
-    114828,
-    114838,
-    114848,
-    114858,
     114868,
-    114878,
-    114888,
-    114898,
-    114908,
-    114917,
-    114927,
-    114937,
-    114947,
-    114957,
-    114967,
-    114977,
-    114987,
-    114997,
-    115007,
-    115017,
     115027,
-    115037,
-    115047,
-    115057,
-    115067,
-    115077,
-    115087,
-    115097,
-    115106,
-    115116,
-    115126,
-    115136,
-    115146,
-    115156,
-    115166,
-    115176,
     115186,
-    115196,
-    115206,
-    115216,
-    115226,
-    115236,
-    115246,
-    115256,
-    115266,
-    115276,
-    115285,
-    115295,
-    115305,
-    115315,
-    115325,
-    115335,
     115345,
-    115355,
-    115365,
-    115375,
-    115385,
-    115395,
-    115405,
-    115415,
-    115425,
-    115435,
-    115444,
-    115454,
-    115464,
-    115474,
-    115484,
-    115494,
     115504,
-    115514,
-    115524,
-    115534,
-    115544,
-    115554,
-    115564,
-    115574,
-    115584,
-    115593,
-    115603,
-    115613,
-    115623,
-    115633,
-    115643,
-    115653,
     115663,
-    115673,
-    115683,
-    115693,
-    115703,
-    115713,
-    115723,
-    115732,
-    115742,
-    115752,
-    115762,
-    115772,
-    115782,
-    115792,
-    115802,
-    115812,
     115822,
-    115832,
-    115842,
-    115852,
-    115862,
-    115871,
-    115881,
-    115891,
-    115901,
-    115911,
-    115921,
-    115931,
-    115941,
-    115951,
-    115961,
-    115971,
     115981,
-    115991,
-    116000,
-    116010,
-    116020,
-    116030,
-    116040,
-    116050,
-    116060,
-    116070,
-    116080,
-    116090,
-    116100,
-    116110,
-    116119,
-    116129,
     116139,
-    116149,
-    116159,
-    116169,
-    116179,
-    116189,
-    116199,
-    116209,
-    116219,
-    116229,
-    116238,
-    116248,
-    116258,
-    116268,
-    116278,
-    116288,
     116298,
-    116308,
-    116318,
-    116328,
-    116338,
-    116347,
-    116357,
-    116367,
-    116377,
-    116387,
-    116397,
-    116407,
-    116417,
-    116427,
-    116437,
-    116447,
     116456,
-    116466,
-    116476,
-    116486,
-    116496,
-    116506,
-    116516,
-    116526,
-    116536,
-    116546,
-    116556,
-    116565,
-    116575,
-    116585,
-    116595,
-    116605,
     116615,
-    116625,
-    116635,
-    116645,
-    116655,
-    116664,
-    116674,
-    116684,
-    116694,
-    116704,
-    116714,
-    116724,
-    116734,
-    116744,
-    116754,
-    116763,
     116773,
-    116783,
-    116793,
-    116803,
-    116813,
-    116823,
-    116833,
-    116843,
-    116853,
-    116862,
-    116872,
-    116882,
-    116892,
-    116902,
-    116912,
-    116922,
     116932,
-    116942,
-    116951,
-    116961,
-    116971,
-    116981,
-    116991,
-    117001,
-    117011,
-    117021,
-    117031,
-    117041,
-    117050,
-    117060,
-    117070,
-    117080,
     117090,
-    117100,
-    117110,
-    117120,
-    117130,
-    117139,
-    117149,
-    117159,
-    117169,
-    117179,
-    117189,
-    117199,
-    117209,
-    117219,
-    117228,
-    117238,
     117248,
-    117258,
-    117268,
-    117278,
-    117288,
-    117298,
-    117307,
-    117317,
-    117327,
-    117337,
-    117347,
-    117357,
-    117367,
-    117377,
-    117387,
-    117396,
     117406,
-    117416,
-    117426,
-    117436,
-    117446,
-    117456,
-    117466,
-    117475,
-    117485,
-    117495,
-    117505,
-    117515,
-    117525,
-    117535,
-    117545,
-    117554,
     117564,
-    117574,
-    117584,
-    117594,
-    117604,
-    117614,
-    117624,
-    117633,
-    117643,
-    117653,
-    117663,
-    117673,
-    117683,
-    117693,
-    117703,
-    117712,
     117722,
-    117732,
-    117742,
-    117752,
-    117762,
-    117772,
-    117782,
-    117791,
-    117801,
-    117811,
-    117821,
-    117831,
-    117841,
-    117851,
-    117860,
-    117870,
     117880,
-    117890,
-    117900,
-    117910,
-    117920,
-    117930,
-    117939,
-    117949,
-    117959,
-    117969,
-    117979,
-    117989,
-    117999,
-    118008,
-    118018,
-    118028,
     118038,
-    118048,
-    118058,
-    118068,
-    118078,
-    118087,
-    118097,
-    118107,
-    118117,
-    118127,
-    118137,
-    118147,
-    118156,
-    118166,
-    118176,
-    118186,
     118196,
-    118206,
-    118216,
-    118225,
-    118235,
-    118245,
-    118255,
-    118265,
-    118275,
-    118285,
-    118294,
-    118304,
-    118314,
-    118324,
-    118334,
-    118344,
     118354,
-    118363,
-    118373,
-    118383,
-    118393,
-    118403,
-    118413,
-    118423,
-    118432,
-    118442,
-    118452,
-    118462,
-    118472,
-    118482,
-    118491,
-    118501,
     118511,
-    118521,
-    118531,
-    118541,
-    118551,
-    118560,
-    118570,
-    118580,
-    118590,
-    118600,
-    118610,
-    118619,
-    118629,
-    118639,
-    118649,
-    118659,
     118669,
-    118679,
-    118688,
-    118698,
-    118708,
-    118718,
-    118728,
-    118738,
-    118747,
-    118757,
-    118767,
-    118777,
-    118787,
-    118797,
-    118807,
-    118816,
     118826,
-    118836,
-    118846,
-    118856,
-    118866,
-    118875,
-    118885,
-    118895,
-    118905,
-    118915,
-    118925,
-    118934,
-    118944,
-    118954,
-    118964,
-    118974,
     118984,
-    118993,
-    119003,
-    119013,
-    119023,
-    119033,
-    119043,
-    119052,
-    119062,
-    119072,
-    119082,
-    119092,
-    119102,
-    119111,
-    119121,
-    119131,
     119141,
-    119151,
-    119161,
-    119170,
-    119180,
-    119190,
-    119200,
-    119210,
-    119220,
-    119229,
-    119239,
-    119249,
-    119259,
-    119269,
-    119279,
-    119288,
     119298,
-    119308,
-    119318,
-    119328,
-    119338,
-    119347,
-    119357,
-    119367,
-    119377,
-    119387,
-    119397,
-    119406,
-    119416,
-    119426,
-    119436,
-    119446,
     119455,
-    119465,
-    119475,
-    119485,
-    119495,
-    119505,
-    119514,
-    119524,
-    119534,
-    119544,
-    119554,
-    119564,
-    119573,
-    119583,
-    119593,
-    119603,
     119613,
-    119622,
-    119632,
-    119642,
-    119652,
-    119662,
-    119672,
-    119681,
-    119691,
-    119701,
-    119711,
-    119721,
-    119730,
-    119740,
-    119750,
-    119760,
     119770,
-    119780,
-    119789,
-    119799,
-    119809,
-    119819,
-    119829,
-    119838,
-    119848,
-    119858,
-    119868,
-    119878,
-    119887,
-    119897,
-    119907,
-    119917,
     119927,
-    119937,
-    119946,
-    119956,
-    119966,
-    119976,
-    119986,
-    119995,
-    120005,
-    120015,
-    120025,
-    120035,
-    120044,
-    120054,
-    120064,
-    120074,
     120084,
-    120093,
-    120103,
-    120113,
-    120123,
-    120133,
-    120142,
-    120152,
-    120162,
-    120172,
-    120182,
-    120192,
-    120201,
-    120211,
-    120221,
-    120231,
     120241,
-    120250,
-    120260,
-    120270,
-    120280,
-    120290,
-    120299,
-    120309,
-    120319,
-    120329,
-    120339,
-    120348,
-    120358,
-    120368,
-    120378,
-    120388,
     120397,
-    120407,
-    120417,
-    120427,
-    120437,
-    120446,
-    120456,
-    120466,
-    120476,
-    120485,
-    120495,
-    120505,
-    120515,
-    120525,
-    120534,
-    120544,
     120554,
-    120564,
-    120574,
-    120583,
-    120593,
-    120603,
-    120613,
-    120623,
-    120632,
-    120642,
-    120652,
-    120662,
-    120672,
-    120681,
-    120691,
-    120701,
     120711,
-    120721,
-    120730,
-    120740,
-    120750,
-    120760,
-    120769,
-    120779,
-    120789,
-    120799,
-    120809,
-    120818,
-    120828,
-    120838,
-    120848,
-    120858,
     120867,
-    120877,
-    120887,
-    120897,
-    120906,
-    120916,
-    120926,
-    120936,
-    120946,
-    120955,
-    120965,
-    120975,
-    120985,
-    120995,
-    121004,
-    121014,
     121024,
-    121034,
-    121043,
-    121053,
-    121063,
-    121073,
-    121083,
-    121092,
-    121102,
-    121112,
-    121122,
-    121131,
-    121141,
-    121151,
-    121161,
-    121171,
     121180,
-    121190,
-    121200,
-    121210,
-    121219,
-    121229,
-    121239,
-    121249,
-    121259,
-    121268,
-    121278,
-    121288,
-    121298,
-    121307,
-    121317,
-    121327,
     121337,
-    121346,
-    121356,
-    121366,
-    121376,
-    121386,
-    121395,
-    121405,
-    121415,
-    121425,
-    121434,
-    121444,
-    121454,
-    121464,
-    121473,
-    121483,
     121493,
-    121503,
-    121513,
-    121522,
-    121532,
-    121542,
-    121552,
-    121561,
-    121571,
-    121581,
-    121591,
-    121600,
-    121610,
-    121620,
-    121630,
-    121640,
     121649,
-    121659,
-    121669,
-    121679,
-    121688,
-    121698,
-    121708,
-    121718,
-    121727,
-    121737,
-    121747,
-    121757,
-    121766,
-    121776,
-    121786,
-    121796,
     121805,
-    121815,
-    121825,
-    121835,
-    121845,
-    121854,
-    121864,
-    121874,
-    121884,
-    121893,
-    121903,
-    121913,
-    121923,
-    121932,
-    121942,
-    121952,
     121962,
-    121971,
-    121981,
-    121991,
-    122001,
-    122010,
-    122020,
-    122030,
-    122040,
-    122049,
-    122059,
-    122069,
-    122079,
-    122088,
-    122098,
-    122108,
     122118,
-    122127,
-    122137,
-    122147,
-    122157,
-    122166,
-    122176,
-    122186,
-    122196,
-    122205,
-    122215,
-    122225,
-    122235,
-    122244,
-    122254,
-    122264,
     122274,
-    122283,
-    122293,
-    122303,
-    122313,
-    122322,
-    122332,
-    122342,
-    122352,
-    122361,
-    122371,
-    122381,
-    122391,
-    122400,
-    122410,
-    122420,
     122430,
-    122439,
-    122449,
-    122459,
-    122469,
-    122478,
-    122488,
-    122498,
-    122508,
-    122517,
-    122527,
-    122537,
-    122547,
-    122556,
-    122566,
-    122576,
     122585,
-    122595,
-    122605,
-    122615,
-    122624,
-    122634,
-    122644,
-    122654,
-    122663,
-    122673,
-    122683,
-    122693,
-    122702,
-    122712,
-    122722,
-    122732,
     122741,
-    122751,
-    122761,
-    122770,
-    122780,
-    122790,
-    122800,
-    122809,
-    122819,
-    122829,
-    122839,
-    122848,
-    122858,
-    122868,
-    122878,
-    122887,
     122897,
-    122907,
-    122916,
-    122926,
-    122936,
-    122946,
-    122955,
-    122965,
-    122975,
-    122985,
-    122994,
-    123004,
-    123014,
-    123023,
-    123033,
-    123043,
     123053,
-    123062,
-    123072,
-    123082,
-    123092,
-    123101,
-    123111,
-    123121,
-    123130,
-    123140,
-    123150,
-    123160,
-    123169,
-    123179,
-    123189,
-    123199,
     123208,
-    123218,
-    123228,
-    123237,
-    123247,
-    123257,
-    123267,
-    123276,
-    123286,
-    123296,
-    123305,
-    123315,
-    123325,
-    123335,
-    123344,
-    123354,
     123364,
-    123374,
-    123383,
-    123393,
-    123403,
-    123412,
-    123422,
-    123432,
-    123442,
-    123451,
-    123461,
-    123471,
-    123480,
-    123490,
-    123500,
-    123510,
     123519,
-    123529,
-    123539,
-    123548,
-    123558,
-    123568,
-    123578,
-    123587,
-    123597,
-    123607,
-    123616,
-    123626,
-    123636,
-    123646,
-    123655,
-    123665,
     123675,
-    123684,
-    123694,
-    123704,
-    123713,
-    123723,
-    123733,
-    123743,
-    123752,
-    123762,
-    123772,
-    123781,
-    123791,
-    123801,
-    123811,
-    123820,
     123830,
-    123840,
-    123849,
-    123859,
-    123869,
-    123879,
-    123888,
-    123898,
-    123908,
-    123917,
-    123927,
-    123937,
-    123946,
-    123956,
-    123966,
-    123976,
     123985,
-    123995,
-    124005,
-    124014,
-    124024,
-    124034,
-    124043,
-    124053,
-    124063,
-    124073,
-    124082,
-    124092,
-    124102,
-    124111,
-    124121,
-    124131,
     124140,
-    124150,
-    124160,
-    124170,
-    124179,
-    124189,
-    124199,
-    124208,
-    124218,
-    124228,
-    124237,
-    124247,
-    124257,
-    124267,
-    124276,
-    124286,
     124296,
-    124305,
-    124315,
-    124325,
-    124334,
-    124344,
-    124354,
-    124363,
-    124373,
-    124383,
-    124393,
-    124402,
-    124412,
-    124422,
-    124431,
-    124441,
     124451,
-    124460,
-    124470,
-    124480,
-    124489,
-    124499,
-    124509,
-    124519,
-    124528,
-    124538,
-    124548,
-    124557,
-    124567,
-    124577,
-    124586,
-    124596,
     124606,
-    124615,
-    124625,
-    124635,
-    124644,
-    124654,
-    124664,
-    124674,
-    124683,
-    124693,
-    124703,
-    124712,
-    124722,
-    124732,
-    124741,
-    124751,
     124761,
-    124770,
-    124780,
-    124790,
-    124799,
-    124809,
-    124819,
-    124828,
-    124838,
-    124848,
-    124857,
-    124867,
-    124877,
-    124887,
-    124896,
-    124906,
     124916,
-    124925,
-    124935,
-    124945,
-    124954,
-    124964,
-    124974,
-    124983,
-    124993,
-    125003,
-    125012,
-    125022,
-    125032,
-    125041,
-    125051,
-    125061,
     125070,
-    125080,
-    125090,
-    125099,
-    125109,
-    125119,
-    125128,
-    125138,
-    125148,
-    125157,
-    125167,
-    125177,
-    125186,
-    125196,
-    125206,
-    125215,
     125225,
-    125235,
-    125244,
-    125254,
-    125264,
-    125273,
-    125283,
-    125293,
-    125302,
-    125312,
-    125322,
-    125331,
-    125341,
-    125351,
-    125360,
-    125370,
     125380,
-    125389,
-    125399,
-    125409,
-    125418,
-    125428,
-    125438,
-    125447,
-    125457,
-    125467,
-    125476,
-    125486,
-    125496,
-    125505,
-    125515,
-    125525,
     125534,
-    125544,
-    125554,
-    125563,
-    125573,
-    125583,
-    125592,
-    125602,
-    125612,
-    125621,
-    125631,
-    125641,
-    125650,
-    125660,
-    125670,
-    125679,
     125689,
-    125699,
-    125708,
-    125718,
-    125728,
-    125737,
-    125747,
-    125757,
-    125766,
-    125776,
-    125786,
-    125795,
-    125805,
-    125815,
-    125824,
-    125834,
     125844,
-    125853,
-    125863,
-    125872,
-    125882,
-    125892,
-    125901,
-    125911,
-    125921,
-    125930,
-    125940,
-    125950,
-    125959,
-    125969,
-    125979,
-    125988,
     125998,
-    126008,
-    126017,
-    126027,
-    126037,
-    126046,
-    126056,
-    126066,
-    126075,
-    126085,
-    126094,
-    126104,
-    126114,
-    126123,
-    126133,
-    126143,
     126152,
-    126162,
-    126172,
-    126181,
-    126191,
-    126201,
-    126210,
-    126220,
-    126230,
-    126239,
-    126249,
-    126258,
-    126268,
-    126278,
-    126287,
-    126297,
     126307,
-    126316,
-    126326,
-    126336,
-    126345,
-    126355,
-    126365,
-    126374,
-    126384,
-    126393,
-    126403,
-    126413,
-    126422,
-    126432,
-    126442,
-    126451,
     126461,
-    126471,
-    126480,
-    126490,
-    126499,
-    126509,
-    126519,
-    126528,
-    126538,
-    126548,
-    126557,
-    126567,
-    126577,
-    126586,
-    126596,
-    126605,
     126615,
-    126625,
-    126634,
-    126644,
-    126654,
-    126663,
-    126673,
-    126683,
-    126692,
-    126702,
-    126711,
-    126721,
-    126731,
-    126740,
-    126750,
-    126760,
     126769,
-    126779,
-    126788,
-    126798,
-    126808,
-    126817,
-    126827,
-    126837,
-    126846,
-    126856,
-    126866,
-    126875,
-    126885,
-    126894,
-    126904,
-    126914,
     126923,
-    126933,
-    126943,
-    126952,
-    126962,
-    126971,
-    126981,
-    126991,
-    127000,
-    127010,
-    127020,
-    127029,
-    127039,
-    127048,
-    127058,
-    127068,
     127077,
-    127087,
-    127097,
-    127106,
-    127116,
-    127125,
-    127135,
-    127145,
-    127154,
-    127164,
-    127174,
-    127183,
-    127193,
-    127202,
-    127212,
-    127222,
     127231,
-    127241,
-    127250,
-    127260,
-    127270,
-    127279,
-    127289,
-    127299,
-    127308,
-    127318,
-    127327,
-    127337,
-    127347,
-    127356,
-    127366,
-    127375,
     127385,
-    127395,
-    127404,
-    127414,
-    127424,
-    127433,
-    127443,
-    127452,
-    127462,
-    127472,
-    127481,
-    127491,
-    127500,
-    127510,
-    127520,
-    127529,
     127539,
-    127549,
-    127558,
-    127568,
-    127577,
-    127587,
-    127597,
-    127606,
-    127616,
-    127625,
-    127635,
-    127645,
-    127654,
-    127664,
-    127673,
-    127683,
     127693,
-    127702,
-    127712,
-    127721,
-    127731,
-    127741,
-    127750,
-    127760,
-    127770,
-    127779,
-    127789,
-    127798,
-    127808,
-    127818,
-    127827,
-    127837,
     127846,
-    127856,
-    127866,
-    127875,
-    127885,
-    127894,
-    127904,
-    127914,
-    127923,
-    127933,
-    127942,
-    127952,
-    127962,
-    127971,
-    127981,
-    127990,
     128000,
-    128010,
-    128019,
-    128029,
-    128038,
-    128048,
-    128058,
-    128067,
-    128077,
-    128086,
-    128096,
-    128106,
-    128115,
-    128125,
-    128134,
-    128144,
     128154,
-    128163,
-    128173,
-    128182,
-    128192,
-    128202,
-    128211,
-    128221,
-    128230,
-    128240,
-    128250,
-    128259,
-    128269,
-    128278,
-    128288,
-    128297,
     128307,
-    128317,
-    128326,
-    128336,
-    128345,
-    128355,
-    128365,
-    128374,
-    128384,
-    128393,
-    128403,
-    128413,
-    128422,
-    128432,
-    128441,
-    128451,
     128461,
-    128470,
-    128480,
-    128489,
-    128499,
-    128508,
-    128518,
-    128528,
-    128537,
-    128547,
-    128556,
-    128566,
-    128576,
-    128585,
-    128595,
-    128604,
     128614,
-    128623,
-    128633,
-    128643,
-    128652,
-    128662,
-    128671,
-    128681,
-    128691,
-    128700,
-    128710,
-    128719,
-    128729,
-    128738,
-    128748,
-    128758,
     128767,
-    128777,
-    128786,
-    128796,
-    128806,
-    128815,
-    128825,
-    128834,
-    128844,
-    128853,
-    128863,
-    128873,
-    128882,
-    128892,
-    128901,
-    128911,
     128920,
-    128930,
-    128940,
-    128949,
-    128959,
-    128968,
-    128978,
-    128988,
-    128997,
-    129007,
-    129016,
-    129026,
-    129035,
-    129045,
-    129055,
-    129064,
     129074,
-    129083,
-    129093,
-    129102,
-    129112,
-    129122,
-    129131,
-    129141,
-    129150,
-    129160,
-    129169,
-    129179,
-    129189,
-    129198,
-    129208,
-    129217,
     129227,
-    129236,
-    129246,
-    129256,
-    129265,
-    129275,
-    129284,
-    129294,
-    129303,
-    129313,
-    129323,
-    129332,
-    129342,
-    129351,
-    129361,
-    129370,
     129380,
-    129389,
-    129399,
-    129409,
-    129418,
-    129428,
-    129437,
-    129447,
-    129456,
-    129466,
-    129476,
-    129485,
-    129495,
-    129504,
-    129514,
-    129523,
     129533,
-    129543,
-    129552,
-    129562,
-    129571,
-    129581,
-    129590,
-    129600,
-    129609,
-    129619,
-    129629,
-    129638,
-    129648,
-    129657,
-    129667,
-    129676,
     129686,
-    129695,
-    129705,
-    129715,
-    129724,
-    129734,
-    129743,
-    129753,
-    129762,
-    129772,
-    129781,
-    129791,
-    129801,
-    129810,
-    129820,
-    129829,
     129839,
-    129848,
-    129858,
-    129867,
-    129877,
-    129887,
-    129896,
-    129906,
-    129915,
-    129925,
-    129934,
-    129944,
-    129953,
-    129963,
-    129973,
-    129982,
     129992,
-    130001,
-    130011,
-    130020,
-    130030,
-    130039,
-    130049,
-    130059,
-    130068,
-    130078,
-    130087,
-    130097,
-    130106,
-    130116,
-    130125,
-    130135,
     130144,
-    130154,
-    130164,
-    130173,
-    130183,
-    130192,
-    130202,
-    130211,
-    130221,
-    130230,
-    130240,
-    130249,
-    130259,
-    130269,
-    130278,
-    130288,
     130297,
-    130307,
-    130316,
-    130326,
-    130335,
-    130345,
-    130354,
-    130364,
-    130373,
-    130383,
-    130393,
-    130402,
-    130412,
-    130421,
-    130431,
-    130440,
     130450,
-    130459,
-    130469,
-    130478,
-    130488,
-    130498,
-    130507,
-    130517,
-    130526,
-    130536,
-    130545,
-    130555,
-    130564,
-    130574,
-    130583,
-    130593,
     130602,
-    130612,
-    130621,
-    130631,
-    130641,
-    130650,
-    130660,
-    130669,
-    130679,
-    130688,
-    130698,
-    130707,
-    130717,
-    130726,
-    130736,
-    130745,
     130755,
-    130764,
-    130774,
-    130784,
-    130793,
-    130803,
-    130812,
-    130822,
-    130831,
-    130841,
-    130850,
-    130860,
-    130869,
-    130879,
-    130888,
-    130898,
     130907,
-    130917,
-    130927,
-    130936,
-    130946,
-    130955,
-    130965,
-    130974,
-    130984,
-    130993,
-    131003,
-    131012,
-    131022,
-    131031,
-    131041,
-    131050,
     131060,
-    131069,
-    131079,
-    131088,
-    131098,
-    131107,
-    131117,
-    131127,
-    131136,
-    131146,
-    131155,
-    131165,
-    131174,
-    131184,
-    131193,
-    131203,
     131212,
-    131222,
-    131231,
-    131241,
-    131250,
-    131260,
-    131269,
-    131279,
-    131288,
-    131298,
-    131307,
-    131317,
-    131326,
-    131336,
-    131346,
-    131355,
     131365,
-    131374,
-    131384,
-    131393,
-    131403,
-    131412,
-    131422,
-    131431,
-    131441,
-    131450,
-    131460,
-    131469,
-    131479,
-    131488,
-    131498,
-    131507,
     131517,
-    131526,
-    131536,
-    131545,
-    131555,
-    131564,
-    131574,
-    131583,
-    131593,
-    131602,
-    131612,
-    131621,
-    131631,
-    131640,
-    131650,
-    131659,
     131669,
-    131678,
-    131688,
-    131698,
-    131707,
-    131717,
-    131726,
-    131736,
-    131745,
-    131755,
-    131764,
-    131774,
-    131783,
-    131793,
-    131802,
-    131812,
     131821,
-    131831,
-    131840,
-    131850,
-    131859,
-    131869,
-    131878,
-    131888,
-    131897,
-    131907,
-    131916,
-    131926,
-    131935,
-    131945,
-    131954,
-    131964,
     131973,
-    131983,
-    131992,
-    132002,
-    132011,
-    132021,
-    132030,
-    132040,
-    132049,
-    132059,
-    132068,
-    132078,
-    132087,
-    132097,
-    132106,
-    132116,
     132125,
-    132135,
-    132144,
-    132154,
-    132163,
-    132173,
-    132182,
-    132192,
-    132201,
-    132211,
-    132220,
-    132230,
-    132239,
-    132249,
-    132258,
-    132268,
     132277,
-    132287,
-    132296,
-    132306,
-    132315,
-    132325,
-    132334,
-    132344,
-    132353,
-    132363,
-    132372,
-    132382,
-    132391,
-    132401,
-    132410,
-    132420,
     132429,
-    132439,
-    132448,
-    132458,
-    132467,
-    132477,
-    132486,
-    132495,
-    132505,
-    132514,
-    132524,
-    132533,
-    132543,
-    132552,
-    132562,
-    132571,
     132581,
-    132590,
-    132600,
-    132609,
-    132619,
-    132628,
-    132638,
-    132647,
-    132657,
-    132666,
-    132676,
-    132685,
-    132695,
-    132704,
-    132714,
-    132723,
     132733,
-    132742,
-    132752,
-    132761,
-    132771,
-    132780,
-    132790,
-    132799,
-    132809,
-    132818,
-    132828,
-    132837,
-    132846,
-    132856,
-    132865,
-    132875,
     132884,
-    132894,
-    132903,
-    132913,
-    132922,
-    132932,
-    132941,
-    132951,
-    132960,
-    132970,
-    132979,
-    132989,
-    132998,
-    133008,
-    133017,
-    133027,
     133036,
-    133046,
-    133055,
-    133064,
-    133074,
-    133083,
-    133093,
-    133102,
-    133112,
-    133121,
-    133131,
-    133140,
-    133150,
-    133159,
-    133169,
-    133178,
     133188,
-    133197,
-    133207,
-    133216,
-    133226,
-    133235,
-    133245,
-    133254,
-    133263,
-    133273,
-    133282,
-    133292,
-    133301,
-    133311,
-    133320,
-    133330,
     133339,
-    133349,
-    133358,
-    133368,
-    133377,
-    133387,
-    133396,
-    133406,
-    133415,
-    133424,
-    133434,
-    133443,
-    133453,
-    133462,
-    133472,
-    133481,
     133491,
-    133500,
-    133510,
-    133519,
-    133529,
-    133538,
-    133548,
-    133557,
-    133566,
-    133576,
-    133585,
-    133595,
-    133604,
-    133614,
-    133623,
-    133633,
     133642,
-    133652,
-    133661,
-    133671,
-    133680,
-    133689,
-    133699,
-    133708,
-    133718,
-    133727,
-    133737,
-    133746,
-    133756,
-    133765,
-    133775,
-    133784,
     133794,
-    133803,
-    133812,
-    133822,
-    133831,
-    133841,
-    133850,
-    133860,
-    133869,
-    133879,
-    133888,
-    133898,
-    133907,
-    133916,
-    133926,
-    133935,
     133945,
-    133954,
-    133964,
-    133973,
-    133983,
-    133992,
-    134002,
-    134011,
-    134020,
-    134030,
-    134039,
-    134049,
-    134058,
-    134068,
-    134077,
-    134087,
     134096,
-    134106,
-    134115,
-    134124,
-    134134,
-    134143,
-    134153,
-    134162,
-    134172,
-    134181,
-    134191,
-    134200,
-    134210,
-    134219,
-    134228,
-    134238,
     134247,
-    134257,
-    134266,
-    134276,
-    134285,
-    134295,
-    134304,
-    134313,
-    134323,
-    134332,
-    134342,
-    134351,
-    134361,
-    134370,
-    134380,
-    134389,
     134398,
-    134408,
-    134417,
-    134427,
-    134436,
-    134446,
-    134455,
-    134465,
-    134474,
-    134483,
-    134493,
-    134502,
-    134512,
-    134521,
-    134531,
-    134540,
     134550,
-    134559,
-    134568,
-    134578,
-    134587,
-    134597,
-    134606,
-    134616,
-    134625,
-    134635,
-    134644,
-    134653,
-    134663,
-    134672,
-    134682,
-    134691,
     134701,
-    134710,
-    134719,
-    134729,
-    134738,
-    134748,
-    134757,
-    134767,
-    134776,
-    134786,
-    134795,
-    134804,
-    134814,
-    134823,
-    134833,
-    134842,
     134852,
-    134861,
-    134870,
-    134880,
-    134889,
-    134899,
-    134908,
-    134918,
-    134927,
-    134936,
-    134946,
-    134955,
-    134965,
-    134974,
-    134984,
-    134993,
     135003,
-    135012,
-    135021,
-    135031,
-    135040,
-    135050,
-    135059,
-    135069,
-    135078,
-    135087,
-    135097,
-    135106,
-    135116,
-    135125,
-    135135,
-    135144,
     135153,
-    135163,
-    135172,
-    135182,
-    135191,
-    135201,
-    135210,
-    135219,
-    135229,
-    135238,
-    135248,
-    135257,
-    135266,
-    135276,
-    135285,
-    135295,
     135304,
-    135314,
-    135323,
-    135332,
-    135342,
-    135351,
-    135361,
-    135370,
-    135380,
-    135389,
-    135398,
-    135408,
-    135417,
-    135427,
-    135436,
-    135446,
     135455,
-    135464,
-    135474,
-    135483,
-    135493,
-    135502,
-    135511,
-    135521,
-    135530,
-    135540,
-    135549,
-    135559,
-    135568,
-    135577,
-    135587,
-    135596,
     135606,
-    135615,
-    135624,
-    135634,
-    135643,
-    135653,
-    135662,
-    135672,
-    135681,
-    135690,
-    135700,
-    135709,
-    135719,
-    135728,
-    135737,
-    135747,
     135756,
-    135766,
-    135775,
-    135785,
-    135794,
-    135803,
-    135813,
-    135822,
-    135832,
-    135841,
-    135850,
-    135860,
-    135869,
-    135879,
-    135888,
-    135897,
     135907,
-    135916,
-    135926,
-    135935,
-    135945,
-    135954,
-    135963,
-    135973,
-    135982,
-    135992,
-    136001,
-    136010,
-    136020,
-    136029,
-    136039,
-    136048,
     136057,
-    136067,
-    136076,
-    136086,
-    136095,
-    136104,
-    136114,
-    136123,
-    136133,
-    136142,
-    136151,
-    136161,
-    136170,
-    136180,
-    136189,
-    136198,
     136208,
-    136217,
-    136227,
-    136236,
-    136246,
-    136255,
-    136264,
-    136274,
-    136283,
-    136293,
-    136302,
-    136311,
-    136321,
-    136330,
-    136340,
-    136349,
     136358,
-    136368,
-    136377,
-    136387,
-    136396,
-    136405,
-    136415,
-    136424,
-    136434,
-    136443,
-    136452,
-    136462,
-    136471,
-    136480,
-    136490,
-    136499,
     136509,
-    136518,
-    136527,
-    136537,
-    136546,
-    136556,
-    136565,
-    136574,
-    136584,
-    136593,
-    136603,
-    136612,
-    136621,
-    136631,
-    136640,
-    136650,
     136659,
-    136668,
-    136678,
-    136687,
-    136697,
-    136706,
-    136715,
-    136725,
-    136734,
-    136744,
-    136753,
-    136762,
-    136772,
-    136781,
-    136790,
-    136800,
     136809,
-    136819,
-    136828,
-    136837,
-    136847,
-    136856,
-    136866,
-    136875,
-    136884,
-    136894,
-    136903,
-    136913,
-    136922,
-    136931,
-    136941,
-    136950,
     136959,
-    136969,
-    136978,
-    136988,
-    136997,
-    137006,
-    137016,
-    137025,
-    137035,
-    137044,
-    137053,
-    137063,
-    137072,
-    137081,
-    137091,
-    137100,
     137110,
-    137119,
-    137128,
-    137138,
-    137147,
-    137157,
-    137166,
-    137175,
-    137185,
-    137194,
-    137203,
-    137213,
-    137222,
-    137232,
-    137241,
-    137250,
     137260,
-    137269,
-    137278,
-    137288,
-    137297,
-    137307,
-    137316,
-    137325,
-    137335,
-    137344,
-    137353,
-    137363,
-    137372,
-    137382,
-    137391,
-    137400,
     137410,
-    137419,
-    137428,
-    137438,
-    137447,
-    137457,
-    137466,
-    137475,
-    137485,
-    137494,
-    137503,
-    137513,
-    137522,
-    137532,
-    137541,
-    137550,
     137560,
-    137569,
-    137578,
-    137588,
-    137597,
-    137607,
-    137616,
-    137625,
-    137635,
-    137644,
-    137653,
-    137663,
-    137672,
-    137682,
-    137691,
-    137700,
     137710,
-    137719,
-    137728,
-    137738,
-    137747,
-    137756,
-    137766,
-    137775,
-    137785,
-    137794,
-    137803,
-    137813,
-    137822,
-    137831,
-    137841,
-    137850,
     137860,
-    137869,
-    137878,
-    137888,
-    137897,
-    137906,
-    137916,
-    137925,
-    137934,
-    137944,
-    137953,
-    137963,
-    137972,
-    137981,
-    137991,
-    138000,
     138009,
-    138019,
-    138028,
-    138037,
-    138047,
-    138056,
-    138066,
-    138075,
-    138084,
-    138094,
-    138103,
-    138112,
-    138122,
-    138131,
-    138140,
-    138150,
     138159,
-    138168,
-    138178,
-    138187,
-    138197,
-    138206,
-    138215,
-    138225,
-    138234,
-    138243,
-    138253,
-    138262,
-    138271,
-    138281,
-    138290,
-    138299,
     138309,
-    138318,
-    138328,
-    138337,
-    138346,
-    138356,
-    138365,
-    138374,
-    138384,
-    138393,
-    138402,
-    138412,
-    138421,
-    138430,
-    138440,
-    138449,
     138458,
-    138468,
-    138477,
-    138487,
-    138496,
-    138505,
-    138515,
-    138524,
-    138533,
-    138543,
-    138552,
-    138561,
-    138571,
-    138580,
-    138589,
-    138599,
     138608,
-    138617,
-    138627,
-    138636,
-    138645,
-    138655,
-    138664,
-    138674,
-    138683,
-    138692,
-    138702,
-    138711,
-    138720,
-    138730,
-    138739,
-    138748,
     138758,
-    138767,
-    138776,
-    138786,
-    138795,
-    138804,
-    138814,
-    138823,
-    138832,
-    138842,
-    138851,
-    138860,
-    138870,
-    138879,
-    138888,
-    138898,
     138907,
-    138916,
-    138926,
-    138935,
-    138944,
-    138954,
-    138963,
-    138973,
-    138982,
-    138991,
-    139001,
-    139010,
-    139019,
-    139029,
-    139038,
-    139047,
     139057,
-    139066,
-    139075,
-    139085,
-    139094,
-    139103,
-    139113,
-    139122,
-    139131,
-    139141,
-    139150,
-    139159,
-    139169,
-    139178,
-    139187,
-    139197,
     139206,
-    139215,
-    139225,
-    139234,
-    139243,
-    139253,
-    139262,
-    139271,
-    139281,
-    139290,
-    139299,
-    139309,
-    139318,
-    139327,
-    139337,
-    139346,
     139355,
-    139365,
-    139374,
-    139383,
-    139393,
-    139402,
-    139411,
-    139421,
-    139430,
-    139439,
-    139449,
-    139458,
-    139467,
-    139477,
-    139486,
-    139495,
     139505,
-    139514,
-    139523,
-    139533,
-    139542,
-    139551,
-    139561,
-    139570,
-    139579,
-    139589,
-    139598,
-    139607,
-    139617,
-    139626,
-    139635,
-    139644,
     139654,
-    139663,
-    139672,
-    139682,
-    139691,
-    139700,
-    139710,
-    139719,
-    139728,
-    139738,
-    139747,
-    139756,
-    139766,
-    139775,
-    139784,
-    139794,
     139803,
-    139812,
-    139822,
-    139831,
-    139840,
-    139850,
-    139859,
-    139868,
-    139878,
-    139887,
-    139896,
-    139906,
-    139915,
-    139924,
-    139933,
-    139943,
     139952,
-    139961,
-    139971,
-    139980,
-    139989,
-    139999,
-    140008,
-    140017,
-    140027,
-    140036,
-    140045,
-    140055,
-    140064,
-    140073,
-    140083,
-    140092,
     140101,
-    140110,
-    140120,
-    140129,
-    140138,
-    140148,
-    140157,
-    140166,
-    140176,
-    140185,
-    140194,
-    140204,
-    140213,
-    140222,
-    140232,
-    140241,
     140250,
-    140260,
-    140269,
-    140278,
-    140287,
-    140297,
-    140306,
-    140315,
-    140325,
-    140334,
-    140343,
-    140353,
-    140362,
-    140371,
-    140381,
-    140390,
     140399,
-    140408,
-    140418,
-    140427,
-    140436,
-    140446,
-    140455,
-    140464,
-    140474,
-    140483,
-    140492,
-    140502,
-    140511,
-    140520,
-    140529,
-    140539,
     140548,
-    140557,
-    140567,
-    140576,
-    140585,
-    140595,
-    140604,
-    140613,
-    140623,
-    140632,
-    140641,
-    140650,
-    140660,
-    140669,
-    140678,
-    140688,
     140697,
-    140706,
-    140716,
-    140725,
-    140734,
-    140743,
-    140753,
-    140762,
-    140771,
-    140781,
-    140790,
-    140799,
-    140809,
-    140818,
-    140827,
-    140836,
     140846,
-    140855,
-    140864,
-    140874,
-    140883,
-    140892,
-    140902,
-    140911,
-    140920,
-    140929,
-    140939,
-    140948,
-    140957,
-    140967,
-    140976,
-    140985,
     140994,
-    141004,
-    141013,
-    141022,
-    141032,
-    141041,
-    141050,
-    141060,
-    141069,
-    141078,
-    141087,
-    141097,
-    141106,
-    141115,
-    141125,
-    141134,
     141143,
-    141152,
-    141162,
-    141171,
-    141180,
-    141190,
-    141199,
-    141208,
-    141218,
-    141227,
-    141236,
-    141245,
-    141255,
-    141264,
-    141273,
-    141283,
     141292,
-    141301,
-    141310,
-    141320,
-    141329,
-    141338,
-    141348,
-    141357,
-    141366,
-    141375,
-    141385,
-    141394,
-    141403,
-    141413,
-    141422,
-    141431,
     141440,
-    141450,
-    141459,
-    141468,
-    141478,
-    141487,
-    141496,
-    141505,
-    141515,
-    141524,
-    141533,
-    141543,
-    141552,
-    141561,
-    141570,
-    141580,
     141589,
-    141598,
-    141608,
-    141617,
-    141626,
-    141635,
-    141645,
-    141654,
-    141663,
-    141673,
-    141682,
-    141691,
-    141700,
-    141710,
-    141719,
-    141728,
     141737,
-    141747,
-    141756,
-    141765,
-    141775,
-    141784,
-    141793,
-    141802,
-    141812,
-    141821,
-    141830,
-    141840,
-    141849,
-    141858,
-    141867,
-    141877,
     141886,
-    141895,
-    141904,
-    141914,
-    141923,
-    141932,
-    141942,
-    141951,
-    141960,
-    141969,
-    141979,
-    141988,
-    141997,
-    142006,
-    142016,
-    142025,
     142034,
-    142044,
-    142053,
-    142062,
-    142071,
-    142081,
-    142090,
-    142099,
-    142108,
-    142118,
-    142127,
-    142136,
-    142146,
-    142155,
-    142164,
-    142173,
     142183,
-    142192,
-    142201,
-    142210,
-    142220,
-    142229,
-    142238,
-    142248,
-    142257,
-    142266,
-    142275,
-    142285,
-    142294,
-    142303,
-    142312,
-    142322,
     142331,
-    142340,
-    142349,
-    142359,
-    142368,
-    142377,
-    142387,
-    142396,
-    142405,
-    142414,
-    142424,
-    142433,
-    142442,
-    142451,
-    142461,
-    142470,
     142479,
-    142488,
-    142498,
-    142507,
-    142516,
-    142525,
-    142535,
-    142544,
-    142553,
-    142563,
-    142572,
-    142581,
-    142590,
-    142600,
-    142609,
-    142618,
     142627,
-    142637,
-    142646,
-    142655,
-    142664,
-    142674,
-    142683,
-    142692,
-    142701,
-    142711,
-    142720,
-    142729,
-    142738,
-    142748,
-    142757,
-    142766,
     142775,
-    142785,
-    142794,
-    142803,
-    142813,
-    142822,
-    142831,
-    142840,
-    142850,
-    142859,
-    142868,
-    142877,
-    142887,
-    142896,
-    142905,
-    142914,
     142924,
-    142933,
-    142942,
-    142951,
-    142961,
-    142970,
-    142979,
-    142988,
-    142998,
-    143007,
-    143016,
-    143025,
-    143035,
-    143044,
-    143053,
-    143062,
     143072,
-    143081,
-    143090,
-    143099,
-    143109,
-    143118,
-    143127,
-    143136,
-    143146,
-    143155,
-    143164,
-    143173,
-    143183,
-    143192,
-    143201,
-    143210,
     143220,
-    143229,
-    143238,
-    143247,
-    143257,
-    143266,
-    143275,
-    143284,
-    143294,
-    143303,
-    143312,
-    143321,
-    143331,
-    143340,
-    143349,
-    143358,
     143368,
-    143377,
-    143386,
-    143395,
-    143404,
-    143414,
-    143423,
-    143432,
-    143441,
-    143451,
-    143460,
-    143469,
-    143478,
-    143488,
-    143497,
-    143506,
     143515,
-    143525,
-    143534,
-    143543,
-    143552,
-    143562,
-    143571,
-    143580,
-    143589,
-    143599,
-    143608,
-    143617,
-    143626,
-    143636,
-    143645,
-    143654,
     143663,
-    143672,
-    143682,
-    143691,
-    143700,
-    143709,
-    143719,
-    143728,
-    143737,
-    143746,
-    143756,
-    143765,
-    143774,
-    143783,
-    143793,
-    143802,
     143811,
-    143820,
-    143829,
-    143839,
-    143848,
-    143857,
-    143866,
-    143876,
-    143885,
-    143894,
-    143903,
-    143913,
-    143922,
-    143931,
-    143940,
-    143949,
     143959,
-    143968,
-    143977,
-    143986,
-    143996,
-    144005,
-    144014,
-    144023,
-    144033,
-    144042,
-    144051,
-    144060,
-    144069,
-    144079,
-    144088,
-    144097,
     144106,
-    144116,
-    144125,
-    144134,
-    144143,
-    144153,
-    144162,
-    144171,
-    144180,
-    144189,
-    144199,
-    144208,
-    144217,
-    144226,
-    144236,
-    144245,
     144254,
-    144263,
-    144272,
-    144282,
-    144291,
-    144300,
-    144309,
-    144319,
-    144328,
-    144337,
-    144346,
-    144355,
-    144365,
-    144374,
-    144383,
-    144392,
     144402,
-    144411,
-    144420,
-    144429,
-    144438,
-    144448,
-    144457,
-    144466,
-    144475,
-    144485,
-    144494,
-    144503,
-    144512,
-    144521,
-    144531,
-    144540,
     144549,
-    144558,
-    144568,
-    144577,
-    144586,
-    144595,
-    144604,
-    144614,
-    144623,
-    144632,
-    144641,
-    144651,
-    144660,
-    144669,
-    144678,
-    144687,
     144697,
-    144706,
-    144715,
-    144724,
-    144733,
-    144743,
-    144752,
-    144761,
-    144770,
-    144780,
-    144789,
-    144798,
-    144807,
-    144816,
-    144826,
-    144835,
     144844,
-    144853,
-    144862,
-    144872,
-    144881,
-    144890,
-    144899,
-    144909,
-    144918,
-    144927,
-    144936,
-    144945,
-    144955,
-    144964,
-    144973,
-    144982,
     144991,
-    145001,
-    145010,
-    145019,
-    145028,
-    145037,
-    145047,
-    145056,
-    145065,
-    145074,
-    145083,
-    145093,
-    145102,
-    145111,
-    145120,
-    145130,
     145139,
-    145148,
-    145157,
-    145166,
-    145176,
-    145185,
-    145194,
-    145203,
-    145212,
-    145222,
-    145231,
-    145240,
-    145249,
-    145258,
-    145268,
-    145277,
     145286,
-    145295,
-    145304,
-    145314,
-    145323,
-    145332,
-    145341,
-    145350,
-    145360,
-    145369,
-    145378,
-    145387,
-    145396,
-    145406,
-    145415,
-    145424,
     145433,
-    145442,
-    145452,
-    145461,
-    145470,
-    145479,
-    145488,
-    145498,
-    145507,
-    145516,
-    145525,
-    145534,
-    145544,
-    145553,
-    145562,
-    145571,
     145580,
-    145590,
-    145599,
-    145608,
-    145617,
-    145626,
-    145636,
-    145645,
-    145654,
-    145663,
-    145672,
-    145682,
-    145691,
-    145700,
-    145709,
-    145718,
     145728,
-    145737,
-    145746,
-    145755,
-    145764,
-    145773,
-    145783,
-    145792,
-    145801,
-    145810,
-    145819,
-    145829,
-    145838,
-    145847,
-    145856,
-    145865,
     145875,
-    145884,
-    145893,
-    145902,
-    145911,
-    145921,
-    145930,
-    145939,
-    145948,
-    145957,
-    145966,
-    145976,
-    145985,
-    145994,
-    146003,
-    146012,
     146022,
-    146031,
-    146040,
-    146049,
-    146058,
-    146068,
-    146077,
-    146086,
-    146095,
-    146104,
-    146113,
-    146123,
-    146132,
-    146141,
-    146150,
-    146159,
     146169,
-    146178,
-    146187,
-    146196,
-    146205,
-    146215,
-    146224,
-    146233,
-    146242,
-    146251,
-    146260,
-    146270,
-    146279,
-    146288,
-    146297,
-    146306,
     146316,
-    146325,
-    146334,
-    146343,
-    146352,
-    146361,
-    146371,
-    146380,
-    146389,
-    146398,
-    146407,
-    146417,
-    146426,
-    146435,
-    146444,
-    146453,
     146462,
-    146472,
-    146481,
-    146490,
-    146499,
-    146508,
-    146517,
-    146527,
-    146536,
-    146545,
-    146554,
-    146563,
-    146573,
-    146582,
-    146591,
-    146600,
     146609,
-    146618,
-    146628,
-    146637,
-    146646,
-    146655,
-    146664,
-    146673,
-    146683,
-    146692,
-    146701,
-    146710,
-    146719,
-    146728,
-    146738,
-    146747,
     146756,
-    146765,
-    146774,
-    146784,
-    146793,
-    146802,
-    146811,
-    146820,
-    146829,
-    146839,
-    146848,
-    146857,
-    146866,
-    146875,
-    146884,
-    146894,
     146903,
-    146912,
-    146921,
-    146930,
-    146939,
-    146949,
-    146958,
-    146967,
-    146976,
-    146985,
-    146994,
-    147004,
-    147013,
-    147022,
-    147031,
-    147040,
     147049,
-    147059,
-    147068,
-    147077,
-    147086,
-    147095,
-    147104,
-    147114,
-    147123,
-    147132,
-    147141,
-    147150,
-    147159,
-    147169,
-    147178,
-    147187,
     147196,
-    147205,
-    147214,
-    147224,
-    147233,
-    147242,
-    147251,
-    147260,
-    147269,
-    147279,
-    147288,
-    147297,
-    147306,
-    147315,
-    147324,
-    147333,
     147343,
-    147352,
-    147361,
-    147370,
-    147379,
-    147388,
-    147398,
-    147407,
-    147416,
-    147425,
-    147434,
-    147443,
-    147453,
-    147462,
-    147471,
-    147480,
     147489,
-    147498,
-    147507,
-    147517,
-    147526,
-    147535,
-    147544,
-    147553,
-    147562,
-    147572,
-    147581,
-    147590,
-    147599,
-    147608,
-    147617,
-    147627,
     147636,
-    147645,
-    147654,
-    147663,
-    147672,
-    147681,
-    147691,
-    147700,
-    147709,
-    147718,
-    147727,
-    147736,
-    147746,
-    147755,
-    147764,
-    147773,
     147782,
-    147791,
-    147800,
-    147810,
-    147819,
-    147828,
-    147837,
-    147846,
-    147855,
-    147864,
-    147874,
-    147883,
-    147892,
-    147901,
-    147910,
-    147919,
     147929,
-    147938,
-    147947,
-    147956,
-    147965,
-    147974,
-    147983,
-    147993,
-    148002,
-    148011,
-    148020,
-    148029,
-    148038,
-    148047,
-    148057,
-    148066,
     148075,
-    148084,
-    148093,
-    148102,
-    148111,
-    148121,
-    148130,
-    148139,
-    148148,
-    148157,
-    148166,
-    148175,
-    148185,
-    148194,
-    148203,
-    148212,
     148221,
-    148230,
-    148239,
-    148249,
-    148258,
-    148267,
-    148276,
-    148285,
-    148294,
-    148303,
-    148313,
-    148322,
-    148331,
-    148340,
-    148349,
-    148358,
     148367,
-    148377,
-    148386,
-    148395,
-    148404,
-    148413,
-    148422,
-    148431,
-    148440,
-    148450,
-    148459,
-    148468,
-    148477,
-    148486,
-    148495,
-    148504,
     148514,
-    148523,
-    148532,
-    148541,
-    148550,
-    148559,
-    148568,
-    148578,
-    148587,
-    148596,
-    148605,
-    148614,
-    148623,
-    148632,
-    148641,
-    148651,
     148660,
-    148669,
-    148678,
-    148687,
-    148696,
-    148705,
-    148715,
-    148724,
-    148733,
-    148742,
-    148751,
-    148760,
-    148769,
-    148778,
-    148788,
-    148797,
     148806,
-    148815,
-    148824,
-    148833,
-    148842,
-    148851,
-    148861,
-    148870,
-    148879,
-    148888,
-    148897,
-    148906,
-    148915,
-    148925,
-    148934,
-    148943,
     148952,
-    148961,
-    148970,
-    148979,
-    148988,
-    148998,
-    149007,
-    149016,
-    149025,
-    149034,
-    149043,
-    149052,
-    149061,
-    149071,
-    149080,
-    149089,
     149098,
-    149107,
-    149116,
-    149125,
-    149134,
-    149144,
-    149153,
-    149162,
-    149171,
-    149180,
-    149189,
-    149198,
-    149207,
-    149216,
-    149226,
-    149235,
     149244,
-    149253,
-    149262,
-    149271,
-    149280,
-    149289,
-    149299,
-    149308,
-    149317,
-    149326,
-    149335,
-    149344,
-    149353,
-    149362,
-    149372,
-    149381,
     149390,
-    149399,
-    149408,
-    149417,
-    149426,
-    149435,
-    149444,
-    149454,
-    149463,
-    149472,
-    149481,
-    149490,
-    149499,
-    149508,
-    149517,
-    149527,
     149536,
-    149545,
-    149554,
-    149563,
-    149572,
-    149581,
-    149590,
-    149599,
-    149609,
-    149618,
-    149627,
-    149636,
-    149645,
-    149654,
-    149663,
-    149672,
     149681,
-    149691,
-    149700,
-    149709,
-    149718,
-    149727,
-    149736,
-    149745,
-    149754,
-    149763,
-    149773,
-    149782,
-    149791,
-    149800,
-    149809,
-    149818,
     149827,
-    149836,
-    149845,
-    149855,
-    149864,
-    149873,
-    149882,
-    149891,
-    149900,
-    149909,
-    149918,
-    149927,
-    149937,
-    149946,
-    149955,
-    149964,
     149973,
-    149982,
-    149991,
-    150000,
-    150009,
-    150018,
-    150028,
-    150037,
-    150046,
-    150055,
-    150064,
-    150073,
-    150082,
-    150091,
-    150100,
-    150110,
     150119,
-    150128,
-    150137,
-    150146,
-    150155,
-    150164,
-    150173,
-    150182,
-    150191,
-    150201,
-    150210,
-    150219,
-    150228,
-    150237,
-    150246,
-    150255,
     150264,
-    150273,
-    150282,
-    150292,
-    150301,
-    150310,
-    150319,
-    150328,
-    150337,
-    150346,
-    150355,
-    150364,
-    150373,
-    150383,
-    150392,
-    150401,
     150410,
-    150419,
-    150428,
-    150437,
-    150446,
-    150455,
-    150464,
-    150474,
-    150483,
-    150492,
-    150501,
-    150510,
-    150519,
-    150528,
-    150537,
-    150546,
     150555,
-    150564,
-    150574,
-    150583,
-    150592,
-    150601,
-    150610,
-    150619,
-    150628,
-    150637,
-    150646,
-    150655,
-    150664,
-    150674,
-    150683,
-    150692,
     150701,
-    150710,
-    150719,
-    150728,
-    150737,
-    150746,
-    150755,
-    150764,
-    150774,
-    150783,
-    150792,
-    150801,
-    150810,
-    150819,
-    150828,
-    150837,
     150846,
-    150855,
-    150864,
-    150874,
-    150883,
-    150892,
-    150901,
-    150910,
-    150919,
-    150928,
-    150937,
-    150946,
-    150955,
-    150964,
-    150974,
-    150983,
     150992,
-    151001,
-    151010,
-    151019,
-    151028,
-    151037,
-    151046,
-    151055,
-    151064,
-    151073,
-    151083,
-    151092,
-    151101,
-    151110,
-    151119,
-    151128,
     151137,
-    151146,
-    151155,
-    151164,
-    151173,
-    151182,
-    151192,
-    151201,
-    151210,
-    151219,
-    151228,
-    151237,
-    151246,
-    151255,
-    151264,
-    151273,
     151282,
-    151291,
-    151300,
-    151310,
-    151319,
-    151328,
-    151337,
-    151346,
-    151355,
-    151364,
-    151373,
-    151382,
-    151391,
-    151400,
-    151409,
-    151419,
     151428,
-    151437,
-    151446,
-    151455,
-    151464,
-    151473,
-    151482,
-    151491,
-    151500,
-    151509,
-    151518,
-    151527,
-    151537,
-    151546,
-    151555,
-    151564,
     151573,
-    151582,
-    151591,
-    151600,
-    151609,
-    151618,
-    151627,
-    151636,
-    151645,
-    151654,
-    151664,
-    151673,
-    151682,
-    151691,
-    151700,
-    151709,
     151718,
-    151727,
-    151736,
-    151745,
-    151754,
-    151763,
-    151772,
-    151781,
-    151791,
-    151800,
-    151809,
-    151818,
-    151827,
-    151836,
-    151845,
-    151854,
     151863,
-    151872,
-    151881,
-    151890,
-    151899,
-    151908,
-    151917,
-    151927,
-    151936,
-    151945,
-    151954,
-    151963,
-    151972,
-    151981,
-    151990,
-    151999,
     152008,
-    152017,
-    152026,
-    152035,
-    152044,
-    152053,
-    152063,
-    152072,
-    152081,
-    152090,
-    152099,
-    152108,
-    152117,
-    152126,
-    152135,
-    152144,
     152153,
-    152162,
-    152171,
-    152180,
-    152189,
-    152198,
-    152208,
-    152217,
-    152226,
-    152235,
-    152244,
-    152253,
-    152262,
-    152271,
-    152280,
-    152289,
     152298,
-    152307,
-    152316,
-    152325,
-    152334,
-    152343,
-    152353,
-    152362,
-    152371,
-    152380,
-    152389,
-    152398,
-    152407,
-    152416,
-    152425,
-    152434,
     152443,
-    152452,
-    152461,
-    152470,
-    152479,
-    152488,
-    152497,
-    152506,
-    152516,
-    152525,
-    152534,
-    152543,
-    152552,
-    152561,
-    152570,
-    152579,
     152588,
-    152597,
-    152606,
-    152615,
-    152624,
-    152633,
-    152642,
-    152651,
-    152660,
-    152669,
-    152678,
-    152688,
-    152697,
-    152706,
-    152715,
-    152724,
     152733,
-    152742,
-    152751,
-    152760,
-    152769,
-    152778,
-    152787,
-    152796,
-    152805,
-    152814,
-    152823,
-    152832,
-    152841,
-    152850,
-    152859,
-    152869,
     152878,
-    152887,
-    152896,
-    152905,
-    152914,
-    152923,
-    152932,
-    152941,
-    152950,
-    152959,
-    152968,
-    152977,
-    152986,
-    152995,
-    153004,
-    153013,
     153022,
-    153031,
-    153040,
-    153049,
-    153059,
-    153068,
-    153077,
-    153086,
-    153095,
-    153104,
-    153113,
-    153122,
-    153131,
-    153140,
-    153149,
-    153158,
     153167,
-    153176,
-    153185,
-    153194,
-    153203,
-    153212,
-    153221,
-    153230,
-    153239,
-    153248,
-    153257,
-    153267,
-    153276,
-    153285,
-    153294,
-    153303,
     153312,
-    153321,
-    153330,
-    153339,
-    153348,
-    153357,
-    153366,
-    153375,
-    153384,
-    153393,
-    153402,
-    153411,
-    153420,
-    153429,
-    153438,
-    153447,
     153456,
-    153465,
-    153474,
-    153483,
-    153492,
-    153501,
-    153511,
-    153520,
-    153529,
-    153538,
-    153547,
-    153556,
-    153565,
-    153574,
-    153583,
-    153592,
     153601,
-    153610,
-    153619,
-    153628,
-    153637,
-    153646,
-    153655,
-    153664,
-    153673,
-    153682,
-    153691,
-    153700,
-    153709,
-    153718,
-    153727,
-    153736,
     153745,
-    153754,
-    153763,
-    153772,
-    153782,
-    153791,
-    153800,
-    153809,
-    153818,
-    153827,
-    153836,
-    153845,
-    153854,
-    153863,
-    153872,
-    153881,
     153890,
-    153899,
-    153908,
-    153917,
-    153926,
-    153935,
-    153944,
-    153953,
-    153962,
-    153971,
-    153980,
-    153989,
-    153998,
-    154007,
-    154016,
-    154025,
     154034,
-    154043,
-    154052,
-    154061,
-    154070,
-    154079,
-    154088,
-    154097,
-    154107,
-    154116,
-    154125,
-    154134,
-    154143,
-    154152,
-    154161,
-    154170,
     154179,
-    154188,
-    154197,
-    154206,
-    154215,
-    154224,
-    154233,
-    154242,
-    154251,
-    154260,
-    154269,
-    154278,
-    154287,
-    154296,
-    154305,
-    154314,
     154323,
-    154332,
-    154341,
-    154350,
-    154359,
-    154368,
-    154377,
-    154386,
-    154395,
-    154404,
-    154413,
-    154422,
-    154431,
-    154440,
-    154449,
-    154458,
     154467,
-    154476,
-    154485,
-    154494,
-    154503,
-    154512,
-    154521,
-    154530,
-    154539,
-    154548,
-    154557,
-    154566,
-    154576,
-    154585,
-    154594,
-    154603,
     154612,
-    154621,
-    154630,
-    154639,
-    154648,
-    154657,
-    154666,
-    154675,
-    154684,
-    154693,
-    154702,
-    154711,
-    154720,
-    154729,
-    154738,
-    154747,
     154756,
-    154765,
-    154774,
-    154783,
-    154792,
-    154801,
-    154810,
-    154819,
-    154828,
-    154837,
-    154846,
-    154855,
-    154864,
-    154873,
-    154882,
-    154891,
     154900,
-    154909,
-    154918,
-    154927,
-    154936,
-    154945,
-    154954,
-    154963,
-    154972,
-    154981,
-    154990,
-    154999,
-    155008,
-    155017,
-    155026,
-    155035,
     155044,
-    155053,
-    155062,
-    155071,
-    155080,
-    155089,
-    155098,
-    155107,
-    155116,
-    155125,
-    155134,
-    155143,
-    155152,
-    155161,
-    155170,
-    155179,
     155188,
-    155197,
-    155206,
-    155215,
-    155224,
-    155233,
-    155242,
-    155251,
-    155260,
-    155269,
-    155278,
-    155287,
-    155296,
-    155305,
-    155314,
-    155323,
     155332,
-    155341,
-    155350,
-    155359,
-    155368,
-    155377,
-    155386,
-    155395,
-    155404,
-    155413,
-    155422,
-    155431,
-    155440,
-    155449,
-    155458,
-    155467,
     155476,
-    155485,
-    155494,
-    155503,
-    155512,
-    155521,
-    155530,
-    155539,
-    155548,
-    155557,
-    155566,
-    155575,
-    155584,
-    155593,
-    155602,
-    155611,
     155620,
-    155629,
-    155638,
-    155647,
-    155656,
-    155665,
-    155674,
-    155683,
-    155692,
-    155701,
-    155710,
-    155719,
-    155728,
-    155737,
-    155746,
-    155755,
     155764,
-    155773,
-    155782,
-    155791,
-    155800,
-    155809,
-    155818,
-    155827,
-    155836,
-    155845,
-    155854,
-    155863,
-    155872,
-    155881,
-    155890,
-    155899,
     155908,
-    155917,
-    155926,
-    155935,
-    155944,
-    155953,
-    155962,
-    155971,
-    155980,
-    155989,
-    155998,
-    156007,
-    156016,
-    156025,
-    156034,
-    156043,
     156052,
-    156061,
-    156070,
-    156079,
-    156088,
-    156097,
-    156106,
-    156115,
-    156123,
-    156132,
-    156141,
-    156150,
-    156159,
-    156168,
-    156177,
-    156186,
     156195,
-    156204,
-    156213,
-    156222,
-    156231,
-    156240,
-    156249,
-    156258,
-    156267,
-    156276,
-    156285,
-    156294,
-    156303,
-    156312,
-    156321,
-    156330,
     156339,
-    156348,
-    156357,
-    156366,
-    156375,
-    156384,
-    156393,
-    156402,
-    156411,
-    156420,
-    156429,
-    156438,
-    156447,
-    156456,
-    156465,
-    156474,
     156483,
-    156492,
-    156501,
-    156510,
-    156519,
-    156528,
-    156537,
-    156546,
-    156555,
-    156564,
-    156573,
-    156582,
-    156590,
-    156599,
-    156608,
-    156617,
     156626,
-    156635,
-    156644,
-    156653,
-    156662,
-    156671,
-    156680,
-    156689,
-    156698,
-    156707,
-    156716,
-    156725,
-    156734,
-    156743,
-    156752,
-    156761,
     156770,
-    156779,
-    156788,
-    156797,
-    156806,
-    156815,
-    156824,
-    156833,
-    156842,
-    156851,
-    156860,
-    156869,
-    156878,
-    156887,
-    156896,
-    156905,
     156914,
-    156922,
-    156931,
-    156940,
-    156949,
-    156958,
-    156967,
-    156976,
-    156985,
-    156994,
-    157003,
-    157012,
-    157021,
-    157030,
-    157039,
-    157048,
     157057,
-    157066,
-    157075,
-    157084,
-    157093,
-    157102,
-    157111,
-    157120,
-    157129,
-    157138,
-    157147,
-    157156,
-    157165,
-    157174,
-    157183,
-    157191,
     157200,
-    157209,
-    157218,
-    157227,
-    157236,
-    157245,
-    157254,
-    157263,
-    157272,
-    157281,
-    157290,
-    157299,
-    157308,
-    157317,
-    157326,
-    157335,
     157344,
-    157353,
-    157362,
-    157371,
-    157380,
-    157389,
-    157398,
-    157407,
-    157416,
-    157425,
-    157433,
-    157442,
-    157451,
-    157460,
-    157469,
-    157478,
     157487,
-    157496,
-    157505,
-    157514,
-    157523,
-    157532,
-    157541,
-    157550,
-    157559,
-    157568,
-    157577,
-    157586,
-    157595,
-    157604,
-    157613,
-    157622,
     157631,
-    157640,
-    157648,
-    157657,
-    157666,
-    157675,
-    157684,
-    157693,
-    157702,
-    157711,
-    157720,
-    157729,
-    157738,
-    157747,
-    157756,
-    157765,
     157774,
-    157783,
-    157792,
-    157801,
-    157810,
-    157819,
-    157828,
-    157837,
-    157845,
-    157854,
-    157863,
-    157872,
-    157881,
-    157890,
-    157899,
-    157908,
     157917,
-    157926,
-    157935,
-    157944,
-    157953,
-    157962,
-    157971,
-    157980,
-    157989,
-    157998,
-    158007,
-    158016,
-    158024,
-    158033,
-    158042,
-    158051,
     158060,
-    158069,
-    158078,
-    158087,
-    158096,
-    158105,
-    158114,
-    158123,
-    158132,
-    158141,
-    158150,
-    158159,
-    158168,
-    158177,
-    158186,
-    158194,
     158203,
-    158212,
-    158221,
-    158230,
-    158239,
-    158248,
-    158257,
-    158266,
-    158275,
-    158284,
-    158293,
-    158302,
-    158311,
-    158320,
-    158329,
-    158338,
     158347,
-    158355,
-    158364,
-    158373,
-    158382,
-    158391,
-    158400,
-    158409,
-    158418,
-    158427,
-    158436,
-    158445,
-    158454,
-    158463,
-    158472,
-    158481,
     158490,
-    158499,
-    158507,
-    158516,
-    158525,
-    158534,
-    158543,
-    158552,
-    158561,
-    158570,
-    158579,
-    158588,
-    158597,
-    158606,
-    158615,
-    158624,
     158633,
-    158642,
-    158650,
-    158659,
-    158668,
-    158677,
-    158686,
-    158695,
-    158704,
-    158713,
-    158722,
-    158731,
-    158740,
-    158749,
-    158758,
-    158767,
     158776,
-    158785,
-    158793,
-    158802,
-    158811,
-    158820,
-    158829,
-    158838,
-    158847,
-    158856,
-    158865,
-    158874,
-    158883,
-    158892,
-    158901,
-    158910,
     158919,
-    158927,
-    158936,
-    158945,
-    158954,
-    158963,
-    158972,
-    158981,
-    158990,
-    158999,
-    159008,
-    159017,
-    159026,
-    159035,
-    159044,
-    159052,
     159061,
-    159070,
-    159079,
-    159088,
-    159097,
-    159106,
-    159115,
-    159124,
-    159133,
-    159142,
-    159151,
-    159160,
-    159169,
-    159177,
-    159186,
-    159195,
     159204,
-    159213,
-    159222,
-    159231,
-    159240,
-    159249,
-    159258,
-    159267,
-    159276,
-    159285,
-    159294,
-    159302,
-    159311,
-    159320,
-    159329,
-    159338,
     159347,
-    159356,
-    159365,
-    159374,
-    159383,
-    159392,
-    159401,
-    159410,
-    159418,
-    159427,
-    159436,
-    159445,
-    159454,
-    159463,
-    159472,
-    159481,
     159490,
-    159499,
-    159508,
-    159517,
-    159526,
-    159534,
-    159543,
-    159552,
-    159561,
-    159570,
-    159579,
-    159588,
-    159597,
-    159606,
-    159615,
-    159624,
     159633,
-    159641,
-    159650,
-    159659,
-    159668,
-    159677,
-    159686,
-    159695,
-    159704,
-    159713,
-    159722,
-    159731,
-    159740,
-    159748,
-    159757,
-    159766,
     159775,
-    159784,
-    159793,
-    159802,
-    159811,
-    159820,
-    159829,
-    159838,
-    159847,
-    159855,
-    159864,
-    159873,
-    159882,
-    159891,
-    159900,
-    159909,
     159918,
-    159927,
-    159936,
-    159945,
-    159954,
-    159962,
-    159971,
-    159980,
-    159989,
-    159998,
-    160007,
-    160016,
-    160025,
-    160034,
-    160043,
-    160052,
     160060,
-    160069,
-    160078,
-    160087,
-    160096,
-    160105,
-    160114,
-    160123,
-    160132,
-    160141,
-    160150,
-    160158,
-    160167,
-    160176,
-    160185,
-    160194,
     160203,
-    160212,
-    160221,
-    160230,
-    160239,
-    160248,
-    160256,
-    160265,
-    160274,
-    160283,
-    160292,
-    160301,
-    160310,
-    160319,
-    160328,
-    160337,
     160346,
-    160354,
-    160363,
-    160372,
-    160381,
-    160390,
-    160399,
-    160408,
-    160417,
-    160426,
-    160435,
-    160443,
-    160452,
-    160461,
-    160470,
-    160479,
     160488,
-    160497,
-    160506,
-    160515,
-    160524,
-    160532,
-    160541,
-    160550,
-    160559,
-    160568,
-    160577,
-    160586,
-    160595,
-    160604,
-    160613,
-    160621,
     160630,
-    160639,
-    160648,
-    160657,
-    160666,
-    160675,
-    160684,
-    160693,
-    160702,
-    160710,
-    160719,
-    160728,
-    160737,
-    160746,
-    160755,
-    160764,
     160773,
-    160782,
-    160791,
-    160799,
-    160808,
-    160817,
-    160826,
-    160835,
-    160844,
-    160853,
-    160862,
-    160871,
-    160880,
-    160888,
-    160897,
-    160906,
     160915,
-    160924,
-    160933,
-    160942,
-    160951,
-    160960,
-    160968,
-    160977,
-    160986,
-    160995,
-    161004,
-    161013,
-    161022,
-    161031,
-    161040,
-    161049,
     161057,
-    161066,
-    161075,
-    161084,
-    161093,
-    161102,
-    161111,
-    161120,
-    161129,
-    161137,
-    161146,
-    161155,
-    161164,
-    161173,
-    161182,
-    161191,
     161200,
-    161209,
-    161217,
-    161226,
-    161235,
-    161244,
-    161253,
-    161262,
-    161271,
-    161280,
-    161289,
-    161297,
-    161306,
-    161315,
-    161324,
-    161333,
     161342,
-    161351,
-    161360,
-    161369,
-    161377,
-    161386,
-    161395,
-    161404,
-    161413,
-    161422,
-    161431,
-    161440,
-    161449,
-    161457,
-    161466,
-    161475,
     161484,
-    161493,
-    161502,
-    161511,
-    161520,
-    161528,
-    161537,
-    161546,
-    161555,
-    161564,
-    161573,
-    161582,
-    161591,
-    161600,
-    161608,
-    161617,
     161626,
-    161635,
-    161644,
-    161653,
-    161662,
-    161671,
-    161679,
-    161688,
-    161697,
-    161706,
-    161715,
-    161724,
-    161733,
-    161742,
-    161751,
-    161759,
     161768,
-    161777,
-    161786,
-    161795,
-    161804,
-    161813,
-    161822,
-    161830,
-    161839,
-    161848,
-    161857,
-    161866,
-    161875,
-    161884,
-    161893,
-    161901,
     161910,
-    161919,
-    161928,
-    161937,
-    161946,
-    161955,
-    161964,
-    161972,
-    161981,
-    161990,
-    161999,
-    162008,
-    162017,
-    162026,
-    162035,
-    162043,
     162052,
-    162061,
-    162070,
-    162079,
-    162088,
-    162097,
-    162106,
-    162114,
-    162123,
-    162132,
-    162141,
-    162150,
-    162159,
-    162168,
-    162177,
-    162185,
     162194,
-    162203,
-    162212,
-    162221,
-    162230,
-    162239,
-    162248,
-    162256,
-    162265,
-    162274,
-    162283,
-    162292,
-    162301,
-    162310,
-    162318,
-    162327,
     162336,
-    162345,
-    162354,
-    162363,
-    162372,
-    162381,
-    162389,
-    162398,
-    162407,
-    162416,
-    162425,
-    162434,
-    162443,
-    162451,
-    162460,
-    162469,
     162478,
-    162487,
-    162496,
-    162505,
-    162514,
-    162522,
-    162531,
-    162540,
-    162549,
-    162558,
-    162567,
-    162576,
-    162584,
-    162593,
-    162602,
-    162611,
     162620,
-    162629,
-    162638,
-    162647,
-    162655,
-    162664,
-    162673,
-    162682,
-    162691,
-    162700,
-    162709,
-    162717,
-    162726,
-    162735,
-    162744,
-    162753,
     162762,
-    162771,
-    162779,
-    162788,
-    162797,
-    162806,
-    162815,
-    162824,
-    162833,
-    162841,
-    162850,
-    162859,
-    162868,
-    162877,
-    162886,
-    162895,
     162903,
-    162912,
-    162921,
-    162930,
-    162939,
-    162948,
-    162957,
-    162966,
-    162974,
-    162983,
-    162992,
-    163001,
-    163010,
-    163019,
-    163028,
-    163036,
     163045,
-    163054,
-    163063,
-    163072,
-    163081,
-    163089,
-    163098,
-    163107,
-    163116,
-    163125,
-    163134,
-    163143,
-    163151,
-    163160,
-    163169,
-    163178,
     163187,
-    163196,
-    163205,
-    163213,
-    163222,
-    163231,
-    163240,
-    163249,
-    163258,
-    163267,
-    163275,
-    163284,
-    163293,
-    163302,
-    163311,
-    163320,
     163329,
-    163337,
-    163346,
-    163355,
-    163364,
-    163373,
-    163382,
-    163390,
-    163399,
-    163408,
-    163417,
-    163426,
-    163435,
-    163444,
-    163452,
-    163461,
     163470,
-    163479,
-    163488,
-    163497,
-    163506,
-    163514,
-    163523,
-    163532,
-    163541,
-    163550,
-    163559,
-    163567,
-    163576,
-    163585,
-    163594,
-    163603,
     163612,
-    163621,
-    163629,
-    163638,
-    163647,
-    163656,
-    163665,
-    163674,
-    163682,
-    163691,
-    163700,
-    163709,
-    163718,
-    163727,
-    163735,
-    163744,
     163753,
-    163762,
-    163771,
-    163780,
-    163789,
-    163797,
-    163806,
-    163815,
-    163824,
-    163833,
-    163842,
-    163850,
-    163859,
-    163868,
-    163877,
-    163886,
     163895,
-    163903,
-    163912,
-    163921,
-    163930,
-    163939,
-    163948,
-    163957,
-    163965,
-    163974,
-    163983,
-    163992,
-    164001,
-    164010,
-    164018,
-    164027,
     164036,
-    164045,
-    164054,
-    164063,
-    164071,
-    164080,
-    164089,
-    164098,
-    164107,
-    164116,
-    164124,
-    164133,
-    164142,
-    164151,
-    164160,
-    164169,
     164177,
-    164186,
-    164195,
-    164204,
-    164213,
-    164222,
-    164230,
-    164239,
-    164248,
-    164257,
-    164266,
-    164275,
-    164283,
-    164292,
-    164301,
-    164310,
     164319,
-    164328,
-    164336,
-    164345,
-    164354,
-    164363,
-    164372,
-    164381,
-    164389,
-    164398,
-    164407,
-    164416,
-    164425,
-    164434,
-    164442,
-    164451,
     164460,
-    164469,
-    164478,
-    164487,
-    164495,
-    164504,
-    164513,
-    164522,
-    164531,
-    164540,
-    164548,
-    164557,
-    164566,
-    164575,
-    164584,
-    164593,
     164601,
-    164610,
-    164619,
-    164628,
-    164637,
-    164646,
-    164654,
-    164663,
-    164672,
-    164681,
-    164690,
-    164699,
-    164707,
-    164716,
-    164725,
-    164734,
     164743,
-    164751,
-    164760,
-    164769,
-    164778,
-    164787,
-    164796,
-    164804,
-    164813,
-    164822,
-    164831,
-    164840,
-    164849,
-    164857,
-    164866,
-    164875,
     164884,
-    164893,
-    164901,
-    164910,
-    164919,
-    164928,
-    164937,
-    164946,
-    164954,
-    164963,
-    164972,
-    164981,
-    164990,
-    164999,
-    165007,
-    165016,
     165025,
-    165034,
-    165043,
-    165051,
-    165060,
-    165069,
-    165078,
-    165087,
-    165096,
-    165104,
-    165113,
-    165122,
-    165131,
-    165140,
-    165148,
-    165157,
     165166,
-    165175,
-    165184,
-    165193,
-    165201,
-    165210,
-    165219,
-    165228,
-    165237,
-    165245,
-    165254,
-    165263,
-    165272,
-    165281,
-    165290,
-    165298,
     165307,
-    165316,
-    165325,
-    165334,
-    165342,
-    165351,
-    165360,
-    165369,
-    165378,
-    165386,
-    165395,
-    165404,
-    165413,
-    165422,
-    165431,
-    165439,
     165448,
-    165457,
-    165466,
-    165475,
-    165483,
-    165492,
-    165501,
-    165510,
-    165519,
-    165527,
-    165536,
-    165545,
-    165554,
-    165563,
-    165572,
-    165580,
     165589,
-    165598,
-    165607,
-    165616,
-    165624,
-    165633,
-    165642,
-    165651,
-    165660,
-    165668,
-    165677,
-    165686,
-    165695,
-    165704,
-    165712,
-    165721,
     165730,
-    165739,
-    165748,
-    165757,
-    165765,
-    165774,
-    165783,
-    165792,
-    165801,
-    165809,
-    165818,
-    165827,
-    165836,
-    165845,
-    165853,
-    165862,
     165871,
-    165880,
-    165889,
-    165897,
-    165906,
-    165915,
-    165924,
-    165933,
-    165941,
-    165950,
-    165959,
-    165968,
-    165977,
-    165985,
-    165994,
-    166003,
     166012,
-    166021,
-    166029,
-    166038,
-    166047,
-    166056,
-    166065,
-    166073,
-    166082,
-    166091,
-    166100,
-    166109,
-    166117,
-    166126,
-    166135,
-    166144,
     166153,
-    166162,
-    166170,
-    166179,
-    166188,
-    166197,
-    166206,
-    166214,
-    166223,
-    166232,
-    166241,
-    166249,
-    166258,
-    166267,
-    166276,
-    166285,
     166293,
-    166302,
-    166311,
-    166320,
-    166329,
-    166337,
-    166346,
-    166355,
-    166364,
-    166373,
-    166381,
-    166390,
-    166399,
-    166408,
-    166417,
-    166425,
     166434,
-    166443,
-    166452,
-    166461,
-    166469,
-    166478,
-    166487,
-    166496,
-    166505,
-    166513,
-    166522,
-    166531,
-    166540,
-    166549,
-    166557,
-    166566,
     166575,
-    166584,
-    166593,
-    166601,
-    166610,
-    166619,
-    166628,
-    166636,
-    166645,
-    166654,
-    166663,
-    166672,
-    166680,
-    166689,
-    166698,
-    166707,
     166716,
-    166724,
-    166733,
-    166742,
-    166751,
-    166760,
-    166768,
-    166777,
-    166786,
-    166795,
-    166804,
-    166812,
-    166821,
-    166830,
-    166839,
-    166847,
     166856,
-    166865,
-    166874,
-    166883,
-    166891,
-    166900,
-    166909,
-    166918,
-    166927,
-    166935,
-    166944,
-    166953,
-    166962,
-    166970,
-    166979,
-    166988,
     166997,
-    167006,
-    167014,
-    167023,
-    167032,
-    167041,
-    167050,
-    167058,
-    167067,
-    167076,
-    167085,
-    167093,
-    167102,
-    167111,
-    167120,
-    167129,
     167137,
-    167146,
-    167155,
-    167164,
-    167173,
-    167181,
-    167190,
-    167199,
-    167208,
-    167216,
-    167225,
-    167234,
-    167243,
-    167252,
-    167260,
-    167269,
     167278,
-    167287,
-    167295,
-    167304,
-    167313,
-    167322,
-    167331,
-    167339,
-    167348,
-    167357,
-    167366,
-    167374,
-    167383,
-    167392,
-    167401,
-    167410,
     167418,
-    167427,
-    167436,
-    167445,
-    167453,
-    167462,
-    167471,
-    167480,
-    167489,
-    167497,
-    167506,
-    167515,
-    167524,
-    167532,
-    167541,
-    167550,
     167559,
-    167568,
-    167576,
-    167585,
-    167594,
-    167603,
-    167611,
-    167620,
-    167629,
-    167638,
-    167647,
-    167655,
-    167664,
-    167673,
-    167682,
-    167690,
     167699,
-    167708,
-    167717,
-    167726,
-    167734,
-    167743,
-    167752,
-    167761,
-    167769,
-    167778,
-    167787,
-    167796,
-    167804,
-    167813,
-    167822,
-    167831,
     167840,
-    167848,
-    167857,
-    167866,
-    167875,
-    167883,
-    167892,
-    167901,
-    167910,
-    167918,
-    167927,
-    167936,
-    167945,
-    167954,
-    167962,
-    167971,
     167980,
-    167989,
-    167997,
-    168006,
-    168015,
-    168024,
-    168032,
-    168041,
-    168050,
-    168059,
-    168068,
-    168076,
-    168085,
-    168094,
-    168103,
-    168111,
     168120,
-    168129,
-    168138,
-    168146,
-    168155,
-    168164,
-    168173,
-    168181,
-    168190,
-    168199,
-    168208,
-    168217,
-    168225,
-    168234,
-    168243,
-    168252,
     168260,
-    168269,
-    168278,
-    168287,
-    168295,
-    168304,
-    168313,
-    168322,
-    168330,
-    168339,
-    168348,
-    168357,
-    168366,
-    168374,
-    168383,
-    168392,
     168401,
-    168409,
-    168418,
-    168427,
-    168436,
-    168444,
-    168453,
-    168462,
-    168471,
-    168479,
-    168488,
-    168497,
-    168506,
-    168514,
-    168523,
-    168532,
     168541,
-    168549,
-    168558,
-    168567,
-    168576,
-    168585,
-    168593,
-    168602,
-    168611,
-    168620,
-    168628,
-    168637,
-    168646,
-    168655,
-    168663,
-    168672,
     168681,
-    168690,
-    168698,
-    168707,
-    168716,
-    168725,
-    168733,
-    168742,
-    168751,
-    168760,
-    168768,
-    168777,
-    168786,
-    168795,
-    168803,
-    168812,
     168821,
-    168830,
-    168838,
-    168847,
-    168856,
-    168865,
-    168873,
-    168882,
-    168891,
-    168900,
-    168908,
-    168917,
-    168926,
-    168935,
-    168943,
-    168952,
     168961,
-    168970,
-    168978,
-    168987,
-    168996,
-    169005,
-    169013,
-    169022,
-    169031,
-    169040,
-    169048,
-    169057,
-    169066,
-    169075,
-    169083,
-    169092,
     169101,
-    169110,
-    169118,
-    169127,
-    169136,
-    169145,
-    169153,
-    169162,
-    169171,
-    169180,
-    169188,
-    169197,
-    169206,
-    169215,
-    169223,
-    169232,
     169241,
-    169250,
-    169258,
-    169267,
-    169276,
-    169285,
-    169293,
-    169302,
-    169311,
-    169320,
-    169328,
-    169337,
-    169346,
-    169355,
-    169363,
-    169372,
     169381,
-    169390,
-    169398,
-    169407,
-    169416,
-    169425,
-    169433,
-    169442,
-    169451,
-    169460,
-    169468,
-    169477,
-    169486,
-    169495,
-    169503,
-    169512,
     169521,
-    169529,
-    169538,
-    169547,
-    169556,
-    169564,
-    169573,
-    169582,
-    169591,
-    169599,
-    169608,
-    169617,
-    169626,
-    169634,
-    169643,
-    169652,
     169661,
-    169669,
-    169678,
-    169687,
-    169696,
-    169704,
-    169713,
-    169722,
-    169731,
-    169739,
-    169748,
-    169757,
-    169765,
-    169774,
-    169783,
-    169792,
     169800,
-    169809,
-    169818,
-    169827,
-    169835,
-    169844,
-    169853,
-    169862,
-    169870,
-    169879,
-    169888,
-    169897,
-    169905,
-    169914,
-    169923,
-    169931,
     169940,
-    169949,
-    169958,
-    169966,
-    169975,
-    169984,
-    169993,
-    170001,
-    170010,
-    170019,
-    170028,
-    170036,
-    170045,
-    170054,
-    170062,
-    170071,
     170080,
-    170089,
-    170097,
-    170106,
-    170115,
-    170124,
-    170132,
-    170141,
-    170150,
-    170159,
-    170167,
-    170176,
-    170185,
-    170193,
-    170202,
-    170211,
     170220,
-    170228,
-    170237,
-    170246,
-    170255,
-    170263,
-    170272,
-    170281,
-    170289,
-    170298,
-    170307,
-    170316,
-    170324,
-    170333,
-    170342,
-    170351,
     170359,
-    170368,
-    170377,
-    170385,
-    170394,
-    170403,
-    170412,
-    170420,
-    170429,
-    170438,
-    170447,
-    170455,
-    170464,
-    170473,
-    170481,
-    170490,
     170499,
-    170508,
-    170516,
-    170525,
-    170534,
-    170543,
-    170551,
-    170560,
-    170569,
-    170577,
-    170586,
-    170595,
-    170604,
-    170612,
-    170621,
-    170630,
     170638,
-    170647,
-    170656,
-    170665,
-    170673,
-    170682,
-    170691,
-    170700,
-    170708,
-    170717,
-    170726,
-    170734,
-    170743,
-    170752,
-    170761,
-    170769,
     170778,
-    170787,
-    170795,
-    170804,
-    170813,
-    170822,
-    170830,
-    170839,
-    170848,
-    170856,
-    170865,
-    170874,
-    170883,
-    170891,
-    170900,
-    170909,
     170918,
-    170926,
-    170935,
-    170944,
-    170952,
-    170961,
-    170970,
-    170979,
-    170987,
-    170996,
-    171005,
-    171013,
-    171022,
-    171031,
-    171040,
-    171048,
     171057,
-    171066,
-    171074,
-    171083,
-    171092,
-    171101,
-    171109,
-    171118,
-    171127,
-    171135,
-    171144,
-    171153,
-    171162,
-    171170,
-    171179,
-    171188,
     171196,
-    171205,
-    171214,
-    171223,
-    171231,
-    171240,
-    171249,
-    171257,
-    171266,
-    171275,
-    171284,
-    171292,
-    171301,
-    171310,
-    171318,
-    171327,
     171336,
-    171345,
-    171353,
-    171362,
-    171371,
-    171379,
-    171388,
-    171397,
-    171405,
-    171414,
-    171423,
-    171432,
-    171440,
-    171449,
-    171458,
-    171466,
     171475,
-    171484,
-    171493,
-    171501,
-    171510,
-    171519,
-    171527,
-    171536,
-    171545,
-    171554,
-    171562,
-    171571,
-    171580,
-    171588,
-    171597,
-    171606,
     171614,
-    171623,
-    171632,
-    171641,
-    171649,
-    171658,
-    171667,
-    171675,
-    171684,
-    171693,
-    171702,
-    171710,
-    171719,
-    171728,
-    171736,
-    171745,
     171754,
-    171762,
-    171771,
-    171780,
-    171789,
-    171797,
-    171806,
-    171815,
-    171823,
-    171832,
-    171841,
-    171849,
-    171858,
-    171867,
-    171876,
-    171884,
     171893,
-    171902,
-    171910,
-    171919,
-    171928,
-    171937,
-    171945,
-    171954,
-    171963,
-    171971,
-    171980,
-    171989,
-    171997,
-    172006,
-    172015,
-    172024,
     172032,
-    172041,
-    172050,
-    172058,
-    172067,
-    172076,
-    172084,
-    172093,
-    172102,
-    172110,
-    172119,
-    172128,
-    172137,
-    172145,
-    172154,
-    172163,
     172171,
-    172180,
-    172189,
-    172197,
-    172206,
-    172215,
-    172224,
-    172232,
-    172241,
-    172250,
-    172258,
-    172267,
-    172276,
-    172284,
-    172293,
-    172302,
     172310,
-    172319,
-    172328,
-    172337,
-    172345,
-    172354,
-    172363,
-    172371,
-    172380,
-    172389,
-    172397,
-    172406,
-    172415,
-    172424,
-    172432,
-    172441,
     172450,
-    172458,
-    172467,
-    172476,
-    172484,
-    172493,
-    172502,
-    172510,
-    172519,
-    172528,
-    172537,
-    172545,
-    172554,
-    172563,
-    172571,
-    172580,
     172589,
-    172597,
-    172606,
-    172615,
-    172623,
-    172632,
-    172641,
-    172649,
-    172658,
-    172667,
-    172676,
-    172684,
-    172693,
-    172702,
-    172710,
-    172719,
     172728,
-    172736,
-    172745,
-    172754,
-    172762,
-    172771,
-    172780,
-    172788,
-    172797,
-    172806,
-    172815,
-    172823,
-    172832,
-    172841,
-    172849,
-    172858,
     172867,
-    172875,
-    172884,
-    172893,
-    172901,
-    172910,
-    172919,
-    172927,
-    172936,
-    172945,
-    172953,
-    172962,
-    172971,
-    172980,
-    172988,
-    172997,
     173006,
-    173014,
-    173023,
-    173032,
-    173040,
-    173049,
-    173058,
-    173066,
-    173075,
-    173084,
-    173092,
-    173101,
-    173110,
-    173118,
-    173127,
-    173136,
     173144,
-    173153,
-    173162,
-    173171,
-    173179,
-    173188,
-    173197,
-    173205,
-    173214,
-    173223,
-    173231,
-    173240,
-    173249,
-    173257,
-    173266,
-    173275,
     173283,
-    173292,
-    173301,
-    173309,
-    173318,
-    173327,
-    173335,
-    173344,
-    173353,
-    173361,
-    173370,
-    173379,
-    173387,
-    173396,
-    173405,
-    173414,
     173422,
-    173431,
-    173440,
-    173448,
-    173457,
-    173466,
-    173474,
-    173483,
-    173492,
-    173500,
-    173509,
-    173518,
-    173526,
-    173535,
-    173544,
-    173552,
     173561,
-    173570,
-    173578,
-    173587,
-    173596,
-    173604,
-    173613,
-    173622,
-    173630,
-    173639,
-    173648,
-    173656,
-    173665,
-    173674,
-    173682,
-    173691,
     173700,
-    173708,
-    173717,
-    173726,
-    173734,
-    173743,
-    173752,
-    173760,
-    173769,
-    173778,
-    173786,
-    173795,
-    173804,
-    173812,
-    173821,
-    173830,
     173838,
-    173847,
-    173856,
-    173864,
-    173873,
-    173882,
-    173890,
-    173899,
-    173908,
-    173916,
-    173925,
-    173934,
-    173942,
-    173951,
-    173960,
-    173968,
     173977,
-    173986,
-    173994,
-    174003,
-    174012,
-    174020,
-    174029,
-    174038,
-    174046,
-    174055,
-    174064,
-    174072,
-    174081,
-    174090,
-    174098,
-    174107,
     174116,
-    174124,
-    174133,
-    174142,
-    174150,
-    174159,
-    174168,
-    174176,
-    174185,
-    174194,
-    174202,
-    174211,
-    174220,
-    174228,
-    174237,
-    174246,
     174254,
-    174263,
-    174272,
-    174280,
-    174289,
-    174298,
-    174306,
-    174315,
-    174324,
-    174332,
-    174341,
-    174350,
-    174358,
-    174367,
-    174376,
-    174384,
     174393,
-    174402,
-    174410,
-    174419,
-    174428,
-    174436,
-    174445,
-    174454,
-    174462,
-    174471,
-    174480,
-    174488,
-    174497,
-    174506,
-    174514,
-    174523,
     174531,
-    174540,
-    174549,
-    174557,
-    174566,
-    174575,
-    174583,
-    174592,
-    174601,
-    174609,
-    174618,
-    174627,
-    174635,
-    174644,
-    174653,
-    174661,
     174670,
-    174679,
-    174687,
-    174696,
-    174705,
-    174713,
-    174722,
-    174731,
-    174739,
-    174748,
-    174757,
-    174765,
-    174774,
-    174782,
-    174791,
-    174800,
     174808,
-    174817,
-    174826,
-    174834,
-    174843,
-    174852,
-    174860,
-    174869,
-    174878,
-    174886,
-    174895,
-    174904,
-    174912,
-    174921,
-    174930,
-    174938,
     174947,
-    174956,
-    174964,
-    174973,
-    174981,
-    174990,
-    174999,
-    175007,
-    175016,
-    175025,
-    175033,
-    175042,
-    175051,
-    175059,
-    175068,
-    175077,
     175085,
-    175094,
-    175103,
-    175111,
-    175120,
-    175129,
-    175137,
-    175146,
-    175154,
-    175163,
-    175172,
-    175180,
-    175189,
-    175198,
-    175206,
-    175215,
     175224,
-    175232,
-    175241,
-    175250,
-    175258,
-    175267,
-    175275,
-    175284,
-    175293,
-    175301,
-    175310,
-    175319,
-    175327,
-    175336,
-    175345,
-    175353,
     175362,
-    175371,
-    175379,
-    175388,
-    175397,
-    175405,
-    175414,
-    175422,
-    175431,
-    175440,
-    175448,
-    175457,
-    175466,
-    175474,
-    175483,
-    175492,
     175500,
-    175509,
-    175518,
-    175526,
-    175535,
-    175543,
-    175552,
-    175561,
-    175569,
-    175578,
-    175587,
-    175595,
-    175604,
-    175613,
-    175621,
-    175630,
     175638,
-    175647,
-    175656,
-    175664,
-    175673,
-    175682,
-    175690,
-    175699,
-    175708,
-    175716,
-    175725,
-    175733,
-    175742,
-    175751,
-    175759,
-    175768,
     175777,
-    175785,
-    175794,
-    175803,
-    175811,
-    175820,
-    175828,
-    175837,
-    175846,
-    175854,
-    175863,
-    175872,
-    175880,
-    175889,
-    175898,
-    175906,
     175915,
-    175923,
-    175932,
-    175941,
-    175949,
-    175958,
-    175967,
-    175975,
-    175984,
-    175993,
-    176001,
-    176010,
-    176018,
-    176027,
-    176036,
-    176044,
     176053,
-    176062,
-    176070,
-    176079,
-    176088,
-    176096,
-    176105,
-    176113,
-    176122,
-    176131,
-    176139,
-    176148,
-    176157,
-    176165,
-    176174,
-    176182,
     176191,
-    176200,
-    176208,
-    176217,
-    176226,
-    176234,
-    176243,
-    176251,
-    176260,
-    176269,
-    176277,
-    176286,
-    176295,
-    176303,
-    176312,
-    176321,
     176329,
-    176338,
-    176346,
-    176355,
-    176364,
-    176372,
-    176381,
-    176390,
-    176398,
-    176407,
-    176415,
-    176424,
-    176433,
-    176441,
-    176450,
-    176459,
     176467,
-    176476,
-    176484,
-    176493,
-    176502,
-    176510,
-    176519,
-    176528,
-    176536,
-    176545,
-    176553,
-    176562,
-    176571,
-    176579,
-    176588,
-    176597,
     176605,
-    176614,
-    176622,
-    176631,
-    176640,
-    176648,
-    176657,
-    176666,
-    176674,
-    176683,
-    176691,
-    176700,
-    176709,
-    176717,
-    176726,
-    176734,
     176743,
-    176752,
-    176760,
-    176769,
-    176778,
-    176786,
-    176795,
-    176803,
-    176812,
-    176821,
-    176829,
-    176838,
-    176847,
-    176855,
-    176864,
-    176872,
     176881,
-    176890,
-    176898,
-    176907,
-    176916,
-    176924,
-    176933,
-    176941,
-    176950,
-    176959,
-    176967,
-    176976,
-    176984,
-    176993,
-    177002,
-    177010,
     177019,
-    177028,
-    177036,
-    177045,
-    177053,
-    177062,
-    177071,
-    177079,
-    177088,
-    177096,
-    177105,
-    177114,
-    177122,
-    177131,
-    177140,
-    177148,
     177157,
-    177165,
-    177174,
-    177183,
-    177191,
-    177200,
-    177208,
-    177217,
-    177226,
-    177234,
-    177243,
-    177252,
-    177260,
-    177269,
-    177277,
-    177286,
     177295,
-    177303,
-    177312,
-    177320,
-    177329,
-    177338,
-    177346,
-    177355,
-    177363,
-    177372,
-    177381,
-    177389,
-    177398,
-    177407,
-    177415,
-    177424,
     177432,
-    177441,
-    177450,
-    177458,
-    177467,
-    177475,
-    177484,
-    177493,
-    177501,
-    177510,
-    177518,
-    177527,
-    177536,
-    177544,
-    177553,
-    177561,
     177570,
-    177579,
-    177587,
-    177596,
-    177605,
-    177613,
-    177622,
-    177630,
-    177639,
-    177648,
-    177656,
-    177665,
-    177673,
-    177682,
-    177691,
-    177699,
     177708,
-    177716,
-    177725,
-    177734,
-    177742,
-    177751,
-    177759,
-    177768,
-    177777,
-    177785,
-    177794,
-    177802,
-    177811,
-    177820,
-    177828,
-    177837,
     177845,
-    177854,
-    177863,
-    177871,
-    177880,
-    177888,
-    177897,
-    177906,
-    177914,
-    177923,
-    177931,
-    177940,
-    177949,
-    177957,
-    177966,
-    177974,
     177983,
-    177992,
-    178000,
-    178009,
-    178017,
-    178026,
-    178035,
-    178043,
-    178052,
-    178060,
-    178069,
-    178078,
-    178086,
-    178095,
-    178103,
-    178112,
     178121,
-    178129,
-    178138,
-    178146,
-    178155,
-    178164,
-    178172,
-    178181,
-    178189,
-    178198,
-    178207,
-    178215,
-    178224,
-    178232,
-    178241,
-    178250,
     178258,
-    178267,
-    178275,
-    178284,
-    178293,
-    178301,
-    178310,
-    178318,
-    178327,
-    178336,
-    178344,
-    178353,
-    178361,
-    178370,
-    178379,
-    178387,
     178396,
-    178404,
-    178413,
-    178422,
-    178430,
-    178439,
-    178447,
-    178456,
-    178465,
-    178473,
-    178482,
-    178490,
-    178499,
-    178507,
-    178516,
-    178525,
     178533,
-    178542,
-    178550,
-    178559,
-    178568,
-    178576,
-    178585,
-    178593,
-    178602,
-    178611,
-    178619,
-    178628,
-    178636,
-    178645,
-    178654,
-    178662,
     178671,
-    178679,
-    178688,
-    178697,
-    178705,
-    178714,
-    178722,
-    178731,
-    178739,
-    178748,
-    178757,
-    178765,
-    178774,
-    178782,
-    178791,
-    178800,
     178808,
-    178817,
-    178825,
-    178834,
-    178843,
-    178851,
-    178860,
-    178868,
-    178877,
-    178885,
-    178894,
-    178903,
-    178911,
-    178920,
-    178928,
-    178937,
     178946,
-    178954,
-    178963,
-    178971,
-    178980,
-    178988,
-    178997,
-    179006,
-    179014,
-    179023,
-    179031,
-    179040,
-    179049,
-    179057,
-    179066,
-    179074,
     179083,
-    179091,
-    179100,
-    179109,
-    179117,
-    179126,
-    179134,
-    179143,
-    179152,
-    179160,
-    179169,
-    179177,
-    179186,
-    179194,
-    179203,
-    179212,
     179220,
-    179229,
-    179237,
-    179246,
-    179255,
-    179263,
-    179272,
-    179280,
-    179289,
-    179297,
-    179306,
-    179315,
-    179323,
-    179332,
-    179340,
-    179349,
     179357,
-    179366,
-    179375,
-    179383,
-    179392,
-    179400,
-    179409,
-    179418,
-    179426,
-    179435,
-    179443,
-    179452,
-    179460,
-    179469,
-    179478,
-    179486,
     179495,
-    179503,
-    179512,
-    179520,
-    179529,
-    179538,
-    179546,
-    179555,
-    179563,
-    179572,
-    179580,
-    179589,
-    179598,
-    179606,
-    179615,
-    179623,
     179632,
-    179641,
-    179649,
-    179658,
-    179666,
-    179675,
-    179683,
-    179692,
-    179701,
-    179709,
-    179718,
-    179726,
-    179735,
-    179743,
-    179752,
-    179761,
     179769,
-    179778,
-    179786,
-    179795,
-    179803,
-    179812,
-    179821,
-    179829,
-    179838,
-    179846,
-    179855,
-    179863,
-    179872,
-    179881,
-    179889,
-    179898,
     179906,
-    179915,
-    179923,
-    179932,
-    179941,
-    179949,
-    179958,
-    179966,
-    179975,
-    179983,
-    179992,
-    180001,
-    180009,
-    180018,
-    180026,
-    180035,
     180043,
-    180052,
-    180061,
-    180069,
-    180078,
-    180086,
-    180095,
-    180103,
-    180112,
-    180120,
-    180129,
-    180138,
-    180146,
-    180155,
-    180163,
-    180172,
     180180,
-    180189,
-    180198,
-    180206,
-    180215,
-    180223,
-    180232,
-    180240,
-    180249,
-    180258,
-    180266,
-    180275,
-    180283,
-    180292,
-    180300,
-    180309,
     180317,
-    180326,
-    180335,
-    180343,
-    180352,
-    180360,
-    180369,
-    180377,
-    180386,
-    180395,
-    180403,
-    180412,
-    180420,
-    180429,
-    180437,
-    180446,
     180454,
-    180463,
-    180472,
-    180480,
-    180489,
-    180497,
-    180506,
-    180514,
-    180523,
-    180532,
-    180540,
-    180549,
-    180557,
-    180566,
-    180574,
-    180583,
     180591,
-    180600,
-    180609,
-    180617,
-    180626,
-    180634,
-    180643,
-    180651,
-    180660,
-    180668,
-    180677,
-    180686,
-    180694,
-    180703,
-    180711,
-    180720,
     180728,
-    180737,
-    180745,
-    180754,
-    180763,
-    180771,
-    180780,
-    180788,
-    180797,
-    180805,
-    180814,
-    180822,
-    180831,
-    180840,
-    180848,
-    180857,
     180865,
-    180874,
-    180882,
-    180891,
-    180899,
-    180908,
-    180917,
-    180925,
-    180934,
-    180942,
-    180951,
-    180959,
-    180968,
-    180976,
-    180985,
-    180994,
     181002,
-    181011,
-    181019,
-    181028,
-    181036,
-    181045,
-    181053,
-    181062,
-    181071,
-    181079,
-    181088,
-    181096,
-    181105,
-    181113,
-    181122,
-    181130,
     181139,
-    181148,
-    181156,
-    181165,
-    181173,
-    181182,
-    181190,
-    181199,
-    181207,
-    181216,
-    181224,
-    181233,
-    181242,
-    181250,
-    181259,
-    181267,
     181276,
-    181284,
-    181293,
-    181301,
-    181310,
-    181319,
-    181327,
-    181336,
-    181344,
-    181353,
-    181361,
-    181370,
-    181378,
-    181387,
-    181395,
-    181404,
     181413,
-    181421,
-    181430,
-    181438,
-    181447,
-    181455,
-    181464,
-    181472,
-    181481,
-    181489,
-    181498,
-    181507,
-    181515,
-    181524,
-    181532,
-    181541,
     181549,
-    181558,
-    181566,
-    181575,
-    181583,
-    181592,
-    181601,
-    181609,
-    181618,
-    181626,
-    181635,
-    181643,
-    181652,
-    181660,
-    181669,
-    181677,
     181686,
-    181694,
-    181703,
-    181712,
-    181720,
-    181729,
-    181737,
-    181746,
-    181754,
-    181763,
-    181771,
-    181780,
-    181788,
-    181797,
-    181806,
-    181814,
     181823,
-    181831,
-    181840,
-    181848,
-    181857,
-    181865,
-    181874,
-    181882,
-    181891,
-    181899,
-    181908,
-    181917,
-    181925,
-    181934,
-    181942,
-    181951,
     181959,
-    181968,
-    181976,
-    181985,
-    181993,
-    182002,
-    182010,
-    182019,
-    182028,
-    182036,
-    182045,
-    182053,
-    182062,
-    182070,
-    182079,
-    182087,
     182096,
-    182104,
-    182113,
-    182121,
-    182130,
-    182138,
-    182147,
-    182156,
-    182164,
-    182173,
-    182181,
-    182190,
-    182198,
-    182207,
-    182215,
-    182224,
     182232,
-    182241,
-    182249,
-    182258,
-    182266,
-    182275,
-    182284,
-    182292,
-    182301,
-    182309,
-    182318,
-    182326,
-    182335,
-    182343,
-    182352,
-    182360,
     182369,
-    182377,
-    182386,
-    182394,
-    182403,
-    182412,
-    182420,
-    182429,
-    182437,
-    182446,
-    182454,
-    182463,
-    182471,
-    182480,
-    182488,
-    182497,
     182505,
-    182514,
-    182522,
-    182531,
-    182539,
-    182548,
-    182557,
-    182565,
-    182574,
-    182582,
-    182591,
-    182599,
-    182608,
-    182616,
-    182625,
-    182633,
     182642,
-    182650,
-    182659,
-    182667,
-    182676,
-    182684,
-    182693,
-    182702,
-    182710,
-    182719,
-    182727,
-    182736,
-    182744,
-    182753,
-    182761,
-    182770,
     182778,
-    182787,
-    182795,
-    182804,
-    182812,
-    182821,
-    182829,
-    182838,
-    182846,
-    182855,
-    182863,
-    182872,
-    182881,
-    182889,
-    182898,
-    182906,
     182915,
-    182923,
-    182932,
-    182940,
-    182949,
-    182957,
-    182966,
-    182974,
-    182983,
-    182991,
-    183000,
-    183008,
-    183017,
-    183025,
-    183034,
-    183042,
     183051,
-    183060,
-    183068,
-    183077,
-    183085,
-    183094,
-    183102,
-    183111,
-    183119,
-    183128,
-    183136,
-    183145,
-    183153,
-    183162,
-    183170,
-    183179,
     183187,
-    183196,
-    183204,
-    183213,
-    183221,
-    183230,
-    183238,
-    183247,
-    183255,
-    183264,
-    183272,
-    183281,
-    183290,
-    183298,
-    183307,
-    183315,
     183324,
-    183332,
-    183341,
-    183349,
-    183358,
-    183366,
-    183375,
-    183383,
-    183392,
-    183400,
-    183409,
-    183417,
-    183426,
-    183434,
-    183443,
-    183451,
     183460,
-    183468,
-    183477,
-    183485,
-    183494,
-    183502,
-    183511,
-    183519,
-    183528,
-    183536,
-    183545,
-    183553,
-    183562,
-    183571,
-    183579,
-    183588,
     183596,
-    183605,
-    183613,
-    183622,
-    183630,
-    183639,
-    183647,
-    183656,
-    183664,
-    183673,
-    183681,
-    183690,
-    183698,
-    183707,
-    183715,
-    183724,
     183732,
-    183741,
-    183749,
-    183758,
-    183766,
-    183775,
-    183783,
-    183792,
-    183800,
-    183809,
-    183817,
-    183826,
-    183834,
-    183843,
-    183851,
-    183860,
     183868,
-    183877,
-    183885,
-    183894,
-    183902,
-    183911,
-    183919,
-    183928,
-    183936,
-    183945,
-    183953,
-    183962,
-    183970,
-    183979,
-    183987,
-    183996,
     184004,
-    184013,
-    184022,
-    184030,
-    184039,
-    184047,
-    184056,
-    184064,
-    184073,
-    184081,
-    184090,
-    184098,
-    184107,
-    184115,
-    184124,
-    184132,
     184141,
-    184149,
-    184158,
-    184166,
-    184175,
-    184183,
-    184192,
-    184200,
-    184209,
-    184217,
-    184226,
-    184234,
-    184243,
-    184251,
-    184260,
-    184268,
     184277,
-    184285,
-    184294,
-    184302,
-    184311,
-    184319,
-    184328,
-    184336,
-    184345,
-    184353,
-    184362,
-    184370,
-    184379,
-    184387,
-    184396,
-    184404,
     184413,
-    184421,
-    184430,
-    184438,
-    184447,
-    184455,
-    184464,
-    184472,
-    184481,
-    184489,
-    184498,
-    184506,
-    184515,
-    184523,
-    184532,
-    184540,
     184549,
-    184557,
-    184566,
-    184574,
-    184583,
-    184591,
-    184600,
-    184608,
-    184617,
-    184625,
-    184634,
-    184642,
-    184651,
-    184659,
-    184668,
-    184676,
     184685,
-    184693,
-    184702,
-    184710,
-    184719,
-    184727,
-    184736,
-    184744,
-    184753,
-    184761,
-    184770,
-    184778,
-    184787,
-    184795,
-    184803,
-    184812,
     184820,
-    184829,
-    184837,
-    184846,
-    184854,
-    184863,
-    184871,
-    184880,
-    184888,
-    184897,
-    184905,
-    184914,
-    184922,
-    184931,
-    184939,
-    184948,
     184956,
-    184965,
-    184973,
-    184982,
-    184990,
-    184999,
-    185007,
-    185016,
-    185024,
-    185033,
-    185041,
-    185050,
-    185058,
-    185067,
-    185075,
-    185084,
     185092,
-    185101,
-    185109,
-    185118,
-    185126,
-    185135,
-    185143,
-    185152,
-    185160,
-    185169,
-    185177,
-    185186,
-    185194,
-    185203,
-    185211,
-    185220,
     185228,
-    185237,
-    185245,
-    185253,
-    185262,
-    185270,
-    185279,
-    185287,
-    185296,
-    185304,
-    185313,
-    185321,
-    185330,
-    185338,
-    185347,
-    185355,
     185364
 };
+#endif
 
 real_32_t faac_table_log2[64+1] = {
     0,
@@ -65632,6 +4196,7 @@ real_32_t faac_table_log2[64+1] = {
     2907270
 };
 
+#ifndef FAAC_FLOAT
 fftfloat faac_fft_costbl[1<<(FAAC_FFT_LOGM-1)] = {
     65536,
     65531,
@@ -66150,7 +4715,7 @@ fftfloat faac_fft_negsintbl[1<<(FAAC_FFT_LOGM-1)] = {
     -804
 };
 
-real_32_t faac_fft_cosx[FAAC_FFT_SINCOS_SIZE] = {
+fftfloat faac_fft_cosx[FAAC_FFT_SINCOS_SIZE] = {
     65536,
     65536,
     65535,
@@ -66665,7 +5230,7 @@ real_32_t faac_fft_cosx[FAAC_FFT_SINCOS_SIZE] = {
     176,
 };
 
-real_32_t faac_fft_sinx[FAAC_FFT_SINCOS_SIZE] = {
+fftfloat faac_fft_sinx[FAAC_FFT_SINCOS_SIZE] = {
     25,
     226,
     427,
@@ -67179,5 +5744,12 @@ real_32_t faac_fft_sinx[FAAC_FFT_SINCOS_SIZE] = {
     65535,
     65536,
 };
+#else
+/* (The floating-point build computes these in faac_fixed_init().) */
+fftfloat faac_fft_costbl[1<<(FAAC_FFT_LOGM-1)];
+fftfloat faac_fft_negsintbl[1<<(FAAC_FFT_LOGM-1)];
+fftfloat faac_fft_cosx[FAAC_FFT_SINCOS_SIZE];
+fftfloat faac_fft_sinx[FAAC_FFT_SINCOS_SIZE];
+#endif
 
 #endif
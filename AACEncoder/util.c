@@ -22,6 +22,9 @@
 
 #include "fixed.h"
 #include "util.h"
+#ifdef WIN32
+#include <windows.h>
+#endif
 
 /* Returns the sample rate index */
 int32_t GetSRIndex(uint32_t sampleRate)
@@ -70,3 +73,37 @@ uint32_t MaxBitresSize(ulong_t bitRate, ulong_t sampleRate)
 {
     return 6144 - REAL2INT(REAL_ICONST(bitRate)/(sampleRate<<10));
 }
+
+void faac_once(faac_once_t *once, void (*init)(void))
+{
+#ifdef WIN32
+    /* 0: not yet, 1: being initialized (by another thread), 2: done */
+    if (InterlockedCompareExchange((long *)once, 1, 0) == 0) {
+        init();
+        InterlockedExchange((long *)once, 2);
+    } else {
+        while (*once != 2)
+            Sleep(0);
+    }
+#else
+    pthread_once(once, init);
+#endif
+}
+
+int32_t faac_claim(volatile int32_t *flag)
+{
+#ifdef WIN32
+    return InterlockedExchange((volatile long *)flag, 1) == 0;
+#else
+    return __sync_lock_test_and_set(flag, 1) == 0;
+#endif
+}
+
+void faac_unclaim(volatile int32_t *flag)
+{
+#ifdef WIN32
+    InterlockedExchange((volatile long *)flag, 0);
+#else
+    __sync_lock_release(flag);
+#endif
+}
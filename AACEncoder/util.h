@@ -34,6 +34,23 @@ extern "C" {
 #define FreeMemory(block) free(block)
 #define SetMemory(block, value, size) memset(block, value, size)
 
+/* Thread-safety functions */
+#ifdef WIN32
+typedef volatile long faac_once_t;
+#define FAAC_ONCE_INIT 0
+#else
+#include <pthread.h>
+typedef pthread_once_t faac_once_t;
+#define FAAC_ONCE_INIT PTHREAD_ONCE_INIT
+#endif
+
+/* calls init() the first time only, even if several threads call this at once */
+void faac_once(faac_once_t *once, void (*init)(void));
+
+/* atomically sets *flag to 1; returns 1 if it was 0 */
+int32_t faac_claim(volatile int32_t *flag);
+void faac_unclaim(volatile int32_t *flag);
+
 int32_t GetSRIndex(uint32_t sampleRate);
 int32_t GetMaxPredSfb(int32_t samplingRateIdx);
 uint32_t MaxBitrate(ulong_t sampleRate);
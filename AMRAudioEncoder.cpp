@@ -20,14 +20,17 @@
 // Implementation
 
 #include "AMRAudioEncoder.hh"
+#include "AudioEncodingQueue.hh"
+#include <string.h>
 extern "C" {
 #include "AMREncoder/interf_enc.h"
 #include "AMREncoder/interf_rom.h"
 }
 
 AMRAudioEncoder* AMRAudioEncoder
-::createNew(UsageEnvironment& env, FramedSource* inputPCMSource, unsigned numChannels) {
-  return new AMRAudioEncoder(env, inputPCMSource, numChannels);
+::createNew(UsageEnvironment& env, FramedSource* inputPCMSource, unsigned numChannels,
+	    unsigned mode) {
+  return new AMRAudioEncoder(env, inputPCMSource, numChannels, mode);
 }
 
 #define MILLION 1000000
@@ -35,110 +38,92 @@ AMRAudioEncoder* AMRAudioEncoder
 #define AMR_SAMPLES_PER_SECOND 8000
 #define AMR_MICROSECONDS_PER_FRAME ((MILLION*AMR_SAMPLES_PER_FRAME)/AMR_SAMPLES_PER_SECOND)
 #define AMR_MAX_CODED_FRAME_SIZE 320 /*?????*/
+#define AMR_NUM_MODES 8 // MR475 through MR122 (we don't use DTX)
+
+// The bitrates (in bps) of the AMR-NB modes:
+static unsigned const amrModeBitrate[AMR_NUM_MODES] = {
+  4750, 5150, 5900, 6700, 7400, 7950, 10200, 12200
+};
+
+unsigned AMRAudioEncoder::bitrateForMode(unsigned mode) {
+  if (mode >= AMR_NUM_MODES) mode = AMR_NUM_MODES-1;
+  return amrModeBitrate[mode];
+}
+
+unsigned AMRAudioEncoder::modeForBitrate(unsigned bitrate) {
+  unsigned mode = AMR_NUM_MODES-1;
+  while (mode > 0 && amrModeBitrate[mode] > bitrate) --mode;
+  return mode;
+}
 
 AMRAudioEncoder
-::AMRAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource, unsigned numChannels)
+::AMRAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource,
+		  unsigned numChannels, unsigned mode)
   : AMRAudioSource(env, False/*isWideband*/, numChannels),
-    fInputPCMSource(inputPCMSource) {
-  extern int EncoderIncludeHeaderByte;
-  EncoderIncludeHeaderByte = 0;
+    fInputPCMSource(inputPCMSource),
+    fMode(mode < AMR_NUM_MODES ? mode : AMR_NUM_MODES-1) {
+  // Note: Each encoded frame begins with its 1-byte AMR frame header (which
+  // identifies the frame's mode), so that the mode can change from frame to frame.
   fEncoderState = Encoder_Interface_init(0/*no DTX*/);
 
-  fMicrosecondsPerByte
+  double microsecondsPerByte
     = (1.0*MILLION)/(AMR_SAMPLES_PER_SECOND*numChannels*sizeof (unsigned short));
-  fInputSampleBufferBytesDesired
-    = AMR_SAMPLES_PER_FRAME*numChannels*sizeof (unsigned short);
-      // the number of samples necessary in order to encode a frame
-  fInputSampleBufferSize = 10*fInputSampleBufferBytesDesired;
-  fInputSampleBuffer = new unsigned char[fInputSampleBufferSize];
-  fInputSampleBufferBytesFull = 0;
-
-  fLastInputDataPresentationTime.tv_sec = 0;
-  fLastInputDataPresentationTime.tv_usec = 0;
+  fEncodingQueue
+    = new AudioEncodingQueue(env, inputPCMSource,
+			     AMR_SAMPLES_PER_FRAME*numChannels*sizeof (unsigned short),
+			     microsecondsPerByte, 0/*no overlap*/, AMR_MAX_CODED_FRAME_SIZE,
+			     encodeFrame, this);
+
+  fLastFrameHeader = toc_byte[fMode];
 }
 
 AMRAudioEncoder::~AMRAudioEncoder() {
+  delete fEncodingQueue; // first, because it may be using the encoder
   Encoder_Interface_exit(fEncoderState);
-  delete[] fInputSampleBuffer;
+  Medium::close(fInputPCMSource); // as a "FramedFilter" would
+}
+
+void AMRAudioEncoder::setOutputBitrate(unsigned bitrate) {
+  // A worker thread may be encoding a frame now; it'll use the new mode
+  // for the next one:
+  __sync_lock_test_and_set(&fMode, modeForBitrate(bitrate));
 }
 
 void AMRAudioEncoder::doGetNextFrame() {
-  // If we have enough samples in order to encode a frame, do this now:
-  if (fInputSampleBufferBytesFull >= fInputSampleBufferBytesDesired) {
-    if (fMaxSize < AMR_MAX_CODED_FRAME_SIZE) {
-      // Our sink hasn't given us enough space for a frame.  We can't encode.
-      fFrameSize = 0;
-      fNumTruncatedBytes = AMR_MAX_CODED_FRAME_SIZE;
-    } else {
-      enum Mode ourAMRMode = MR122; // the only mode that we support
-      fFrameSize = Encoder_Interface_Encode(fEncoderState, ourAMRMode,
-					    (short*)fInputSampleBuffer, fTo,
-					    0/*disable DTX*/);
-      // Note the 1-byte AMR frame header (which wasn't included in the encoded data):
-      fLastFrameHeader = toc_byte[ourAMRMode];
-
-      fNumTruncatedBytes = 0;
-
-      // Shift any remaining samples down the the start of the buffer:
-      fInputSampleBufferBytesFull -= fInputSampleBufferBytesDesired;
-      memmove(fInputSampleBuffer,
-	      &fInputSampleBuffer[fInputSampleBufferBytesDesired],
-	      fInputSampleBufferBytesFull);
-    }
-
-    // Complete delivery to the client:
-    fPresentationTime = fLastInputDataPresentationTime;
-    //fDurationInMicroseconds = AMR_MICROSECONDS_PER_FRAME;
-    fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
-    afterGetting(this);
-  } else {
-    // Read more samples from our source, then try again:
-    unsigned maxBytesToRead
-      = fInputSampleBufferSize - fInputSampleBufferBytesFull;
-    fInputPCMSource
-      ->getNextFrame(&fInputSampleBuffer[fInputSampleBufferBytesFull],
-		     maxBytesToRead,
-		     afterGettingFrame, this,
-		     FramedSource::handleClosure, this);
-  }
+  // Deliver our next encoded frame, once it's ready:
+  fEncodingQueue->getNextEncodedFrame(afterEncoding, this,
+				      FramedSource::handleClosure, this);
 }
 
 void AMRAudioEncoder::doStopGettingFrames() {
-  fInputPCMSource->stopGettingFrames();
+  fEncodingQueue->stopGettingFrames();
 }
 
-void AMRAudioEncoder
-::afterGettingFrame(void* clientData, unsigned frameSize,
-                    unsigned numTruncatedBytes,
-                    struct timeval presentationTime,
-                    unsigned durationInMicroseconds) {
+void AMRAudioEncoder::afterEncoding(void* clientData) {
   AMRAudioEncoder* source = (AMRAudioEncoder*)clientData;
-  source->afterGettingFrame1(frameSize, numTruncatedBytes,
-                             presentationTime, durationInMicroseconds);
-}
-
-void AMRAudioEncoder
-::afterGettingFrame1(unsigned frameSize, unsigned numTruncatedBytes,
-                     struct timeval presentationTime, unsigned durationInMicroseconds) {
-  // Adjust presentationTime to allow for the data that's still in our buffer:
-  int uSecondsAdjustment
-    = (int)(fInputSampleBufferBytesFull*fMicrosecondsPerByte);
-  presentationTime.tv_sec -= uSecondsAdjustment/MILLION;
-  uSecondsAdjustment %= MILLION;
-  if (presentationTime.tv_usec < uSecondsAdjustment) {
-    --presentationTime.tv_sec;
-    presentationTime.tv_usec += MILLION;
+  source->fEncodingQueue->deliverFrame(source->fTo, source->fMaxSize,
+				       source->fFrameSize, source->fNumTruncatedBytes,
+				       source->fPresentationTime);
+
+  // Move the frame's header (which our RTP sink gets separately) out of its data:
+  if (source->fFrameSize > 0) {
+    source->fLastFrameHeader = source->fTo[0];
+    memmove(source->fTo, &source->fTo[1], --source->fFrameSize);
   }
-  presentationTime.tv_usec -= uSecondsAdjustment;
 
-  // Don't allow the presentation time to decrease:
-  if (presentationTime.tv_sec > fLastInputDataPresentationTime.tv_sec ||
-      (presentationTime.tv_sec == fLastInputDataPresentationTime.tv_sec &&
-       presentationTime.tv_usec > fLastInputDataPresentationTime.tv_usec)) {
-    fLastInputDataPresentationTime = presentationTime;
-  }
-  fInputSampleBufferBytesFull += frameSize;  
+  // Complete delivery to the client:
+  //source->fDurationInMicroseconds = AMR_MICROSECONDS_PER_FRAME;
+  source->fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
+  afterGetting(source);
+}
 
-  // Try again to encode and deliver data to the sink:
-  doGetNextFrame();
+unsigned AMRAudioEncoder
+::encodeFrame(void* encoderData, unsigned char* /*overlap*/, unsigned char* frame,
+	      unsigned char* to, unsigned /*maxSize*/) {
+  // (Note that we may be called from a worker thread.)
+  AMRAudioEncoder* encoder = (AMRAudioEncoder*)encoderData;
+  enum Mode mode = (enum Mode)__sync_fetch_and_add(&encoder->fMode, 0); // an atomic read
+  int frameSize = Encoder_Interface_Encode(encoder->fEncoderState, mode,
+					   (short*)frame, to, 0/*disable DTX*/);
+  return frameSize < 0 ? 0 : (unsigned)frameSize;
 }
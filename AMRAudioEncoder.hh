@@ -24,13 +24,27 @@
 
 #include "AMRAudioSource.hh"
 
+class AudioEncodingQueue;
+
 class AMRAudioEncoder: public AMRAudioSource {
 public:
   static AMRAudioEncoder* createNew(UsageEnvironment& env,
-				    FramedSource* inputPCMSource, unsigned numChannels);
+				    FramedSource* inputPCMSource, unsigned numChannels,
+				    unsigned mode = 7/*MR122*/);
+
+  void setOutputBitrate(unsigned bitrate);
+      // switches (from the next frame) to the highest mode whose bitrate
+      // (in bps) is at most "bitrate" - or to the lowest mode.
+      // (This is our only means of switching mode: it's called by our
+      // "BitrateController", from receivers' RTCP loss reports.  We don't
+      // receive AMR RTP ourselves, so never see a receiver's "CMR".)
+
+  static unsigned bitrateForMode(unsigned mode); // in bps
+  static unsigned modeForBitrate(unsigned bitrate);
 
 protected:
-  AMRAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource, unsigned numChannels);
+  AMRAudioEncoder(UsageEnvironment& env, FramedSource* inputPCMSource,
+		  unsigned numChannels, unsigned mode);
       // called only by createNew()
   virtual ~AMRAudioEncoder();
 
@@ -40,23 +54,17 @@ private:
   virtual void doStopGettingFrames();
 
 private:
-  static void afterGettingFrame(void* clientData, unsigned frameSize,
-                                unsigned numTruncatedBytes,
-                                struct timeval presentationTime,
-                                unsigned durationInMicroseconds);
-  void afterGettingFrame1(unsigned frameSize,
-                          unsigned numTruncatedBytes,
-                          struct timeval presentationTime,
-                          unsigned durationInMicroseconds);
+  static void afterEncoding(void* clientData);
+  static unsigned encodeFrame(void* encoderData,
+			      unsigned char* overlap, unsigned char* frame,
+			      unsigned char* to, unsigned maxSize);
 
 private:
   FramedSource* fInputPCMSource;
   void* fEncoderState;
-  double fMicrosecondsPerByte;
-  unsigned char* fInputSampleBuffer;
-  unsigned fInputSampleBufferSize;
-  unsigned fInputSampleBufferBytesDesired, fInputSampleBufferBytesFull;
-  struct timeval fLastInputDataPresentationTime;
+  AudioEncodingQueue* fEncodingQueue;
+  unsigned fMode; // chosen at startup, or by "setOutputBitrate()";
+      // used (by worker threads) for the next frame
 };
 
 #endif
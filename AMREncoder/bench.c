@@ -0,0 +1,318 @@
+/*
+ * ===================================================================
+ *  TS 26.104
+ *  REL-5 V5.4.0 2004-03
+ *  REL-6 V6.1.0 2004-03
+ *  3GPP AMR Floating-point Speech Codec
+ * ===================================================================
+ *
+ */
+
+/*
+ * bench.c
+ *
+ *
+ * Project:
+ *    AMR Floating-Point Codec
+ *
+ * Contains:
+ *    A per-function benchmark of the encoder's LPC and pitch analysis.
+ *    This file includes sp_enc.c (so that it can name its static
+ *    functions), and "make amrbench" compiles it with
+ *    -finstrument-functions, so that every function call passes
+ *    through the hooks below.  For each of the functions in "timed",
+ *    we report the median time per call, times the number of calls per
+ *    frame - first with the scalar loops, and then with the best SIMD
+ *    kernels that this CPU has.  (The time of a function that calls
+ *    others, e.g. Pitch_ol, includes theirs.)
+ *
+ *    We also report the whole encoder's time per frame, with the hooks
+ *    idle.  Each figure is the best of NUM_RUNS runs.
+ *
+ *    usage: amrbench mode numFrames [pcmFile]
+ *    (mode is 0 (MR475) through 7 (MR122); pcmFile is raw 16-bit
+ *    native-endian 8 kHz speech, otherwise a synthetic voiced signal
+ *    is used)
+ *
+ */
+
+#include "sp_enc.c"
+
+#include <time.h>
+#include "interf_enc.h"
+#include "simd.h"
+
+#define NO_HOOK __attribute__ ( ( no_instrument_function ) )
+
+#define NUM_RUNS 5 /* we report the fastest */
+#define MAX_NS 65536 /* (slower calls are counted as this) */
+#define MAX_DEPTH 16
+
+typedef struct {
+   void *fn;
+   const char *name;
+} TimedFunction;
+
+static const TimedFunction timed[] = {
+   { ( void * )Autocorr, "Autocorr" },
+   { ( void * )Levinson, "Levinson" },
+   { ( void * )Residu2, "Residu2" },
+   { ( void * )Residu3, "Residu3" },
+   { ( void * )Syn_filt2, "Syn_filt2" },
+   { ( void * )Syn_filt3, "Syn_filt3" },
+   { ( void * )comp_corr, "comp_corr" },
+   { ( void * )Lag_max, "Lag_max" },
+   { ( void * )Pitch_ol, "Pitch_ol (incl.)" },
+   { ( void * )Norm_Corr, "Norm_Corr" },
+   { ( void * )Convolve, "Convolve" }
+};
+#define NUM_TIMED ( int )( sizeof( timed ) / sizeof( timed[0] ) )
+
+static int profiling; /* whether the hooks record anything */
+static unsigned int histogram[NUM_TIMED][MAX_NS]; /* calls, by ns */
+static unsigned long numCalls[NUM_TIMED];
+
+/* the timed calls that are in progress: */
+static struct {
+   int index;
+   struct timespec start;
+} stack[MAX_DEPTH];
+static int depth;
+
+static long timerOverhead; /* ns, of a pair of clock_gettime() calls */
+
+static NO_HOOK long nsSince( struct timespec *start )
+{
+   struct timespec now;
+
+   clock_gettime( CLOCK_MONOTONIC, &now );
+   return ( now.tv_sec - start->tv_sec ) * 1000000000L
+         + ( now.tv_nsec - start->tv_nsec );
+}
+
+static NO_HOOK int timedIndex( void *fn )
+{
+   int i;
+
+   for ( i = 0; i < NUM_TIMED; i++ ) {
+      if ( timed[i].fn == fn )
+         return i;
+   }
+   return -1;
+}
+
+void NO_HOOK __cyg_profile_func_enter( void *fn, void *caller )
+{
+   int i;
+
+   if ( !profiling || ( i = timedIndex( fn ) ) < 0 || depth == MAX_DEPTH )
+      return;
+   stack[depth].index = i;
+   clock_gettime( CLOCK_MONOTONIC, &stack[depth++].start );
+}
+
+void NO_HOOK __cyg_profile_func_exit( void *fn, void *caller )
+{
+   long ns;
+   int i;
+
+   if ( !profiling || depth == 0 || stack[depth - 1].index != ( i = timedIndex( fn ) ) )
+      return;
+   ns = nsSince( &stack[--depth].start ) - timerOverhead;
+   ns = ns < 0 ? 0 : ns < MAX_NS ? ns : MAX_NS - 1;
+   histogram[i][ns]++;
+   numCalls[i]++;
+}
+
+/*
+ * makeInput
+ *
+ *
+ * Parameters:
+ *    fileName          I: raw PCM to read, or NULL
+ *    numSamples        I: how many samples
+ *
+ * Function:
+ *    Reads "fileName" (padding it with silence), or else generates a
+ *    voiced signal: a harmonic tone with a wandering pitch and level,
+ *    a little noise, and the 13-bit resolution of real input
+ *
+ * Returns:
+ *    the samples (to be freed)
+ */
+static NO_HOOK short *makeInput( const char *fileName, long numSamples )
+{
+   short *pcm = ( short * )calloc( numSamples, sizeof( short ) );
+   unsigned int seed = 12345;
+   double phase = 0, phase2 = 0;
+   long i;
+
+   if ( fileName != NULL ) {
+      FILE *fid = fopen( fileName, "rb" );
+
+      if ( fid == NULL ) {
+         perror( fileName );
+         exit( 1 );
+      }
+      if ( fread( pcm, sizeof( short ), numSamples, fid ) < ( size_t )numSamples )
+         fprintf( stderr, "%s is short; padding it with silence\n", fileName );
+      fclose( fid );
+      return pcm;
+   }
+
+   for ( i = 0; i < numSamples; i++ ) {
+      double noise, level, f0, x;
+
+      seed = seed * 1103515245 + 12345;
+      noise = ( ( seed >> 16 ) & 0x7fff ) / 32768.0 - 0.5;
+      level = 0.5 + 0.5 * sin( i * 0.002 );
+      f0 = 140 * ( 1 + 0.2 * sin( i * 0.0007 ) );
+      x = level * ( 0.35 * sin( phase ) + 0.15 * sin( 2 * phase ) + 0.1 * sin( 3 * phase )
+            + 0.08 * sin( phase2 ) ) + 0.02 * noise;
+      phase += 2 * M_PI * f0 / 8000;
+      phase2 += 2 * M_PI * 1100 / 8000;
+      pcm[i] = ( short )( ( short )( x * 32767 * 0.8 ) & 0xfff8 );
+   }
+   return pcm;
+}
+
+/*
+ * encode
+ *
+ *
+ * Parameters:
+ *    mode              I: AMR mode
+ *    pcm               I: numFrames frames of input
+ *    numFrames         I: how many frames
+ *
+ * Function:
+ *    Encodes the input with a new encoder
+ *
+ * Returns:
+ *    the time taken, in ns per frame
+ */
+static NO_HOOK double encode( enum Mode mode, short *pcm, int numFrames )
+{
+   void *st = Encoder_Interface_init( 0 );
+   unsigned char out[32];
+   struct timespec start;
+   double ns;
+   int f;
+
+   clock_gettime( CLOCK_MONOTONIC, &start );
+   for ( f = 0; f < numFrames; f++ )
+      Encoder_Interface_Encode( st, mode, pcm + f * L_FRAME, out, 0 );
+   ns = ( double )nsSince( &start ) / numFrames;
+   Encoder_Interface_exit( st );
+   return ns;
+}
+
+/*
+ * profile
+ *
+ *
+ * Parameters:
+ *    mode              I: AMR mode
+ *    pcm               I: numFrames frames of input
+ *    numFrames         I: how many frames
+ *    usPerFrame        O: for each timed function, its (best) cost
+ *    callsPerFrame     O: for each timed function, its calls per frame
+ *
+ * Function:
+ *    Runs the encoder NUM_RUNS times with the hooks on, and once more
+ *    with them idle
+ *
+ * Returns:
+ *    the whole encoder's (best) time per frame, in us
+ */
+static NO_HOOK double profile( enum Mode mode, short *pcm, int numFrames,
+      double usPerFrame[], double callsPerFrame[] )
+{
+   double best = 0;
+   int run, i, ns;
+
+   for ( i = 0; i < NUM_TIMED; i++ )
+      usPerFrame[i] = -1;
+
+   for ( run = 0; run < NUM_RUNS; run++ ) {
+      double t;
+
+      memset( histogram, 0, sizeof( histogram ) );
+      memset( numCalls, 0, sizeof( numCalls ) );
+      depth = 0;
+      profiling = 1;
+      encode( mode, pcm, numFrames );
+      profiling = 0;
+
+      for ( i = 0; i < NUM_TIMED; i++ ) {
+         unsigned long count = 0;
+         double us;
+
+         for ( ns = 0; ns < MAX_NS - 1; ns++ ) {
+            count += histogram[i][ns];
+            if ( 2 * count >= numCalls[i] )
+               break;
+         }
+         us = ns / 1000.0 * numCalls[i] / numFrames;
+         if ( usPerFrame[i] < 0 || us < usPerFrame[i] )
+            usPerFrame[i] = us;
+         callsPerFrame[i] = ( double )numCalls[i] / numFrames;
+      }
+
+      t = encode( mode, pcm, numFrames ) / 1000;
+      if ( run == 0 || t < best )
+         best = t;
+   }
+   return best;
+}
+
+
+int main( int argc, char *argv[] )
+{
+   static const char *modeName[] = { "MR475", "MR515", "MR59", "MR67", "MR74",
+         "MR795", "MR102", "MR122" };
+   double scalarUs[NUM_TIMED], simdUs[NUM_TIMED], calls[NUM_TIMED];
+   double scalarTotal, simdTotal;
+   int mode, numFrames, simdLevel, i;
+   short *pcm;
+   struct timespec start;
+
+   if ( argc != 3 && argc != 4 ) {
+      fprintf( stderr, "usage: %s mode numFrames [pcmFile]\n", argv[0] );
+      return 1;
+   }
+   mode = atoi( argv[1] );
+   numFrames = atoi( argv[2] );
+   if ( mode < MR475 || mode > MR122 || numFrames < 1 ) {
+      fprintf( stderr, "usage: %s mode numFrames [pcmFile]\n", argv[0] );
+      return 1;
+   }
+   pcm = makeInput( argc == 4 ? argv[3] : NULL, ( long )numFrames * L_FRAME );
+
+   timerOverhead = MAX_NS;
+   for ( i = 0; i < 1000; i++ ) {
+      long ns;
+
+      clock_gettime( CLOCK_MONOTONIC, &start );
+      if ( ( ns = nsSince( &start ) ) < timerOverhead )
+         timerOverhead = ns;
+   }
+
+   amr_simd_setup( AMR_SIMD_NONE );
+   scalarTotal = profile( ( enum Mode )mode, pcm, numFrames, scalarUs, calls );
+   simdLevel = amr_simd_setup( AMR_SIMD_BEST );
+   simdTotal = profile( ( enum Mode )mode, pcm, numFrames, simdUs, calls );
+
+   printf( "%s, %d frames: us per 20 ms frame (median per call x calls per frame)\n",
+         modeName[mode], numFrames );
+   printf( "%-18s %8s %8s %8s\n", "", "calls", "scalar", simdLevel == AMR_SIMD_256 ?
+         "AVX2" : simdLevel == AMR_SIMD_128 ? "NEON" : "(none)" );
+   for ( i = 0; i < NUM_TIMED; i++ ) {
+      if ( calls[i] > 0 )
+         printf( "%-18s %8.1f %8.1f %8.1f\n", timed[i].name, calls[i], scalarUs[i], simdUs[i] );
+   }
+   printf( "%-18s %8s %8.1f %8.1f\n", "whole encoder", "", scalarTotal, simdTotal );
+
+   free( pcm );
+   return 0;
+}
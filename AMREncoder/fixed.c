@@ -26,6 +26,8 @@
 #include <sys/types.h>
 #ifdef WIN32
 #include <winsock.h>
+#else
+#include <pthread.h>
 #endif
 #include "fixed.h"
 
@@ -33,20 +35,20 @@
 #ifdef FIXED_POINT
 
 /* lookup tables */
-extern real_32_t fixed_table_log[FIXED_SAMPLES+1];
-extern real_32_t fixed_table_sqrt[FIXED_SAMPLES+1];
-extern real_32_t fixed_table_pow[FIXED_SAMPLES+1];
-extern real_t fixed_table_pow34[FIXED_SAMPLES_POW34+1];
-extern real_32_t fixed_table_log2[64+1];
-extern fftfloat fixed_fft_costbl[1<<(FIXED_FFT_LOGM-1)];
-extern fftfloat fixed_fft_negsintbl[1<<(FIXED_FFT_LOGM-1)];
-extern real_32_t fixed_fft_cosx[FIXED_FFT_SINCOS_SIZE];
-extern real_32_t fixed_fft_sinx[FIXED_FFT_SINCOS_SIZE];
-extern frac_t fixed_table_cos[FIXED_SAMPLES+1];
-extern real_t fixed_table_acos[FIXED_SAMPLES+1];
-extern frac_t fixed_table_cos_pi_div_4k[FIXED_SAMPLES+1];
-
-static real_t maxx=0,maxy=0;
+extern FIXED_TABLE real_t fixed_table_log[FIXED_SAMPLES+1];
+extern FIXED_TABLE real_t fixed_table_sqrt[FIXED_SAMPLES+1];
+extern FIXED_TABLE real_t fixed_table_pow[FIXED_SAMPLES+1];
+extern FIXED_TABLE real_t fixed_table_pow34[FIXED_SAMPLES_POW34+1];
+extern FIXED_TABLE real_t fixed_table_log2[64+1];
+extern FIXED_TABLE fftfloat fixed_fft_costbl[1<<(FIXED_FFT_LOGM-1)];
+extern FIXED_TABLE fftfloat fixed_fft_negsintbl[1<<(FIXED_FFT_LOGM-1)];
+extern FIXED_TABLE real_32_t fixed_fft_cosx[FIXED_FFT_SINCOS_SIZE];
+extern FIXED_TABLE real_32_t fixed_fft_sinx[FIXED_FFT_SINCOS_SIZE];
+extern FIXED_TABLE frac_t fixed_table_cos[FIXED_SAMPLES+1];
+extern FIXED_TABLE real_t fixed_table_acos[FIXED_SAMPLES+1];
+extern FIXED_TABLE frac_t fixed_table_cos_pi_div_4k[FIXED_SAMPLES+1];
+
+static const real_t maxx=0,maxy=0;
 
 #ifdef FIXED_DEBUG
 void fixed_debug(const char *fmt, ...)
@@ -76,8 +78,8 @@ INLINE real_t fixed_sqrt(real_t x)
 {
     real_t y;
     int32_t n=0;
-    static real_t realconst1 = REAL_CONST(0.1);
-    static real_t realconst2 = FIXED_POW34_MAXSAMPLE;
+    static const real_t realconst1 = REAL_CONST(0.1);
+    static const real_t realconst2 = FIXED_POW34_MAXSAMPLE;
 #ifdef FIXED_LAGRANGE
     int32_t i;
 #endif
@@ -125,8 +127,8 @@ INLINE real_t fixed_log(real_t x)
 {
     real_t y;
     int32_t n=0;
-    static real_t realconst1 = REAL_CONST(0.1);
-    static real_t realconst2 = REAL_ICONST(1) ;
+    static const real_t realconst1 = REAL_CONST(0.1);
+    static const real_t realconst2 = REAL_ICONST(1) ;
 #ifdef FIXED_LAGRANGE
     int32_t i;
 #endif
@@ -166,7 +168,7 @@ INLINE real_t fixed_log(real_t x)
 
 INLINE real_t fixed_log10(real_t x)
 {
-    static real_t log10 = REAL_CONST(2.3025850930);
+    static const real_t log10 = REAL_CONST(2.3025850930);
 
     return DIV_R(fixed_log(x),log10);
 }
@@ -179,8 +181,8 @@ INLINE real_t fixed_pow(real_t x, real_t y)
     real_t zf;
     int32_t neg=0;
     real_t y1;
-    static real_32_t log2 = REAL_CONST(0.6931471806);
-    static real_t realconst1 = REAL_ICONST(1) ;
+    static const real_32_t log2 = REAL_CONST(0.6931471806);
+    static const real_t realconst1 = REAL_ICONST(1) ;
 #ifdef FIXED_LAGRANGE
     int32_t i;
 #endif
@@ -265,8 +267,11 @@ INLINE real_t fixed_pow34(real_t x)
 {
     register real_t y;
     register int32_t n=0;
-    static real_t realconst1 = REAL_ICONST(FIXED_POW34_MAXSAMPLE)>>4;
-    static real_t realconst2 = REAL_ICONST(FIXED_POW34_MAXSAMPLE);
+    static const real_t realconst1 = REAL_ICONST(FIXED_POW34_MAXSAMPLE)>>4;
+    static const real_t realconst2 = REAL_ICONST(FIXED_POW34_MAXSAMPLE);
+#ifdef FIXED_LAGRANGE
+    int32_t i;
+#endif
 
 #ifdef FIXED_DEBUG_POW34
     printf("fixed_pow34: x = %.8f, pow34(x) = %.8f",
@@ -282,16 +287,23 @@ INLINE real_t fixed_pow34(real_t x)
             n-=3;
         }
     
-        while (x>realconst2) {
+        while (x>=realconst2) {
             x = x>>4;
             n+=3;
         }
-    
+
+#ifdef FIXED_LAGRANGE
+        i = (int32_t)(x>>FIXED_POW34_REALCONST2);
+        y = fixed_table_pow34[i] +
+            (((fixed_table_pow34[i+1]-fixed_table_pow34[i])*(x&((1<<FIXED_POW34_REALCONST2)-1)))>>FIXED_POW34_REALCONST2);
+#else
+        y = fixed_table_pow34[FIXED_POW34_INDEX(x)];
+#endif
         if ( n > 0 )
-            y = (fixed_table_pow34[FIXED_POW34_INDEX(x)])<<n;
+            y = y<<n;
         else {
             n = -n;
-            y = (fixed_table_pow34[FIXED_POW34_INDEX(x)])>>n;
+            y = y>>n;
         }
     }
     else
@@ -304,17 +316,28 @@ INLINE real_t fixed_pow34(real_t x)
     return y;
 }
 
-/* -1<=x<=1, 0<=y<=PI */
+/* -1<=x<=1, y=acos(x)*4000/PI, 0<=y<=4000 */
 INLINE real_t fixed_acos(real_t x)
 {
     register real_t y;
+    real_t t;
     int32_t i;
+    static const real_t realconst1 = REAL_CONST(0.0625);
+    static const real_t realconst2 = REAL_CONST(4000/FIXED_M_PI_F);
 
     if ( (x<REAL_ICONST(-1)) || (x>REAL_ICONST(1)) ) {
         printf("fixed_acos overflow: x = %.8f\n",REAL2FLOAT(x));
         return (REAL_ICONST(-1));
     }
 
+    /* Too steep to interpolate near -1 and 1, where
+       acos(1-t) = sqrt(2t)*(1+t/12+3t^2/160+...) */
+    t = REAL_ICONST(1)-((x<0)?-x:x);
+    if ( t<realconst1 ) {
+        y = MUL_R(fixed_sqrt(t<<1),MUL_R(realconst2,REAL_ICONST(1)+t/12+MUL_R(t,t)*3/160));
+        return (x<0)?REAL_ICONST(4000)-y:y;
+    }
+
     x += REAL_ICONST(1);
 
     i = x>>(REAL2SAMPLE_BIT+1);
@@ -355,9 +378,9 @@ INLINE real_t fixed_frexp(int32_t x, int32_t *exp)
     return frac;
 }
 
-void fixed_fixed_init()
-{
 #ifdef FIXED_RUNTIME_TABLE
+static void fixed_make_tables(void)
+{
     register int32_t i;
     real_t ln2 = REAL_CONST(0.69314718);
     double step;
@@ -380,8 +403,8 @@ void fixed_fixed_init()
     }
 
     step = ((double)FIXED_POW34_MAXSAMPLE)/FIXED_SAMPLES_POW34;
-    for (i=0;i<=FIXED_SAMPLES_POW34;i+=step) {
-        fixed_table_pow34[i]=REAL_CONST(pow((double)i,0.75));
+    for (i=0;i<=FIXED_SAMPLES_POW34;i++) {
+        fixed_table_pow34[i]=REAL_CONST(pow(i*step,0.75));
     }
 
     for (i=1;i <= 64;i++) {
@@ -414,15 +437,37 @@ void fixed_fixed_init()
         fixed_table_cos[i]=FRAC_CONST(cos((double)8*i/FIXED_SAMPLES));
     }
 
-    /* Make runtime table for y=acos(x) */
+    /* Make runtime table for y=acos(x)*4000/PI */
     for (i=0;i<=FIXED_SAMPLES;i++) {
-        fixed_table_acos[i]=REAL_CONST(acos((double)(i<<1)/FIXED_SAMPLES-1));
+        fixed_table_acos[i]=REAL_CONST(acos((double)(i<<1)/FIXED_SAMPLES-1)*4000/FIXED_M_PI_F);
     }
 
     /* Make runtime table for y=cos_pi_div_4000(x) */
     for (i=0;i<=FIXED_SAMPLES;i++) {
         fixed_table_cos_pi_div_4k[i]=FRAC_CONST(cos((double)2*FIXED_M_PI_F*i/FIXED_SAMPLES));
     }
+}
+#endif
+
+void fixed_fixed_init()
+{
+#ifdef FIXED_RUNTIME_TABLE
+#ifdef WIN32
+    /* 0: not yet, 1: being built (by another thread), 2: done */
+    static volatile long tables_built = 0;
+
+    if (InterlockedCompareExchange(&tables_built, 1, 0) == 0) {
+        fixed_make_tables();
+        InterlockedExchange(&tables_built, 2);
+    } else {
+        while (tables_built != 2)
+            Sleep(0);
+    }
+#else
+    static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&tables_once, fixed_make_tables);
+#endif
 #endif
 }
 
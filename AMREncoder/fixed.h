@@ -56,6 +56,14 @@ extern "C" {
 /* define FIXED_RUNTIME_TABLE to generate lookup table at runtime when initializing */
 //#define FIXED_RUNTIME_TABLE  1
 
+/* the lookup tables are read-only, unless they're generated at runtime (once,
+   by fixed_fixed_init(), for all encoders) */
+#ifdef FIXED_RUNTIME_TABLE
+#define FIXED_TABLE
+#else
+#define FIXED_TABLE const
+#endif
+
 /* define FIXED_STATIC_MEMORY to use static memory instead dynamic memory */
 //#define FIXED_STATIC_MEMORY 1
 
@@ -180,17 +188,20 @@ typedef int32_t fftfloat;
 #define FRAC_ICONST(A)  ((frac_t)(A)<<FRAC_BITS)
 #define FRAC2FLOAT(A) (((float)(A))/(FRAC_PRECISION))
 
-#define SAMPLE_BITS    14
+/* 1024 samples per table (8 KB), interpolated by FIXED_LAGRANGE: log() and
+   cos_pi_div_4k() stay within 5 LSBs of REAL_BITS, sqrt() within 2e-4 of its
+   value, and acos(), which takes a series near +-1, within 0.05 of 0..4000 */
+#define SAMPLE_BITS    10
 #define FIXED_SAMPLES    (1<<SAMPLE_BITS)
 #define REAL2SAMPLE_BIT (REAL_BITS-SAMPLE_BITS) // should > 0
 
 /* pow34(x) */
-#define POW34_SAMPLE_BIT      14
+#define POW34_SAMPLE_BIT      10
 #define FIXED_SAMPLES_POW34    (1<<POW34_SAMPLE_BIT)
 #define POW34_SCALE_BIT       14
 #define FIXED_POW34_MAXSAMPLE  (1<<POW34_SCALE_BIT)
 #define FIXED_POW34_REALCONST1 ((1<<REAL_BITS)>>1) //REAL_CONST(0.5)
-#define FIXED_POW34_REALCONST2 (REAL_BITS+POW34_SCALE_BIT-SAMPLE_BITS)
+#define FIXED_POW34_REALCONST2 (REAL_BITS+POW34_SCALE_BIT-POW34_SAMPLE_BIT)
 #define FIXED_POW34_INDEX(x)   ((x+FIXED_POW34_REALCONST1)>>FIXED_POW34_REALCONST2)
 
 /* fixed-point operations */
@@ -253,10 +264,10 @@ typedef double fftfloat;
 /* fft */
 #define FIXED_FFT_LOGM   9
 #define FIXED_FFT_SINCOS_SIZE     512
-extern fftfloat fixed_fft_costbl[1<<(FIXED_FFT_LOGM-1)];
-extern fftfloat fixed_fft_negsintbl[1<<(FIXED_FFT_LOGM-1)];
-extern real_32_t fixed_fft_cosx[FIXED_FFT_SINCOS_SIZE];
-extern real_32_t fixed_fft_sinx[FIXED_FFT_SINCOS_SIZE];
+extern FIXED_TABLE fftfloat fixed_fft_costbl[1<<(FIXED_FFT_LOGM-1)];
+extern FIXED_TABLE fftfloat fixed_fft_negsintbl[1<<(FIXED_FFT_LOGM-1)];
+extern FIXED_TABLE real_32_t fixed_fft_cosx[FIXED_FFT_SINCOS_SIZE];
+extern FIXED_TABLE real_32_t fixed_fft_sinx[FIXED_FFT_SINCOS_SIZE];
 
 /* definination for PI */
 #define FIXED_M_PI      REAL_CONST(3.14159265358979323846)
@@ -264,6 +275,7 @@ extern real_32_t fixed_fft_sinx[FIXED_FFT_SINCOS_SIZE];
 #define FIXED_M_PI_F    (3.14159265358979323846)
 #define FIXED_TWOPI_F   (FIXED_M_PI_F*2)
 
+/* builds the lookup tables if FIXED_RUNTIME_TABLE; safe to call from any thread */
 extern void fixed_fixed_init();
 extern void fixed_fixed_exit();
 
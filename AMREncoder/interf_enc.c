@@ -31,7 +31,7 @@
 #include "interf_rom.h"
 
 /* Subjective importance of the speech encoded bits */
-static Word16 order_MR475[] =
+static const Word16 order_MR475[] =
 {
    0, 0x80,
    0, 0x40,
@@ -129,7 +129,7 @@ static Word16 order_MR475[] =
    11, 0x40,
    15, 0x40
 };
-static Word16 order_MR515[] =
+static const Word16 order_MR515[] =
 {
    0, 0x1,
    0, 0x2,
@@ -235,7 +235,7 @@ static Word16 order_MR515[] =
    12, 0x8,
    16, 0x8
 };
-static Word16 order_MR59[] =
+static const Word16 order_MR59[] =
 {
    0, 0x80,
    0, 0x40,
@@ -356,7 +356,7 @@ static Word16 order_MR59[] =
    12, 0x20,
    16, 0x20
 };
-static Word16 order_MR67[] =
+static const Word16 order_MR67[] =
 {
    0, 0x80,
    0, 0x40,
@@ -493,7 +493,7 @@ static Word16 order_MR67[] =
    12, 0x100,
    16, 0x100
 };
-static Word16 order_MR74[] =
+static const Word16 order_MR74[] =
 {
    0, 0x80,
    0, 0x40,
@@ -644,7 +644,7 @@ static Word16 order_MR74[] =
    12, 0x40,
    16, 0x40
 };
-static Word16 order_MR795[] =
+static const Word16 order_MR795[] =
 {
    0, 0x1,
    0, 0x2,
@@ -965,7 +965,7 @@ static Word16 order_MR795[] =
    14, 0x200,
    19, 0x200
 };
-static Word16 order_MR102[] =
+static const Word16 order_MR102[] =
 {
    0, 0x1,
    0, 0x2,
@@ -1172,7 +1172,7 @@ static Word16 order_MR102[] =
    9, 0x4,
    9, 0x2
 };
-static Word16 order_MR122[] =
+static const Word16 order_MR122[] =
 {
    0, 0x40,
    0, 0x20,
@@ -1419,7 +1419,7 @@ static Word16 order_MR122[] =
    18, 0x1,
    44, 0x1
 };
-static Word16 order_MRDTX[] =
+static const Word16 order_MRDTX[] =
 {
    0, 0x4,
    0, 0x2,
@@ -1481,6 +1481,7 @@ typedef struct
    Word32 dtx;
    enum TXFrameType prev_ft;   /* Type of the previous frame */
    void *encoderState;   /* Points encoder state structure */
+   Word32 headerByte;   /* Include the frame header (TOC) byte in the output */
 } enc_interface_State;
 
 
@@ -1620,6 +1621,7 @@ static void Prm2Bits( enum Mode mode, Word16 prm[], Word16 bits[] )
  *    stream               O: packed speech frame
  *    frame_type           I: frame type (DTX)
  *    speech_mode          I: speech mode (DTX)
+ *    header_byte          I: include the frame header byte
  *
  * Function:
  *    Pack encoder output parameters to octet structure according
@@ -1628,17 +1630,16 @@ static void Prm2Bits( enum Mode mode, Word16 prm[], Word16 bits[] )
  * Returns:
  *    number of octets
  */
-int EncoderIncludeHeaderByte = 1;
 static int EncoderMMS( enum Mode mode, Word16 *param, UWord8 *stream, enum
-      TXFrameType frame_type, enum Mode speech_mode )
+      TXFrameType frame_type, enum Mode speech_mode, Word32 header_byte )
 {
    Word32 j = 0, k;
-   Word16 *mask;
-   int resultFrameSize = block_size[mode] - !EncoderIncludeHeaderByte;
+   const Word16 *mask;
+   int resultFrameSize = block_size[mode] - !header_byte;
 
    memset(stream, 0, resultFrameSize);
 
-   if (EncoderIncludeHeaderByte) {
+   if (header_byte) {
      *stream = toc_byte[mode];
      stream++;
    }
@@ -1816,7 +1817,7 @@ static int Encoder3GPP( enum Mode mode, Word16 *param, UWord8 *stream, enum
       TXFrameType frame_type, enum Mode speech_mode )
 {
    Word32 j = 0;
-   Word16 *mask;
+   const Word16 *mask;
 
    memset(stream, 0, block_size[mode]);
 
@@ -2162,7 +2163,7 @@ int Encoder_Interface_Encode( void *st, enum Mode mode, Word16 *speech,
    return Encoder3GPP( used_mode, prm, serial, txFrameType, mode );
 
 #else
-   return EncoderMMS( used_mode, prm, serial, txFrameType, mode );
+   return EncoderMMS( used_mode, prm, serial, txFrameType, mode, s->headerByte );
 
 #endif
 #else
@@ -2203,10 +2204,32 @@ void * Encoder_Interface_init( int dtx )
    s->encoderState = Speech_Encode_Frame_init( dtx );
    Sid_Sync_reset( s );
    s->dtx = dtx;
+   s->headerByte = 1;
    return s;
 }
 
 
+/*
+ * Encoder_Interface_setHeaderByte
+ *
+ *
+ * Parameters:
+ *    state             I: state structure
+ *    header_byte       I: include the frame header byte
+ *
+ * Function:
+ *    Selects whether the packed frames (in the RFC 3267 storage format)
+ *    start with their frame header byte.  The default is to include it.
+ *
+ * Returns:
+ *    Void
+ */
+void Encoder_Interface_setHeaderByte( void *state, int header_byte )
+{
+   ( ( enc_interface_State * )state )->headerByte = header_byte;
+}
+
+
 /*
  * DecoderInterfaceExit
  *
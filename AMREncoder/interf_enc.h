@@ -51,6 +51,11 @@ int Encoder_Interface_Encode( void *st, enum Mode mode, short *speech,
  */
 void *Encoder_Interface_init( int dtx );
 
+/*
+ * Include (default) or omit the frame header byte
+ */
+void Encoder_Interface_setHeaderByte( void *state, int header_byte );
+
 /*
  * Exit and free memory
  */
@@ -146,8 +146,7 @@
 #define CVAD_ADAPT_REALLY_FAST 1.0F - 0.80F  /* threshold for really fast adaption */
 
 /* track table for algebraic code book search (MR475, MR515) */
-#if 0
-static Word8 trackTable[4 * 5] =
+static const Word16 trackTable[4 * 5] =
    {
       /* subframe 1; track to code; -1 do not code this position */ 0,
       1,
@@ -170,7 +169,6 @@ static Word8 trackTable[4 * 5] =
       0,
       1
    };
-#endif
 
 static const real_t gamma1[M] =
 {
@@ -600,7 +598,7 @@ static const real_t b24[UP_SAMP_MAX*L_INTER_SRCH+1] =
  * lagwindow[i] =  exp( -0.5*(2*pi*F0*(i+1)/Fs)^2 ); i = 0,...,9
  * F0 = 60 Hz, Fs = 8000 Hz
  */
-static real_32_t lag_wind[M] =
+static const real_32_t lag_wind[M] =
 {
    REAL_CONST(0.99889028F),
    REAL_CONST(0.99556851F),
@@ -5133,520 +5131,520 @@ static const real_32_t dico3_lsf_3[] =
 #define MR515_3_SIZE  128
 
 /* third codebook for MR475, MR515 */
-static const Float32 mr515_3_lsf[] =
+static const real_32_t mr515_3_lsf[] =
 {
-   102.295F,
-   39.7949F,
-   -7.32422F,
-   -63.9648F,
-   -111.084F,
-   -192.627F,
-   -349.121F,
-   -176.025F,
-   245.605F,
-   162.109F,
-   65.6738F,
-   6.10352F,
-   151.123F,
-   63.4766F,
-   44.6777F,
-   23.4375F,
-   -236.328F,
-   -331.543F,
-   -94.7266F,
-   32.9590F,
-   -169.189F,
-   203.857F,
-   111.328F,
-   37.5977F,
-   269.775F,
-   171.631F,
-   138.916F,
-   88.6230F,
-   396.729F,
-   323.730F,
-   240.479F,
-   182.617F,
-   -53.7109F,
-   53.4668F,
-   18.5547F,
-   -50.7813F,
-   -355.225F,
-   -405.762F,
-   11.9629F,
-   36.3770F,
-   -235.352F,
-   -41.9922F,
-   -183.594F,
-   -82.0313F,
-   152.588F,
-   51.0254F,
-   -61.0352F,
-   -16.1133F,
-   -248.291F,
-   -204.590F,
-   -0.488281F,
-   77.3926F,
-   -529.297F,
-   -362.549F,
-   -33.6914F,
-   30.0293F,
-   -458.008F,
-   -512.451F,
-   -127.197F,
-   20.7520F,
-   -236.084F,
-   -89.3555F,
-   -169.678F,
-   -215.088F,
-   -224.854F,
-   -246.826F,
-   -186.279F,
-   -231.689F,
-   -30.2734F,
-   -62.5000F,
-   -85.9375F,
-   -161.133F,
-   43.4570F,
-   113.037F,
-   86.4258F,
-   74.2188F,
-   -425.781F,
-   -144.287F,
-   -68.8477F,
-   19.2871F,
-   -549.072F,
-   42.7246F,
-   211.670F,
-   121.826F,
-   -33.6914F,
-   -43.9453F,
-   -44.1895F,
-   -5.12695F,
-   -559.326F,
-   -302.979F,
-   -112.305F,
-   -126.953F,
-   -188.232F,
-   110.107F,
-   -2.44141F,
-   -75.1953F,
-   66.1621F,
-   -15.8691F,
-   0.976563F,
-   52.2461F,
-   -68.1152F,
-   -106.201F,
-   -10.4980F,
-   -84.9609F,
-   -163.574F,
-   8.54492F,
-   -15.8691F,
-   -51.5137F,
-   196.777F,
-   130.615F,
-   20.7520F,
-   72.5098F,
-   13.9160F,
-   58.3496F,
-   176.270F,
-   120.361F,
-   54.9316F,
-   161.377F,
-   205.078F,
-   133.545F,
-   -131.836F,
-   -91.7969F,
-   3.41797F,
-   85.2051F,
-   114.502F,
-   176.025F,
-   80.8105F,
-   39.5508F,
-   -132.813F,
-   -183.594F,
-   -15.1367F,
-   -2.44141F,
-   97.1680F,
-   -21.4844F,
-   176.758F,
-   171.143F,
-   -4.63867F,
-   -130.127F,
-   -22.9492F,
-   146.729F,
-   33.2031F,
-   -17.3340F,
-   -166.260F,
-   -182.373F,
-   -40.5273F,
-   -83.9844F,
-   63.7207F,
-   -12.2070F,
-   39.3066F,
-   -12.6953F,
-   118.408F,
-   82.2754F,
-   -408.936F,
-   12.2070F,
-   46.3867F,
-   -22.7051F,
-   -557.129F,
-   -56.3965F,
-   -47.3633F,
-   -20.0195F,
-   -23.1934F,
-   -145.264F,
-   -37.5977F,
-   31.2500F,
-   218.262F,
-   122.314F,
-   143.555F,
-   111.572F,
-   -84.2285F,
-   50.2930F,
-   29.7852F,
-   26.8555F,
-   -154.053F,
-   -55.4199F,
-   -138.916F,
-   0.732422F,
-   99.6094F,
-   58.3496F,
-   96.9238F,
-   55.1758F,
-   -48.0957F,
-   -0.488281F,
-   31.2500F,
-   119.873F,
-   312.744F,
-   220.703F,
-   71.2891F,
-   52.4902F,
-   131.348F,
-   74.7070F,
-   63.2324F,
-   124.268F,
-   -165.283F,
-   -255.615F,
-   3.17383F,
-   78.3691F,
-   -165.771F,
-   -143.555F,
-   -87.4023F,
-   -51.7578F,
-   -136.230F,
-   59.3262F,
-   157.715F,
-   116.943F,
-   118.652F,
-   83.4961F,
-   154.785F,
-   129.883F,
-   26.1230F,
-   195.801F,
-   80.8105F,
-   33.2031F,
-   -27.3438F,
-   -97.1680F,
-   -251.709F,
-   -69.8242F,
-   -79.5898F,
-   -172.119F,
-   70.3125F,
-   66.4063F,
-   317.139F,
-   279.297F,
-   287.598F,
-   209.961F,
-   -103.271F,
-   29.5410F,
-   -93.9941F,
-   -36.1328F,
-   -72.0215F,
-   -73.7305F,
-   -203.613F,
-   -199.951F,
-   3.90625F,
-   -5.85938F,
-   -49.0723F,
-   -116.211F,
-   135.498F,
-   22.2168F,
-   -59.8145F,
-   71.7773F,
-   -9.27734F,
-   -92.5293F,
-   -234.863F,
-   -298.096F,
-   -290.771F,
-   -370.605F,
-   -66.6504F,
-   -96.4355F,
-   -95.2148F,
-   -247.314F,
-   -157.471F,
-   139.893F,
-   -449.951F,
-   -251.465F,
-   123.291F,
-   114.258F,
-   181.641F,
-   231.201F,
-   148.682F,
-   120.361F,
-   -168.213F,
-   -286.133F,
-   -153.320F,
-   -32.9590F,
-   -250.488F,
-   47.6074F,
-   100.342F,
-   47.8516F,
-   386.230F,
-   280.029F,
-   140.381F,
-   82.2754F,
-   -302.490F,
-   -189.697F,
-   -158.203F,
-   -34.6680F,
-   145.264F,
-   201.416F,
-   236.084F,
-   179.443F,
-   -294.434F,
-   -236.816F,
-   -19.7754F,
-   -83.4961F,
-   -181.885F,
-   3.17383F,
-   -17.5781F,
-   91.5527F,
-   110.840F,
-   4.63867F,
-   343.506F,
-   224.854F,
-   -402.100F,
-   -41.9922F,
-   210.205F,
-   137.207F,
-   226.563F,
-   375.244F,
-   259.521F,
-   180.664F,
-   -603.516F,
-   -232.422F,
-   64.4531F,
-   20.0195F,
-   -122.559F,
-   -235.596F,
-   -325.684F,
-   30.0293F,
-   211.670F,
-   301.758F,
-   130.371F,
-   41.7480F,
-   -566.406F,
-   -112.305F,
-   190.430F,
-   88.6230F,
-   -290.527F,
-   -150.635F,
-   61.5234F,
-   -14.8926F,
-   -42.4805F,
-   8.30078F,
-   246.826F,
-   192.383F,
-   -569.580F,
-   60.3027F,
-   103.271F,
-   37.3535F,
-   -3.90625F,
-   -86.6699F,
-   63.9648F,
-   109.619F,
-   -384.766F,
-   -261.963F,
-   -132.813F,
-   -90.5762F,
-   -150.146F,
-   -74.4629F,
-   256.592F,
-   196.533F,
-   167.725F,
-   128.906F,
-   1.46484F,
-   -44.4336F,
-   228.271F,
-   213.623F,
-   244.629F,
-   197.510F,
-   48.5840F,
-   62.7441F,
-   30.7617F,
-   18.5547F,
-   -142.578F,
-   -277.832F,
-   146.240F,
-   135.742F,
-   -269.775F,
-   -339.600F,
-   -388.428F,
-   -126.709F,
-   -238.525F,
-   -323.486F,
-   26.3672F,
-   84.7168F,
-   -176.270F,
-   -238.037F,
-   89.1113F,
-   24.6582F,
-   -35.4004F,
-   166.260F,
-   60.7910F,
-   -37.3535F,
-   0.000000F,
-   -81.5430F,
-   -139.160F,
-   38.8184F,
-   100.586F,
-   69.5801F,
-   -82.0313F,
-   -150.635F,
-   -232.666F,
-   -235.840F,
-   216.553F,
-   168.213F,
-   -305.420F,
-   20.5078F,
-   -45.1660F,
-   -97.1680F,
-   -144.531F,
-   105.713F,
-   254.883F,
-   159.424F,
-   20.7520F,
-   80.3223F,
-   -9.76563F,
-   88.1348F,
-   -105.713F,
-   -172.119F,
-   113.770F,
-   140.137F,
-   -37.5977F,
-   159.668F,
-   144.531F,
-   70.8008F,
-   -40.7715F,
-   17.5781F,
-   85.2051F,
-   42.7246F,
-   164.551F,
-   72.5098F,
-   238.525F,
-   175.781F,
-   301.514F,
-   293.945F,
-   184.814F,
-   119.141F,
-   -97.6563F,
-   -65.6738F,
-   131.348F,
-   90.8203F,
-   -329.590F,
-   -338.623F,
-   -291.504F,
-   -22.2168F,
-   308.105F,
-   213.867F,
-   189.209F,
-   170.898F,
-   -146.240F,
-   -9.27734F,
-   -104.980F,
-   -176.270F,
-   482.422F,
-   397.949F,
-   241.943F,
-   148.438F,
-   27.0996F,
-   67.3828F,
-   -55.1758F,
-   -23.4375F,
-   -231.201F,
-   -94.7266F,
-   -2.68555F,
-   -1.70898F,
-   -73.9746F,
-   -129.639F,
-   -204.834F,
-   82.5195F,
-   423.340F,
-   417.480F,
-   343.018F,
-   247.314F,
-   -125.977F,
-   -208.740F,
-   -157.471F,
-   51.2695F,
-   -167.969F,
-   -101.563F,
-   125.244F,
-   56.1523F,
-   -200.684F,
-   -155.518F,
-   -279.785F,
-   -78.1250F,
-   -232.422F,
-   -160.645F,
-   -169.434F,
-   44.6777F,
-   -27.8320F,
-   -152.100F,
-   199.707F,
-   164.551F,
-   -46.6309F,
-   -49.8047F,
-   178.467F,
-   155.029F,
-   12.4512F,
-   298.096F,
-   215.576F,
-   140.625F,
-   -232.910F,
-   -105.225F,
-   201.660F,
-   145.996F,
-   -83.4961F,
-   -184.326F,
-   -219.727F,
-   -99.3652F,
-   -274.902F,
-   -86.4258F,
-   -50.2930F,
-   -125.000F,
-   -133.545F,
-   -197.754F,
-   -87.1582F,
-   -151.367F,
-   16.1133F,
-   125.732F,
-   -17.8223F,
-   -100.098F,
-   -212.891F,
-   -230.713F,
-   -352.539F,
-   -299.561F,
-   46.6309F,
-   -4.15039F,
-   -132.813F,
-   -56.3965F,
-   -375.977F,
-   -132.813F,
-   -219.971F,
-   -216.309F
+   REAL_CONST(102.295F),
+   REAL_CONST(39.7949F),
+   REAL_CONST(-7.32422F),
+   REAL_CONST(-63.9648F),
+   REAL_CONST(-111.084F),
+   REAL_CONST(-192.627F),
+   REAL_CONST(-349.121F),
+   REAL_CONST(-176.025F),
+   REAL_CONST(245.605F),
+   REAL_CONST(162.109F),
+   REAL_CONST(65.6738F),
+   REAL_CONST(6.10352F),
+   REAL_CONST(151.123F),
+   REAL_CONST(63.4766F),
+   REAL_CONST(44.6777F),
+   REAL_CONST(23.4375F),
+   REAL_CONST(-236.328F),
+   REAL_CONST(-331.543F),
+   REAL_CONST(-94.7266F),
+   REAL_CONST(32.9590F),
+   REAL_CONST(-169.189F),
+   REAL_CONST(203.857F),
+   REAL_CONST(111.328F),
+   REAL_CONST(37.5977F),
+   REAL_CONST(269.775F),
+   REAL_CONST(171.631F),
+   REAL_CONST(138.916F),
+   REAL_CONST(88.6230F),
+   REAL_CONST(396.729F),
+   REAL_CONST(323.730F),
+   REAL_CONST(240.479F),
+   REAL_CONST(182.617F),
+   REAL_CONST(-53.7109F),
+   REAL_CONST(53.4668F),
+   REAL_CONST(18.5547F),
+   REAL_CONST(-50.7813F),
+   REAL_CONST(-355.225F),
+   REAL_CONST(-405.762F),
+   REAL_CONST(11.9629F),
+   REAL_CONST(36.3770F),
+   REAL_CONST(-235.352F),
+   REAL_CONST(-41.9922F),
+   REAL_CONST(-183.594F),
+   REAL_CONST(-82.0313F),
+   REAL_CONST(152.588F),
+   REAL_CONST(51.0254F),
+   REAL_CONST(-61.0352F),
+   REAL_CONST(-16.1133F),
+   REAL_CONST(-248.291F),
+   REAL_CONST(-204.590F),
+   REAL_CONST(-0.488281F),
+   REAL_CONST(77.3926F),
+   REAL_CONST(-529.297F),
+   REAL_CONST(-362.549F),
+   REAL_CONST(-33.6914F),
+   REAL_CONST(30.0293F),
+   REAL_CONST(-458.008F),
+   REAL_CONST(-512.451F),
+   REAL_CONST(-127.197F),
+   REAL_CONST(20.7520F),
+   REAL_CONST(-236.084F),
+   REAL_CONST(-89.3555F),
+   REAL_CONST(-169.678F),
+   REAL_CONST(-215.088F),
+   REAL_CONST(-224.854F),
+   REAL_CONST(-246.826F),
+   REAL_CONST(-186.279F),
+   REAL_CONST(-231.689F),
+   REAL_CONST(-30.2734F),
+   REAL_CONST(-62.5000F),
+   REAL_CONST(-85.9375F),
+   REAL_CONST(-161.133F),
+   REAL_CONST(43.4570F),
+   REAL_CONST(113.037F),
+   REAL_CONST(86.4258F),
+   REAL_CONST(74.2188F),
+   REAL_CONST(-425.781F),
+   REAL_CONST(-144.287F),
+   REAL_CONST(-68.8477F),
+   REAL_CONST(19.2871F),
+   REAL_CONST(-549.072F),
+   REAL_CONST(42.7246F),
+   REAL_CONST(211.670F),
+   REAL_CONST(121.826F),
+   REAL_CONST(-33.6914F),
+   REAL_CONST(-43.9453F),
+   REAL_CONST(-44.1895F),
+   REAL_CONST(-5.12695F),
+   REAL_CONST(-559.326F),
+   REAL_CONST(-302.979F),
+   REAL_CONST(-112.305F),
+   REAL_CONST(-126.953F),
+   REAL_CONST(-188.232F),
+   REAL_CONST(110.107F),
+   REAL_CONST(-2.44141F),
+   REAL_CONST(-75.1953F),
+   REAL_CONST(66.1621F),
+   REAL_CONST(-15.8691F),
+   REAL_CONST(0.976563F),
+   REAL_CONST(52.2461F),
+   REAL_CONST(-68.1152F),
+   REAL_CONST(-106.201F),
+   REAL_CONST(-10.4980F),
+   REAL_CONST(-84.9609F),
+   REAL_CONST(-163.574F),
+   REAL_CONST(8.54492F),
+   REAL_CONST(-15.8691F),
+   REAL_CONST(-51.5137F),
+   REAL_CONST(196.777F),
+   REAL_CONST(130.615F),
+   REAL_CONST(20.7520F),
+   REAL_CONST(72.5098F),
+   REAL_CONST(13.9160F),
+   REAL_CONST(58.3496F),
+   REAL_CONST(176.270F),
+   REAL_CONST(120.361F),
+   REAL_CONST(54.9316F),
+   REAL_CONST(161.377F),
+   REAL_CONST(205.078F),
+   REAL_CONST(133.545F),
+   REAL_CONST(-131.836F),
+   REAL_CONST(-91.7969F),
+   REAL_CONST(3.41797F),
+   REAL_CONST(85.2051F),
+   REAL_CONST(114.502F),
+   REAL_CONST(176.025F),
+   REAL_CONST(80.8105F),
+   REAL_CONST(39.5508F),
+   REAL_CONST(-132.813F),
+   REAL_CONST(-183.594F),
+   REAL_CONST(-15.1367F),
+   REAL_CONST(-2.44141F),
+   REAL_CONST(97.1680F),
+   REAL_CONST(-21.4844F),
+   REAL_CONST(176.758F),
+   REAL_CONST(171.143F),
+   REAL_CONST(-4.63867F),
+   REAL_CONST(-130.127F),
+   REAL_CONST(-22.9492F),
+   REAL_CONST(146.729F),
+   REAL_CONST(33.2031F),
+   REAL_CONST(-17.3340F),
+   REAL_CONST(-166.260F),
+   REAL_CONST(-182.373F),
+   REAL_CONST(-40.5273F),
+   REAL_CONST(-83.9844F),
+   REAL_CONST(63.7207F),
+   REAL_CONST(-12.2070F),
+   REAL_CONST(39.3066F),
+   REAL_CONST(-12.6953F),
+   REAL_CONST(118.408F),
+   REAL_CONST(82.2754F),
+   REAL_CONST(-408.936F),
+   REAL_CONST(12.2070F),
+   REAL_CONST(46.3867F),
+   REAL_CONST(-22.7051F),
+   REAL_CONST(-557.129F),
+   REAL_CONST(-56.3965F),
+   REAL_CONST(-47.3633F),
+   REAL_CONST(-20.0195F),
+   REAL_CONST(-23.1934F),
+   REAL_CONST(-145.264F),
+   REAL_CONST(-37.5977F),
+   REAL_CONST(31.2500F),
+   REAL_CONST(218.262F),
+   REAL_CONST(122.314F),
+   REAL_CONST(143.555F),
+   REAL_CONST(111.572F),
+   REAL_CONST(-84.2285F),
+   REAL_CONST(50.2930F),
+   REAL_CONST(29.7852F),
+   REAL_CONST(26.8555F),
+   REAL_CONST(-154.053F),
+   REAL_CONST(-55.4199F),
+   REAL_CONST(-138.916F),
+   REAL_CONST(0.732422F),
+   REAL_CONST(99.6094F),
+   REAL_CONST(58.3496F),
+   REAL_CONST(96.9238F),
+   REAL_CONST(55.1758F),
+   REAL_CONST(-48.0957F),
+   REAL_CONST(-0.488281F),
+   REAL_CONST(31.2500F),
+   REAL_CONST(119.873F),
+   REAL_CONST(312.744F),
+   REAL_CONST(220.703F),
+   REAL_CONST(71.2891F),
+   REAL_CONST(52.4902F),
+   REAL_CONST(131.348F),
+   REAL_CONST(74.7070F),
+   REAL_CONST(63.2324F),
+   REAL_CONST(124.268F),
+   REAL_CONST(-165.283F),
+   REAL_CONST(-255.615F),
+   REAL_CONST(3.17383F),
+   REAL_CONST(78.3691F),
+   REAL_CONST(-165.771F),
+   REAL_CONST(-143.555F),
+   REAL_CONST(-87.4023F),
+   REAL_CONST(-51.7578F),
+   REAL_CONST(-136.230F),
+   REAL_CONST(59.3262F),
+   REAL_CONST(157.715F),
+   REAL_CONST(116.943F),
+   REAL_CONST(118.652F),
+   REAL_CONST(83.4961F),
+   REAL_CONST(154.785F),
+   REAL_CONST(129.883F),
+   REAL_CONST(26.1230F),
+   REAL_CONST(195.801F),
+   REAL_CONST(80.8105F),
+   REAL_CONST(33.2031F),
+   REAL_CONST(-27.3438F),
+   REAL_CONST(-97.1680F),
+   REAL_CONST(-251.709F),
+   REAL_CONST(-69.8242F),
+   REAL_CONST(-79.5898F),
+   REAL_CONST(-172.119F),
+   REAL_CONST(70.3125F),
+   REAL_CONST(66.4063F),
+   REAL_CONST(317.139F),
+   REAL_CONST(279.297F),
+   REAL_CONST(287.598F),
+   REAL_CONST(209.961F),
+   REAL_CONST(-103.271F),
+   REAL_CONST(29.5410F),
+   REAL_CONST(-93.9941F),
+   REAL_CONST(-36.1328F),
+   REAL_CONST(-72.0215F),
+   REAL_CONST(-73.7305F),
+   REAL_CONST(-203.613F),
+   REAL_CONST(-199.951F),
+   REAL_CONST(3.90625F),
+   REAL_CONST(-5.85938F),
+   REAL_CONST(-49.0723F),
+   REAL_CONST(-116.211F),
+   REAL_CONST(135.498F),
+   REAL_CONST(22.2168F),
+   REAL_CONST(-59.8145F),
+   REAL_CONST(71.7773F),
+   REAL_CONST(-9.27734F),
+   REAL_CONST(-92.5293F),
+   REAL_CONST(-234.863F),
+   REAL_CONST(-298.096F),
+   REAL_CONST(-290.771F),
+   REAL_CONST(-370.605F),
+   REAL_CONST(-66.6504F),
+   REAL_CONST(-96.4355F),
+   REAL_CONST(-95.2148F),
+   REAL_CONST(-247.314F),
+   REAL_CONST(-157.471F),
+   REAL_CONST(139.893F),
+   REAL_CONST(-449.951F),
+   REAL_CONST(-251.465F),
+   REAL_CONST(123.291F),
+   REAL_CONST(114.258F),
+   REAL_CONST(181.641F),
+   REAL_CONST(231.201F),
+   REAL_CONST(148.682F),
+   REAL_CONST(120.361F),
+   REAL_CONST(-168.213F),
+   REAL_CONST(-286.133F),
+   REAL_CONST(-153.320F),
+   REAL_CONST(-32.9590F),
+   REAL_CONST(-250.488F),
+   REAL_CONST(47.6074F),
+   REAL_CONST(100.342F),
+   REAL_CONST(47.8516F),
+   REAL_CONST(386.230F),
+   REAL_CONST(280.029F),
+   REAL_CONST(140.381F),
+   REAL_CONST(82.2754F),
+   REAL_CONST(-302.490F),
+   REAL_CONST(-189.697F),
+   REAL_CONST(-158.203F),
+   REAL_CONST(-34.6680F),
+   REAL_CONST(145.264F),
+   REAL_CONST(201.416F),
+   REAL_CONST(236.084F),
+   REAL_CONST(179.443F),
+   REAL_CONST(-294.434F),
+   REAL_CONST(-236.816F),
+   REAL_CONST(-19.7754F),
+   REAL_CONST(-83.4961F),
+   REAL_CONST(-181.885F),
+   REAL_CONST(3.17383F),
+   REAL_CONST(-17.5781F),
+   REAL_CONST(91.5527F),
+   REAL_CONST(110.840F),
+   REAL_CONST(4.63867F),
+   REAL_CONST(343.506F),
+   REAL_CONST(224.854F),
+   REAL_CONST(-402.100F),
+   REAL_CONST(-41.9922F),
+   REAL_CONST(210.205F),
+   REAL_CONST(137.207F),
+   REAL_CONST(226.563F),
+   REAL_CONST(375.244F),
+   REAL_CONST(259.521F),
+   REAL_CONST(180.664F),
+   REAL_CONST(-603.516F),
+   REAL_CONST(-232.422F),
+   REAL_CONST(64.4531F),
+   REAL_CONST(20.0195F),
+   REAL_CONST(-122.559F),
+   REAL_CONST(-235.596F),
+   REAL_CONST(-325.684F),
+   REAL_CONST(30.0293F),
+   REAL_CONST(211.670F),
+   REAL_CONST(301.758F),
+   REAL_CONST(130.371F),
+   REAL_CONST(41.7480F),
+   REAL_CONST(-566.406F),
+   REAL_CONST(-112.305F),
+   REAL_CONST(190.430F),
+   REAL_CONST(88.6230F),
+   REAL_CONST(-290.527F),
+   REAL_CONST(-150.635F),
+   REAL_CONST(61.5234F),
+   REAL_CONST(-14.8926F),
+   REAL_CONST(-42.4805F),
+   REAL_CONST(8.30078F),
+   REAL_CONST(246.826F),
+   REAL_CONST(192.383F),
+   REAL_CONST(-569.580F),
+   REAL_CONST(60.3027F),
+   REAL_CONST(103.271F),
+   REAL_CONST(37.3535F),
+   REAL_CONST(-3.90625F),
+   REAL_CONST(-86.6699F),
+   REAL_CONST(63.9648F),
+   REAL_CONST(109.619F),
+   REAL_CONST(-384.766F),
+   REAL_CONST(-261.963F),
+   REAL_CONST(-132.813F),
+   REAL_CONST(-90.5762F),
+   REAL_CONST(-150.146F),
+   REAL_CONST(-74.4629F),
+   REAL_CONST(256.592F),
+   REAL_CONST(196.533F),
+   REAL_CONST(167.725F),
+   REAL_CONST(128.906F),
+   REAL_CONST(1.46484F),
+   REAL_CONST(-44.4336F),
+   REAL_CONST(228.271F),
+   REAL_CONST(213.623F),
+   REAL_CONST(244.629F),
+   REAL_CONST(197.510F),
+   REAL_CONST(48.5840F),
+   REAL_CONST(62.7441F),
+   REAL_CONST(30.7617F),
+   REAL_CONST(18.5547F),
+   REAL_CONST(-142.578F),
+   REAL_CONST(-277.832F),
+   REAL_CONST(146.240F),
+   REAL_CONST(135.742F),
+   REAL_CONST(-269.775F),
+   REAL_CONST(-339.600F),
+   REAL_CONST(-388.428F),
+   REAL_CONST(-126.709F),
+   REAL_CONST(-238.525F),
+   REAL_CONST(-323.486F),
+   REAL_CONST(26.3672F),
+   REAL_CONST(84.7168F),
+   REAL_CONST(-176.270F),
+   REAL_CONST(-238.037F),
+   REAL_CONST(89.1113F),
+   REAL_CONST(24.6582F),
+   REAL_CONST(-35.4004F),
+   REAL_CONST(166.260F),
+   REAL_CONST(60.7910F),
+   REAL_CONST(-37.3535F),
+   REAL_CONST(0.000000F),
+   REAL_CONST(-81.5430F),
+   REAL_CONST(-139.160F),
+   REAL_CONST(38.8184F),
+   REAL_CONST(100.586F),
+   REAL_CONST(69.5801F),
+   REAL_CONST(-82.0313F),
+   REAL_CONST(-150.635F),
+   REAL_CONST(-232.666F),
+   REAL_CONST(-235.840F),
+   REAL_CONST(216.553F),
+   REAL_CONST(168.213F),
+   REAL_CONST(-305.420F),
+   REAL_CONST(20.5078F),
+   REAL_CONST(-45.1660F),
+   REAL_CONST(-97.1680F),
+   REAL_CONST(-144.531F),
+   REAL_CONST(105.713F),
+   REAL_CONST(254.883F),
+   REAL_CONST(159.424F),
+   REAL_CONST(20.7520F),
+   REAL_CONST(80.3223F),
+   REAL_CONST(-9.76563F),
+   REAL_CONST(88.1348F),
+   REAL_CONST(-105.713F),
+   REAL_CONST(-172.119F),
+   REAL_CONST(113.770F),
+   REAL_CONST(140.137F),
+   REAL_CONST(-37.5977F),
+   REAL_CONST(159.668F),
+   REAL_CONST(144.531F),
+   REAL_CONST(70.8008F),
+   REAL_CONST(-40.7715F),
+   REAL_CONST(17.5781F),
+   REAL_CONST(85.2051F),
+   REAL_CONST(42.7246F),
+   REAL_CONST(164.551F),
+   REAL_CONST(72.5098F),
+   REAL_CONST(238.525F),
+   REAL_CONST(175.781F),
+   REAL_CONST(301.514F),
+   REAL_CONST(293.945F),
+   REAL_CONST(184.814F),
+   REAL_CONST(119.141F),
+   REAL_CONST(-97.6563F),
+   REAL_CONST(-65.6738F),
+   REAL_CONST(131.348F),
+   REAL_CONST(90.8203F),
+   REAL_CONST(-329.590F),
+   REAL_CONST(-338.623F),
+   REAL_CONST(-291.504F),
+   REAL_CONST(-22.2168F),
+   REAL_CONST(308.105F),
+   REAL_CONST(213.867F),
+   REAL_CONST(189.209F),
+   REAL_CONST(170.898F),
+   REAL_CONST(-146.240F),
+   REAL_CONST(-9.27734F),
+   REAL_CONST(-104.980F),
+   REAL_CONST(-176.270F),
+   REAL_CONST(482.422F),
+   REAL_CONST(397.949F),
+   REAL_CONST(241.943F),
+   REAL_CONST(148.438F),
+   REAL_CONST(27.0996F),
+   REAL_CONST(67.3828F),
+   REAL_CONST(-55.1758F),
+   REAL_CONST(-23.4375F),
+   REAL_CONST(-231.201F),
+   REAL_CONST(-94.7266F),
+   REAL_CONST(-2.68555F),
+   REAL_CONST(-1.70898F),
+   REAL_CONST(-73.9746F),
+   REAL_CONST(-129.639F),
+   REAL_CONST(-204.834F),
+   REAL_CONST(82.5195F),
+   REAL_CONST(423.340F),
+   REAL_CONST(417.480F),
+   REAL_CONST(343.018F),
+   REAL_CONST(247.314F),
+   REAL_CONST(-125.977F),
+   REAL_CONST(-208.740F),
+   REAL_CONST(-157.471F),
+   REAL_CONST(51.2695F),
+   REAL_CONST(-167.969F),
+   REAL_CONST(-101.563F),
+   REAL_CONST(125.244F),
+   REAL_CONST(56.1523F),
+   REAL_CONST(-200.684F),
+   REAL_CONST(-155.518F),
+   REAL_CONST(-279.785F),
+   REAL_CONST(-78.1250F),
+   REAL_CONST(-232.422F),
+   REAL_CONST(-160.645F),
+   REAL_CONST(-169.434F),
+   REAL_CONST(44.6777F),
+   REAL_CONST(-27.8320F),
+   REAL_CONST(-152.100F),
+   REAL_CONST(199.707F),
+   REAL_CONST(164.551F),
+   REAL_CONST(-46.6309F),
+   REAL_CONST(-49.8047F),
+   REAL_CONST(178.467F),
+   REAL_CONST(155.029F),
+   REAL_CONST(12.4512F),
+   REAL_CONST(298.096F),
+   REAL_CONST(215.576F),
+   REAL_CONST(140.625F),
+   REAL_CONST(-232.910F),
+   REAL_CONST(-105.225F),
+   REAL_CONST(201.660F),
+   REAL_CONST(145.996F),
+   REAL_CONST(-83.4961F),
+   REAL_CONST(-184.326F),
+   REAL_CONST(-219.727F),
+   REAL_CONST(-99.3652F),
+   REAL_CONST(-274.902F),
+   REAL_CONST(-86.4258F),
+   REAL_CONST(-50.2930F),
+   REAL_CONST(-125.000F),
+   REAL_CONST(-133.545F),
+   REAL_CONST(-197.754F),
+   REAL_CONST(-87.1582F),
+   REAL_CONST(-151.367F),
+   REAL_CONST(16.1133F),
+   REAL_CONST(125.732F),
+   REAL_CONST(-17.8223F),
+   REAL_CONST(-100.098F),
+   REAL_CONST(-212.891F),
+   REAL_CONST(-230.713F),
+   REAL_CONST(-352.539F),
+   REAL_CONST(-299.561F),
+   REAL_CONST(46.6309F),
+   REAL_CONST(-4.15039F),
+   REAL_CONST(-132.813F),
+   REAL_CONST(-56.3965F),
+   REAL_CONST(-375.977F),
+   REAL_CONST(-132.813F),
+   REAL_CONST(-219.971F),
+   REAL_CONST(-216.309F)
 
 };
 #define MR795_1_SIZE  512
@@ -11071,520 +11069,520 @@ static const real_32_t dico5_lsf_5[DICO5_SIZE_5 * 4] =
  *    g_fac(1)           // frame 1 and 3
  *
  */
-static const Float32 table_gain_MR475[MR475_VQ_SIZE * 4] =
+static const real_t table_gain_MR475[MR475_VQ_SIZE * 4] =
 {
-0.049561F, 0.031250F,
-0.033081F, 0.034180F,
-0.175354F, 0.277100F,
-0.138306F, 0.830566F,
-0.126160F, 0.137451F,
-0.773743F, 0.157959F,
-0.252197F, 0.438965F,
-0.341858F, 1.290283F,
-0.469299F, 0.091309F,
-0.227966F, 0.107666F,
-0.666016F, 0.644043F,
-0.720642F, 0.608887F,
-1.250610F, 0.194580F,
-0.318481F, 0.164795F,
-0.410400F, 2.039551F,
-0.322388F, 0.414063F,
-0.090820F, 0.104492F,
-0.359009F, 0.110352F,
-0.325439F, 0.994141F,
-0.218689F, 0.309570F,
-0.150696F, 0.219971F,
-0.970093F, 0.245361F,
-0.914429F, 0.798584F,
-0.630554F, 1.186035F,
-0.221863F, 0.493408F,
-0.158447F, 0.203857F,
-0.754395F, 1.194336F,
-0.744995F, 0.416016F,
-0.819824F, 0.391602F,
-0.556519F, 0.571533F,
-0.242188F, 0.375488F,
-0.334412F, 2.425781F,
-0.231628F, 0.101807F,
-0.082947F, 0.101074F,
-0.222168F, 0.383057F,
-0.487976F, 0.864502F,
-0.696106F, 0.157471F,
-0.521973F, 0.155029F,
-0.247559F, 0.336182F,
-1.013672F, 1.495117F,
-0.697021F, 0.170898F,
-0.122498F, 0.148193F,
-0.757751F, 0.385254F,
-0.678650F, 1.136230F,
-0.834961F, 0.416992F,
-0.731812F, 0.300049F,
-0.488037F, 1.781494F,
-0.807556F, 1.395264F,
-0.148193F, 0.282959F,
-0.126526F, 0.473877F,
-0.379517F, 1.494385F,
-0.216431F, 0.440430F,
-0.544739F, 0.439941F,
-0.529724F, 0.385742F,
-0.850525F, 0.873047F,
-0.812561F, 1.522705F,
-0.374878F, 0.275879F,
-0.365845F, 0.423340F,
-0.863098F, 1.138184F,
-0.687927F, 0.810791F,
-0.746216F, 0.378662F,
-0.850281F, 0.736084F,
-0.310120F, 2.554688F,
-0.576416F, 1.637207F,
-0.103088F, 0.166748F,
-0.087646F, 0.318848F,
-0.440186F, 0.960205F,
-0.249146F, 0.662354F,
-0.475647F, 0.171875F,
-0.919800F, 0.195801F,
-0.384460F, 1.272461F,
-0.264709F, 1.307861F,
-0.407471F, 0.132080F,
-0.369995F, 0.152832F,
-0.833191F, 0.903320F,
-0.701782F, 0.587891F,
-0.986084F, 0.174805F,
-0.743225F, 0.183350F,
-0.492249F, 2.804932F,
-0.385376F, 0.550781F,
-0.272583F, 0.121094F,
-0.445129F, 0.127686F,
-0.623352F, 0.935791F,
-0.512329F, 0.741455F,
-0.512878F, 0.235840F,
-0.868408F, 0.458984F,
-0.531189F, 1.320557F,
-1.000671F, 1.187256F,
-0.452881F, 0.483154F,
-0.371643F, 0.300293F,
-0.571960F, 1.073730F,
-0.888550F, 0.821045F,
-0.827576F, 0.701416F,
-0.803406F, 0.357666F,
-0.337769F, 0.409668F,
-0.801880F, 3.606201F,
-0.447876F, 0.146484F,
-0.080444F, 0.133789F,
-0.259521F, 0.864014F,
-0.613037F, 0.577148F,
-0.646179F, 0.151855F,
-0.798828F, 0.163330F,
-0.862183F, 0.860840F,
-0.307556F, 2.388672F,
-0.936157F, 0.151123F,
-0.190125F, 0.144043F,
-1.003540F, 0.735596F,
-0.948608F, 1.017578F,
-0.948303F, 0.393311F,
-0.940247F, 0.299805F,
-0.977966F, 2.270264F,
-0.459839F, 1.214844F,
-0.121460F, 0.296143F,
-0.698669F, 0.282471F,
-0.763672F, 1.347412F,
-0.578308F, 0.645508F,
-0.470947F, 0.496582F,
-0.810547F, 0.546631F,
-0.977234F, 1.243408F,
-0.492310F, 1.650635F,
-0.615417F, 0.344971F,
-0.305298F, 0.572998F,
-0.764343F, 1.458740F,
-0.923218F, 0.707764F,
-1.114746F, 0.558838F,
-0.966003F, 0.616943F,
-0.992737F, 2.503418F,
-0.894226F, 2.763428F,
-0.109680F, 0.082275F,
-0.190125F, 0.096924F,
-0.214233F, 0.714844F,
-0.280273F, 0.651855F,
-0.458923F, 0.153320F,
-0.696716F, 0.160156F,
-0.362915F, 0.594482F,
-0.399414F, 1.798584F,
-0.502808F, 0.202393F,
-0.244141F, 0.210693F,
-0.612305F, 0.608398F,
-0.980042F, 0.866943F,
-1.111084F, 0.257324F,
-0.372498F, 0.354980F,
-0.359131F, 1.928711F,
-1.144531F, 0.846680F,
-0.113770F, 0.132813F,
-0.561401F, 0.166748F,
-0.709412F, 1.015625F,
-0.280396F, 0.401367F,
-0.192749F, 0.282471F,
-0.973694F, 0.625000F,
-0.753723F, 0.911377F,
-1.063232F, 1.284180F,
-0.372681F, 0.489258F,
-0.178040F, 0.425293F,
-1.005066F, 1.283447F,
-1.024597F, 0.410156F,
-1.050110F, 0.429443F,
-0.291321F, 0.788818F,
-0.450806F, 1.473389F,
-0.875366F, 2.444336F,
-0.246277F, 0.107910F,
-0.255981F, 0.111816F,
-0.562378F, 0.547363F,
-0.453308F, 1.029541F,
-0.784912F, 0.195557F,
-0.682739F, 0.201416F,
-0.771973F, 0.508789F,
-0.790771F, 1.600098F,
-0.580139F, 0.243164F,
-0.404602F, 0.240479F,
-0.643127F, 0.610840F,
-0.933167F, 1.222168F,
-0.769165F, 0.501709F,
-0.945068F, 0.403564F,
-0.988403F, 1.689697F,
-0.868591F, 1.413574F,
-0.160278F, 0.202148F,
-0.342712F, 0.411621F,
-0.833923F, 1.410645F,
-0.223877F, 0.379395F,
-0.690491F, 0.642822F,
-0.596313F, 0.356201F,
-0.854675F, 1.155518F,
-0.970276F, 1.535889F,
-0.383179F, 0.456543F,
-0.482788F, 0.557861F,
-1.036255F, 1.115967F,
-1.011719F, 0.939697F,
-0.930664F, 0.564209F,
-0.977966F, 0.791992F,
-0.882507F, 4.347656F,
-0.723083F, 0.674561F,
-0.120911F, 0.343506F,
-0.085449F, 0.213867F,
-0.264587F, 0.865967F,
-0.268005F, 1.027832F,
-0.329895F, 0.166016F,
-1.065735F, 0.190674F,
-0.396790F, 1.249512F,
-0.493835F, 1.874268F,
-0.448914F, 0.193848F,
-0.508606F, 0.288574F,
-0.918030F, 0.771484F,
-0.911133F, 0.741943F,
-1.246399F, 0.214844F,
-0.887756F, 0.208008F,
-0.752991F, 3.590820F,
-0.421387F, 0.468750F,
-0.257874F, 0.227783F,
-0.501587F, 0.265381F,
-0.650574F, 0.997070F,
-0.615356F, 1.106689F,
-0.166931F, 0.205078F,
-1.260803F, 0.263916F,
-1.019958F, 1.456543F,
-0.968811F, 1.117676F,
-0.663513F, 0.628418F,
-0.230286F, 0.284668F,
-0.886169F, 0.987305F,
-1.263367F, 0.641357F,
-0.928894F, 0.667480F,
-0.932251F, 0.533691F,
-0.381897F, 0.787598F,
-0.801086F, 4.755859F,
-0.439209F, 0.227051F,
-0.150269F, 0.395020F,
-0.275574F, 0.754883F,
-0.845459F, 1.044189F,
-0.638428F, 0.203369F,
-1.058289F, 0.197754F,
-1.030945F, 0.558838F,
-0.948853F, 2.006104F,
-0.830261F, 0.411133F,
-0.195129F, 0.447754F,
-0.973389F, 0.688477F,
-0.965088F, 1.300537F,
-1.037964F, 0.595215F,
-1.024658F, 0.323730F,
-0.956482F, 1.991211F,
-0.715698F, 2.088867F,
-0.229614F, 0.501221F,
-0.583679F, 0.321533F,
-0.827698F, 1.657715F,
-0.746277F, 0.472656F,
-0.499268F, 0.866699F,
-0.810974F, 0.434082F,
-0.994812F, 1.611084F,
-0.994324F, 1.894043F,
-0.520081F, 0.622803F,
-0.440979F, 0.645752F,
-1.115051F, 1.828369F,
-1.030579F, 0.548828F,
-1.091431F, 0.704102F,
-1.053772F, 0.812500F,
-0.574768F, 4.922363F,
-0.673950F, 2.031250F,
-0.078491F, 0.151367F,
-0.087341F, 0.142334F,
-0.365784F, 0.558838F,
-0.242798F, 0.885254F,
-0.313965F, 0.183594F,
-0.818420F, 0.202637F,
-0.338928F, 0.698242F,
-0.718018F, 1.442383F,
-0.655334F, 0.136719F,
-0.332397F, 0.137695F,
-0.813049F, 0.734375F,
-0.729126F, 0.899170F,
-1.213806F, 0.194824F,
-0.599670F, 0.177734F,
-0.833923F, 2.135742F,
-0.451111F, 0.745361F,
-0.153503F, 0.189941F,
-0.369263F, 0.203369F,
-0.394836F, 1.238770F,
-0.506897F, 0.601318F,
-0.374817F, 0.455322F,
-0.934326F, 0.308105F,
-0.879395F, 1.110107F,
-0.833923F, 1.102295F,
-0.191467F, 0.728271F,
-0.151306F, 0.307373F,
-0.920898F, 1.134521F,
-0.938843F, 0.636475F,
-0.884521F, 0.583984F,
-0.760620F, 0.619385F,
-0.460144F, 0.719971F,
-0.787903F, 2.944336F,
-0.333740F, 0.166992F,
-0.191711F, 0.176270F,
-0.310120F, 0.311035F,
-0.777100F, 1.025391F,
-0.933960F, 0.166260F,
-0.477234F, 0.144531F,
-0.398804F, 0.493408F,
-1.005737F, 2.133057F,
-0.815674F, 0.215332F,
-0.329407F, 0.219482F,
-0.894531F, 0.531738F,
-0.899719F, 1.031982F,
-0.870972F, 0.316895F,
-0.850159F, 0.495361F,
-0.944641F, 1.826660F,
-0.965271F, 1.116211F,
-0.153870F, 0.491455F,
-0.308960F, 0.440430F,
-0.314880F, 1.606934F,
-0.435181F, 0.878174F,
-0.666504F, 0.393311F,
-0.715881F, 0.416992F,
-1.031677F, 0.843506F,
-0.992920F, 1.621094F,
-0.567993F, 0.245850F,
-0.571838F, 0.514160F,
-1.170776F, 1.229736F,
-0.759338F, 1.042236F,
-0.971619F, 0.325195F,
-0.937317F, 0.857422F,
-0.726196F, 3.452393F,
-0.982727F, 1.673340F,
-0.122681F, 0.179932F,
-0.230652F, 0.210205F,
-0.699097F, 0.703125F,
-0.217529F, 0.864258F,
-0.552795F, 0.302979F,
-0.756287F, 0.218750F,
-0.521606F, 1.130127F,
-0.705627F, 1.410156F,
-0.496155F, 0.143799F,
-0.501587F, 0.143555F,
-1.143066F, 0.916748F,
-0.791809F, 0.768799F,
-0.960022F, 0.185059F,
-1.015259F, 0.184082F,
-0.929077F, 2.719238F,
-0.968689F, 0.539063F,
-0.285217F, 0.148926F,
-0.623657F, 0.165527F,
-0.931213F, 1.012207F,
-0.349670F, 0.812256F,
-0.511292F, 0.407715F,
-1.212280F, 0.566650F,
-0.942993F, 1.345459F,
-0.857788F, 1.338135F,
-0.349609F, 0.705078F,
-0.462646F, 0.328613F,
-0.877930F, 1.300049F,
-0.990967F, 0.964355F,
-0.922729F, 0.914063F,
-0.934204F, 0.350342F,
-0.890930F, 0.993652F,
-0.750793F, 3.832031F,
-0.464905F, 0.414795F,
-0.132446F, 0.215820F,
-0.272156F, 1.114990F,
-1.104370F, 0.807129F,
-0.777710F, 0.198975F,
-0.911011F, 0.221436F,
-0.916504F, 1.045166F,
-0.947144F, 2.042969F,
-1.098267F, 0.265381F,
-0.143921F, 0.211182F,
-0.993713F, 0.924561F,
-0.956970F, 1.122070F,
-0.998291F, 0.374512F,
-1.012207F, 0.539551F,
-1.027405F, 2.367432F,
-0.972229F, 1.101807F,
-0.200012F, 0.264893F,
-0.588562F, 0.533936F,
-0.730774F, 1.481445F,
-0.561462F, 1.089355F,
-0.546570F, 0.397705F,
-0.627991F, 0.747559F,
-1.005920F, 1.258545F,
-0.943970F, 1.725098F,
-0.834839F, 0.620850F,
-0.321838F, 0.555908F,
-1.022095F, 1.516846F,
-1.016541F, 0.832031F,
-1.239258F, 0.821045F,
-1.140625F, 0.484619F,
-0.864990F, 3.141357F,
-0.924927F, 3.833740F,
-0.273010F, 0.249023F,
-0.102600F, 0.216309F,
-0.263123F, 1.050049F,
-0.546387F, 0.892822F,
-0.359680F, 0.280029F,
-0.710876F, 0.354492F,
-0.969604F, 0.543701F,
-0.279663F, 1.622070F,
-0.422913F, 0.294189F,
-0.379639F, 0.195068F,
-0.757751F, 0.832275F,
-0.974609F, 0.946533F,
-1.212097F, 0.514893F,
-0.591370F, 0.522705F,
-0.899780F, 2.155762F,
-0.883789F, 0.634521F,
-0.110901F, 0.302246F,
-0.474304F, 0.198486F,
-1.164490F, 1.076660F,
-0.338989F, 0.503906F,
-0.225037F, 0.694336F,
-1.064148F, 0.550781F,
-1.019104F, 1.095215F,
-0.988708F, 1.315430F,
-0.489990F, 0.674561F,
-0.207825F, 0.517334F,
-1.063599F, 1.337158F,
-0.836060F, 0.680176F,
-1.213318F, 0.664063F,
-0.555298F, 0.947266F,
-1.109131F, 1.179932F,
-1.058105F, 2.980225F,
-0.312256F, 0.243164F,
-0.301208F, 0.241211F,
-0.603516F, 0.752197F,
-0.367065F, 1.311279F,
-0.969299F, 0.406982F,
-0.513000F, 0.288818F,
-0.920837F, 0.577637F,
-1.207092F, 1.709473F,
-0.730164F, 0.381348F,
-0.444275F, 0.275391F,
-1.028992F, 0.374023F,
-0.962036F, 1.313721F,
-0.897705F, 0.504150F,
-1.227112F, 0.526123F,
-1.047241F, 2.012939F,
-1.093201F, 1.542480F,
-0.333679F, 0.367188F,
-0.250244F, 0.628418F,
-1.063293F, 1.662598F,
-0.346252F, 0.705078F,
-1.015381F, 0.825684F,
-0.547791F, 0.447021F,
-1.230408F, 1.156494F,
-1.193237F, 1.780762F,
-0.406372F, 0.678955F,
-0.700195F, 0.810791F,
-1.183899F, 1.233887F,
-1.152222F, 1.152832F,
-1.003357F, 0.579346F,
-1.246948F, 1.070801F,
-0.692932F, 6.476074F,
-0.707581F, 0.749023F,
-0.174927F, 0.382324F,
-0.311768F, 0.261230F,
-0.586792F, 1.199951F,
-0.301453F, 0.863281F,
-0.460266F, 0.214355F,
-1.264465F, 0.207764F,
-0.423462F, 1.072998F,
-1.025330F, 1.887939F,
-0.618713F, 0.248779F,
-0.600891F, 0.235352F,
-0.945679F, 0.965576F,
-0.943542F, 0.837402F,
-1.151306F, 0.239746F,
-1.228027F, 0.235107F,
-1.030029F, 3.146240F,
-0.874878F, 1.025391F,
-0.402771F, 0.297852F,
-0.562866F, 0.198730F,
-1.034058F, 1.253418F,
-0.345520F, 1.195801F,
-0.334961F, 0.438965F,
-1.236450F, 0.967285F,
-1.037903F, 1.508301F,
-1.094299F, 1.447510F,
-0.571594F, 0.834961F,
-0.456177F, 0.481201F,
-1.192444F, 1.263916F,
-1.159851F, 0.733887F,
-1.004272F, 0.924805F,
-0.980835F, 0.577881F,
-0.528809F, 0.669678F,
-0.576477F, 6.435059F,
-0.662598F, 0.314209F,
-0.216980F, 0.246338F,
-0.342163F, 0.884277F,
-1.187317F, 1.345703F,
-0.760071F, 0.194580F,
-1.259399F, 0.222412F,
-0.941589F, 0.748535F,
-1.039856F, 2.508545F,
-1.152527F, 0.642822F,
-0.238831F, 0.309570F,
-1.191345F, 0.822998F,
-1.101807F, 1.276855F,
-1.177429F, 0.409668F,
-1.190674F, 0.774414F,
-1.103027F, 2.625488F,
-1.014709F, 1.671143F,
-0.191284F, 0.561035F,
-0.663391F, 0.594971F,
-0.950928F, 1.687744F,
-0.768860F, 0.825439F,
-0.678467F, 0.804932F,
-1.023071F, 0.591797F,
-1.150696F, 1.639404F,
-1.048035F, 2.413818F,
-0.777771F, 0.635986F,
-0.545471F, 0.766602F,
-1.161682F, 1.895508F,
-1.119812F, 0.947266F,
-1.249695F, 0.898926F,
-1.196411F, 0.825195F,
-0.796143F, 4.729736F,
-0.642456F, 5.645508F,
+REAL_CONST(0.049561F), REAL_CONST(0.031250F),
+REAL_CONST(0.033081F), REAL_CONST(0.034180F),
+REAL_CONST(0.175354F), REAL_CONST(0.277100F),
+REAL_CONST(0.138306F), REAL_CONST(0.830566F),
+REAL_CONST(0.126160F), REAL_CONST(0.137451F),
+REAL_CONST(0.773743F), REAL_CONST(0.157959F),
+REAL_CONST(0.252197F), REAL_CONST(0.438965F),
+REAL_CONST(0.341858F), REAL_CONST(1.290283F),
+REAL_CONST(0.469299F), REAL_CONST(0.091309F),
+REAL_CONST(0.227966F), REAL_CONST(0.107666F),
+REAL_CONST(0.666016F), REAL_CONST(0.644043F),
+REAL_CONST(0.720642F), REAL_CONST(0.608887F),
+REAL_CONST(1.250610F), REAL_CONST(0.194580F),
+REAL_CONST(0.318481F), REAL_CONST(0.164795F),
+REAL_CONST(0.410400F), REAL_CONST(2.039551F),
+REAL_CONST(0.322388F), REAL_CONST(0.414063F),
+REAL_CONST(0.090820F), REAL_CONST(0.104492F),
+REAL_CONST(0.359009F), REAL_CONST(0.110352F),
+REAL_CONST(0.325439F), REAL_CONST(0.994141F),
+REAL_CONST(0.218689F), REAL_CONST(0.309570F),
+REAL_CONST(0.150696F), REAL_CONST(0.219971F),
+REAL_CONST(0.970093F), REAL_CONST(0.245361F),
+REAL_CONST(0.914429F), REAL_CONST(0.798584F),
+REAL_CONST(0.630554F), REAL_CONST(1.186035F),
+REAL_CONST(0.221863F), REAL_CONST(0.493408F),
+REAL_CONST(0.158447F), REAL_CONST(0.203857F),
+REAL_CONST(0.754395F), REAL_CONST(1.194336F),
+REAL_CONST(0.744995F), REAL_CONST(0.416016F),
+REAL_CONST(0.819824F), REAL_CONST(0.391602F),
+REAL_CONST(0.556519F), REAL_CONST(0.571533F),
+REAL_CONST(0.242188F), REAL_CONST(0.375488F),
+REAL_CONST(0.334412F), REAL_CONST(2.425781F),
+REAL_CONST(0.231628F), REAL_CONST(0.101807F),
+REAL_CONST(0.082947F), REAL_CONST(0.101074F),
+REAL_CONST(0.222168F), REAL_CONST(0.383057F),
+REAL_CONST(0.487976F), REAL_CONST(0.864502F),
+REAL_CONST(0.696106F), REAL_CONST(0.157471F),
+REAL_CONST(0.521973F), REAL_CONST(0.155029F),
+REAL_CONST(0.247559F), REAL_CONST(0.336182F),
+REAL_CONST(1.013672F), REAL_CONST(1.495117F),
+REAL_CONST(0.697021F), REAL_CONST(0.170898F),
+REAL_CONST(0.122498F), REAL_CONST(0.148193F),
+REAL_CONST(0.757751F), REAL_CONST(0.385254F),
+REAL_CONST(0.678650F), REAL_CONST(1.136230F),
+REAL_CONST(0.834961F), REAL_CONST(0.416992F),
+REAL_CONST(0.731812F), REAL_CONST(0.300049F),
+REAL_CONST(0.488037F), REAL_CONST(1.781494F),
+REAL_CONST(0.807556F), REAL_CONST(1.395264F),
+REAL_CONST(0.148193F), REAL_CONST(0.282959F),
+REAL_CONST(0.126526F), REAL_CONST(0.473877F),
+REAL_CONST(0.379517F), REAL_CONST(1.494385F),
+REAL_CONST(0.216431F), REAL_CONST(0.440430F),
+REAL_CONST(0.544739F), REAL_CONST(0.439941F),
+REAL_CONST(0.529724F), REAL_CONST(0.385742F),
+REAL_CONST(0.850525F), REAL_CONST(0.873047F),
+REAL_CONST(0.812561F), REAL_CONST(1.522705F),
+REAL_CONST(0.374878F), REAL_CONST(0.275879F),
+REAL_CONST(0.365845F), REAL_CONST(0.423340F),
+REAL_CONST(0.863098F), REAL_CONST(1.138184F),
+REAL_CONST(0.687927F), REAL_CONST(0.810791F),
+REAL_CONST(0.746216F), REAL_CONST(0.378662F),
+REAL_CONST(0.850281F), REAL_CONST(0.736084F),
+REAL_CONST(0.310120F), REAL_CONST(2.554688F),
+REAL_CONST(0.576416F), REAL_CONST(1.637207F),
+REAL_CONST(0.103088F), REAL_CONST(0.166748F),
+REAL_CONST(0.087646F), REAL_CONST(0.318848F),
+REAL_CONST(0.440186F), REAL_CONST(0.960205F),
+REAL_CONST(0.249146F), REAL_CONST(0.662354F),
+REAL_CONST(0.475647F), REAL_CONST(0.171875F),
+REAL_CONST(0.919800F), REAL_CONST(0.195801F),
+REAL_CONST(0.384460F), REAL_CONST(1.272461F),
+REAL_CONST(0.264709F), REAL_CONST(1.307861F),
+REAL_CONST(0.407471F), REAL_CONST(0.132080F),
+REAL_CONST(0.369995F), REAL_CONST(0.152832F),
+REAL_CONST(0.833191F), REAL_CONST(0.903320F),
+REAL_CONST(0.701782F), REAL_CONST(0.587891F),
+REAL_CONST(0.986084F), REAL_CONST(0.174805F),
+REAL_CONST(0.743225F), REAL_CONST(0.183350F),
+REAL_CONST(0.492249F), REAL_CONST(2.804932F),
+REAL_CONST(0.385376F), REAL_CONST(0.550781F),
+REAL_CONST(0.272583F), REAL_CONST(0.121094F),
+REAL_CONST(0.445129F), REAL_CONST(0.127686F),
+REAL_CONST(0.623352F), REAL_CONST(0.935791F),
+REAL_CONST(0.512329F), REAL_CONST(0.741455F),
+REAL_CONST(0.512878F), REAL_CONST(0.235840F),
+REAL_CONST(0.868408F), REAL_CONST(0.458984F),
+REAL_CONST(0.531189F), REAL_CONST(1.320557F),
+REAL_CONST(1.000671F), REAL_CONST(1.187256F),
+REAL_CONST(0.452881F), REAL_CONST(0.483154F),
+REAL_CONST(0.371643F), REAL_CONST(0.300293F),
+REAL_CONST(0.571960F), REAL_CONST(1.073730F),
+REAL_CONST(0.888550F), REAL_CONST(0.821045F),
+REAL_CONST(0.827576F), REAL_CONST(0.701416F),
+REAL_CONST(0.803406F), REAL_CONST(0.357666F),
+REAL_CONST(0.337769F), REAL_CONST(0.409668F),
+REAL_CONST(0.801880F), REAL_CONST(3.606201F),
+REAL_CONST(0.447876F), REAL_CONST(0.146484F),
+REAL_CONST(0.080444F), REAL_CONST(0.133789F),
+REAL_CONST(0.259521F), REAL_CONST(0.864014F),
+REAL_CONST(0.613037F), REAL_CONST(0.577148F),
+REAL_CONST(0.646179F), REAL_CONST(0.151855F),
+REAL_CONST(0.798828F), REAL_CONST(0.163330F),
+REAL_CONST(0.862183F), REAL_CONST(0.860840F),
+REAL_CONST(0.307556F), REAL_CONST(2.388672F),
+REAL_CONST(0.936157F), REAL_CONST(0.151123F),
+REAL_CONST(0.190125F), REAL_CONST(0.144043F),
+REAL_CONST(1.003540F), REAL_CONST(0.735596F),
+REAL_CONST(0.948608F), REAL_CONST(1.017578F),
+REAL_CONST(0.948303F), REAL_CONST(0.393311F),
+REAL_CONST(0.940247F), REAL_CONST(0.299805F),
+REAL_CONST(0.977966F), REAL_CONST(2.270264F),
+REAL_CONST(0.459839F), REAL_CONST(1.214844F),
+REAL_CONST(0.121460F), REAL_CONST(0.296143F),
+REAL_CONST(0.698669F), REAL_CONST(0.282471F),
+REAL_CONST(0.763672F), REAL_CONST(1.347412F),
+REAL_CONST(0.578308F), REAL_CONST(0.645508F),
+REAL_CONST(0.470947F), REAL_CONST(0.496582F),
+REAL_CONST(0.810547F), REAL_CONST(0.546631F),
+REAL_CONST(0.977234F), REAL_CONST(1.243408F),
+REAL_CONST(0.492310F), REAL_CONST(1.650635F),
+REAL_CONST(0.615417F), REAL_CONST(0.344971F),
+REAL_CONST(0.305298F), REAL_CONST(0.572998F),
+REAL_CONST(0.764343F), REAL_CONST(1.458740F),
+REAL_CONST(0.923218F), REAL_CONST(0.707764F),
+REAL_CONST(1.114746F), REAL_CONST(0.558838F),
+REAL_CONST(0.966003F), REAL_CONST(0.616943F),
+REAL_CONST(0.992737F), REAL_CONST(2.503418F),
+REAL_CONST(0.894226F), REAL_CONST(2.763428F),
+REAL_CONST(0.109680F), REAL_CONST(0.082275F),
+REAL_CONST(0.190125F), REAL_CONST(0.096924F),
+REAL_CONST(0.214233F), REAL_CONST(0.714844F),
+REAL_CONST(0.280273F), REAL_CONST(0.651855F),
+REAL_CONST(0.458923F), REAL_CONST(0.153320F),
+REAL_CONST(0.696716F), REAL_CONST(0.160156F),
+REAL_CONST(0.362915F), REAL_CONST(0.594482F),
+REAL_CONST(0.399414F), REAL_CONST(1.798584F),
+REAL_CONST(0.502808F), REAL_CONST(0.202393F),
+REAL_CONST(0.244141F), REAL_CONST(0.210693F),
+REAL_CONST(0.612305F), REAL_CONST(0.608398F),
+REAL_CONST(0.980042F), REAL_CONST(0.866943F),
+REAL_CONST(1.111084F), REAL_CONST(0.257324F),
+REAL_CONST(0.372498F), REAL_CONST(0.354980F),
+REAL_CONST(0.359131F), REAL_CONST(1.928711F),
+REAL_CONST(1.144531F), REAL_CONST(0.846680F),
+REAL_CONST(0.113770F), REAL_CONST(0.132813F),
+REAL_CONST(0.561401F), REAL_CONST(0.166748F),
+REAL_CONST(0.709412F), REAL_CONST(1.015625F),
+REAL_CONST(0.280396F), REAL_CONST(0.401367F),
+REAL_CONST(0.192749F), REAL_CONST(0.282471F),
+REAL_CONST(0.973694F), REAL_CONST(0.625000F),
+REAL_CONST(0.753723F), REAL_CONST(0.911377F),
+REAL_CONST(1.063232F), REAL_CONST(1.284180F),
+REAL_CONST(0.372681F), REAL_CONST(0.489258F),
+REAL_CONST(0.178040F), REAL_CONST(0.425293F),
+REAL_CONST(1.005066F), REAL_CONST(1.283447F),
+REAL_CONST(1.024597F), REAL_CONST(0.410156F),
+REAL_CONST(1.050110F), REAL_CONST(0.429443F),
+REAL_CONST(0.291321F), REAL_CONST(0.788818F),
+REAL_CONST(0.450806F), REAL_CONST(1.473389F),
+REAL_CONST(0.875366F), REAL_CONST(2.444336F),
+REAL_CONST(0.246277F), REAL_CONST(0.107910F),
+REAL_CONST(0.255981F), REAL_CONST(0.111816F),
+REAL_CONST(0.562378F), REAL_CONST(0.547363F),
+REAL_CONST(0.453308F), REAL_CONST(1.029541F),
+REAL_CONST(0.784912F), REAL_CONST(0.195557F),
+REAL_CONST(0.682739F), REAL_CONST(0.201416F),
+REAL_CONST(0.771973F), REAL_CONST(0.508789F),
+REAL_CONST(0.790771F), REAL_CONST(1.600098F),
+REAL_CONST(0.580139F), REAL_CONST(0.243164F),
+REAL_CONST(0.404602F), REAL_CONST(0.240479F),
+REAL_CONST(0.643127F), REAL_CONST(0.610840F),
+REAL_CONST(0.933167F), REAL_CONST(1.222168F),
+REAL_CONST(0.769165F), REAL_CONST(0.501709F),
+REAL_CONST(0.945068F), REAL_CONST(0.403564F),
+REAL_CONST(0.988403F), REAL_CONST(1.689697F),
+REAL_CONST(0.868591F), REAL_CONST(1.413574F),
+REAL_CONST(0.160278F), REAL_CONST(0.202148F),
+REAL_CONST(0.342712F), REAL_CONST(0.411621F),
+REAL_CONST(0.833923F), REAL_CONST(1.410645F),
+REAL_CONST(0.223877F), REAL_CONST(0.379395F),
+REAL_CONST(0.690491F), REAL_CONST(0.642822F),
+REAL_CONST(0.596313F), REAL_CONST(0.356201F),
+REAL_CONST(0.854675F), REAL_CONST(1.155518F),
+REAL_CONST(0.970276F), REAL_CONST(1.535889F),
+REAL_CONST(0.383179F), REAL_CONST(0.456543F),
+REAL_CONST(0.482788F), REAL_CONST(0.557861F),
+REAL_CONST(1.036255F), REAL_CONST(1.115967F),
+REAL_CONST(1.011719F), REAL_CONST(0.939697F),
+REAL_CONST(0.930664F), REAL_CONST(0.564209F),
+REAL_CONST(0.977966F), REAL_CONST(0.791992F),
+REAL_CONST(0.882507F), REAL_CONST(4.347656F),
+REAL_CONST(0.723083F), REAL_CONST(0.674561F),
+REAL_CONST(0.120911F), REAL_CONST(0.343506F),
+REAL_CONST(0.085449F), REAL_CONST(0.213867F),
+REAL_CONST(0.264587F), REAL_CONST(0.865967F),
+REAL_CONST(0.268005F), REAL_CONST(1.027832F),
+REAL_CONST(0.329895F), REAL_CONST(0.166016F),
+REAL_CONST(1.065735F), REAL_CONST(0.190674F),
+REAL_CONST(0.396790F), REAL_CONST(1.249512F),
+REAL_CONST(0.493835F), REAL_CONST(1.874268F),
+REAL_CONST(0.448914F), REAL_CONST(0.193848F),
+REAL_CONST(0.508606F), REAL_CONST(0.288574F),
+REAL_CONST(0.918030F), REAL_CONST(0.771484F),
+REAL_CONST(0.911133F), REAL_CONST(0.741943F),
+REAL_CONST(1.246399F), REAL_CONST(0.214844F),
+REAL_CONST(0.887756F), REAL_CONST(0.208008F),
+REAL_CONST(0.752991F), REAL_CONST(3.590820F),
+REAL_CONST(0.421387F), REAL_CONST(0.468750F),
+REAL_CONST(0.257874F), REAL_CONST(0.227783F),
+REAL_CONST(0.501587F), REAL_CONST(0.265381F),
+REAL_CONST(0.650574F), REAL_CONST(0.997070F),
+REAL_CONST(0.615356F), REAL_CONST(1.106689F),
+REAL_CONST(0.166931F), REAL_CONST(0.205078F),
+REAL_CONST(1.260803F), REAL_CONST(0.263916F),
+REAL_CONST(1.019958F), REAL_CONST(1.456543F),
+REAL_CONST(0.968811F), REAL_CONST(1.117676F),
+REAL_CONST(0.663513F), REAL_CONST(0.628418F),
+REAL_CONST(0.230286F), REAL_CONST(0.284668F),
+REAL_CONST(0.886169F), REAL_CONST(0.987305F),
+REAL_CONST(1.263367F), REAL_CONST(0.641357F),
+REAL_CONST(0.928894F), REAL_CONST(0.667480F),
+REAL_CONST(0.932251F), REAL_CONST(0.533691F),
+REAL_CONST(0.381897F), REAL_CONST(0.787598F),
+REAL_CONST(0.801086F), REAL_CONST(4.755859F),
+REAL_CONST(0.439209F), REAL_CONST(0.227051F),
+REAL_CONST(0.150269F), REAL_CONST(0.395020F),
+REAL_CONST(0.275574F), REAL_CONST(0.754883F),
+REAL_CONST(0.845459F), REAL_CONST(1.044189F),
+REAL_CONST(0.638428F), REAL_CONST(0.203369F),
+REAL_CONST(1.058289F), REAL_CONST(0.197754F),
+REAL_CONST(1.030945F), REAL_CONST(0.558838F),
+REAL_CONST(0.948853F), REAL_CONST(2.006104F),
+REAL_CONST(0.830261F), REAL_CONST(0.411133F),
+REAL_CONST(0.195129F), REAL_CONST(0.447754F),
+REAL_CONST(0.973389F), REAL_CONST(0.688477F),
+REAL_CONST(0.965088F), REAL_CONST(1.300537F),
+REAL_CONST(1.037964F), REAL_CONST(0.595215F),
+REAL_CONST(1.024658F), REAL_CONST(0.323730F),
+REAL_CONST(0.956482F), REAL_CONST(1.991211F),
+REAL_CONST(0.715698F), REAL_CONST(2.088867F),
+REAL_CONST(0.229614F), REAL_CONST(0.501221F),
+REAL_CONST(0.583679F), REAL_CONST(0.321533F),
+REAL_CONST(0.827698F), REAL_CONST(1.657715F),
+REAL_CONST(0.746277F), REAL_CONST(0.472656F),
+REAL_CONST(0.499268F), REAL_CONST(0.866699F),
+REAL_CONST(0.810974F), REAL_CONST(0.434082F),
+REAL_CONST(0.994812F), REAL_CONST(1.611084F),
+REAL_CONST(0.994324F), REAL_CONST(1.894043F),
+REAL_CONST(0.520081F), REAL_CONST(0.622803F),
+REAL_CONST(0.440979F), REAL_CONST(0.645752F),
+REAL_CONST(1.115051F), REAL_CONST(1.828369F),
+REAL_CONST(1.030579F), REAL_CONST(0.548828F),
+REAL_CONST(1.091431F), REAL_CONST(0.704102F),
+REAL_CONST(1.053772F), REAL_CONST(0.812500F),
+REAL_CONST(0.574768F), REAL_CONST(4.922363F),
+REAL_CONST(0.673950F), REAL_CONST(2.031250F),
+REAL_CONST(0.078491F), REAL_CONST(0.151367F),
+REAL_CONST(0.087341F), REAL_CONST(0.142334F),
+REAL_CONST(0.365784F), REAL_CONST(0.558838F),
+REAL_CONST(0.242798F), REAL_CONST(0.885254F),
+REAL_CONST(0.313965F), REAL_CONST(0.183594F),
+REAL_CONST(0.818420F), REAL_CONST(0.202637F),
+REAL_CONST(0.338928F), REAL_CONST(0.698242F),
+REAL_CONST(0.718018F), REAL_CONST(1.442383F),
+REAL_CONST(0.655334F), REAL_CONST(0.136719F),
+REAL_CONST(0.332397F), REAL_CONST(0.137695F),
+REAL_CONST(0.813049F), REAL_CONST(0.734375F),
+REAL_CONST(0.729126F), REAL_CONST(0.899170F),
+REAL_CONST(1.213806F), REAL_CONST(0.194824F),
+REAL_CONST(0.599670F), REAL_CONST(0.177734F),
+REAL_CONST(0.833923F), REAL_CONST(2.135742F),
+REAL_CONST(0.451111F), REAL_CONST(0.745361F),
+REAL_CONST(0.153503F), REAL_CONST(0.189941F),
+REAL_CONST(0.369263F), REAL_CONST(0.203369F),
+REAL_CONST(0.394836F), REAL_CONST(1.238770F),
+REAL_CONST(0.506897F), REAL_CONST(0.601318F),
+REAL_CONST(0.374817F), REAL_CONST(0.455322F),
+REAL_CONST(0.934326F), REAL_CONST(0.308105F),
+REAL_CONST(0.879395F), REAL_CONST(1.110107F),
+REAL_CONST(0.833923F), REAL_CONST(1.102295F),
+REAL_CONST(0.191467F), REAL_CONST(0.728271F),
+REAL_CONST(0.151306F), REAL_CONST(0.307373F),
+REAL_CONST(0.920898F), REAL_CONST(1.134521F),
+REAL_CONST(0.938843F), REAL_CONST(0.636475F),
+REAL_CONST(0.884521F), REAL_CONST(0.583984F),
+REAL_CONST(0.760620F), REAL_CONST(0.619385F),
+REAL_CONST(0.460144F), REAL_CONST(0.719971F),
+REAL_CONST(0.787903F), REAL_CONST(2.944336F),
+REAL_CONST(0.333740F), REAL_CONST(0.166992F),
+REAL_CONST(0.191711F), REAL_CONST(0.176270F),
+REAL_CONST(0.310120F), REAL_CONST(0.311035F),
+REAL_CONST(0.777100F), REAL_CONST(1.025391F),
+REAL_CONST(0.933960F), REAL_CONST(0.166260F),
+REAL_CONST(0.477234F), REAL_CONST(0.144531F),
+REAL_CONST(0.398804F), REAL_CONST(0.493408F),
+REAL_CONST(1.005737F), REAL_CONST(2.133057F),
+REAL_CONST(0.815674F), REAL_CONST(0.215332F),
+REAL_CONST(0.329407F), REAL_CONST(0.219482F),
+REAL_CONST(0.894531F), REAL_CONST(0.531738F),
+REAL_CONST(0.899719F), REAL_CONST(1.031982F),
+REAL_CONST(0.870972F), REAL_CONST(0.316895F),
+REAL_CONST(0.850159F), REAL_CONST(0.495361F),
+REAL_CONST(0.944641F), REAL_CONST(1.826660F),
+REAL_CONST(0.965271F), REAL_CONST(1.116211F),
+REAL_CONST(0.153870F), REAL_CONST(0.491455F),
+REAL_CONST(0.308960F), REAL_CONST(0.440430F),
+REAL_CONST(0.314880F), REAL_CONST(1.606934F),
+REAL_CONST(0.435181F), REAL_CONST(0.878174F),
+REAL_CONST(0.666504F), REAL_CONST(0.393311F),
+REAL_CONST(0.715881F), REAL_CONST(0.416992F),
+REAL_CONST(1.031677F), REAL_CONST(0.843506F),
+REAL_CONST(0.992920F), REAL_CONST(1.621094F),
+REAL_CONST(0.567993F), REAL_CONST(0.245850F),
+REAL_CONST(0.571838F), REAL_CONST(0.514160F),
+REAL_CONST(1.170776F), REAL_CONST(1.229736F),
+REAL_CONST(0.759338F), REAL_CONST(1.042236F),
+REAL_CONST(0.971619F), REAL_CONST(0.325195F),
+REAL_CONST(0.937317F), REAL_CONST(0.857422F),
+REAL_CONST(0.726196F), REAL_CONST(3.452393F),
+REAL_CONST(0.982727F), REAL_CONST(1.673340F),
+REAL_CONST(0.122681F), REAL_CONST(0.179932F),
+REAL_CONST(0.230652F), REAL_CONST(0.210205F),
+REAL_CONST(0.699097F), REAL_CONST(0.703125F),
+REAL_CONST(0.217529F), REAL_CONST(0.864258F),
+REAL_CONST(0.552795F), REAL_CONST(0.302979F),
+REAL_CONST(0.756287F), REAL_CONST(0.218750F),
+REAL_CONST(0.521606F), REAL_CONST(1.130127F),
+REAL_CONST(0.705627F), REAL_CONST(1.410156F),
+REAL_CONST(0.496155F), REAL_CONST(0.143799F),
+REAL_CONST(0.501587F), REAL_CONST(0.143555F),
+REAL_CONST(1.143066F), REAL_CONST(0.916748F),
+REAL_CONST(0.791809F), REAL_CONST(0.768799F),
+REAL_CONST(0.960022F), REAL_CONST(0.185059F),
+REAL_CONST(1.015259F), REAL_CONST(0.184082F),
+REAL_CONST(0.929077F), REAL_CONST(2.719238F),
+REAL_CONST(0.968689F), REAL_CONST(0.539063F),
+REAL_CONST(0.285217F), REAL_CONST(0.148926F),
+REAL_CONST(0.623657F), REAL_CONST(0.165527F),
+REAL_CONST(0.931213F), REAL_CONST(1.012207F),
+REAL_CONST(0.349670F), REAL_CONST(0.812256F),
+REAL_CONST(0.511292F), REAL_CONST(0.407715F),
+REAL_CONST(1.212280F), REAL_CONST(0.566650F),
+REAL_CONST(0.942993F), REAL_CONST(1.345459F),
+REAL_CONST(0.857788F), REAL_CONST(1.338135F),
+REAL_CONST(0.349609F), REAL_CONST(0.705078F),
+REAL_CONST(0.462646F), REAL_CONST(0.328613F),
+REAL_CONST(0.877930F), REAL_CONST(1.300049F),
+REAL_CONST(0.990967F), REAL_CONST(0.964355F),
+REAL_CONST(0.922729F), REAL_CONST(0.914063F),
+REAL_CONST(0.934204F), REAL_CONST(0.350342F),
+REAL_CONST(0.890930F), REAL_CONST(0.993652F),
+REAL_CONST(0.750793F), REAL_CONST(3.832031F),
+REAL_CONST(0.464905F), REAL_CONST(0.414795F),
+REAL_CONST(0.132446F), REAL_CONST(0.215820F),
+REAL_CONST(0.272156F), REAL_CONST(1.114990F),
+REAL_CONST(1.104370F), REAL_CONST(0.807129F),
+REAL_CONST(0.777710F), REAL_CONST(0.198975F),
+REAL_CONST(0.911011F), REAL_CONST(0.221436F),
+REAL_CONST(0.916504F), REAL_CONST(1.045166F),
+REAL_CONST(0.947144F), REAL_CONST(2.042969F),
+REAL_CONST(1.098267F), REAL_CONST(0.265381F),
+REAL_CONST(0.143921F), REAL_CONST(0.211182F),
+REAL_CONST(0.993713F), REAL_CONST(0.924561F),
+REAL_CONST(0.956970F), REAL_CONST(1.122070F),
+REAL_CONST(0.998291F), REAL_CONST(0.374512F),
+REAL_CONST(1.012207F), REAL_CONST(0.539551F),
+REAL_CONST(1.027405F), REAL_CONST(2.367432F),
+REAL_CONST(0.972229F), REAL_CONST(1.101807F),
+REAL_CONST(0.200012F), REAL_CONST(0.264893F),
+REAL_CONST(0.588562F), REAL_CONST(0.533936F),
+REAL_CONST(0.730774F), REAL_CONST(1.481445F),
+REAL_CONST(0.561462F), REAL_CONST(1.089355F),
+REAL_CONST(0.546570F), REAL_CONST(0.397705F),
+REAL_CONST(0.627991F), REAL_CONST(0.747559F),
+REAL_CONST(1.005920F), REAL_CONST(1.258545F),
+REAL_CONST(0.943970F), REAL_CONST(1.725098F),
+REAL_CONST(0.834839F), REAL_CONST(0.620850F),
+REAL_CONST(0.321838F), REAL_CONST(0.555908F),
+REAL_CONST(1.022095F), REAL_CONST(1.516846F),
+REAL_CONST(1.016541F), REAL_CONST(0.832031F),
+REAL_CONST(1.239258F), REAL_CONST(0.821045F),
+REAL_CONST(1.140625F), REAL_CONST(0.484619F),
+REAL_CONST(0.864990F), REAL_CONST(3.141357F),
+REAL_CONST(0.924927F), REAL_CONST(3.833740F),
+REAL_CONST(0.273010F), REAL_CONST(0.249023F),
+REAL_CONST(0.102600F), REAL_CONST(0.216309F),
+REAL_CONST(0.263123F), REAL_CONST(1.050049F),
+REAL_CONST(0.546387F), REAL_CONST(0.892822F),
+REAL_CONST(0.359680F), REAL_CONST(0.280029F),
+REAL_CONST(0.710876F), REAL_CONST(0.354492F),
+REAL_CONST(0.969604F), REAL_CONST(0.543701F),
+REAL_CONST(0.279663F), REAL_CONST(1.622070F),
+REAL_CONST(0.422913F), REAL_CONST(0.294189F),
+REAL_CONST(0.379639F), REAL_CONST(0.195068F),
+REAL_CONST(0.757751F), REAL_CONST(0.832275F),
+REAL_CONST(0.974609F), REAL_CONST(0.946533F),
+REAL_CONST(1.212097F), REAL_CONST(0.514893F),
+REAL_CONST(0.591370F), REAL_CONST(0.522705F),
+REAL_CONST(0.899780F), REAL_CONST(2.155762F),
+REAL_CONST(0.883789F), REAL_CONST(0.634521F),
+REAL_CONST(0.110901F), REAL_CONST(0.302246F),
+REAL_CONST(0.474304F), REAL_CONST(0.198486F),
+REAL_CONST(1.164490F), REAL_CONST(1.076660F),
+REAL_CONST(0.338989F), REAL_CONST(0.503906F),
+REAL_CONST(0.225037F), REAL_CONST(0.694336F),
+REAL_CONST(1.064148F), REAL_CONST(0.550781F),
+REAL_CONST(1.019104F), REAL_CONST(1.095215F),
+REAL_CONST(0.988708F), REAL_CONST(1.315430F),
+REAL_CONST(0.489990F), REAL_CONST(0.674561F),
+REAL_CONST(0.207825F), REAL_CONST(0.517334F),
+REAL_CONST(1.063599F), REAL_CONST(1.337158F),
+REAL_CONST(0.836060F), REAL_CONST(0.680176F),
+REAL_CONST(1.213318F), REAL_CONST(0.664063F),
+REAL_CONST(0.555298F), REAL_CONST(0.947266F),
+REAL_CONST(1.109131F), REAL_CONST(1.179932F),
+REAL_CONST(1.058105F), REAL_CONST(2.980225F),
+REAL_CONST(0.312256F), REAL_CONST(0.243164F),
+REAL_CONST(0.301208F), REAL_CONST(0.241211F),
+REAL_CONST(0.603516F), REAL_CONST(0.752197F),
+REAL_CONST(0.367065F), REAL_CONST(1.311279F),
+REAL_CONST(0.969299F), REAL_CONST(0.406982F),
+REAL_CONST(0.513000F), REAL_CONST(0.288818F),
+REAL_CONST(0.920837F), REAL_CONST(0.577637F),
+REAL_CONST(1.207092F), REAL_CONST(1.709473F),
+REAL_CONST(0.730164F), REAL_CONST(0.381348F),
+REAL_CONST(0.444275F), REAL_CONST(0.275391F),
+REAL_CONST(1.028992F), REAL_CONST(0.374023F),
+REAL_CONST(0.962036F), REAL_CONST(1.313721F),
+REAL_CONST(0.897705F), REAL_CONST(0.504150F),
+REAL_CONST(1.227112F), REAL_CONST(0.526123F),
+REAL_CONST(1.047241F), REAL_CONST(2.012939F),
+REAL_CONST(1.093201F), REAL_CONST(1.542480F),
+REAL_CONST(0.333679F), REAL_CONST(0.367188F),
+REAL_CONST(0.250244F), REAL_CONST(0.628418F),
+REAL_CONST(1.063293F), REAL_CONST(1.662598F),
+REAL_CONST(0.346252F), REAL_CONST(0.705078F),
+REAL_CONST(1.015381F), REAL_CONST(0.825684F),
+REAL_CONST(0.547791F), REAL_CONST(0.447021F),
+REAL_CONST(1.230408F), REAL_CONST(1.156494F),
+REAL_CONST(1.193237F), REAL_CONST(1.780762F),
+REAL_CONST(0.406372F), REAL_CONST(0.678955F),
+REAL_CONST(0.700195F), REAL_CONST(0.810791F),
+REAL_CONST(1.183899F), REAL_CONST(1.233887F),
+REAL_CONST(1.152222F), REAL_CONST(1.152832F),
+REAL_CONST(1.003357F), REAL_CONST(0.579346F),
+REAL_CONST(1.246948F), REAL_CONST(1.070801F),
+REAL_CONST(0.692932F), REAL_CONST(6.476074F),
+REAL_CONST(0.707581F), REAL_CONST(0.749023F),
+REAL_CONST(0.174927F), REAL_CONST(0.382324F),
+REAL_CONST(0.311768F), REAL_CONST(0.261230F),
+REAL_CONST(0.586792F), REAL_CONST(1.199951F),
+REAL_CONST(0.301453F), REAL_CONST(0.863281F),
+REAL_CONST(0.460266F), REAL_CONST(0.214355F),
+REAL_CONST(1.264465F), REAL_CONST(0.207764F),
+REAL_CONST(0.423462F), REAL_CONST(1.072998F),
+REAL_CONST(1.025330F), REAL_CONST(1.887939F),
+REAL_CONST(0.618713F), REAL_CONST(0.248779F),
+REAL_CONST(0.600891F), REAL_CONST(0.235352F),
+REAL_CONST(0.945679F), REAL_CONST(0.965576F),
+REAL_CONST(0.943542F), REAL_CONST(0.837402F),
+REAL_CONST(1.151306F), REAL_CONST(0.239746F),
+REAL_CONST(1.228027F), REAL_CONST(0.235107F),
+REAL_CONST(1.030029F), REAL_CONST(3.146240F),
+REAL_CONST(0.874878F), REAL_CONST(1.025391F),
+REAL_CONST(0.402771F), REAL_CONST(0.297852F),
+REAL_CONST(0.562866F), REAL_CONST(0.198730F),
+REAL_CONST(1.034058F), REAL_CONST(1.253418F),
+REAL_CONST(0.345520F), REAL_CONST(1.195801F),
+REAL_CONST(0.334961F), REAL_CONST(0.438965F),
+REAL_CONST(1.236450F), REAL_CONST(0.967285F),
+REAL_CONST(1.037903F), REAL_CONST(1.508301F),
+REAL_CONST(1.094299F), REAL_CONST(1.447510F),
+REAL_CONST(0.571594F), REAL_CONST(0.834961F),
+REAL_CONST(0.456177F), REAL_CONST(0.481201F),
+REAL_CONST(1.192444F), REAL_CONST(1.263916F),
+REAL_CONST(1.159851F), REAL_CONST(0.733887F),
+REAL_CONST(1.004272F), REAL_CONST(0.924805F),
+REAL_CONST(0.980835F), REAL_CONST(0.577881F),
+REAL_CONST(0.528809F), REAL_CONST(0.669678F),
+REAL_CONST(0.576477F), REAL_CONST(6.435059F),
+REAL_CONST(0.662598F), REAL_CONST(0.314209F),
+REAL_CONST(0.216980F), REAL_CONST(0.246338F),
+REAL_CONST(0.342163F), REAL_CONST(0.884277F),
+REAL_CONST(1.187317F), REAL_CONST(1.345703F),
+REAL_CONST(0.760071F), REAL_CONST(0.194580F),
+REAL_CONST(1.259399F), REAL_CONST(0.222412F),
+REAL_CONST(0.941589F), REAL_CONST(0.748535F),
+REAL_CONST(1.039856F), REAL_CONST(2.508545F),
+REAL_CONST(1.152527F), REAL_CONST(0.642822F),
+REAL_CONST(0.238831F), REAL_CONST(0.309570F),
+REAL_CONST(1.191345F), REAL_CONST(0.822998F),
+REAL_CONST(1.101807F), REAL_CONST(1.276855F),
+REAL_CONST(1.177429F), REAL_CONST(0.409668F),
+REAL_CONST(1.190674F), REAL_CONST(0.774414F),
+REAL_CONST(1.103027F), REAL_CONST(2.625488F),
+REAL_CONST(1.014709F), REAL_CONST(1.671143F),
+REAL_CONST(0.191284F), REAL_CONST(0.561035F),
+REAL_CONST(0.663391F), REAL_CONST(0.594971F),
+REAL_CONST(0.950928F), REAL_CONST(1.687744F),
+REAL_CONST(0.768860F), REAL_CONST(0.825439F),
+REAL_CONST(0.678467F), REAL_CONST(0.804932F),
+REAL_CONST(1.023071F), REAL_CONST(0.591797F),
+REAL_CONST(1.150696F), REAL_CONST(1.639404F),
+REAL_CONST(1.048035F), REAL_CONST(2.413818F),
+REAL_CONST(0.777771F), REAL_CONST(0.635986F),
+REAL_CONST(0.545471F), REAL_CONST(0.766602F),
+REAL_CONST(1.161682F), REAL_CONST(1.895508F),
+REAL_CONST(1.119812F), REAL_CONST(0.947266F),
+REAL_CONST(1.249695F), REAL_CONST(0.898926F),
+REAL_CONST(1.196411F), REAL_CONST(0.825195F),
+REAL_CONST(0.796143F), REAL_CONST(4.729736F),
+REAL_CONST(0.642456F), REAL_CONST(5.645508F),
 
 };
 
@@ -11594,209 +11592,209 @@ static const Float32 table_gain_MR475[MR475_VQ_SIZE * 4] =
  */
 /* table used in 'high' rates: MR67 MR74 MR102 */
 #define VQ_SIZE_HIGHRATES 128
-static const Float32 table_highrates[VQ_SIZE_HIGHRATES * 2] =
+static const real_t table_highrates[VQ_SIZE_HIGHRATES * 2] =
 {
    /*g_pit,    g_fac,   */
-   0.0352173F,   0.161621F,
-   0.0491943F,   0.448242F,
-   0.189758F,   0.256836F,
-   0.255188F,   0.338623F,
-   0.144836F,   0.347900F,
-   0.198242F,   0.484619F,
-   0.111511F,   0.566406F,
-   0.0574341F,   0.809082F,
-   0.143494F,   0.726807F,
-   0.220703F,   0.590820F,
-   0.210632F,   0.755859F,
-   0.180359F,   1.05005F,
-   0.112793F,   1.09863F,
-   0.237061F,   1.32227F,
-   0.0724487F,   1.76025F,
-   0.188171F,   2.19727F,
-   0.450684F,   0.215576F,
-   0.363892F,   0.367676F,
-   0.314636F,   0.520996F,
-   0.484863F,   0.490479F,
-   0.397156F,   0.549316F,
-   0.468140F,   0.671875F,
-   0.363281F,   0.736328F,
-   0.298950F,   0.918945F,
-   0.426575F,   0.875977F,
-   0.498901F,   0.971191F,
-   0.370117F,   1.07520F,
-   0.470520F,   1.24194F,
-   0.337097F,   1.46997F,
-   0.474182F,   1.73975F,
-   0.369873F,   1.93799F,
-   0.341431F,   2.80444F,
-   0.645813F,   0.331055F,
-   0.552307F,   0.389893F,
-   0.597778F,   0.496826F,
-   0.546021F,   0.589600F,
-   0.628418F,   0.630859F,
-   0.574158F,   0.667480F,
-   0.531006F,   0.785645F,
-   0.595520F,   0.828857F,
-   0.621155F,   0.950195F,
-   0.559692F,   1.10547F,
-   0.619629F,   1.22168F,
-   0.556274F,   1.40015F,
-   0.640869F,   1.52979F,
-   0.617065F,   1.86304F,
-   0.539795F,   2.13062F,
-   0.546631F,   3.05078F,
-   0.788818F,   0.238281F,
-   0.697937F,   0.428467F,
-   0.740845F,   0.568359F,
-   0.695068F,   0.578125F,
-   0.653076F,   0.748047F,
-   0.752686F,   0.698486F,
-   0.715454F,   0.812256F,
-   0.687866F,   0.903320F,
-   0.662903F,   1.07739F,
-   0.737427F,   1.10669F,
-   0.688660F,   1.27075F,
-   0.729980F,   1.53931F,
-   0.681580F,   1.83936F,
-   0.740234F,   2.03345F,
-   0.669495F,   2.63110F,
-   0.628662F,   4.24219F,
-   0.848328F,   0.410400F,
-   0.767822F,   0.499268F,
-   0.809631F,   0.595459F,
-   0.856506F,   0.729736F,
-   0.821045F,   0.756348F,
-   0.756592F,   0.893066F,
-   0.824585F,   0.922852F,
-   0.786133F,   1.04297F,
-   0.825989F,   1.18677F,
-   0.773132F,   1.33228F,
-   0.845581F,   1.49072F,
-   0.795349F,   1.58276F,
-   0.827454F,   1.88501F,
-   0.790833F,   2.27319F,
-   0.837036F,   2.82007F,
-   0.768494F,   3.71240F,
-   0.922424F,   0.375977F,
-   0.919922F,   0.569580F,
-   0.886658F,   0.613037F,
-   0.896729F,   0.781006F,
-   0.938843F,   0.869141F,
-   0.862610F,   0.966797F,
-   0.921753F,   1.03418F,
-   0.874756F,   1.17773F,
-   0.906128F,   1.33081F,
-   0.934204F,   1.48511F,
-   0.874573F,   1.68164F,
-   0.919189F,   1.87720F,
-   0.879272F,   2.30127F,
-   0.939148F,   2.37817F,
-   0.904785F,   3.48413F,
-   0.830078F,   6.08862F,
-   1.00073F,   0.480713F,
-   1.02643F,   0.691406F,
-   0.959045F,   0.694092F,
-   0.982910F,   0.814453F,
-   1.00000F,   0.967529F,
-   1.03394F,   1.11792F,
-   0.958923F,   1.12280F,
-   0.990112F,   1.33008F,
-   1.02734F,   1.55811F,
-   0.960999F,   1.74341F,
-   0.996460F,   1.82349F,
-   1.01385F,   2.10547F,
-   1.03931F,   2.54346F,
-   0.970764F,   2.88501F,
-   1.03015F,   3.58643F,
-   1.00800F,   5.09521F,
-   1.10730F,   0.508545F,
-   1.18414F,   0.775879F,
-   1.06860F,   0.836426F,
-   1.22400F,   0.983154F,
-   1.10284F,   1.03735F,
-   1.15674F,   1.23682F,
-   1.08099F,   1.31885F,
-   1.21063F,   1.51172F,
-   1.09558F,   1.71240F,
-   1.30115F,   1.92310F,
-   1.09314F,   2.26782F,
-   1.16846F,   2.26807F,
-   1.25226F,   2.77856F,
-   1.10321F,   3.53638F,
-   1.22064F,   4.36572F,
-   1.15002F,   7.99902F
+   REAL_CONST(0.0352173F),   REAL_CONST(0.161621F),
+   REAL_CONST(0.0491943F),   REAL_CONST(0.448242F),
+   REAL_CONST(0.189758F),   REAL_CONST(0.256836F),
+   REAL_CONST(0.255188F),   REAL_CONST(0.338623F),
+   REAL_CONST(0.144836F),   REAL_CONST(0.347900F),
+   REAL_CONST(0.198242F),   REAL_CONST(0.484619F),
+   REAL_CONST(0.111511F),   REAL_CONST(0.566406F),
+   REAL_CONST(0.0574341F),   REAL_CONST(0.809082F),
+   REAL_CONST(0.143494F),   REAL_CONST(0.726807F),
+   REAL_CONST(0.220703F),   REAL_CONST(0.590820F),
+   REAL_CONST(0.210632F),   REAL_CONST(0.755859F),
+   REAL_CONST(0.180359F),   REAL_CONST(1.05005F),
+   REAL_CONST(0.112793F),   REAL_CONST(1.09863F),
+   REAL_CONST(0.237061F),   REAL_CONST(1.32227F),
+   REAL_CONST(0.0724487F),   REAL_CONST(1.76025F),
+   REAL_CONST(0.188171F),   REAL_CONST(2.19727F),
+   REAL_CONST(0.450684F),   REAL_CONST(0.215576F),
+   REAL_CONST(0.363892F),   REAL_CONST(0.367676F),
+   REAL_CONST(0.314636F),   REAL_CONST(0.520996F),
+   REAL_CONST(0.484863F),   REAL_CONST(0.490479F),
+   REAL_CONST(0.397156F),   REAL_CONST(0.549316F),
+   REAL_CONST(0.468140F),   REAL_CONST(0.671875F),
+   REAL_CONST(0.363281F),   REAL_CONST(0.736328F),
+   REAL_CONST(0.298950F),   REAL_CONST(0.918945F),
+   REAL_CONST(0.426575F),   REAL_CONST(0.875977F),
+   REAL_CONST(0.498901F),   REAL_CONST(0.971191F),
+   REAL_CONST(0.370117F),   REAL_CONST(1.07520F),
+   REAL_CONST(0.470520F),   REAL_CONST(1.24194F),
+   REAL_CONST(0.337097F),   REAL_CONST(1.46997F),
+   REAL_CONST(0.474182F),   REAL_CONST(1.73975F),
+   REAL_CONST(0.369873F),   REAL_CONST(1.93799F),
+   REAL_CONST(0.341431F),   REAL_CONST(2.80444F),
+   REAL_CONST(0.645813F),   REAL_CONST(0.331055F),
+   REAL_CONST(0.552307F),   REAL_CONST(0.389893F),
+   REAL_CONST(0.597778F),   REAL_CONST(0.496826F),
+   REAL_CONST(0.546021F),   REAL_CONST(0.589600F),
+   REAL_CONST(0.628418F),   REAL_CONST(0.630859F),
+   REAL_CONST(0.574158F),   REAL_CONST(0.667480F),
+   REAL_CONST(0.531006F),   REAL_CONST(0.785645F),
+   REAL_CONST(0.595520F),   REAL_CONST(0.828857F),
+   REAL_CONST(0.621155F),   REAL_CONST(0.950195F),
+   REAL_CONST(0.559692F),   REAL_CONST(1.10547F),
+   REAL_CONST(0.619629F),   REAL_CONST(1.22168F),
+   REAL_CONST(0.556274F),   REAL_CONST(1.40015F),
+   REAL_CONST(0.640869F),   REAL_CONST(1.52979F),
+   REAL_CONST(0.617065F),   REAL_CONST(1.86304F),
+   REAL_CONST(0.539795F),   REAL_CONST(2.13062F),
+   REAL_CONST(0.546631F),   REAL_CONST(3.05078F),
+   REAL_CONST(0.788818F),   REAL_CONST(0.238281F),
+   REAL_CONST(0.697937F),   REAL_CONST(0.428467F),
+   REAL_CONST(0.740845F),   REAL_CONST(0.568359F),
+   REAL_CONST(0.695068F),   REAL_CONST(0.578125F),
+   REAL_CONST(0.653076F),   REAL_CONST(0.748047F),
+   REAL_CONST(0.752686F),   REAL_CONST(0.698486F),
+   REAL_CONST(0.715454F),   REAL_CONST(0.812256F),
+   REAL_CONST(0.687866F),   REAL_CONST(0.903320F),
+   REAL_CONST(0.662903F),   REAL_CONST(1.07739F),
+   REAL_CONST(0.737427F),   REAL_CONST(1.10669F),
+   REAL_CONST(0.688660F),   REAL_CONST(1.27075F),
+   REAL_CONST(0.729980F),   REAL_CONST(1.53931F),
+   REAL_CONST(0.681580F),   REAL_CONST(1.83936F),
+   REAL_CONST(0.740234F),   REAL_CONST(2.03345F),
+   REAL_CONST(0.669495F),   REAL_CONST(2.63110F),
+   REAL_CONST(0.628662F),   REAL_CONST(4.24219F),
+   REAL_CONST(0.848328F),   REAL_CONST(0.410400F),
+   REAL_CONST(0.767822F),   REAL_CONST(0.499268F),
+   REAL_CONST(0.809631F),   REAL_CONST(0.595459F),
+   REAL_CONST(0.856506F),   REAL_CONST(0.729736F),
+   REAL_CONST(0.821045F),   REAL_CONST(0.756348F),
+   REAL_CONST(0.756592F),   REAL_CONST(0.893066F),
+   REAL_CONST(0.824585F),   REAL_CONST(0.922852F),
+   REAL_CONST(0.786133F),   REAL_CONST(1.04297F),
+   REAL_CONST(0.825989F),   REAL_CONST(1.18677F),
+   REAL_CONST(0.773132F),   REAL_CONST(1.33228F),
+   REAL_CONST(0.845581F),   REAL_CONST(1.49072F),
+   REAL_CONST(0.795349F),   REAL_CONST(1.58276F),
+   REAL_CONST(0.827454F),   REAL_CONST(1.88501F),
+   REAL_CONST(0.790833F),   REAL_CONST(2.27319F),
+   REAL_CONST(0.837036F),   REAL_CONST(2.82007F),
+   REAL_CONST(0.768494F),   REAL_CONST(3.71240F),
+   REAL_CONST(0.922424F),   REAL_CONST(0.375977F),
+   REAL_CONST(0.919922F),   REAL_CONST(0.569580F),
+   REAL_CONST(0.886658F),   REAL_CONST(0.613037F),
+   REAL_CONST(0.896729F),   REAL_CONST(0.781006F),
+   REAL_CONST(0.938843F),   REAL_CONST(0.869141F),
+   REAL_CONST(0.862610F),   REAL_CONST(0.966797F),
+   REAL_CONST(0.921753F),   REAL_CONST(1.03418F),
+   REAL_CONST(0.874756F),   REAL_CONST(1.17773F),
+   REAL_CONST(0.906128F),   REAL_CONST(1.33081F),
+   REAL_CONST(0.934204F),   REAL_CONST(1.48511F),
+   REAL_CONST(0.874573F),   REAL_CONST(1.68164F),
+   REAL_CONST(0.919189F),   REAL_CONST(1.87720F),
+   REAL_CONST(0.879272F),   REAL_CONST(2.30127F),
+   REAL_CONST(0.939148F),   REAL_CONST(2.37817F),
+   REAL_CONST(0.904785F),   REAL_CONST(3.48413F),
+   REAL_CONST(0.830078F),   REAL_CONST(6.08862F),
+   REAL_CONST(1.00073F),   REAL_CONST(0.480713F),
+   REAL_CONST(1.02643F),   REAL_CONST(0.691406F),
+   REAL_CONST(0.959045F),   REAL_CONST(0.694092F),
+   REAL_CONST(0.982910F),   REAL_CONST(0.814453F),
+   REAL_CONST(1.00000F),   REAL_CONST(0.967529F),
+   REAL_CONST(1.03394F),   REAL_CONST(1.11792F),
+   REAL_CONST(0.958923F),   REAL_CONST(1.12280F),
+   REAL_CONST(0.990112F),   REAL_CONST(1.33008F),
+   REAL_CONST(1.02734F),   REAL_CONST(1.55811F),
+   REAL_CONST(0.960999F),   REAL_CONST(1.74341F),
+   REAL_CONST(0.996460F),   REAL_CONST(1.82349F),
+   REAL_CONST(1.01385F),   REAL_CONST(2.10547F),
+   REAL_CONST(1.03931F),   REAL_CONST(2.54346F),
+   REAL_CONST(0.970764F),   REAL_CONST(2.88501F),
+   REAL_CONST(1.03015F),   REAL_CONST(3.58643F),
+   REAL_CONST(1.00800F),   REAL_CONST(5.09521F),
+   REAL_CONST(1.10730F),   REAL_CONST(0.508545F),
+   REAL_CONST(1.18414F),   REAL_CONST(0.775879F),
+   REAL_CONST(1.06860F),   REAL_CONST(0.836426F),
+   REAL_CONST(1.22400F),   REAL_CONST(0.983154F),
+   REAL_CONST(1.10284F),   REAL_CONST(1.03735F),
+   REAL_CONST(1.15674F),   REAL_CONST(1.23682F),
+   REAL_CONST(1.08099F),   REAL_CONST(1.31885F),
+   REAL_CONST(1.21063F),   REAL_CONST(1.51172F),
+   REAL_CONST(1.09558F),   REAL_CONST(1.71240F),
+   REAL_CONST(1.30115F),   REAL_CONST(1.92310F),
+   REAL_CONST(1.09314F),   REAL_CONST(2.26782F),
+   REAL_CONST(1.16846F),   REAL_CONST(2.26807F),
+   REAL_CONST(1.25226F),   REAL_CONST(2.77856F),
+   REAL_CONST(1.10321F),   REAL_CONST(3.53638F),
+   REAL_CONST(1.22064F),   REAL_CONST(4.36572F),
+   REAL_CONST(1.15002F),   REAL_CONST(7.99902F)
 };
 
 
 /* table used in 'low' rates: MR475, MR515, MR59 */
 #define VQ_SIZE_LOWRATES 64
-static const Float32 table_lowrates[VQ_SIZE_LOWRATES * 2] =
+static const real_t table_lowrates[VQ_SIZE_LOWRATES * 2] =
 {
    /*g_pit,    g_fac */
-   0.659973F,   7.01978F,
-   1.25000F,   0.679932F,
-   1.14996F,   1.60986F,
-   0.379944F,   1.80981F,
-   1.04999F,   2.54980F,
-   1.31995F,   0.309814F,
-   1.28998F,   1.07983F,
-   0.689941F,   0.379883F,
-   1.15997F,   3.12988F,
-   1.06000F,   0.609863F,
-   1.08997F,   1.17993F,
-   0.609985F,   0.609863F,
-   1.06995F,   1.91992F,
-   0.869995F,   0.459961F,
-   0.969971F,   0.769775F,
-   0.409973F,   0.439941F,
-   1.10999F,   4.92993F,
-   1.09998F,   0.739990F,
-   1.01996F,   1.42993F,
-   0.539978F,   0.979980F,
-   0.969971F,   2.18994F,
-   1.09998F,   0.339844F,
-   1.01996F,   1.00000F,
-   0.500000F,   0.159912F,
-   0.929993F,   3.39990F,
-   0.869995F,   0.759766F,
-   0.859985F,   1.13989F,
-   0.329956F,   0.659912F,
-   0.819946F,   1.59985F,
-   0.759949F,   0.219971F,
-   0.759949F,   0.649902F,
-   0.229980F,   0.159912F,
-   0.899963F,   5.73999F,
-   1.16998F,   0.599854F,
-   1.22998F,   1.23999F,
-   0.419983F,   1.00000F,
-   1.25000F,   2.08984F,
-   1.19995F,   0.179932F,
-   1.15997F,   1.03979F,
-   0.479980F,   0.509766F,
-   0.699951F,   3.00000F,
-   0.969971F,   0.359863F,
-   0.959961F,   1.12988F,
-   0.559998F,   0.349854F,
-   0.979980F,   1.70996F,
-   0.904968F,   0.179932F,
-   0.919983F,   0.549805F,
-   0.309998F,   0.299805F,
-   0.809998F,   4.22998F,
-   1.00995F,   0.569824F,
-   0.919983F,   1.41992F,
-   0.239990F,   0.899902F,
-   0.869995F,   2.09985F,
-   1.02997F,   0.189941F,
-   0.919983F,   0.929932F,
-   0.369995F,   0.149902F,
-   0.569946F,   2.25977F,
-   0.809998F,   0.429932F,
-   0.809998F,   0.859863F,
-   0.149963F,   0.479980F,
-   0.699951F,   1.34985F,
-   0.639954F,   0.179932F,
-   0.709961F,   0.779785F,
-   0.0899658F,   0.189941F
+   REAL_CONST(0.659973F),   REAL_CONST(7.01978F),
+   REAL_CONST(1.25000F),   REAL_CONST(0.679932F),
+   REAL_CONST(1.14996F),   REAL_CONST(1.60986F),
+   REAL_CONST(0.379944F),   REAL_CONST(1.80981F),
+   REAL_CONST(1.04999F),   REAL_CONST(2.54980F),
+   REAL_CONST(1.31995F),   REAL_CONST(0.309814F),
+   REAL_CONST(1.28998F),   REAL_CONST(1.07983F),
+   REAL_CONST(0.689941F),   REAL_CONST(0.379883F),
+   REAL_CONST(1.15997F),   REAL_CONST(3.12988F),
+   REAL_CONST(1.06000F),   REAL_CONST(0.609863F),
+   REAL_CONST(1.08997F),   REAL_CONST(1.17993F),
+   REAL_CONST(0.609985F),   REAL_CONST(0.609863F),
+   REAL_CONST(1.06995F),   REAL_CONST(1.91992F),
+   REAL_CONST(0.869995F),   REAL_CONST(0.459961F),
+   REAL_CONST(0.969971F),   REAL_CONST(0.769775F),
+   REAL_CONST(0.409973F),   REAL_CONST(0.439941F),
+   REAL_CONST(1.10999F),   REAL_CONST(4.92993F),
+   REAL_CONST(1.09998F),   REAL_CONST(0.739990F),
+   REAL_CONST(1.01996F),   REAL_CONST(1.42993F),
+   REAL_CONST(0.539978F),   REAL_CONST(0.979980F),
+   REAL_CONST(0.969971F),   REAL_CONST(2.18994F),
+   REAL_CONST(1.09998F),   REAL_CONST(0.339844F),
+   REAL_CONST(1.01996F),   REAL_CONST(1.00000F),
+   REAL_CONST(0.500000F),   REAL_CONST(0.159912F),
+   REAL_CONST(0.929993F),   REAL_CONST(3.39990F),
+   REAL_CONST(0.869995F),   REAL_CONST(0.759766F),
+   REAL_CONST(0.859985F),   REAL_CONST(1.13989F),
+   REAL_CONST(0.329956F),   REAL_CONST(0.659912F),
+   REAL_CONST(0.819946F),   REAL_CONST(1.59985F),
+   REAL_CONST(0.759949F),   REAL_CONST(0.219971F),
+   REAL_CONST(0.759949F),   REAL_CONST(0.649902F),
+   REAL_CONST(0.229980F),   REAL_CONST(0.159912F),
+   REAL_CONST(0.899963F),   REAL_CONST(5.73999F),
+   REAL_CONST(1.16998F),   REAL_CONST(0.599854F),
+   REAL_CONST(1.22998F),   REAL_CONST(1.23999F),
+   REAL_CONST(0.419983F),   REAL_CONST(1.00000F),
+   REAL_CONST(1.25000F),   REAL_CONST(2.08984F),
+   REAL_CONST(1.19995F),   REAL_CONST(0.179932F),
+   REAL_CONST(1.15997F),   REAL_CONST(1.03979F),
+   REAL_CONST(0.479980F),   REAL_CONST(0.509766F),
+   REAL_CONST(0.699951F),   REAL_CONST(3.00000F),
+   REAL_CONST(0.969971F),   REAL_CONST(0.359863F),
+   REAL_CONST(0.959961F),   REAL_CONST(1.12988F),
+   REAL_CONST(0.559998F),   REAL_CONST(0.349854F),
+   REAL_CONST(0.979980F),   REAL_CONST(1.70996F),
+   REAL_CONST(0.904968F),   REAL_CONST(0.179932F),
+   REAL_CONST(0.919983F),   REAL_CONST(0.549805F),
+   REAL_CONST(0.309998F),   REAL_CONST(0.299805F),
+   REAL_CONST(0.809998F),   REAL_CONST(4.22998F),
+   REAL_CONST(1.00995F),   REAL_CONST(0.569824F),
+   REAL_CONST(0.919983F),   REAL_CONST(1.41992F),
+   REAL_CONST(0.239990F),   REAL_CONST(0.899902F),
+   REAL_CONST(0.869995F),   REAL_CONST(2.09985F),
+   REAL_CONST(1.02997F),   REAL_CONST(0.189941F),
+   REAL_CONST(0.919983F),   REAL_CONST(0.929932F),
+   REAL_CONST(0.369995F),   REAL_CONST(0.149902F),
+   REAL_CONST(0.569946F),   REAL_CONST(2.25977F),
+   REAL_CONST(0.809998F),   REAL_CONST(0.429932F),
+   REAL_CONST(0.809998F),   REAL_CONST(0.859863F),
+   REAL_CONST(0.149963F),   REAL_CONST(0.479980F),
+   REAL_CONST(0.699951F),   REAL_CONST(1.34985F),
+   REAL_CONST(0.639954F),   REAL_CONST(0.179932F),
+   REAL_CONST(0.709961F),   REAL_CONST(0.779785F),
+   REAL_CONST(0.0899658F),   REAL_CONST(0.189941F)
 };
 
 
@@ -14144,259 +14142,259 @@ static const real_t window_160_80[240] =
 };
 
 /* correlation weights	*/
-static const Float32 corrweight[251] =
+static const real_t corrweight[251] =
 {
-   0.624805F,
-   0.625813F,
-   0.626820F,
-   0.627827F,
-   0.628834F,
-   0.630024F,
-   0.631031F,
-   0.632221F,
-   0.633229F,
-   0.634419F,
-   0.635426F,
-   0.636616F,
-   0.637623F,
-   0.638813F,
-   0.640034F,
-   0.641224F,
-   0.642415F,
-   0.643605F,
-   0.644826F,
-   0.646016F,
-   0.647206F,
-   0.648427F,
-   0.649617F,
-   0.651021F,
-   0.652211F,
-   0.653615F,
-   0.654805F,
-   0.656209F,
-   0.657430F,
-   0.658834F,
-   0.660207F,
-   0.661611F,
-   0.663015F,
-   0.664418F,
-   0.665822F,
-   0.667226F,
-   0.668630F,
-   0.670217F,
-   0.671621F,
-   0.673208F,
-   0.674612F,
-   0.676229F,
-   0.677816F,
-   0.679434F,
-   0.681021F,
-   0.682607F,
-   0.684225F,
-   0.685812F,
-   0.687613F,
-   0.689230F,
-   0.691031F,
-   0.692831F,
-   0.694632F,
-   0.696432F,
-   0.698233F,
-   0.700034F,
-   0.702017F,
-   0.703818F,
-   0.705832F,
-   0.707816F,
-   0.709616F,
-   0.711814F,
-   0.713828F,
-   0.715812F,
-   0.718009F,
-   0.720237F,
-   0.722221F,
-   0.724631F,
-   0.726829F,
-   0.729026F,
-   0.731437F,
-   0.733818F,
-   0.736229F,
-   0.738609F,
-   0.741234F,
-   0.743614F,
-   0.746208F,
-   0.748833F,
-   0.751610F,
-   0.754234F,
-   0.757012F,
-   0.760033F,
-   0.762810F,
-   0.765831F,
-   0.768822F,
-   0.772027F,
-   0.775018F,
-   0.778222F,
-   0.781610F,
-   0.785028F,
-   0.788415F,
-   0.792016F,
-   0.795618F,
-   0.799219F,
-   0.803034F,
-   0.807031F,
-   0.811029F,
-   0.815027F,
-   0.819239F,
-   0.823634F,
-   0.828028F,
-   0.832636F,
-   0.837428F,
-   0.842219F,
-   0.847224F,
-   0.852412F,
-   0.857814F,
-   0.863216F,
-   0.869015F,
-   0.874813F,
-   0.881039F,
-   0.887417F,
-   0.894040F,
-   0.901028F,
-   0.908231F,
-   0.915616F,
-   0.923429F,
-   0.931639F,
-   0.940214F,
-   0.960021F,
-   1.00000F,
-   1.00000F,
-   1.00000F,
-   1.00000F,
-   1.00000F,
-   1.00000F,
-   1.00000F,
-   0.960021F,
-   0.940214F,
-   0.931639F,
-   0.923429F,
-   0.915616F,
-   0.908231F,
-   0.901028F,
-   0.894040F,
-   0.887417F,
-   0.881039F,
-   0.874813F,
-   0.869015F,
-   0.863216F,
-   0.857814F,
-   0.852412F,
-   0.847224F,
-   0.842219F,
-   0.837428F,
-   0.832636F,
-   0.828028F,
-   0.823634F,
-   0.819239F,
-   0.815027F,
-   0.811029F,
-   0.807031F,
-   0.803034F,
-   0.799219F,
-   0.795618F,
-   0.792016F,
-   0.788415F,
-   0.785028F,
-   0.781610F,
-   0.778222F,
-   0.775018F,
-   0.772027F,
-   0.768822F,
-   0.765831F,
-   0.762810F,
-   0.760033F,
-   0.757012F,
-   0.754234F,
-   0.751610F,
-   0.748833F,
-   0.746208F,
-   0.743614F,
-   0.741234F,
-   0.738609F,
-   0.736229F,
-   0.733818F,
-   0.731437F,
-   0.729026F,
-   0.726829F,
-   0.724631F,
-   0.722221F,
-   0.720237F,
-   0.718009F,
-   0.715812F,
-   0.713828F,
-   0.711814F,
-   0.709616F,
-   0.707816F,
-   0.705832F,
-   0.703818F,
-   0.702017F,
-   0.700034F,
-   0.698233F,
-   0.696432F,
-   0.694632F,
-   0.692831F,
-   0.691031F,
-   0.689230F,
-   0.687613F,
-   0.685812F,
-   0.684225F,
-   0.682607F,
-   0.681021F,
-   0.679434F,
-   0.677816F,
-   0.676229F,
-   0.674612F,
-   0.673208F,
-   0.671621F,
-   0.670217F,
-   0.668630F,
-   0.667226F,
-   0.665822F,
-   0.664418F,
-   0.663015F,
-   0.661611F,
-   0.660207F,
-   0.658834F,
-   0.657430F,
-   0.656209F,
-   0.654805F,
-   0.653615F,
-   0.652211F,
-   0.651021F,
-   0.649617F,
-   0.648427F,
-   0.647206F,
-   0.646016F,
-   0.644826F,
-   0.643605F,
-   0.642415F,
-   0.641224F,
-   0.640034F,
-   0.638813F,
-   0.637623F,
-   0.636616F,
-   0.635426F,
-   0.634419F,
-   0.633229F,
-   0.632221F,
-   0.631031F,
-   0.630024F,
-   0.628834F,
-   0.627827F,
-   0.626820F,
-   0.625813F,
-   0.624805F,
-   0.623615F,
-   0.622608F,
-   0.621632F,
-   0.620624F
+   REAL_CONST(0.624805F),
+   REAL_CONST(0.625813F),
+   REAL_CONST(0.626820F),
+   REAL_CONST(0.627827F),
+   REAL_CONST(0.628834F),
+   REAL_CONST(0.630024F),
+   REAL_CONST(0.631031F),
+   REAL_CONST(0.632221F),
+   REAL_CONST(0.633229F),
+   REAL_CONST(0.634419F),
+   REAL_CONST(0.635426F),
+   REAL_CONST(0.636616F),
+   REAL_CONST(0.637623F),
+   REAL_CONST(0.638813F),
+   REAL_CONST(0.640034F),
+   REAL_CONST(0.641224F),
+   REAL_CONST(0.642415F),
+   REAL_CONST(0.643605F),
+   REAL_CONST(0.644826F),
+   REAL_CONST(0.646016F),
+   REAL_CONST(0.647206F),
+   REAL_CONST(0.648427F),
+   REAL_CONST(0.649617F),
+   REAL_CONST(0.651021F),
+   REAL_CONST(0.652211F),
+   REAL_CONST(0.653615F),
+   REAL_CONST(0.654805F),
+   REAL_CONST(0.656209F),
+   REAL_CONST(0.657430F),
+   REAL_CONST(0.658834F),
+   REAL_CONST(0.660207F),
+   REAL_CONST(0.661611F),
+   REAL_CONST(0.663015F),
+   REAL_CONST(0.664418F),
+   REAL_CONST(0.665822F),
+   REAL_CONST(0.667226F),
+   REAL_CONST(0.668630F),
+   REAL_CONST(0.670217F),
+   REAL_CONST(0.671621F),
+   REAL_CONST(0.673208F),
+   REAL_CONST(0.674612F),
+   REAL_CONST(0.676229F),
+   REAL_CONST(0.677816F),
+   REAL_CONST(0.679434F),
+   REAL_CONST(0.681021F),
+   REAL_CONST(0.682607F),
+   REAL_CONST(0.684225F),
+   REAL_CONST(0.685812F),
+   REAL_CONST(0.687613F),
+   REAL_CONST(0.689230F),
+   REAL_CONST(0.691031F),
+   REAL_CONST(0.692831F),
+   REAL_CONST(0.694632F),
+   REAL_CONST(0.696432F),
+   REAL_CONST(0.698233F),
+   REAL_CONST(0.700034F),
+   REAL_CONST(0.702017F),
+   REAL_CONST(0.703818F),
+   REAL_CONST(0.705832F),
+   REAL_CONST(0.707816F),
+   REAL_CONST(0.709616F),
+   REAL_CONST(0.711814F),
+   REAL_CONST(0.713828F),
+   REAL_CONST(0.715812F),
+   REAL_CONST(0.718009F),
+   REAL_CONST(0.720237F),
+   REAL_CONST(0.722221F),
+   REAL_CONST(0.724631F),
+   REAL_CONST(0.726829F),
+   REAL_CONST(0.729026F),
+   REAL_CONST(0.731437F),
+   REAL_CONST(0.733818F),
+   REAL_CONST(0.736229F),
+   REAL_CONST(0.738609F),
+   REAL_CONST(0.741234F),
+   REAL_CONST(0.743614F),
+   REAL_CONST(0.746208F),
+   REAL_CONST(0.748833F),
+   REAL_CONST(0.751610F),
+   REAL_CONST(0.754234F),
+   REAL_CONST(0.757012F),
+   REAL_CONST(0.760033F),
+   REAL_CONST(0.762810F),
+   REAL_CONST(0.765831F),
+   REAL_CONST(0.768822F),
+   REAL_CONST(0.772027F),
+   REAL_CONST(0.775018F),
+   REAL_CONST(0.778222F),
+   REAL_CONST(0.781610F),
+   REAL_CONST(0.785028F),
+   REAL_CONST(0.788415F),
+   REAL_CONST(0.792016F),
+   REAL_CONST(0.795618F),
+   REAL_CONST(0.799219F),
+   REAL_CONST(0.803034F),
+   REAL_CONST(0.807031F),
+   REAL_CONST(0.811029F),
+   REAL_CONST(0.815027F),
+   REAL_CONST(0.819239F),
+   REAL_CONST(0.823634F),
+   REAL_CONST(0.828028F),
+   REAL_CONST(0.832636F),
+   REAL_CONST(0.837428F),
+   REAL_CONST(0.842219F),
+   REAL_CONST(0.847224F),
+   REAL_CONST(0.852412F),
+   REAL_CONST(0.857814F),
+   REAL_CONST(0.863216F),
+   REAL_CONST(0.869015F),
+   REAL_CONST(0.874813F),
+   REAL_CONST(0.881039F),
+   REAL_CONST(0.887417F),
+   REAL_CONST(0.894040F),
+   REAL_CONST(0.901028F),
+   REAL_CONST(0.908231F),
+   REAL_CONST(0.915616F),
+   REAL_CONST(0.923429F),
+   REAL_CONST(0.931639F),
+   REAL_CONST(0.940214F),
+   REAL_CONST(0.960021F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(1.00000F),
+   REAL_CONST(0.960021F),
+   REAL_CONST(0.940214F),
+   REAL_CONST(0.931639F),
+   REAL_CONST(0.923429F),
+   REAL_CONST(0.915616F),
+   REAL_CONST(0.908231F),
+   REAL_CONST(0.901028F),
+   REAL_CONST(0.894040F),
+   REAL_CONST(0.887417F),
+   REAL_CONST(0.881039F),
+   REAL_CONST(0.874813F),
+   REAL_CONST(0.869015F),
+   REAL_CONST(0.863216F),
+   REAL_CONST(0.857814F),
+   REAL_CONST(0.852412F),
+   REAL_CONST(0.847224F),
+   REAL_CONST(0.842219F),
+   REAL_CONST(0.837428F),
+   REAL_CONST(0.832636F),
+   REAL_CONST(0.828028F),
+   REAL_CONST(0.823634F),
+   REAL_CONST(0.819239F),
+   REAL_CONST(0.815027F),
+   REAL_CONST(0.811029F),
+   REAL_CONST(0.807031F),
+   REAL_CONST(0.803034F),
+   REAL_CONST(0.799219F),
+   REAL_CONST(0.795618F),
+   REAL_CONST(0.792016F),
+   REAL_CONST(0.788415F),
+   REAL_CONST(0.785028F),
+   REAL_CONST(0.781610F),
+   REAL_CONST(0.778222F),
+   REAL_CONST(0.775018F),
+   REAL_CONST(0.772027F),
+   REAL_CONST(0.768822F),
+   REAL_CONST(0.765831F),
+   REAL_CONST(0.762810F),
+   REAL_CONST(0.760033F),
+   REAL_CONST(0.757012F),
+   REAL_CONST(0.754234F),
+   REAL_CONST(0.751610F),
+   REAL_CONST(0.748833F),
+   REAL_CONST(0.746208F),
+   REAL_CONST(0.743614F),
+   REAL_CONST(0.741234F),
+   REAL_CONST(0.738609F),
+   REAL_CONST(0.736229F),
+   REAL_CONST(0.733818F),
+   REAL_CONST(0.731437F),
+   REAL_CONST(0.729026F),
+   REAL_CONST(0.726829F),
+   REAL_CONST(0.724631F),
+   REAL_CONST(0.722221F),
+   REAL_CONST(0.720237F),
+   REAL_CONST(0.718009F),
+   REAL_CONST(0.715812F),
+   REAL_CONST(0.713828F),
+   REAL_CONST(0.711814F),
+   REAL_CONST(0.709616F),
+   REAL_CONST(0.707816F),
+   REAL_CONST(0.705832F),
+   REAL_CONST(0.703818F),
+   REAL_CONST(0.702017F),
+   REAL_CONST(0.700034F),
+   REAL_CONST(0.698233F),
+   REAL_CONST(0.696432F),
+   REAL_CONST(0.694632F),
+   REAL_CONST(0.692831F),
+   REAL_CONST(0.691031F),
+   REAL_CONST(0.689230F),
+   REAL_CONST(0.687613F),
+   REAL_CONST(0.685812F),
+   REAL_CONST(0.684225F),
+   REAL_CONST(0.682607F),
+   REAL_CONST(0.681021F),
+   REAL_CONST(0.679434F),
+   REAL_CONST(0.677816F),
+   REAL_CONST(0.676229F),
+   REAL_CONST(0.674612F),
+   REAL_CONST(0.673208F),
+   REAL_CONST(0.671621F),
+   REAL_CONST(0.670217F),
+   REAL_CONST(0.668630F),
+   REAL_CONST(0.667226F),
+   REAL_CONST(0.665822F),
+   REAL_CONST(0.664418F),
+   REAL_CONST(0.663015F),
+   REAL_CONST(0.661611F),
+   REAL_CONST(0.660207F),
+   REAL_CONST(0.658834F),
+   REAL_CONST(0.657430F),
+   REAL_CONST(0.656209F),
+   REAL_CONST(0.654805F),
+   REAL_CONST(0.653615F),
+   REAL_CONST(0.652211F),
+   REAL_CONST(0.651021F),
+   REAL_CONST(0.649617F),
+   REAL_CONST(0.648427F),
+   REAL_CONST(0.647206F),
+   REAL_CONST(0.646016F),
+   REAL_CONST(0.644826F),
+   REAL_CONST(0.643605F),
+   REAL_CONST(0.642415F),
+   REAL_CONST(0.641224F),
+   REAL_CONST(0.640034F),
+   REAL_CONST(0.638813F),
+   REAL_CONST(0.637623F),
+   REAL_CONST(0.636616F),
+   REAL_CONST(0.635426F),
+   REAL_CONST(0.634419F),
+   REAL_CONST(0.633229F),
+   REAL_CONST(0.632221F),
+   REAL_CONST(0.631031F),
+   REAL_CONST(0.630024F),
+   REAL_CONST(0.628834F),
+   REAL_CONST(0.627827F),
+   REAL_CONST(0.626820F),
+   REAL_CONST(0.625813F),
+   REAL_CONST(0.624805F),
+   REAL_CONST(0.623615F),
+   REAL_CONST(0.622608F),
+   REAL_CONST(0.621632F),
+   REAL_CONST(0.620624F)
 };
 
 
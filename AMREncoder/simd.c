@@ -0,0 +1,1153 @@
+/*
+ * ===================================================================
+ *  TS 26.104
+ *  REL-5 V5.4.0 2004-03
+ *  REL-6 V6.1.0 2004-03
+ *  3GPP AMR Floating-point Speech Codec
+ * ===================================================================
+ *
+ */
+
+/*
+ * simd.c
+ *
+ *
+ * Project:
+ *    AMR Floating-Point Codec
+ *
+ * Contains:
+ *    AVX2 and NEON versions of cor_h_x(), cor_h() and of the
+ *    pulse pair loops of search_8i40() and search_10i40(), and of the
+ *    dot products, convolutions and correlations of the LPC and pitch
+ *    analysis.
+ *
+ *    The correlations are sums of MUL_R() products that are stored into
+ *    32-bit real_32_t, so only bits [REAL_BITS, REAL_BITS+31] of each
+ *    64-bit product matter and all the additions can wrap around in 32
+ *    bits, in any order.  The kernels compute exactly those bits.
+ *
+ *    For the pulse searches, cor_h() also lays each row of rr[][] out by
+ *    tracks, rrt[i][t][k] = rr[i][t+k*step], so that the positions of a
+ *    track are contiguous.  The rows follow the same recurrence: each
+ *    track's block is the next track's block of the row below, and the
+ *    last track's is the first track's, one position on.
+ *
+ *    The pulse searches keep the pair with the largest sq/alp, comparing
+ *    alp*sq1 > sq*alp1 with 64-bit products of 32-bit values.  While
+ *    every alp is positive that comparison is a strict ordering, so each
+ *    vector lane can keep its own best pair and the lanes' bests can be
+ *    merged afterwards, taking the pair that the scalar loop would have
+ *    reached first among equals.  Where that does not hold, the kernel
+ *    gives up and the scalar loop is run instead.
+ *
+ */
+#include <string.h>
+#include "typedef.h"
+#include "fixed.h"
+#include "simd.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#if !defined(__GNUC__) || defined(FIXED_USE_ASM)
+/* the kernels need GCC's intrinsics, and the MIPS build has its own asm */
+#elif defined(__i386__) || defined(__x86_64__)
+#define AMR_SIMD_X86    1
+#include <immintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define AMR_SIMD_NEON   1
+#include <arm_neon.h>
+#endif
+
+#define L_CODE          AMR_SIMD_L_CODE
+#define TRACKS          AMR_SIMD_TRACKS
+#define TRACK           AMR_SIMD_TRACK
+#define L_SUBFR         AMR_SIMD_L_SUBFR
+#define M               AMR_SIMD_M
+#define TRACK_BUF       ( TRACK + 8 )   /* a track and one vector of zeros */
+#define PAIR_MAX        TRACK
+#define PAIR_NONE       0x7fffffff
+
+AMR_SIMD_Kernels amr_simd_kernels;
+static Word32 amr_simd_initialized = 0;
+
+#if defined(AMR_SIMD_X86) || defined(AMR_SIMD_NEON)
+
+/* whether all of x[0..n-1] fit in 32 bits */
+static Word32 fits_32( real_t x[], Word32 n )
+{
+   Word32 i;
+
+   for ( i = 0; i < n; i++ ) {
+      if ( x[i] != ( int32_t )x[i] )
+         return 0;
+   }
+   return 1;
+}
+
+
+/*
+ * cor_h_stage
+ *
+ *
+ * Parameters:
+ *    h                 I: impulse response
+ *    sign              I: sign information
+ *    hr                O: h[] reversed, in 32 bits, zero padded
+ *    s                 O: sign[] in 32 bits
+ *
+ * Function:
+ *    Prepares the vectors of cor_h(): its correlations are
+ *    rr[i][j] = rr[i+1][j+1] + hr[i]*hr[j], row by row from the last.
+ *
+ * Returns:
+ *    0 if h[] does not fit in 32 bits
+ */
+static Word32 cor_h_stage( real_t h[], Word32 sign[], int32_t hr[], int32_t s[] )
+{
+   Word32 i;
+
+   if ( !fits_32( h, L_CODE ) )
+      return 0;
+   for ( i = 0; i < L_CODE; i++ ) {
+      hr[L_CODE - 1 - i] = ( int32_t )h[i];
+      s[i] = ( int32_t )sign[i];
+   }
+   for ( i = L_CODE; i < L_CODE + 8; i++ )
+      hr[i] = 0;
+   return 1;
+}
+
+
+/*
+ * tracks_stage
+ *
+ *
+ * Parameters:
+ *    hr, s             I: as from cor_h_stage()
+ *    step              I: distance between the positions of a track
+ *    hrt               O: hr[] by tracks, zero padded
+ *    st                O: s[] by tracks
+ *    n                 I: the vector width
+ *
+ * Function:
+ *    Prepares the vectors of cor_h()'s rrt[][][].
+ *
+ * Returns:
+ *    the positions of a track to compute, a multiple of n
+ */
+static Word32 tracks_stage( int32_t hr[], int32_t s[], Word32 step,
+                            int32_t hrt[][TRACK_BUF], int32_t st[][TRACK_BUF], Word32 n )
+{
+   Word32 t, k, j;
+
+   for ( t = 0; t < step; t++ ) {
+      for ( k = 0; k < TRACK_BUF; k++ ) {
+         j = t + k * step;
+         hrt[t][k] = ( j < L_CODE ) ? hr[j] : 0;
+         st[t][k] = ( j < L_CODE ) ? s[j] : 1;
+      }
+   }
+   return ( ( L_CODE / step + n - 1 ) / n ) * n;
+}
+
+
+/*
+ * cor_h_x_stage
+ *
+ *
+ * Parameters:
+ *    h                 I: impulse response
+ *    x                 I: target
+ *    h32               O: REAL32(h[])
+ *    x32               O: REAL32(x[]), zero padded
+ *
+ * Function:
+ *    Prepares the vectors of cor_h_x(); with x32[] zero past L_CODE,
+ *    every dn[i] can sum L_CODE-i0 products, i0 <= i.
+ *
+ * Returns:
+ *    void
+ */
+static void cor_h_x_stage( real_t h[], real_t x[], int32_t h32[], int32_t x32[] )
+{
+   Word32 i;
+
+   for ( i = 0; i < L_CODE; i++ ) {
+      h32[i] = REAL32( h[i] );
+      x32[i] = REAL32( x[i] );
+   }
+   for ( i = L_CODE; i < L_CODE + 8; i++ )
+      x32[i] = 0;
+}
+
+#endif
+
+#ifdef AMR_SIMD_X86
+
+__attribute__((target("avx2")))
+static INLINE __m256i mul_shift_avx2( __m256i a, __m256i b, int32_t shift )
+{
+   __m256i even, odd;
+
+   even = _mm256_srli_epi64( _mm256_mul_epi32( a, b ), shift );
+   odd = _mm256_mul_epi32( _mm256_srli_epi64( a, 32 ), _mm256_srli_epi64( b, 32 ) );
+   return _mm256_blend_epi32( even, _mm256_slli_epi64( odd, 32 - shift ), 0xaa );
+}
+
+__attribute__((target("avx2")))
+static void cor_h_x_avx2( real_t h[], real_t x[], real_32_t dn[] )
+{
+   int32_t h32[L_CODE], x32[L_CODE + 8];
+   __m256i acc;
+   Word32 i, k;
+
+   cor_h_x_stage( h, x, h32, x32 );
+
+   for ( i = 0; i < L_CODE; i += 8 ) {
+      acc = _mm256_setzero_si256();
+      for ( k = 0; k < L_CODE - i; k++ )
+         acc = _mm256_add_epi32( acc, mul_shift_avx2( _mm256_set1_epi32( h32[k] ),
+               _mm256_loadu_si256( ( const __m256i * )( x32 + i + k ) ), REAL_BITS ) );
+      _mm256_storeu_si256( ( __m256i * )( dn + i ), acc );
+   }
+}
+
+__attribute__((target("avx2")))
+static Word32 cor_h_avx2( real_t h[], Word32 sign[], real_32_t rr[][L_CODE],
+                          real_32_t rrt[][TRACKS][TRACK], Word32 step )
+{
+   int32_t hr[L_CODE + 8], s[L_CODE], buf[2][L_CODE + 8];
+   int32_t hrt[TRACKS][TRACK_BUF], st[TRACKS][TRACK_BUF], tbuf[2][TRACKS][TRACK_BUF];
+   int32_t *prev = buf[0], *cur = buf[1], *tmp;
+   int32_t ( *tprev )[TRACK_BUF] = tbuf[0], ( *tcur )[TRACK_BUF] = tbuf[1], ( *ttmp )[TRACK_BUF];
+   const int32_t *src;
+   __m256i vh, vs, v;
+   Word32 i, j, t, n = 0;
+
+   if ( !cor_h_stage( h, sign, hr, s ) )
+      return 0;
+   memset( buf, 0, sizeof( buf ) );
+   if ( rrt ) {
+      n = tracks_stage( hr, s, step, hrt, st, 8 );
+      memset( tbuf, 0, sizeof( tbuf ) );
+   }
+
+   for ( i = L_CODE - 1; i >= 0; i-- ) {
+      vh = _mm256_set1_epi32( hr[i] );
+      vs = _mm256_set1_epi32( s[i] );
+      for ( j = 0; j < L_CODE; j += 8 ) {
+         v = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i * )( prev + j + 1 ) ),
+                               mul_shift_avx2( vh, _mm256_loadu_si256( ( const __m256i * )( hr + j ) ), REAL_BITS ) );
+         _mm256_storeu_si256( ( __m256i * )( cur + j ), v );
+         _mm256_storeu_si256( ( __m256i * )( rr[i] + j ),
+               _mm256_sign_epi32( v, _mm256_mullo_epi32( vs, _mm256_loadu_si256( ( const __m256i * )( s + j ) ) ) ) );
+      }
+      tmp = prev;
+      prev = cur;
+      cur = tmp;
+
+      if ( !rrt )
+         continue;
+      for ( t = 0; t < step; t++ ) {
+         src = ( t + 1 < step ) ? tprev[t + 1] : tprev[0] + 1;
+         for ( j = 0; j < n; j += 8 ) {
+            v = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i * )( src + j ) ),
+                                  mul_shift_avx2( vh, _mm256_loadu_si256( ( const __m256i * )( hrt[t] + j ) ), REAL_BITS ) );
+            _mm256_storeu_si256( ( __m256i * )( tcur[t] + j ), v );
+            _mm256_storeu_si256( ( __m256i * )( rrt[i][t] + j ),
+                  _mm256_sign_epi32( v, _mm256_mullo_epi32( vs, _mm256_loadu_si256( ( const __m256i * )( st[t] + j ) ) ) ) );
+         }
+      }
+      ttmp = tprev;
+      tprev = tcur;
+      tcur = ttmp;
+   }
+   return 1;
+}
+
+/* the first n positions x of a track: REAL2INT(dn[x]) into d[], and
+   rr[x][x] + 2*the sum of rr[pos[i]][x] (alp1 and rrv[] of the scalar
+   loops, less alp0) into e[] */
+__attribute__((target("avx2")))
+static INLINE void pair_track_avx2( real_32_t dn[], real_32_t rrt[][TRACKS][TRACK],
+                                    Word32 pos[], Word32 npos, Word32 track, Word32 n,
+                                    Word32 step, __m256i d[], __m256i e[] )
+{
+   __m256i k, x, sum;
+   Word32 i, v;
+
+   for ( v = 0; v * 8 < n; v++ ) {
+      k = _mm256_add_epi32( _mm256_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0 ), _mm256_set1_epi32( v * 8 ) );
+      x = _mm256_add_epi32( _mm256_set1_epi32( track ), _mm256_mullo_epi32( k, _mm256_set1_epi32( step ) ) );
+      x = _mm256_min_epi32( x, _mm256_set1_epi32( L_CODE - 1 ) );
+      d[v] = _mm256_srai_epi32( _mm256_i32gather_epi32( ( const int * )dn, x, 4 ), REAL_BITS );
+
+      sum = _mm256_setzero_si256();
+      for ( i = 0; i < npos; i++ )
+         sum = _mm256_add_epi32( sum, _mm256_loadu_si256( ( const __m256i * )( rrt[pos[i]][track] + v * 8 ) ) );
+      /* rr[x][x] is rrt[x][track][k] */
+      x = _mm256_add_epi32( _mm256_mullo_epi32( x, _mm256_set1_epi32( TRACKS * TRACK ) ), k );
+      e[v] = _mm256_add_epi32( _mm256_i32gather_epi32( ( const int * )rrt[0][track], x, 4 ),
+                               _mm256_slli_epi32( sum, 1 ) );
+   }
+}
+
+typedef struct
+{
+   __m256i sq, alp, ps, idx;
+} pair_best_avx2;
+
+/* tries the first pulse k, whose ps1 and alp1 are given, with the second
+   pulses l to l+7, and keeps each lane's best pair */
+__attribute__((target("avx2")))
+static INLINE void pair_try_avx2( pair_best_avx2 *best, __m256i *fail, const int32_t *rab,
+                                  __m256i ps1, __m256i alp1, __m256i dnb, __m256i vb,
+                                  Word32 k, Word32 l, Word32 nb, Word32 wide )
+{
+   __m256i lane, valid, ps2, alp2, sq2, upd, gte, gto;
+
+   lane = _mm256_add_epi32( _mm256_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0 ), _mm256_set1_epi32( l ) );
+   valid = _mm256_cmpgt_epi32( _mm256_set1_epi32( nb ), lane );
+   ps2 = _mm256_add_epi32( ps1, dnb );
+   alp2 = _mm256_add_epi32( _mm256_add_epi32( alp1, vb ),
+                            _mm256_slli_epi32( _mm256_loadu_si256( ( const __m256i * )( rab + l ) ), 1 ) );
+   sq2 = _mm256_mullo_epi32( ps2, ps2 );
+
+   upd = _mm256_cmpgt_epi32( _mm256_set1_epi32( 1 ), alp2 );
+   if ( wide )
+      upd = _mm256_or_si256( upd, _mm256_or_si256( _mm256_cmpgt_epi32( ps2, _mm256_set1_epi32( 46340 ) ),
+                                                   _mm256_cmpgt_epi32( _mm256_set1_epi32( -46340 ), ps2 ) ) );
+   *fail = _mm256_or_si256( *fail, _mm256_and_si256( upd, valid ) );
+
+   /* alp*sq2 > sq*alp2, for the even and the odd lanes */
+   gte = _mm256_cmpgt_epi64( _mm256_mul_epi32( best->alp, sq2 ), _mm256_mul_epi32( best->sq, alp2 ) );
+   gto = _mm256_cmpgt_epi64( _mm256_mul_epi32( _mm256_srli_epi64( best->alp, 32 ), _mm256_srli_epi64( sq2, 32 ) ),
+                             _mm256_mul_epi32( _mm256_srli_epi64( best->sq, 32 ), _mm256_srli_epi64( alp2, 32 ) ) );
+   upd = _mm256_and_si256( valid, _mm256_blend_epi32( gte, gto, 0xaa ) );
+
+   best->sq = _mm256_blendv_epi8( best->sq, sq2, upd );
+   best->alp = _mm256_blendv_epi8( best->alp, alp2, upd );
+   best->ps = _mm256_blendv_epi8( best->ps, ps2, upd );
+   best->idx = _mm256_blendv_epi8( best->idx, _mm256_add_epi32( lane, _mm256_set1_epi32( k * PAIR_MAX ) ), upd );
+}
+
+/* the better of each lane's pairs x and y: the larger sq/alp or, among equals,
+   the smaller index */
+__attribute__((target("avx2")))
+static INLINE pair_best_avx2 pair_better_avx2( pair_best_avx2 x, pair_best_avx2 y )
+{
+   __m256i pe, qe, po, qo, gt, eq, upd;
+
+   /* x.alp*y.sq against x.sq*y.alp, for the even and the odd lanes */
+   pe = _mm256_mul_epi32( x.alp, y.sq );
+   qe = _mm256_mul_epi32( x.sq, y.alp );
+   po = _mm256_mul_epi32( _mm256_srli_epi64( x.alp, 32 ), _mm256_srli_epi64( y.sq, 32 ) );
+   qo = _mm256_mul_epi32( _mm256_srli_epi64( x.sq, 32 ), _mm256_srli_epi64( y.alp, 32 ) );
+   gt = _mm256_blend_epi32( _mm256_cmpgt_epi64( pe, qe ), _mm256_cmpgt_epi64( po, qo ), 0xaa );
+   eq = _mm256_blend_epi32( _mm256_cmpeq_epi64( pe, qe ), _mm256_cmpeq_epi64( po, qo ), 0xaa );
+   upd = _mm256_or_si256( gt, _mm256_and_si256( eq, _mm256_cmpgt_epi32( x.idx, y.idx ) ) );
+
+   x.sq = _mm256_blendv_epi8( x.sq, y.sq, upd );
+   x.alp = _mm256_blendv_epi8( x.alp, y.alp, upd );
+   x.ps = _mm256_blendv_epi8( x.ps, y.ps, upd );
+   x.idx = _mm256_blendv_epi8( x.idx, y.idx, upd );
+   return x;
+}
+
+/* x with its lanes permuted by p */
+__attribute__((target("avx2")))
+static INLINE pair_best_avx2 pair_permute_avx2( pair_best_avx2 x, __m256i p )
+{
+   x.sq = _mm256_permutevar8x32_epi32( x.sq, p );
+   x.alp = _mm256_permutevar8x32_epi32( x.alp, p );
+   x.ps = _mm256_permutevar8x32_epi32( x.ps, p );
+   x.idx = _mm256_permutevar8x32_epi32( x.idx, p );
+   return x;
+}
+
+/*
+ * Two sets of lanes are kept, so that the comparisons of consecutive
+ * pairs do not wait for each other: those of the even and odd first
+ * pulses, or, with more than 8 second pulses, those of l < 8 and l >= 8.
+ */
+__attribute__((target("avx2")))
+static Word32 search_pair_avx2( real_32_t dn[], real_32_t rrt[][TRACKS][TRACK],
+                                Word32 pos[], Word32 npos, Word32 a, Word32 na,
+                                Word32 b, Word32 nb, Word32 step, Word32 wide,
+                                int32_t *ps, real_32_t *alp, int64_t *sq,
+                                Word32 *ia, Word32 *ib )
+{
+   int32_t dna[PAIR_MAX], va[PAIR_MAX];
+   pair_best_avx2 best[2];
+   __m256i d[2], e[2], dnb[2], vb[2], fail;
+   Word32 i, k;
+
+   pair_track_avx2( dn, rrt, pos, npos, a, na, step, d, e );
+   pair_track_avx2( dn, rrt, pos, npos, b, nb, step, dnb, vb );
+   for ( i = 0; i * 8 < na; i++ ) {
+      _mm256_storeu_si256( ( __m256i * )( dna + i * 8 ), d[i] );
+      _mm256_storeu_si256( ( __m256i * )( va + i * 8 ), e[i] );
+   }
+
+   for ( i = 0; i < 2; i++ ) {
+      best[i].sq = _mm256_set1_epi32( -1 );
+      best[i].alp = _mm256_set1_epi32( REAL_ICONST( 1 ) );
+      best[i].ps = _mm256_setzero_si256();
+      best[i].idx = _mm256_set1_epi32( PAIR_NONE );
+   }
+   fail = _mm256_setzero_si256();
+
+#define PAIR_TRY( n, k, l ) \
+   pair_try_avx2( &best[n], &fail, rrt[a + ( k ) * step][b], _mm256_set1_epi32( *ps + dna[k] ), \
+                  _mm256_set1_epi32( *alp + va[k] ), dnb[( l ) / 8], vb[( l ) / 8], k, l, nb, wide )
+   if ( nb <= 8 ) {
+      for ( k = 0; k + 1 < na; k += 2 ) {
+         PAIR_TRY( 0, k, 0 );
+         PAIR_TRY( 1, k + 1, 0 );
+      }
+      if ( k < na )
+         PAIR_TRY( 0, k, 0 );
+   }
+   else {
+      for ( k = 0; k < na; k++ ) {
+         PAIR_TRY( 0, k, 0 );
+         PAIR_TRY( 1, k, 8 );
+      }
+   }
+#undef PAIR_TRY
+   if ( _mm256_movemask_epi8( fail ) )
+      return 0;
+
+   /* merge the lanes; a lane's index is k*PAIR_MAX+l, in the scalar
+      loop's order, so among equal sq/alp the smallest wins */
+   best[0] = pair_better_avx2( best[0], best[1] );
+   best[0] = pair_better_avx2( best[0], pair_permute_avx2( best[0], _mm256_set_epi32( 3, 2, 1, 0, 7, 6, 5, 4 ) ) );
+   best[0] = pair_better_avx2( best[0], pair_permute_avx2( best[0], _mm256_set_epi32( 5, 4, 7, 6, 1, 0, 3, 2 ) ) );
+   best[0] = pair_better_avx2( best[0], pair_permute_avx2( best[0], _mm256_set_epi32( 6, 7, 4, 5, 2, 3, 0, 1 ) ) );
+
+   k = _mm256_cvtsi256_si32( best[0].idx );
+   *ps = _mm256_cvtsi256_si32( best[0].ps );
+   *alp = _mm256_cvtsi256_si32( best[0].alp );
+   *sq = _mm256_cvtsi256_si32( best[0].sq );
+   *ia = a;
+   *ib = b;
+   if ( k != PAIR_NONE ) {
+      *ia = a + ( k / PAIR_MAX ) * step;
+      *ib = b + ( k % PAIR_MAX ) * step;
+   }
+   return 1;
+}
+
+/*
+ * The LPC and pitch analysis primitives.  AVX2 has no 64-bit arithmetic
+ * shift for MUL_R(), but a product of two 32-bit values plus 2^62 is
+ * never negative: shifted logically, it is MUL_R() plus MUL_R_BIAS,
+ * which the sums take off by starting from -MUL_R_BIAS per term.
+ */
+#define MUL_R_BIAS      ( ( int64_t )1 << ( 62 - REAL_BITS ) )
+
+/* MUL_R() of the low 32 bits of each 64-bit lane, plus MUL_R_BIAS */
+__attribute__((target("avx2")))
+static INLINE __m256i mul_r_avx2( __m256i a, __m256i b )
+{
+   return _mm256_srli_epi64( _mm256_add_epi64( _mm256_mul_epi32( a, b ),
+                             _mm256_set1_epi64x( ( int64_t )1 << 62 ) ), REAL_BITS );
+}
+
+/* REAL2INT32(a)*REAL2INT32(b) in 32 bits, sign extended, for each 64-bit lane */
+__attribute__((target("avx2")))
+static INLINE __m256i mul_int32_avx2( __m256i a, __m256i b )
+{
+   return _mm256_mul_epi32( _mm256_mullo_epi32( _mm256_srli_epi64( a, REAL_BITS ),
+                                                _mm256_srli_epi64( b, REAL_BITS ) ),
+                            _mm256_set1_epi64x( 1 ) );
+}
+
+/* the eight 32-bit lanes of v, sign extended, added to the four 64-bit lanes of acc */
+__attribute__((target("avx2")))
+static INLINE __m256i add_wide_avx2( __m256i acc, __m256i v )
+{
+   return _mm256_add_epi64( acc, _mm256_add_epi64( _mm256_cvtepi32_epi64( _mm256_castsi256_si128( v ) ),
+                                                   _mm256_cvtepi32_epi64( _mm256_extracti128_si256( v, 1 ) ) ) );
+}
+
+/* the sum of the 64-bit lanes */
+__attribute__((target("avx2")))
+static INLINE int64_t sum_avx2( __m256i v )
+{
+   __m128i s;
+   int64_t sum;
+
+   s = _mm_add_epi64( _mm256_castsi256_si128( v ), _mm256_extracti128_si256( v, 1 ) );
+   _mm_storel_epi64( ( __m128i * )&sum, _mm_add_epi64( s, _mm_unpackhi_epi64( s, s ) ) );
+   return sum;
+}
+
+__attribute__((target("avx2")))
+static int64_t dot_32_avx2( real_32_t x[], real_32_t y[], Word32 n )
+{
+   __m256i acc = _mm256_setzero_si256();
+   Word32 i;
+
+   for ( i = 0; i < n; i += 8 )
+      acc = add_wide_avx2( acc, _mm256_mullo_epi32(
+            _mm256_srai_epi32( _mm256_loadu_si256( ( const __m256i * )( x + i ) ), REAL_BITS ),
+            _mm256_srai_epi32( _mm256_loadu_si256( ( const __m256i * )( y + i ) ), REAL_BITS ) ) );
+   return sum_avx2( acc );
+}
+
+__attribute__((target("avx2")))
+static int64_t dot_fixed_avx2( real_t x[], real_t y[], Word32 n )
+{
+   __m256i acc = _mm256_setzero_si256();
+   Word32 i;
+
+   for ( i = 0; i < n; i += 4 )
+      acc = _mm256_add_epi64( acc, mul_int32_avx2( _mm256_loadu_si256( ( const __m256i * )( x + i ) ),
+                                                   _mm256_loadu_si256( ( const __m256i * )( y + i ) ) ) );
+   return sum_avx2( acc );
+}
+
+__attribute__((target("avx2")))
+static real_t dot_mul_r_avx2( real_t x[], real_t y[], Word32 n )
+{
+   __m256i acc = _mm256_set1_epi64x( -( n / 4 ) * MUL_R_BIAS );
+   Word32 i;
+
+   for ( i = 0; i < n; i += 4 )
+      acc = _mm256_add_epi64( acc, mul_r_avx2( _mm256_loadu_si256( ( const __m256i * )( x + i ) ),
+                                               _mm256_loadu_si256( ( const __m256i * )( y + i ) ) ) );
+   return sum_avx2( acc );
+}
+
+__attribute__((target("avx2")))
+static int64_t abs_sum_avx2( real_32_t x[], Word32 n )
+{
+   __m256i acc = _mm256_setzero_si256();
+   Word32 i;
+
+   for ( i = 0; i < n; i += 8 )
+      acc = add_wide_avx2( acc, _mm256_abs_epi32( _mm256_loadu_si256( ( const __m256i * )( x + i ) ) ) );
+   return sum_avx2( acc );
+}
+
+__attribute__((target("avx2")))
+static void convolve_avx2( real_t x[], real_t h[], real_t y[] )
+{
+   real_t hz[3 + L_SUBFR];   /* h[] after three zeros, for k-i < 0 */
+   __m256i acc;
+   Word32 i, k;
+
+   hz[0] = hz[1] = hz[2] = 0;
+   memcpy( hz + 3, h, L_SUBFR * sizeof( real_t ) );
+
+   for ( k = 0; k < L_SUBFR; k += 4 ) {
+      acc = _mm256_set1_epi64x( -( k + 4 ) * MUL_R_BIAS );
+      for ( i = 0; i < k + 4; i++ )
+         acc = _mm256_add_epi64( acc, mul_r_avx2( _mm256_set1_epi64x( x[i] ),
+               _mm256_loadu_si256( ( const __m256i * )( hz + 3 + k - i ) ) ) );
+      _mm256_storeu_si256( ( __m256i * )( y + k ), acc );
+   }
+}
+
+/* y[k..k+3] of residu() */
+__attribute__((target("avx2")))
+static INLINE __m256i residu_avx2( const __m256i va[], real_t x[], Word32 k )
+{
+   __m256i acc = _mm256_set1_epi64x( -( M + 1 ) * MUL_R_BIAS );
+   Word32 j;
+
+   for ( j = 0; j <= M; j++ )
+      acc = _mm256_add_epi64( acc, mul_r_avx2( va[j], _mm256_loadu_si256( ( const __m256i * )( x + k - j ) ) ) );
+   return acc;
+}
+
+__attribute__((target("avx2")))
+static void residu_64_avx2( real_32_t a[], real_t x[], real_t y[] )
+{
+   __m256i va[M + 1];
+   Word32 j, k;
+
+   for ( j = 0; j <= M; j++ )
+      va[j] = _mm256_set1_epi64x( a[j] );
+   for ( k = 0; k < L_SUBFR; k += 4 )
+      _mm256_storeu_si256( ( __m256i * )( y + k ), residu_avx2( va, x, k ) );
+}
+
+__attribute__((target("avx2")))
+static void residu_32_avx2( real_32_t a[], real_t x[], real_32_t y[] )
+{
+   __m256i va[M + 1];
+   const __m256i low = _mm256_setr_epi32( 0, 2, 4, 6, 0, 2, 4, 6 );
+   Word32 j, k;
+
+   for ( j = 0; j <= M; j++ )
+      va[j] = _mm256_set1_epi64x( a[j] );
+   for ( k = 0; k < L_SUBFR; k += 4 )
+      _mm_storeu_si128( ( __m128i * )( y + k ), _mm256_castsi256_si128(
+            _mm256_permutevar8x32_epi32( residu_avx2( va, x, k ), low ) ) );
+}
+
+__attribute__((target("avx2")))
+static Word32 norm_corr_avx2( real_t exc[], real_t xn[], real_t h[], real_t y[],
+                              Word32 t_min, Word32 t_max, int64_t corr[], int64_t norm[] )
+{
+   __m256i vy[L_SUBFR / 4], vh[L_SUBFR / 4], vx[L_SUBFR / 4];
+   __m256i c, nm, e, r, prev;
+   const __m256i one = _mm256_set1_epi64x( 1 ), bias = _mm256_set1_epi64x( MUL_R_BIAS );
+   Word32 i, t;
+
+   if ( !fits_32( h, L_SUBFR ) || !fits_32( &exc[ - t_max], t_max - t_min ) )
+      return 0;
+
+   for ( i = 0; i < L_SUBFR / 4; i++ ) {
+      vy[i] = _mm256_loadu_si256( ( const __m256i * )( y + 4 * i ) );
+      vh[i] = _mm256_loadu_si256( ( const __m256i * )( h + 4 * i ) );
+      vx[i] = _mm256_srli_epi64( _mm256_loadu_si256( ( const __m256i * )( xn + 4 * i ) ), REAL_BITS );
+   }
+   /* y[0] is exc[-t-1] itself */
+   vh[0] = _mm256_blend_epi32( vh[0], _mm256_setzero_si256(), 0x03 );
+
+   for ( t = t_min; ; t++ ) {
+      /* corr: as mul_int32_avx2(), with xn[] already shifted; norm:
+         the low 32 bits, as int, of each y[] */
+      c = _mm256_setzero_si256();
+      nm = c;
+      for ( i = 0; i < L_SUBFR / 4; i++ ) {
+         c = _mm256_add_epi64( c, _mm256_mul_epi32( _mm256_mullo_epi32( vx[i],
+                               _mm256_srli_epi64( vy[i], REAL_BITS ) ), one ) );
+         nm = _mm256_add_epi64( nm, _mm256_mul_epi32( _mm256_srai_epi32(
+                                _mm256_abs_epi32( vy[i] ), REAL_BITS ), one ) );
+      }
+      corr[t - t_min] = sum_avx2( c );
+      norm[t - t_min] = sum_avx2( nm );
+      if ( t == t_max )
+         break;
+
+      /* move every lane up one, the top lane of each vector to the
+         bottom of the next */
+      e = _mm256_set1_epi64x( exc[ - t - 1] );
+      prev = e;
+      for ( i = 0; i < L_SUBFR / 4; i++ ) {
+         r = _mm256_permute4x64_epi64( vy[i], _MM_SHUFFLE( 2, 1, 0, 3 ) );
+         vy[i] = _mm256_add_epi64( _mm256_blend_epi32( r, prev, 0x03 ),
+                                   _mm256_sub_epi64( mul_r_avx2( e, vh[i] ), bias ) );
+         prev = r;
+      }
+   }
+   return 1;
+}
+
+#endif /* AMR_SIMD_X86 */
+
+#ifdef AMR_SIMD_NEON
+
+typedef struct
+{
+   int32_t dna[PAIR_MAX], va[PAIR_MAX];     /* per first pulse */
+   int32_t dnb[PAIR_MAX], vb[PAIR_MAX];     /* per second pulse */
+} pair_table;
+
+
+/*
+ * pair_stage
+ *
+ *
+ * Parameters:
+ *    dn, rrt, a, na, b, nb, step: as for search_pair()
+ *    t                 O: the search's terms, contiguous
+ *
+ * Function:
+ *    Gathers the track positions' correlations and energies; the
+ *    kernels then add the energies with the pulses found so far, to
+ *    get alp1 and rrv[] of the scalar loops.  Positions past nb are zero.
+ *
+ * Returns:
+ *    void
+ */
+static INLINE void pair_stage( real_32_t dn[], real_32_t rrt[][TRACKS][TRACK], Word32 a,
+                               Word32 na, Word32 b, Word32 nb, Word32 step, pair_table *t )
+{
+   Word32 k, l, x;
+
+   for ( k = 0; k < na; k++ ) {
+      x = a + k * step;
+      t->dna[k] = REAL2INT( dn[x] );
+      t->va[k] = rrt[x][a][k];
+   }
+   for ( ; k < PAIR_MAX; k++ )
+      t->va[k] = 0;
+
+   for ( l = 0; l < nb; l++ ) {
+      x = b + l * step;
+      t->dnb[l] = REAL2INT( dn[x] );
+      t->vb[l] = rrt[x][b][l];
+   }
+   for ( ; l < PAIR_MAX; l++ ) {
+      t->dnb[l] = 0;
+      t->vb[l] = 0;
+   }
+}
+
+
+/*
+ * pair_merge
+ *
+ *
+ * Parameters:
+ *    lsq, lalp, lps, lidx  I: each lane's best pair (lidx PAIR_NONE if none)
+ *    lanes             I: number of lanes
+ *    a, b, step        I: as for search_pair()
+ *    ps, alp, sq, ia, ib  O: the best pair, as the scalar loop finds it
+ *
+ * Function:
+ *    Merges the lanes' best pairs.  A lane's index is k*PAIR_MAX+l, in
+ *    the scalar loop's order, so among equal sq/alp the smallest wins.
+ *
+ * Returns:
+ *    1
+ */
+static INLINE Word32 pair_merge( int32_t lsq[], int32_t lalp[], int32_t lps[], int32_t lidx[],
+                                 Word32 lanes, Word32 a, Word32 b, Word32 step,
+                                 int32_t *ps, real_32_t *alp, int64_t *sq, Word32 *ia, Word32 *ib )
+{
+   int64_t bsq = -1, p, q;
+   int32_t balp = REAL_ICONST( 1 ), bps = 0, bidx = PAIR_NONE;
+   Word32 i;
+
+   for ( i = 0; i < lanes; i++ ) {
+      if ( lidx[i] == PAIR_NONE )
+         continue;
+      p = ( int64_t )balp * lsq[i];
+      q = bsq * lalp[i];
+
+      if ( ( p > q ) || ( ( p == q ) && ( lidx[i] < bidx ) ) ) {
+         bsq = lsq[i];
+         balp = lalp[i];
+         bps = lps[i];
+         bidx = lidx[i];
+      }
+   }
+
+   *ps = bps;
+   *alp = balp;
+   *sq = bsq;
+   *ia = a;
+   *ib = b;
+   if ( bidx != PAIR_NONE ) {
+      *ia = a + ( bidx / PAIR_MAX ) * step;
+      *ib = b + ( bidx % PAIR_MAX ) * step;
+   }
+   return 1;
+}
+
+/* bits [shift, shift+31] of each of the 64-bit products a*b (signed) */
+#define MUL_SHIFT_NEON(a, b, shift) \
+   vcombine_s32( vshrn_n_s64( vmull_s32( vget_low_s32( a ), vget_low_s32( b ) ), shift ), \
+                 vshrn_n_s64( vmull_s32( vget_high_s32( a ), vget_high_s32( b ) ), shift ) )
+
+/* x > y for 64-bit lanes whose difference fits in 64 bits, narrowed to 32 */
+#define CMPGT64_NEON(x, y) \
+   vmovn_u64( vreinterpretq_u64_s64( vshrq_n_s64( vsubq_s64( y, x ), 63 ) ) )
+
+static void cor_h_x_neon( real_t h[], real_t x[], real_32_t dn[] )
+{
+   int32_t h32[L_CODE], x32[L_CODE + 8];
+   int32x4_t acc;
+   Word32 i, k;
+
+   cor_h_x_stage( h, x, h32, x32 );
+
+   for ( i = 0; i < L_CODE; i += 4 ) {
+      acc = vdupq_n_s32( 0 );
+      for ( k = 0; k < L_CODE - i; k++ )
+         acc = vaddq_s32( acc, MUL_SHIFT_NEON( vdupq_n_s32( h32[k] ), vld1q_s32( x32 + i + k ), REAL_BITS ) );
+      vst1q_s32( dn + i, acc );
+   }
+}
+
+static Word32 cor_h_neon( real_t h[], Word32 sign[], real_32_t rr[][L_CODE],
+                          real_32_t rrt[][TRACKS][TRACK], Word32 step )
+{
+   int32_t hr[L_CODE + 8], s[L_CODE], buf[2][L_CODE + 8];
+   int32_t hrt[TRACKS][TRACK_BUF], st[TRACKS][TRACK_BUF], tbuf[2][TRACKS][TRACK_BUF];
+   int32_t *prev = buf[0], *cur = buf[1], *tmp;
+   int32_t ( *tprev )[TRACK_BUF] = tbuf[0], ( *tcur )[TRACK_BUF] = tbuf[1], ( *ttmp )[TRACK_BUF];
+   const int32_t *src;
+   int32x4_t vh, vs, v;
+   Word32 i, j, t, n = 0;
+
+   if ( !cor_h_stage( h, sign, hr, s ) )
+      return 0;
+   memset( buf, 0, sizeof( buf ) );
+   if ( rrt ) {
+      n = tracks_stage( hr, s, step, hrt, st, 4 );
+      memset( tbuf, 0, sizeof( tbuf ) );
+   }
+
+   for ( i = L_CODE - 1; i >= 0; i-- ) {
+      vh = vdupq_n_s32( hr[i] );
+      vs = vdupq_n_s32( s[i] );
+      for ( j = 0; j < L_CODE; j += 4 ) {
+         v = vaddq_s32( vld1q_s32( prev + j + 1 ), MUL_SHIFT_NEON( vh, vld1q_s32( hr + j ), REAL_BITS ) );
+         vst1q_s32( cur + j, v );
+         vst1q_s32( rr[i] + j, vmulq_s32( v, vmulq_s32( vs, vld1q_s32( s + j ) ) ) );
+      }
+      tmp = prev;
+      prev = cur;
+      cur = tmp;
+
+      if ( !rrt )
+         continue;
+      for ( t = 0; t < step; t++ ) {
+         src = ( t + 1 < step ) ? tprev[t + 1] : tprev[0] + 1;
+         for ( j = 0; j < n; j += 4 ) {
+            v = vaddq_s32( vld1q_s32( src + j ), MUL_SHIFT_NEON( vh, vld1q_s32( hrt[t] + j ), REAL_BITS ) );
+            vst1q_s32( tcur[t] + j, v );
+            vst1q_s32( rrt[i][t] + j, vmulq_s32( v, vmulq_s32( vs, vld1q_s32( st[t] + j ) ) ) );
+         }
+      }
+      ttmp = tprev;
+      tprev = tcur;
+      tcur = ttmp;
+   }
+   return 1;
+}
+
+/* v[k] += 2 * the sum of rrt[pos[i]][track][k], k < n */
+static void pair_energy_neon( real_32_t rrt[][TRACKS][TRACK], Word32 pos[], Word32 npos,
+                              Word32 track, Word32 n, int32_t v[] )
+{
+   int32x4_t sum;
+   Word32 i, k;
+
+   for ( k = 0; k < n; k += 4 ) {
+      sum = vdupq_n_s32( 0 );
+      for ( i = 0; i < npos; i++ )
+         sum = vaddq_s32( sum, vld1q_s32( rrt[pos[i]][track] + k ) );
+      vst1q_s32( v + k, vaddq_s32( vld1q_s32( v + k ), vshlq_n_s32( sum, 1 ) ) );
+   }
+}
+
+static Word32 search_pair_neon( real_32_t dn[], real_32_t rrt[][TRACKS][TRACK],
+                                Word32 pos[], Word32 npos, Word32 a, Word32 na,
+                                Word32 b, Word32 nb, Word32 step, Word32 wide,
+                                int32_t *ps, real_32_t *alp, int64_t *sq,
+                                Word32 *ia, Word32 *ib )
+{
+   static const int32_t lanes[4] = { 0, 1, 2, 3 };
+   pair_table t;
+   int32_t lsq[4], lalp[4], lps[4], lidx[4];
+   const int32_t *rab;
+   int32x4_t ps1, alp1, ps2, alp2, sq2, bsq, balp, bps, bidx, lane;
+   uint32x4_t valid, upd, fail;
+   uint32x2_t f;
+   Word32 k, l;
+
+   pair_stage( dn, rrt, a, na, b, nb, step, &t );
+   pair_energy_neon( rrt, pos, npos, a, na, t.va );
+   pair_energy_neon( rrt, pos, npos, b, nb, t.vb );
+
+   bsq = vdupq_n_s32( -1 );
+   balp = vdupq_n_s32( REAL_ICONST( 1 ) );
+   bps = vdupq_n_s32( 0 );
+   bidx = vdupq_n_s32( PAIR_NONE );
+   fail = vdupq_n_u32( 0 );
+
+   for ( k = 0; k < na; k++ ) {
+      rab = rrt[a + k * step][b];
+      ps1 = vdupq_n_s32( *ps + t.dna[k] );
+      alp1 = vdupq_n_s32( *alp + t.va[k] );
+
+      for ( l = 0; l < nb; l += 4 ) {
+         lane = vaddq_s32( vld1q_s32( lanes ), vdupq_n_s32( l ) );
+         valid = vcltq_s32( lane, vdupq_n_s32( nb ) );
+         ps2 = vaddq_s32( ps1, vld1q_s32( t.dnb + l ) );
+         alp2 = vaddq_s32( vaddq_s32( alp1, vld1q_s32( t.vb + l ) ), vshlq_n_s32( vld1q_s32( rab + l ), 1 ) );
+         sq2 = vmulq_s32( ps2, ps2 );
+
+         upd = vcltq_s32( alp2, vdupq_n_s32( 1 ) );
+         if ( wide )
+            upd = vorrq_u32( upd, vorrq_u32( vcgtq_s32( ps2, vdupq_n_s32( 46340 ) ),
+                                             vcltq_s32( ps2, vdupq_n_s32( -46340 ) ) ) );
+         fail = vorrq_u32( fail, vandq_u32( upd, valid ) );
+
+         /* alp*sq2 > sq*alp2 */
+         upd = vcombine_u32( CMPGT64_NEON( vmull_s32( vget_low_s32( balp ), vget_low_s32( sq2 ) ),
+                                           vmull_s32( vget_low_s32( bsq ), vget_low_s32( alp2 ) ) ),
+                             CMPGT64_NEON( vmull_s32( vget_high_s32( balp ), vget_high_s32( sq2 ) ),
+                                           vmull_s32( vget_high_s32( bsq ), vget_high_s32( alp2 ) ) ) );
+         upd = vandq_u32( upd, valid );
+
+         bsq = vbslq_s32( upd, sq2, bsq );
+         balp = vbslq_s32( upd, alp2, balp );
+         bps = vbslq_s32( upd, ps2, bps );
+         bidx = vbslq_s32( upd, vaddq_s32( lane, vdupq_n_s32( k * PAIR_MAX ) ), bidx );
+      }
+   }
+   f = vorr_u32( vget_low_u32( fail ), vget_high_u32( fail ) );
+   if ( vget_lane_u32( vpmax_u32( f, f ), 0 ) )
+      return 0;
+
+   vst1q_s32( lsq, bsq );
+   vst1q_s32( lalp, balp );
+   vst1q_s32( lps, bps );
+   vst1q_s32( lidx, bidx );
+   return pair_merge( lsq, lalp, lps, lidx, 4, a, b, step, ps, alp, sq, ia, ib );
+}
+
+/* MUL_R() of each of the 32-bit lanes */
+#define MUL_R_NEON(a, b) vshrq_n_s64( vmull_s32( a, b ), REAL_BITS )
+
+/* REAL2INT32() of x[0..3] */
+#define REAL2INT32_NEON(x) \
+   vcombine_s32( vshrn_n_s64( vld1q_s64( x ), REAL_BITS ), vshrn_n_s64( vld1q_s64( ( x ) + 2 ), REAL_BITS ) )
+
+/* the sum of the 64-bit lanes */
+#define SUM_NEON(v) vget_lane_s64( vadd_s64( vget_low_s64( v ), vget_high_s64( v ) ), 0 )
+
+static int64_t dot_32_neon( real_32_t x[], real_32_t y[], Word32 n )
+{
+   int64x2_t acc = vdupq_n_s64( 0 );
+   Word32 i;
+
+   for ( i = 0; i < n; i += 4 )
+      acc = vpadalq_s32( acc, vmulq_s32( vshrq_n_s32( vld1q_s32( x + i ), REAL_BITS ),
+                                         vshrq_n_s32( vld1q_s32( y + i ), REAL_BITS ) ) );
+   return SUM_NEON( acc );
+}
+
+static int64_t dot_fixed_neon( real_t x[], real_t y[], Word32 n )
+{
+   int64x2_t acc = vdupq_n_s64( 0 );
+   Word32 i;
+
+   for ( i = 0; i < n; i += 4 )
+      acc = vpadalq_s32( acc, vmulq_s32( REAL2INT32_NEON( x + i ), REAL2INT32_NEON( y + i ) ) );
+   return SUM_NEON( acc );
+}
+
+static real_t dot_mul_r_neon( real_t x[], real_t y[], Word32 n )
+{
+   int64x2_t acc = vdupq_n_s64( 0 );
+   Word32 i;
+
+   for ( i = 0; i < n; i += 2 )
+      acc = vaddq_s64( acc, MUL_R_NEON( vmovn_s64( vld1q_s64( x + i ) ), vmovn_s64( vld1q_s64( y + i ) ) ) );
+   return SUM_NEON( acc );
+}
+
+static int64_t abs_sum_neon( real_32_t x[], Word32 n )
+{
+   int64x2_t acc = vdupq_n_s64( 0 );
+   Word32 i;
+
+   for ( i = 0; i < n; i += 4 )
+      acc = vpadalq_s32( acc, vabsq_s32( vld1q_s32( x + i ) ) );
+   return SUM_NEON( acc );
+}
+
+static void convolve_neon( real_t x[], real_t h[], real_t y[] )
+{
+   int32_t hz[3 + L_SUBFR];   /* REAL32(h[]) after three zeros, for k-i < 0 */
+   int32x4_t vh;
+   int32x2_t vx;
+   int64x2_t lo, hi;
+   Word32 i, k;
+
+   hz[0] = hz[1] = hz[2] = 0;
+   for ( i = 0; i < L_SUBFR; i++ )
+      hz[3 + i] = REAL32( h[i] );
+
+   for ( k = 0; k < L_SUBFR; k += 4 ) {
+      lo = hi = vdupq_n_s64( 0 );
+      for ( i = 0; i < k + 4; i++ ) {
+         vx = vdup_n_s32( REAL32( x[i] ) );
+         vh = vld1q_s32( hz + 3 + k - i );
+         lo = vaddq_s64( lo, MUL_R_NEON( vx, vget_low_s32( vh ) ) );
+         hi = vaddq_s64( hi, MUL_R_NEON( vx, vget_high_s32( vh ) ) );
+      }
+      vst1q_s64( y + k, lo );
+      vst1q_s64( y + k + 2, hi );
+   }
+}
+
+/* y[k..k+3] of residu(), from x32[] = REAL32(x[-M..]) */
+static INLINE void residu_neon( real_32_t a[], int32_t x32[], Word32 k, int64x2_t *lo, int64x2_t *hi )
+{
+   int32x4_t vx;
+   int32x2_t va;
+   Word32 j;
+
+   *lo = *hi = vdupq_n_s64( 0 );
+   for ( j = 0; j <= M; j++ ) {
+      va = vdup_n_s32( a[j] );
+      vx = vld1q_s32( x32 + M + k - j );
+      *lo = vaddq_s64( *lo, MUL_R_NEON( vget_low_s32( vx ), va ) );
+      *hi = vaddq_s64( *hi, MUL_R_NEON( vget_high_s32( vx ), va ) );
+   }
+}
+
+static void residu_64_neon( real_32_t a[], real_t x[], real_t y[] )
+{
+   int32_t x32[M + L_SUBFR];
+   int64x2_t lo, hi;
+   Word32 k;
+
+   for ( k = - M; k < L_SUBFR; k++ )
+      x32[M + k] = REAL32( x[k] );
+   for ( k = 0; k < L_SUBFR; k += 4 ) {
+      residu_neon( a, x32, k, &lo, &hi );
+      vst1q_s64( y + k, lo );
+      vst1q_s64( y + k + 2, hi );
+   }
+}
+
+static void residu_32_neon( real_32_t a[], real_t x[], real_32_t y[] )
+{
+   int32_t x32[M + L_SUBFR];
+   int64x2_t lo, hi;
+   Word32 k;
+
+   for ( k = - M; k < L_SUBFR; k++ )
+      x32[M + k] = REAL32( x[k] );
+   for ( k = 0; k < L_SUBFR; k += 4 ) {
+      residu_neon( a, x32, k, &lo, &hi );
+      vst1q_s32( y + k, vcombine_s32( vmovn_s64( lo ), vmovn_s64( hi ) ) );
+   }
+}
+
+static Word32 norm_corr_neon( real_t exc[], real_t xn[], real_t h[], real_t y[],
+                              Word32 t_min, Word32 t_max, int64_t corr[], int64_t norm[] )
+{
+   /* y[] one lane up, below it exc[-t-1]: the next y[] is
+      yb[i] + MUL_R(exc[-t-1],h[i]), with h[0] taken as 0 */
+   int64_t yb[2][1 + L_SUBFR], *cur = yb[0], *next = yb[1], *tmp;
+   int32_t h32[L_SUBFR];
+   int32x2_t e;
+   int32x4_t vy;
+   int64x2_t nm;
+   Word32 i, t;
+
+   if ( !fits_32( h, L_SUBFR ) || !fits_32( &exc[ - t_max], t_max - t_min ) )
+      return 0;
+
+   h32[0] = 0;
+   for ( i = 1; i < L_SUBFR; i++ )
+      h32[i] = ( int32_t )h[i];
+   memcpy( cur + 1, y, L_SUBFR * sizeof( int64_t ) );
+
+   for ( t = t_min; ; t++ ) {
+      nm = vdupq_n_s64( 0 );
+      for ( i = 0; i < L_SUBFR; i += 4 ) {
+         /* the low 32 bits, as int, of each y[] */
+         vy = vcombine_s32( vmovn_s64( vld1q_s64( cur + 1 + i ) ), vmovn_s64( vld1q_s64( cur + 3 + i ) ) );
+         nm = vpadalq_s32( nm, vshrq_n_s32( vabsq_s32( vy ), REAL_BITS ) );
+      }
+      corr[t - t_min] = dot_fixed_neon( xn, cur + 1, L_SUBFR );
+      norm[t - t_min] = SUM_NEON( nm );
+      if ( t == t_max )
+         break;
+
+      cur[0] = exc[ - t - 1];
+      e = vdup_n_s32( ( int32_t )exc[ - t - 1] );
+      for ( i = 0; i < L_SUBFR; i += 2 )
+         vst1q_s64( next + 1 + i, vaddq_s64( vld1q_s64( cur + i ), MUL_R_NEON( e, vld1_s32( h32 + i ) ) ) );
+      tmp = cur;
+      cur = next;
+      next = tmp;
+   }
+   return 1;
+}
+
+#endif /* AMR_SIMD_NEON */
+
+static Word32 simd_supported( void )
+{
+#ifdef AMR_SIMD_X86
+   __builtin_cpu_init();
+   if ( __builtin_cpu_supports( "avx2" ) )
+      return AMR_SIMD_256;
+#endif
+#ifdef AMR_SIMD_NEON
+   return AMR_SIMD_128; /* we were built for a CPU that has NEON */
+#endif
+   return AMR_SIMD_NONE;
+}
+
+Word32 amr_simd_setup( Word32 max_level )
+{
+   Word32 level = min( simd_supported(), max_level );
+
+   memset( &amr_simd_kernels, 0, sizeof( amr_simd_kernels ) );
+#ifdef AMR_SIMD_X86
+   /* SSE2 has no signed 32x32->64 bit multiply, and making up for it
+      costs more than the scalar loops: only AVX2 is worth it */
+   if ( level == AMR_SIMD_256 ) {
+      amr_simd_kernels.cor_h_x = cor_h_x_avx2;
+      amr_simd_kernels.cor_h = cor_h_avx2;
+      amr_simd_kernels.search_pair = search_pair_avx2;
+      amr_simd_kernels.dot_32 = dot_32_avx2;
+      amr_simd_kernels.dot_fixed = dot_fixed_avx2;
+      amr_simd_kernels.dot_mul_r = dot_mul_r_avx2;
+      amr_simd_kernels.abs_sum = abs_sum_avx2;
+      amr_simd_kernels.convolve = convolve_avx2;
+      amr_simd_kernels.residu = residu_64_avx2;
+      amr_simd_kernels.residu_32 = residu_32_avx2;
+      amr_simd_kernels.norm_corr = norm_corr_avx2;
+   }
+   else
+      level = AMR_SIMD_NONE;
+#endif
+#ifdef AMR_SIMD_NEON
+   if ( level >= AMR_SIMD_128 ) {
+      level = AMR_SIMD_128;
+      amr_simd_kernels.cor_h_x = cor_h_x_neon;
+      amr_simd_kernels.cor_h = cor_h_neon;
+      amr_simd_kernels.search_pair = search_pair_neon;
+      amr_simd_kernels.dot_32 = dot_32_neon;
+      amr_simd_kernels.dot_fixed = dot_fixed_neon;
+      amr_simd_kernels.dot_mul_r = dot_mul_r_neon;
+      amr_simd_kernels.abs_sum = abs_sum_neon;
+      amr_simd_kernels.convolve = convolve_neon;
+      amr_simd_kernels.residu = residu_64_neon;
+      amr_simd_kernels.residu_32 = residu_32_neon;
+      amr_simd_kernels.norm_corr = norm_corr_neon;
+   }
+#endif
+   amr_simd_kernels.level = level;
+   amr_simd_initialized = 1;
+
+   return level;
+}
+
+static void simd_init_once( void )
+{
+   if ( !amr_simd_initialized )
+      amr_simd_setup( AMR_SIMD_BEST );
+}
+
+void amr_simd_init( void )
+{
+#ifdef WIN32
+   /* 0: not yet, 1: being set up (by another thread), 2: done */
+   static volatile long simd_done = 0;
+
+   if ( InterlockedCompareExchange( &simd_done, 1, 0 ) == 0 ) {
+      simd_init_once();
+      InterlockedExchange( &simd_done, 2 );
+   }
+   else {
+      while ( simd_done != 2 )
+         Sleep( 0 );
+   }
+#else
+   static pthread_once_t simd_once = PTHREAD_ONCE_INIT;
+
+   pthread_once( &simd_once, simd_init_once );
+#endif
+}
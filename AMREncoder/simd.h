@@ -0,0 +1,147 @@
+/*
+ * ===================================================================
+ *  TS 26.104
+ *  REL-5 V5.4.0 2004-03
+ *  REL-6 V6.1.0 2004-03
+ *  3GPP AMR Floating-point Speech Codec
+ * ===================================================================
+ *
+ */
+
+/*
+ * simd.h
+ *
+ *
+ * Project:
+ *    AMR Floating-Point Codec
+ *
+ * Contains:
+ *    Vector (AVX2 or NEON) versions of the algebraic codebook
+ *    search's inner loops, and of the dot products, convolutions and
+ *    correlations of the LPC and pitch analysis.  They use exactly the
+ *    same fixed-point arithmetic as the scalar loops in sp_enc.c, so
+ *    their output is bit-exact with them.
+ *
+ */
+#ifndef _AMR_SIMD_H
+#define _AMR_SIMD_H
+
+#include "typedef.h"
+#include "fixed.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* vector widths, for amr_simd_setup() */
+#define AMR_SIMD_NONE   0   /* use the scalar loops */
+#define AMR_SIMD_128    1   /* NEON */
+#define AMR_SIMD_256    2   /* AVX2 */
+#define AMR_SIMD_BEST   AMR_SIMD_256
+
+#define AMR_SIMD_L_CODE 40  /* L_CODE of rom_enc.h */
+#define AMR_SIMD_TRACKS 5   /* NB_TRACK of rom_enc.h */
+#define AMR_SIMD_TRACK  16  /* > the positions of a track, STEP or STEP_MR102 apart */
+#define AMR_SIMD_L_SUBFR 40 /* L_SUBFR of rom_enc.h */
+#define AMR_SIMD_M      10  /* M of rom_enc.h, the LPC order */
+
+typedef struct
+{
+   Word32 level;
+
+   /*
+    * cor_h_x: dn[i] = the sum of MUL_R(h[k],x[i+k]), k < L_CODE-i
+    */
+   void ( *cor_h_x )( real_t h[], real_t x[], real_32_t dn[] );
+
+   /*
+    * cor_h: rr[i][j] = sign[i]*sign[j]*the sum of MUL_R(h[k],h[k+|i-j|]),
+    * k < L_CODE-max(i,j), with every sign[] +1 or -1.  Unless rrt is NULL,
+    * the rows are also stored by tracks, for search_pair():
+    * rrt[i][t][k] = rr[i][t+k*step].
+    * Returns 0, without touching rr[][], if h[] does not fit in 32 bits.
+    */
+   Word32 ( *cor_h )( real_t h[], Word32 sign[],
+                      real_32_t rr[][AMR_SIMD_L_CODE],
+                      real_32_t rrt[][AMR_SIMD_TRACKS][AMR_SIMD_TRACK], Word32 step );
+
+   /*
+    * search_pair: one "i2 and i3"-style loop of search_8i40() and
+    * search_10i40(), on the rrt[][][] of cor_h().
+    * Tries the pulse pairs ia = a + k*step (k < na),
+    * ib = b + l*step (l < nb), a and b < step, added to the npos pulses pos[] whose
+    * correlation and energy are *ps and *alp, and keeps the first pair
+    * that maximizes sq/alp.  sq is ps*ps, in 64 bits if "wide" is set
+    * and in 32 bits otherwise.  On return *ps, *alp, *sq, *ia and *ib
+    * hold what the scalar loop leaves in them.
+    * Returns 0, without touching the results, if the pair cannot be
+    * found exactly as the scalar loop would (an energy <= 0, or a wide
+    * sq beyond 32 bits).
+    */
+   Word32 ( *search_pair )( real_32_t dn[], real_32_t rrt[][AMR_SIMD_TRACKS][AMR_SIMD_TRACK],
+                            Word32 pos[], Word32 npos, Word32 a, Word32 na,
+                            Word32 b, Word32 nb, Word32 step, Word32 wide,
+                            int32_t *ps, real_32_t *alp, int64_t *sq,
+                            Word32 *ia, Word32 *ib );
+
+   /*
+    * The LPC and pitch analysis primitives.  Their lengths n are
+    * multiples of 8, and all their sums wrap around as the scalar ones do.
+    *
+    * dot_32: the sum of REAL2INT32(x[i])*REAL2INT32(y[i]), i < n,
+    * each product in 32 bits (comp_corr()).
+    * dot_fixed: the same for real_t x[] and y[] (Dotproduct40_fixed()).
+    * dot_mul_r: the sum of MUL_R(REAL32(x[i]),REAL32(y[i])), i < n
+    * (Dotproduct40_fix2()).
+    * abs_sum: the sum of abs(x[i]), i < n.
+    */
+   int64_t ( *dot_32 )( real_32_t x[], real_32_t y[], Word32 n );
+   int64_t ( *dot_fixed )( real_t x[], real_t y[], Word32 n );
+   real_t ( *dot_mul_r )( real_t x[], real_t y[], Word32 n );
+   int64_t ( *abs_sum )( real_32_t x[], Word32 n );
+
+   /*
+    * convolve: y[k] = the sum of MUL_R(REAL32(x[i]),REAL32(h[k-i])),
+    * i <= k < L_SUBFR.
+    */
+   void ( *convolve )( real_t x[], real_t h[], real_t y[] );
+
+   /*
+    * residu: y[k] = the sum of MUL_R(REAL32(x[k-j]),a[j]), j <= M,
+    * k < L_SUBFR; residu_32 stores y[] in 32 bits (Residu3(), Residu2()).
+    */
+   void ( *residu )( real_32_t a[], real_t x[], real_t y[] );
+   void ( *residu_32 )( real_32_t a[], real_t x[], real_32_t y[] );
+
+   /*
+    * norm_corr: the delay loop of Norm_Corr().  From y[], the excitation
+    * exc[-t_min] filtered by h[], it computes for each delay t from
+    * t_min to t_max corr[t-t_min] = dot_fixed(xn,y,L_SUBFR) and
+    * norm[t-t_min] = the sum of REAL2INT(abs(y[i])), then moves y[] on
+    * to the next delay: y[i] = y[i-1] + MUL_R(exc[-t-1],h[i]),
+    * y[0] = exc[-t-1].  y[] is left undefined.
+    * Returns 0, without touching the results, if h[] or exc[] does
+    * not fit in 32 bits.
+    */
+   Word32 ( *norm_corr )( real_t exc[], real_t xn[], real_t h[], real_t y[],
+                          Word32 t_min, Word32 t_max, int64_t corr[], int64_t norm[] );
+} AMR_SIMD_Kernels;
+
+/* NULL entries mean that the scalar loops are used */
+extern AMR_SIMD_Kernels amr_simd_kernels;
+
+/* selects the widest kernels that the CPU supports, once for all
+   encoders, unless amr_simd_setup() has already been called
+   (Speech_Encode_Frame_init() calls this) */
+void amr_simd_init( void );
+
+/* selects the widest kernels up to "max_level"; returns the level chosen.
+   The kernels are shared by all encoders, so call this only while no
+   encoder is encoding - e.g., before opening any. */
+Word32 amr_simd_setup( Word32 max_level );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
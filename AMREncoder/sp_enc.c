@@ -28,6 +28,7 @@
 #include "sp_enc.h"
 #include "rom_enc.h"
 #include "fixed.h"
+#include "simd.h"
 
 #define AMR_DEBUG	1
 
@@ -548,6 +549,9 @@ INLINE static int64_t Dotproduct40_fixed( real_t *x, real_t *y )
     int32_t hi,lo;
 #endif
 
+   if ( amr_simd_kernels.dot_fixed )
+      return amr_simd_kernels.dot_fixed( x, y, 40 );
+
 #ifdef FIXED_USE_ASM
     FIXED_MUL(hi,lo,REAL2INT32(x[0]),REAL2INT32(y[0]));
     for ( i=1; i<40; i++ )
@@ -570,6 +574,9 @@ INLINE static real_t Dotproduct40_fix2( real_t *x, real_t *y )
     int32_t hi,lo;
 #endif
 
+   if ( amr_simd_kernels.dot_mul_r )
+      return amr_simd_kernels.dot_mul_r( x, y, 40 );
+
 #ifdef FIXED_USE_ASM
     FIXED_MUL(hi,lo,REAL32(x[0]),REAL32(y[0]));
     for ( i=1; i<40; i++ )
@@ -619,6 +626,12 @@ static void Autocorr( real_t x[], int64_t r[], const real_t wind[] )
    /*
     * Autocorrelation
     */
+   if ( amr_simd_kernels.dot_fixed ) {
+      for ( i = 0; i <= M; i++ )
+         r[i] = amr_simd_kernels.dot_fixed( y, &y[i], L_WINDOW );
+      return;
+   }
+
    for ( i = 0; i <= M; i++ ) {
       sum = 0;
 
@@ -1528,15 +1541,14 @@ static void Q_plsf_3( enum Mode mode, real_t *past_rq,
 
    /* Split-VQ of prediction error */
    /* MR475, MR515 */
-#if 0
    if ( ( mode == MR475 ) || ( mode == MR515 ) ) {
       indice[0] = Vq_subvec3( &lsf_r1[0], dico1_lsf_3, &wf1[0], DICO1_SIZE_3, 0 );
       indice[1] = Vq_subvec3( &lsf_r1[3], dico2_lsf_3, &wf1[3], DICO2_SIZE_3 /2, 1 );
       indice[2] = Vq_subvec4( &lsf_r1[6], mr515_3_lsf, &wf1[6], MR515_3_SIZE );
    }
-#endif
+
    /* MR795 */
-   /*else*/ if ( mode == MR795 ) {
+   else if ( mode == MR795 ) {
       indice[0] = Vq_subvec3( &lsf_r1[0], mr795_1_lsf, &wf1[0], MR795_1_SIZE, 0 );
       indice[1] = Vq_subvec3( &lsf_r1[3], dico2_lsf_3, &wf1[3], DICO2_SIZE_3, 0 );
       indice[2] = Vq_subvec4( &lsf_r1[6], dico3_lsf_3, &wf1[6], DICO3_SIZE_3 );
@@ -2050,6 +2062,11 @@ static void Residu2( real_32_t a[], real_t x[], real_32_t y[] )
     int32_t hi,lo;
 #endif
 
+   if ( amr_simd_kernels.residu_32 ) {
+      amr_simd_kernels.residu_32( a, x, y );
+      return;
+   }
+
    for ( i = 0; i < L_SUBFR; i ++ ) {
 #ifdef FIXED_USE_ASM
        FIXED_MUL(hi,lo,x[i],a[0]);
@@ -2073,6 +2090,11 @@ static void Residu3( real_32_t a[], real_t x[], real_t y[] )
     int32_t hi,lo;
 #endif
 
+   if ( amr_simd_kernels.residu ) {
+      amr_simd_kernels.residu( a, x, y );
+      return;
+   }
+
    for ( i = 0; i < L_SUBFR; i ++ ) {
 #ifdef FIXED_USE_ASM
        FIXED_MUL(hi,lo,x[i],a[0]);
@@ -2131,9 +2153,12 @@ INLINE static void Syn_filt( real_t a[], real_t x[], real_t y[],
            FIXED_MSUB(hi,lo,REAL32(a[j]),REAL32(yy[-j]));
        *yy++ = FIXED_INT64_R(hi,lo);
 #else
+       /* the newest output last, so that the next one waits on it
+          for one product only */
        sum = MUL_R(REAL32(x[i]),REAL32(a[0]));
-       for (j=1;j<=M;j++)
+       for (j=M;j>1;j--)
            sum -= MUL_R(REAL32(a[j]),REAL32(yy[-j]));
+       sum -= MUL_R(REAL32(a[1]),REAL32(yy[-1]));
        *yy++ = sum;
 #endif
        y[i] = yy[ - 1];
@@ -2172,8 +2197,9 @@ INLINE static void Syn_filt2( real_32_t a[], real_32_t x[], real_32_t y[],
        *yy++ = FIXED_INT64_R(hi,lo);
 #else
        sum = MUL_R(x[i],a[0]);
-       for (j=1;j<=M;j++)
+       for (j=M;j>1;j--)
            sum -= MUL_R(REAL32(a[j]),yy[-j]);
+       sum -= MUL_R(REAL32(a[1]),yy[-1]);
        *yy++ = sum;
 #endif
        y[i] = yy[ - 1];
@@ -2212,8 +2238,9 @@ INLINE static void Syn_filt3( real_32_t a[], real_t x[], real_t y[],
        *yy++ = FIXED_INT64_R(hi,lo);
 #else
        sum = MUL_R(REAL32(x[i]),REAL32(a[0]));
-       for (j=1;j<=M;j++)
+       for (j=M;j>1;j--)
            sum -= MUL_R(REAL32(a[j]),REAL32(yy[-j]));
+       sum -= MUL_R(REAL32(a[1]),REAL32(yy[-1]));
        *yy++ = sum;
 #endif
        y[i] = yy[ - 1];
@@ -2323,6 +2350,12 @@ static void comp_corr( real_32_t sig[], Word32 L_frame, Word32 lag_max,
    int64_t T0;
 #endif
 
+   if ( amr_simd_kernels.dot_32 ) {
+      for ( i = lag_max; i >= lag_min; i-- )
+         corr[ - i] = amr_simd_kernels.dot_32( sig, &sig[ - i], L_frame );
+      return;
+   }
+
    for ( i = lag_max; i >= lag_min; i-- ) {
       p = sig;
       p1 = &sig[ - i];
@@ -2426,8 +2459,12 @@ static Word16 Lag_max( vadState *vadSt, int64_t corr[], real_32_t sig[],
    T0 = REAL_ICONST(0);
    p = &sig[ - p_max];
 
-   for ( i = 0; i < L_frame; i++, p++ ) {
-       T0 += fixed_fabs(*p);
+   if ( amr_simd_kernels.abs_sum )
+      T0 = amr_simd_kernels.abs_sum( p, L_frame );
+   else {
+      for ( i = 0; i < L_frame; i++, p++ ) {
+          T0 += fixed_fabs(*p);
+      }
    }
 
    if ( dtx ) {
@@ -2626,7 +2663,7 @@ static Word32 Pitch_ol( enum Mode mode, vadState *vadSt, real_32_t signal[],
    Word16 p_max1, p_max2, p_max3;
    int64_t *corr_ptr;
    Word32 i, j;
-   static real_t real_const1 = REAL_CONST(0.85);
+   static const real_t real_const1 = REAL_CONST(0.85);
 #ifdef VAD2
    Float32 r01, r02, r03;
    Float32 rmax1, rmax2, rmax3;
@@ -2754,20 +2791,18 @@ static Word32 Pitch_ol( enum Mode mode, vadState *vadSt, real_32_t signal[],
  * Returns:
  *    p_max             lag found
  */
-#if 0
-static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
-      Word32 old_lag, Word32 *cor_max, Word32 wght_flg, Float32 *gain_flg,
+static Word32 Lag_max_wght( vadState *vadSt, int64_t corr[], real_32_t signal[],
+      Word32 old_lag, Word32 *cor_max, Word32 wght_flg, real_t *gain_flg,
       Word32 dtx )
 {
-   Float32 t0, t1, max;
-   Float32 *psignal, *p1signal;
-   const Float32 *ww, *we;
+   int64_t t0, t1, max;
+   real_32_t *psignal, *p1signal;
+   const real_t *ww, *we;
    Word32 i, j, p_max;
 
-
    ww = &corrweight[250];
    we = &corrweight[266 - old_lag];
-   max = -FLT_MAX;
+   max = -MAX_REAL;
    p_max = PIT_MAX;
 
    /* see if the neigbouring emphasis is used */
@@ -2775,9 +2810,9 @@ static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
       /* find maximum correlation with weighting */
       for ( i = PIT_MAX; i >= PIT_MIN; i-- ) {
          /* Weighting of the correlation function. */
-         t0 = corr[ - i] * *ww--;
+         t0 = MUL_R(corr[ - i],*ww--);
           /* Weight the neighbourhood of the old lag. */
-         t0 *= *we--;
+         t0 = MUL_R(t0,*we--);
 
          if ( t0 >= max ) {
             max = t0;
@@ -2790,7 +2825,7 @@ static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
       /* find maximum correlation with weighting */
       for ( i = PIT_MAX; i >= PIT_MIN; i-- ) {
          /* Weighting of the correlation function. */
-         t0 = corr[ - i] * *ww--;
+         t0 = MUL_R(corr[ - i],*ww--);
 
          if ( t0 >= max ) {
             max = t0;
@@ -2805,9 +2840,15 @@ static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
    t1 = 0;
 
    /* Compute energy */
-   for ( j = 0; j < L_FRAME_BY2; j++, psignal++, p1signal++ ) {
-      t0 += *psignal * *p1signal;
-      t1 += *p1signal * *p1signal;
+   if ( amr_simd_kernels.dot_32 ) {
+      t0 = amr_simd_kernels.dot_32( psignal, p1signal, L_FRAME_BY2 );
+      t1 = amr_simd_kernels.dot_32( p1signal, p1signal, L_FRAME_BY2 );
+   }
+   else {
+      for ( j = 0; j < L_FRAME_BY2; j++, psignal++, p1signal++ ) {
+         t0 += REAL2INT32(*psignal) * REAL2INT32(*p1signal);
+         t1 += REAL2INT32(*p1signal) * REAL2INT32(*p1signal);
+      }
    }
 
    if ( dtx ) {
@@ -2817,7 +2858,7 @@ static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
 #else
       /* update and detect tone */
       vad_tone_detection_update( vadSt, 0 );
-      vad_tone_detection( vadSt, t0, t1 );
+      vad_tone_detection( vadSt, t0, REAL_ICONST(t1) );
 #endif
    }
 
@@ -2825,7 +2866,7 @@ static Word32 Lag_max_wght( vadState *vadSt, Float32 corr[], Float32 signal[],
     * gain flag is set according to the open_loop gain
     * is t2/t1 > 0.4 ?
     */
-   *gain_flg = t0 - ( t1 * 0.4F );
+   *gain_flg = REAL_ICONST(t0) - MUL_R(REAL_ICONST(t1),REAL_CONST(0.4F));
    *cor_max = 0;
    return( p_max );
 }
@@ -2912,20 +2953,17 @@ static Word32 gmed_n( Word32 ind[], Word32 n )
  * Returns:
  *    p_max1            open loop pitch lag
  */
-static Word32 Pitch_ol_wgh( Word32 *old_T0_med, Word16 *wght_flg, Float32 *ada_w,
-      vadState *vadSt, Float32 signal[], Word32 old_lags[], Float32 ol_gain_flg[],
+static Word32 Pitch_ol_wgh( Word32 *old_T0_med, Word16 *wght_flg, real_t *ada_w,
+      vadState *vadSt, real_32_t signal[], Word32 old_lags[], real_t ol_gain_flg[],
       Word16 idx, Word32 dtx )
 {
-   Float32 corr[PIT_MAX + 1];
-#ifndef VAD2
-   Float32 corr_hp_max;
-#endif
-   Float32 *corrPtr;
+   int64_t corr[PIT_MAX + 1];
+   int64_t *corrPtr;
    Word32 i, max1, p_max1;
 
-
    /* calculate all coreelations of signal, from pit_min to pit_max */
    corrPtr = &corr[PIT_MAX];
+   memset(corr,0,(PIT_MAX+1)*sizeof(int64_t));
    comp_corr( signal, L_FRAME_BY2, PIT_MAX, PIT_MIN, corrPtr );
    p_max1 = Lag_max_wght( vadSt, corrPtr, signal, *old_T0_med,
          &max1, *wght_flg, &ol_gain_flg[idx], dtx );
@@ -2938,34 +2976,21 @@ static Word32 Pitch_ol_wgh( Word32 *old_T0_med, Word16 *wght_flg, Float32 *ada_w
       }
       old_lags[0] = p_max1;
       *old_T0_med = gmed_n( old_lags, 5 );
-      *ada_w = 1;
+      *ada_w = REAL_ICONST(1);
    }
    else {
       *old_T0_med = p_max1;
-      *ada_w = *ada_w * 0.9F;
+      *ada_w = MUL_R(*ada_w,REAL_CONST(0.9F));
    }
 
-   if ( *ada_w < 0.3 ) {
+   if ( *ada_w < REAL_CONST(0.3F) ) {
       *wght_flg = 0;
    }
    else {
       *wght_flg = 1;
    }
-
-#ifndef VAD2
-   if ( dtx ) {
-      if ( idx == 1 ) {
-         /* calculate max high-passed filtered correlation of all lags */
-         hp_max( corrPtr, signal, L_FRAME_BY2, PIT_MAX, PIT_MIN, &corr_hp_max );
-
-         /* update complex background detector */
-         vadSt->best_corr_hp = corr_hp_max * 0.5F;
-      }
-   }
-#endif
    return( p_max1 );
 }
-#endif
 
 /*
  * ol_ltp
@@ -3016,27 +3041,23 @@ static void ol_ltp( enum Mode mode, vadState *vadSt, real_32_t wsp[],
       ol_gain_flg[1] = REAL_ICONST(0);
    }
 
-#if 0
    if ( ( mode == MR475 ) || ( mode == MR515 ) ) {
       *T_op = Pitch_ol( mode, vadSt, wsp, PIT_MIN, PIT_MAX, L_FRAME, dtx, idx );
    }
    else {
-#endif
       if ( mode <= MR795 ) {
          *T_op = Pitch_ol( mode, vadSt, wsp, PIT_MIN, PIT_MAX, L_FRAME_BY2, dtx,
                idx );
       }
-#if 0
       else if ( mode == MR102 ) {
          *T_op = Pitch_ol_wgh( old_T0_med, wght_flg, ada_w, vadSt, wsp, old_lags,
             ol_gain_flg, idx, dtx );
       }
-#endif
       else {
          *T_op = Pitch_ol( mode, vadSt, wsp, PIT_MIN_MR122, PIT_MAX, L_FRAME_BY2
                , dtx, idx );
       }
-//   }
+   }
 }
 
 
@@ -3225,7 +3246,7 @@ static void Norm_Corr( real_t exc[], real_t xn[],
 {
    real_t exc_temp[L_SUBFR];
    real_t *p_exc;
-   int64_t corr, norm;
+   int64_t corr[L_SUBFR], norm[L_SUBFR];   /* by delay, from t_min */
    register Word32 i, j, k;
 #ifdef FIXED_USE_ASM
    int32_t hi,lo;
@@ -3238,54 +3259,63 @@ static void Norm_Corr( real_t exc[], real_t xn[],
 
    /* compute the filtered excitation for the first delay t_min */
    /* convolution Yk(n) */
-   for ( j = 0; j < L_SUBFR; j++ ) {
+   if ( amr_simd_kernels.convolve )
+      amr_simd_kernels.convolve( p_exc, h, exc_temp );
+   else {
+      for ( j = 0; j < L_SUBFR; j++ ) {
 #ifdef FIXED_USE_ASM
-      FIXED_MUL(hi,lo,REAL32(p_exc[0]),REAL32(h[j]));
-      for ( i = 1; i <= j; i++ ) {
-         FIXED_MADD(hi,lo,REAL32(p_exc[i]),REAL32(h[j - i]));
-      }
-      exc_temp[j] = FIXED_INT64_R(hi,lo);
+         FIXED_MUL(hi,lo,REAL32(p_exc[0]),REAL32(h[j]));
+         for ( i = 1; i <= j; i++ ) {
+            FIXED_MADD(hi,lo,REAL32(p_exc[i]),REAL32(h[j - i]));
+         }
+         exc_temp[j] = FIXED_INT64_R(hi,lo);
 #else
-      sum = REAL_ICONST(0);
+         sum = REAL_ICONST(0);
 
-      for ( i = 0; i <= j; i++ ) {
-         sum += MUL_R(REAL32(p_exc[i]),REAL32(h[j - i]));
-      }
-      exc_temp[j] = sum;
+         for ( i = 0; i <= j; i++ ) {
+            sum += MUL_R(REAL32(p_exc[i]),REAL32(h[j - i]));
+         }
+         exc_temp[j] = sum;
 #endif
+      }
    }
 
    /* loop for every possible period */
-   for ( i = t_min; i <= t_max; i++ ) {
-      /*        39                     */
-      /* SQRT[ SUM[ Yk(n) * Yk(n)] ]   */
-      /*       n=0                     */
-       norm = 0;
-       for ( j=0; j<40; j++)
-           norm += REAL2INT(fixed_fabs(exc_temp[j]));
-
-      /*        39                  */
-      /* SQRT[ SUM[ X(n) * Yk(n)] ] */
-      /*       n=0                  */
-      corr = Dotproduct40_fixed( xn, exc_temp );
-
-      /* R(k) */
-      if ( norm == 0 )
-         corr_norm[i] = REAL_ICONST(corr);
-      else
-         corr_norm[i] = REAL_ICONST(corr)/norm;
-
-      /* modify the filtered excitation exc_tmp[] for the next iteration */
-      if ( i != t_max ) {
-         k--;
-
-         for ( j = L_SUBFR - 1; j > 0; j-- ) {
-            /* Yk(n) = Yk-1(n-1) + u(-k) * h(n) */
-            exc_temp[j] = exc_temp[j - 1] + MUL_R(exc[k],h[j]);
+   if ( !amr_simd_kernels.norm_corr ||
+        !amr_simd_kernels.norm_corr( exc, xn, h, exc_temp, t_min, t_max, corr, norm ) ) {
+      for ( i = t_min; i <= t_max; i++ ) {
+         /*        39                     */
+         /* SQRT[ SUM[ Yk(n) * Yk(n)] ]   */
+         /*       n=0                     */
+         norm[i - t_min] = 0;
+         for ( j=0; j<40; j++)
+            norm[i - t_min] += REAL2INT(fixed_fabs(exc_temp[j]));
+
+         /*        39                  */
+         /* SQRT[ SUM[ X(n) * Yk(n)] ] */
+         /*       n=0                  */
+         corr[i - t_min] = Dotproduct40_fixed( xn, exc_temp );
+
+         /* modify the filtered excitation exc_tmp[] for the next iteration */
+         if ( i != t_max ) {
+            k--;
+
+            for ( j = L_SUBFR - 1; j > 0; j-- ) {
+               /* Yk(n) = Yk-1(n-1) + u(-k) * h(n) */
+               exc_temp[j] = exc_temp[j - 1] + MUL_R(exc[k],h[j]);
+            }
+            exc_temp[0] = exc[k];
          }
-         exc_temp[0] = exc[k];
       }
    }
+
+   /* R(k) */
+   for ( i = t_min; i <= t_max; i++ ) {
+      if ( norm[i - t_min] == 0 )
+         corr_norm[i] = REAL_ICONST(corr[i - t_min]);
+      else
+         corr_norm[i] = REAL_ICONST(corr[i - t_min])/norm[i - t_min];
+   }
 }
 
 
@@ -3867,88 +3897,6 @@ static Word32 Pitch_fr( Word32 *T0_prev_subframe, enum Mode mode, Word32 T_op[],
  * Returns:
  *    void
  */
-#if 0
-static void Pred_lt_3or6( Float32 exc[], Word32 T0, Word32 frac, Word16 flag3 )
-{
-   Float32 s;
-   Float32 *x0, *x1, *x2;
-   const Float32 *c1, *c2;
-   Word32 j;
-
-
-   x0 = &exc[ - T0];
-   frac = -frac;
-
-   if ( flag3 != 0 ) {
-      /* inter_3l[k] = b60[2*k] -> k' = 2*k */
-      frac <<= 1;
-   }
-
-   if ( frac < 0 ) {
-      frac += UP_SAMP_MAX;
-      x0--;
-   }
-   c1 = &b60[frac];
-   c2 = &b60[UP_SAMP_MAX - frac];
-
-   for ( j = 0; j < L_SUBFR; j += 4 ) {
-      x1 = x0++;
-      x2 = x0;
-      s = x1[0] * c1[0] + x2[0] * c2[0];
-      s += x1[ - 1] *c1[6] + x2[1] * c2[6];
-      s += x1[ - 2] * c1[12] + x2[2] * c2[12];
-      s += x1[ - 3] * c1[18] + x2[3] * c2[18];
-      s += x1[ - 4] * c1[24] + x2[4] * c2[24];
-      s += x1[ - 5] * c1[30] + x2[5] * c2[30];
-      s += x1[ - 6] * c1[36] + x2[6] * c2[36];
-      s += x1[ - 7] * c1[42] + x2[7] * c2[42];
-      s += x1[ - 8] * c1[48] + x2[8] * c2[48];
-      s += x1[ - 9] * c1[54] + x2[9] * c2[54];
-      exc[j] = ( Float32 )floor(s + 0.5F);
-      x1 = x0++;
-      x2 = x0;
-      s = x1[0] * c1[0] + x2[0] * c2[0];
-      s += x1[ - 1] *c1[6] + x2[1] * c2[6];
-      s += x1[ - 2] * c1[12] + x2[2] * c2[12];
-      s += x1[ - 3] * c1[18] + x2[3] * c2[18];
-      s += x1[ - 4] * c1[24] + x2[4] * c2[24];
-      s += x1[ - 5] * c1[30] + x2[5] * c2[30];
-      s += x1[ - 6] * c1[36] + x2[6] * c2[36];
-      s += x1[ - 7] * c1[42] + x2[7] * c2[42];
-      s += x1[ - 8] * c1[48] + x2[8] * c2[48];
-      s += x1[ - 9] * c1[54] + x2[9] * c2[54];
-      exc[j + 1] = ( Float32 )floor(s + 0.5F);
-      x1 = x0++;
-      x2 = x0;
-      s = x1[0] * c1[0] + x2[0] * c2[0];
-      s += x1[ - 1] *c1[6] + x2[1] * c2[6];
-      s += x1[ - 2] * c1[12] + x2[2] * c2[12];
-      s += x1[ - 3] * c1[18] + x2[3] * c2[18];
-      s += x1[ - 4] * c1[24] + x2[4] * c2[24];
-      s += x1[ - 5] * c1[30] + x2[5] * c2[30];
-      s += x1[ - 6] * c1[36] + x2[6] * c2[36];
-      s += x1[ - 7] * c1[42] + x2[7] * c2[42];
-      s += x1[ - 8] * c1[48] + x2[8] * c2[48];
-      s += x1[ - 9] * c1[54] + x2[9] * c2[54];
-      exc[j + 2] = ( Float32 )floor(s + 0.5F);
-      x1 = x0++;
-      x2 = x0;
-      s = x1[0] * c1[0] + x2[0] * c2[0];
-      s += x1[ - 1] *c1[6] + x2[1] * c2[6];
-      s += x1[ - 2] * c1[12] + x2[2] * c2[12];
-      s += x1[ - 3] * c1[18] + x2[3] * c2[18];
-      s += x1[ - 4] * c1[24] + x2[4] * c2[24];
-      s += x1[ - 5] * c1[30] + x2[5] * c2[30];
-      s += x1[ - 6] * c1[36] + x2[6] * c2[36];
-      s += x1[ - 7] * c1[42] + x2[7] * c2[42];
-      s += x1[ - 8] * c1[48] + x2[8] * c2[48];
-      s += x1[ - 9] * c1[54] + x2[9] * c2[54];
-      exc[j + 3] = ( Float32 )floor(s + 0.5F);
-   }
-   return;
-}
-#endif
-
 static void Pred_lt_3or6_fixed( Word32 exc[], Word32 T0, Word32 frac, Word32 flag3 )
 {
    Word32 s, i, j;
@@ -3995,6 +3943,93 @@ static void Pred_lt_3or6_fixed( Word32 exc[], Word32 T0, Word32 frac, Word32 fla
 }
 
 
+/*
+ * Pred_lt_3or6
+ *
+ *
+ * Parameters:
+ *    exc      B: excitation buffer
+ *    T0       I: integer pitch lag
+ *    frac     I: fraction of lag
+ *    flag3    I: if set, upsampling rate = 3 (6 otherwise)
+ *
+ * Function:
+ *    Pred_lt_3or6_fixed() on a real_t excitation buffer. The adaptive
+ *    codebook vector is computed on the integer excitation, as in the
+ *    decoder, to keep encoder and decoder excitation in sync.
+ *
+ * Returns:
+ *    void
+ */
+static void Pred_lt_3or6( real_t exc[], Word32 T0, Word32 frac, Word32 flag3 )
+{
+   Word32 exc_tmp[PIT_MAX + L_INTERPOL + L_SUBFR];
+   Word32 *exc_tmp_p;
+   Word32 i;
+
+   exc_tmp_p = exc_tmp + PIT_MAX + L_INTERPOL;
+
+   for (i = -(PIT_MAX + L_INTERPOL); i < L_SUBFR; i++)
+      exc_tmp_p[i] = REAL2INT(exc[i]);
+
+   Pred_lt_3or6_fixed( exc_tmp_p, T0, frac, flag3 );
+
+   for (i = -(PIT_MAX + L_INTERPOL); i < L_SUBFR; i++)
+      exc[i] = REAL_ICONST(exc_tmp_p[i]);
+}
+
+
+/*
+ * Convolve
+ *
+ *
+ * Parameters:
+ *    x                 I: First input
+ *    h                 I: second input
+ *    y                 O: output
+ *
+ * Function:
+ *    Convolution
+ *
+ *    y[n] = sum_{i=0}^{n} x[i] h[n-i], n=0,...,L-1
+ *
+ * Returns:
+ *    void
+ */
+static void Convolve( real_t x[], real_t h[], real_t y[] )
+{
+   Word32 i, n;
+#ifdef FIXED_USE_ASM
+   int32_t hi,lo;
+#else
+   real_t s;
+#endif
+
+   if ( amr_simd_kernels.convolve ) {
+      amr_simd_kernels.convolve( x, h, y );
+      return;
+   }
+
+   for ( n = 0; n < L_SUBFR; n++ ) {
+#ifdef FIXED_USE_ASM
+      FIXED_MUL(hi,lo,x[0],h[n]);
+
+      for ( i = 1; i <= n; i++ ) {
+         FIXED_MADD(hi,lo,REAL32(x[i]),REAL32(h[n - i]));
+      }
+      y[n] = FIXED_INT64_R(hi,lo);
+#else
+      s = REAL_ICONST(0);
+
+      for ( i = 0; i <= n; i++ ) {
+         s += MUL_R(REAL32(x[i]),REAL32(h[n - i]));
+      }
+      y[n] = s;
+#endif
+   }
+}
+
+
 /*
  * G_pitch
  *
@@ -4206,17 +4241,7 @@ static void cl_ltp( Word32 *T0_prev_subframe, real_t *gp, enum Mode mode,
                     real_t gCoeff[], Word16 **anap, real_t *gp_limit )
 {
    Word32 i;
-   Word32 n;
    Word16 gpc_flag, resu3;   /* flag for upsample resolution */
-   Word32 exc_tmp[314];
-   Word32 *exc_tmp_p;
-#ifdef FIXED_USE_ASM
-   int32_t hi,lo;
-#else
-   real_t s;
-#endif
-
-   exc_tmp_p = exc_tmp + PIT_MAX + L_INTERPOL;
 
    /* Closed-loop fractional pitch search */
    *T0 = Pitch_fr( T0_prev_subframe, mode, T_op,
@@ -4230,35 +4255,13 @@ static void cl_ltp( Word32 *T0_prev_subframe, real_t *gp, enum Mode mode,
     * to maintain encoder/decoder excitation
     * syncronization
     */
-    for (i = -(PIT_MAX + L_INTERPOL); i < 40; i++)
-      exc_tmp_p[i] = REAL2INT(exc[i]);
-
-   Pred_lt_3or6_fixed( exc_tmp_p, *T0, *T0_frac, resu3 );
-
-   for (i = -(PIT_MAX + L_INTERPOL); i < 40; i++)
-      exc[i] = REAL_ICONST(exc_tmp_p[i]);
+   Pred_lt_3or6( exc, *T0, *T0_frac, resu3 );
 
    /*
     *   Convolve to get filtered adaptive codebook vector
     *  y[n] = sum_{i=0}^{n} x[i] h[n-i], n=0,...,L-1
     */
-   for ( n = 0; n < L_SUBFR; n++ ) {
-#ifdef FIXED_USE_ASM
-      FIXED_MUL(hi,lo,exc[0],h1[n]);
-
-      for ( i = 1; i <= n; i++ ) {
-         FIXED_MADD(hi,lo,REAL32(exc[i]),REAL32(h1[n - i]));
-      }
-      y1[n] = FIXED_INT64_R(hi,lo);
-#else
-      s = REAL_ICONST(0);
-
-      for ( i = 0; i <= n; i++ ) {
-         s += MUL_R(REAL32(exc[i]),REAL32(h1[n - i]));
-      }
-      y1[n] = s;
-#endif
-   }
+   Convolve( exc, h1, y1 );
 
    /* The adaptive codebook gain */
    *gain_pit = G_pitch( xn, y1, gCoeff );
@@ -4390,6 +4393,10 @@ static void cor_h_x_fixed( real_t h[], real_t x[], real_32_t dn[] )
 {
    Word32 i;
 
+   if ( amr_simd_kernels.cor_h_x ) {
+      amr_simd_kernels.cor_h_x( h, x, dn );
+      return;
+   }
    dn[0] = (real_32_t)Dotproduct40_fix2( h, x );
 
    for ( i = 1; i < L_CODE; i++ )
@@ -4482,7 +4489,9 @@ static void cor_h( real_t h[], Word32 sign[], real_32_t rr[][L_CODE] )
    Word32 *signi, *signj;
    Word32 ii, total_loops, four_loops;
    register int i;
-   
+
+   if ( amr_simd_kernels.cor_h && amr_simd_kernels.cor_h( h, sign, rr, NULL, 0 ) )
+      return;
    sum = REAL_ICONST(0);
 
    /* Compute diagonal matrix of autocorrelation of h */
@@ -4641,6 +4650,35 @@ static void cor_h( real_t h[], Word32 sign[], real_32_t rr[][L_CODE] )
 }
 
 
+/*
+ * cor_h_tracks
+ *
+ *
+ * Parameters:
+ *    h                I: h[]
+ *    sign             I: sign information
+ *    rr               O: correlations
+ *    rrt              O: rr[][] by tracks, rrt[i][t][k] = rr[i][t+k*step]
+ *    step             I: distance between the positions of a track
+ *
+ * Function:
+ *    cor_h(), for search_8i40() and search_10i40(): when their pulse
+ *    pair loops have a vector version, it also gets the correlations
+ *    laid out for them.
+ *
+ * Returns:
+ *    1 if rrt[][][] was computed
+ */
+static Word32 cor_h_tracks( real_t h[], Word32 sign[], real_32_t rr[][L_CODE],
+                            real_32_t rrt[][AMR_SIMD_TRACKS][AMR_SIMD_TRACK], Word32 step )
+{
+   if ( amr_simd_kernels.search_pair && amr_simd_kernels.cor_h( h, sign, rr, rrt, step ) )
+      return 1;
+   cor_h( h, sign, rr );
+   return 0;
+}
+
+
 /*
  * search_2i40_9bits
  *
@@ -4682,18 +4720,18 @@ static void cor_h( real_t h[], Word32 sign[], real_32_t rr[][L_CODE] )
  * Returns:
  *    void
  */
-#if 0
-static void search_2i40_9bits( Word16 subNr, Float32 dn[], Float32 rr[][L_CODE],
-      Word32 codvec[] )
+static void search_2i40_9bits( Word16 subNr, real_32_t dn[], 
+                               real_32_t rr[][L_CODE], Word32 codvec[] )
 {
-   Float32 ps0, ps1, psk, alp, alp0, alp1, alpk, sq, sq1;
+   real_32_t alpk, alp, alp0, alp1;
+   int32_t ps0, ps1;
+   int64_t sq, sq1, psk;
    Word32 i0, i1, ix, i;
    Word16 ipos[2];
    Word16 track1;
 
-
    psk = -1;
-   alpk = 1;
+   alpk = REAL_ICONST(1);
 
    for ( i = 0; i < 2; i++ ) {
       codvec[i] = i;
@@ -4706,18 +4744,18 @@ static void search_2i40_9bits( Word16 subNr, Float32 dn[], Float32 rr[][L_CODE],
 
       /* i0 loop: try 8 positions	*/
       for ( i0 = ipos[0]; i0 < L_CODE; i0 += STEP ) {
-         ps0 = dn[i0];
+         ps0 = REAL2INT(dn[i0]);
          alp0 = rr[i0][i0];
 
          /* i1 loop: 8 positions */
          sq = -1;
-         alp = 1;
+         alp = REAL_ICONST(1);
          ix = ipos[1];
 
          for ( i1 = ipos[1]; i1 < L_CODE; i1 += STEP ) {
-            ps1 = ps0 + dn[i1];
-            alp1 = alp0 + rr[i1][i1] + 2.0F * rr[i0][i1];
-            sq1 = ps1 * ps1;
+            ps1 = ps0 + REAL2INT(dn[i1]);
+            alp1 = alp0 + rr[i1][i1] + (rr[i0][i1]<<1);
+            sq1 = (int64_t)ps1*ps1;
 
             if ( ( alp * sq1 ) > ( sq * alp1 ) ) {
                sq = sq1;
@@ -4759,25 +4797,26 @@ static void search_2i40_9bits( Word16 subNr, Float32 dn[], Float32 rr[][L_CODE],
  * Returns:
  *    void
  */
-static void build_code_2i40_9bits( Word16 subNr, Word32 codvec[], Float32
-      dn_sign[], Float32 cod[], Float32 h[], Float32 y[], Word16 *anap )
+static void build_code_2i40_9bits( Word16 subNr, Word32 codvec[], 
+                                   Word32 dn_sign[], real_t cod[], 
+                                   real_t h[], real_t y[], Word16 *anap )
 {
-   Float32 s;
-   Float32 *p0, *p1;
+   real_t s;
+   real_t *p0, *p1;
    Word32 _sign[2];
    Word32 i, j, k, track, index, indx = 0, rsign = 0;
-   Word8 first, *pt;
-
+   const Word16 *pt;
+   Word16 first;
 
    pt = &trackTable[subNr + ( subNr << 2 )];
-   memset( cod, 0, 160 );
+   memset( cod, 0, L_SUBFR*sizeof(real_t) );
 
    for ( k = 0; k < 2; k++ ) {
       /* read pulse position */
       i = codvec[k];
 
       /* read sign */
-      j = ( Word32 )dn_sign[i];
+      j = dn_sign[i];
 
       /* index = pos/5 */
       index = i / 5;
@@ -4812,14 +4851,14 @@ static void build_code_2i40_9bits( Word16 subNr, Word32 codvec[], Float32
       }
 
       if ( j > 0 ) {
-         cod[i] = 0.9998779296875F;
+         cod[i] = REAL_CONST(0.9998779296875F);
          _sign[k] = 1;
 
          /*	sign information */
          rsign = rsign + ( 1 << track );
       }
       else {
-         cod[i] = -1;
+         cod[i] = REAL_ICONST(-1);
          _sign[k] = -1;
       }
       indx = indx + index;
@@ -4864,33 +4903,37 @@ static void build_code_2i40_9bits( Word16 subNr, Word32 codvec[], Float32
  * Returns:
  *    void
  */
-static void code_2i40_9bits( Word16 subNr, Float32 x[], Float32 h[], Word32 T0,
-      Float32 pitch_sharp, Float32 code[], Float32 y[], Word16 *anap )
+static void code_2i40_9bits( Word16 subNr, real_t x[], real_t h[], 
+                             Word32 T0, real_t pitch_sharp, 
+                             real_t code[], real_t y[], Word16 *anap )
 {
-   Float32 rr[L_CODE][L_CODE];
-   Float32 dn[L_CODE], dn_sign[L_CODE], dn2[L_CODE];
+   real_32_t rr[L_CODE][L_CODE];
+   real_32_t dn[L_CODE], dn2[L_CODE];
+   Word32 dn_sign[L_CODE];
    Word32 codvec[2];
    Word32 i;
 
-
-   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0.0F ) )
+   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         h[i] += h[i - T0] * pitch_sharp;
+         h[i] = h[i] + MUL_R(h[i - T0],pitch_sharp);
       }
-   cor_h_x( h, x, dn );
+   }
+
+   cor_h_x_fixed( h, x, dn );
    set_sign( dn, dn_sign, dn2, 8 );
    cor_h( h, dn_sign, rr );
    search_2i40_9bits( subNr, dn, rr, codvec );
    build_code_2i40_9bits( subNr, codvec, dn_sign, code, h, y, anap );
 
-      /*
-       * Compute innovation vector gain.
-       * Include fixed-gain pitch contribution into code[].
-       */
-   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0.0F ) )
+   /*
+    * Compute innovation vector gain.
+    * Include fixed-gain pitch contribution into code[].
+    */
+   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         code[i] += code[i - T0] * pitch_sharp;
+         code[i] = code[i] + MUL_R(code[i - T0],pitch_sharp);
       }
+   }
 }
 
 
@@ -4910,18 +4953,18 @@ static void code_2i40_9bits( Word16 subNr, Float32 x[], Float32 h[], Word32 T0,
  * Returns:
  *    void
  */
-static void search_2i40_11bits( Float32 dn[], Float32 rr[][L_CODE], Word32
-      codvec[] )
+static void search_2i40_11bits( real_32_t dn[], real_32_t rr[][L_CODE], 
+                                Word32 codvec[] )
 {
-   Float64 alpk, alp, alp0, alp1;
-   Float32 psk, ps0, ps1, sq, sq1;
+   real_32_t alpk, alp, alp0, alp1;
+   int32_t ps0, ps1;
+   int64_t sq, sq1, psk;
    Word32 i, i0, i1, ix = 0;
    Word16 ipos[2];
    Word16 track1, track2;
 
-
    psk = -1;
-   alpk = 1;
+   alpk = REAL_ICONST(1);
 
    for ( i = 0; i < 2; i++ ) {
       codvec[i] = i;
@@ -4940,23 +4983,23 @@ static void search_2i40_11bits( Float32 dn[], Float32 rr[][L_CODE], Word32
           * i0 loop: try 8 positions.
           */
          for ( i0 = ipos[0]; i0 < L_CODE; i0 += STEP ) {
-            ps0 = dn[i0];
-            alp0 = rr[i0][i0] * 0.25F;
+            ps0 = REAL2INT(dn[i0]);
+            alp0 = rr[i0][i0]>>2;
 
             /*
              * i1 loop: 8 positions.
              */
             sq = -1;
-            alp = 1;
+            alp = REAL_ICONST(1);
             ix = ipos[1];
 
             for ( i1 = ipos[1]; i1 < L_CODE; i1 += STEP ) {
-               ps1 = ps0 + dn[i1];
+               ps1 = ps0 + REAL2INT(dn[i1]);
 
                /* alp1 = alp0 + rr[i0][i1] + 1/2*rr[i1][i1]; */
-               alp1 = alp0 + rr[i1][i1] * 0.25F;
-               alp1 += rr[i0][i1] * 0.5F;
-               sq1 = ps1 * ps1;
+               alp1 = alp0 + (rr[i1][i1]>>2);
+               alp1 += (rr[i0][i1]>>1);
+               sq1 = (int64_t)ps1*ps1;
 
                if ( ( alp * sq1 ) > ( sq * alp1 ) ) {
                   sq = sq1;
@@ -5000,20 +5043,20 @@ static void search_2i40_11bits( Float32 dn[], Float32 rr[][L_CODE], Word32
  * Returns:
  *    void
  */
-static void build_code_2i40_11bits( Word32 codvec[], Float32 dn_sign[], Float32
-      cod[], Float32 h[], Float32 y[], Word16 *anap )
+static void build_code_2i40_11bits( Word32 codvec[], Word32 dn_sign[], 
+                                    real_t cod[], real_t h[], 
+                                    real_t y[], Word16 *anap )
 {
-   Float64 s;
-   Float32 *p0, *p1;
+   real_t s;
+   real_t *p0, *p1;
    Word32 _sign[2];
    Word32 i, j, k, track, index, indx = 0, rsign = 0;
 
-
-   memset( cod, 0, 160 );
+   memset( cod, 0, L_SUBFR*sizeof(real_t) );
 
    for ( k = 0; k < 2; k++ ) {
       i = codvec[k];   /* read pulse position */
-      j = ( Word16 )dn_sign[i];   /* read sign */
+      j = dn_sign[i];   /* read sign */
       index = i / 5;   /* index = pos/5 */
 
       /* track = pos%5 */
@@ -5047,12 +5090,12 @@ static void build_code_2i40_11bits( Word32 codvec[], Float32 dn_sign[], Float32
       }
 
       if ( j > 0 ) {
-         cod[i] = 0.9998779296875F;
+         cod[i] = REAL_CONST(0.9998779296875F);
          _sign[k] = 1;
          rsign = rsign + ( 1 << track );
       }
       else {
-         cod[i] = -1;
+         cod[i] = REAL_ICONST(-1);
          _sign[k] = -1;
       }
       indx = indx + index;
@@ -5063,7 +5106,7 @@ static void build_code_2i40_11bits( Word32 codvec[], Float32 dn_sign[], Float32
    for ( i = 0; i < L_CODE; i++ ) {
       s = *p0++ * _sign[0];
       s += *p1++ * _sign[1];
-      y[i] = ( Float32 )s;
+      y[i] = s;
    }
    anap[0] = ( Word16 )indx;
    anap[1] = ( Word16 )rsign;
@@ -5102,21 +5145,23 @@ static void build_code_2i40_11bits( Word32 codvec[], Float32 dn_sign[], Float32
  * Returns:
  *    void
  */
-static void code_2i40_11bits( Float32 x[], Float32 h[], Word32 T0, Float32
-      pitch_sharp, Float32 code[], Float32 y[], Word16 *anap )
+static void code_2i40_11bits( real_t x[], real_t h[], Word32 T0, 
+                              real_t pitch_sharp, real_t code[], 
+                              real_t y[], Word16 *anap )
 {
-   Float32 rr[L_CODE][L_CODE];
-   Float32 dn[L_CODE], dn2[L_CODE], dn_sign[L_CODE];
+   real_32_t rr[L_CODE][L_CODE];
+   real_32_t dn[L_CODE], dn2[L_CODE];
+   Word32 dn_sign[L_CODE];
    Word32 codvec[2];
    Word32 i;
 
-
-   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0.0F ) ) {
+   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         h[i] = h[i] + ( h[i - T0] * pitch_sharp );
+         h[i] = h[i] + MUL_R(h[i - T0],pitch_sharp);
       }
    }
-   cor_h_x( h, x, dn );
+
+   cor_h_x_fixed( h, x, dn );
    set_sign( dn, dn_sign, dn2, 8 );
    cor_h( h, dn_sign, rr );
    search_2i40_11bits( dn, rr, codvec );
@@ -5126,9 +5171,9 @@ static void code_2i40_11bits( Float32 x[], Float32 h[], Word32 T0, Float32
     * Compute innovation vector gain.
     * Include fixed-gain pitch contribution into code[].
     */
-   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0.0F ) ) {
+   if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         code[i] = code[i] + code[i - T0] * pitch_sharp;
+         code[i] = code[i] + MUL_R(code[i - T0],pitch_sharp);
       }
    }
 }
@@ -5151,17 +5196,22 @@ static void code_2i40_11bits( Float32 x[], Float32 h[], Word32 T0, Float32
  * Returns:
  *    void
  */
-static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
-      Word32 codvec[] )
+static void search_3i40( real_32_t dn[], real_32_t dn2[], 
+                         real_32_t rr[][L_CODE], Word32 codvec[] )
 {
-   Float32 psk, ps0, ps1, sq, sq1, alpk, alp, alp0, alp1, ps = 0.0F;
-   Float32 *rr2, *rr1, *rr0, *pdn, *pdn_max;
+   real_32_t alpk, alp, alp0, alp1;
+   int32_t ps, ps0, ps1;
+   int64_t sq, sq1, psk;
+   real_32_t *rr2, *rr1, *rr0, *pdn, *pdn_max;
    Word32 ipos[3];
    Word32 i0, i1, i2, ix, i, pos, track1, track2;
 
+   psk = -1;
+   alpk = REAL_ICONST(1);
 
-   psk = -1.0F;
-   alpk = 1.0F;
+   for ( i = 0; i < 3; i++ ) {
+      codvec[i] = i;
+   }
 
    for ( track1 = 1; track1 < 4; track1 += 2 ) {
       for ( track2 = 2; track2 < 5; track2 += 2 ) {
@@ -5175,13 +5225,13 @@ static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
             /* i0 loop: try 8 positions */
             for ( i0 = ipos[0]; i0 < L_CODE; i0 += STEP ) {
                if ( dn2[i0] >= 0 ) {
-                  ps0 = dn[i0];
+                  ps0 = REAL2INT(dn[i0]);
                   alp0 = rr[i0][i0];
 
                   /* i1 loop: 8 positions */
-                  sq = -1.0F;
-                  alp = 1.0F;
-                  ps = 0.0F;
+                  sq = -1;
+                  alp = REAL_ICONST(1);
+                  ps = 0;
                   ix = ipos[1];
                   i1 = ipos[1];
                   rr1 = &rr[i1][i1];
@@ -5190,9 +5240,9 @@ static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
                   pdn_max = &dn[L_CODE];
 
                   do {
-                     ps1 = ps0 + *pdn;
-                     alp1 = alp0 + *rr1 + 2.0F * *rr0;
-                     sq1 = ps1 * ps1;
+                     ps1 = ps0 + REAL2INT(*pdn);
+                     alp1 = alp0 + *rr1 + ((*rr0)<<1);
+                     sq1 = (int64_t)ps1*ps1;
 
                      if ( ( alp * sq1 ) > ( sq * alp1 ) ) {
                         sq = sq1;
@@ -5209,9 +5259,9 @@ static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
                   /* i2 loop: 8 positions */
                   ps0 = ps;
                   alp0 = alp;
-                  sq = -1.0F;
-                  alp = 1.0F;
-                  ps = 0.0F;
+                  sq = -1;
+                  alp = REAL_ICONST(1);
+                  ps = 0;
                   ix = ipos[2];
                   i2 = ipos[2];
                   rr2 = &rr[i2][i2];
@@ -5220,9 +5270,9 @@ static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
                   pdn = &dn[i2];
 
                   do {
-                     ps1 = ps0 + *pdn;
-                     alp1 = alp0 + *rr2 + 2.0F * ( *rr1 + *rr0 );
-                     sq1 = ps1 * ps1;
+                     ps1 = ps0 + REAL2INT(*pdn);
+                     alp1 = alp0 + *rr2 + (( *rr1 + *rr0 )<<1);
+                     sq1 = (int64_t)ps1*ps1;
 
                      if ( ( alp * sq1 ) > ( sq * alp1 ) ) {
                         sq = sq1;
@@ -5279,16 +5329,16 @@ static void search_3i40( Float32 dn[], Float32 dn2[], Float32 rr[][L_CODE],
  * Returns:
  *    void
  */
-static void build_code_3i40_14bits( Word32 codvec[], Float32 dn_sign[], Float32
-      cod[], Float32 h[], Float32 y[], Word16 *anap )
+static void build_code_3i40_14bits( Word32 codvec[], Word32 dn_sign[], 
+                                    real_t cod[], real_t h[], 
+                                    real_t y[], Word16 *anap )
 {
-   Float64 s;
-   Float32 _sign[3];
-   Float32 *p0, *p1, *p2;
+   real_t s;
+   real_t *p0, *p1, *p2;
+   Word32 _sign[3];
    Word32 i, j, k, track, index, indx, rsign;
 
-
-   memset( cod, 0, 160 );
+   memset( cod, 0, L_SUBFR*sizeof(real_t) );
    indx = 0;
    rsign = 0;
 
@@ -5297,7 +5347,7 @@ static void build_code_3i40_14bits( Word32 codvec[], Float32 dn_sign[], Float32
       i = codvec[k];
 
       /* read sign */
-      j = ( Word16 )dn_sign[i];
+      j = dn_sign[i];
 
       /* index = pos/5 */
       index = i / 5;
@@ -5321,13 +5371,13 @@ static void build_code_3i40_14bits( Word32 codvec[], Float32 dn_sign[], Float32
       }
 
       if ( j > 0 ) {
-         cod[i] = 0.9998779296875F;
-         _sign[k] = 1.0F;
+         cod[i] = REAL_CONST(0.9998779296875F);
+         _sign[k] = 1;
          rsign = rsign + ( 1 << track );
       }
       else {
-         cod[i] = -1.0F;
-         _sign[k] = -1.0F;
+         cod[i] = REAL_ICONST(-1);
+         _sign[k] = -1;
       }
       indx = indx + index;
    }
@@ -5339,7 +5389,7 @@ static void build_code_3i40_14bits( Word32 codvec[], Float32 dn_sign[], Float32
       s = *p0++ * _sign[0];
       s += *p1++ * _sign[1];
       s += *p2++ * _sign[2];
-      y[i] = ( Float32 )s;
+      y[i] = s;
    }
    anap[0] = ( Word16 )indx;
    anap[1] = ( Word16 )rsign;
@@ -5377,21 +5427,23 @@ static void build_code_3i40_14bits( Word32 codvec[], Float32 dn_sign[], Float32
  * Returns:
  *    void
  */
-static void code_3i40_14bits( Float32 x[], Float32 h[], Word32 T0, Float32
-      pitch_sharp, Float32 code[], Float32 y[], Word16 *anap )
+static void code_3i40_14bits( real_t x[], real_t h[], Word32 T0, 
+                              real_t pitch_sharp, real_t code[], 
+                              real_t y[], Word16 *anap )
 {
-   Float32 rr[L_CODE][L_CODE];
-   Float32 dn[L_CODE], dn2[L_CODE], dn_sign[L_CODE];
+   real_32_t rr[L_CODE][L_CODE];
+   real_32_t dn[L_CODE], dn2[L_CODE];
+   Word32 dn_sign[L_CODE];
    Word32 codvec[3];
    Word32 i;
 
-
    if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         h[i] = h[i] + ( h[i - T0] * pitch_sharp );
+         h[i] = h[i] + MUL_R(h[i - T0],pitch_sharp);
       }
    }
-   cor_h_x( h, x, dn );
+
+   cor_h_x_fixed( h, x, dn );
    set_sign( dn, dn_sign, dn2, 6 );
    cor_h( h, dn_sign, rr );
    search_3i40( dn, dn2, rr, codvec );
@@ -5405,11 +5457,10 @@ static void code_3i40_14bits( Float32 x[], Float32 h[], Word32 T0, Float32
     */
    if ( ( T0 < L_CODE ) && ( pitch_sharp != 0 ) ) {
       for ( i = T0; i < L_CODE; i++ ) {
-         code[i] = code[i] + ( code[i - T0] * pitch_sharp );
+         code[i] = code[i] + MUL_R(code[i - T0],pitch_sharp);
       }
    }
 }
-#endif
 
 /*
  * search_4i40
@@ -5797,6 +5848,8 @@ static void set_sign12k2( real_32_t dn[], real_t cn[],
       max = REAL_ICONST(-1);
 
       for ( j = i; j < L_CODE; j += step ) {
+         cor = b[j];
+
          if ( cor > max ) {
             max = cor;
             pos = j;
@@ -5839,6 +5892,7 @@ static void set_sign12k2( real_32_t dn[], real_t cn[],
  * Parameters:
  *    dn                I: correlation between target and h[]
  *    rr                I: matrix of autocorrelation
+ *    rrt               I: rr[][] by tracks, for the vector search, or NULL
  *    ipos              I: starting position for each pulse
  *    pos_max           I: maximum of correlation position
  *    codvec            O: algebraic codebook vector
@@ -5850,15 +5904,19 @@ static void set_sign12k2( real_32_t dn[], real_t cn[],
  * Returns:
  *    void
  */
-#if 0
-static void search_8i40( Float32 dn[], Float32 rr[][L_CODE], Word32 ipos[],
+static void search_8i40( real_32_t dn[], real_32_t rr[][L_CODE],
+      real_32_t rrt[][AMR_SIMD_TRACKS][AMR_SIMD_TRACK], Word32 ipos[],
       Word32 pos_max[], Word32 codvec[] )
 {
-   Float32 rrv[L_CODE];
-   Float32 psk, ps, ps0, ps1, ps2, sq, sq2, alpk, alp, alp0, alp1, alp2;
-   Float32 *p_r, *p_r0, *p_r1, *p_r2, *p_r3, *p_r4, *p_r5, *p_r6, *p_r7, *p_r8;
-   Float32 *p_rrv, *p_rrv0, *p_dn, *p_dn0, *p_dn1, *p_dn_max;
+   real_32_t rrv[L_CODE];
+   int32_t ps, ps0, ps1, ps2;
+   real_32_t alpk, alp, alp0, alp1, alp2;
+   int64_t sq, sq2, psk;
+   real_32_t *p_r, *p_r0, *p_r1, *p_r2, *p_r3, *p_r4, *p_r5, *p_r6, *p_r7, *p_r8;
+   real_32_t *p_rrv, *p_rrv0;
+   real_32_t *p_dn, *p_dn0, *p_dn1, *p_dn_max;
    Word32 i0, i1, i2, i3, i4, i5, i6, i7, j, k, ia, ib, i, pos;
+   Word32 ip[6];
 
    p_dn_max = &dn[39];
 
@@ -5870,7 +5928,7 @@ static void search_8i40( Float32 dn[], Float32 rr[][L_CODE], Word32 ipos[],
    /* i1 loop */
    /* Default value */
    psk = -1;
-   alpk = 1;
+   alpk = REAL_ICONST(1);
 
    for ( i = 0; i < 8; i++ ) {
       codvec[i] = i;
@@ -5885,248 +5943,252 @@ static void search_8i40( Float32 dn[], Float32 rr[][L_CODE], Word32 ipos[],
       i5 = ipos[5];
       i6 = ipos[6];
       i7 = ipos[7];
-      ps0 = dn[i0] + dn[i1];
-      alp0 = *p_r + rr[i1][i1] + 2.0F * rr[i0][i1];
+      ps = REAL2INT(dn[i0]) + REAL2INT(dn[i1]);
+      alp = *p_r + rr[i1][i1] + (rr[i0][i1]<<1);
 
       /* i2 and i3 loop	*/
-      p_rrv = &rrv[i3];
-      p_r0 = &rr[i0][i3];
-      p_r1 = &rr[i1][i3];
-      p_r3 = &rr[i3][i3];
-      *p_rrv = *p_r3 + 2.0F * ( *p_r0 + *p_r1 );
-      *( p_rrv + 4 ) = *( p_r3 + 164 ) + 2.0F * ( *( p_r0 + 4 ) + *( p_r1 + 4 )
-            );
-      *( p_rrv + 8 ) = *( p_r3 + 328 ) + 2.0F * ( *( p_r0 + 8 ) + *( p_r1 + 8 )
-            );
-      *( p_rrv + 12 ) = *( p_r3 + 492 ) + 2.0F * ( *( p_r0 + 12 ) + *( p_r1 + 12
-            ) );
-      *( p_rrv + 16 ) = *( p_r3 + 656 ) + 2.0F * ( *( p_r0 + 16 ) + *( p_r1 + 16
-            ) );
-      *( p_rrv + 20 ) = *( p_r3 + 820 ) + 2.0F * ( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) );
-      *( p_rrv + 24 ) = *( p_r3 + 984 ) + 2.0F * ( *( p_r0 + 24 ) + *( p_r1 + 24
-            ) );
-      *( p_rrv + 28 ) = *( p_r3 + 1148 ) + 2.0F * ( *( p_r0 + 28 ) + *( p_r1 +
-            28 ) );
-      *( p_rrv + 32 ) = *( p_r3 + 1312 ) + 2.0F * ( *( p_r0 + 32 ) + *( p_r1 +
-            32 ) );
-      *( p_rrv + 36 ) = *( p_r3 + 1476 ) + 2.0F * ( *( p_r0 + 36 ) + *( p_r1 +
-            36 ) );
-      sq = -1;
-      alp = 1;
-      ps = 0;
-      ia = i2;
-      ib = i3;
-      p_rrv = rrv + i3;
-      p_r0 = &rr[i0][i2];
-      p_r1 = &rr[i1][i2];
-      p_r2 = &rr[i2][i2];
-      p_r3 = &rr[i2][i3];
-      p_dn0 = dn + i2;
-      p_dn1 = dn + i3;
-      p_rrv0 = rrv + i3;
-
-      do {
-         ps1 = ps0 + *p_dn0;
-         alp1 = alp0 + *p_r2 + 2.0F * ( *p_r0 + *p_r1 );
-         p_rrv = p_rrv0;
-         p_dn = p_dn1;
-         p_r4 = p_r3;
+      ps0 = ps;
+      alp0 = alp;
+      ip[0] = i0;
+      ip[1] = i1;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 2, i2, ( 39 - i2 ) / 4 + 1,
+                 i3, ( 38 - i3 ) / 4 + 1, 4, 1, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = &rrv[i3];
+         p_r0 = &rr[i0][i3];
+         p_r1 = &rr[i1][i3];
+         p_r3 = &rr[i3][i3];
+         *p_rrv = *p_r3 + (( *p_r0 + *p_r1 )<<1);
+         *( p_rrv + 4 ) = *( p_r3 + 164 ) + (( *( p_r0 + 4 ) + *( p_r1 + 4 ))<<1);
+         *( p_rrv + 8 ) = *( p_r3 + 328 ) + (( *( p_r0 + 8 ) + *( p_r1 + 8 ))<<1);
+         *( p_rrv + 12 ) = *( p_r3 + 492 ) + (( *( p_r0 + 12 ) + *( p_r1 + 12 ))<<1);
+         *( p_rrv + 16 ) = *( p_r3 + 656 ) + (( *( p_r0 + 16 ) + *( p_r1 + 16 ))<<1);
+         *( p_rrv + 20 ) = *( p_r3 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20 ))<<1);
+         *( p_rrv + 24 ) = *( p_r3 + 984 ) + (( *( p_r0 + 24 ) + *( p_r1 + 24 ))<<1);
+         *( p_rrv + 28 ) = *( p_r3 + 1148 ) + (( *( p_r0 + 28 ) + *( p_r1 + 28 ))<<1);
+         *( p_rrv + 32 ) = *( p_r3 + 1312 ) + (( *( p_r0 + 32 ) + *( p_r1 + 32 ))<<1);
+         *( p_rrv + 36 ) = *( p_r3 + 1476 ) + (( *( p_r0 + 36 ) + *( p_r1 + 36 ))<<1);
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i2;
+         ib = i3;
+         p_rrv = rrv + i3;
+         p_r0 = &rr[i0][i2];
+         p_r1 = &rr[i1][i2];
+         p_r2 = &rr[i2][i2];
+         p_r3 = &rr[i2][i3];
+         p_dn0 = dn + i2;
+         p_dn1 = dn + i3;
+         p_rrv0 = rrv + i3;
 
          do {
-            ps2 = ps1 + *p_dn;
-            sq2 = ps2 * ps2;
-            alp2 = alp1 + *p_rrv + 2.0F * *p_r4;
-
-            if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = p_dn0 - dn;
-               ib = p_dn - dn;
-            }
-            p_rrv += 4;
-            p_dn += 4;
-            p_r4 += 4;
-         } while ( p_dn < p_dn_max );
-         p_dn0 += 4;
-         p_r0 += 4;
-         p_r1 += 4;
-         p_r2 += 164;
-         p_r3 += 160;
-      } while ( p_dn0 <= p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r2 + (( *p_r0 + *p_r1 )<<1);
+            p_rrv = p_rrv0;
+            p_dn = p_dn1;
+            p_r4 = p_r3;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = (int64_t)ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r4)<<1);
+
+               if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_rrv += 4;
+               p_dn += 4;
+               p_r4 += 4;
+            } while ( p_dn < p_dn_max );
+            p_dn0 += 4;
+            p_r0 += 4;
+            p_r1 += 4;
+            p_r2 += 164;
+            p_r3 += 160;
+         } while ( p_dn0 <= p_dn_max );
+      }
       i2 = ia;
       i3 = ib;
 
       /* i4 and i5 loop	*/
-      p_rrv = rrv + i5;
-      p_r0 = &rr[i0][i5];
-      p_r1 = &rr[i1][i5];
-      p_r2 = &rr[i2][i5];
-      p_r3 = &rr[i3][i5];
-      p_r5 = &rr[i5][i5];
-      *p_rrv = *p_r5 + 2.0F * ( *p_r0 + *p_r1 + *p_r2 + *p_r3 );
-      *( p_rrv + 4 ) = *( p_r5 + 164 ) + 2.0F * ( *( p_r0 + 4 ) + *( p_r1 + 4 )
-            + *( p_r2 + 4 ) + *( p_r3 + 4 ) );
-      *( p_rrv + 8 ) = *( p_r5 + 328 ) + 2.0F * ( *( p_r0 + 8 ) + *( p_r1 + 8 )
-            + *( p_r2 + 8 ) + *( p_r3 + 8 ) );
-      *( p_rrv + 12 ) = *( p_r5 + 492 ) + 2.0F * ( *( p_r0 + 12 ) + *( p_r1 + 12
-            ) + *( p_r2 + 12 ) + *( p_r3 + 12 ) );
-      *( p_rrv + 16 ) = *( p_r5 + 656 ) + 2.0F * ( *( p_r0 + 16 ) + *( p_r1 + 16
-            ) + *( p_r2 + 16 ) + *( p_r3 + 16 ) );
-      *( p_rrv + 20 ) = *( p_r5 + 820 ) + 2.0F * ( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) );
-      *( p_rrv + 24 ) = *( p_r5 + 984 ) + 2.0F * ( *( p_r0 + 24 ) + *( p_r1 + 24
-            ) + *( p_r2 + 24 ) + *( p_r3 + 24 ) );
-      *( p_rrv + 28 ) = *( p_r5 + 1148 ) + 2.0F * ( *( p_r0 + 28 ) + *( p_r1 +
-            28 ) + *( p_r2 + 28 ) + *( p_r3 + 28 ) );
-      *( p_rrv + 32 ) = *( p_r5 + 1312 ) + 2.0F * ( *( p_r0 + 32 ) + *( p_r1 +
-            32 ) + *( p_r2 + 32 ) + *( p_r3 + 32 ) );
-      *( p_rrv + 36 ) = *( p_r5 + 1476 ) + 2.0F * ( *( p_r0 + 36 ) + *( p_r1 +
-            36 ) + *( p_r2 + 36 ) + *( p_r3 + 36 ) );
-
-      /* Default value */
       ps0 = ps;
       alp0 = alp;
-      sq = -1;
-      alp = 1;
-      ps = 0;
-      ia = i4;
-      ib = i5;
-      p_dn0 = dn + i4;
-      p_dn1 = dn + i5;
-      p_r0 = &rr[i0][i4];
-      p_r1 = &rr[i1][i4];
-      p_r2 = &rr[i2][i4];
-      p_r3 = &rr[i3][i4];
-      p_r4 = &rr[i4][i4];
-      p_r5 = &rr[i4][i5];
-      p_rrv0 = rrv + i5;
-
-      do {
-         ps1 = ps0 + *p_dn0;
-         alp1 = alp0 + *p_r4 + 2.0F * ( *p_r0 + *p_r1 + *p_r2 + *p_r3 );
-         p_dn = p_dn1;
-         p_r6 = p_r5;
-         p_rrv = p_rrv0;
+      ip[2] = i2;
+      ip[3] = i3;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 4, i4, ( 38 - i4 ) / 4 + 1,
+                 i5, ( 39 - i5 ) / 4 + 1, 4, 1, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = rrv + i5;
+         p_r0 = &rr[i0][i5];
+         p_r1 = &rr[i1][i5];
+         p_r2 = &rr[i2][i5];
+         p_r3 = &rr[i3][i5];
+         p_r5 = &rr[i5][i5];
+         *p_rrv = *p_r5 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
+         *( p_rrv + 4 ) = *( p_r5 + 164 ) + (( *( p_r0 + 4 ) + *( p_r1 + 4 )
+               + *( p_r2 + 4 ) + *( p_r3 + 4 ) )<<1);
+         *( p_rrv + 8 ) = *( p_r5 + 328 ) + (( *( p_r0 + 8 ) + *( p_r1 + 8 )
+               + *( p_r2 + 8 ) + *( p_r3 + 8 ) )<<1);
+         *( p_rrv + 12 ) = *( p_r5 + 492 ) + (( *( p_r0 + 12 ) + *( p_r1 + 12 )
+               + *( p_r2 + 12 ) + *( p_r3 + 12 ) )<<1);
+         *( p_rrv + 16 ) = *( p_r5 + 656 ) + (( *( p_r0 + 16 ) + *( p_r1 + 16 )
+               + *( p_r2 + 16 ) + *( p_r3 + 16 ) )<<1);
+         *( p_rrv + 20 ) = *( p_r5 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20 )
+               + *( p_r2 + 20 ) + *( p_r3 + 20 ) )<<1);
+         *( p_rrv + 24 ) = *( p_r5 + 984 ) + (( *( p_r0 + 24 ) + *( p_r1 + 24 )
+               + *( p_r2 + 24 ) + *( p_r3 + 24 ) )<<1);
+         *( p_rrv + 28 ) = *( p_r5 + 1148 ) + (( *( p_r0 + 28 ) + *( p_r1 + 28 )
+               + *( p_r2 + 28 ) + *( p_r3 + 28 ) )<<1);
+         *( p_rrv + 32 ) = *( p_r5 + 1312 ) + (( *( p_r0 + 32 ) + *( p_r1 + 32 )
+               + *( p_r2 + 32 ) + *( p_r3 + 32 ) )<<1);
+         *( p_rrv + 36 ) = *( p_r5 + 1476 ) + (( *( p_r0 + 36 ) + *( p_r1 + 36 )
+               + *( p_r2 + 36 ) + *( p_r3 + 36 ) )<<1);
+
+         /* Default value */
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i4;
+         ib = i5;
+         p_dn0 = dn + i4;
+         p_dn1 = dn + i5;
+         p_r0 = &rr[i0][i4];
+         p_r1 = &rr[i1][i4];
+         p_r2 = &rr[i2][i4];
+         p_r3 = &rr[i3][i4];
+         p_r4 = &rr[i4][i4];
+         p_r5 = &rr[i4][i5];
+         p_rrv0 = rrv + i5;
 
          do {
-            ps2 = ps1 + *p_dn;
-            sq2 = ps2 * ps2;
-            alp2 = alp1 + *p_rrv + 2.0F * *p_r6;
-
-            if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = p_dn0 - dn;
-               ib = p_dn - dn;
-            }
-            p_dn += 4;
-            p_rrv += 4;
-            p_r6 += 4;
-         } while ( p_dn <= p_dn_max );
-         p_r0 += 4;
-         p_r1 += 4;
-         p_r2 += 4;
-         p_r3 += 4;
-         p_r4 += 164;
-         p_r5 += 160;
-         p_dn0 += 4;
-      } while ( p_dn0 < p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r4 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
+            p_dn = p_dn1;
+            p_r6 = p_r5;
+            p_rrv = p_rrv0;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = (int64_t)ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r6)<<1);
+
+               if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_dn += 4;
+               p_rrv += 4;
+               p_r6 += 4;
+            } while ( p_dn <= p_dn_max );
+            p_r0 += 4;
+            p_r1 += 4;
+            p_r2 += 4;
+            p_r3 += 4;
+            p_r4 += 164;
+            p_r5 += 160;
+            p_dn0 += 4;
+         } while ( p_dn0 < p_dn_max );
+      }
       i4 = ia;
       i5 = ib;
 
       /* i6 and i7 loop	*/
-      p_rrv = rrv + i7;
-      p_r0 = &rr[i0][i7];
-      p_r1 = &rr[i1][i7];
-      p_r2 = &rr[i2][i7];
-      p_r3 = &rr[i3][i7];
-      p_r4 = &rr[i4][i7];
-      p_r5 = &rr[i5][i7];
-      p_r7 = &rr[i7][i7];
-      *p_rrv = *p_r7 + 2.0F * ( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 );
-      *( p_rrv + 4 ) = *( p_r7 + 164 ) + 2.0F * ( *( p_r0 + 4 ) + *( p_r1 + 4 )
-            + *( p_r2 + 4 ) + *( p_r3 + 4 ) + *( p_r4 + 4 ) + *( p_r5 + 4 ) );
-      *( p_rrv + 8 ) = *( p_r7 + 328 ) + 2.0F * ( *( p_r0 + 8 ) + *( p_r1 + 8 )
-            + *( p_r2 + 8 ) + *( p_r3 + 8 ) + *( p_r4 + 8 ) + *( p_r5 + 8 ) );
-      *( p_rrv + 12 ) = *( p_r7 + 492 ) + 2.0F * ( *( p_r0 + 12 ) + *( p_r1 + 12
-            ) + *( p_r2 + 12 ) + *( p_r3 + 12 ) + *( p_r4 + 12 ) + *( p_r5 + 12
-            ) );
-      *( p_rrv + 16 ) = *( p_r7 + 656 ) + 2.0F * ( *( p_r0 + 16 ) + *( p_r1 + 16
-            ) + *( p_r2 + 16 ) + *( p_r3 + 16 ) + *( p_r4 + 16 ) + *( p_r5 + 16
-            ) );
-      *( p_rrv + 20 ) = *( p_r7 + 820 ) + 2.0F * ( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20
-            ) );
-      *( p_rrv + 24 ) = *( p_r7 + 984 ) + 2.0F * ( *( p_r0 + 24 ) + *( p_r1 + 24
-            ) + *( p_r2 + 24 ) + *( p_r3 + 24 ) + *( p_r4 + 24 ) + *( p_r5 + 24
-            ) );
-      *( p_rrv + 28 ) = *( p_r7 + 1148 ) + 2.0F * ( *( p_r0 + 28 ) + *( p_r1 +
-            28 ) + *( p_r2 + 28 ) + *( p_r3 + 28 ) + *( p_r4 + 28 ) + *( p_r5 +
-            28 ) );
-      *( p_rrv + 32 ) = *( p_r7 + 1312 ) + 2.0F * ( *( p_r0 + 32 ) + *( p_r1 +
-            32 ) + *( p_r2 + 32 ) + *( p_r3 + 32 ) + *( p_r4 + 32 ) + *( p_r5 +
-            32 ) );
-      *( p_rrv + 36 ) = *( p_r7 + 1476 ) + 2.0F * ( *( p_r0 + 36 ) + *( p_r1 +
-            36 ) + *( p_r2 + 36 ) + *( p_r3 + 36 ) + *( p_r4 + 36 ) + *( p_r5 +
-            36 ) );
-
-      /* Default value */
       ps0 = ps;
       alp0 = alp;
-      sq = -1;
-      alp = 1;
-      ps = 0;
-      ia = i6;
-      ib = i7;
-      p_dn0 = dn + i6;
-      p_dn1 = dn + i7;
-      p_r0 = &rr[i0][i6];
-      p_r1 = &rr[i1][i6];
-      p_r2 = &rr[i2][i6];
-      p_r3 = &rr[i3][i6];
-      p_r4 = &rr[i4][i6];
-      p_r5 = &rr[i5][i6];
-      p_r6 = &rr[i6][i6];
-      p_r7 = &rr[i6][i7];
-      p_rrv0 = rrv + i7;
-
-      do {
-         ps1 = ps0 + *p_dn0;
-         alp1 = alp0 + *p_r6 + 2.0F * ( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-               *p_r5 );
-         p_dn = p_dn1;
-         p_r8 = p_r7;
-         p_rrv = p_rrv0;
+      ip[4] = i4;
+      ip[5] = i5;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 6, i6, ( 38 - i6 ) / 4 + 1,
+                 i7, ( 39 - i7 ) / 4 + 1, 4, 1, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = rrv + i7;
+         p_r0 = &rr[i0][i7];
+         p_r1 = &rr[i1][i7];
+         p_r2 = &rr[i2][i7];
+         p_r3 = &rr[i3][i7];
+         p_r4 = &rr[i4][i7];
+         p_r5 = &rr[i5][i7];
+         p_r7 = &rr[i7][i7];
+         *p_rrv = *p_r7 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 )<<1);
+         *( p_rrv + 4 ) = *( p_r7 + 164 ) + (( *( p_r0 + 4 ) + *( p_r1 + 4 )
+               + *( p_r2 + 4 ) + *( p_r3 + 4 ) + *( p_r4 + 4 ) + *( p_r5 + 4 ) )<<1);
+         *( p_rrv + 8 ) = *( p_r7 + 328 ) + (( *( p_r0 + 8 ) + *( p_r1 + 8 )
+               + *( p_r2 + 8 ) + *( p_r3 + 8 ) + *( p_r4 + 8 ) + *( p_r5 + 8 ) )<<1);
+         *( p_rrv + 12 ) = *( p_r7 + 492 ) + (( *( p_r0 + 12 ) + *( p_r1 + 12 )
+               + *( p_r2 + 12 ) + *( p_r3 + 12 ) + *( p_r4 + 12 ) + *( p_r5 + 12 ) )<<1);
+         *( p_rrv + 16 ) = *( p_r7 + 656 ) + (( *( p_r0 + 16 ) + *( p_r1 + 16 )
+               + *( p_r2 + 16 ) + *( p_r3 + 16 ) + *( p_r4 + 16 ) + *( p_r5 + 16 ) )<<1);
+         *( p_rrv + 20 ) = *( p_r7 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20 )
+               + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20 ) )<<1);
+         *( p_rrv + 24 ) = *( p_r7 + 984 ) + (( *( p_r0 + 24 ) + *( p_r1 + 24 )
+               + *( p_r2 + 24 ) + *( p_r3 + 24 ) + *( p_r4 + 24 ) + *( p_r5 + 24 ) )<<1);
+         *( p_rrv + 28 ) = *( p_r7 + 1148 ) + (( *( p_r0 + 28 ) + *( p_r1 + 28 )
+               + *( p_r2 + 28 ) + *( p_r3 + 28 ) + *( p_r4 + 28 ) + *( p_r5 + 28 ) )<<1);
+         *( p_rrv + 32 ) = *( p_r7 + 1312 ) + (( *( p_r0 + 32 ) + *( p_r1 + 32 )
+               + *( p_r2 + 32 ) + *( p_r3 + 32 ) + *( p_r4 + 32 ) + *( p_r5 + 32 ) )<<1);
+         *( p_rrv + 36 ) = *( p_r7 + 1476 ) + (( *( p_r0 + 36 ) + *( p_r1 + 36 )
+               + *( p_r2 + 36 ) + *( p_r3 + 36 ) + *( p_r4 + 36 ) + *( p_r5 + 36 ) )<<1);
+
+         /* Default value */
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i6;
+         ib = i7;
+         p_dn0 = dn + i6;
+         p_dn1 = dn + i7;
+         p_r0 = &rr[i0][i6];
+         p_r1 = &rr[i1][i6];
+         p_r2 = &rr[i2][i6];
+         p_r3 = &rr[i3][i6];
+         p_r4 = &rr[i4][i6];
+         p_r5 = &rr[i5][i6];
+         p_r6 = &rr[i6][i6];
+         p_r7 = &rr[i6][i7];
+         p_rrv0 = rrv + i7;
 
          do {
-            ps2 = ps1 + *p_dn;
-            sq2 = ps2 * ps2;
-            alp2 = alp1 + *p_rrv + 2.0F * *p_r8;
-
-            if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = p_dn0 - dn;
-               ib = p_dn - dn;
-            }
-            p_dn += 4;
-            p_rrv += 4;
-            p_r8 += 4;
-         } while ( p_dn <= p_dn_max );
-         p_r0 += 4;
-         p_r1 += 4;
-         p_r2 += 4;
-         p_r3 += 4;
-         p_r4 += 4;
-         p_r5 += 4;
-         p_r6 += 164;
-         p_r7 += 160;
-         p_dn0 += 4;
-      } while ( p_dn0 < p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r6 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
+                  *p_r5 )<<1);
+            p_dn = p_dn1;
+            p_r8 = p_r7;
+            p_rrv = p_rrv0;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = (int64_t)ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r8)<<1);
+
+               if ( ( alp * sq2 ) > ( sq * alp2 ) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_dn += 4;
+               p_rrv += 4;
+               p_r8 += 4;
+            } while ( p_dn <= p_dn_max );
+            p_r0 += 4;
+            p_r1 += 4;
+            p_r2 += 4;
+            p_r3 += 4;
+            p_r4 += 4;
+            p_r5 += 4;
+            p_r6 += 164;
+            p_r7 += 160;
+            p_dn0 += 4;
+         } while ( p_dn0 < p_dn_max );
+      }
 
       /*
        * now finished searching a set of 8 pulses
@@ -6179,16 +6241,16 @@ static void search_8i40( Float32 dn[], Float32 rr[][L_CODE], Word32 ipos[],
  * Returns:
  *    void
  */
-static void build_code_8i40_31bits( Word32 codvec[], Word16 dn_sign[], Float32
-      cod[], Float32 h[], Float32 y[], Word32 sign_indx[], Word32 pos_indx[] )
+static void build_code_8i40_31bits( Word32 codvec[], Word32 dn_sign[], 
+                                    real_t cod[], real_t h[], real_t y[], 
+                                    Word32 sign_indx[], Word32 pos_indx[] )
 {
-   Float64 s;
-   Float32 *p0, *p1, *p2, *p3, *p4, *p5, *p6, *p7;
-   Float32 sign[8];
+   real_t s;
+   real_t *p0, *p1, *p2, *p3, *p4, *p5, *p6, *p7;
+   Word32 sign[8];
    Word32 i, j, k, track, sign_index, pos_index;
 
-
-   memset( cod, 0, L_CODE <<2 );
+   memset( cod, 0, L_CODE*sizeof(real_t) );
 
    for ( i = 0; i < NB_TRACK_MR102; i++ ) {
       pos_indx[i] = -1;
@@ -6200,7 +6262,7 @@ static void build_code_8i40_31bits( Word32 codvec[], Word16 dn_sign[], Float32
       i = codvec[k];
 
       /* read sign */
-      j = ( Word32 )dn_sign[i];
+      j = dn_sign[i];
 
       /* index = pos/4 */
       pos_index = i >> 2;
@@ -6209,14 +6271,14 @@ static void build_code_8i40_31bits( Word32 codvec[], Word16 dn_sign[], Float32
       track = i & 3;
 
       if ( j > 0 ) {
-         cod[i] = cod[i] + 0.99987792968750F;
+         cod[i] = cod[i] + REAL_CONST(0.99987792968750F);
          sign[k] = 1;
 
          /* bit=0 -> positive pulse */
          sign_index = 0;
       }
       else {
-         cod[i] = cod[i] - 0.99987792968750F;
+         cod[i] = cod[i] - REAL_CONST(0.99987792968750F);
          sign[k] = -1;
 
          /* bit=1 => negative pulse */
@@ -6276,7 +6338,7 @@ static void build_code_8i40_31bits( Word32 codvec[], Word16 dn_sign[], Float32
       s += *p5++ * sign[5];
       s += *p6++ * sign[6];
       s += *p7++ * sign[7];
-      y[i] = ( Float32 )( s );
+      y[i] = s;
    }
 }
 
@@ -6416,42 +6478,43 @@ static void compress_code( Word32 sign_indx[], Word32 pos_indx[], Word16 indx[]
  * Returns:
  *    void
  */
-static void code_8i40_31bits( Float32 x[], Float32 cn[], Float32 h[],
-                             Word32 T0, Float32 pitch_sharp, Float32 code[],
-                             Float32 y[], Word16 anap[] )
+static void code_8i40_31bits( real_t x[], real_t cn[], real_t h[],
+                              Word32 T0, real_t pitch_sharp, real_t code[],
+                              real_t y[], Word16 anap[] )
 {
-   Float32 rr[L_CODE][L_CODE];
-   Float32 dn[L_CODE],sign[L_CODE];
+   real_32_t rr[L_CODE][L_CODE];
+   real_32_t rrt[L_CODE][AMR_SIMD_TRACKS][AMR_SIMD_TRACK];
+   real_32_t dn[L_CODE];
+   Word32 sign[L_CODE];
    Word32 ipos[8], pos_max[NB_TRACK_MR102], codvec[8], linear_signs[
       NB_TRACK_MR102], linear_codewords[8];
-   Word32 i;
+   Word32 i, tracks;
 
-   if ( pitch_sharp > 1.0F )
-      pitch_sharp = 1.0F;
+   if ( pitch_sharp > REAL_ICONST(1) )
+      pitch_sharp = REAL_ICONST(1);
 
    /* include pitch contribution into impulse resp. */
    if ( pitch_sharp != 0 ) {
       for ( i = T0; i < L_SUBFR; i++ ) {
-         h[i] += h[i - T0] * pitch_sharp;
+         h[i] += MUL_R(h[i - T0],pitch_sharp);
       }
    }
 
-   cor_h_x( h, x, dn );
+   cor_h_x_fixed( h, x, dn );
    set_sign12k2( dn, cn, sign, pos_max, NB_TRACK_MR102, ipos, STEP_MR102 );
-   cor_h( h, sign, rr );
-   search_8i40( dn, rr, ipos, pos_max, codvec );
+   tracks = cor_h_tracks( h, sign, rr, rrt, STEP_MR102 );
+   search_8i40( dn, rr, tracks ? rrt : NULL, ipos, pos_max, codvec );
    build_code_8i40_31bits( codvec, sign, code, h, y, linear_signs, linear_codewords );
    compress_code( linear_signs, linear_codewords, anap );
 
    /* Add the pitch contribution to code[]. */
    if ( pitch_sharp != 0 ) {
       for ( i = T0; i < L_SUBFR; i++ ) {
-         code[i] += code[i - T0] * pitch_sharp;
+         code[i] += MUL_R(code[i - T0],pitch_sharp);
       }
    }
    return;
 }
-#endif
 
 /*
  * search_10i40
@@ -6460,6 +6523,7 @@ static void code_8i40_31bits( Float32 x[], Float32 cn[], Float32 h[],
  * Parameters:
  *    dn                I: correlation between target and h[]
  *    rr                I: matrix of autocorrelation
+ *    rrt               I: rr[][] by tracks, for the vector search, or NULL
  *    ipos              I: starting position for each pulse
  *    pos_max           I: maximum of correlation position
  *    codvec            O: algebraic codebook vector
@@ -6489,7 +6553,8 @@ static void code_8i40_31bits( Float32 x[], Float32 cn[], Float32 h[],
  * Returns:
  *    void
  */
-static void search_10i40( real_32_t dn[], real_32_t rr[][L_CODE], Word32 ipos[],
+static void search_10i40( real_32_t dn[], real_32_t rr[][L_CODE],
+      real_32_t rrt[][AMR_SIMD_TRACKS][AMR_SIMD_TRACK], Word32 ipos[],
       Word32 pos_max[], Word32 codvec[] )
 {
    real_32_t rrv[L_CODE];
@@ -6501,6 +6566,7 @@ static void search_10i40( real_32_t dn[], real_32_t rr[][L_CODE], Word32 ipos[],
    real_32_t *p_rrv, *p_rrv0;
    real_32_t *p_dn, *p_dn0, *p_dn1, *p_dn_max;
    Word32 i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, j, k, ia, ib, i, pos;
+   Word32 ip[8];
 
    p_dn_max = &dn[39];
 
@@ -6528,323 +6594,349 @@ static void search_10i40( real_32_t dn[], real_32_t rr[][L_CODE], Word32 ipos[],
       i7 = ipos[7];
       i8 = ipos[8];
       i9 = ipos[9];
-      ps0 = REAL2INT(dn[i0]) + REAL2INT(dn[i1]);
-      alp0 = *p_r + rr[i1][i1] + (rr[i0][i1]<<1);
+      ps = REAL2INT(dn[i0]) + REAL2INT(dn[i1]);
+      alp = *p_r + rr[i1][i1] + (rr[i0][i1]<<1);
 
       /* i2 and i3 loop	*/
-      p_rrv = &rrv[i3];
-      p_r0 = &rr[i0][i3];
-      p_r1 = &rr[i1][i3];
-      p_r3 = &rr[i3][i3];
-      *p_rrv = *p_r3 + (( *p_r0 + *p_r1 )<<1);
-      *( p_rrv + 5 ) = *( p_r3 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 ))<<1);
-      *( p_rrv + 10 ) = *( p_r3 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10 ))<<1);
-      *( p_rrv + 15 ) = *( p_r3 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15 ))<<1);
-      *( p_rrv + 20 ) = *( p_r3 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20 ))<<1);
-      *( p_rrv + 25 ) = *( p_r3 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +25 ))<<1);
-      *( p_rrv + 30 ) = *( p_r3 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +30 ))<<1);
-      *( p_rrv + 35 ) = *( p_r3 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +35 ))<<1);
-      sq = -1;
-      alp = REAL_ICONST(1);
-      ps = 0;
-      ia = i2;
-      ib = i3;
-      p_rrv = rrv + i3;
-      p_r0 = &rr[i0][i2];
-      p_r1 = &rr[i1][i2];
-      p_r2 = &rr[i2][i2];
-      p_r3 = &rr[i2][i3];
-      p_dn0 = dn + i2;
-      p_dn1 = dn + i3;
-      p_rrv0 = rrv + i3;
-
-      do {
-         ps1 = ps0 + REAL2INT(*p_dn0);
-         alp1 = alp0 + *p_r2 + (( *p_r0 + *p_r1 )<<1);
-         p_rrv = p_rrv0;
-         p_dn = p_dn1;
-         p_r4 = p_r3;
+      ps0 = ps;
+      alp0 = alp;
+      ip[0] = i0;
+      ip[1] = i1;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 2, i2, ( 39 - i2 ) / 5 + 1,
+                 i3, ( 38 - i3 ) / 5 + 1, 5, 0, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = &rrv[i3];
+         p_r0 = &rr[i0][i3];
+         p_r1 = &rr[i1][i3];
+         p_r3 = &rr[i3][i3];
+         *p_rrv = *p_r3 + (( *p_r0 + *p_r1 )<<1);
+         *( p_rrv + 5 ) = *( p_r3 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 ))<<1);
+         *( p_rrv + 10 ) = *( p_r3 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10 ))<<1);
+         *( p_rrv + 15 ) = *( p_r3 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15 ))<<1);
+         *( p_rrv + 20 ) = *( p_r3 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20 ))<<1);
+         *( p_rrv + 25 ) = *( p_r3 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +25 ))<<1);
+         *( p_rrv + 30 ) = *( p_r3 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +30 ))<<1);
+         *( p_rrv + 35 ) = *( p_r3 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +35 ))<<1);
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i2;
+         ib = i3;
+         p_rrv = rrv + i3;
+         p_r0 = &rr[i0][i2];
+         p_r1 = &rr[i1][i2];
+         p_r2 = &rr[i2][i2];
+         p_r3 = &rr[i2][i3];
+         p_dn0 = dn + i2;
+         p_dn1 = dn + i3;
+         p_rrv0 = rrv + i3;
 
          do {
-            ps2 = ps1 + REAL2INT(*p_dn);
-            sq2 = ps2*ps2;
-            alp2 = alp1 + *p_rrv + ((*p_r4)<<1);
-
-            if ( (alp*sq2) > (sq*alp2) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = ( Word16 )( p_dn0 - dn );
-               ib = ( Word16 )( p_dn - dn );
-            }
-            p_rrv += 5;
-            p_dn += 5;
-            p_r4 += 5;
-         } while ( p_dn < p_dn_max );
-         p_dn0 += 5;
-         p_r0 += 5;
-         p_r1 += 5;
-         p_r2 += 205;
-         p_r3 += 200;
-      } while ( p_dn0 <= p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r2 + (( *p_r0 + *p_r1 )<<1);
+            p_rrv = p_rrv0;
+            p_dn = p_dn1;
+            p_r4 = p_r3;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r4)<<1);
+
+               if ( (alp*sq2) > (sq*alp2) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_rrv += 5;
+               p_dn += 5;
+               p_r4 += 5;
+            } while ( p_dn < p_dn_max );
+            p_dn0 += 5;
+            p_r0 += 5;
+            p_r1 += 5;
+            p_r2 += 205;
+            p_r3 += 200;
+         } while ( p_dn0 <= p_dn_max );
+      }
       i2 = ia;
       i3 = ib;
 
       /* i4 and i5 loop	*/
-      p_rrv = rrv + i5;
-      p_r0 = &rr[i0][i5];
-      p_r1 = &rr[i1][i5];
-      p_r2 = &rr[i2][i5];
-      p_r3 = &rr[i3][i5];
-      p_r5 = &rr[i5][i5];
-      *p_rrv = *p_r5 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
-      *( p_rrv + 5 ) = *( p_r5 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
-            + *( p_r2 + 5 ) + *( p_r3 + 5 ) )<<1);
-      *( p_rrv + 10 ) = *( p_r5 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
-            ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) )<<1);
-      *( p_rrv + 15 ) = *( p_r5 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
-            ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) )<<1);
-      *( p_rrv + 20 ) = *( p_r5 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) )<<1);
-      *( p_rrv + 25 ) = *( p_r5 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
-            25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) )<<1);
-      *( p_rrv + 30 ) = *( p_r5 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
-            30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) )<<1);
-      *( p_rrv + 35 ) = *( p_r5 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
-            35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) )<<1);
-      /* Default value */
       ps0 = ps;
       alp0 = alp;
-      sq = -1;
-      alp = REAL_ICONST(1);
-      ps = 0;
-      ia = i4;
-      ib = i5;
-      p_dn0 = dn + i4;
-      p_dn1 = dn + i5;
-      p_r0 = &rr[i0][i4];
-      p_r1 = &rr[i1][i4];
-      p_r2 = &rr[i2][i4];
-      p_r3 = &rr[i3][i4];
-      p_r4 = &rr[i4][i4];
-      p_r5 = &rr[i4][i5];
-      p_rrv0 = rrv + i5;
-
-      do {
-         ps1 = ps0 + REAL2INT(*p_dn0);
-         alp1 = alp0 + *p_r4 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
-         p_dn = p_dn1;
-         p_r6 = p_r5;
-         p_rrv = p_rrv0;
+      ip[2] = i2;
+      ip[3] = i3;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 4, i4, ( 38 - i4 ) / 5 + 1,
+                 i5, ( 39 - i5 ) / 5 + 1, 5, 0, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = rrv + i5;
+         p_r0 = &rr[i0][i5];
+         p_r1 = &rr[i1][i5];
+         p_r2 = &rr[i2][i5];
+         p_r3 = &rr[i3][i5];
+         p_r5 = &rr[i5][i5];
+         *p_rrv = *p_r5 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
+         *( p_rrv + 5 ) = *( p_r5 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
+               + *( p_r2 + 5 ) + *( p_r3 + 5 ) )<<1);
+         *( p_rrv + 10 ) = *( p_r5 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
+               ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) )<<1);
+         *( p_rrv + 15 ) = *( p_r5 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
+               ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) )<<1);
+         *( p_rrv + 20 ) = *( p_r5 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
+               ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) )<<1);
+         *( p_rrv + 25 ) = *( p_r5 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
+               25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) )<<1);
+         *( p_rrv + 30 ) = *( p_r5 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
+               30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) )<<1);
+         *( p_rrv + 35 ) = *( p_r5 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
+               35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) )<<1);
+         /* Default value */
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i4;
+         ib = i5;
+         p_dn0 = dn + i4;
+         p_dn1 = dn + i5;
+         p_r0 = &rr[i0][i4];
+         p_r1 = &rr[i1][i4];
+         p_r2 = &rr[i2][i4];
+         p_r3 = &rr[i3][i4];
+         p_r4 = &rr[i4][i4];
+         p_r5 = &rr[i4][i5];
+         p_rrv0 = rrv + i5;
 
          do {
-            ps2 = ps1 + REAL2INT(*p_dn);
-            sq2 = ps2*ps2;
-            alp2 = alp1 + *p_rrv + ((*p_r6)<<1);
-
-            if ( (alp*sq2) > (sq*alp2) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = ( Word16 )( p_dn0 - dn );
-               ib = ( Word16 )( p_dn - dn );
-            }
-            p_dn += 5;
-            p_rrv += 5;
-            p_r6 += 5;
-         } while ( p_dn <= p_dn_max );
-         p_r0 += 5;
-         p_r1 += 5;
-         p_r2 += 5;
-         p_r3 += 5;
-         p_r4 += 205;
-         p_r5 += 200;
-         p_dn0 += 5;
-      } while ( p_dn0 < p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r4 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 )<<1);
+            p_dn = p_dn1;
+            p_r6 = p_r5;
+            p_rrv = p_rrv0;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r6)<<1);
+
+               if ( (alp*sq2) > (sq*alp2) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_dn += 5;
+               p_rrv += 5;
+               p_r6 += 5;
+            } while ( p_dn <= p_dn_max );
+            p_r0 += 5;
+            p_r1 += 5;
+            p_r2 += 5;
+            p_r3 += 5;
+            p_r4 += 205;
+            p_r5 += 200;
+            p_dn0 += 5;
+         } while ( p_dn0 < p_dn_max );
+      }
       i4 = ia;
       i5 = ib;
 
       /* i6 and i7 loop	*/
-      p_rrv = rrv + i7;
-      p_r0 = &rr[i0][i7];
-      p_r1 = &rr[i1][i7];
-      p_r2 = &rr[i2][i7];
-      p_r3 = &rr[i3][i7];
-      p_r4 = &rr[i4][i7];
-      p_r5 = &rr[i5][i7];
-      p_r7 = &rr[i7][i7];
-      *p_rrv = *p_r7 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 )<<1);
-      *( p_rrv + 5 ) = *( p_r7 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
-            + *( p_r2 + 5 ) + *( p_r3 + 5 ) + *( p_r4 + 5 ) + *( p_r5 + 5 ) )<<1);
-      *( p_rrv + 10 ) = *( p_r7 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
-            ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) + *( p_r4 + 10 ) + *( p_r5 + 10
-            ) )<<1);
-      *( p_rrv + 15 ) = *( p_r7 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
-            ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) + *( p_r4 + 15 ) + *( p_r5 + 15
-            ) )<<1);
-      *( p_rrv + 20 ) = *( p_r7 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20
-            ) )<<1);
-      *( p_rrv + 25 ) = *( p_r7 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
-            25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) + *( p_r4 + 25 ) + *( p_r5 +
-            25 ) )<<1);
-      *( p_rrv + 30 ) = *( p_r7 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
-            30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) + *( p_r4 + 30 ) + *( p_r5 +
-            30 ) )<<1);
-      *( p_rrv + 35 ) = *( p_r7 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
-            35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) + *( p_r4 + 35 ) + *( p_r5 +
-            35 ) )<<1);
-
-      /* Default value */
       ps0 = ps;
       alp0 = alp;
-      sq = -1;
-      alp = REAL_ICONST(1);
-      ps = 0;
-      ia = i6;
-      ib = i7;
-      p_dn0 = dn + i6;
-      p_dn1 = dn + i7;
-      p_r0 = &rr[i0][i6];
-      p_r1 = &rr[i1][i6];
-      p_r2 = &rr[i2][i6];
-      p_r3 = &rr[i3][i6];
-      p_r4 = &rr[i4][i6];
-      p_r5 = &rr[i5][i6];
-      p_r6 = &rr[i6][i6];
-      p_r7 = &rr[i6][i7];
-      p_rrv0 = rrv + i7;
-
-      do {
-         ps1 = ps0 + REAL2INT(*p_dn0);
-         alp1 = alp0 + *p_r6 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-               *p_r5 )<<1);
-         p_dn = p_dn1;
-         p_r8 = p_r7;
-         p_rrv = p_rrv0;
+      ip[4] = i4;
+      ip[5] = i5;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 6, i6, ( 38 - i6 ) / 5 + 1,
+                 i7, ( 39 - i7 ) / 5 + 1, 5, 0, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = rrv + i7;
+         p_r0 = &rr[i0][i7];
+         p_r1 = &rr[i1][i7];
+         p_r2 = &rr[i2][i7];
+         p_r3 = &rr[i3][i7];
+         p_r4 = &rr[i4][i7];
+         p_r5 = &rr[i5][i7];
+         p_r7 = &rr[i7][i7];
+         *p_rrv = *p_r7 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 )<<1);
+         *( p_rrv + 5 ) = *( p_r7 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
+               + *( p_r2 + 5 ) + *( p_r3 + 5 ) + *( p_r4 + 5 ) + *( p_r5 + 5 ) )<<1);
+         *( p_rrv + 10 ) = *( p_r7 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
+               ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) + *( p_r4 + 10 ) + *( p_r5 + 10
+               ) )<<1);
+         *( p_rrv + 15 ) = *( p_r7 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
+               ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) + *( p_r4 + 15 ) + *( p_r5 + 15
+               ) )<<1);
+         *( p_rrv + 20 ) = *( p_r7 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
+               ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20
+               ) )<<1);
+         *( p_rrv + 25 ) = *( p_r7 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
+               25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) + *( p_r4 + 25 ) + *( p_r5 +
+               25 ) )<<1);
+         *( p_rrv + 30 ) = *( p_r7 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
+               30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) + *( p_r4 + 30 ) + *( p_r5 +
+               30 ) )<<1);
+         *( p_rrv + 35 ) = *( p_r7 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
+               35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) + *( p_r4 + 35 ) + *( p_r5 +
+               35 ) )<<1);
+
+         /* Default value */
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i6;
+         ib = i7;
+         p_dn0 = dn + i6;
+         p_dn1 = dn + i7;
+         p_r0 = &rr[i0][i6];
+         p_r1 = &rr[i1][i6];
+         p_r2 = &rr[i2][i6];
+         p_r3 = &rr[i3][i6];
+         p_r4 = &rr[i4][i6];
+         p_r5 = &rr[i5][i6];
+         p_r6 = &rr[i6][i6];
+         p_r7 = &rr[i6][i7];
+         p_rrv0 = rrv + i7;
 
          do {
-            ps2 = ps1 + REAL2INT(*p_dn);
-            sq2 = ps2*ps2;
-            alp2 = alp1 + *p_rrv + ((*p_r8)<<1);
-
-            if ( (alp*sq2) > (sq*alp2) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = ( Word16 )( p_dn0 - dn );
-               ib = ( Word16 )( p_dn - dn );
-            }
-            p_dn += 5;
-            p_rrv += 5;
-            p_r8 += 5;
-         } while ( p_dn <= p_dn_max );
-         p_r0 += 5;
-         p_r1 += 5;
-         p_r2 += 5;
-         p_r3 += 5;
-         p_r4 += 5;
-         p_r5 += 5;
-         p_r6 += 205;
-         p_r7 += 200;
-         p_dn0 += 5;
-      } while ( p_dn0 < p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r6 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
+                  *p_r5 )<<1);
+            p_dn = p_dn1;
+            p_r8 = p_r7;
+            p_rrv = p_rrv0;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r8)<<1);
+
+               if ( (alp*sq2) > (sq*alp2) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_dn += 5;
+               p_rrv += 5;
+               p_r8 += 5;
+            } while ( p_dn <= p_dn_max );
+            p_r0 += 5;
+            p_r1 += 5;
+            p_r2 += 5;
+            p_r3 += 5;
+            p_r4 += 5;
+            p_r5 += 5;
+            p_r6 += 205;
+            p_r7 += 200;
+            p_dn0 += 5;
+         } while ( p_dn0 < p_dn_max );
+      }
       i6 = ia;
       i7 = ib;
 
       /* i8 and i9 loop	*/
-      p_rrv = rrv + i9;
-      p_r0 = &rr[i0][i9];
-      p_r1 = &rr[i1][i9];
-      p_r2 = &rr[i2][i9];
-      p_r3 = &rr[i3][i9];
-      p_r4 = &rr[i4][i9];
-      p_r5 = &rr[i5][i9];
-      p_r6 = &rr[i6][i9];
-      p_r7 = &rr[i7][i9];
-      p_r9 = &rr[i9][i9];
-      *p_rrv = *p_r9 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 +
-            *p_r6 + *p_r7 )<<1);
-      *( p_rrv + 5 ) = *( p_r9 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
-            + *( p_r2 + 5 ) + *( p_r3 + 5 ) + *( p_r4 + 5 ) + *( p_r5 + 5 ) + *(
-            p_r6 + 5 ) + *( p_r7 + 5 ) )<<1);
-      *( p_rrv + 10 ) = *( p_r9 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
-            ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) + *( p_r4 + 10 ) + *( p_r5 + 10
-            ) + *( p_r6 + 10 ) + *( p_r7 + 10 ) )<<1);
-      *( p_rrv + 15 ) = *( p_r9 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
-            ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) + *( p_r4 + 15 ) + *( p_r5 + 15
-            ) + *( p_r6 + 15 ) + *( p_r7 + 15 ) )<<1);
-      *( p_rrv + 20 ) = *( p_r9 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
-            ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20
-            ) + *( p_r6 + 20 ) + *( p_r7 + 20 ) )<<1);
-      *( p_rrv + 25 ) = *( p_r9 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
-            25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) + *( p_r4 + 25 ) + *( p_r5 +
-            25 ) + *( p_r6 + 25 ) + *( p_r7 + 25 ) )<<1);
-      *( p_rrv + 30 ) = *( p_r9 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
-            30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) + *( p_r4 + 30 ) + *( p_r5 +
-            30 ) + *( p_r6 + 30 ) + *( p_r7 + 30 ) )<<1);
-      *( p_rrv + 35 ) = *( p_r9 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
-            35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) + *( p_r4 + 35 ) + *( p_r5 +
-            35 ) + *( p_r6 + 35 ) + *( p_r7 + 35 ) )<<1);
-
-      /* Default value */
       ps0 = ps;
       alp0 = alp;
-      sq = -1;
-      alp = REAL_ICONST(1);
-      ps = 0;
-      ia = i8;
-      ib = i9;
-      p_dn0 = dn + i8;
-      p_dn1 = dn + i9;
-      p_r0 = &rr[i0][i8];
-      p_r1 = &rr[i1][i8];
-      p_r2 = &rr[i2][i8];
-      p_r3 = &rr[i3][i8];
-      p_r4 = &rr[i4][i8];
-      p_r5 = &rr[i5][i8];
-      p_r6 = &rr[i6][i8];
-      p_r7 = &rr[i7][i8];
-      p_r8 = &rr[i8][i8];
-      p_r9 = &rr[i8][i9];
-      p_rrv0 = rrv + i9;
-
-      do {
-         ps1 = ps0 + REAL2INT(*p_dn0);
-         alp1 = alp0 + *p_r8 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-               *p_r5 + *p_r6 + *p_r7 )<<1);
-         p_dn = p_dn1;
-         p_r10 = p_r9;
-         p_rrv = p_rrv0;
+      ip[6] = i6;
+      ip[7] = i7;
+      if ( !rrt ||
+           !amr_simd_kernels.search_pair( dn, rrt, ip, 8, i8, ( 38 - i8 ) / 5 + 1,
+                 i9, ( 39 - i9 ) / 5 + 1, 5, 0, &ps, &alp, &sq, &ia, &ib ) ) {
+         p_rrv = rrv + i9;
+         p_r0 = &rr[i0][i9];
+         p_r1 = &rr[i1][i9];
+         p_r2 = &rr[i2][i9];
+         p_r3 = &rr[i3][i9];
+         p_r4 = &rr[i4][i9];
+         p_r5 = &rr[i5][i9];
+         p_r6 = &rr[i6][i9];
+         p_r7 = &rr[i7][i9];
+         p_r9 = &rr[i9][i9];
+         *p_rrv = *p_r9 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 + *p_r5 +
+               *p_r6 + *p_r7 )<<1);
+         *( p_rrv + 5 ) = *( p_r9 + 205 ) + (( *( p_r0 + 5 ) + *( p_r1 + 5 )
+               + *( p_r2 + 5 ) + *( p_r3 + 5 ) + *( p_r4 + 5 ) + *( p_r5 + 5 ) + *(
+               p_r6 + 5 ) + *( p_r7 + 5 ) )<<1);
+         *( p_rrv + 10 ) = *( p_r9 + 410 ) + (( *( p_r0 + 10 ) + *( p_r1 + 10
+               ) + *( p_r2 + 10 ) + *( p_r3 + 10 ) + *( p_r4 + 10 ) + *( p_r5 + 10
+               ) + *( p_r6 + 10 ) + *( p_r7 + 10 ) )<<1);
+         *( p_rrv + 15 ) = *( p_r9 + 615 ) + (( *( p_r0 + 15 ) + *( p_r1 + 15
+               ) + *( p_r2 + 15 ) + *( p_r3 + 15 ) + *( p_r4 + 15 ) + *( p_r5 + 15
+               ) + *( p_r6 + 15 ) + *( p_r7 + 15 ) )<<1);
+         *( p_rrv + 20 ) = *( p_r9 + 820 ) + (( *( p_r0 + 20 ) + *( p_r1 + 20
+               ) + *( p_r2 + 20 ) + *( p_r3 + 20 ) + *( p_r4 + 20 ) + *( p_r5 + 20
+               ) + *( p_r6 + 20 ) + *( p_r7 + 20 ) )<<1);
+         *( p_rrv + 25 ) = *( p_r9 + 1025 ) + (( *( p_r0 + 25 ) + *( p_r1 +
+               25 ) + *( p_r2 + 25 ) + *( p_r3 + 25 ) + *( p_r4 + 25 ) + *( p_r5 +
+               25 ) + *( p_r6 + 25 ) + *( p_r7 + 25 ) )<<1);
+         *( p_rrv + 30 ) = *( p_r9 + 1230 ) + (( *( p_r0 + 30 ) + *( p_r1 +
+               30 ) + *( p_r2 + 30 ) + *( p_r3 + 30 ) + *( p_r4 + 30 ) + *( p_r5 +
+               30 ) + *( p_r6 + 30 ) + *( p_r7 + 30 ) )<<1);
+         *( p_rrv + 35 ) = *( p_r9 + 1435 ) + (( *( p_r0 + 35 ) + *( p_r1 +
+               35 ) + *( p_r2 + 35 ) + *( p_r3 + 35 ) + *( p_r4 + 35 ) + *( p_r5 +
+               35 ) + *( p_r6 + 35 ) + *( p_r7 + 35 ) )<<1);
+
+         /* Default value */
+         sq = -1;
+         alp = REAL_ICONST(1);
+         ps = 0;
+         ia = i8;
+         ib = i9;
+         p_dn0 = dn + i8;
+         p_dn1 = dn + i9;
+         p_r0 = &rr[i0][i8];
+         p_r1 = &rr[i1][i8];
+         p_r2 = &rr[i2][i8];
+         p_r3 = &rr[i3][i8];
+         p_r4 = &rr[i4][i8];
+         p_r5 = &rr[i5][i8];
+         p_r6 = &rr[i6][i8];
+         p_r7 = &rr[i7][i8];
+         p_r8 = &rr[i8][i8];
+         p_r9 = &rr[i8][i9];
+         p_rrv0 = rrv + i9;
 
          do {
-            ps2 = ps1 + REAL2INT(*p_dn);
-            sq2 = ps2*ps2;
-            alp2 = alp1 + *p_rrv + ((*p_r10)<<1);
-
-            if ( (alp*sq2) > (sq*alp2) ) {
-               sq = sq2;
-               ps = ps2;
-               alp = alp2;
-               ia = ( Word16 )( p_dn0 - dn );
-               ib = ( Word16 )( p_dn - dn );
-            }
-            p_dn += 5;
-            p_rrv += 5;
-            p_r10 += 5;
-         } while ( p_dn <= p_dn_max );
-         p_r0 += 5;
-         p_r1 += 5;
-         p_r2 += 5;
-         p_r3 += 5;
-         p_r4 += 5;
-         p_r5 += 5;
-         p_r6 += 5;
-         p_r7 += 5;
-         p_r8 += 205;
-         p_r9 += 200;
-         p_dn0 += 5;
-      } while ( p_dn0 < p_dn_max );
+            ps1 = ps0 + REAL2INT(*p_dn0);
+            alp1 = alp0 + *p_r8 + (( *p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
+                  *p_r5 + *p_r6 + *p_r7 )<<1);
+            p_dn = p_dn1;
+            p_r10 = p_r9;
+            p_rrv = p_rrv0;
+
+            do {
+               ps2 = ps1 + REAL2INT(*p_dn);
+               sq2 = ps2*ps2;
+               alp2 = alp1 + *p_rrv + ((*p_r10)<<1);
+
+               if ( (alp*sq2) > (sq*alp2) ) {
+                  sq = sq2;
+                  ps = ps2;
+                  alp = alp2;
+                  ia = ( Word16 )( p_dn0 - dn );
+                  ib = ( Word16 )( p_dn - dn );
+               }
+               p_dn += 5;
+               p_rrv += 5;
+               p_r10 += 5;
+            } while ( p_dn <= p_dn_max );
+            p_r0 += 5;
+            p_r1 += 5;
+            p_r2 += 5;
+            p_r3 += 5;
+            p_r4 += 5;
+            p_r5 += 5;
+            p_r6 += 5;
+            p_r7 += 5;
+            p_r8 += 205;
+            p_r9 += 200;
+            p_dn0 += 5;
+         } while ( p_dn0 < p_dn_max );
+      }
 
       /*
        * test and memorise if this combination is better than the last one.
@@ -7110,10 +7202,11 @@ static void code_10i40_35bits( real_t x[], real_t cn[], real_t h[],
                                real_t y[], Word16 anap[] )
  {
     real_32_t rr[L_CODE][L_CODE];
+    real_32_t rrt[L_CODE][AMR_SIMD_TRACKS][AMR_SIMD_TRACK];
     real_32_t dn[L_CODE];
     Word32 sign[L_CODE];
     Word32 ipos[10], pos_max[NB_TRACK], codvec[10];
-    Word32 i;
+    Word32 i, tracks;
 
     /* include pitch contribution into impulse resp. */
     if ( gain_pit > REAL_ICONST(1) )
@@ -7135,8 +7228,8 @@ static void code_10i40_35bits( real_t x[], real_t cn[], real_t h[],
     set_sign12k2( dn, cn, sign, pos_max, NB_TRACK, ipos, STEP );
 
     /* Matrix of correlations */
-    cor_h( h, sign, rr );
-    search_10i40( dn, rr, ipos, pos_max, codvec );
+    tracks = cor_h_tracks( h, sign, rr, rrt, STEP );
+    search_10i40( dn, rr, tracks ? rrt : NULL, ipos, pos_max, codvec );
     build_code_10i40_35bits( codvec, sign, code, h, y, anap );
     
     for ( i = 0; i < 10; i++ ) {
@@ -7182,7 +7275,7 @@ static void cbsearch( enum Mode mode, Word16 subnr, real_t x[],
                      real_t *res2, Word16 **anap )
 {
    switch (mode){
-/*   case MR475:
+   case MR475:
    case MR515:
       code_2i40_9bits( subnr, x, h, T0, pitch_sharp, code, y, *anap );
       ( *anap ) += 2;
@@ -7195,15 +7288,15 @@ static void cbsearch( enum Mode mode, Word16 subnr, real_t x[],
       code_3i40_14bits( x, h, T0, pitch_sharp, code, y, *anap );
       ( *anap ) += 2;
       break;
-   case MR74: */
+   case MR74:
    case MR795:
       code_4i40_17bits( x, h, T0, pitch_sharp, code, y, *anap );
       ( *anap ) += 2;
       break;
-/*   case MR102:
+   case MR102:
       code_8i40_31bits( x, res2, h, T0, pitch_sharp, code, y, *anap );
       *anap += 7;
-      break; */
+      break;
    default:
       code_10i40_35bits( x, res2, h, T0, gain_pit, code, y, *anap );
       *anap += 10;
@@ -7424,9 +7517,11 @@ static void gc_pred( Word32 *past_qua_en, enum Mode mode, real_t *code,
       *gcode0_fra = ( ener >> 1 ) - ( *gcode0_exp << 15 );
    }
    else {
-      ener = ener_code<<(27-REAL_BITS);
-      if (ener < 0)
+      /* saturate Q27 energy, 8 and 10 pulse codes with sharpening exceed 16.0 */
+      if ( ener_code > ( ( real_t )0x7fffffff >> ( 27 - REAL_BITS ) ) )
          ener = 0x7fffffff;
+      else
+         ener = ener_code<<(27-REAL_BITS);
 
       fixed_frexp(ener, &exp_code);
       exp_code = 31 - exp_code;
@@ -7595,39 +7690,40 @@ static void calc_filt_energies( enum Mode mode, real_t xn[], real_t xn2[],
  * Returns:
  *    void
  */
-#if 0
-static void MR475_update_unq_pred( Word32 *past_qua_en, Float32 gcode0, Float32
-      cod_gain )
+static void MR475_update_unq_pred( Word32 *past_qua_en, real_t gcode0, 
+                                   real_t cod_gain )
 {
-   Float32 qua_ener, pred_err_fact;
-   Word32 i, index, energy, max, s;
-
+   real_t qua_ener, pred_err_fact;
+   Word32 i, index, energy, max, s, exp, frac;
 
-   if ( cod_gain <= 0 ) {
+   if ( cod_gain <= REAL_ICONST(0) ) {
       /*MIN_QUA_ENER*/
-      qua_ener = -32.0F;
+      qua_ener = REAL_ICONST(-32);
    }
    else {
       if (gcode0 != 0) {
-         pred_err_fact = cod_gain / gcode0;
+         pred_err_fact = DIV_R(cod_gain,gcode0);
       }
       else {
-         pred_err_fact = 10.0F;
+         pred_err_fact = REAL_ICONST(10);
       }
 
-      if ( pred_err_fact < 0.0251189F ) {
+      if ( pred_err_fact < REAL_CONST(0.0251189F) ) {
          /*MIN_QUA_ENER*/
-         qua_ener = -32.0F;
+         qua_ener = REAL_ICONST(-32);
       }
-      else if ( pred_err_fact > 7.8125F ) {
+      else if ( pred_err_fact > REAL_CONST(7.8125F) ) {
          /*MAX_QUA_ENER*/
-         qua_ener = 17.8558F;
+         qua_ener = REAL_CONST(17.8558F);
       }
       else {
-         qua_ener = ( Float32 )( 20.0F*log10( pred_err_fact ) );
+         /* 20*log10(x) = log2(x) * 6.0206, 24660 = 6.0206 in Q12 */
+         Log2( ( Word32 )pred_err_fact, &exp, &frac );
+         qua_ener = ( ( ( int64_t )( ( ( exp - REAL_BITS ) << 15 ) + frac ) )
+               * 24660 ) >> ( 27 - REAL_BITS );
       }
    }
-   energy = (Word32)(qua_ener * 1024 + 0.5F);
+   energy = (Word32)(( qua_ener + ( 1 << ( REAL_BITS - 11 ) ) ) >> ( REAL_BITS - 10 ));
    max = abs(energy - qua_gain_code[0]);
    index = 0;
    /* find match from table */
@@ -7679,32 +7775,33 @@ static void MR475_update_unq_pred( Word32 *past_qua_en, Float32 gcode0, Float32
  *    index             index of quantization
  */
 static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word32
-                               sf0_gcode0_fra, Float32 sf0_coeff[], Float32 sf0_target_en,
-                               Float32 sf1_code_nosharp[], Word32 sf1_gcode0_exp, Word32
-                               sf1_gcode0_fra, Float32 sf1_coeff[], Float32 sf1_target_en,
-                               Float32 gp_limit, Float32 *sf0_gain_pit, Float32
-                               *sf0_gain_cod, Float32 *sf1_gain_pit, Float32 *sf1_gain_cod )
-{
-   Float32 temp, temp2, g_pitch, g2_pitch, g_code, g2_code, g_pit_cod, dist_min, sf0_gcode0, sf1_gcode0;
-   const Float32 *p;
+                               sf0_gcode0_fra, real_t sf0_coeff[], real_t sf0_target_en,
+                               real_t sf1_code_nosharp[], Word32 sf1_gcode0_exp, Word32
+                               sf1_gcode0_fra, real_t sf1_coeff[], real_t sf1_target_en,
+                               real_t gp_limit, real_t *sf0_gain_pit, real_t
+                               *sf0_gain_cod, real_t *sf1_gain_pit, real_t *sf1_gain_cod )
+{
+   real_t temp, temp2, g_pitch, g2_pitch, g_code, g_pit_cod, dist_min, sf0_gcode0, sf1_gcode0;
+   int64_t g2_code;
+   const real_t *p;
    Word32 i, tmp, g_code_tmp, gcode0, index = 0;
 
-   sf0_gcode0 = (Float32)Pow2(sf0_gcode0_exp, sf0_gcode0_fra);
-   sf1_gcode0 = (Float32)Pow2(sf1_gcode0_exp, sf1_gcode0_fra);
+   sf0_gcode0 = REAL_ICONST(Pow2(sf0_gcode0_exp, sf0_gcode0_fra));
+   sf1_gcode0 = REAL_ICONST(Pow2(sf1_gcode0_exp, sf1_gcode0_fra));
 
-   if ( ( sf0_target_en * 2.0F ) < sf1_target_en ) {
-      sf0_coeff[0] *= 2.0F;
-      sf0_coeff[1] *= 2.0F;
-      sf0_coeff[2] *= 2.0F;
-      sf0_coeff[3] *= 2.0F;
-      sf0_coeff[4] *= 2.0F;
+   if ( ( sf0_target_en << 1 ) < sf1_target_en ) {
+      sf0_coeff[0] <<= 1;
+      sf0_coeff[1] <<= 1;
+      sf0_coeff[2] <<= 1;
+      sf0_coeff[3] <<= 1;
+      sf0_coeff[4] <<= 1;
    }
-   else if ( sf0_target_en > ( sf1_target_en * 4.0F ) ) {
-      sf1_coeff[0] *= 2.0F;
-      sf1_coeff[1] *= 2.0F;
-      sf1_coeff[2] *= 2.0F;
-      sf1_coeff[3] *= 2.0F;
-      sf1_coeff[4] *= 2.0F;
+   else if ( sf0_target_en > ( sf1_target_en << 2 ) ) {
+      sf1_coeff[0] <<= 1;
+      sf1_coeff[1] <<= 1;
+      sf1_coeff[2] <<= 1;
+      sf1_coeff[3] <<= 1;
+      sf1_coeff[4] <<= 1;
    }
 
    /*
@@ -7715,22 +7812,22 @@ static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word
     * minimum MSE is stored and finally used to retrieve the quantized
     * gains
     */
-   dist_min = FLT_MAX;
+   dist_min = MAX_REAL;
    p = &table_gain_MR475[0];
 
    for ( i = 0; i < MR475_VQ_SIZE; i++ ) {
       /* subframe 0 (and 2) calculations */
       g_pitch = *p++;
       g_code = *p++;
-      g_code *= sf0_gcode0;
-      g2_pitch = g_pitch * g_pitch;
-      g2_code = g_code * g_code;
-      g_pit_cod = g_code * g_pitch;
-      temp = sf0_coeff[0] * g2_pitch;
-      temp += sf0_coeff[1] * g_pitch;
-      temp += sf0_coeff[2] * g2_code;
-      temp += sf0_coeff[3] * g_code;
-      temp += sf0_coeff[4] * g_pit_cod;
+      g_code = MUL_R(g_code,sf0_gcode0);
+      g2_pitch = MUL_R(g_pitch,g_pitch);
+      g2_code = REAL2INT(g_code)*REAL2INT(g_code);
+      g_pit_cod = MUL_R(g_code,g_pitch);
+      temp = MUL_R(sf0_coeff[0],g2_pitch);
+      temp += MUL_R(sf0_coeff[1],g_pitch);
+      temp += sf0_coeff[2]*g2_code;
+      temp += MUL_R(sf0_coeff[3],g_code);
+      temp += MUL_R(sf0_coeff[4],g_pit_cod);
       temp2 = g_pitch - gp_limit;
 
       /* subframe 1 (and 3) calculations */
@@ -7738,15 +7835,15 @@ static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word
       g_code = *p++;
 
       if ( temp2 <= 0 && ( g_pitch <= gp_limit ) ) {
-         g_code *= sf1_gcode0;
-         g2_pitch = g_pitch * g_pitch;
-         g2_code = g_code * g_code;
-         g_pit_cod = g_code * g_pitch;
-         temp += sf1_coeff[0] * g2_pitch;
-         temp += sf1_coeff[1] * g_pitch;
-         temp += sf1_coeff[2] * g2_code;
-         temp += sf1_coeff[3] * g_code;
-         temp += sf1_coeff[4] * g_pit_cod;
+         g_code = MUL_R(g_code,sf1_gcode0);
+         g2_pitch = MUL_R(g_pitch,g_pitch);
+         g2_code = REAL2INT(g_code)*REAL2INT(g_code);
+         g_pit_cod = MUL_R(g_code,g_pitch);
+         temp += MUL_R(sf1_coeff[0],g2_pitch);
+         temp += MUL_R(sf1_coeff[1],g_pitch);
+         temp += sf1_coeff[2]*g2_code;
+         temp += MUL_R(sf1_coeff[3],g_code);
+         temp += MUL_R(sf1_coeff[4],g_pit_cod);
 
          /*
           * store table index if MSE for this index is lower
@@ -7768,24 +7865,24 @@ static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word
    tmp = index << 2;
    p = &table_gain_MR475[tmp];
    *sf0_gain_pit = *p++;
-   g_code_tmp = (Word32)(*p++ * 4096 + 0.5F);
+   g_code_tmp = (Word32)(( *p++ + ( 1 << ( REAL_BITS - 13 ) ) ) >> ( REAL_BITS - 12 ));
 
    gcode0 = Pow2( 14, sf0_gcode0_fra );
    if ( sf0_gcode0_exp < 11 ) {
-      *sf0_gain_cod = (Float32)(( g_code_tmp * gcode0 ) >> ( 25 - sf0_gcode0_exp ));
+      *sf0_gain_cod = REAL_ICONST(( g_code_tmp * gcode0 ) >> ( 25 - sf0_gcode0_exp ));
    }
    else {
       i = ( ( g_code_tmp * gcode0 ) << ( sf0_gcode0_exp - 9 ) );
 
       if ( ( i >> ( sf0_gcode0_exp - 9 ) ) != ( g_code_tmp * gcode0 ) ) {
-         *sf0_gain_cod = (Float32)0x7FFF;
+         *sf0_gain_cod = REAL_ICONST(0x7FFF);
       }
       else {
-         *sf0_gain_cod = (Float32)(i >> 16);
+         *sf0_gain_cod = REAL_ICONST(i >> 16);
       }
    }
 
-   *sf0_gain_cod *= 0.5F;
+   *sf0_gain_cod >>= 1;
 
    for ( i = 3; i > 0; i-- ) {
       past_qua_en[i] = past_qua_en[i - 1];
@@ -7802,24 +7899,24 @@ static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word
    tmp += 2;
    p = &table_gain_MR475[tmp];
    *sf1_gain_pit = *p++;
-   g_code_tmp = (Word32)(*p++ * 4096 + 0.5F);
+   g_code_tmp = (Word32)(( *p++ + ( 1 << ( REAL_BITS - 13 ) ) ) >> ( REAL_BITS - 12 ));
 
    gcode0 = Pow2( 14, sf1_gcode0_fra );
    if ( sf1_gcode0_exp < 11 ) {
-      *sf1_gain_cod = (Float32)(( g_code_tmp * gcode0 ) >> ( 25 - sf1_gcode0_exp ));
+      *sf1_gain_cod = REAL_ICONST(( g_code_tmp * gcode0 ) >> ( 25 - sf1_gcode0_exp ));
    }
    else {
       i = ( ( g_code_tmp * gcode0 ) << ( sf1_gcode0_exp - 9 ) );
 
       if ( ( i >> ( sf1_gcode0_exp - 9 ) ) != ( g_code_tmp * gcode0 ) ) {
-         *sf1_gain_cod = (Float32)0x7FFF;
+         *sf1_gain_cod = REAL_ICONST(0x7FFF);
       }
       else {
-         *sf1_gain_cod = (Float32)(i >> 16);
+         *sf1_gain_cod = REAL_ICONST(i >> 16);
       }
    }
 
-   *sf1_gain_cod *= 0.5F;
+   *sf1_gain_cod >>= 1;
 
    for ( i = 3; i > 0; i-- ) {
       past_qua_en[i] = past_qua_en[i - 1];
@@ -7828,7 +7925,6 @@ static Word16 MR475_gain_quant( Word32 *past_qua_en, Word32 sf0_gcode0_exp, Word
 
    return( Word16 )index;
 }
-#endif
 
 /*
  * q_gain_code
@@ -7880,7 +7976,7 @@ static Word16 q_gain_code( real_t gcode0, real_t *gain, Word32 *qua_ener_index)
       }
    }
    p = &gain_factor[index];
-   *gain = fixed_floor(MUL_F(gcode0,*p));
+   *gain = fixed_floor(MUL_R(gcode0,*p));
    *qua_ener_index = index;
 
    return( Word16 )index;
@@ -8064,7 +8160,8 @@ static void calc_unfilt_energies( real_t res[], real_t exc[], real_t code[],
    /* calculate LTP coding gain, i.e. energy reduction LP res -> LTP res */
    if ( en[3] > 0 && en[0] != 0 ) {
       /* gain = ResEn / LTPResEn */
-       *ltpg = fixed_log(REAL_ICONST(en[0]))-fixed_log(REAL_ICONST(en[3]));
+       *ltpg = DIV_R( fixed_log( REAL_ICONST( en[0] ) )-fixed_log( REAL_ICONST( en[3] ) ),
+             REAL_CONST( 0.6931471806 ) );
    }
    else {
       *ltpg = REAL_ICONST(0);
@@ -8448,17 +8545,17 @@ static void MR795_gain_quant( real_t *prev_gc, Word16 *onset, real_t *ltpg_mem,
  * Returns:
  *    index             index of quantization
  */
-#if 0
-static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, Float32 coeff[], Float32
-      gp_limit, Float32 *gain_pit, Float32 *gain_cod, Word32 *qua_ener_index)
+static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, real_t coeff[], 
+                        real_t gp_limit, real_t *gain_pit, real_t *gain_cod, 
+                        Word32 *qua_ener_index)
 {
-   Float32 g_pitch, g2_pitch, g_code, g2_code, g_pit_cod, tmp, dist_min, gcode0;
-   const Float32 *table_gain, *p;
+   real_t g_pitch, g2_pitch, g_code, g_pit_cod, tmp, dist_min, gcode0;
+   int64_t g2_code;
+   const real_t *table_gain, *p;
    Word32 i, index = 0, gcode_0, g_code_tmp;
    Word16 table_len;
 
-   gcode0 = (Float32)Pow2( gcode0_exp, gcode0_fra );
-
+   gcode0 = REAL_ICONST(Pow2( gcode0_exp, gcode0_fra ));
 
    if ( ( mode == MR102 ) || ( mode == MR74 ) || ( mode == MR67 ) ) {
       table_len = VQ_SIZE_HIGHRATES;
@@ -8479,7 +8576,7 @@ static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, Fl
     * minimum MSE is stored and finally used to retrieve the quantized
     * gains
     */
-   dist_min = FLT_MAX;
+   dist_min = MAX_REAL;
    p = &table_gain[0];
 
    for ( i = 0; i < table_len; i++ ) {
@@ -8489,15 +8586,15 @@ static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, Fl
       g_code = *p++;
 
       if ( g_pitch <= gp_limit ) {
-         g_code *= gcode0;
-         g2_pitch = g_pitch * g_pitch;
-         g2_code = g_code * g_code;
-         g_pit_cod = g_code * g_pitch;
-         tmp = coeff[0] * g2_pitch;
-         tmp += coeff[1] * g_pitch;
-         tmp += coeff[2] * g2_code;
-         tmp += coeff[3] * g_code;
-         tmp += coeff[4] * g_pit_cod;
+         g_code = MUL_R(g_code,gcode0);
+         g2_pitch = MUL_R(g_pitch,g_pitch);
+         g2_code = REAL2INT(g_code)*REAL2INT(g_code);
+         g_pit_cod = MUL_R(g_code,g_pitch);
+         tmp = MUL_R(coeff[0],g2_pitch);
+         tmp += MUL_R(coeff[1],g_pitch);
+         tmp += coeff[2]*g2_code;
+         tmp += MUL_R(coeff[3],g_code);
+         tmp += MUL_R(coeff[4],g_pit_cod);
 
          /*
           * store table index if MSE for this index is lower
@@ -8515,7 +8612,7 @@ static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, Fl
     */
    p = &table_gain[index << 1];
    *gain_pit = *p++;
-   g_code_tmp = (Word32)(4096 * *p);
+   g_code_tmp = (Word32)((*p)>>(REAL_BITS-12));
 
    /*
     * calculate final fixed codebook gain:
@@ -8524,24 +8621,23 @@ static Word16 Qua_gain( enum Mode mode, Word32 gcode0_exp, Word32 gcode0_fra, Fl
 
    gcode_0 = Pow2( 14, gcode0_fra );
    if ( gcode0_exp < 11 ) {
-      *gain_cod = (Float32)((g_code_tmp * gcode_0) >> ( 25 - gcode0_exp ));
+      *gain_cod = REAL_ICONST((g_code_tmp * gcode_0) >> ( 25 - gcode0_exp ));
    }
    else {
       i = ( ( g_code_tmp * gcode_0) << ( gcode0_exp - 9 ) );
 
       if ( ( i >> ( gcode0_exp - 9 ) ) != ( g_code_tmp * gcode_0) ) {
-         *gain_cod = 0x7FFF;
+         *gain_cod = REAL_ICONST(0x7FFF);
       }
       else {
-         *gain_cod = (Float32)(i >> 16);
+         *gain_cod = REAL_ICONST(i >> 16);
       }
    }
-   *gain_cod = *gain_cod * 0.5F;
+   *gain_cod >>= 1;
    *qua_ener_index += index;
 
    return( Word16 )index;
 }
-#endif
 
 /*
  * gainQuant
@@ -8599,7 +8695,6 @@ static void gainQuant( enum Mode mode, Word32 even_subframe, Word32 *past_qua_en
    Word32 i, exp, frac, qua_ener_index = 0;
 
    if ( mode == MR475 ) {
-#if 0
       if ( even_subframe != 0 ) {
       /*
        * save position in output parameter stream and current
@@ -8616,7 +8711,7 @@ static void gainQuant( enum Mode mode, Word32 even_subframe, Word32 *past_qua_en
           * (note that code[] is unsharpened in MR475)
           */
          gc_pred( past_qua_en, mode, code, sf0_gcode0_exp, sf0_gcode0_fra, &en );
-         gcode0 = (Float32)Pow2(*sf0_gcode0_exp, *sf0_gcode0_fra);
+         gcode0 = REAL_ICONST(Pow2(*sf0_gcode0_exp, *sf0_gcode0_fra));
 
          /*
           * calculate energy coefficients for quantization
@@ -8627,7 +8722,7 @@ static void gainQuant( enum Mode mode, Word32 even_subframe, Word32 *past_qua_en
 
          /* store optimum codebook gain */
          *gain_cod = cod_gain;
-         *sf0_target_en = (Float32)Dotproduct40( xn, xn );
+         *sf0_target_en = Dotproduct40_fix2( xn, xn );
 
          /*
           * calculate optimum codebook gain and update
@@ -8646,14 +8741,13 @@ static void gainQuant( enum Mode mode, Word32 even_subframe, Word32 *past_qua_en
 
          /* calculate energy coefficients for quantization */
          calc_filt_energies( mode, xn, xn2, y1, y2, gCoeff, coeff, &cod_gain );
-         en = (Float32)Dotproduct40( xn, xn );
+         en = Dotproduct40_fix2( xn, xn );
 
          /* run real (4-dim) quantizer and update real gain predictor */
          **gain_idx_ptr = MR475_gain_quant( past_qua_en, *sf0_gcode0_exp, *sf0_gcode0_fra, sf0_coeff,
                *sf0_target_en, code, exp, frac, coeff, en, gp_limit, sf0_gain_pit,
                sf0_gain_cod, gain_pit, gain_cod );
       }
-#endif
    }
    else {
       /*
@@ -8693,11 +8787,10 @@ static void gainQuant( enum Mode mode, Word32 even_subframe, Word32 *past_qua_en
                   code, coeff, en, exp, frac , cod_gain, gp_limit, gain_pit,
                   gain_cod, &qua_ener_index, anap );
          }
-/*         else {
-
+         else {
             *( *anap )++ = Qua_gain( mode, exp, frac, coeff, gp_limit, gain_pit,
                   gain_cod, &qua_ener_index);
-         } */
+         }
       }
 
       /*
@@ -8778,8 +8871,8 @@ static void subframePostProc( real_t *speech, Word16 i_subfr, real_t gain_pit,
                               real_t *mem_w0, real_t *exc, real_t *sharp )
 {
    Word32 i, j;
-   static real_t real_const1 = REAL_CONST(0.5);
-   static real_t real_const2 = REAL_CONST(0.794556F);
+   static const real_t real_const1 = REAL_CONST(0.5);
+   static const real_t real_const2 = REAL_CONST(0.794556F);
 
    /*
     * Update pitch sharpening "sharp" with quantized gain_pit
@@ -8816,40 +8909,6 @@ static void subframePostProc( real_t *speech, Word16 i_subfr, real_t gain_pit,
 }
 
 
-/*
- * Convolve
- *
- *
- * Parameters:
- *    x                 I: First input
- *    h                 I: second input
- *    y                 O: output
- *
- * Function:
- *    Convolution
- *
- * Returns:
- *    void
- */
-#if 0
-static void Convolve( Float32 x[], Float32 h[], Float32 y[] )
-{
-   Word32 i, n;
-   Float32 s;
-
-
-   for ( n = 0; n < L_SUBFR; n++ ) {
-      s = 0.0F;
-
-      for ( i = 0; i <= n; i++ ) {
-         s += x[i] * h[n - i];
-      }
-      y[n] = s;
-   }
-   return;
-}
-
-
 /*
  * tx_dtx_handler
  *
@@ -8866,6 +8925,7 @@ static void Convolve( Float32 x[], Float32 h[], Float32 y[] )
  * Returns:
  *    compute_new_sid_possible
  */
+#if 0
 static Word16 tx_dtx_handler( Word16 vad_flag, Word16 *decAnaElapsedCount,
       Word16 *dtxHangoverCount, enum Mode *used_mode )
 {
@@ -10620,23 +10680,23 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
    real_t res2[L_SUBFR];   /* Long term (LTP) prediction residual */
 
    /* Vector and scalars needed for the MR475 */
-//   real_t xn_sf0[L_SUBFR];   /* Target vector for pitch search */
-//   real_t y2_sf0[L_SUBFR];   /* Filtered codebook innovation */
-//   real_t code_sf0[L_SUBFR];   /* Fixed codebook excitation */
-//   real_t h1_sf0[L_SUBFR];   /* The impulse response of sf0 */
-//   real_t mem_syn_save[M];   /* Filter memory */
-///   real_t mem_w0_save[M];   /* Filter memory */
-//   real_t mem_err_save[M];   /* Filter memory */
-//   real_t sharp_save = REAL_ICONST(0);   /* Sharpening */
+   real_t xn_sf0[L_SUBFR];   /* Target vector for pitch search */
+   real_t y2_sf0[L_SUBFR];   /* Filtered codebook innovation */
+   real_t code_sf0[L_SUBFR];   /* Fixed codebook excitation */
+   real_t h1_sf0[L_SUBFR];   /* The impulse response of sf0 */
+   real_t mem_syn_save[M];   /* Filter memory */
+   real_t mem_w0_save[M];   /* Filter memory */
+   real_t mem_err_save[M];   /* Filter memory */
+   real_t sharp_save = REAL_ICONST(0);   /* Sharpening */
    real_t gain_pit_sf0;   /* Quantized pitch gain for sf0 */
    real_t gain_code_sf0;   /* Quantized codebook gain for sf0 */
-//   Word16 i_subfr_sf0 = 0;   /* Position in exc[] for sf0 */
+   Word16 i_subfr_sf0 = 0;   /* Position in exc[] for sf0 */
 
    /* Scalars & Flags */
    real_t gain_pit, gain_code;
    real_t gp_limit;   /* pitch gain limit value */
-//   Word32 T0_sf0 = 0;   /* Integer pitch lag of sf0 */
-//   Word32 T0_frac_sf0 = 0;   /* Fractional pitch lag of sf0 */
+   Word32 T0_sf0 = 0;   /* Integer pitch lag of sf0 */
+   Word32 T0_frac_sf0 = 0;   /* Fractional pitch lag of sf0 */
    Word32 T0, T0_frac;
    Word32 T_op[2];
    Word32 evenSubfr;
@@ -10856,34 +10916,30 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
       subfrNr += 1;
       evenSubfr = 1 - evenSubfr;
 
-#if 0
       if ( ( evenSubfr != 0 ) && ( *used_mode == MR475 ) ) {
-         memcpy( mem_syn_save, st->mem_syn, M <<2 );
-         memcpy( mem_w0_save, st->mem_w0, M <<2 );
-         memcpy( mem_err_save, st->mem_err, M <<2 );
+         memcpy( mem_syn_save, st->mem_syn, M*sizeof(real_t) );
+         memcpy( mem_w0_save, st->mem_w0, M*sizeof(real_t) );
+         memcpy( mem_err_save, st->mem_err, M*sizeof(real_t) );
          sharp_save = st->sharp;
       }
-#endif
 
       /* Preprocessing of subframe */
       if ( *used_mode != MR475 ) {
          subframePreProc( *used_mode, &Ap1[offset], &Ap2[offset], 
                Aq, &st->speech[i_subfr], st->mem_err, st->mem_w0, st->zero,
                st->ai_zero, &st->exc[i_subfr], st->h1, xn, res, st->error );
-         offset += MP1;
       }
-#if 0
       /* MR475 */
       else {
-         subframePreProc( *used_mode, gamma1, gamma1_12k2, gamma2, A, Aq, &st->
-               speech[i_subfr], st->mem_err, mem_w0_save, st->zero, st->ai_zero,
-               &st->exc[i_subfr], st->h1, xn, res, st->error );
+         subframePreProc( *used_mode, &Ap1[offset], &Ap2[offset], 
+               Aq, &st->speech[i_subfr], st->mem_err, mem_w0_save, st->zero,
+               st->ai_zero, &st->exc[i_subfr], st->h1, xn, res, st->error );
 
          if ( evenSubfr != 0 ) {
-            memcpy( h1_sf0, st->h1, L_SUBFR <<2 );
+            memcpy( h1_sf0, st->h1, L_SUBFR*sizeof(real_t) );
          }
       }
-#endif
+      offset += MP1;
 
 #ifdef AMR_DEBUG_SUBFRAMEPREPROC
       amr_dump_real("cod_amr:st->ai_zero",st->ai_zero,MP1);
@@ -10973,12 +11029,11 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
                &st->sharp );
       }
       else {
-#if 0
          if ( evenSubfr != 0 ) {
             i_subfr_sf0 = i_subfr;
-            memcpy( xn_sf0, xn, L_SUBFR <<2 );
-            memcpy( y2_sf0, y2, L_SUBFR <<2 );
-            memcpy( code_sf0, code, L_SUBFR <<2 );
+            memcpy( xn_sf0, xn, L_SUBFR*sizeof(real_t) );
+            memcpy( y2_sf0, y2, L_SUBFR*sizeof(real_t) );
+            memcpy( code_sf0, code, L_SUBFR*sizeof(real_t) );
             T0_sf0 = T0;
             T0_frac_sf0 = T0_frac;
 
@@ -10993,7 +11048,7 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
              * update both subframes for the MR475
              * Restore states for the MR475 mode
              */
-            memcpy( st->mem_err, mem_err_save, M <<2 );
+            memcpy( st->mem_err, mem_err_save, M*sizeof(real_t) );
 
             /* re-build excitation for sf 0 */
             Pred_lt_3or6( &st->exc[i_subfr_sf0], T0_sf0, T0_frac_sf0, 1 );
@@ -11010,9 +11065,9 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
              * re-run pre-processing to get xn right (needed by postproc)
              * (this also reconstructs the unsharpened h1 for sf 1)
              */
-            subframePreProc( *used_mode, gamma1, gamma1_12k2, gamma2, A, Aq, &st
-                  ->speech[i_subfr], st->mem_err, st->mem_w0, st->zero, st->
-                  ai_zero, &st->exc[i_subfr], st->h1, xn, res, st->error );
+            subframePreProc( *used_mode, &Ap1[offset - MP1], &Ap2[offset - MP1],
+                  Aq, &st->speech[i_subfr], st->mem_err, st->mem_w0, st->zero,
+                  st->ai_zero, &st->exc[i_subfr], st->h1, xn, res, st->error );
 
             /* re-build excitation sf 1 (changed if lag < L_SUBFR) */
             Pred_lt_3or6( &st->exc[i_subfr], T0, T0_frac, 1 );
@@ -11021,7 +11076,6 @@ static void cod_amr( cod_amrState *st, enum Mode mode, real_t new_speech[],
                   synth, xn, code, y1, y2, st->mem_syn, st->mem_err, st->mem_w0,
                   st->exc, &st->sharp );
          }
-#endif
       }
 #ifdef AMR_DEBUG_SUBFRAMEPOSTPROC
 	  amr_dump_real32("subframePostProc::synth",synth,L_FRAME);
@@ -11167,12 +11221,12 @@ static void Pre_Process( real_t *y2, real_t *y1, Word16 *x0,
    Word32 i;
    Word16 x2;
    real_t tmp;
-   static frac_t real_const1 = FRAC_CONST(0.4636230465);
-   static frac_t real_const2 = FRAC_CONST(0.92724705);
-   static frac_t real_const3 = FRAC_CONST(0.4636234515);
-   static frac_t real_const4 = FRAC_CONST(1.906005859);
-   static frac_t real_const5 = FRAC_CONST(0.911376953);
-   static frac_t real_const6 = FRAC_CONST(0.0000000001);
+   static const frac_t real_const1 = FRAC_CONST(0.4636230465);
+   static const frac_t real_const2 = FRAC_CONST(0.92724705);
+   static const frac_t real_const3 = FRAC_CONST(0.4636234515);
+   static const frac_t real_const4 = FRAC_CONST(1.906005859);
+   static const frac_t real_const5 = FRAC_CONST(0.911376953);
+   static const frac_t real_const6 = FRAC_CONST(0.0000000001);
 
    for ( i = 0; i < 160; i++ ) {
       x2 = *x1;
@@ -11540,6 +11594,10 @@ void * Speech_Encode_Frame_init( int dtx )
    Speech_Encode_FrameState *s;
    void *s1;
 
+   /* the lookup tables and the vector kernels are shared by all encoders */
+   fixed_fixed_init();
+   amr_simd_init();
+
    /* allocate memory */
    if ( ( s = ( Speech_Encode_FrameState * ) malloc( sizeof(
          Speech_Encode_FrameState ) ) ) == NULL ) {
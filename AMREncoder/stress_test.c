@@ -0,0 +1,163 @@
+/*
+ * ===================================================================
+ *  TS 26.104
+ *  REL-5 V5.4.0 2004-03
+ *  REL-6 V6.1.0 2004-03
+ *  3GPP AMR Floating-point Speech Codec
+ * ===================================================================
+ *
+ */
+
+/*
+ * stress_test.c
+ *
+ *
+ * Project:
+ *    AMR Floating-Point Codec
+ *
+ * Contains:
+ *    A test of the encoder's reentrancy.  Each of several encoders is
+ *    first run on its own, and then all of them are run at once, on
+ *    their own threads (several times over).  Every concurrent run must
+ *    produce exactly the same output as the serial run of that encoder.
+ *
+ *    The encoders differ in their input, their DTX setting, whether
+ *    their frames have a header byte, and in how often they switch
+ *    mode, so that the threads exercise different code paths at once.
+ *
+ *    usage: stress_test [numEncoders [numFrames [numRounds]]]
+ *    (exits with status 1 if any output differs)
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include "interf_enc.h"
+
+#define MAX_PACKED_SIZE 32 /* the frame header byte, and up to 31 bytes */
+
+typedef struct {
+   int id;
+   int numFrames;
+   unsigned char *out;
+   int outSize;
+} Job;
+
+/*
+ * runEncoder
+ *
+ *
+ * Parameters:
+ *    arg               B: the Job to run
+ *
+ * Function:
+ *    Encodes the job's input (a signal generated from its "id"),
+ *    putting the packed frames into its "out" buffer
+ *
+ * Returns:
+ *    NULL
+ */
+static void *runEncoder( void *arg )
+{
+   Job *job = ( Job * )arg;
+   void *st = Encoder_Interface_init( job->id % 3 == 0 /* DTX */ );
+   short speech[160];
+   unsigned int seed = job->id + 1;
+   int f, i;
+
+   Encoder_Interface_setHeaderByte( st, job->id % 2 == 0 );
+   job->outSize = 0;
+
+   for ( f = 0; f < job->numFrames; f++ ) {
+      /* switch mode every 2 to 10 frames, depending on the encoder: */
+      enum Mode mode = ( enum Mode )( ( f / ( 2 + job->id % 9 ) + job->id ) % 8 );
+
+      for ( i = 0; i < 160; i++ ) {
+         int t = f * 160 + i;
+         double x = 6000 * sin( t * 0.05 * ( 1 + job->id % 5 ) )
+               + 3000 * sin( t * 0.0031 * t / 1000.0 );
+
+         seed = seed * 1103515245 + 12345;
+
+         /* leave gaps of near-silence, for DTX: */
+         if ( ( f / 50 ) % 4 == 3 )
+            x = 0;
+         speech[i] = ( short )( x + ( int )( ( seed >> 16 ) % 2000 ) - 1000 );
+      }
+      /* (let the other encoders in between our frames, even on one CPU) */
+      sched_yield();
+      job->outSize += Encoder_Interface_Encode( st, mode, speech,
+            job->out + job->outSize, 0 );
+   }
+   Encoder_Interface_exit( st );
+   return NULL;
+}
+
+
+int main( int argc, char *argv[] )
+{
+   int numEncoders = argc > 1 ? atoi( argv[1] ) : 8;
+   int numFrames = argc > 2 ? atoi( argv[2] ) : 500;
+   int numRounds = argc > 3 ? atoi( argv[3] ) : 10;
+   Job *serial, *concurrent;
+   pthread_t *threads;
+   int i, round, numMismatches = 0;
+
+   if ( numEncoders < 1 || numFrames < 1 || numRounds < 1 ) {
+      fprintf( stderr, "usage: %s [numEncoders [numFrames [numRounds]]]\n", argv[0] );
+      return 1;
+   }
+   serial = ( Job * )calloc( numEncoders, sizeof( Job ) );
+   concurrent = ( Job * )calloc( numEncoders, sizeof( Job ) );
+   threads = ( pthread_t * )calloc( numEncoders, sizeof( pthread_t ) );
+
+   /* The reference output, from running each encoder on its own: */
+   for ( i = 0; i < numEncoders; i++ ) {
+      serial[i].id = concurrent[i].id = i;
+      serial[i].numFrames = concurrent[i].numFrames = numFrames;
+      serial[i].out = ( unsigned char * )malloc( numFrames * MAX_PACKED_SIZE );
+      concurrent[i].out = ( unsigned char * )malloc( numFrames * MAX_PACKED_SIZE );
+      runEncoder( &serial[i] );
+   }
+
+   for ( round = 0; round < numRounds; round++ ) {
+      for ( i = 0; i < numEncoders; i++ ) {
+         if ( pthread_create( &threads[i], NULL, runEncoder, &concurrent[i] ) != 0 ) {
+            fprintf( stderr, "pthread_create() failed\n" );
+            return 1;
+         }
+      }
+      for ( i = 0; i < numEncoders; i++ )
+         pthread_join( threads[i], NULL );
+
+      for ( i = 0; i < numEncoders; i++ ) {
+         if ( concurrent[i].outSize != serial[i].outSize
+               || memcmp( concurrent[i].out, serial[i].out, serial[i].outSize ) != 0 ) {
+            fprintf( stderr, "round %d: encoder %d's output differs from its serial run\n",
+                  round, i );
+            ++numMismatches;
+         }
+      }
+   }
+
+   if ( numMismatches > 0 ) {
+      printf( "FAILED: %d of %d concurrent runs differ\n",
+            numMismatches, numEncoders * numRounds );
+      return 1;
+   }
+   printf( "ok: %d encoders x %d frames, %d rounds: concurrent output matches serial\n",
+         numEncoders, numFrames, numRounds );
+
+   for ( i = 0; i < numEncoders; i++ ) {
+      free( serial[i].out );
+      free( concurrent[i].out );
+   }
+   free( serial );
+   free( concurrent );
+   free( threads );
+   return 0;
+}
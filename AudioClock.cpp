@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A sample-accurate clock for captured audio.  Presentation times are derived
+// from the cumulative number of bytes captured, anchored to CLOCK_MONOTONIC,
+// and disciplined (by a PLL) to the measured capture times, and to the video
+// capture device's timestamps.
+// Implementation
+
+#include "AudioClock.hh"
+#include <time.h>
+#include <math.h>
+
+// The PLL's loop gains (per measurement).  Measured capture times jitter by
+// several ms, so the clock follows them only slowly:
+#define PHASE_GAIN (1.0/32)
+#define FREQUENCY_GAIN (1.0/1024)
+#define MAX_FREQUENCY_CORRECTION 0.0005 // 500 ppm
+
+// A phase error larger than this means that audio data was lost (or the
+// clock was stepped), so we start again from the measured time:
+#define MAX_PHASE_ERROR 0.1 // seconds
+
+// Video frames are dequeued some time after they're timestamped, so each frame
+// gives us an underestimate of the domain offset.  We therefore follow the
+// least-delayed frames: moving quickly toward larger offsets, but only slowly
+// toward smaller ones:
+#define DOMAIN_OFFSET_GAIN_UP (1.0/8)
+#define DOMAIN_OFFSET_GAIN_DOWN (1.0/1024)
+#define MAX_DOMAIN_OFFSET_STEP 1.0 // seconds; a larger change means that the clock was stepped
+
+static double realtimeNow() {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return now.tv_sec + now.tv_usec/1000000.0;
+}
+
+double AudioClock::monotonicNow() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec/1000000000.0;
+}
+
+AudioClock::AudioClock(unsigned bytesPerSecond)
+  : fSecondsPerByte(1.0/bytesPerSecond),
+    fIsSynced(False), fNextTime(0.0), fFrequencyCorrection(0.0), fLastPhaseError(0.0),
+    fNumResyncs(0) {
+  // Unless we're told otherwise, video devices timestamp their frames with
+  // "gettimeofday()":
+  setVideoClockIsMonotonic(False);
+}
+
+void AudioClock::setVideoClockIsMonotonic(Boolean isMonotonic) {
+  // Start in the video device's domain, so that the first video timestamps
+  // (which arrive only after audio has started) just fine-tune the offset:
+  fDomainOffset = isMonotonic ? 0.0 : realtimeNow() - monotonicNow();
+}
+
+void AudioClock::noteCaptureTime(double captureTime) {
+  if (!fIsSynced) {
+    fNextTime = captureTime;
+    fIsSynced = True;
+    return;
+  }
+
+  double phaseError = captureTime - fNextTime;
+  fLastPhaseError = phaseError;
+  if (fabs(phaseError) > MAX_PHASE_ERROR) {
+    fNextTime = captureTime;
+    ++fNumResyncs;
+    return;
+  }
+
+  fNextTime += PHASE_GAIN*phaseError;
+  fFrequencyCorrection += FREQUENCY_GAIN*phaseError;
+  if (fFrequencyCorrection > MAX_FREQUENCY_CORRECTION) {
+    fFrequencyCorrection = MAX_FREQUENCY_CORRECTION;
+  } else if (fFrequencyCorrection < -MAX_FREQUENCY_CORRECTION) {
+    fFrequencyCorrection = -MAX_FREQUENCY_CORRECTION;
+  }
+}
+
+struct timeval AudioClock::presentationTime(unsigned numBytes) {
+  if (!fIsSynced) noteCaptureTime(monotonicNow()); // we have nothing better
+
+  double t = fNextTime + fDomainOffset;
+  fNextTime += numBytes*fSecondsPerByte*(1.0 + fFrequencyCorrection);
+
+  struct timeval result;
+  result.tv_sec = (long)floor(t);
+  result.tv_usec = (long)((t - result.tv_sec)*1000000.0);
+  if (result.tv_usec >= 1000000) { // because of rounding
+    ++result.tv_sec;
+    result.tv_usec -= 1000000;
+  }
+  return result;
+}
+
+void AudioClock::resync() {
+  if (fIsSynced) ++fNumResyncs;
+  fIsSynced = False;
+}
+
+void AudioClock::noteVideoTimestamp(struct timeval const& timestamp) {
+  double offset = timestamp.tv_sec + timestamp.tv_usec/1000000.0 - monotonicNow();
+  if (fabs(offset - fDomainOffset) > MAX_DOMAIN_OFFSET_STEP) {
+    // The video device's clock was stepped, so follow it:
+    fDomainOffset = offset;
+    return;
+  }
+
+  fDomainOffset += (offset - fDomainOffset)
+    *(offset > fDomainOffset ? DOMAIN_OFFSET_GAIN_UP : DOMAIN_OFFSET_GAIN_DOWN);
+}
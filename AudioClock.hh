@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A sample-accurate clock for captured audio.  Presentation times are derived
+// from the cumulative number of bytes captured, anchored to CLOCK_MONOTONIC,
+// and disciplined (by a PLL) to the measured capture times, and to the video
+// capture device's timestamps.
+// C++ header
+
+#ifndef _AUDIO_CLOCK_HH
+#define _AUDIO_CLOCK_HH
+
+#include <sys/time.h>
+#ifndef _BOOLEAN_HH
+#include <Boolean.hh>
+#endif
+
+class AudioClock {
+public:
+  AudioClock(unsigned bytesPerSecond);
+
+  // Used by whoever captures audio:
+  void noteCaptureTime(double captureTime);
+      // "captureTime" is the (CLOCK_MONOTONIC) time at which the next byte of
+      // audio data was captured, as measured by the caller (e.g., from the amount
+      // of data buffered by the device).  This needn't be called for every chunk.
+  struct timeval presentationTime(unsigned numBytes);
+      // returns the presentation time of the next "numBytes" bytes of audio data,
+      // and advances the clock past them
+  void resync(); // called after a discontinuity (e.g., an overrun) in the audio data
+
+  // Used by whoever captures video:
+  void setVideoClockIsMonotonic(Boolean isMonotonic);
+      // called (before audio capture starts) once we know which clock the video
+      // device timestamps its frames from: CLOCK_MONOTONIC, or "gettimeofday()"
+  void noteVideoTimestamp(struct timeval const& timestamp);
+      // "timestamp" is that of a video frame that was just dequeued
+
+  double frequencyCorrection() const { return fFrequencyCorrection; }
+      // the fractional amount by which the device's sample rate differs from nominal
+  double lastPhaseError() const { return fLastPhaseError; } // in seconds
+  unsigned numResyncs() const { return fNumResyncs; }
+
+  static double monotonicNow(); // the current CLOCK_MONOTONIC time, in seconds
+
+private:
+  double fSecondsPerByte;
+  Boolean fIsSynced;
+  double fNextTime; // the (CLOCK_MONOTONIC) time of the next byte of audio data
+  double fFrequencyCorrection;
+  double fLastPhaseError;
+  unsigned fNumResyncs;
+
+  // The difference between CLOCK_MONOTONIC and the presentation time domain
+  // (i.e., that of the video device's timestamps):
+  double fDomainOffset;
+};
+
+#endif
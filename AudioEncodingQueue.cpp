@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A per-stream queue that accumulates PCM audio from a source, has it encoded
+// a frame at a time (by a pool of worker threads, if "-encthreads" is given),
+// and hands the encoded frames back to the event loop in order.
+// Implementation
+
+#include "AudioEncodingQueue.hh"
+#include "PCMAccumulator.hh"
+#include "Options.hh"
+#include "Err.hh"
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+// The number of frames of each stream that can be queued for encoding (or be
+// encoded, but not yet delivered):
+#define ENCODING_QUEUE_DEPTH 4
+
+////////// AudioEncoderPool //////////
+
+// Worker threads that encode frames for all queues.  Each queue with frames to
+// encode is in a FIFO 'run queue'.  A worker takes the queue at its head,
+// encodes that queue's oldest unencoded frame, then puts the queue back at the
+// tail (if it has more).  So each queue's frames are encoded in order, by one
+// thread at a time (as the encoder's state requires), while different streams
+// are encoded in parallel, and fairly.
+
+class AudioEncoderPool {
+public:
+  static AudioEncoderPool* instance(UsageEnvironment& env);
+      // creates the pool the first time; returns NULL if we can't
+
+  void lock() { pthread_mutex_lock(&fMutex); }
+  void unlock() { pthread_mutex_unlock(&fMutex); }
+
+  // The following are called with the lock held:
+  void makeRunnable(AudioEncodingQueue* queue);
+  void removeRunnable(AudioEncodingQueue* queue);
+  void waitUntilIdle(AudioEncodingQueue* queue);
+
+private:
+  AudioEncoderPool();
+
+  static void* workerMain(void* clientData);
+  void workerLoop();
+
+private:
+  pthread_mutex_t fMutex;
+  pthread_cond_t fWorkCond; // signaled when a queue becomes runnable
+  pthread_cond_t fIdleCond; // broadcast when a frame has been encoded
+  AudioEncodingQueue* fRunHead;
+  AudioEncodingQueue* fRunTail;
+};
+
+static AudioEncoderPool* theAudioEncoderPool = NULL;
+
+AudioEncoderPool* AudioEncoderPool::instance(UsageEnvironment& env) {
+  if (theAudioEncoderPool == NULL) {
+    AudioEncoderPool* pool = new AudioEncoderPool;
+
+    // The workers run for as long as we do:
+    unsigned numThreads = 0;
+    for (unsigned i = 0; i < audioEncoderThreads; ++i) {
+      pthread_t thread;
+      if (pthread_create(&thread, NULL, workerMain, pool) != 0) break;
+      pthread_detach(thread);
+      ++numThreads;
+    }
+    if (numThreads < audioEncoderThreads) {
+      err(env) << "Failed to create audio encoder threads; created "
+	       << numThreads << " of " << audioEncoderThreads << "\n";
+    }
+    if (numThreads == 0) {
+      audioEncoderThreads = 0; // don't try again; encode within the event loop
+      delete pool;
+      return NULL;
+    }
+
+    theAudioEncoderPool = pool;
+  }
+
+  return theAudioEncoderPool;
+}
+
+AudioEncoderPool::AudioEncoderPool()
+  : fRunHead(NULL), fRunTail(NULL) {
+  pthread_mutex_init(&fMutex, NULL);
+  pthread_cond_init(&fWorkCond, NULL);
+  pthread_cond_init(&fIdleCond, NULL);
+}
+
+void AudioEncoderPool::makeRunnable(AudioEncodingQueue* queue) {
+  queue->fNextRunnable = NULL;
+  if (fRunTail == NULL) {
+    fRunHead = queue;
+  } else {
+    fRunTail->fNextRunnable = queue;
+  }
+  fRunTail = queue;
+  queue->fIsRunnable = True;
+  pthread_cond_signal(&fWorkCond);
+}
+
+void AudioEncoderPool::removeRunnable(AudioEncodingQueue* queue) {
+  if (!queue->fIsRunnable) return;
+
+  AudioEncodingQueue* prev = NULL;
+  for (AudioEncodingQueue* q = fRunHead; q != NULL; prev = q, q = q->fNextRunnable) {
+    if (q != queue) continue;
+
+    if (prev == NULL) fRunHead = q->fNextRunnable; else prev->fNextRunnable = q->fNextRunnable;
+    if (fRunTail == q) fRunTail = prev;
+    break;
+  }
+  queue->fIsRunnable = False;
+}
+
+void AudioEncoderPool::waitUntilIdle(AudioEncodingQueue* queue) {
+  while (queue->fIsBeingEncoded) pthread_cond_wait(&fIdleCond, &fMutex);
+}
+
+void* AudioEncoderPool::workerMain(void* clientData) {
+  ((AudioEncoderPool*)clientData)->workerLoop();
+  return NULL;
+}
+
+void AudioEncoderPool::workerLoop() {
+  lock();
+  while (1) {
+    while (fRunHead == NULL) pthread_cond_wait(&fWorkCond, &fMutex);
+
+    AudioEncodingQueue* queue = fRunHead;
+    fRunHead = queue->fNextRunnable;
+    if (fRunHead == NULL) fRunTail = NULL;
+    queue->fIsRunnable = False;
+    queue->fIsBeingEncoded = True;
+    AudioEncodingQueue::EncodingJob& job = queue->fJobs[queue->fNextToEncode];
+    unlock();
+
+    queue->encodeJob(job);
+
+    lock();
+    job.isDone = True;
+    queue->fNextToEncode = (queue->fNextToEncode + 1)%ENCODING_QUEUE_DEPTH;
+    queue->fIsBeingEncoded = False;
+    if (--queue->fNumToEncode > 0) makeRunnable(queue);
+    pthread_cond_broadcast(&fIdleCond);
+
+    // Tell the event loop (while we still hold the lock, so that the queue
+    // can't be deleted before we do so):
+    u_int64_t one = 1;
+    write(queue->fEventFd, &one, sizeof one);
+  }
+}
+
+
+////////// AudioEncodingQueue //////////
+
+AudioEncodingQueue
+::AudioEncodingQueue(UsageEnvironment& env, FramedSource* pcmSource,
+		     unsigned bytesPerFrame, double microsecondsPerByte,
+		     unsigned numOverlapFrames, unsigned maxEncodedFrameSize,
+		     AudioEncodeFunc* encodeFunc, void* encoderData)
+  : fEnv(env), fPCMSource(pcmSource),
+    fEncodeFunc(encodeFunc), fEncoderData(encoderData),
+    fMaxEncodedFrameSize(maxEncodedFrameSize),
+    fAfterFunc(NULL), fAfterClientData(NULL),
+    fOnCloseFunc(NULL), fOnCloseClientData(NULL),
+    fIsActive(False), fIsAwaitingFrame(False), fReadIsPending(False),
+    fHead(0), fNumJobs(0), fNextToEncode(0), fNumToEncode(0),
+    fPool(NULL), fEventFd(-1),
+    fIsBeingEncoded(False), fIsRunnable(False), fNextRunnable(NULL) {
+  fInputSamples
+    = new PCMAccumulator(bytesPerFrame, microsecondsPerByte, numOverlapFrames);
+
+  fJobs = new EncodingJob[ENCODING_QUEUE_DEPTH];
+  for (unsigned i = 0; i < ENCODING_QUEUE_DEPTH; ++i) {
+    fJobs[i].output = new unsigned char[fMaxEncodedFrameSize];
+    fJobs[i].isDone = False;
+  }
+
+  if (audioEncoderThreads > 0) {
+    fEventFd = eventfd(0, EFD_NONBLOCK);
+    if (fEventFd < 0) {
+      err(env) << "eventfd() failed; encoding audio within the event loop\n";
+    } else {
+      fPool = AudioEncoderPool::instance(env);
+    }
+
+    if (fPool == NULL) {
+      if (fEventFd >= 0) ::close(fEventFd);
+      fEventFd = -1;
+    } else {
+      env.taskScheduler().turnOnBackgroundReadHandling(fEventFd,
+	    (TaskScheduler::BackgroundHandlerProc*)&encodingCompletionHandler, this);
+    }
+  }
+}
+
+AudioEncodingQueue::~AudioEncodingQueue() {
+  if (fPool != NULL) {
+    // Make sure that no worker is using (or will use) us:
+    fPool->lock();
+    fPool->removeRunnable(this);
+    fPool->waitUntilIdle(this);
+    fPool->unlock();
+
+    fEnv.taskScheduler().turnOffBackgroundReadHandling(fEventFd);
+    ::close(fEventFd);
+  }
+
+  for (unsigned i = 0; i < ENCODING_QUEUE_DEPTH; ++i) delete[] fJobs[i].output;
+  delete[] fJobs;
+  delete fInputSamples;
+}
+
+void AudioEncodingQueue
+::getNextEncodedFrame(afterEncodingFunc* afterFunc, void* afterClientData,
+		      onCloseFunc* onClose, void* onCloseClientData) {
+  fAfterFunc = afterFunc; fAfterClientData = afterClientData;
+  fOnCloseFunc = onClose; fOnCloseClientData = onCloseClientData;
+  fIsActive = fIsAwaitingFrame = True;
+
+  process();
+}
+
+void AudioEncodingQueue
+::deliverFrame(unsigned char* to, unsigned maxSize, unsigned& frameSize,
+	       unsigned& numTruncatedBytes, struct timeval& presentationTime) {
+  EncodingJob& job = fJobs[fHead];
+  if (job.frameSize > maxSize) {
+    // Our reader hasn't given us enough space for the frame:
+    frameSize = maxSize;
+    numTruncatedBytes = job.frameSize - maxSize;
+  } else {
+    frameSize = job.frameSize;
+    numTruncatedBytes = 0;
+  }
+  memcpy(to, job.output, frameSize);
+  presentationTime = job.presentationTime;
+
+  // The job's slot, and its PCM, can now be reused:
+  if (fPool != NULL) fPool->lock();
+  job.isDone = False;
+  fHead = (fHead + 1)%ENCODING_QUEUE_DEPTH;
+  --fNumJobs;
+  if (fPool != NULL) fPool->unlock();
+  fInputSamples->releaseFrame();
+}
+
+void AudioEncodingQueue::stopGettingFrames() {
+  fIsActive = fIsAwaitingFrame = False;
+  if (fReadIsPending) {
+    fPCMSource->stopGettingFrames();
+    fReadIsPending = False;
+  }
+}
+
+void AudioEncodingQueue::process() {
+  // Queue whatever complete frames of PCM we have for encoding:
+  submitFrames();
+
+  // Read more PCM, if we have room for it (even if our reader isn't waiting,
+  // so that encoding can proceed meanwhile):
+  if (fIsActive && !fReadIsPending) {
+    fInputSamples->prepareToWrite();
+    if (fInputSamples->bytesFree() > 0) {
+      fReadIsPending = True;
+      fPCMSource->getNextFrame(fInputSamples->writePtr(), fInputSamples->bytesFree(),
+			       afterGettingPCM, this,
+			       fOnCloseFunc, fOnCloseClientData);
+      // (Note that this may have already called us again.)
+    }
+  }
+
+  // If our reader is waiting, and our oldest frame has been encoded, deliver it:
+  if (fIsAwaitingFrame && haveEncodedFrame()) {
+    fIsAwaitingFrame = False;
+    (*fAfterFunc)(fAfterClientData);
+  }
+}
+
+void AudioEncodingQueue::submitFrames() {
+  if (fPool != NULL) fPool->lock();
+  while (fNumJobs < ENCODING_QUEUE_DEPTH && fInputSamples->haveFrame()) {
+    EncodingJob& job = fJobs[(fHead + fNumJobs)%ENCODING_QUEUE_DEPTH];
+    job.overlap = fInputSamples->overlapPtr();
+    job.frame = fInputSamples->framePtr();
+    job.presentationTime = fInputSamples->presentationTime();
+    fInputSamples->consumeFrame(True/*hold, until delivered*/);
+    ++fNumJobs;
+
+    if (fPool == NULL) {
+      encodeJob(job);
+      job.isDone = True;
+    } else {
+      ++fNumToEncode;
+      if (!fIsRunnable && !fIsBeingEncoded) fPool->makeRunnable(this);
+    }
+  }
+  if (fPool != NULL) fPool->unlock();
+}
+
+void AudioEncodingQueue::encodeJob(EncodingJob& job) {
+  job.frameSize = (*fEncodeFunc)(fEncoderData, job.overlap, job.frame,
+				 job.output, fMaxEncodedFrameSize);
+}
+
+Boolean AudioEncodingQueue::haveEncodedFrame() {
+  if (fNumJobs == 0) return False;
+  if (fPool == NULL) return fJobs[fHead].isDone;
+
+  fPool->lock();
+  Boolean isDone = fJobs[fHead].isDone;
+  fPool->unlock();
+  return isDone;
+}
+
+void AudioEncodingQueue
+::afterGettingPCM(void* clientData, unsigned frameSize,
+		  unsigned /*numTruncatedBytes*/,
+		  struct timeval presentationTime,
+		  unsigned /*durationInMicroseconds*/) {
+  AudioEncodingQueue* queue = (AudioEncodingQueue*)clientData;
+  queue->fReadIsPending = False;
+  queue->fInputSamples->addData(frameSize, presentationTime);
+  queue->process();
+}
+
+void AudioEncodingQueue
+::encodingCompletionHandler(AudioEncodingQueue* queue, int /*mask*/) {
+  // Reset our event fd; the jobs themselves tell us what's been done:
+  u_int64_t count;
+  read(queue->fEventFd, &count, sizeof count);
+  queue->process();
+}
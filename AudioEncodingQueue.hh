@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A per-stream queue that accumulates PCM audio from a source, has it encoded
+// a frame at a time (by a pool of worker threads, if "-encthreads" is given),
+// and hands the encoded frames back to the event loop in order.
+// C++ header
+
+#ifndef _AUDIO_ENCODING_QUEUE_HH
+#define _AUDIO_ENCODING_QUEUE_HH
+
+#include "FramedSource.hh"
+
+class PCMAccumulator;
+class AudioEncoderPool;
+
+// Encodes one frame of PCM (preceded by the encoder's overlap, if any) into
+// "to", returning the encoded size.  When encoding is done by worker threads,
+// this is called from one of them, but never for two frames of one queue at once:
+typedef unsigned AudioEncodeFunc(void* encoderData,
+				 unsigned char* overlap, unsigned char* frame,
+				 unsigned char* to, unsigned maxSize);
+
+class AudioEncodingQueue {
+public:
+  AudioEncodingQueue(UsageEnvironment& env, FramedSource* pcmSource,
+		     unsigned bytesPerFrame, double microsecondsPerByte,
+		     unsigned numOverlapFrames, unsigned maxEncodedFrameSize,
+		     AudioEncodeFunc* encodeFunc, void* encoderData);
+  virtual ~AudioEncodingQueue(); // waits for any frame that's being encoded
+
+  typedef void (afterEncodingFunc)(void* clientData);
+  typedef void (onCloseFunc)(void* clientData);
+  void getNextEncodedFrame(afterEncodingFunc* afterFunc, void* afterClientData,
+			   onCloseFunc* onClose, void* onCloseClientData);
+      // "afterFunc" is called (from the event loop) once the oldest frame that
+      // we haven't yet delivered has been encoded; it then calls:
+  void deliverFrame(unsigned char* to, unsigned maxSize, unsigned& frameSize,
+		    unsigned& numTruncatedBytes, struct timeval& presentationTime);
+  void stopGettingFrames();
+
+private:
+  struct EncodingJob {
+    unsigned char* overlap;
+    unsigned char* frame;
+    struct timeval presentationTime;
+    unsigned char* output;
+    unsigned frameSize;
+    Boolean isDone;
+  };
+
+  void process();
+  void submitFrames();
+  void encodeJob(EncodingJob& job);
+  Boolean haveEncodedFrame();
+
+  static void afterGettingPCM(void* clientData, unsigned frameSize,
+			      unsigned numTruncatedBytes,
+			      struct timeval presentationTime,
+			      unsigned durationInMicroseconds);
+  static void encodingCompletionHandler(AudioEncodingQueue* queue, int mask);
+
+private:
+  friend class AudioEncoderPool;
+  UsageEnvironment& fEnv;
+  FramedSource* fPCMSource;
+  PCMAccumulator* fInputSamples;
+  AudioEncodeFunc* fEncodeFunc;
+  void* fEncoderData;
+  unsigned fMaxEncodedFrameSize;
+
+  afterEncodingFunc* fAfterFunc; void* fAfterClientData;
+  onCloseFunc* fOnCloseFunc; void* fOnCloseClientData;
+  Boolean fIsActive, fIsAwaitingFrame, fReadIsPending;
+
+  // A ring of jobs, oldest first.  When encoding is done by "fPool", the ring,
+  // and the fields that follow, are protected by the pool's lock:
+  EncodingJob* fJobs;
+  unsigned fHead, fNumJobs, fNextToEncode, fNumToEncode;
+  AudioEncoderPool* fPool; // NULL if we encode within the event loop
+  int fEventFd; // written by the pool each time it finishes one of our jobs
+  Boolean fIsBeingEncoded, fIsRunnable;
+  AudioEncodingQueue* fNextRunnable; // in the pool's run queue
+};
+
+#endif
@@ -25,8 +25,10 @@
 #include "MPEGAudioEncoder.hh"
 #include "AMRAudioEncoder.hh"
 #include "AACAudioEncoder.hh"
+#include "BitrateController.hh"
 
-FramedSource* createAudioSource(UsageEnvironment& env, FramedSource* pcmSource) {
+FramedSource* createAudioSource(UsageEnvironment& env, FramedSource* pcmSource,
+				BitrateController* bitrateController) {
   FramedSource* audioSource;
 
   // Add in any filter necessary to transform the data prior to streaming:
@@ -50,12 +52,17 @@ FramedSource* createAudioSource(UsageEnvironment& env, FramedSource* pcmSource)
 		  audioNumChannels, audioSamplingFrequency, audioOutputBitrate/1000);
   } else if (audioFormat == AFMT_AMR) { // stream AMR audio
     // Create a software filter that will encode the PCM audio source to AMR:
-    audioSource = AMRAudioEncoder::createNew(env, pcmSource, audioNumChannels);
+    AMRAudioEncoder* amrEncoder
+      = AMRAudioEncoder::createNew(env, pcmSource, audioNumChannels, audioAMRMode);
+    if (bitrateController != NULL) bitrateController->addAudioEncoder(amrEncoder);
+    audioSource = amrEncoder;
   } else { // AFMT_AAC: stream AAC audio
     // Create a software filter that will encode the PCM audio source to AAC:
-    audioSource = AACAudioEncoder
+    AACAudioEncoder* aacEncoder = AACAudioEncoder
       ::createNew(env, pcmSource,
 		  audioNumChannels, audioSamplingFrequency, audioOutputBitrate/1000);
+    if (bitrateController != NULL) bitrateController->addAudioEncoder(aacEncoder);
+    audioSource = aacEncoder;
   }
 
   return audioSource;
@@ -24,7 +24,11 @@
 
 #include <liveMedia.hh>
 
-FramedSource* createAudioSource(UsageEnvironment& env, FramedSource* pcmSource);
+class BitrateController; // forward
+
+FramedSource* createAudioSource(UsageEnvironment& env, FramedSource* pcmSource,
+				BitrateController* bitrateController = NULL);
+    // If "bitrateController" is non-NULL, it also controls any audio encoder's bitrate
 
 RTPSink* createAudioRTPSink(UsageEnvironment& env, Groupsock* rtpGroupsockAudio,
 			    unsigned char rtpPayloadTypeIfDynamic = 96);
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Adapts the video encoder's (and AAC or AMR audio encoder's) bitrate to the packet
+// loss and jitter that our receivers report in their RTCP receiver reports.
+// Implementation
+
+#include "BitrateController.hh"
+#include "WISInput.hh"
+#include "AACAudioEncoder.hh"
+#include "AMRAudioEncoder.hh"
+#include "Options.hh"
+
+////////// MonitoredMediumSet implementation //////////
+
+MonitoredMediumSet::MonitoredMediumSet()
+  : fNumNames(0) {
+}
+
+MonitoredMediumSet::~MonitoredMediumSet() {
+  for (unsigned i = 0; i < fNumNames; ++i) delete[] fNames[i];
+}
+
+void MonitoredMediumSet::add(Medium* medium) {
+  if (medium == NULL || fNumNames == MAX_MONITORED_MEDIA) return;
+  fNames[fNumNames++] = strDup(medium->name());
+}
+
+Medium* MonitoredMediumSet::next(UsageEnvironment& env, unsigned& index) {
+  while (index < fNumNames) {
+    Medium* medium;
+    if (Medium::lookupByName(env, fNames[index], medium)) {
+      ++index;
+      return medium;
+    }
+
+    // This medium has since been closed.  Forget it:
+    delete[] fNames[index];
+    fNames[index] = fNames[--fNumNames];
+  }
+  return NULL;
+}
+
+
+////////// BitrateController implementation //////////
+
+// How often (in seconds) we look for new receiver reports:
+#define CHECK_INTERVAL 2
+
+// We reduce our bitrates if any receiver reports more packet loss (or jitter)
+// than this:
+#define HIGH_LOSS_FRACTION 0.05
+#define HIGH_JITTER 0.030 // seconds
+
+// We increase our bitrates (by half a step) after this many consecutive checks in
+// which receivers reported at most this much packet loss (and little jitter):
+#define LOW_LOSS_FRACTION 0.01
+#define NUM_GOOD_CHECKS_BEFORE_INCREASE 3
+
+BitrateController* BitrateController::createNew(UsageEnvironment& env, WISInput& input) {
+  return new BitrateController(env, input);
+}
+
+BitrateController::BitrateController(UsageEnvironment& env, WISInput& input)
+  : Medium(env),
+    fInput(input), fCheckTask(NULL),
+    fVideoBitrate(videoBitrate), fAudioBitrate(audioOutputBitrate), fNumGoodChecks(0),
+    fLastLossFraction(0.0), fLastJitter(0.0), fNumDecreases(0), fNumIncreases(0) {
+  gettimeofday(&fLastCheckTime, NULL);
+
+  // Begin within our limits:
+  if (fVideoBitrate > rateControlMaxVideoBitrate) {
+    fVideoBitrate = rateControlMaxVideoBitrate;
+    fInput.changeVideoBitrate(fVideoBitrate);
+  }
+
+  fCheckTask = env.taskScheduler().scheduleDelayedTask(CHECK_INTERVAL*1000000,
+						       checkReceiverReports, this);
+}
+
+BitrateController::~BitrateController() {
+  envir().taskScheduler().unscheduleDelayedTask(fCheckTask);
+}
+
+void BitrateController::addRTPSink(RTPSink* rtpSink) {
+  fRTPSinks.add(rtpSink);
+}
+
+void BitrateController::addAudioEncoder(AACAudioEncoder* encoder) {
+  fAudioEncoders.add(encoder);
+  if (fAudioBitrate != audioOutputBitrate) encoder->setOutputKbps(fAudioBitrate/1000);
+}
+
+void BitrateController::addAudioEncoder(AMRAudioEncoder* encoder) {
+  fAudioEncoders.add(encoder);
+  if (fAudioBitrate != audioOutputBitrate) encoder->setOutputBitrate(fAudioBitrate);
+}
+
+void BitrateController::printStatistics(UsageEnvironment& env) {
+  env << "Bitrate control: video " << fVideoBitrate << " bps";
+  if (audioFormat == AFMT_AAC || audioFormat == AFMT_AMR) {
+    env << ", audio " << fAudioBitrate << " bps";
+  }
+  env << "; " << fNumDecreases << " decreases, " << fNumIncreases << " increases"
+      << " (last report: " << fLastLossFraction*100 << "% loss, "
+      << fLastJitter*1000 << " ms jitter)\n";
+}
+
+void BitrateController::checkReceiverReports(void* clientData) {
+  ((BitrateController*)clientData)->checkReceiverReports1();
+}
+
+static Boolean isAtOrAfter(struct timeval const& t1, struct timeval const& t2) {
+  return t1.tv_sec > t2.tv_sec || (t1.tv_sec == t2.tv_sec && t1.tv_usec >= t2.tv_usec);
+}
+
+void BitrateController::checkReceiverReports1() {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+
+  // Find the worst loss and jitter in the reports that have arrived since our
+  // last check.  (We look at every receiver of every stream, because they all
+  // share our uplink.)
+  Boolean haveReport = False;
+  double lossFraction = 0.0, jitter = 0.0;
+  unsigned index = 0;
+  Medium* medium;
+  while ((medium = fRTPSinks.next(envir(), index)) != NULL) {
+    RTPSink* rtpSink = (RTPSink*)medium;
+    RTPTransmissionStatsDB::Iterator iter(rtpSink->transmissionStatsDB());
+    RTPTransmissionStats* stats;
+    while ((stats = iter.next()) != NULL) {
+      if (!isAtOrAfter(stats->lastTimeReceived(), fLastCheckTime)) continue; // old news
+      haveReport = True;
+
+      double receiverLossFraction = stats->packetLossRatio()/256.0;
+      if (receiverLossFraction > lossFraction) lossFraction = receiverLossFraction;
+      double receiverJitter = (double)stats->jitter()/rtpSink->rtpTimestampFrequency();
+      if (receiverJitter > jitter) jitter = receiverJitter;
+    }
+  }
+  fLastCheckTime = now;
+
+  if (haveReport) {
+    fLastLossFraction = lossFraction;
+    fLastJitter = jitter;
+
+    double step = rateControlStepPercent/100.0;
+    if (lossFraction > HIGH_LOSS_FRACTION || jitter > HIGH_JITTER) {
+      // Our receivers' paths look congested.  Back off, in proportion to the loss
+      // (but by at least half a step, and at most a step):
+      double decrease = lossFraction;
+      if (decrease < step/2) decrease = step/2;
+      if (decrease > step) decrease = step;
+      changeBitrates(1.0 - decrease);
+      fNumGoodChecks = 0;
+    } else if (lossFraction <= LOW_LOSS_FRACTION && jitter <= HIGH_JITTER/2) {
+      // Probe for more bandwidth, but only slowly:
+      if (++fNumGoodChecks >= NUM_GOOD_CHECKS_BEFORE_INCREASE) {
+	changeBitrates(1.0 + step/2);
+	fNumGoodChecks = 0;
+      }
+    } else {
+      fNumGoodChecks = 0; // hold steady
+    }
+  }
+
+  fCheckTask = envir().taskScheduler().scheduleDelayedTask(CHECK_INTERVAL*1000000,
+							   checkReceiverReports, this);
+}
+
+static unsigned scaleBitrate(unsigned bitrate, double factor,
+			     unsigned minBitrate, unsigned maxBitrate) {
+  double newBitrate = bitrate*factor;
+  if (newBitrate < minBitrate) return minBitrate;
+  if (newBitrate > maxBitrate) return maxBitrate;
+  return (unsigned)newBitrate;
+}
+
+void BitrateController::changeBitrates(double factor) {
+  Boolean changed = False;
+
+  // The video encoder applies its new bitrate at the start of its next GOP:
+  unsigned newVideoBitrate = scaleBitrate(fVideoBitrate, factor,
+					  rateControlMinVideoBitrate, rateControlMaxVideoBitrate);
+  if (newVideoBitrate != fVideoBitrate) {
+    fVideoBitrate = newVideoBitrate;
+    fInput.changeVideoBitrate(fVideoBitrate);
+    changed = True;
+  }
+
+  // Our audio encoders apply theirs at their next frame:
+  if (audioFormat == AFMT_AAC || audioFormat == AFMT_AMR) {
+    unsigned newAudioBitrate = scaleBitrate(fAudioBitrate, factor,
+					    rateControlMinAudioBitrate, audioOutputBitrate);
+    if (newAudioBitrate != fAudioBitrate) {
+      fAudioBitrate = newAudioBitrate;
+      unsigned index = 0;
+      Medium* medium;
+      while ((medium = fAudioEncoders.next(envir(), index)) != NULL) {
+	if (audioFormat == AFMT_AAC) {
+	  ((AACAudioEncoder*)medium)->setOutputKbps(fAudioBitrate/1000);
+	} else {
+	  ((AMRAudioEncoder*)medium)->setOutputBitrate(fAudioBitrate);
+	}
+      }
+      changed = True;
+    }
+  }
+
+  if (changed) {
+    if (factor < 1.0) ++fNumDecreases; else ++fNumIncreases;
+  }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Adapts the video encoder's (and AAC or AMR audio encoder's) bitrate to the packet
+// loss and jitter that our receivers report in their RTCP receiver reports.
+// C++ header
+
+#ifndef _BITRATE_CONTROLLER_HH
+#define _BITRATE_CONTROLLER_HH
+
+#include <liveMedia.hh>
+
+class WISInput; // forward
+class AACAudioEncoder; // forward
+class AMRAudioEncoder; // forward
+
+// A set of media (e.g., "RTPSink"s) that may be closed by someone else at any time.
+// (We remember them by name, and forget each once it can no longer be looked up.)
+#define MAX_MONITORED_MEDIA 32
+class MonitoredMediumSet {
+public:
+  MonitoredMediumSet();
+  virtual ~MonitoredMediumSet();
+
+  void add(Medium* medium);
+  Medium* next(UsageEnvironment& env, unsigned& index);
+      // returns the next medium (starting from "index" 0) that still exists;
+      // NULL when there are no more
+
+private:
+  char* fNames[MAX_MONITORED_MEDIA];
+  unsigned fNumNames;
+};
+
+class BitrateController: public Medium {
+public:
+  static BitrateController* createNew(UsageEnvironment& env, WISInput& input);
+
+  void addRTPSink(RTPSink* rtpSink);
+      // an RTP sink (for our input's video and/or audio) whose receivers we listen to
+  void addAudioEncoder(AACAudioEncoder* encoder);
+  void addAudioEncoder(AMRAudioEncoder* encoder);
+      // an audio encoder (fed by our input) whose bitrate we also control
+      // (an AMR encoder's is that of the highest mode that fits)
+
+  void printStatistics(UsageEnvironment& env);
+
+protected:
+  BitrateController(UsageEnvironment& env, WISInput& input); // called only by createNew()
+  virtual ~BitrateController();
+
+private:
+  static void checkReceiverReports(void* clientData);
+  void checkReceiverReports1();
+  void changeBitrates(double factor);
+
+private:
+  WISInput& fInput;
+  TaskToken fCheckTask;
+  MonitoredMediumSet fRTPSinks, fAudioEncoders;
+  struct timeval fLastCheckTime;
+  unsigned fVideoBitrate, fAudioBitrate; // in bps
+  unsigned fNumGoodChecks; // since we last changed the bitrates
+  double fLastLossFraction, fLastJitter;
+  unsigned fNumDecreases, fNumIncreases;
+};
+
+#endif
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A replacement for the GO7007 capture hardware: replays pre-recorded video
+// elementary streams and raw PCM audio files, or else generates a synthetic
+// MPEG-1 video pattern and audio tone.
+// Implementation
+
+#include "CaptureReplayer.hh"
+#include "Options.hh"
+#include "Err.hh"
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+CaptureReplayer* CaptureReplayer
+::createNew(UsageEnvironment& env, char const* videoFileName, char const* audioFileName,
+	    Boolean synthetic) {
+  CaptureReplayer* replayer = new CaptureReplayer;
+  do {
+    if (videoFileName != NULL) {
+      if (!replayer->openVideoFile(env, videoFileName)) break;
+    } else if (synthetic && videoFormat != VFMT_NONE) {
+      replayer->generateSyntheticVideo();
+    }
+
+    if (audioFileName != NULL) {
+      if (!replayer->openAudioFile(env, audioFileName)) break;
+    } else if (synthetic && audioFormat != AFMT_NONE) {
+      replayer->fSyntheticAudio = True;
+    }
+
+    return replayer;
+  } while (0);
+
+  // An error occurred:
+  delete replayer;
+  return NULL;
+}
+
+CaptureReplayer::CaptureReplayer()
+  : fVideoData(NULL), fVideoDataSize(0), fVideoDataIsMapped(False), fVideoOffset(0),
+    fSyntheticFrameOffsets(NULL), fNumSyntheticFrames(0), fNextSyntheticFrame(0),
+    fAudioData(NULL), fAudioDataSize(0), fAudioOffset(0),
+    fSyntheticAudio(False), fTonePhase(0.0) {
+}
+
+CaptureReplayer::~CaptureReplayer() {
+  if (fVideoDataIsMapped) {
+    munmap(fVideoData, fVideoDataSize);
+  } else {
+    delete[] fVideoData;
+  }
+  delete[] fSyntheticFrameOffsets;
+  if (fAudioData != NULL) munmap(fAudioData, fAudioDataSize);
+}
+
+static unsigned char* mapFile(UsageEnvironment& env, char const* fileName,
+			      unsigned& fileSize) {
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    err(env) << "Unable to open \"" << fileName << "\": " << strerror(errno) << "\n";
+    return NULL;
+  }
+
+  unsigned char* data = NULL;
+  struct stat sb;
+  if (fstat(fd, &sb) < 0 || sb.st_size == 0 || sb.st_size > 0x7FFFFFFF) {
+    err(env) << "\"" << fileName << "\" is empty, or too large\n";
+  } else {
+    fileSize = (unsigned)sb.st_size;
+    data = (unsigned char*)mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      err(env) << "Unable to map \"" << fileName << "\": " << strerror(errno) << "\n";
+      data = NULL;
+    }
+  }
+  close(fd);
+  return data;
+}
+
+Boolean CaptureReplayer::openVideoFile(UsageEnvironment& env, char const* fileName) {
+  fVideoData = mapFile(env, fileName, fVideoDataSize);
+  if (fVideoData == NULL) return False;
+  fVideoDataIsMapped = True;
+
+  // Check that the file looks like the kind of stream that we're going to deliver:
+  Boolean ok;
+  if (videoFormat == VFMT_MJPEG) {
+    ok = fVideoDataSize >= 2 && fVideoData[0] == 0xFF && fVideoData[1] == 0xD8;
+  } else {
+    ok = fVideoDataSize >= 4
+      && fVideoData[0] == 0 && fVideoData[1] == 0 && fVideoData[2] == 1;
+  }
+  if (!ok) {
+    err(env) << "\"" << fileName << "\" doesn't begin with a "
+	     << (videoFormat == VFMT_MJPEG ? "JPEG SOI marker" : "MPEG start code") << "\n";
+    return False;
+  }
+
+  return True;
+}
+
+Boolean CaptureReplayer::openAudioFile(UsageEnvironment& env, char const* fileName) {
+  fAudioData = mapFile(env, fileName, fAudioDataSize);
+  if (fAudioData == NULL) return False;
+
+  // Use only whole sample frames:
+  unsigned const bytesPerFrame = audioCaptureNumChannels*2;
+  if (fAudioDataSize < bytesPerFrame) {
+    err(env) << "\"" << fileName << "\" is too small to contain any audio\n";
+    return False;
+  }
+  fAudioDataSize -= fAudioDataSize%bytesPerFrame;
+
+  return True;
+}
+
+void CaptureReplayer::nextVideoFrame(unsigned char*& frameData, unsigned& frameSize) {
+  if (fSyntheticFrameOffsets != NULL) {
+    unsigned i = fNextSyntheticFrame;
+    frameData = &fVideoData[fSyntheticFrameOffsets[i]];
+    frameSize = fSyntheticFrameOffsets[i+1] - fSyntheticFrameOffsets[i];
+    fNextSyntheticFrame = (i+1)%fNumSyntheticFrames;
+    return;
+  }
+
+  // Find the end of the frame that begins at "fVideoOffset":
+  unsigned start = fVideoOffset;
+  unsigned end;
+  switch (videoFormat) {
+  case VFMT_MJPEG: {
+    // The frame ends with an EOI marker.  (The next one begins with a SOI marker.)
+    for (end = start + 2; end + 1 < fVideoDataSize; ++end) {
+      if (fVideoData[end] == 0xFF && fVideoData[end+1] == 0xD9) break;
+    }
+    end = end + 2 < fVideoDataSize ? end + 2 : fVideoDataSize;
+    while (end + 1 < fVideoDataSize
+	   && !(fVideoData[end] == 0xFF && fVideoData[end+1] == 0xD8)) ++end;
+    break;
+  }
+  case VFMT_MPEG4: {
+    end = findMPEGFrameEnd(start, 0xB6/*VOP*/);
+    break;
+  }
+  default: {
+    end = findMPEGFrameEnd(start, 0x00/*picture*/);
+    break;
+  }
+  }
+  if (end + 1 >= fVideoDataSize) end = fVideoDataSize;
+
+  frameData = &fVideoData[start];
+  frameSize = end - start;
+  fVideoOffset = end < fVideoDataSize ? end : 0; // loop at the end of the file
+}
+
+unsigned CaptureReplayer::findMPEGFrameEnd(unsigned start, unsigned char pictureStartCode) const {
+  // Like the GO7007, we deliver each picture along with the headers that precede it,
+  // so the frame ends at the first header (or picture) start code after a picture:
+  Boolean havePicture = False;
+  for (unsigned i = start; i + 3 < fVideoDataSize; ++i) {
+    if (fVideoData[i] != 0 || fVideoData[i+1] != 0 || fVideoData[i+2] != 1) continue;
+
+    unsigned char code = fVideoData[i+3];
+    Boolean isHeaderOrPicture;
+    if (videoFormat == VFMT_MPEG4) {
+      isHeaderOrPicture = code <= 0x2F/*VO or VOL*/ || code == 0xB0/*VOS*/
+	|| code == 0xB3/*GOV*/ || code == 0xB6/*VOP*/;
+    } else {
+      isHeaderOrPicture = code == 0xB3/*sequence*/ || code == 0xB8/*GOP*/
+	|| code == 0x00/*picture*/;
+    }
+    if (isHeaderOrPicture && havePicture) return i;
+    if (code == pictureStartCode) havePicture = True;
+    i += 3;
+  }
+  return fVideoDataSize;
+}
+
+void CaptureReplayer::nextAudioChunk(unsigned char* to, unsigned size) {
+  if (fAudioData != NULL) {
+    while (size > 0) {
+      unsigned n = fAudioDataSize - fAudioOffset;
+      if (n > size) n = size;
+      memcpy(to, &fAudioData[fAudioOffset], n);
+      to += n; size -= n;
+      fAudioOffset = (fAudioOffset + n)%fAudioDataSize; // loop at the end of the file
+    }
+    return;
+  }
+
+  // Generate a 1 kHz tone, at -12 dBFS, in each channel:
+  short* samples = (short*)to;
+  unsigned numFrames = size/(audioCaptureNumChannels*2);
+  double const phaseIncrement = 2*M_PI*1000/audioCaptureSamplingFrequency;
+  for (unsigned i = 0; i < numFrames; ++i) {
+    short sample = (short)(8192*sin(fTonePhase));
+    for (unsigned c = 0; c < audioCaptureNumChannels; ++c) *samples++ = sample;
+    fTonePhase += phaseIncrement;
+    if (fTonePhase >= 2*M_PI) fTonePhase -= 2*M_PI;
+  }
+}
+
+
+////////// Synthetic MPEG-1 video generation //////////
+
+// We generate a short cycle of intra-coded MPEG-1 pictures (each preceded by a
+// sequence header and GOP header, so that any of them can be decoded on its own)
+// that show horizontal bands of gray, moving one macroblock row per picture.
+// Each picture is padded with user data to the size implied by the video bitrate,
+// so that the load on the rest of the pipeline is realistic.
+
+#define NUM_SYNTHETIC_FRAMES 8
+
+class BitWriter {
+public:
+  BitWriter(unsigned char* buf): fBuf(buf), fNumBits(0) {}
+
+  void putBits(unsigned value, unsigned numBits) {
+    while (numBits > 0) {
+      --numBits;
+      unsigned char& byte = fBuf[fNumBits/8];
+      unsigned char mask = 0x80>>(fNumBits%8);
+      if ((value>>numBits)&1) byte |= mask; else byte &=~ mask;
+      ++fNumBits;
+    }
+  }
+  void putStartCode(unsigned char code) {
+    while (fNumBits%8 != 0) putBits(0, 1); // stuffing
+    putBits(0x000001, 24);
+    putBits(code, 8);
+  }
+  unsigned numBytes() const { return (fNumBits+7)/8; }
+
+private:
+  unsigned char* fBuf;
+  unsigned fNumBits;
+};
+
+static unsigned char mpeg1FrameRateCode() {
+  static double const rates[] = {0, 24000.0/1001, 24, 25, 30000.0/1001, 30, 50, 60000.0/1001, 60};
+  double fps = videoFrameRateDenominator == 0 ? 30000.0/1001
+    : (double)videoFrameRateNumerator/videoFrameRateDenominator;
+  unsigned char best = 1;
+  for (unsigned char code = 2; code <= 8; ++code) {
+    if (fabs(rates[code] - fps) < fabs(rates[best] - fps)) best = code;
+  }
+  return best;
+}
+
+static void putLumaDCDifferential(BitWriter& bw, int diff) {
+  static unsigned const sizeCodes[] = {0x4, 0x0, 0x1, 0x5, 0x6, 0xE, 0x1E, 0x3E, 0x7E};
+  static unsigned const sizeCodeLengths[] = {3, 2, 2, 3, 3, 4, 5, 6, 7};
+  unsigned absDiff = diff < 0 ? -diff : diff;
+  unsigned size = 0;
+  while ((1u<<size) <= absDiff) ++size;
+  bw.putBits(sizeCodes[size], sizeCodeLengths[size]);
+  if (size > 0) bw.putBits(diff > 0 ? diff : diff + (1<<size) - 1, size);
+}
+
+void CaptureReplayer::generateSyntheticVideo() {
+  unsigned const mbWidth = (videoWidth+15)/16;
+  unsigned const mbHeight = (videoHeight+15)/16;
+  double fps = videoFrameRateDenominator == 0 ? 30000.0/1001
+    : (double)videoFrameRateNumerator/videoFrameRateDenominator;
+  unsigned const targetFrameSize = (unsigned)(videoBitrate/8/fps);
+  unsigned const maxFrameSize = mbWidth*mbHeight*8 + mbHeight*8 + 64 + targetFrameSize;
+
+  fNumSyntheticFrames = NUM_SYNTHETIC_FRAMES;
+  fVideoData = new unsigned char[fNumSyntheticFrames*maxFrameSize];
+  fSyntheticFrameOffsets = new unsigned[fNumSyntheticFrames+1];
+  unsigned offset = 0;
+  for (unsigned f = 0; f < fNumSyntheticFrames; ++f) {
+    fSyntheticFrameOffsets[f] = offset;
+    BitWriter bw(&fVideoData[offset]);
+
+    // Sequence header:
+    unsigned bitRateField = (videoBitrate+399)/400;
+    if (bitRateField == 0 || bitRateField > 0x3FFFE) bitRateField = 0x3FFFE;
+    bw.putStartCode(0xB3);
+    bw.putBits(videoWidth, 12);
+    bw.putBits(videoHeight, 12);
+    bw.putBits(1, 4); // pel_aspect_ratio: square
+    bw.putBits(mpeg1FrameRateCode(), 4);
+    bw.putBits(bitRateField, 18);
+    bw.putBits(1, 1); // marker
+    bw.putBits(112, 10); // vbv_buffer_size
+    bw.putBits(0, 3); // constrained_parameters_flag, and no quantizer matrices
+
+    // GOP header (a closed GOP, of just this picture):
+    bw.putStartCode(0xB8);
+    bw.putBits(0, 6); // drop_frame_flag, hours
+    bw.putBits(0, 6); // minutes
+    bw.putBits(1, 1); // marker
+    bw.putBits(0, 12); // seconds, pictures
+    bw.putBits(1, 1); // closed_gop
+    bw.putBits(0, 1); // broken_link
+
+    // Picture header:
+    bw.putStartCode(0x00);
+    bw.putBits(0, 10); // temporal_reference
+    bw.putBits(1, 3); // picture_coding_type: I
+    bw.putBits(0xFFFF, 16); // vbv_delay
+    bw.putBits(0, 1); // extra_bit_picture
+
+    // User data, to pad the picture to its target size:
+    unsigned sliceDataSize = mbWidth*mbHeight*41/8 + mbHeight*6;
+    unsigned headerSize = bw.numBytes() + 4;
+    if (targetFrameSize > headerSize + sliceDataSize) {
+      bw.putStartCode(0xB2);
+      for (unsigned i = headerSize + sliceDataSize; i < targetFrameSize; ++i) {
+	bw.putBits(0xFF, 8);
+      }
+    }
+
+    // One slice per macroblock row.  Each row's luminance is set by the DC
+    // differential of its first block; everything else continues from it:
+    for (unsigned row = 0; row < mbHeight; ++row) {
+      bw.putStartCode(row+1);
+      bw.putBits(8, 5); // quantizer_scale
+      bw.putBits(0, 1); // extra_bit_slice
+      int rowDiff = (int)((row + f)%8)*16 - 64;
+      for (unsigned col = 0; col < mbWidth; ++col) {
+	bw.putBits(1, 1); // macroblock_address_increment: 1
+	bw.putBits(1, 1); // macroblock_type: intra
+	for (unsigned b = 0; b < 4; ++b) {
+	  putLumaDCDifferential(bw, col == 0 && b == 0 ? rowDiff : 0);
+	  bw.putBits(0x2, 2); // end_of_block
+	}
+	for (unsigned b = 4; b < 6; ++b) {
+	  bw.putBits(0x0, 2); // chrominance DC size: 0
+	  bw.putBits(0x2, 2); // end_of_block
+	}
+      }
+    }
+    offset += bw.numBytes();
+  }
+  fSyntheticFrameOffsets[fNumSyntheticFrames] = offset;
+  fVideoDataSize = offset;
+}
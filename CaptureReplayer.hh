@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A replacement for the GO7007 capture hardware: replays pre-recorded video
+// elementary streams and raw PCM audio files, or else generates a synthetic
+// MPEG-1 video pattern and audio tone.
+// C++ header
+
+#ifndef _CAPTURE_REPLAYER_HH
+#define _CAPTURE_REPLAYER_HH
+
+#include <UsageEnvironment.hh>
+
+class CaptureReplayer {
+public:
+  static CaptureReplayer* createNew(UsageEnvironment& env,
+				    char const* videoFileName, char const* audioFileName,
+				    Boolean synthetic);
+      // If "synthetic", then we generate whatever (video or audio) isn't read from a file.
+      // Returns NULL (after reporting an error) on failure.
+  virtual ~CaptureReplayer();
+
+  Boolean hasVideo() const { return fVideoData != NULL; }
+  Boolean hasAudio() const { return fAudioData != NULL || fSyntheticAudio; }
+
+  void nextVideoFrame(unsigned char*& frameData, unsigned& frameSize);
+      // The frame remains valid for as long as we exist.  (Files are replayed in a loop.)
+  void nextAudioChunk(unsigned char* to, unsigned size);
+      // "size" must be a multiple of the audio frame size.  (Files are replayed in a loop.)
+
+private:
+  CaptureReplayer();
+
+  Boolean openVideoFile(UsageEnvironment& env, char const* fileName);
+  Boolean openAudioFile(UsageEnvironment& env, char const* fileName);
+  void generateSyntheticVideo();
+  unsigned findMPEGFrameEnd(unsigned start, unsigned char pictureStartCode) const;
+
+private:
+  // Video: either a memory-mapped file, or a set of generated frames:
+  unsigned char* fVideoData;
+  unsigned fVideoDataSize;
+  Boolean fVideoDataIsMapped;
+  unsigned fVideoOffset; // of the next frame
+  unsigned* fSyntheticFrameOffsets; // NULL unless our video is synthetic
+  unsigned fNumSyntheticFrames, fNextSyntheticFrame;
+
+  // Audio: either a memory-mapped file, or a generated tone:
+  unsigned char* fAudioData;
+  unsigned fAudioDataSize;
+  unsigned fAudioOffset;
+  Boolean fSyntheticAudio;
+  double fTonePhase;
+};
+
+#endif
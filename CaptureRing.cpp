@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A lock-free, single-producer/single-consumer ring of captured frame
+// descriptors, used to queue captured frames until the event loop delivers them
+// (possibly handing them over from a capture thread).
+// Implementation
+
+#include "CaptureRing.hh"
+#include <stddef.h>
+
+// "fHead" and "fTail" increase without bound (modulo 2^32); a slot's index is
+// its count modulo "fDepth".  A full memory barrier separates each access to a
+// slot from the update of the count that hands that slot to the other side.
+#define memoryBarrier() __sync_synchronize()
+
+CaptureRing::CaptureRing(unsigned depth, unsigned slotDataSize)
+  : fSlotData(NULL), fDepth(depth == 0 ? 1 : depth), fSlotDataSize(slotDataSize),
+    fHead(0), fTail(0), fHighWaterMark(0), fNumOverruns(0) {
+  fSlots = new CapturedFrame[fDepth];
+  if (fSlotDataSize > 0) fSlotData = new unsigned char[fDepth*fSlotDataSize];
+  for (unsigned i = 0; i < fDepth; ++i) {
+    fSlots[i].data = fSlotData == NULL ? NULL : &fSlotData[i*fSlotDataSize];
+    fSlots[i].size = 0;
+    fSlots[i].bufferIndex = -1;
+  }
+}
+
+CaptureRing::~CaptureRing() {
+  delete[] fSlotData;
+  delete[] fSlots;
+}
+
+CapturedFrame* CaptureRing::producerSlot() {
+  unsigned head = fHead;
+  if (head - fTail == fDepth) return NULL; // full
+  memoryBarrier(); // don't touch the slot until the consumer has finished with it
+
+  CapturedFrame* slot = &fSlots[head%fDepth];
+  if (fSlotData != NULL) slot->data = &fSlotData[(head%fDepth)*fSlotDataSize];
+  return slot;
+}
+
+void CaptureRing::produce() {
+  memoryBarrier(); // the slot's contents must be visible before the new "fHead"
+  unsigned occupancy = ++fHead - fTail;
+  if (occupancy > fHighWaterMark) fHighWaterMark = occupancy;
+}
+
+CapturedFrame* CaptureRing::consumerSlot() {
+  unsigned tail = fTail;
+  if (fHead == tail) return NULL; // empty
+  memoryBarrier(); // don't read the slot until we've seen that it was produced
+
+  return &fSlots[tail%fDepth];
+}
+
+void CaptureRing::consume() {
+  memoryBarrier(); // finish with the slot before handing it back to the producer
+  ++fTail;
+}
+
+unsigned CaptureRing::occupancy() const {
+  return fHead - fTail;
+}
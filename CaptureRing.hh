@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A lock-free, single-producer/single-consumer ring of captured frame
+// descriptors, used to queue captured frames until the event loop delivers them
+// (possibly handing them over from a capture thread).
+// C++ header
+
+#ifndef _CAPTURE_RING_HH
+#define _CAPTURE_RING_HH
+
+#include <sys/time.h>
+#ifndef _BOOLEAN_HH
+#include <Boolean.hh>
+#endif
+
+struct CapturedFrame {
+  unsigned char* data;
+  unsigned size;
+  struct timeval presentationTime;
+  int bufferIndex; // for video: the driver's buffer that holds "data"; otherwise -1
+};
+
+class CaptureRing {
+public:
+  CaptureRing(unsigned depth, unsigned slotDataSize = 0);
+      // If "slotDataSize" is non-zero, each slot gets its own data buffer of this size
+      // (for audio); otherwise, "data" must point to memory owned by someone else (video).
+  virtual ~CaptureRing();
+
+  unsigned depth() const { return fDepth; }
+  unsigned slotDataSize() const { return fSlotDataSize; }
+
+  // Used only by the producer:
+  CapturedFrame* producerSlot(); // returns NULL if the ring is full
+  void produce(); // publishes the slot returned by "producerSlot()"
+  void noteOverrun() { ++fNumOverruns; }
+
+  // Used only by the consumer:
+  CapturedFrame* consumerSlot(); // returns NULL if the ring is empty
+  void consume(); // releases the slot returned by "consumerSlot()"
+
+  // Used by anyone:
+  unsigned occupancy() const;
+  Boolean isFull() const { return occupancy() == fDepth; }
+  unsigned highWaterMark() const { return fHighWaterMark; }
+  unsigned numOverruns() const { return fNumOverruns; }
+
+private:
+  CapturedFrame* fSlots;
+  unsigned char* fSlotData;
+  unsigned fDepth, fSlotDataSize;
+  unsigned volatile fHead; // the next slot to be produced; written only by the producer
+  unsigned volatile fTail; // the next slot to be consumed; written only by the consumer
+  unsigned volatile fHighWaterMark, fNumOverruns; // written only by the producer
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "DarwinStreaming.hh"
 #include "Options.hh"
 #include "AudioRTPCommon.hh"
+#include "BitrateController.hh"
 #include "WISJPEGStreamSource.hh"
 #include "MPEG2TransportStreamAccumulator.hh"
 
@@ -52,7 +53,8 @@ void setupDarwinStreaming(UsageEnvironment& env, WISInput& inputDevice) {
   /******************audio***********************/
   if (audioFormat != AFMT_NONE) {
     // Create the audio source:
-    sourceAudio = createAudioSource(env, inputDevice.audioSource());
+    sourceAudio = createAudioSource(env, inputDevice.audioSource(),
+				    inputDevice.bitrateController());
 
     if (packageFormat != PFMT_TRANSPORT_STREAM) { // there's a separate RTP stream for audio
       // Create 'groupsocks' for RTP and RTCP.
@@ -65,6 +67,9 @@ void setupDarwinStreaming(UsageEnvironment& env, WISInput& inputDevice) {
       
       // Create a RTP sink for the audio stream:
       sinkAudio = createAudioRTPSink(env, rtpGroupsockAudio);
+      if (inputDevice.bitrateController() != NULL) {
+	inputDevice.bitrateController()->addRTPSink(sinkAudio);
+      }
 
       // Create (and start) a 'RTCP instance' for this RTP sink:
       unsigned totalSessionBandwidthAudio = (audioOutputBitrate+500)/1000; // in kbps; for RTCP b/w share
@@ -95,7 +100,7 @@ void setupDarwinStreaming(UsageEnvironment& env, WISInput& inputDevice) {
       case VFMT_NONE: // not used
 	break;
       case VFMT_MJPEG: {
-	sourceVideo = WISJPEGStreamSource::createNew(inputDevice.videoSource());
+	sourceVideo = WISJPEGStreamSource::createNew(inputDevice.videoSource(), &inputDevice);
 	break;
       }
       case VFMT_MPEG1:
@@ -145,6 +150,10 @@ void setupDarwinStreaming(UsageEnvironment& env, WISInput& inputDevice) {
       }
     }
 
+    if (inputDevice.bitrateController() != NULL) {
+      inputDevice.bitrateController()->addRTPSink(sinkVideo);
+    }
+
     // Create (and start) a 'RTCP instance' for this RTP sink:
     unsigned totalSessionBandwidthVideo = (videoBitrate+500)/1000; // in kbps; for RTCP b/w share
     rtcpVideo = RTCPInstance::createNew(env, rtcpGroupsockVideo,
@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Restarting without re-initializing our capture devices
+// Implementation
+
+#include "Handover.hh"
+#include "Err.hh"
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// The messages that we exchange (over a SOCK_SEQPACKET socket) are:
+//   new instance -> running instance: a "HandoverRequestMessage"
+//   running instance -> new instance: a "HandoverState", with its file descriptors
+//   new instance -> running instance: HANDOVER_ACCEPT (or HANDOVER_DECLINE)
+//   running instance -> new instance: HANDOVER_EXITING (after which it exits)
+// If the running instance can't hand over, it just closes the connection.
+
+#define HANDOVER_MAGIC 0x57495301 // "WIS", version 1
+struct HandoverRequestMessage {
+  u_int32_t magic;
+  u_int32_t stateSize; // so that we don't mix up different builds' "HandoverState"s
+};
+
+#define HANDOVER_ACCEPT 'A'
+#define HANDOVER_DECLINE 'D'
+#define HANDOVER_EXITING 'X'
+
+// How long (in seconds) each instance waits for the other:
+#define HANDOVER_TIMEOUT 5
+#define HANDOVER_REPLY_TIMEOUT 10
+
+#define MAX_HANDOVER_FDS (2*MAX_INPUT_DEVICES+1)
+
+static void printErr(UsageEnvironment& env, char const* str) {
+  err(env) << str << ": " << strerror(errno) << "\n";
+}
+
+static Boolean setUnixSocketAddress(UsageEnvironment& env, struct sockaddr_un& addr,
+				    char const* socketName) {
+  memset(&addr, 0, sizeof addr);
+  addr.sun_family = AF_UNIX;
+  if (strlen(socketName) >= sizeof addr.sun_path) {
+    err(env) << "The handover socket name \"" << socketName << "\" is too long\n";
+    return False;
+  }
+  strcpy(addr.sun_path, socketName);
+  return True;
+}
+
+static void setReceiveTimeout(int socketNum, unsigned seconds) {
+  struct timeval timeout;
+  timeout.tv_sec = seconds;
+  timeout.tv_usec = 0;
+  setsockopt(socketNum, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+}
+
+
+////////// HandoverRTSPServer implementation //////////
+
+HandoverRTSPServer*
+HandoverRTSPServer::createNew(UsageEnvironment& env, Port ourPort,
+			      UserAuthenticationDatabase* authDatabase,
+			      int handedOverSocket) {
+  int ourSocket;
+  if (handedOverSocket >= 0) {
+    ourSocket = dup(handedOverSocket);
+    if (ourSocket < 0) {
+      env.setResultErrMsg("Unable to take over the RTSP server socket: ");
+      return NULL;
+    }
+  } else {
+    ourSocket = setUpOurSocket(env, ourPort);
+    if (ourSocket == -1) return NULL;
+  }
+
+  return new HandoverRTSPServer(env, ourSocket, ourPort, authDatabase);
+}
+
+HandoverRTSPServer
+::HandoverRTSPServer(UsageEnvironment& env, int ourSocket, Port ourPort,
+		     UserAuthenticationDatabase* authDatabase)
+  : RTSPServer(env, ourSocket, ourPort, authDatabase, 65),
+    fServerSocketNum(ourSocket), fServerPortNum(ntohs(ourPort.num())) {
+}
+
+HandoverRTSPServer::~HandoverRTSPServer() {
+}
+
+
+////////// HandoverRequest implementation //////////
+
+HandoverRequest* HandoverRequest::createNew(UsageEnvironment& env, char const* socketName,
+					    Boolean& instanceIsRunning) {
+  instanceIsRunning = False;
+  struct sockaddr_un addr;
+  if (!setUnixSocketAddress(env, addr, socketName)) return NULL;
+
+  int socketNum = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+  if (socketNum < 0) {
+    printErr(env, "Unable to create the handover socket");
+    return NULL;
+  }
+  if (connect(socketNum, (struct sockaddr*)&addr, sizeof addr) < 0) {
+    // Assume that there's no instance running (or that it has crashed):
+    ::close(socketNum);
+    return NULL;
+  }
+  instanceIsRunning = True;
+  env << "Taking over from the instance that's running on \"" << socketName << "\"...\n";
+
+  HandoverRequest* request = new HandoverRequest(env, socketNum);
+  if (!request->receiveState()) {
+    delete request;
+    return NULL;
+  }
+
+  return request;
+}
+
+HandoverRequest::HandoverRequest(UsageEnvironment& env, int socketNum)
+  : fEnv(env), fSocketNum(socketNum), fNumReceivedFds(0), fWasAccepted(False) {
+  memset(&fState, 0, sizeof fState);
+  setReceiveTimeout(fSocketNum, HANDOVER_TIMEOUT);
+}
+
+HandoverRequest::~HandoverRequest() {
+  if (!fWasAccepted) {
+    // Let the running instance carry on:
+    char reply = HANDOVER_DECLINE;
+    send(fSocketNum, &reply, 1, MSG_NOSIGNAL);
+  }
+  ::close(fSocketNum);
+
+  // Anything that we used has been duplicated, so we can close these:
+  for (unsigned i = 0; i < fNumReceivedFds; ++i) ::close(fReceivedFds[i]);
+}
+
+Boolean HandoverRequest::receiveState() {
+  HandoverRequestMessage request;
+  request.magic = HANDOVER_MAGIC;
+  request.stateSize = sizeof (HandoverState);
+  if (send(fSocketNum, &request, sizeof request, MSG_NOSIGNAL) != sizeof request) {
+    printErr(fEnv, "Unable to send the handover request");
+    return False;
+  }
+
+  // Receive the running instance's state, along with its file descriptors:
+  struct iovec iov;
+  iov.iov_base = &fState;
+  iov.iov_len = sizeof fState;
+  char control[CMSG_SPACE(MAX_HANDOVER_FDS*sizeof (int))];
+  struct msghdr msg;
+  memset(&msg, 0, sizeof msg);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof control;
+  ssize_t result = recvmsg(fSocketNum, &msg, 0);
+
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+    unsigned numFds = (cmsg->cmsg_len - CMSG_LEN(0))/sizeof (int);
+    int const* fds = (int const*)CMSG_DATA(cmsg);
+    for (unsigned i = 0; i < numFds && fNumReceivedFds < MAX_HANDOVER_FDS; ++i) {
+      fReceivedFds[fNumReceivedFds++] = fds[i];
+    }
+  }
+
+  if (result < 0) {
+    printErr(fEnv, "Unable to receive the running instance's state");
+    return False;
+  }
+  if (result != sizeof fState || (msg.msg_flags&(MSG_TRUNC|MSG_CTRUNC)) != 0
+      || fState.numDevices > MAX_INPUT_DEVICES) {
+    err(fEnv) << "The running instance didn't hand over its devices"
+	      << " (is it a different version, or using \"-alsa\" or replaying?)\n";
+    return False;
+  }
+
+  // Replace file descriptor indices with the file descriptors themselves:
+  for (unsigned i = 0; i < fState.numDevices; ++i) {
+    fState.devices[i].videoFileNo = receivedFd(fState.devices[i].videoFileNo);
+    fState.devices[i].audioFileNo = receivedFd(fState.devices[i].audioFileNo);
+  }
+  fState.rtspServerSocket = receivedFd(fState.rtspServerSocket);
+
+  return True;
+}
+
+int HandoverRequest::receivedFd(int index) const {
+  return index >= 0 && (unsigned)index < fNumReceivedFds ? fReceivedFds[index] : -1;
+}
+
+Boolean HandoverRequest::accept() {
+  char reply = HANDOVER_ACCEPT;
+  if (send(fSocketNum, &reply, 1, MSG_NOSIGNAL) != 1) {
+    printErr(fEnv, "Unable to accept the handover");
+    return False;
+  }
+
+  // Wait for the running instance to confirm that it's exiting.  (If it doesn't,
+  // it may have given up waiting for us, and resumed capturing.)
+  char confirmation;
+  if (recv(fSocketNum, &confirmation, 1, 0) != 1 || confirmation != HANDOVER_EXITING) {
+    err(fEnv) << "The running instance didn't confirm the handover\n";
+    return False;
+  }
+
+  fWasAccepted = True;
+  return True;
+}
+
+
+////////// HandoverListener implementation //////////
+
+HandoverListener* HandoverListener::createNew(UsageEnvironment& env, char const* socketName,
+					      WISInput** inputDevices, unsigned numDevices,
+					      HandoverRTSPServer* rtspServer) {
+  struct sockaddr_un addr;
+  if (!setUnixSocketAddress(env, addr, socketName)) return NULL;
+
+  int listenSocketNum = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+  if (listenSocketNum < 0) {
+    printErr(env, "Unable to create the handover socket");
+    return NULL;
+  }
+
+  // Replace any socket left behind by an instance that we've taken over from
+  // (or that has crashed):
+  unlink(socketName);
+  if (bind(listenSocketNum, (struct sockaddr*)&addr, sizeof addr) < 0
+      || listen(listenSocketNum, 1) < 0) {
+    err(env) << "Unable to listen on the handover socket \"" << socketName << "\": "
+	     << strerror(errno) << "\n";
+    ::close(listenSocketNum);
+    return NULL;
+  }
+
+  return new HandoverListener(env, socketName, listenSocketNum,
+			      inputDevices, numDevices, rtspServer);
+}
+
+HandoverListener
+::HandoverListener(UsageEnvironment& env, char const* socketName, int listenSocketNum,
+		   WISInput** inputDevices, unsigned numDevices,
+		   HandoverRTSPServer* rtspServer)
+  : Medium(env),
+    fSocketName(strDup(socketName)), fListenSocketNum(listenSocketNum),
+    fConnectionSocketNum(-1), fNumDevices(numDevices), fNumPreparedDevices(0),
+    fRTSPServer(rtspServer), fReplyTimeoutTask(NULL) {
+  for (unsigned i = 0; i < numDevices; ++i) fInputDevices[i] = inputDevices[i];
+
+  env.taskScheduler().turnOnBackgroundReadHandling(fListenSocketNum,
+	(TaskScheduler::BackgroundHandlerProc*)&incomingConnectionHandler, this);
+}
+
+HandoverListener::~HandoverListener() {
+  if (fConnectionSocketNum >= 0) cancelHandover();
+
+  envir().taskScheduler().turnOffBackgroundReadHandling(fListenSocketNum);
+  ::close(fListenSocketNum);
+  unlink(fSocketName);
+  delete[] fSocketName;
+}
+
+void HandoverListener::incomingConnectionHandler(HandoverListener* listener, int /*mask*/) {
+  listener->incomingConnectionHandler1();
+}
+
+static int addFd(int* fds, unsigned& numFds, int fd) {
+  // Returns the index of "fd" in "fds" (or -1, if "fd" is -1):
+  if (fd < 0) return -1;
+  fds[numFds] = fd;
+  return numFds++;
+}
+
+void HandoverListener::incomingConnectionHandler1() {
+  int socketNum = accept(fListenSocketNum, NULL, NULL);
+  if (socketNum < 0) return;
+  if (fConnectionSocketNum >= 0) {
+    // We're already handing over to someone else:
+    ::close(socketNum);
+    return;
+  }
+  fConnectionSocketNum = socketNum;
+
+  do {
+    // Read the new instance's request (which it sends as soon as it connects):
+    setReceiveTimeout(fConnectionSocketNum, 1);
+    HandoverRequestMessage request;
+    if (recv(fConnectionSocketNum, &request, sizeof request, 0) != sizeof request
+	|| request.magic != HANDOVER_MAGIC || request.stateSize != sizeof (HandoverState)) {
+      warn(envir()) << "Ignoring an invalid handover request (from a different version?)\n";
+      break;
+    }
+    envir() << "Handing over to a newly-started instance...\n";
+
+    // Stop capturing, and describe our devices:
+    HandoverState state;
+    memset(&state, 0, sizeof state);
+    int fds[MAX_HANDOVER_FDS];
+    unsigned numFds = 0;
+    state.numDevices = fNumDevices;
+    while (fNumPreparedDevices < fNumDevices) {
+      WISInputHandoverState& device = state.devices[fNumPreparedDevices];
+      if (!fInputDevices[fNumPreparedDevices]->prepareHandover(device)) break;
+      ++fNumPreparedDevices;
+
+      device.videoFileNo = addFd(fds, numFds, device.videoFileNo);
+      device.audioFileNo = addFd(fds, numFds, device.audioFileNo);
+    }
+    if (fNumPreparedDevices < fNumDevices) {
+      err(envir()) << "Our devices can't be handed over\n";
+      break;
+    }
+    if (fRTSPServer != NULL) {
+      state.rtspServerSocket = addFd(fds, numFds, fRTSPServer->serverSocket());
+      state.rtspServerPortNum = fRTSPServer->serverPortNum();
+    } else {
+      state.rtspServerSocket = -1;
+    }
+
+    // Send our state, with the file descriptors attached:
+    struct iovec iov;
+    iov.iov_base = &state;
+    iov.iov_len = sizeof state;
+    char control[CMSG_SPACE(MAX_HANDOVER_FDS*sizeof (int))];
+    struct msghdr msg;
+    memset(&msg, 0, sizeof msg);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (numFds > 0) {
+      memset(control, 0, sizeof control);
+      msg.msg_control = control;
+      msg.msg_controllen = CMSG_SPACE(numFds*sizeof (int));
+      struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = SOL_SOCKET;
+      cmsg->cmsg_type = SCM_RIGHTS;
+      cmsg->cmsg_len = CMSG_LEN(numFds*sizeof (int));
+      memcpy(CMSG_DATA(cmsg), fds, numFds*sizeof (int));
+    }
+    if (sendmsg(fConnectionSocketNum, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof state) {
+      printErr(envir(), "Unable to send our state to the new instance");
+      break;
+    }
+
+    // Wait (but not forever) for the new instance to accept:
+    envir().taskScheduler().turnOnBackgroundReadHandling(fConnectionSocketNum,
+	(TaskScheduler::BackgroundHandlerProc*)&replyHandler, this);
+    fReplyTimeoutTask
+      = envir().taskScheduler().scheduleDelayedTask(HANDOVER_REPLY_TIMEOUT*1000000,
+						    replyTimeoutHandler, this);
+    return;
+  } while (0);
+
+  // An error occurred:
+  cancelHandover();
+}
+
+void HandoverListener::replyHandler(HandoverListener* listener, int /*mask*/) {
+  listener->replyHandler1();
+}
+
+void HandoverListener::replyHandler1() {
+  char reply;
+  if (recv(fConnectionSocketNum, &reply, 1, 0) == 1 && reply == HANDOVER_ACCEPT) {
+    // The new instance now has everything that it needs.  Tell it that we're
+    // leaving (so that it can start using our devices), and leave:
+    char confirmation = HANDOVER_EXITING;
+    if (send(fConnectionSocketNum, &confirmation, 1, MSG_NOSIGNAL) == 1) {
+      envir() << "Handed over to the new instance; exiting\n";
+      exit(0);
+    }
+  }
+
+  envir() << "The new instance didn't take over; resuming\n";
+  cancelHandover();
+}
+
+void HandoverListener::replyTimeoutHandler(void* clientData) {
+  HandoverListener* listener = (HandoverListener*)clientData;
+  listener->fReplyTimeoutTask = NULL;
+
+  warn(listener->envir()) << "Timed out waiting for the new instance to take over; resuming\n";
+  listener->cancelHandover();
+}
+
+void HandoverListener::cancelHandover() {
+  envir().taskScheduler().unscheduleDelayedTask(fReplyTimeoutTask);
+  envir().taskScheduler().turnOffBackgroundReadHandling(fConnectionSocketNum);
+  ::close(fConnectionSocketNum);
+  fConnectionSocketNum = -1;
+
+  // Resume capturing:
+  for (unsigned i = 0; i < fNumPreparedDevices; ++i) fInputDevices[i]->cancelHandover();
+  fNumPreparedDevices = 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Restarting without re-initializing our capture devices: a running instance
+// hands its devices' open file descriptors (and its RTSP server's listening
+// socket) over a Unix domain socket to a newly-started instance, which carries
+// on capturing from them.
+// C++ header
+
+#ifndef _HANDOVER_HH
+#define _HANDOVER_HH
+
+#include <liveMedia.hh>
+#ifndef _WIS_INPUT_HH
+#include "WISInput.hh"
+#endif
+#ifndef _OPTIONS_HH
+#include "Options.hh"
+#endif
+
+// An RTSP server whose listening socket can be handed over to (or taken over
+// from) another instance:
+class HandoverRTSPServer: public RTSPServer {
+public:
+  static HandoverRTSPServer* createNew(UsageEnvironment& env, Port ourPort,
+				       UserAuthenticationDatabase* authDatabase,
+				       int handedOverSocket = -1);
+      // If "handedOverSocket" >= 0, it's another instance's (already listening)
+      // server socket, which we use (a duplicate of) instead of creating our own.
+
+  int serverSocket() const { return fServerSocketNum; }
+  portNumBits serverPortNum() const { return fServerPortNum; }
+
+protected:
+  HandoverRTSPServer(UsageEnvironment& env, int ourSocket, Port ourPort,
+		     UserAuthenticationDatabase* authDatabase);
+      // called only by createNew()
+  virtual ~HandoverRTSPServer();
+
+private:
+  int fServerSocketNum;
+  portNumBits fServerPortNum;
+};
+
+// What a running instance hands over.  (Within a message, each file descriptor
+// is replaced by its index in the message's SCM_RIGHTS array.)
+struct HandoverState {
+  unsigned numDevices;
+  WISInputHandoverState devices[MAX_INPUT_DEVICES];
+  int rtspServerSocket; // -1 if none
+  portNumBits rtspServerPortNum;
+};
+
+// Used by a newly-started instance, to take over from a running one:
+class HandoverRequest {
+public:
+  static HandoverRequest* createNew(UsageEnvironment& env, char const* socketName,
+				    Boolean& instanceIsRunning);
+      // Asks the instance that's listening on "socketName" to hand over its state.
+      // Returns NULL if there's no such instance (in which case "instanceIsRunning"
+      // is set to False), or on error.
+  virtual ~HandoverRequest(); // declines the handover, unless "accept()" succeeded
+
+  HandoverState const& state() const { return fState; }
+      // The file descriptors in this remain ours; they're closed by our destructor.
+  Boolean accept();
+      // Tells the running instance to exit, and waits until it has agreed to.
+      // After this, its devices (and server socket) are ours alone.
+
+private:
+  HandoverRequest(UsageEnvironment& env, int socketNum); // called only by createNew()
+  Boolean receiveState();
+  int receivedFd(int index) const;
+
+private:
+  UsageEnvironment& fEnv;
+  int fSocketNum;
+  HandoverState fState;
+  int fReceivedFds[2*MAX_INPUT_DEVICES+1];
+  unsigned fNumReceivedFds;
+  Boolean fWasAccepted;
+};
+
+// Used by a running instance, to wait for a newly-started one to take over:
+class HandoverListener: public Medium {
+public:
+  static HandoverListener* createNew(UsageEnvironment& env, char const* socketName,
+				     WISInput** inputDevices, unsigned numDevices,
+				     HandoverRTSPServer* rtspServer);
+      // "rtspServer" may be NULL (if we're not running one)
+
+protected:
+  HandoverListener(UsageEnvironment& env, char const* socketName, int listenSocketNum,
+		   WISInput** inputDevices, unsigned numDevices,
+		   HandoverRTSPServer* rtspServer); // called only by createNew()
+  virtual ~HandoverListener();
+
+private:
+  static void incomingConnectionHandler(HandoverListener* listener, int mask);
+  void incomingConnectionHandler1();
+  static void replyHandler(HandoverListener* listener, int mask);
+  void replyHandler1();
+  static void replyTimeoutHandler(void* clientData);
+  void cancelHandover();
+
+private:
+  char* fSocketName;
+  int fListenSocketNum;
+  int fConnectionSocketNum; // -1 unless a handover is in progress
+  WISInput* fInputDevices[MAX_INPUT_DEVICES];
+  unsigned fNumDevices, fNumPreparedDevices;
+  HandoverRTSPServer* fRTSPServer;
+  TaskToken fReplyTimeoutTask;
+};
+
+#endif
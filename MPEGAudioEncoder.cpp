@@ -20,6 +20,7 @@
 // Implementation
 
 #include "MPEGAudioEncoder.hh"
+#include "AudioEncodingQueue.hh"
 extern "C" {
 #include "avcodec.h"
 #include "mpegaudio.h"
@@ -55,97 +56,50 @@ MPEGAudioEncoder
   mp2_encoder.init(ctx);
 
   fFrameDurationInMicroseconds = samplingRate == 0 ? 0
-    : ((MPA_FRAME_SIZE*2*MILLION)/samplingRate + 1)/2; // rounds to nearest int
-  fMicrosecondsPerByte
+    : ((MPA_FRAME_SIZE*2*(unsigned long long)MILLION)/samplingRate + 1)/2; // rounds to nearest int
+  double microsecondsPerByte
     = (1.0*MILLION)/(samplingRate*numChannels*sizeof (unsigned short));
-  fInputSampleBufferBytesDesired
-    = MPA_FRAME_SIZE*numChannels*sizeof (unsigned short);
-      // the number of bytes necessary in order to encode a frame
-  fInputSampleBufferSize = 10*fInputSampleBufferBytesDesired;
-  fInputSampleBuffer = new unsigned char[fInputSampleBufferSize];
-  fInputSampleBufferBytesFull = 0;
-
-  fLastInputDataPresentationTime.tv_sec = 0;
-  fLastInputDataPresentationTime.tv_usec = 0;
+  fEncodingQueue
+    = new AudioEncodingQueue(env, inputSource,
+			     MPA_FRAME_SIZE*numChannels*sizeof (unsigned short),
+			     microsecondsPerByte, 0/*no overlap*/, MPA_MAX_CODED_FRAME_SIZE,
+			     encodeFrame, this);
 }
 
 MPEGAudioEncoder::~MPEGAudioEncoder() {
+  delete fEncodingQueue; // first, because it may be using the encoder
+
   AVCodecContext* ctx = (AVCodecContext*)fCodecContext;
   delete[] (unsigned char*)(ctx->priv_data);
   delete ctx;
-
-  delete[] fInputSampleBuffer;
 }
 
 void MPEGAudioEncoder::doGetNextFrame() {
-  // If we have enough samples in order to encode a frame, do this now:
-  if (fInputSampleBufferBytesFull >= fInputSampleBufferBytesDesired) {
-    if (fMaxSize < MPA_MAX_CODED_FRAME_SIZE) {
-      // Our sink hasn't given us enough space for a frame.  We can't encode.
-      fFrameSize = 0;
-      fNumTruncatedBytes = MPA_MAX_CODED_FRAME_SIZE;
-    } else {
-      AVCodecContext* ctx = (AVCodecContext*)fCodecContext;
-      fFrameSize = mp2_encoder.encode(ctx, fTo, fMaxSize, fInputSampleBuffer);
-      fNumTruncatedBytes = 0;
-
-      // Shift any remaining samples down the the start of the buffer:
-      fInputSampleBufferBytesFull -= fInputSampleBufferBytesDesired;
-      memmove(fInputSampleBuffer,
-	      &fInputSampleBuffer[fInputSampleBufferBytesDesired],
-	      fInputSampleBufferBytesFull);
-    }
+  // Deliver our next encoded frame, once it's ready:
+  fEncodingQueue->getNextEncodedFrame(afterEncoding, this,
+				      FramedSource::handleClosure, this);
+}
 
-    // Complete delivery to the client:
-    fPresentationTime = fLastInputDataPresentationTime;
-    //fDurationInMicroseconds = fFrameDurationInMicroseconds;
-    fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
-    afterGetting(this);
-  } else {
-    // Read more samples from our source, then try again:
-    unsigned maxBytesToRead
-      = fInputSampleBufferSize - fInputSampleBufferBytesFull;
-    fInputSource
-      ->getNextFrame(&fInputSampleBuffer[fInputSampleBufferBytesFull],
-		     maxBytesToRead,
-		     afterGettingFrame, this,
-		     FramedSource::handleClosure, this);
-  }
+void MPEGAudioEncoder::doStopGettingFrames() {
+  fEncodingQueue->stopGettingFrames();
 }
 
-void MPEGAudioEncoder
-::afterGettingFrame(void* clientData, unsigned frameSize,
-                    unsigned numTruncatedBytes,
-                    struct timeval presentationTime,
-                    unsigned durationInMicroseconds) {
+void MPEGAudioEncoder::afterEncoding(void* clientData) {
   MPEGAudioEncoder* source = (MPEGAudioEncoder*)clientData;
-  source->afterGettingFrame1(frameSize, numTruncatedBytes,
-                             presentationTime, durationInMicroseconds);
+  source->fEncodingQueue->deliverFrame(source->fTo, source->fMaxSize,
+				       source->fFrameSize, source->fNumTruncatedBytes,
+				       source->fPresentationTime);
+
+  // Complete delivery to the client:
+  //source->fDurationInMicroseconds = source->fFrameDurationInMicroseconds;
+  source->fDurationInMicroseconds = 0; // because audio capture is bursty, check for it ASAP
+  afterGetting(source);
 }
 
-void MPEGAudioEncoder
-::afterGettingFrame1(unsigned frameSize, unsigned numTruncatedBytes,
-                     struct timeval presentationTime,
-                     unsigned durationInMicroseconds) {
-  // Adjust presentationTime to allow for the data that's still in our buffer:
-  int uSecondsAdjustment
-    = (int)(fInputSampleBufferBytesFull*fMicrosecondsPerByte);
-  presentationTime.tv_sec -= uSecondsAdjustment/MILLION;
-  uSecondsAdjustment %= MILLION;
-  if (presentationTime.tv_usec < uSecondsAdjustment) {
-    --presentationTime.tv_sec;
-    presentationTime.tv_usec += MILLION;
-  }
-  presentationTime.tv_usec -= uSecondsAdjustment;
-
-  // Don't allow the presentation time to decrease:
-  if (presentationTime.tv_sec > fLastInputDataPresentationTime.tv_sec ||
-      (presentationTime.tv_sec == fLastInputDataPresentationTime.tv_sec &&
-       presentationTime.tv_usec > fLastInputDataPresentationTime.tv_usec)) {
-    fLastInputDataPresentationTime = presentationTime;
-  }
-  fInputSampleBufferBytesFull += frameSize;  
-
-  // Try again to encode and deliver data to the sink:
-  doGetNextFrame();
+unsigned MPEGAudioEncoder
+::encodeFrame(void* encoderData, unsigned char* /*overlap*/, unsigned char* frame,
+	      unsigned char* to, unsigned maxSize) {
+  // (Note that we may be called from a worker thread.)
+  AVCodecContext* ctx = (AVCodecContext*)(((MPEGAudioEncoder*)encoderData)->fCodecContext);
+  return mp2_encoder.encode(ctx, to, maxSize, frame);
 }
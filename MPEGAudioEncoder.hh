@@ -24,6 +24,8 @@
 
 #include "FramedFilter.hh"
 
+class AudioEncodingQueue;
+
 class MPEGAudioEncoder: public FramedFilter {
 public:
   static MPEGAudioEncoder* createNew(UsageEnvironment& env,
@@ -42,25 +44,18 @@ protected:
 private:
   // redefined virtual functions:
   virtual void doGetNextFrame();
+  virtual void doStopGettingFrames();
 
 private:
-  static void afterGettingFrame(void* clientData, unsigned frameSize,
-                                unsigned numTruncatedBytes,
-                                struct timeval presentationTime,
-                                unsigned durationInMicroseconds);
-  void afterGettingFrame1(unsigned frameSize,
-                          unsigned numTruncatedBytes,
-                          struct timeval presentationTime,
-                          unsigned durationInMicroseconds);
+  static void afterEncoding(void* clientData);
+  static unsigned encodeFrame(void* encoderData,
+			      unsigned char* overlap, unsigned char* frame,
+			      unsigned char* to, unsigned maxSize);
 
 private:
   void* fCodecContext;
   unsigned fFrameDurationInMicroseconds;
-  double fMicrosecondsPerByte;
-  unsigned char* fInputSampleBuffer;
-  unsigned fInputSampleBufferSize;
-  unsigned fInputSampleBufferBytesDesired, fInputSampleBufferBytesFull;
-  struct timeval fLastInputDataPresentationTime;
+  AudioEncodingQueue* fEncodingQueue;
 };
 
 #endif
@@ -22,6 +22,7 @@
 #include "MulticastStreaming.hh"
 #include "Options.hh"
 #include "AudioRTPCommon.hh"
+#include "BitrateController.hh"
 #include "WISJPEGStreamSource.hh"
 #include "MPEG2TransportStreamAccumulator.hh"
 
@@ -51,7 +52,8 @@ void setupMulticastStreaming(WISInput& inputDevice, ServerMediaSession* sms) {
   /******************audio ***********************/
   if (audioFormat != AFMT_NONE) {
     // Create the audio source:
-    sourceAudio = createAudioSource(env, inputDevice.audioSource());
+    sourceAudio = createAudioSource(env, inputDevice.audioSource(),
+				    inputDevice.bitrateController());
 
     if (packageFormat != PFMT_TRANSPORT_STREAM) { // there's a separate RTP stream for audio
       // Create 'groupsocks' for RTP and RTCP:
@@ -67,6 +69,9 @@ void setupMulticastStreaming(WISInput& inputDevice, ServerMediaSession* sms) {
       }
       
       sinkAudio = createAudioRTPSink(env, rtpGroupsockAudio);
+      if (inputDevice.bitrateController() != NULL) {
+	inputDevice.bitrateController()->addRTPSink(sinkAudio);
+      }
 
       // Create (and start) a 'RTCP instance' for this RTP sink:
       unsigned totalSessionBandwidthAudio = (audioOutputBitrate+500)/1000; // in kbps; for RTCP b/w share
@@ -99,7 +104,7 @@ void setupMulticastStreaming(WISInput& inputDevice, ServerMediaSession* sms) {
       case VFMT_NONE: // not used
 	break;
       case VFMT_MJPEG: {
-	sourceVideo = WISJPEGStreamSource::createNew(inputDevice.videoSource());
+	sourceVideo = WISJPEGStreamSource::createNew(inputDevice.videoSource(), &inputDevice);
 	break;
       }
       case VFMT_MPEG1:
@@ -153,6 +158,10 @@ void setupMulticastStreaming(WISInput& inputDevice, ServerMediaSession* sms) {
       }
     }
 
+    if (inputDevice.bitrateController() != NULL) {
+      inputDevice.bitrateController()->addRTPSink(sinkVideo);
+    }
+
     // Create (and start) a 'RTCP instance' for this RTP sink:
     unsigned totalSessionBandwidthVideo = (videoBitrate+500)/1000; // in kbps; for RTCP b/w share
     rtcpVideo = RTCPInstance::createNew(env, rtcpGroupsockVideo,
@@ -21,6 +21,8 @@
 
 #include "Options.hh"
 #include "TV.hh"
+#include "AMRAudioEncoder.hh"
+#include "PCMResampler.hh"
 #include "Err.hh"
 #include <GroupsockHelper.hh>
 #include <getopt.h>
@@ -37,6 +39,9 @@ char* remoteDSSNameOrAddress = NULL;
 
 PackageFormat packageFormat = PFMT_SEPARATE_STREAMS;
 
+char* inputDeviceNames[MAX_INPUT_DEVICES];
+unsigned numInputDevices = 0;
+
 VideoFormat videoFormat = VFMT_MPEG4;
 int videoWidth = 640;
 int videoHeight = 480;
@@ -68,10 +73,25 @@ int videoInputDeviceNumber = 0;
 int videoFrameRateNumerator = 0; // changed later
 int videoFrameRateDenominator = 0; // ditto
 
+Boolean videoZeroCopy = False; // default: copy each frame out of the driver's buffers
+unsigned videoNumBuffers = 32; // memory-mapped capture buffers requested from the driver
+Boolean useCaptureThread = False; // default: capture from within the event loop
+unsigned captureRingDepth = 16; // frames (or audio chunks) queued for each stream
+char* replayVideoFileName = NULL; // if set, replay this elementary stream instead of capturing
+char* replayAudioFileName = NULL; // if set, replay this raw PCM file instead of capturing
+Boolean replaySynthetic = False; // if set, generate whatever isn't replayed from a file
+Boolean replayAsFastAsPossible = False; // default: replay at the nominal frame/sample rate
+
 AudioFormat audioFormat = AFMT_PCM_RAW16;
 unsigned audioSamplingFrequency = 48000;
 unsigned audioNumChannels = 2;
+unsigned audioCaptureSamplingFrequency = 0; // default: "audioSamplingFrequency"
+unsigned audioCaptureNumChannels = 0; // default: "audioNumChannels"
 unsigned audioOutputBitrate = 0; // default: we're not encoding to MPEG audio
+Boolean audioUseALSA = False; // default: capture through the OSS emulation device
+unsigned audioPeriodFrames = 0; // default: 20 ms worth (used only with "-alsa")
+unsigned audioEncoderThreads = 0; // default: encode audio within the event loop
+unsigned audioAMRMode = 7; // default: MR122 (12.2 kbps)
 
 int tvFreq = -1; // default value => don't use TV tuner
 
@@ -89,11 +109,30 @@ static int strToInt(char const* str) {
   return invalidValue;
 }
 
+static void getBitrateArg(UsageEnvironment& env, char const* str, unsigned& bitrate) {
+  int val = strToInt(str);
+  if (val == invalidValue || val <= 0) {
+    err(env) << "Invalid bitrate (bps): " << str << "\n";
+    return;
+  }
+  bitrate = (unsigned)val;
+}
+
 StreamingMode streamingMode = STREAMING_UNICAST;
 netAddressBits multicastAddress = 0;
 portNumBits videoRTPPortNum = 6000;
 portNumBits audioRTPPortNum = 6002;
 
+unsigned statisticsReportInterval = 0;
+
+char* handoverSocketName = NULL; // default: restarting re-initializes our devices
+
+Boolean rateControl = False; // default: our bitrates are fixed
+unsigned rateControlMinVideoBitrate = 0; // default: a quarter of "videoBitrate"
+unsigned rateControlMaxVideoBitrate = 0; // default: "videoBitrate"
+unsigned rateControlMinAudioBitrate = 0; // default: half of "audioOutputBitrate"
+unsigned rateControlStepPercent = 10;
+
 void checkArgs(UsageEnvironment& env, int argc, char** argv) {
   while (1) {
     int option_index = 0;
@@ -122,6 +161,42 @@ void checkArgs(UsageEnvironment& env, int argc, char** argv) {
       {"saturation", 1, 0, 0},
       {"hue", 1, 0, 0},
 
+      // video capture parameters
+      {"device", 1, 0, 0},
+      {"zerocopy", 0, 0, 0},
+      {"vbuffers", 1, 0, 0},
+      {"capturethread", 0, 0, 0},
+      {"ringdepth", 1, 0, 0},
+
+      // replaying (instead of capturing)
+      {"replayvideo", 1, 0, 0},
+      {"replayaudio", 1, 0, 0},
+      {"synthetic", 0, 0, 0},
+      {"replayfast", 0, 0, 0},
+
+      // audio capture parameters
+      {"alsa", 0, 0, 0},
+      {"aperiod", 1, 0, 0},
+      {"capturefreq", 1, 0, 0},
+      {"capturechannels", 1, 0, 0},
+
+      // audio encoding
+      {"encthreads", 1, 0, 0},
+      {"amrmode", 1, 0, 0},
+
+      // statistics reporting
+      {"stats", 1, 0, 0},
+
+      // restarting (without re-initializing our devices)
+      {"handover", 1, 0, 0},
+
+      // adaptive bitrate control
+      {"ratecontrol", 0, 0, 0},
+      {"minbitrate", 1, 0, 0},
+      {"maxbitrate", 1, 0, 0},
+      {"minaudiobitrate", 1, 0, 0},
+      {"ratestep", 1, 0, 0},
+
       {0, 0, 0, 0}
     };
 
@@ -192,6 +267,114 @@ void checkArgs(UsageEnvironment& env, int argc, char** argv) {
       else if (strcmp(option, "contrast") == 0) videoInputContrast = strToInt(optarg);
       else if (strcmp(option, "saturation") == 0) videoInputSaturation = strToInt(optarg);
       else if (strcmp(option, "hue") == 0) videoInputHue = strToInt(optarg);
+
+      // video capture parameters
+      else if (strcmp(option, "device") == 0) {
+	if (numInputDevices == MAX_INPUT_DEVICES) {
+	  err(env) << "Too many input devices; ignoring \"" << optarg << "\"\n";
+	  break;
+	}
+	inputDeviceNames[numInputDevices++] = strDup(optarg);
+      } else if (strcmp(option, "zerocopy") == 0) videoZeroCopy = True;
+      else if (strcmp(option, "vbuffers") == 0) {
+	int numBuffersArg = strToInt(optarg);
+	if (numBuffersArg == invalidValue || numBuffersArg < 2) {
+	  err(env) << "Invalid number of video capture buffers: " << optarg << "\n";
+	  break;
+	}
+	videoNumBuffers = (unsigned)numBuffersArg;
+      } else if (strcmp(option, "capturethread") == 0) useCaptureThread = True;
+      else if (strcmp(option, "ringdepth") == 0) {
+	int ringDepthArg = strToInt(optarg);
+	if (ringDepthArg == invalidValue || ringDepthArg <= 0) {
+	  err(env) << "Invalid capture ring depth: " << optarg << "\n";
+	  break;
+	}
+	captureRingDepth = (unsigned)ringDepthArg;
+      }
+
+      // replaying (instead of capturing)
+      else if (strcmp(option, "replayvideo") == 0) {
+	delete[] replayVideoFileName; replayVideoFileName = strDup(optarg);
+      } else if (strcmp(option, "replayaudio") == 0) {
+	delete[] replayAudioFileName; replayAudioFileName = strDup(optarg);
+      } else if (strcmp(option, "synthetic") == 0) replaySynthetic = True;
+      else if (strcmp(option, "replayfast") == 0) replayAsFastAsPossible = True;
+
+      // audio capture parameters
+      else if (strcmp(option, "alsa") == 0) audioUseALSA = True;
+      else if (strcmp(option, "aperiod") == 0) {
+	int periodArg = strToInt(optarg);
+	if (periodArg == invalidValue || periodArg <= 0) {
+	  err(env) << "Invalid audio period size (frames): " << optarg << "\n";
+	  break;
+	}
+	audioPeriodFrames = (unsigned)periodArg;
+      } else if (strcmp(option, "capturefreq") == 0) {
+	int frequencyArg = strToInt(optarg);
+	if (frequencyArg == invalidValue || frequencyArg <= 0) {
+	  err(env) << "Invalid audio capture sampling frequency argument: " << optarg << "\n";
+	  break;
+	}
+	audioCaptureSamplingFrequency = (unsigned)frequencyArg;
+      } else if (strcmp(option, "capturechannels") == 0) {
+	int numChannelsArg = strToInt(optarg);
+	if (numChannelsArg != 1 && numChannelsArg != 2) {
+	  err(env) << "Invalid number of audio capture channels (1 or 2): " << optarg << "\n";
+	  break;
+	}
+	audioCaptureNumChannels = (unsigned)numChannelsArg;
+      }
+
+      // audio encoding
+      else if (strcmp(option, "encthreads") == 0) {
+	int numThreadsArg = strToInt(optarg);
+	if (numThreadsArg == invalidValue || numThreadsArg < 0) {
+	  err(env) << "Invalid number of audio encoder threads: " << optarg << "\n";
+	  break;
+	}
+	audioEncoderThreads = (unsigned)numThreadsArg;
+      } else if (strcmp(option, "amrmode") == 0) {
+	int modeArg = strToInt(optarg);
+	if (modeArg == invalidValue || modeArg < 0 || modeArg > 7) {
+	  err(env) << "Invalid AMR mode (0 (4.75 kbps) through 7 (12.2 kbps)) argument: "
+		   << optarg << "\n";
+	  break;
+	}
+	audioAMRMode = (unsigned)modeArg;
+      }
+
+      // statistics reporting
+      else if (strcmp(option, "stats") == 0) {
+	int intervalArg = strToInt(optarg);
+	if (intervalArg == invalidValue || intervalArg < 0) {
+	  err(env) << "Invalid statistics report interval (seconds): " << optarg << "\n";
+	  break;
+	}
+	statisticsReportInterval = (unsigned)intervalArg;
+      }
+
+      // restarting (without re-initializing our devices)
+      else if (strcmp(option, "handover") == 0) {
+	delete[] handoverSocketName; handoverSocketName = strDup(optarg);
+      }
+
+      // adaptive bitrate control
+      else if (strcmp(option, "ratecontrol") == 0) rateControl = True;
+      else if (strcmp(option, "minbitrate") == 0) {
+	getBitrateArg(env, optarg, rateControlMinVideoBitrate);
+      } else if (strcmp(option, "maxbitrate") == 0) {
+	getBitrateArg(env, optarg, rateControlMaxVideoBitrate);
+      } else if (strcmp(option, "minaudiobitrate") == 0) {
+	getBitrateArg(env, optarg, rateControlMinAudioBitrate);
+      } else if (strcmp(option, "ratestep") == 0) {
+	int stepArg = strToInt(optarg);
+	if (stepArg == invalidValue || stepArg <= 0 || stepArg >= 100) {
+	  err(env) << "Invalid bitrate step (percent): " << optarg << "\n";
+	  break;
+	}
+	rateControlStepPercent = (unsigned)stepArg;
+      }
       break;
     }
 
@@ -467,9 +650,76 @@ void checkArgs(UsageEnvironment& env, int argc, char** argv) {
   } else if (multicastAddress != 0) {
     streamingMode = STREAMING_MULTICAST_ASM;
   }
+
+  // Only our built-in RTSP server can stream from more than one input device
+  // (each as a separate stream):
+  if (numInputDevices > 1 && streamingMode != STREAMING_UNICAST) {
+    err(env) << "Multiple input devices can be streamed only using unicast from our RTSP server\n";
+    exit(1);
+  }
+
+  // Synthetic video is generated as MPEG-1 (which our MPEG-2 streams can also carry):
+  if (replaySynthetic && replayVideoFileName == NULL
+      && videoFormat != VFMT_NONE && videoFormat != VFMT_MPEG1 && videoFormat != VFMT_MPEG2) {
+    err(env) << "Synthetic video can be streamed only as MPEG-1 or MPEG-2 (or use \"-nv\")\n";
+    exit(1);
+  }
+
+#ifndef HAVE_ALSA
+  if (audioUseALSA) {
+    warn(env) << "This binary was built without ALSA support; capturing audio through OSS instead\n";
+    audioUseALSA = False;
+  }
+#endif
+
+  // Only devices that we've opened ourselves (and not through ALSA) can be handed over:
+  if (handoverSocketName != NULL
+      && (replayVideoFileName != NULL || replayAudioFileName != NULL || replaySynthetic)) {
+    err(env) << "\"-handover\" can't be used when replaying\n";
+    exit(1);
+  }
+  if (handoverSocketName != NULL && audioUseALSA) {
+    err(env) << "\"-handover\" can't be used with \"-alsa\" (use OSS audio capture instead)\n";
+    exit(1);
+  }
+
+  // Unless we were asked to capture audio differently, we capture it as we stream it:
+  if (audioCaptureSamplingFrequency == 0) audioCaptureSamplingFrequency = audioSamplingFrequency;
+  if (audioCaptureNumChannels == 0) audioCaptureNumChannels = audioNumChannels;
+  if (audioFormat != AFMT_NONE
+      && !PCMResampler::canConvert(audioCaptureSamplingFrequency, audioSamplingFrequency)) {
+    err(env) << "Audio captured at " << audioCaptureSamplingFrequency
+	     << " Hz can't be converted to " << audioSamplingFrequency << " Hz\n";
+    exit(1);
+  }
+
+  // AMR's bitrate is set by its mode:
+  if (audioFormat == AFMT_AMR) audioOutputBitrate = AMRAudioEncoder::bitrateForMode(audioAMRMode);
+
+  // Fill in the limits of our adaptive bitrate control:
+  if (rateControl) {
+    if (videoQuant != 0) {
+      err(env) << "\"-ratecontrol\" needs a target bitrate (not a fixed quantizer)\n";
+      exit(1);
+    }
+    if (rateControlMaxVideoBitrate == 0) rateControlMaxVideoBitrate = videoBitrate;
+    if (rateControlMinVideoBitrate == 0) rateControlMinVideoBitrate = videoBitrate/4;
+    if (rateControlMinVideoBitrate > rateControlMaxVideoBitrate) {
+      err(env) << "The minimum bitrate (" << rateControlMinVideoBitrate
+	       << ") is more than the maximum (" << rateControlMaxVideoBitrate << ")\n";
+      exit(1);
+    }
+    if (rateControlMinAudioBitrate == 0 || rateControlMinAudioBitrate > audioOutputBitrate) {
+      rateControlMinAudioBitrate = audioOutputBitrate/2;
+    }
+  }
 }
 
 void reclaimArgs() {
+  for (unsigned i = 0; i < numInputDevices; ++i) delete[] inputDeviceNames[i];
+  delete[] replayVideoFileName;
+  delete[] replayAudioFileName;
+  delete[] handoverSocketName;
   delete authDB;
   delete[] streamDescription;
 }
@@ -34,6 +34,10 @@ extern char* remoteDSSNameOrAddress;
 
 extern PackageFormat packageFormat;
 
+#define MAX_INPUT_DEVICES 8
+extern char* inputDeviceNames[MAX_INPUT_DEVICES]; // sysfs paths or USB addresses
+extern unsigned numInputDevices; // 0 means: use the first GO7007 device found
+
 extern VideoFormat videoFormat;
 extern int videoWidth;
 extern int videoHeight;
@@ -45,11 +49,25 @@ extern unsigned long long videoType;
 extern int videoInputDeviceNumber;
 extern int videoFrameRateNumerator;
 extern int videoFrameRateDenominator;
+extern Boolean videoZeroCopy;
+extern unsigned videoNumBuffers;
+extern Boolean useCaptureThread;
+extern unsigned captureRingDepth;
+extern char* replayVideoFileName;
+extern char* replayAudioFileName;
+extern Boolean replaySynthetic;
+extern Boolean replayAsFastAsPossible;
 
 extern AudioFormat audioFormat;
 extern unsigned audioSamplingFrequency;
 extern unsigned audioNumChannels;
+extern unsigned audioCaptureSamplingFrequency; // if different from the above (which we
+extern unsigned audioCaptureNumChannels;       // stream), the captured audio is converted
 extern unsigned audioOutputBitrate; // if we're encoding to MPEG audio
+extern Boolean audioUseALSA;
+extern unsigned audioPeriodFrames;
+extern unsigned audioEncoderThreads;
+extern unsigned audioAMRMode; // 0 (MR475) through 7 (MR122)
 
 extern int tvFreq;
 
@@ -69,6 +87,15 @@ extern netAddressBits multicastAddress;
 extern portNumBits videoRTPPortNum;
 extern portNumBits audioRTPPortNum;
 
+extern unsigned statisticsReportInterval; // in seconds; 0 means: don't report
+
+extern char* handoverSocketName; // if set, restarts can take over our devices through this
+
+extern Boolean rateControl; // if set, adapt our bitrates to receivers' RTCP reports
+extern unsigned rateControlMinVideoBitrate, rateControlMaxVideoBitrate; // in bps
+extern unsigned rateControlMinAudioBitrate; // in bps (the maximum is "audioOutputBitrate")
+extern unsigned rateControlStepPercent; // the most that we change bitrates by at once
+
 extern void checkArgs(UsageEnvironment& env, int argc, char** argv);
 extern void reclaimArgs();
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A ring buffer that accumulates PCM audio for an encoder, and hands it out
+// a frame at a time, contiguously and without copying.  It also tracks the
+// presentation time of the data that it holds.
+// Implementation
+
+#include "PCMAccumulator.hh"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifndef MILLION
+#define MILLION 1000000
+#endif
+
+// The ring holds up to this many frames (including any overlap):
+#define RING_SIZE_IN_FRAMES 10
+
+PCMAccumulator::PCMAccumulator(unsigned bytesPerFrame, double microsecondsPerByte,
+			       unsigned numOverlapFrames)
+  : fBuffer(NULL), fBufferSize(RING_SIZE_IN_FRAMES*bytesPerFrame), fIsMirrored(False),
+    fBytesPerFrame(bytesPerFrame), fNumOverlapFrames(numOverlapFrames),
+    fMicrosecondsPerByte(microsecondsPerByte), fReadOffset(0), fBytesFull(0), fBytesHeld(0) {
+  fMicrosecondsPerFrame = (unsigned)(fBytesPerFrame*fMicrosecondsPerByte + 0.5);
+  fPresentationTime.tv_sec = fPresentationTime.tv_usec = 0;
+
+  // Map the ring twice, back to back, so that data that wraps around its end
+  // can still be read (and written) in one piece.  If we can't, use a buffer
+  // twice the ring's size instead, and move its data back to the start each
+  // time we've consumed a ring's worth:
+  fIsMirrored = mapMirror();
+  if (!fIsMirrored) fBuffer = new unsigned char[2*fBufferSize];
+}
+
+PCMAccumulator::~PCMAccumulator() {
+  if (fIsMirrored) {
+    munmap(fBuffer, 2*fBufferSize);
+  } else {
+    delete[] fBuffer;
+  }
+}
+
+void PCMAccumulator::addData(unsigned numBytes, struct timeval presentationTime) {
+  // The presentation time of the start of our data follows exactly from this data's:
+  int uSecondsAdjustment = (int)(fBytesFull*fMicrosecondsPerByte);
+  presentationTime.tv_sec -= uSecondsAdjustment/MILLION;
+  uSecondsAdjustment %= MILLION;
+  if (presentationTime.tv_usec < uSecondsAdjustment) {
+    --presentationTime.tv_sec;
+    presentationTime.tv_usec += MILLION;
+  }
+  presentationTime.tv_usec -= uSecondsAdjustment;
+  fPresentationTime = presentationTime;
+  fBytesFull += numBytes;
+}
+
+void PCMAccumulator::consumeFrame(Boolean hold) {
+  if (hold) fBytesHeld += fBytesPerFrame;
+  fBytesFull -= fBytesPerFrame;
+  fReadOffset += fBytesPerFrame;
+  if (fIsMirrored && fReadOffset >= fBufferSize) {
+    fReadOffset -= fBufferSize; // the same data, in the first mapping
+  }
+
+  // The remaining data starts exactly one frame later:
+  fPresentationTime.tv_usec += fMicrosecondsPerFrame;
+  fPresentationTime.tv_sec += fPresentationTime.tv_usec/MILLION;
+  fPresentationTime.tv_usec %= MILLION;
+}
+
+void PCMAccumulator::prepareToWrite() {
+  // If we're not mirrored, and have consumed a ring's worth, move our data back
+  // to the start of the buffer.  (We don't do this when a frame is consumed,
+  // because a write into the buffer may then be in progress.)  Any held frames
+  // stay where they are; our data fits below them:
+  if (!fIsMirrored && fReadOffset >= fBufferSize) {
+    memmove(fBuffer, &fBuffer[fReadOffset], fBytesFull);
+    fReadOffset = 0;
+  }
+}
+
+void PCMAccumulator::releaseFrame() {
+  fBytesHeld -= fBytesPerFrame;
+}
+
+Boolean PCMAccumulator::mapMirror() {
+  long pageSize = sysconf(_SC_PAGESIZE);
+  if (pageSize <= 0) return False;
+  unsigned size = ((fBufferSize + pageSize - 1)/pageSize)*pageSize;
+
+  // The memory is an (unlinked) file in "/dev/shm", so that it can be mapped twice:
+  char fileName[] = "/dev/shm/wis-streamer-pcm-XXXXXX";
+  int fd = mkstemp(fileName);
+  if (fd < 0) return False;
+  unlink(fileName);
+
+  unsigned char* base = NULL;
+  do {
+    if (ftruncate(fd, size) < 0) break;
+
+    // Reserve the address space, then map the file into both halves of it:
+    void* reservation = mmap(NULL, 2*size, PROT_NONE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (reservation == MAP_FAILED) break;
+    base = (unsigned char*)reservation;
+
+    if (mmap(base, size, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0) == MAP_FAILED
+	|| mmap(base + size, size, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0)
+	   == MAP_FAILED) {
+      munmap(base, 2*size);
+      base = NULL;
+      break;
+    }
+  } while (0);
+  close(fd); // the mappings keep the memory
+
+  if (base == NULL) return False;
+  fBuffer = base;
+  fBufferSize = size;
+  return True;
+}
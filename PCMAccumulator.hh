@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A ring buffer that accumulates PCM audio for an encoder, and hands it out
+// a frame at a time, contiguously and without copying.  It also tracks the
+// presentation time of the data that it holds.
+// C++ header
+
+#ifndef _PCM_ACCUMULATOR_HH
+#define _PCM_ACCUMULATOR_HH
+
+#include <sys/time.h>
+#ifndef _BOOLEAN_HH
+#include <Boolean.hh>
+#endif
+
+class PCMAccumulator {
+public:
+  PCMAccumulator(unsigned bytesPerFrame, double microsecondsPerByte,
+		 unsigned numOverlapFrames = 0);
+      // Each frame that's handed out is preceded by "numOverlapFrames" frames of
+      // older data (which an encoder such as AAC's needs as well).
+  virtual ~PCMAccumulator();
+
+  // Filling:
+  void prepareToWrite();
+      // Call this before each write (i.e., before "writePtr()" and "bytesFree()"),
+      // when no other write is in progress.
+  unsigned char* writePtr() const { return fBuffer + fReadOffset + fBytesFull; }
+  unsigned bytesFree() const { return fBufferSize - fBytesHeld - fBytesFull; }
+  void addData(unsigned numBytes, struct timeval presentationTime);
+      // "numBytes" were written at "writePtr()".  "presentationTime" is that of
+      // these bytes; our input's presentation times are sample-accurate.
+
+  // Emptying:
+  Boolean haveFrame() const {
+    return fBytesFull >= (fNumOverlapFrames+1)*fBytesPerFrame;
+  }
+  unsigned char* overlapPtr() const { return fBuffer + fReadOffset; }
+  unsigned char* framePtr() const {
+    return fBuffer + fReadOffset + fNumOverlapFrames*fBytesPerFrame;
+  }
+  struct timeval const& presentationTime() const { return fPresentationTime; }
+      // of the data at "overlapPtr()"
+  void consumeFrame(Boolean hold = False); // moves on by one frame
+      // If "hold" is True, the frame's memory (including its overlap) isn't
+      // reused until "releaseFrame()" is called - e.g., once the frame has been
+      // encoded by another thread.  Frames are released in the order consumed.
+  void releaseFrame();
+
+  Boolean isMirrored() const { return fIsMirrored; }
+
+private:
+  Boolean mapMirror();
+
+private:
+  unsigned char* fBuffer;
+  unsigned fBufferSize; // the ring's size; the mapping (or buffer) is twice this
+  Boolean fIsMirrored; // whether the second half of the mapping is the first half again
+  unsigned fBytesPerFrame, fNumOverlapFrames;
+  double fMicrosecondsPerByte;
+  unsigned fMicrosecondsPerFrame;
+  unsigned fReadOffset, fBytesFull, fBytesHeld;
+  struct timeval fPresentationTime;
+};
+
+#endif
@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A filter that converts 16-bit PCM audio to another sampling frequency
+// (using a polyphase FIR filter), and/or to another number of channels.
+// Implementation
+
+#include "PCMResampler.hh"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define PCM_SIMD_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define PCM_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#define MILLION 1000000
+
+// We read at most this many frames of input at a time:
+#define INPUT_CHUNK_FRAMES 2048
+
+// Our filter is a windowed sinc, with this many zero crossings on each side
+// of its center (at the lower of the two sampling frequencies).  Its cutoff
+// is this fraction of the lower of the two Nyquist frequencies:
+#define ZERO_CROSSINGS 16
+#define CUTOFF 0.90
+#define KAISER_BETA 8.0 // for about 80 dB of stopband attenuation
+
+// The coefficients of each phase are 16-bit, and sum to 1.0:
+#define COEFFICIENT_BITS 14
+
+// Limits on the size of the filter:
+#define MAX_NUM_PHASES 1024
+#define MAX_NUM_TAPS 1024
+
+static unsigned gcd(unsigned a, unsigned b) {
+  while (b != 0) {
+    unsigned r = a%b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+static unsigned numTapsFor(unsigned upFactor, unsigned downFactor) {
+  unsigned larger = upFactor > downFactor ? upFactor : downFactor;
+  unsigned numTaps = (2*ZERO_CROSSINGS*larger + upFactor - 1)/upFactor;
+  return (numTaps + 15)&~15; // for our vector kernels
+}
+
+
+////////// Kernels //////////
+
+// The sum of "n" (a multiple of 16) products of samples "x" and coefficients "c".
+// (It can't overflow: the coefficients of a phase sum to 1.0, and their
+// magnitudes to well under 2.0 - i.e., 1<<(COEFFICIENT_BITS+1).)
+static int dotProduct_c(short const* x, short const* c, unsigned n) {
+  int sum = 0;
+  for (unsigned i = 0; i < n; ++i) sum += x[i]*c[i];
+  return sum;
+}
+
+// Averages the channels of "n" stereo frames:
+static void downmix_c(short* to, short const* from, unsigned n) {
+  for (unsigned i = 0; i < n; ++i) {
+    to[i] = (from[2*i] + from[2*i+1])>>1;
+  }
+}
+
+#ifdef PCM_SIMD_X86
+__attribute__((target("sse2")))
+static int dotProduct_sse2(short const* x, short const* c, unsigned n) {
+  __m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+  for (unsigned i = 0; i < n; i += 16) {
+    sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)&x[i]),
+					      _mm_loadu_si128((__m128i const*)&c[i])));
+    sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_loadu_si128((__m128i const*)&x[i+8]),
+					      _mm_loadu_si128((__m128i const*)&c[i+8])));
+  }
+  sum0 = _mm_add_epi32(sum0, sum1);
+  sum0 = _mm_add_epi32(sum0, _mm_shuffle_epi32(sum0, _MM_SHUFFLE(1,0,3,2)));
+  sum0 = _mm_add_epi32(sum0, _mm_shuffle_epi32(sum0, _MM_SHUFFLE(2,3,0,1)));
+  return _mm_cvtsi128_si32(sum0);
+}
+
+__attribute__((target("avx2")))
+static int dotProduct_avx2(short const* x, short const* c, unsigned n) {
+  __m256i sum = _mm256_setzero_si256();
+  for (unsigned i = 0; i < n; i += 16) {
+    sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_loadu_si256((__m256i const*)&x[i]),
+						  _mm256_loadu_si256((__m256i const*)&c[i])));
+  }
+  __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+  sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(1,0,3,2)));
+  sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, _MM_SHUFFLE(2,3,0,1)));
+  return _mm_cvtsi128_si32(sum4);
+}
+
+__attribute__((target("sse2")))
+static void downmix_sse2(short* to, short const* from, unsigned n) {
+  __m128i const ones = _mm_set1_epi16(1);
+  unsigned i = 0;
+  for (; i + 8 <= n; i += 8) {
+    // (Each pair of products is left + right, as 32 bits.)
+    __m128i lo = _mm_srai_epi32(_mm_madd_epi16(_mm_loadu_si128((__m128i const*)&from[2*i]),
+					       ones), 1);
+    __m128i hi = _mm_srai_epi32(_mm_madd_epi16(_mm_loadu_si128((__m128i const*)&from[2*i+8]),
+					       ones), 1);
+    _mm_storeu_si128((__m128i*)&to[i], _mm_packs_epi32(lo, hi));
+  }
+  downmix_c(&to[i], &from[2*i], n - i);
+}
+#endif
+
+#ifdef PCM_SIMD_NEON
+static int dotProduct_neon(short const* x, short const* c, unsigned n) {
+  int32x4_t sum0 = vdupq_n_s32(0), sum1 = vdupq_n_s32(0);
+  for (unsigned i = 0; i < n; i += 8) {
+    int16x8_t xv = vld1q_s16(&x[i]), cv = vld1q_s16(&c[i]);
+    sum0 = vmlal_s16(sum0, vget_low_s16(xv), vget_low_s16(cv));
+    sum1 = vmlal_s16(sum1, vget_high_s16(xv), vget_high_s16(cv));
+  }
+  sum0 = vaddq_s32(sum0, sum1);
+  int32x2_t sum2 = vadd_s32(vget_low_s32(sum0), vget_high_s32(sum0));
+  return vget_lane_s32(vpadd_s32(sum2, sum2), 0);
+}
+
+static void downmix_neon(short* to, short const* from, unsigned n) {
+  unsigned i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int16x8x2_t lr = vld2q_s16(&from[2*i]); // deinterleaves the channels
+    int32x4_t lo = vaddl_s16(vget_low_s16(lr.val[0]), vget_low_s16(lr.val[1]));
+    int32x4_t hi = vaddl_s16(vget_high_s16(lr.val[0]), vget_high_s16(lr.val[1]));
+    vst1q_s16(&to[i], vcombine_s16(vshrn_n_s32(lo, 1), vshrn_n_s32(hi, 1)));
+  }
+  downmix_c(&to[i], &from[2*i], n - i);
+}
+#endif
+
+// The best kernels for our CPU (all of which give the same results):
+static int (*dotProduct)(short const* x, short const* c, unsigned n) = dotProduct_c;
+static void (*downmix)(short* to, short const* from, unsigned n) = downmix_c;
+
+static void chooseKernels() {
+#ifdef PCM_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    dotProduct = dotProduct_avx2;
+  } else if (__builtin_cpu_supports("sse2")) {
+    dotProduct = dotProduct_sse2;
+  }
+  if (__builtin_cpu_supports("sse2")) downmix = downmix_sse2;
+#endif
+#ifdef PCM_SIMD_NEON
+  // We were built for a CPU that has NEON:
+  dotProduct = dotProduct_neon;
+  downmix = downmix_neon;
+#endif
+}
+
+
+////////// PCMResampler implementation //////////
+
+PCMResampler* PCMResampler
+::createNew(UsageEnvironment& env, FramedSource* inputPCMSource,
+	    unsigned inSamplingFrequency, unsigned inNumChannels,
+	    unsigned outSamplingFrequency, unsigned outNumChannels) {
+  if (inNumChannels < 1 || inNumChannels > 2 || outNumChannels < 1 || outNumChannels > 2
+      || !canConvert(inSamplingFrequency, outSamplingFrequency)) {
+    return NULL;
+  }
+  return new PCMResampler(env, inputPCMSource, inSamplingFrequency, inNumChannels,
+			  outSamplingFrequency, outNumChannels);
+}
+
+Boolean PCMResampler::canConvert(unsigned inSamplingFrequency,
+				 unsigned outSamplingFrequency) {
+  if (inSamplingFrequency == 0 || outSamplingFrequency == 0) return False;
+  unsigned divisor = gcd(inSamplingFrequency, outSamplingFrequency);
+  unsigned upFactor = outSamplingFrequency/divisor;
+  unsigned downFactor = inSamplingFrequency/divisor;
+  return upFactor <= MAX_NUM_PHASES && numTapsFor(upFactor, downFactor) <= MAX_NUM_TAPS;
+}
+
+PCMResampler
+::PCMResampler(UsageEnvironment& env, FramedSource* inputPCMSource,
+	       unsigned inSamplingFrequency, unsigned inNumChannels,
+	       unsigned outSamplingFrequency, unsigned outNumChannels)
+  : FramedFilter(env, inputPCMSource),
+    fInNumChannels(inNumChannels), fOutNumChannels(outNumChannels),
+    fCoefficients(NULL), fNumHistoryFrames(0), fNextPhase(0), fChunkIndex(0) {
+  static Boolean haveChosenKernels = False;
+  if (!haveChosenKernels) {
+    chooseKernels();
+    haveChosenKernels = True;
+  }
+
+  unsigned divisor = gcd(inSamplingFrequency, outSamplingFrequency);
+  fUpFactor = outSamplingFrequency/divisor;
+  fDownFactor = inSamplingFrequency/divisor;
+  fMicrosecondsPerInputFrame = (1.0*MILLION)/inSamplingFrequency;
+  if (fUpFactor == 1 && fDownFactor == 1) {
+    // We're only converting the number of channels:
+    fNumTaps = 1;
+    fDelayInMicroseconds = 0.0;
+  } else {
+    fNumTaps = numTapsFor(fUpFactor, fDownFactor);
+    fDelayInMicroseconds
+      = ((fUpFactor*fNumTaps - 1)/(2.0*fUpFactor))*fMicrosecondsPerInputFrame;
+    makeFilter();
+  }
+
+  // Our history starts as silence:
+  unsigned numPlanes = inNumChannels == 2 && outNumChannels == 2 ? 2 : 1;
+  for (unsigned i = 0; i < 2; ++i) {
+    fHistory[i] = NULL;
+    if (i < numPlanes) {
+      fHistory[i] = new short[fNumTaps - 1 + INPUT_CHUNK_FRAMES];
+      memset(fHistory[i], 0, (fNumTaps - 1)*sizeof (short));
+    }
+  }
+  fNumHistoryFrames = fNextIndex = fNumTaps - 1;
+
+  fChunkPresentationTime.tv_sec = fChunkPresentationTime.tv_usec = 0;
+  fInputBuffer = new unsigned char[INPUT_CHUNK_FRAMES*inNumChannels*sizeof (short)];
+}
+
+PCMResampler::~PCMResampler() {
+  delete[] fCoefficients;
+  delete[] fHistory[0]; delete[] fHistory[1];
+  delete[] fInputBuffer;
+}
+
+static double besselI0(double x) {
+  double sum = 1.0, term = 1.0;
+  for (unsigned k = 1; term > sum*1e-12; ++k) {
+    term *= (x/(2*k))*(x/(2*k));
+    sum += term;
+  }
+  return sum;
+}
+
+void PCMResampler::makeFilter() {
+  // The filter runs (in effect) at "fUpFactor" times our input frequency.  Its
+  // taps k*fUpFactor + phase form the phase that computes an output frame
+  // falling "phase"/"fUpFactor" of the way between two input frames:
+  unsigned const length = fUpFactor*fNumTaps;
+  double const center = (length - 1)/2.0;
+  double lowerFrequency = fUpFactor < fDownFactor ? (double)fUpFactor/fDownFactor : 1.0;
+  double const cutoff = CUTOFF*lowerFrequency/(2*fUpFactor); // in cycles per tap
+  double const i0Beta = besselI0(KAISER_BETA);
+
+  fCoefficients = new short[length];
+  double* taps = new double[fNumTaps];
+  for (unsigned phase = 0; phase < fUpFactor; ++phase) {
+    double sum = 0.0;
+    for (unsigned k = 0; k < fNumTaps; ++k) {
+      double t = k*fUpFactor + phase - center;
+      double sinc = t == 0.0 ? 2*cutoff : sin(2*M_PI*cutoff*t)/(M_PI*t);
+      double r = t/center;
+      taps[k] = sinc*besselI0(KAISER_BETA*sqrt(1.0 - r*r))/i0Beta;
+      sum += taps[k];
+    }
+
+    // Scale the phase to unity gain, and round it, putting the rounding error
+    // into its largest tap.  The taps are stored in reverse, to line up with
+    // the oldest-first input that each output frame is computed from:
+    short* c = &fCoefficients[phase*fNumTaps];
+    int total = 0;
+    unsigned largest = 0;
+    for (unsigned k = 0; k < fNumTaps; ++k) {
+      int v = (int)floor(taps[k]/sum*(1<<COEFFICIENT_BITS) + 0.5);
+      c[fNumTaps-1-k] = (short)v;
+      total += v;
+      if (abs(v) > abs(c[fNumTaps-1-largest])) largest = k;
+    }
+    c[fNumTaps-1-largest] += (1<<COEFFICIENT_BITS) - total;
+  }
+  delete[] taps;
+}
+
+void PCMResampler::doGetNextFrame() {
+  unsigned const bytesPerOutputFrame = fOutNumChannels*sizeof (short);
+  unsigned const maxNumFrames = fMaxSize/bytesPerOutputFrame;
+
+  // The presentation time of our next output frame:
+  double uSeconds = ((int)fNextIndex - fChunkIndex + (double)fNextPhase/fUpFactor)
+    *fMicrosecondsPerInputFrame - fDelayInMicroseconds;
+  long uSecondsAdjustment = (long)floor(uSeconds + 0.5);
+  struct timeval presentationTime = fChunkPresentationTime;
+  presentationTime.tv_sec += uSecondsAdjustment/MILLION;
+  presentationTime.tv_usec += uSecondsAdjustment%MILLION;
+  if (presentationTime.tv_usec < 0) {
+    --presentationTime.tv_sec;
+    presentationTime.tv_usec += MILLION;
+  } else if (presentationTime.tv_usec >= MILLION) {
+    ++presentationTime.tv_sec;
+    presentationTime.tv_usec -= MILLION;
+  }
+
+  unsigned numFrames = convert((short*)fTo, maxNumFrames);
+  if (numFrames > 0 || maxNumFrames == 0) {
+    // Complete delivery to the client:
+    fFrameSize = numFrames*bytesPerOutputFrame;
+    fNumTruncatedBytes = 0;
+    fPresentationTime = presentationTime;
+    fDurationInMicroseconds
+      = (unsigned)((numFrames*fDownFactor*fMicrosecondsPerInputFrame)/fUpFactor);
+    afterGetting(this);
+  } else {
+    // We need more input.  Ask for no more than the client has room for (once
+    // converted), so that we can convert it all at once:
+    unsigned numInputFrames = (maxNumFrames*fDownFactor)/fUpFactor;
+    if (numInputFrames == 0) numInputFrames = 1;
+    if (numInputFrames > INPUT_CHUNK_FRAMES) numInputFrames = INPUT_CHUNK_FRAMES;
+    fInputSource->getNextFrame(fInputBuffer, numInputFrames*fInNumChannels*sizeof (short),
+			       afterGettingFrame, this,
+			       FramedSource::handleClosure, this);
+  }
+}
+
+void PCMResampler
+::afterGettingFrame(void* clientData, unsigned frameSize,
+		    unsigned /*numTruncatedBytes*/,
+		    struct timeval presentationTime,
+		    unsigned /*durationInMicroseconds*/) {
+  PCMResampler* resampler = (PCMResampler*)clientData;
+  resampler->afterGettingFrame1(frameSize, presentationTime);
+}
+
+void PCMResampler::afterGettingFrame1(unsigned frameSize, struct timeval presentationTime) {
+  // Add the new frames to our history, converting them to planar channels:
+  unsigned numFrames = frameSize/(fInNumChannels*sizeof (short));
+  short const* from = (short const*)fInputBuffer;
+  short* to = &fHistory[0][fNumHistoryFrames];
+  if (fInNumChannels == 1) {
+    memcpy(to, from, numFrames*sizeof (short));
+  } else if (fOutNumChannels == 1) {
+    downmix(to, from, numFrames);
+  } else {
+    short* to1 = &fHistory[1][fNumHistoryFrames];
+    for (unsigned i = 0; i < numFrames; ++i) {
+      to[i] = from[2*i];
+      to1[i] = from[2*i+1];
+    }
+  }
+  fChunkPresentationTime = presentationTime;
+  fChunkIndex = fNumHistoryFrames;
+  fNumHistoryFrames += numFrames;
+
+  // Try again to complete delivery:
+  doGetNextFrame();
+}
+
+static inline short filterOutput(short const* x, short const* c, unsigned numTaps) {
+  int sum = (dotProduct(x, c, numTaps) + (1<<(COEFFICIENT_BITS-1)))>>COEFFICIENT_BITS;
+  return sum > 32767 ? 32767 : sum < -32768 ? -32768 : (short)sum;
+}
+
+unsigned PCMResampler::convert(short* to, unsigned maxNumFrames) {
+  // Each output frame advances our input position by "fDownFactor"/"fUpFactor" frames:
+  unsigned const indexStep = fDownFactor/fUpFactor, phaseStep = fDownFactor%fUpFactor;
+  unsigned numFrames = 0;
+
+  if (fCoefficients == NULL) {
+    // We're only converting the number of channels:
+    numFrames = fNumHistoryFrames - fNextIndex;
+    if (numFrames > maxNumFrames) numFrames = maxNumFrames;
+    short const* left = &fHistory[0][fNextIndex];
+    short const* right = fHistory[1] != NULL ? &fHistory[1][fNextIndex] : left;
+    if (fOutNumChannels == 1) {
+      memcpy(to, left, numFrames*sizeof (short));
+    } else {
+      for (unsigned i = 0; i < numFrames; ++i) {
+	to[2*i] = left[i];
+	to[2*i+1] = right[i];
+      }
+    }
+    fNextIndex += numFrames;
+  } else {
+    while (numFrames < maxNumFrames && fNextIndex < fNumHistoryFrames) {
+      // Our output frame is computed from the "fNumTaps" input frames ending
+      // with the one at "fNextIndex":
+      unsigned start = fNextIndex + 1 - fNumTaps;
+      short const* c = &fCoefficients[fNextPhase*fNumTaps];
+      short left = filterOutput(&fHistory[0][start], c, fNumTaps);
+      *to++ = left;
+      if (fOutNumChannels == 2) {
+	*to++ = fHistory[1] != NULL ? filterOutput(&fHistory[1][start], c, fNumTaps) : left;
+      }
+      ++numFrames;
+
+      fNextIndex += indexStep;
+      fNextPhase += phaseStep;
+      if (fNextPhase >= fUpFactor) {
+	fNextPhase -= fUpFactor;
+	++fNextIndex;
+      }
+    }
+  }
+
+  // Discard the input frames that we no longer need.  (If our next output frame
+  // needs none of the ones that we have, we discard them all; it then starts
+  // with a frame that we've yet to receive.)
+  unsigned numUnneeded = fNextIndex + 1 - fNumTaps;
+  if (numUnneeded > fNumHistoryFrames) numUnneeded = fNumHistoryFrames;
+  if (numUnneeded > 0) {
+    for (unsigned i = 0; i < 2; ++i) {
+      if (fHistory[i] == NULL) continue;
+      memmove(fHistory[i], &fHistory[i][numUnneeded],
+	      (fNumHistoryFrames - numUnneeded)*sizeof (short));
+    }
+    fNumHistoryFrames -= numUnneeded;
+    fNextIndex -= numUnneeded;
+    fChunkIndex -= numUnneeded;
+  }
+
+  return numFrames;
+}
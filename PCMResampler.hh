@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A filter that converts 16-bit PCM audio to another sampling frequency
+// (using a polyphase FIR filter), and/or to another number of channels.
+// C++ header
+
+#ifndef _PCM_RESAMPLER_HH
+#define _PCM_RESAMPLER_HH
+
+#include "FramedFilter.hh"
+
+class PCMResampler: public FramedFilter {
+public:
+  static PCMResampler* createNew(UsageEnvironment& env, FramedSource* inputPCMSource,
+				 unsigned inSamplingFrequency, unsigned inNumChannels,
+				 unsigned outSamplingFrequency, unsigned outNumChannels);
+      // Each number of channels must be 1 or 2.  Stereo is downmixed to mono by
+      // averaging the two channels; mono is upmixed by duplicating it.
+
+  static Boolean canConvert(unsigned inSamplingFrequency, unsigned outSamplingFrequency);
+      // False if the ratio of the two frequencies (in lowest terms) is too
+      // complex for our filter's tables
+
+protected:
+  PCMResampler(UsageEnvironment& env, FramedSource* inputPCMSource,
+	       unsigned inSamplingFrequency, unsigned inNumChannels,
+	       unsigned outSamplingFrequency, unsigned outNumChannels);
+      // called only by createNew()
+  virtual ~PCMResampler();
+
+private:
+  // redefined virtual functions:
+  virtual void doGetNextFrame();
+
+private:
+  static void afterGettingFrame(void* clientData, unsigned frameSize,
+				unsigned numTruncatedBytes,
+				struct timeval presentationTime,
+				unsigned durationInMicroseconds);
+  void afterGettingFrame1(unsigned frameSize, struct timeval presentationTime);
+  void makeFilter();
+  unsigned convert(short* to, unsigned maxNumFrames);
+      // converts as much of our input as we can, returning the number of frames
+
+private:
+  unsigned fInNumChannels, fOutNumChannels;
+  unsigned fUpFactor, fDownFactor; // the ratio of our output and input frequencies
+  unsigned fNumTaps; // per phase; a multiple of 16
+  short* fCoefficients; // "fUpFactor" phases of "fNumTaps" each (NULL if no resampling)
+  double fMicrosecondsPerInputFrame;
+  double fDelayInMicroseconds; // our filter's
+
+  // Our input, as one (or, if both are stereo, two) planar channels.  The first
+  // "fNumTaps"-1 frames are history, from earlier input:
+  short* fHistory[2];
+  unsigned fNumHistoryFrames;
+  unsigned fNextIndex, fNextPhase; // the position of our next output frame
+
+  // The presentation time of the input frame at index "fChunkIndex" (which
+  // can be negative, once that frame has left our history):
+  struct timeval fChunkPresentationTime;
+  int fChunkIndex;
+
+  unsigned char* fInputBuffer; // what we read from our input source
+};
+
+#endif
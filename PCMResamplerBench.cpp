@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2005-2006 WIS Technologies International Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and the associated README documentation file (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// A benchmark of "PCMResampler": the CPU cost, per output channel, of each
+// conversion, with each of the kernels that this CPU has.  ("make bench")
+// This includes "PCMResampler.cpp", so that it can choose the kernels.
+// Implementation
+
+#include "PCMResampler.cpp"
+#include <BasicUsageEnvironment.hh>
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_RUNS 5 // we report the fastest
+#define TONE_FREQUENCY 997
+
+// A source of 16-bit PCM (a tone, plus noise) that delivers each frame at
+// once, so that we can run a filter chain without an event loop:
+class TestPCMSource: public FramedSource {
+public:
+  TestPCMSource(UsageEnvironment& env, unsigned samplingFrequency, unsigned numChannels);
+  virtual ~TestPCMSource();
+
+private:
+  // redefined virtual functions:
+  virtual void doGetNextFrame();
+
+private:
+  unsigned fSamplingFrequency, fNumChannels;
+  short* fSamples; // one second's worth, which we repeat
+  unsigned fNextFrame; // within "fSamples"
+  double fNextTime; // in microseconds
+};
+
+TestPCMSource::TestPCMSource(UsageEnvironment& env,
+			     unsigned samplingFrequency, unsigned numChannels)
+  : FramedSource(env), fSamplingFrequency(samplingFrequency), fNumChannels(numChannels),
+    fNextFrame(0), fNextTime(0.0) {
+  fSamples = new short[samplingFrequency*numChannels];
+  unsigned seed = 12345;
+  for (unsigned i = 0; i < samplingFrequency; ++i) {
+    double x = 20000*sin((2*M_PI*TONE_FREQUENCY*i)/samplingFrequency);
+    for (unsigned c = 0; c < numChannels; ++c) {
+      seed = seed*1103515245 + 12345;
+      fSamples[i*numChannels + c] = (short)(x + (int)((seed>>16)%2000) - 1000);
+    }
+  }
+}
+
+TestPCMSource::~TestPCMSource() {
+  delete[] fSamples;
+}
+
+void TestPCMSource::doGetNextFrame() {
+  // Deliver up to 20 ms of audio (but no more than the rest of our second):
+  unsigned numFrames = fMaxSize/(fNumChannels*sizeof (short));
+  if (numFrames > fSamplingFrequency/50) numFrames = fSamplingFrequency/50;
+  if (numFrames > fSamplingFrequency - fNextFrame) numFrames = fSamplingFrequency - fNextFrame;
+  memcpy(fTo, &fSamples[fNextFrame*fNumChannels], numFrames*fNumChannels*sizeof (short));
+  fNextFrame = (fNextFrame + numFrames)%fSamplingFrequency;
+
+  fFrameSize = numFrames*fNumChannels*sizeof (short);
+  fNumTruncatedBytes = 0;
+  fPresentationTime.tv_sec = (long)(fNextTime/MILLION);
+  fPresentationTime.tv_usec = (long)fmod(fNextTime, MILLION);
+  fDurationInMicroseconds = 0;
+  fNextTime += (numFrames*(double)MILLION)/fSamplingFrequency;
+  afterGetting(this);
+}
+
+// The kernels that we can compare:
+struct Kernels {
+  char const* name;
+  int (*dotProduct)(short const* x, short const* c, unsigned n);
+  void (*downmix)(short* to, short const* from, unsigned n);
+};
+
+static unsigned numKernels = 0;
+static Kernels kernels[3];
+
+static void addKernels(char const* name,
+		       int (*dotProductFunc)(short const*, short const*, unsigned),
+		       void (*downmixFunc)(short*, short const*, unsigned)) {
+  kernels[numKernels].name = name;
+  kernels[numKernels].dotProduct = dotProductFunc;
+  kernels[numKernels].downmix = downmixFunc;
+  ++numKernels;
+}
+
+static void findKernels() {
+  addKernels("C", dotProduct_c, downmix_c);
+#ifdef PCM_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) addKernels("SSE2", dotProduct_sse2, downmix_sse2);
+  if (__builtin_cpu_supports("avx2")) addKernels("AVX2", dotProduct_avx2, downmix_sse2);
+#endif
+#ifdef PCM_SIMD_NEON
+  addKernels("NEON", dotProduct_neon, downmix_neon);
+#endif
+}
+
+static unsigned numOutputBytes;
+static void afterGettingFrame(void* /*clientData*/, unsigned frameSize,
+			      unsigned /*numTruncatedBytes*/,
+			      struct timeval /*presentationTime*/,
+			      unsigned /*durationInMicroseconds*/) {
+  numOutputBytes = frameSize;
+}
+
+static double cpuMicroseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+  return now.tv_sec*(double)MILLION + now.tv_nsec/1000.0;
+}
+
+// Returns the CPU time (in microseconds) taken to convert "numSeconds" of audio:
+static double runConversion(UsageEnvironment& env, Kernels const& k,
+			    unsigned inFrequency, unsigned inNumChannels,
+			    unsigned outFrequency, unsigned outNumChannels,
+			    unsigned numSeconds) {
+  PCMResampler* resampler
+    = PCMResampler::createNew(env, new TestPCMSource(env, inFrequency, inNumChannels),
+			      inFrequency, inNumChannels, outFrequency, outNumChannels);
+  // (after "createNew()", which chooses the best kernels the first time)
+  dotProduct = k.dotProduct;
+  downmix = k.downmix;
+
+  // Read 20 ms of output at a time, as an encoder would:
+  unsigned const bytesPerOutputFrame = outNumChannels*sizeof (short);
+  unsigned const maxSize = (outFrequency/50)*bytesPerOutputFrame;
+  unsigned char* buffer = new unsigned char[maxSize];
+  unsigned long numFramesLeft = (unsigned long)numSeconds*outFrequency;
+
+  double start = cpuMicroseconds();
+  while (numFramesLeft > 0) {
+    numOutputBytes = 0;
+    resampler->getNextFrame(buffer, maxSize, afterGettingFrame, NULL, NULL, NULL);
+    unsigned numFrames = numOutputBytes/bytesPerOutputFrame;
+    numFramesLeft -= numFrames < numFramesLeft ? numFrames : numFramesLeft;
+  }
+  double elapsed = cpuMicroseconds() - start;
+
+  delete[] buffer;
+  Medium::close(resampler); // also closes our source
+  return elapsed;
+}
+
+static void usage(char const* progName) {
+  fprintf(stderr, "usage: %s [-s seconds] [inFrequency inChannels outFrequency outChannels]\n",
+	  progName);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  TaskScheduler* scheduler = BasicTaskScheduler::createNew();
+  UsageEnvironment* env = BasicUsageEnvironment::createNew(*scheduler);
+  char const* progName = argv[0];
+
+  unsigned numSeconds = 20;
+  if (argc > 2 && strcmp(argv[1], "-s") == 0) {
+    numSeconds = atoi(argv[2]);
+    argc -= 2; argv += 2;
+  }
+  if (numSeconds == 0 || (argc != 1 && argc != 5)) usage(progName);
+
+  // By default, the conversions from a 48 kHz stereo capture that our
+  // encoders most often need:
+  struct { unsigned inFrequency, inNumChannels, outFrequency, outNumChannels; }
+  conversions[] = {
+    { 48000, 2, 8000, 1 },  // AMR
+    { 48000, 2, 16000, 1 },
+    { 48000, 2, 44100, 2 },
+    { 48000, 2, 48000, 1 }  // downmixing only
+  };
+  unsigned numConversions = sizeof conversions/sizeof conversions[0];
+  if (argc == 5) {
+    conversions[0].inFrequency = atoi(argv[1]);
+    conversions[0].inNumChannels = atoi(argv[2]);
+    conversions[0].outFrequency = atoi(argv[3]);
+    conversions[0].outNumChannels = atoi(argv[4]);
+    numConversions = 1;
+  }
+
+  for (unsigned i = 0; i < numConversions; ++i) {
+    if (conversions[i].inNumChannels < 1 || conversions[i].inNumChannels > 2
+	|| conversions[i].outNumChannels < 1 || conversions[i].outNumChannels > 2
+	|| !PCMResampler::canConvert(conversions[i].inFrequency, conversions[i].outFrequency)) {
+      fprintf(stderr, "Can't convert %u Hz, %u channel(s) to %u Hz, %u channel(s)\n",
+	      conversions[i].inFrequency, conversions[i].inNumChannels,
+	      conversions[i].outFrequency, conversions[i].outNumChannels);
+      return 1;
+    }
+  }
+
+  findKernels();
+  printf("CPU time per output channel, in us per second of audio (best of %d x %u s):\n",
+	 NUM_RUNS, numSeconds);
+  printf("%-26s", "");
+  for (unsigned k = 0; k < numKernels; ++k) printf("%8s", kernels[k].name);
+  printf("\n");
+
+  for (unsigned i = 0; i < numConversions; ++i) {
+    unsigned inFrequency = conversions[i].inFrequency;
+    unsigned inNumChannels = conversions[i].inNumChannels;
+    unsigned outFrequency = conversions[i].outFrequency;
+    unsigned outNumChannels = conversions[i].outNumChannels;
+    char label[40];
+    snprintf(label, sizeof label, "%u/%u -> %u/%u:",
+	     inFrequency, inNumChannels, outFrequency, outNumChannels);
+    printf("%-26s", label);
+    for (unsigned k = 0; k < numKernels; ++k) {
+      double best = 0.0;
+      for (unsigned run = 0; run < NUM_RUNS; ++run) {
+	double us = runConversion(*env, kernels[k], inFrequency, inNumChannels,
+				  outFrequency, outNumChannels, numSeconds);
+	if (run == 0 || us < best) best = us;
+      }
+      printf("%8.0f", best/numSeconds/outNumChannels);
+    }
+    printf("\n");
+  }
+
+  env->reclaim();
+  delete scheduler;
+  return 0;
+}
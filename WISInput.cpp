@@ -20,29 +20,57 @@
 // Implementation
 
 #include "WISInput.hh"
+#include "CaptureReplayer.hh"
+#include "PCMResampler.hh"
+#include "BitrateController.hh"
 #include "Options.hh"
 #include "Err.hh"
 #include <fcntl.h>
+#include <errno.h>
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/poll.h>
+#include <sys/eventfd.h>
 #include <linux/soundcard.h>
 #ifndef __LINUX_VIDEODEV_H
 #include "videodev.h"
 #endif
 #include "go7007.h"
+
+// (Newer) drivers say which clock they timestamp video buffers from:
+#ifndef V4L2_BUF_FLAG_TIMESTAMP_MASK
+#define V4L2_BUF_FLAG_TIMESTAMP_MASK		0xe000
+#define V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC	0x2000
+#endif
 ////////// WISOpenFileSource definition //////////
 
-// A common "FramedSource" subclass, used for reading from an open file:
+// A common "FramedSource" subclass, used for reading from an open file.
+// Data is captured into a ring - either by us, from within the event loop
+// (draining everything that's available each time our file becomes readable),
+// or else by our input's capture thread - and is delivered from there.
+// Either way, we stay registered with the event loop for the whole session,
+// rather than for each frame.
 
 class WISOpenFileSource: public FramedSource {
+public:
+  void resumeReadHandling();
+      // called when we may have room to capture more data
+  void suspendCapture(); // stops capturing (for now)
+  void resumeCapture(Boolean hadStarted);
+      // resumes capturing, after "suspendCapture()"
+
 protected:
-  WISOpenFileSource(UsageEnvironment& env, WISInput& input, int fileNo);
+  WISOpenFileSource(UsageEnvironment& env, WISInput& input, int fileNo,
+		    CaptureRing* ring, int ringEventFd);
   virtual ~WISOpenFileSource();
 
-  virtual void readFromFile() = 0;
+  virtual Boolean startCapturing() = 0;
+  virtual void captureAvailableData() = 0;
+  virtual Boolean canCapture(); // returns False if captured data has nowhere to go
+  virtual Boolean deliverFrame(CapturedFrame& frame) = 0;
+      // returns True iff "frame" has now been completely delivered
 
 private: // redefined virtual functions:
   virtual void doGetNextFrame();
@@ -50,10 +78,17 @@ private: // redefined virtual functions:
 private:
   static void incomingDataHandler(WISOpenFileSource* source, int mask);
   void incomingDataHandler1();
+  void startReadHandling();
+  void stopReadHandling();
+  Boolean deliverFromRing();
 
 protected:
   WISInput& fInput;
   int fFileNo;
+  CaptureRing* fRing;
+  int fReadyFd; // the fd that we wait on: either "fFileNo", or our ring's event fd
+  Boolean fCapturesInEventLoop; // i.e., "fReadyFd" is "fFileNo"
+  Boolean fReadHandlingIsOn;
 };
 
 
@@ -65,7 +100,10 @@ public:
   virtual ~WISVideoOpenFileSource();
 
 protected: // redefined virtual functions:
-  virtual void readFromFile();
+  virtual Boolean startCapturing();
+  virtual void captureAvailableData();
+  virtual Boolean canCapture();
+  virtual Boolean deliverFrame(CapturedFrame& frame);
 };
 
 
@@ -77,19 +115,35 @@ public:
   virtual ~WISAudioOpenFileSource();
 
 protected: // redefined virtual functions:
-  virtual void readFromFile();
+  virtual Boolean startCapturing();
+  virtual void captureAvailableData();
+  virtual Boolean deliverFrame(CapturedFrame& frame);
 };
 
+// Audio is read into our ring in chunks (of at most) this size:
+#define AUDIO_CAPTURE_CHUNK_SIZE 4096
 
 ////////// WISInput implementation //////////
 
-WISInput* WISInput::createNew(UsageEnvironment& env) {
-  if (!fHaveInitialized) {
-    if (!initialize(env)) return NULL;
-    fHaveInitialized = True;
+WISInput* WISInput::createNew(UsageEnvironment& env, char const* deviceName) {
+  WISInput* newInput = new WISInput(env, deviceName);
+  if (!newInput->initialize(env, NULL)) {
+    Medium::close(newInput);
+    return NULL;
   }
 
-  return new WISInput(env);
+  return newInput;
+}
+
+WISInput* WISInput::createNew(UsageEnvironment& env, char const* deviceName,
+			      WISInputHandoverState const& handoverState) {
+  WISInput* newInput = new WISInput(env, deviceName);
+  if (!newInput->initialize(env, &handoverState)) {
+    Medium::close(newInput);
+    return NULL;
+  }
+
+  return newInput;
 }
 
 FramedSource* WISInput::videoSource() {
@@ -103,21 +157,131 @@ FramedSource* WISInput::audioSource() {
   if (fOurAudioSource == NULL) {
     fOurAudioSource = new WISAudioOpenFileSource(envir(), *this);
   }
-  return fOurAudioSource;
+  if (audioCaptureSamplingFrequency == audioSamplingFrequency
+      && audioCaptureNumChannels == audioNumChannels) {
+    return fOurAudioSource;
+  }
+
+  // Add a filter that converts the captured audio to what we stream.  (This
+  // filter belongs to our caller; closing it also closes "fOurAudioSource".)
+  return PCMResampler::createNew(envir(), fOurAudioSource,
+				 audioCaptureSamplingFrequency, audioCaptureNumChannels,
+				 audioSamplingFrequency, audioNumChannels);
 }
 
-WISInput::WISInput(UsageEnvironment& env)
-  : Medium(env) {
+// The "/dev/videoN" devices that are currently in use by a "WISInput" object:
+static unsigned videoDevicesInUse = 0; // a bit mask, indexed by N
+
+WISInput::WISInput(UsageEnvironment& env, char const* deviceName)
+  : Medium(env),
+    fDeviceName(strDup(deviceName)), fVideoDeviceNum(-1),
+    fOurVideoFileNo(-1), fOurVideoSource(NULL),
+    fOurAudioFileNo(-1), fOurAudioSource(NULL),
+#ifdef HAVE_ALSA
+    fPCM(NULL), fNumAudioXruns(0),
+#endif
+    fNumBuffers(0), fCaptureStart(True),
+    fVideoRing(NULL), fAudioRing(NULL),
+    fVideoEventFd(-1), fAudioEventFd(-1), fWakeupEventFd(-1),
+    fCaptureThreadIsRunning(False),
+    fCaptureVideo(False), fCaptureAudio(False), fStopCaptureThread(False),
+    fNumCaptureErrors(0), fCaptureIsSuspended(False),
+    fHaveVideoSequence(False), fLastVideoSequence(0),
+    fNumCapturedVideoFrames(0), fNumDroppedVideoFrames(0), fMaxVideoFramesPerBatch(0),
+    fAudioClock(audioCaptureSamplingFrequency*audioCaptureNumChannels*2),
+    fReplayer(NULL), fVideoReplayTask(NULL), fAudioReplayTask(NULL),
+    fNumReplayedVideoFrames(0), fNumReplayedAudioBytes(0),
+    fBitrateController(NULL), fPendingVideoBitrate(0),
+    fCurrentVideoBitrate(videoBitrate), fNumFailedBitrateChanges(0),
+    fVideoFrameLendingEnabled(False), fLentBufferIndex(-1), fLentVideoFrameSize(0),
+    fNumLentVideoFrames(0), fNumCopiedVideoFrames(0) {
 }
 
 WISInput::~WISInput() {
+  Medium::close(fBitrateController);
+  Medium::close(fOurVideoSource);
+  Medium::close(fOurAudioSource);
+
+  envir().taskScheduler().unscheduleDelayedTask(fVideoReplayTask);
+  envir().taskScheduler().unscheduleDelayedTask(fAudioReplayTask);
+  delete fReplayer;
+
+  if (fCaptureThreadIsRunning) {
+    fStopCaptureThread = True;
+    wakeUp(fWakeupEventFd);
+    pthread_join(fCaptureThread, NULL);
+  }
+  if (fVideoEventFd >= 0) ::close(fVideoEventFd);
+  if (fAudioEventFd >= 0) ::close(fAudioEventFd);
+  if (fWakeupEventFd >= 0) ::close(fWakeupEventFd);
+  delete fVideoRing;
+  delete fAudioRing;
+
+  for (unsigned i = 0; i < fNumBuffers; ++i) {
+    munmap(fBuffers[i].addr, fBuffers[i].length);
+  }
+#ifdef HAVE_ALSA
+  if (fPCM != NULL) {
+    snd_pcm_close(fPCM);
+    fOurAudioFileNo = -1; // it belonged to "fPCM"
+  }
+#endif
+  if (fOurVideoFileNo >= 0) ::close(fOurVideoFileNo);
+  if (fOurAudioFileNo >= 0) ::close(fOurAudioFileNo);
+  if (fVideoDeviceNum >= 0) videoDevicesInUse &=~ (1<<fVideoDeviceNum);
+
+  delete[] fDeviceName;
+}
+
+static void printErr(UsageEnvironment& env, char const* str = NULL) {
+  if (str != NULL) err(env) << str;
+  env << ": " << strerror(env.getErrno()) << "\n";
 }
 
-Boolean WISInput::initialize(UsageEnvironment& env) {
+Boolean WISInput::initialize(UsageEnvironment& env,
+			    WISInputHandoverState const* handoverState) {
   do {
-    if (!openFiles(env)) break;
-    if (!initALSA(env)) break;
-    if (!initV4L(env)) break;
+    if (replayVideoFileName != NULL || replayAudioFileName != NULL || replaySynthetic) {
+      // We replay files (or synthetic data), rather than using a capture device:
+      fReplayer = CaptureReplayer::createNew(env, replayVideoFileName, replayAudioFileName,
+					     replaySynthetic);
+      if (fReplayer == NULL) break;
+      if (videoFormat != VFMT_NONE && !fReplayer->hasVideo()) {
+	err(env) << "There's no video to replay (use \"-replayvideo\", \"-synthetic\" or \"-nv\")\n";
+	break;
+      }
+      if (audioFormat != AFMT_NONE && !fReplayer->hasAudio()) {
+	err(env) << "There's no audio to replay (use \"-replayaudio\", \"-synthetic\" or \"-na\")\n";
+	break;
+      }
+    } else if (handoverState != NULL) {
+      // Another process has handed its (already initialized) device over to us:
+      if (!takeOverDevice(env, *handoverState)) break;
+    } else {
+      if (!openFiles(env)) break;
+      if (!initALSA(env)) break;
+      if (!initV4L(env)) break;
+    }
+
+    // Create the rings that captured data gets queued in.
+    // (Don't let the video ring hold more than half of the driver's buffers.)
+    unsigned videoRingDepth = captureRingDepth;
+    if (fReplayer == NULL && videoRingDepth > fNumBuffers/2) videoRingDepth = fNumBuffers/2;
+    fVideoRing = new CaptureRing(videoRingDepth);
+    fAudioRing = new CaptureRing(captureRingDepth, AUDIO_CAPTURE_CHUNK_SIZE);
+
+    if (useCaptureThread || fReplayer != NULL) {
+      // Create the event fds that our capture thread (or replay tasks) will signal:
+      fVideoEventFd = eventfd(0, EFD_NONBLOCK);
+      fAudioEventFd = eventfd(0, EFD_NONBLOCK);
+      fWakeupEventFd = eventfd(0, EFD_NONBLOCK);
+      if (fVideoEventFd < 0 || fAudioEventFd < 0 || fWakeupEventFd < 0) {
+	printErr(env, "eventfd() failed");
+	break;
+      }
+    }
+
+    if (rateControl) fBitrateController = BitrateController::createNew(env, *this);
 
     return True;
   } while (0);
@@ -126,9 +290,30 @@ Boolean WISInput::initialize(UsageEnvironment& env) {
   return False;
 }
 
-static void printErr(UsageEnvironment& env, char const* str = NULL) {
-  if (str != NULL) err(env) << str;
-  env << ": " << strerror(env.getErrno()) << "\n";
+Boolean WISInput::deviceMatches(char const* videoDevicePath) const {
+  if (fDeviceName == NULL) return True; // any device will do
+
+  unsigned len;
+  if (fDeviceName[0] == '/') {
+    // A sysfs path - of the video device itself, or of one of its ancestors
+    // (e.g., the USB device):
+    char canonpath[PATH_MAX];
+    if (realpath(fDeviceName, canonpath) == NULL) return False;
+    len = strlen(canonpath);
+    return strncmp(videoDevicePath, canonpath, len) == 0
+      && (videoDevicePath[len] == '\0' || videoDevicePath[len] == '/');
+  }
+
+  // A USB address (e.g., "1-2.3").  Look for it as a component of the video
+  // device's sysfs path - either alone, or as the prefix of an interface name
+  // (e.g., "1-2.3:1.0"):
+  len = strlen(fDeviceName);
+  for (char const* p = videoDevicePath; (p = strchr(p, '/')) != NULL; ) {
+    ++p;
+    if (strncmp(p, fDeviceName, len) == 0
+	&& (p[len] == '\0' || p[len] == '/' || p[len] == ':')) return True;
+  }
+  return False;
 }
 
 Boolean WISInput::openFiles(UsageEnvironment& env) {
@@ -150,34 +335,45 @@ Boolean WISInput::openFiles(UsageEnvironment& env) {
       break;
     }
     
-    // Find a Video4Linux device associated with the go7007 driver:
+    // Find a Video4Linux device associated with the go7007 driver
+    // (and, if we were given a device name, with that particular device):
     char sympath[PATH_MAX], sympath2[PATH_MAX], canonpath[PATH_MAX], gopath[PATH_MAX];
     int const maxFileNum = 20;
     for (i = 0; i < maxFileNum; ++i) {
+      if (videoDevicesInUse&(1<<i)) continue; // it's being used by another "WISInput"
       snprintf(sympath, sizeof sympath, "/sys/class/video4linux/video%d/driver", i);
       snprintf(sympath2, sizeof sympath2, "/sys/class/video4linux/video%d/device/driver", i);
-      if (realpath(sympath, canonpath) != NULL) {
-	if (strcmp(strrchr(canonpath, '/') + 1, "go7007") == 0) break;
-      } else if (realpath(sympath2, canonpath) != NULL) { // alternative path
-        if (strcmp(strrchr(canonpath, '/') + 1, "go7007") == 0) break;
-      }
+      if (realpath(sympath, canonpath) == NULL
+	  && realpath(sympath2, canonpath) == NULL) continue; // alternative path
+      if (strcmp(strrchr(canonpath, '/') + 1, "go7007") != 0) continue;
+
+      snprintf(sympath, sizeof sympath, "/sys/class/video4linux/video%d/device", i);
+      if (realpath(sympath, gopath) != NULL && deviceMatches(gopath)) break;
     }
-    snprintf(sympath, sizeof sympath, "/sys/class/video4linux/video%d/device", i);
-    if (i == maxFileNum || realpath(sympath, gopath) == NULL) {
-      err(env) << "Driver loaded but no GO7007SB devices found.\n";
+    if (i == maxFileNum) {
+      if (fDeviceName != NULL) {
+	err(env) << "No GO7007SB device found at \"" << fDeviceName << "\".\n";
+      } else {
+	err(env) << "Driver loaded but no (unused) GO7007SB devices found.\n";
+      }
       env << "Is the device connected properly?\n";
       break;
     }
+#else
+    while (videoDevicesInUse&(1<<i)) ++i;
 #endif
 
     // Open it:
     char vDeviceName[PATH_MAX];
     snprintf(vDeviceName, sizeof vDeviceName, "/dev/video%d", i);
-    fOurVideoFileNo = open(vDeviceName, O_RDWR);
+    fOurVideoFileNo = open(vDeviceName, O_RDWR|O_NONBLOCK);
+        // non-blocking, so that we can dequeue every ready buffer at once
     if (fOurVideoFileNo < 0) {
       err(env) << "Unable to open \"" << vDeviceName << "\""; printErr(env);
       break;
     }
+    fVideoDeviceNum = i;
+    videoDevicesInUse |= 1<<i;
   
 #ifndef IGNORE_DRIVER_CHECK
     // Find the ALSA device associated with this USB address:
@@ -192,6 +388,14 @@ Boolean WISInput::openFiles(UsageEnvironment& env) {
     }
 #endif
 
+#ifdef HAVE_ALSA
+    if (audioUseALSA) {
+      // Capture directly from the ALSA PCM device, rather than via OSS emulation:
+      if (!openALSAPCM(env, i)) break;
+      return True;
+    }
+#endif
+
     // Find the OSS emulation minor number for this ALSA device:
     char const* ossFileName = "/proc/asound/oss/devices";
     FILE* file = fopen(ossFileName, "r");
@@ -265,6 +469,10 @@ Boolean WISInput::openFiles(UsageEnvironment& env) {
 }
 
 Boolean WISInput::initALSA(UsageEnvironment& env) {
+#ifdef HAVE_ALSA
+  if (fPCM != NULL) return setALSAPCMParams(env);
+#endif
+
   do {
     int arg;
 #ifdef WORDS_BIGENDIAN
@@ -276,12 +484,12 @@ Boolean WISInput::initALSA(UsageEnvironment& env) {
       printErr(env, "SNDCTL_DSP_SETFMT");
       break;
     }
-    arg = audioSamplingFrequency;
+    arg = audioCaptureSamplingFrequency;
     if (ioctl(fOurAudioFileNo, SNDCTL_DSP_SPEED, &arg) < 0) {
       printErr(env, "SNDCTL_DSP_SPEED");
       break;
     }
-    arg = audioNumChannels > 1 ? 1 : 0;
+    arg = audioCaptureNumChannels > 1 ? 1 : 0;
     if (ioctl(fOurAudioFileNo, SNDCTL_DSP_STEREO, &arg) < 0) {
       printErr(env, "SNDCTL_DSP_STEREO");
       break;
@@ -294,6 +502,95 @@ Boolean WISInput::initALSA(UsageEnvironment& env) {
   return False;
 }
 
+#ifdef HAVE_ALSA
+// The PCM's ring buffer holds this many periods:
+#define ALSA_PERIODS_PER_BUFFER 8
+
+Boolean WISInput::openALSAPCM(UsageEnvironment& env, int cardNum) {
+  char pcmName[30];
+  snprintf(pcmName, sizeof pcmName, "hw:%d,0", cardNum);
+  int ret = snd_pcm_open(&fPCM, pcmName, SND_PCM_STREAM_CAPTURE, SND_PCM_NONBLOCK);
+  if (ret < 0) {
+    fPCM = NULL;
+    err(env) << "Unable to open ALSA PCM device \"" << pcmName << "\": "
+	     << snd_strerror(ret) << "\n";
+    return False;
+  }
+
+  // We wait for audio data on the PCM's (single) poll descriptor:
+  struct pollfd pfd;
+  if (snd_pcm_poll_descriptors(fPCM, &pfd, 1) != 1) {
+    err(env) << "Unable to get a poll descriptor for ALSA PCM device \""
+	     << pcmName << "\"\n";
+    return False;
+  }
+  fOurAudioFileNo = pfd.fd;
+
+  return True;
+}
+
+Boolean WISInput::setALSAPCMParams(UsageEnvironment& env) {
+  char const* failedOperation;
+  int ret;
+  do {
+    snd_pcm_hw_params_t* hwParams;
+    snd_pcm_hw_params_alloca(&hwParams);
+    failedOperation = "snd_pcm_hw_params_any";
+    if ((ret = snd_pcm_hw_params_any(fPCM, hwParams)) < 0) break;
+    failedOperation = "snd_pcm_hw_params_set_access";
+    if ((ret = snd_pcm_hw_params_set_access(fPCM, hwParams,
+					    SND_PCM_ACCESS_MMAP_INTERLEAVED)) < 0) break;
+    failedOperation = "snd_pcm_hw_params_set_format";
+#ifdef WORDS_BIGENDIAN
+    if ((ret = snd_pcm_hw_params_set_format(fPCM, hwParams, SND_PCM_FORMAT_S16_BE)) < 0) break;
+#else
+    if ((ret = snd_pcm_hw_params_set_format(fPCM, hwParams, SND_PCM_FORMAT_S16_LE)) < 0) break;
+#endif
+    failedOperation = "snd_pcm_hw_params_set_channels";
+    if ((ret = snd_pcm_hw_params_set_channels(fPCM, hwParams,
+					      audioCaptureNumChannels)) < 0) break;
+    failedOperation = "snd_pcm_hw_params_set_rate";
+    if ((ret = snd_pcm_hw_params_set_rate(fPCM, hwParams,
+					  audioCaptureSamplingFrequency, 0)) < 0) break;
+
+    // Capture in periods of the requested size (by default, 20 ms):
+    snd_pcm_uframes_t periodSize
+      = audioPeriodFrames > 0 ? audioPeriodFrames : audioCaptureSamplingFrequency/50;
+    failedOperation = "snd_pcm_hw_params_set_period_size_near";
+    if ((ret = snd_pcm_hw_params_set_period_size_near(fPCM, hwParams,
+						      &periodSize, NULL)) < 0) break;
+    snd_pcm_uframes_t bufferSize = periodSize*ALSA_PERIODS_PER_BUFFER;
+    failedOperation = "snd_pcm_hw_params_set_buffer_size_near";
+    if ((ret = snd_pcm_hw_params_set_buffer_size_near(fPCM, hwParams, &bufferSize)) < 0) break;
+    failedOperation = "snd_pcm_hw_params";
+    if ((ret = snd_pcm_hw_params(fPCM, hwParams)) < 0) break;
+    if (audioPeriodFrames > 0 && periodSize != audioPeriodFrames) {
+      env << "Using an ALSA period size of " << (unsigned)periodSize << " frames\n";
+    }
+
+    // Wake us up once per period, and timestamp the hardware pointer each time
+    // that it's updated:
+    snd_pcm_sw_params_t* swParams;
+    snd_pcm_sw_params_alloca(&swParams);
+    failedOperation = "snd_pcm_sw_params_current";
+    if ((ret = snd_pcm_sw_params_current(fPCM, swParams)) < 0) break;
+    failedOperation = "snd_pcm_sw_params_set_avail_min";
+    if ((ret = snd_pcm_sw_params_set_avail_min(fPCM, swParams, periodSize)) < 0) break;
+    failedOperation = "snd_pcm_sw_params_set_tstamp_mode";
+    if ((ret = snd_pcm_sw_params_set_tstamp_mode(fPCM, swParams,
+						 SND_PCM_TSTAMP_ENABLE)) < 0) break;
+    failedOperation = "snd_pcm_sw_params";
+    if ((ret = snd_pcm_sw_params(fPCM, swParams)) < 0) break;
+
+    return True;
+  } while (0);
+
+  // An error occurred:
+  err(env) << failedOperation << " failed: " << snd_strerror(ret) << "\n";
+  return False;
+}
+#endif
+
 static Boolean checkChange(UsageEnvironment& env,
 			   struct v4l2_queryctrl const& ctrl, v4l2_control& newCtrl,
 			   char const* ctrlName, int ctrlId, int newValue) {
@@ -330,14 +627,6 @@ static Boolean areChangingValue(UsageEnvironment& env,
   return False;
 }
 
-#define MAX_BUFFERS     32
-static struct {
-  unsigned char *addr;
-  unsigned int length;
-} buffers[MAX_BUFFERS];
-
-static int capture_start = 1;
-
 Boolean WISInput::initV4L(UsageEnvironment& env) {
   do {
     // Begin by enumerating the available video input ports, and noting which of these
@@ -482,43 +771,30 @@ Boolean WISInput::initV4L(UsageEnvironment& env) {
       }
     }
 
-#ifndef NEW_BITRATE_SETTING_CODE
     // Set the bitrate:
-    if (ioctl(fOurVideoFileNo, GO7007IOC_S_BITRATE, &videoBitrate) < 0) {
+    if (!setEncoderBitrate(videoBitrate)) {
       printErr(env, "Unable to set video bitrate");
       break;
     }
-#else
-    struct v4l2_mpeg_compression compression;
-    memset(&compression, 0, sizeof compression);
-    if( videoQuant != 0) {
-      compression.st_bitrate.mode = V4L2_BITRATE_VBR;
-      compression.st_bitrate.max = videoQuant;
-      compression.st_bitrate.min = videoQuant;
-      compression.st_bitrate.target = 0;
-    }
-    else {
-      compression.st_bitrate.mode = V4L2_BITRATE_CBR;
-      compression.st_bitrate.max = videoBitrate/1000;
-      compression.st_bitrate.min = videoBitrate/1000;
-      compression.st_bitrate.target = videoBitrate/1000;
-    }
-    if (ioctl(fOurVideoFileNo, VIDIOC_S_MPEGCOMP, &compression) < 0) {
-      printErr(env, "Unable to set MPEG bitrate parameters");
-      break;
-    }
-#endif
 
     // Request that buffers be allocated for memory mapping:
     struct v4l2_requestbuffers req;
     memset(&req, 0, sizeof req);
     req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
     req.memory = V4L2_MEMORY_MMAP;
-    req.count = MAX_BUFFERS;
+    req.count = videoNumBuffers;
+    if (req.count > MAX_BUFFERS) {
+      warn(env) << "Using only " << MAX_BUFFERS << " video capture buffers\n";
+      req.count = MAX_BUFFERS;
+    }
     if (ioctl(fOurVideoFileNo, VIDIOC_REQBUFS, &req) < 0) {
       printErr(env, "VIDIOC_REQBUFS");
       break;
     }
+    if (req.count > MAX_BUFFERS) req.count = MAX_BUFFERS; // the driver gave us extra
+    if (req.count != videoNumBuffers) {
+      env << "Using " << req.count << " video capture buffers\n";
+    }
     
     // Map each of the buffers into this process's memory,
     // and queue them for frame capture:
@@ -532,18 +808,120 @@ Boolean WISInput::initV4L(UsageEnvironment& env) {
 	printErr(env, "VIDIOC_QUERYBUF");
 	break;
       }
-      buffers[buf.index].addr
+      if (j == 0) noteVideoTimestampClock(buf.flags);
+      fBuffers[buf.index].addr
 	= (unsigned char *)mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED,
 				fOurVideoFileNo, buf.m.offset);
-      if (buffers[buf.index].addr == MAP_FAILED) {
+      if (fBuffers[buf.index].addr == MAP_FAILED) {
 	printErr(env, "mmap() failed");
 	break;
       }
-      buffers[buf.index].length = buf.length;
+      fBuffers[buf.index].length = buf.length;
+      ++fNumBuffers;
     }
     if (j < req.count) break; // an error occurred
     
-    capture_start = 1;
+    fCaptureStart = True;
+
+    return True;
+  } while (0);
+
+  // An error occurred:
+  return False;
+}
+
+void WISInput::noteVideoTimestampClock(unsigned bufferFlags) {
+  // Put our audio clock in the same time domain as the video buffers' timestamps
+  // before we capture any audio, so that its presentation times never jump.
+  // (Drivers that don't say which clock they use call "gettimeofday()".)
+  fAudioClock.setVideoClockIsMonotonic((bufferFlags&V4L2_BUF_FLAG_TIMESTAMP_MASK)
+				       == V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC);
+}
+
+// The options that "openFiles()", "initALSA()" and "initV4L()" set a device up with:
+static void getDeviceSettings(int* settings) {
+  unsigned i = 0;
+  settings[i++] = videoFormat;
+  settings[i++] = videoWidth;
+  settings[i++] = videoHeight;
+  settings[i++] = videoBitrate;
+  settings[i++] = videoQuant;
+  settings[i++] = videoGopsize;
+  settings[i++] = videoBframe;
+  settings[i++] = (int)videoType;
+  settings[i++] = (int)(videoType>>32);
+  settings[i++] = videoInputDeviceNumber;
+  settings[i++] = videoFrameRateNumerator;
+  settings[i++] = videoFrameRateDenominator;
+  settings[i++] = videoInputBrightness;
+  settings[i++] = videoInputContrast;
+  settings[i++] = videoInputSaturation;
+  settings[i++] = videoInputHue;
+  settings[i++] = tvFreq;
+  settings[i++] = audioCaptureSamplingFrequency;
+  settings[i++] = audioCaptureNumChannels;
+  // i == NUM_DEVICE_SETTINGS
+}
+
+Boolean WISInput::takeOverDevice(UsageEnvironment& env,
+				 WISInputHandoverState const& handoverState) {
+  do {
+    // We can't change how the device was set up (without re-initializing it):
+    int settings[NUM_DEVICE_SETTINGS];
+    getDeviceSettings(settings);
+    if (memcmp(settings, handoverState.deviceSettings, sizeof settings) != 0) {
+      err(env) << "The running instance's device was set up with different video or audio parameters\n";
+      break;
+    }
+    if (handoverState.numBuffers == 0 || handoverState.numBuffers > MAX_BUFFERS
+	|| handoverState.videoDeviceNum < 0 || handoverState.videoDeviceNum >= 32) {
+      err(env) << "Invalid video device state from the running instance\n";
+      break;
+    }
+
+    // Use our own copies of the device's (already open) file descriptors:
+    fOurVideoFileNo = dup(handoverState.videoFileNo);
+    if (fOurVideoFileNo < 0) {
+      printErr(env, "Unable to take over the video device");
+      break;
+    }
+    fVideoDeviceNum = handoverState.videoDeviceNum;
+    videoDevicesInUse |= 1<<fVideoDeviceNum;
+    if (handoverState.audioFileNo >= 0
+	&& (fOurAudioFileNo = dup(handoverState.audioFileNo)) < 0) {
+      printErr(env, "Unable to take over the audio device");
+      break;
+    }
+
+    // Map each of the driver's buffers into this process's memory, as the other
+    // process did.  (They're already allocated, and possibly queued.)
+    unsigned j;
+    for (j = 0; j < handoverState.numBuffers; ++j) {
+      fBuffers[j].addr
+	= (unsigned char *)mmap(NULL, handoverState.buffers[j].length,
+				PROT_READ | PROT_WRITE, MAP_SHARED,
+				fOurVideoFileNo, handoverState.buffers[j].offset);
+      if (fBuffers[j].addr == MAP_FAILED) {
+	printErr(env, "mmap() failed");
+	break;
+      }
+      fBuffers[j].length = handoverState.buffers[j].length;
+      ++fNumBuffers;
+    }
+    if (j < handoverState.numBuffers) break; // an error occurred
+
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof buf);
+    buf.index = 0;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(fOurVideoFileNo, VIDIOC_QUERYBUF, &buf) == 0) {
+      noteVideoTimestampClock(buf.flags);
+    }
+
+    fCaptureStart = !handoverState.captureStarted;
+    fHaveVideoSequence = handoverState.haveVideoSequence;
+    fLastVideoSequence = handoverState.lastVideoSequence;
 
     return True;
   } while (0);
@@ -552,6 +930,28 @@ Boolean WISInput::initV4L(UsageEnvironment& env) {
   return False;
 }
 
+Boolean WISInput::setEncoderBitrate(int bitrate) {
+#ifndef NEW_BITRATE_SETTING_CODE
+  return ioctl(fOurVideoFileNo, GO7007IOC_S_BITRATE, &bitrate) == 0;
+#else
+  struct v4l2_mpeg_compression compression;
+  memset(&compression, 0, sizeof compression);
+  if( videoQuant != 0) {
+    compression.st_bitrate.mode = V4L2_BITRATE_VBR;
+    compression.st_bitrate.max = videoQuant;
+    compression.st_bitrate.min = videoQuant;
+    compression.st_bitrate.target = 0;
+  }
+  else {
+    compression.st_bitrate.mode = V4L2_BITRATE_CBR;
+    compression.st_bitrate.max = bitrate/1000;
+    compression.st_bitrate.min = bitrate/1000;
+    compression.st_bitrate.target = bitrate/1000;
+  }
+  return ioctl(fOurVideoFileNo, VIDIOC_S_MPEGCOMP, &compression) == 0;
+#endif
+}
+
 void WISInput::listVideoInputDevices(UsageEnvironment& env) {
   env << "Input devices available:\n";
   for (int i = 0; ; ++i) {
@@ -572,29 +972,677 @@ void WISInput::listVideoInputDevices(UsageEnvironment& env) {
   }
 }
 
-Boolean WISInput::fHaveInitialized = False;
-int WISInput::fOurVideoFileNo = -1;
-FramedSource* WISInput::fOurVideoSource = NULL;
-int WISInput::fOurAudioFileNo = -1;
-FramedSource* WISInput::fOurAudioSource = NULL;
+Boolean WISInput::startVideoCapture(char const*& failedOperation) {
+  // Queue all of our buffers for frame capture:
+  struct v4l2_buffer buf;
+  for (unsigned i = 0; i < fNumBuffers; ++i) {
+    memset(&buf, 0, sizeof buf);
+    buf.index = i;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(fOurVideoFileNo, VIDIOC_QBUF, &buf) < 0) {
+      failedOperation = "VIDIOC_QBUF";
+      return False;
+    }
+  }
+
+  // Start capturing:
+  int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  if (ioctl(fOurVideoFileNo, VIDIOC_STREAMON, &type) < 0) {
+    failedOperation = "VIDIOC_STREAMON";
+    return False;
+  }
+
+  fCaptureStart = False;
+  return True;
+}
+
+Boolean WISInput::dequeueVideoFrame(CapturedFrame& frame, char const*& failedOperation) {
+  // Retrieve a filled video buffer from the kernel:
+  struct v4l2_buffer buf;
+  memset(&buf, 0, sizeof buf);
+  buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  buf.memory = V4L2_MEMORY_MMAP;
+  if (ioctl(fOurVideoFileNo, VIDIOC_DQBUF, &buf) < 0) {
+    failedOperation = "VIDIOC_DQBUF";
+    return False;
+  }
+
+  // Use the buffer's sequence number to detect frames that the driver dropped
+  // (because all of its buffers were full):
+  if (fHaveVideoSequence) {
+    unsigned gap = buf.sequence - (fLastVideoSequence + 1);
+    if (gap < 0x80000000) fNumDroppedVideoFrames += gap; // else, the counter went backwards
+  }
+  fLastVideoSequence = buf.sequence;
+  fHaveVideoSequence = True;
+  ++fNumCapturedVideoFrames;
+
+  // Keep our audio clock in the same time domain as the video timestamps:
+  fAudioClock.noteVideoTimestamp(buf.timestamp);
+
+  // If we've been asked to change the encoder's bitrate, do so now, if this frame
+  // starts a new GOP (so that the whole of the next GOP is at the new bitrate):
+  if (fPendingVideoBitrate != 0
+      && (videoFormat == VFMT_MJPEG || (buf.flags&V4L2_BUF_FLAG_KEYFRAME) != 0)) {
+    unsigned bitrate = __sync_lock_test_and_set(&fPendingVideoBitrate, 0);
+    if (bitrate != 0) {
+      if (setEncoderBitrate(bitrate)) {
+	fCurrentVideoBitrate = bitrate;
+      } else {
+	++fNumFailedBitrateChanges; // e.g., the driver won't change it while streaming
+      }
+    }
+  }
+
+  frame.data = fBuffers[buf.index].addr;
+  frame.size = buf.bytesused;
+  frame.presentationTime = buf.timestamp;
+  frame.bufferIndex = buf.index;
+  return True;
+}
+
+Boolean WISInput::requeueVideoBuffer(unsigned bufferIndex) {
+  struct v4l2_buffer buf;
+  memset(&buf, 0, sizeof buf);
+  buf.index = bufferIndex;
+  buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+  buf.memory = V4L2_MEMORY_MMAP;
+  return ioctl(fOurVideoFileNo, VIDIOC_QBUF, &buf) == 0;
+}
+
+static void advanceAudioPresentationTime(struct timeval& presentationTime,
+					 unsigned numBytes) {
+  unsigned uSeconds = (unsigned)((numBytes*1000000.0)
+				 /(audioCaptureSamplingFrequency*audioCaptureNumChannels*2));
+  presentationTime.tv_usec += uSeconds;
+  presentationTime.tv_sec += presentationTime.tv_usec/1000000;
+  presentationTime.tv_usec %= 1000000;
+}
+
+Boolean WISInput::startCapturing(Boolean isVideo) {
+  if (fCaptureIsSuspended) return False; // we're handing our device over
+
+  if (isVideo) {
+    if (fCaptureVideo) return True; // already capturing
+    char const* failedOperation;
+    if (fReplayer == NULL && fCaptureStart && !startVideoCapture(failedOperation)) {
+      printErr(envir(), failedOperation);
+      return False;
+    }
+    fCaptureVideo = True;
+  } else {
+    if (fCaptureAudio) return True; // already capturing
+#ifdef HAVE_ALSA
+    int ret;
+    if (fPCM != NULL && (ret = snd_pcm_start(fPCM)) < 0) {
+      err(envir()) << "snd_pcm_start failed: " << snd_strerror(ret) << "\n";
+      return False;
+    }
+#endif
+    fCaptureAudio = True;
+  }
+  if (fReplayer != NULL) {
+    startReplaying(isVideo);
+    return True;
+  }
+  if (!useCaptureThread) return True;
+
+  if (!fCaptureThreadIsRunning) return startCaptureThread();
+
+  wakeUp(fWakeupEventFd); // so that the thread notices the new stream
+  return True;
+}
+
+Boolean WISInput::startCaptureThread() {
+  if (pthread_create(&fCaptureThread, NULL, captureThreadMain, this) != 0) {
+    err(envir()) << "Failed to create the capture thread\n";
+    return False;
+  }
+  fCaptureThreadIsRunning = True;
+  return True;
+}
+
+void* WISInput::captureThreadMain(void* clientData) {
+  ((WISInput*)clientData)->captureThreadLoop();
+  return NULL;
+}
+
+void WISInput::captureThreadLoop() {
+  while (!fStopCaptureThread) {
+    // Wait until we have video and/or audio data to capture (or are woken up):
+    struct pollfd fds[3];
+    unsigned numFds = 0;
+    int videoFdIndex = -1, audioFdIndex = -1;
+    fds[numFds].fd = fWakeupEventFd; fds[numFds++].events = POLLIN;
+    if (fCaptureVideo) {
+      videoFdIndex = numFds;
+      fds[numFds].fd = fOurVideoFileNo; fds[numFds++].events = POLLIN;
+    }
+    if (fCaptureAudio) {
+      audioFdIndex = numFds;
+      fds[numFds].fd = fOurAudioFileNo; fds[numFds++].events = POLLIN;
+    }
+    if (poll(fds, numFds, -1) < 0) continue; // e.g., EINTR
+
+    if (fds[0].revents & POLLIN) {
+      u_int64_t count;
+      read(fWakeupEventFd, &count, sizeof count);
+    }
+    if (videoFdIndex >= 0 && fds[videoFdIndex].revents != 0) {
+      if (fds[videoFdIndex].revents & POLLIN) {
+	captureVideoFrames(True);
+      } else {
+	// All of the driver's buffers are held downstream.  Wait for some to be released:
+	usleep(10000);
+      }
+    }
+    if (audioFdIndex >= 0 && (fds[audioFdIndex].revents & POLLIN)) {
+      captureAudioData(True);
+    }
+  }
+}
+
+void WISInput::captureVideoFrames(Boolean dropIfRingIsFull) {
+  // Dequeue every buffer that the driver has filled (until it tells us "EAGAIN").
+  // If "dropIfRingIsFull", then we can't let the driver stall, so frames that don't
+  // fit in the ring are dropped; otherwise, we stop once the ring is full:
+  unsigned numCaptured = 0;
+  while (dropIfRingIsFull || !fVideoRing->isFull()) {
+    CapturedFrame frame;
+    char const* failedOperation;
+    if (!dequeueVideoFrame(frame, failedOperation)) {
+      if (errno != EAGAIN) ++fNumCaptureErrors;
+      break;
+    }
+
+    CapturedFrame* slot = fVideoRing->producerSlot();
+    if (slot == NULL) {
+      // Our reader isn't keeping up.  Drop this frame (giving its buffer back):
+      fVideoRing->noteOverrun();
+      if (!requeueVideoBuffer(frame.bufferIndex)) ++fNumCaptureErrors;
+      continue;
+    }
+    *slot = frame;
+    fVideoRing->produce();
+    ++numCaptured;
+  }
+  if (numCaptured > fMaxVideoFramesPerBatch) fMaxVideoFramesPerBatch = numCaptured;
+
+  if (numCaptured > 0 && fVideoEventFd >= 0) wakeUp(fVideoEventFd);
+}
+
+void WISInput::captureAudioData(Boolean dropIfRingIsFull) {
+#ifdef HAVE_ALSA
+  if (fPCM != NULL) {
+    captureALSAData(dropIfRingIsFull);
+    return;
+  }
+#endif
+
+  // Use the amount of data that's buffered to measure when it was captured (to
+  // discipline our audio clock).  Each chunk's presentation time then comes from
+  // the clock:
+  double const secondsPerByte = 1.0/(audioCaptureSamplingFrequency*audioCaptureNumChannels*2);
+  double now = AudioClock::monotonicNow();
+  audio_buf_info info;
+  Boolean haveBufferedBytes
+    = ioctl(fOurAudioFileNo, SNDCTL_DSP_GETISPACE, &info) == 0 && info.bytes > 0;
+  if (haveBufferedBytes) fAudioClock.noteCaptureTime(now - info.bytes*secondsPerByte);
+
+  // Read all available data (until the device tells us "EAGAIN"):
+  unsigned char discardBuffer[AUDIO_CAPTURE_CHUNK_SIZE];
+  unsigned numCaptured = 0;
+  Boolean isFirstChunk = True;
+  while (dropIfRingIsFull || !fAudioRing->isFull()) {
+    CapturedFrame* slot = fAudioRing->producerSlot();
+    unsigned char* to = slot == NULL ? discardBuffer : slot->data;
+
+    int ret = read(fOurAudioFileNo, to, AUDIO_CAPTURE_CHUNK_SIZE);
+    if (ret <= 0) break;
+
+    if (isFirstChunk && !haveBufferedBytes) {
+      // We don't know how much was buffered, so assume that this chunk just ended:
+      fAudioClock.noteCaptureTime(AudioClock::monotonicNow() - ret*secondsPerByte);
+    }
+    isFirstChunk = False;
+    struct timeval chunkPresentationTime = fAudioClock.presentationTime((unsigned)ret);
+
+    if (slot == NULL) {
+      // Our reader isn't keeping up.  Drop this data:
+      fAudioRing->noteOverrun();
+      continue;
+    }
+    slot->size = (unsigned)ret;
+    slot->presentationTime = chunkPresentationTime;
+    slot->bufferIndex = -1;
+    fAudioRing->produce();
+    ++numCaptured;
+  }
+
+  if (numCaptured > 0 && fAudioEventFd >= 0) wakeUp(fAudioEventFd);
+}
+
+#ifdef HAVE_ALSA
+void WISInput::captureALSAData(Boolean dropIfRingIsFull) {
+  snd_pcm_sframes_t avail = snd_pcm_avail_update(fPCM);
+  if (avail < 0) {
+    recoverFromALSAError((int)avail);
+    return;
+  }
+
+  // Measure when the oldest available frame was captured (to discipline our
+  // audio clock), using the time at which the hardware pointer was last updated
+  // (or, failing that, the current time).  The hardware timestamp is in the
+  // "gettimeofday()" domain, so convert it to CLOCK_MONOTONIC:
+  unsigned const bytesPerFrame = audioCaptureNumChannels*2;
+  double const secondsPerFrame = 1.0/audioCaptureSamplingFrequency;
+  double captureTime = AudioClock::monotonicNow();
+  snd_pcm_uframes_t availAtTimestamp;
+  snd_htimestamp_t timestamp;
+  if (snd_pcm_htimestamp(fPCM, &availAtTimestamp, &timestamp) == 0
+      && (timestamp.tv_sec != 0 || timestamp.tv_nsec != 0)) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    captureTime -= (now.tv_sec - timestamp.tv_sec)
+      + (now.tv_usec*1000 - timestamp.tv_nsec)/1000000000.0;
+  } else {
+    availAtTimestamp = avail;
+  }
+  fAudioClock.noteCaptureTime(captureTime - availAtTimestamp*secondsPerFrame);
+
+  // Copy all available frames (in chunks) directly from the PCM's mmap buffer:
+  unsigned numCaptured = 0;
+  while (avail > 0 && (dropIfRingIsFull || !fAudioRing->isFull())) {
+    snd_pcm_channel_area_t const* areas;
+    snd_pcm_uframes_t offset;
+    snd_pcm_uframes_t numFrames = AUDIO_CAPTURE_CHUNK_SIZE/bytesPerFrame;
+    if (numFrames > (snd_pcm_uframes_t)avail) numFrames = avail;
+    int ret = snd_pcm_mmap_begin(fPCM, &areas, &offset, &numFrames);
+    if (ret < 0) {
+      recoverFromALSAError(ret);
+      break;
+    }
+    unsigned numBytes = numFrames*bytesPerFrame;
+
+    struct timeval presentationTime = fAudioClock.presentationTime(numBytes);
+    CapturedFrame* slot = fAudioRing->producerSlot();
+    if (slot == NULL) {
+      // Our reader isn't keeping up.  Drop this data:
+      fAudioRing->noteOverrun();
+    } else {
+      memcpy(slot->data,
+	     (unsigned char*)areas[0].addr + (areas[0].first + offset*areas[0].step)/8,
+	     numBytes);
+      slot->size = numBytes;
+      slot->presentationTime = presentationTime;
+      slot->bufferIndex = -1;
+      fAudioRing->produce();
+      ++numCaptured;
+    }
+
+    snd_pcm_sframes_t numCommitted = snd_pcm_mmap_commit(fPCM, offset, numFrames);
+    if (numCommitted < 0 || (snd_pcm_uframes_t)numCommitted != numFrames) {
+      recoverFromALSAError(numCommitted < 0 ? (int)numCommitted : -EPIPE);
+      break;
+    }
+    avail -= numFrames;
+  }
+
+  if (numCaptured > 0 && fAudioEventFd >= 0) wakeUp(fAudioEventFd);
+}
+
+void WISInput::recoverFromALSAError(int errorCode) {
+  if (errorCode == -EAGAIN) return; // not really an error
+  if (errorCode == -EPIPE) {
+    ++fNumAudioXruns; // the PCM's buffer overflowed, because we didn't read it in time
+    fAudioClock.resync(); // because we lost data
+  } else {
+    ++fNumCaptureErrors;
+  }
+
+  // Restart capture:
+  if (snd_pcm_prepare(fPCM) < 0 || snd_pcm_start(fPCM) < 0) ++fNumCaptureErrors;
+}
+#endif
+
+void WISInput::wakeUp(int eventFd) {
+  u_int64_t one = 1;
+  write(eventFd, &one, sizeof one);
+}
+
+void WISInput::startReplaying(Boolean isVideo) {
+  // Each stream's replay timeline begins now:
+  if (isVideo) {
+    gettimeofday(&fVideoReplayStartTime, NULL);
+    replayVideo();
+  } else {
+    gettimeofday(&fAudioReplayStartTime, NULL);
+    fAudioClock.noteCaptureTime(AudioClock::monotonicNow());
+    replayAudio();
+  }
+}
+
+static struct timeval replayTime(struct timeval const& startTime, u_int64_t numUnits,
+				 u_int64_t unitsPerSecondNumerator,
+				 u_int64_t unitsPerSecondDenominator) {
+  // Returns the time (on a replay timeline) of unit (frame or byte) #"numUnits":
+  u_int64_t uSeconds = (numUnits*unitsPerSecondDenominator*1000000)/unitsPerSecondNumerator;
+  struct timeval result = startTime;
+  result.tv_sec += uSeconds/1000000;
+  result.tv_usec += uSeconds%1000000;
+  if (result.tv_usec >= 1000000) {
+    ++result.tv_sec;
+    result.tv_usec -= 1000000;
+  }
+  return result;
+}
+
+static int uSecondsUntil(struct timeval const& t) {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (t.tv_sec - now.tv_sec)*1000000 + (t.tv_usec - now.tv_usec);
+}
+
+// If we're replaying as fast as possible, but our reader has fallen behind,
+// we check again for room in our ring after this delay:
+#define REPLAY_RETRY_DELAY 1000 // us
+
+void WISInput::replayVideoHandler(void* clientData) {
+  WISInput* input = (WISInput*)clientData;
+  input->fVideoReplayTask = NULL;
+  input->replayVideo();
+}
+
+void WISInput::replayVideo() {
+  u_int64_t const framesPerSecondNumerator
+    = videoFrameRateNumerator > 0 ? videoFrameRateNumerator : 30000;
+  u_int64_t const framesPerSecondDenominator
+    = videoFrameRateDenominator > 0 ? videoFrameRateDenominator : 1001;
+
+  // Deliver each frame that's now due (or, if we're replaying as fast as possible,
+  // as many as fit in our ring).  Each frame's presentation time is its nominal time:
+  unsigned numReplayed = 0;
+  int uSecondsToDelay = 0;
+  while (1) {
+    struct timeval frameTime
+      = replayTime(fVideoReplayStartTime, fNumReplayedVideoFrames,
+		   framesPerSecondNumerator, framesPerSecondDenominator);
+    if (!replayAsFastAsPossible && (uSecondsToDelay = uSecondsUntil(frameTime)) > 0) break;
+
+    CapturedFrame* slot = fVideoRing->producerSlot();
+    if (slot == NULL) {
+      if (replayAsFastAsPossible) {
+	uSecondsToDelay = REPLAY_RETRY_DELAY;
+	break;
+      }
+      // Our reader isn't keeping up.  Like a capture device, drop this frame:
+      fVideoRing->noteOverrun();
+      ++fNumReplayedVideoFrames;
+      continue;
+    }
+
+    fReplayer->nextVideoFrame(slot->data, slot->size);
+    slot->presentationTime = frameTime;
+    slot->bufferIndex = -1; // our frames can't be lent
+    fVideoRing->produce();
+    ++fNumReplayedVideoFrames;
+    ++numReplayed;
+  }
+  if (numReplayed > 0) wakeUp(fVideoEventFd);
+
+  fVideoReplayTask
+    = envir().taskScheduler().scheduleDelayedTask(uSecondsToDelay, replayVideoHandler, this);
+}
+
+void WISInput::replayAudioHandler(void* clientData) {
+  WISInput* input = (WISInput*)clientData;
+  input->fAudioReplayTask = NULL;
+  input->replayAudio();
+}
+
+void WISInput::replayAudio() {
+  u_int64_t const bytesPerSecond = audioCaptureSamplingFrequency*audioCaptureNumChannels*2;
+
+  // Deliver each chunk that's now complete (or, if we're replaying as fast as
+  // possible, as many as fit in our ring).  Our audio clock timestamps them:
+  unsigned numReplayed = 0;
+  int uSecondsToDelay = 0;
+  while (1) {
+    struct timeval chunkEndTime
+      = replayTime(fAudioReplayStartTime, fNumReplayedAudioBytes + AUDIO_CAPTURE_CHUNK_SIZE,
+		   bytesPerSecond, 1);
+    if (!replayAsFastAsPossible && (uSecondsToDelay = uSecondsUntil(chunkEndTime)) > 0) break;
+
+    CapturedFrame* slot = fAudioRing->producerSlot();
+    if (slot == NULL) {
+      if (replayAsFastAsPossible) {
+	uSecondsToDelay = REPLAY_RETRY_DELAY;
+	break;
+      }
+      // Our reader isn't keeping up.  Like a capture device, drop this data:
+      unsigned char discardBuffer[AUDIO_CAPTURE_CHUNK_SIZE];
+      fReplayer->nextAudioChunk(discardBuffer, AUDIO_CAPTURE_CHUNK_SIZE);
+      fAudioClock.presentationTime(AUDIO_CAPTURE_CHUNK_SIZE);
+      fAudioRing->noteOverrun();
+      fNumReplayedAudioBytes += AUDIO_CAPTURE_CHUNK_SIZE;
+      continue;
+    }
+
+    fReplayer->nextAudioChunk(slot->data, AUDIO_CAPTURE_CHUNK_SIZE);
+    slot->size = AUDIO_CAPTURE_CHUNK_SIZE;
+    slot->presentationTime = fAudioClock.presentationTime(AUDIO_CAPTURE_CHUNK_SIZE);
+    slot->bufferIndex = -1;
+    fAudioRing->produce();
+    fNumReplayedAudioBytes += AUDIO_CAPTURE_CHUNK_SIZE;
+    ++numReplayed;
+  }
+  if (numReplayed > 0) wakeUp(fAudioEventFd);
+
+  fAudioReplayTask
+    = envir().taskScheduler().scheduleDelayedTask(uSecondsToDelay, replayAudioHandler, this);
+}
+
+Boolean WISInput::prepareHandover(WISInputHandoverState& handoverState) {
+  if (fReplayer != NULL) return False; // we have no device to hand over
+#ifdef HAVE_ALSA
+  if (fPCM != NULL) return False; // an ALSA PCM can't be shared with another process
+#endif
+
+  // Stop capturing, so that the set of buffers that we've dequeued from the driver
+  // stays fixed.  (We keep delivering whatever's already in our rings.)
+  fCaptureIsSuspended = True;
+  if (fOurVideoSource != NULL) ((WISOpenFileSource*)fOurVideoSource)->suspendCapture();
+  if (fOurAudioSource != NULL) ((WISOpenFileSource*)fOurAudioSource)->suspendCapture();
+  if (fCaptureThreadIsRunning) {
+    fStopCaptureThread = True;
+    wakeUp(fWakeupEventFd);
+    pthread_join(fCaptureThread, NULL);
+    fCaptureThreadIsRunning = False;
+    fStopCaptureThread = False;
+  }
+
+  memset(&handoverState, 0, sizeof handoverState);
+  handoverState.videoFileNo = fOurVideoFileNo;
+  handoverState.audioFileNo = fOurAudioFileNo;
+  handoverState.videoDeviceNum = fVideoDeviceNum;
+  getDeviceSettings(handoverState.deviceSettings);
+  handoverState.numBuffers = fNumBuffers;
+  for (unsigned i = 0; i < fNumBuffers; ++i) {
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof buf);
+    buf.index = i;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(fOurVideoFileNo, VIDIOC_QUERYBUF, &buf) < 0) {
+      printErr(envir(), "VIDIOC_QUERYBUF");
+      cancelHandover();
+      return False;
+    }
+    handoverState.buffers[i].offset = buf.m.offset;
+    handoverState.buffers[i].length = fBuffers[i].length;
+  }
+  handoverState.captureStarted = !fCaptureStart;
+  handoverState.haveVideoSequence = fHaveVideoSequence;
+  handoverState.lastVideoSequence = fLastVideoSequence;
+
+  return True;
+}
+
+void WISInput::cancelHandover() {
+  fCaptureIsSuspended = False;
+  if (useCaptureThread && (fCaptureVideo || fCaptureAudio)) startCaptureThread();
+  if (fOurVideoSource != NULL) {
+    ((WISOpenFileSource*)fOurVideoSource)->resumeCapture(fCaptureVideo);
+  }
+  if (fOurAudioSource != NULL) {
+    ((WISOpenFileSource*)fOurAudioSource)->resumeCapture(fCaptureAudio);
+  }
+}
+
+void WISInput::completeTakeover() {
+  if (fCaptureStart) return; // "startVideoCapture()" will queue all of our buffers
+
+  // The other process had dequeued some buffers (to deliver, or to lend).  It has
+  // now exited, so give them back to the driver to be filled in again:
+  unsigned numRequeued = 0;
+  for (unsigned i = 0; i < fNumBuffers; ++i) {
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof buf);
+    buf.index = i;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(fOurVideoFileNo, VIDIOC_QUERYBUF, &buf) == 0
+	&& (buf.flags&(V4L2_BUF_FLAG_QUEUED|V4L2_BUF_FLAG_DONE)) == 0
+	&& requeueVideoBuffer(i)) ++numRequeued;
+  }
+  envir() << "Took over " << fNumBuffers << " video capture buffers ("
+	  << numRequeued << " given back to the driver)\n";
+}
+
+void WISInput::changeVideoBitrate(unsigned bitrate) {
+  fPendingVideoBitrate = bitrate == fCurrentVideoBitrate ? 0 : bitrate;
+}
+
+void WISInput::enableVideoFrameLending() {
+  fVideoFrameLendingEnabled = videoZeroCopy;
+}
+
+Boolean WISInput::lentVideoFrame(unsigned char*& frameData, unsigned& frameSize) {
+  if (fLentBufferIndex < 0) return False;
+
+  frameData = fBuffers[fLentBufferIndex].addr;
+  frameSize = fLentVideoFrameSize;
+  return True;
+}
+
+void WISInput::releaseVideoFrame() {
+  if (fLentBufferIndex < 0) return;
+
+  // Send the buffer back to the kernel to be filled in again:
+  if (!requeueVideoBuffer(fLentBufferIndex)) printErr(envir(), "VIDIOC_QBUF");
+  fLentBufferIndex = -1;
+}
+
+unsigned WISInput::numFilledVideoBuffers() {
+  unsigned numFilled = 0;
+  for (unsigned i = 0; i < fNumBuffers; ++i) {
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof buf);
+    buf.index = i;
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(fOurVideoFileNo, VIDIOC_QUERYBUF, &buf) == 0
+	&& (buf.flags&V4L2_BUF_FLAG_DONE) != 0) ++numFilled;
+  }
+  return numFilled;
+}
+
+static void printRingStatistics(UsageEnvironment& env, char const* name,
+				CaptureRing const* ring) {
+  env << name << " capture ring: " << ring->occupancy() << "/" << ring->depth()
+      << " full (high-water mark " << ring->highWaterMark() << "), "
+      << ring->numOverruns() << " overruns\n";
+}
+
+void WISInput::printStatistics(UsageEnvironment& env) {
+  env << "Video frames: " << fNumLentVideoFrames << " lent (single-copy), "
+      << fNumCopiedVideoFrames << " copied\n";
+  if (fNumBuffers > 0) {
+    env << "Video capture: " << numFilledVideoBuffers() << "/" << fNumBuffers
+	<< " buffers filled and waiting (at most " << fMaxVideoFramesPerBatch
+	<< " dequeued at once); " << fNumCapturedVideoFrames << " frames captured, "
+	<< fNumDroppedVideoFrames << " dropped by the driver\n";
+  }
+  if (fVideoRing != NULL) printRingStatistics(env, "Video", fVideoRing);
+#ifdef HAVE_ALSA
+  if (fPCM != NULL) env << "Audio capture: " << fNumAudioXruns << " ALSA xruns\n";
+#endif
+  if (fOurAudioSource != NULL) {
+    env << "Audio clock: frequency correction " << fAudioClock.frequencyCorrection()*1e6
+	<< " ppm, last phase error " << fAudioClock.lastPhaseError()*1e6 << " us, "
+	<< fAudioClock.numResyncs() << " resyncs\n";
+  }
+  if (fAudioRing != NULL) printRingStatistics(env, "Audio", fAudioRing);
+  if (fNumCaptureErrors > 0) env << fNumCaptureErrors << " capture errors\n";
+  if (fBitrateController != NULL) {
+    env << "Video encoder bitrate: " << fCurrentVideoBitrate << " bps";
+    if (fNumFailedBitrateChanges > 0) {
+      env << " (" << fNumFailedBitrateChanges << " changes refused by the driver)";
+    }
+    env << "\n";
+    fBitrateController->printStatistics(env);
+  }
+}
 
 
 ////////// WISOpenFileSource implementation //////////
 
 WISOpenFileSource
-::WISOpenFileSource(UsageEnvironment& env, WISInput& input, int fileNo)
+::WISOpenFileSource(UsageEnvironment& env, WISInput& input, int fileNo,
+		    CaptureRing* ring, int ringEventFd)
   : FramedSource(env),
-    fInput(input), fFileNo(fileNo) {
+    fInput(input), fFileNo(fileNo), fRing(ring),
+    fReadyFd(ringEventFd >= 0 ? ringEventFd : fileNo),
+    fCapturesInEventLoop(ringEventFd < 0), fReadHandlingIsOn(False) {
 }
 
 WISOpenFileSource::~WISOpenFileSource() {
-  envir().taskScheduler().turnOffBackgroundReadHandling(fFileNo);
+  stopReadHandling();
+}
+
+void WISOpenFileSource::resumeReadHandling() {
+  if (fCapturesInEventLoop && canCapture()) startReadHandling();
+}
+
+void WISOpenFileSource::suspendCapture() {
+  if (fCapturesInEventLoop) stopReadHandling();
+}
+
+void WISOpenFileSource::resumeCapture(Boolean hadStarted) {
+  // If our reader has been waiting (perhaps for capture to start), then start again:
+  if (isCurrentlyAwaitingData()) {
+    doGetNextFrame();
+  } else if (hadStarted) {
+    resumeReadHandling();
+  }
+}
+
+Boolean WISOpenFileSource::canCapture() {
+  return !fInput.fCaptureIsSuspended && !fRing->isFull();
 }
 
 void WISOpenFileSource::doGetNextFrame() {
-  // Await the next incoming data on our FID:
-  envir().taskScheduler().turnOnBackgroundReadHandling(fFileNo,
-	       (TaskScheduler::BackgroundHandlerProc*)&incomingDataHandler, this);
+  if (!startCapturing()) return;
+
+  // If our ring already holds data, deliver it now:
+  Boolean delivered = deliverFromRing();
+
+  // Make sure that we're watching for more data (unless we capture it ourselves,
+  // and have nowhere to put it):
+  if (!fCapturesInEventLoop || canCapture()) startReadHandling();
+
+  if (delivered) afterGetting(this);
 }
 
 void WISOpenFileSource
@@ -603,14 +1651,40 @@ void WISOpenFileSource
 }
 
 void WISOpenFileSource::incomingDataHandler1() {
-  // Read the data from our file into the client's buffer:
-  readFromFile();
+  if (fCapturesInEventLoop) {
+    // Capture everything that's available now.  If that leaves us with nowhere
+    // to put more data, stop watching our file until our reader has caught up:
+    captureAvailableData();
+    if (!canCapture()) stopReadHandling();
+  } else {
+    // Our input's capture thread has added to our ring.  Reset the ring's event fd:
+    u_int64_t count;
+    read(fReadyFd, &count, sizeof count);
+  }
+
+  // If our reader is waiting, tell it that we have new data:
+  if (isCurrentlyAwaitingData() && deliverFromRing()) afterGetting(this);
+}
+
+void WISOpenFileSource::startReadHandling() {
+  if (fReadHandlingIsOn) return;
+  envir().taskScheduler().turnOnBackgroundReadHandling(fReadyFd,
+	       (TaskScheduler::BackgroundHandlerProc*)&incomingDataHandler, this);
+  fReadHandlingIsOn = True;
+}
+
+void WISOpenFileSource::stopReadHandling() {
+  if (!fReadHandlingIsOn) return;
+  envir().taskScheduler().turnOffBackgroundReadHandling(fReadyFd);
+  fReadHandlingIsOn = False;
+}
 
-  // Stop handling any more input, until we're ready again:
-  envir().taskScheduler().turnOffBackgroundReadHandling(fFileNo);
+Boolean WISOpenFileSource::deliverFromRing() {
+  CapturedFrame* frame = fRing->consumerSlot();
+  if (frame == NULL) return False;
 
-  // Tell our client that we have new data:
-  afterGetting(this);
+  if (deliverFrame(*frame)) fRing->consume();
+  return True;
 }
 
 
@@ -618,50 +1692,44 @@ void WISOpenFileSource::incomingDataHandler1() {
 
 WISVideoOpenFileSource
 ::WISVideoOpenFileSource(UsageEnvironment& env, WISInput& input)
-  : WISOpenFileSource(env, input, input.fOurVideoFileNo) {
+  : WISOpenFileSource(env, input, input.fOurVideoFileNo,
+		      input.fVideoRing, input.fVideoEventFd) {
 }
 
 WISVideoOpenFileSource::~WISVideoOpenFileSource() {
   fInput.fOurVideoSource = NULL;
 }
 
-void WISVideoOpenFileSource::readFromFile() {
-  // Retrieve a filled video buffer from the kernel:
-  unsigned i;  
-  struct v4l2_buffer buf;
+Boolean WISVideoOpenFileSource::startCapturing() {
+  return fInput.startCapturing(True);
+}
 
-  if (capture_start) {
-    capture_start = 0;
-    for (i = 0; i < MAX_BUFFERS; ++i) {
-      memset(&buf, 0, sizeof buf);
-      buf.index = i;
-      buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-      buf.memory = V4L2_MEMORY_MMAP;
-      if (ioctl(fFileNo, VIDIOC_QBUF, &buf) < 0) {
-        printErr(envir(), "VIDIOC_QBUF");
-        return;
-      }
-    }
-    
-    // Start capturing:
-    i = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-    if (ioctl(fFileNo, VIDIOC_STREAMON, &i) < 0) {
-      printErr(envir(), "VIDIOC_STREAMON");
-      return;
-    }
-  }
-  
-  memset(&buf, 0, sizeof buf);
-  buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-  buf.memory = V4L2_MEMORY_MMAP;
-  if (ioctl(fFileNo, VIDIOC_DQBUF, &buf) < 0) {
-    printErr(envir(), "VIDIOC_DQBUF");
-    return;
-  }
+void WISVideoOpenFileSource::captureAvailableData() {
+  fInput.captureVideoFrames(False);
+}
 
+Boolean WISVideoOpenFileSource::canCapture() {
+  // We also need the driver to have at least one buffer to fill.  (A lent
+  // buffer is always given back before we return to the event loop.)
+  return WISOpenFileSource::canCapture()
+    && fRing->occupancy() < fInput.fNumBuffers;
+}
+
+Boolean WISVideoOpenFileSource::deliverFrame(CapturedFrame& frame) {
   // Note the timestamp and size:
-  fPresentationTime = buf.timestamp;
-  fFrameSize = buf.bytesused;
+  fPresentationTime = frame.presentationTime;
+  fFrameSize = frame.size;
+
+  // If our reader accepts lent frames, then lend this one, rather than copying
+  // it.  (Our reader copies what it wants, and checks for truncation, itself.)
+  if (fInput.fVideoFrameLendingEnabled && frame.bufferIndex >= 0) {
+    ++fInput.fNumLentVideoFrames;
+    fInput.fLentBufferIndex = frame.bufferIndex;
+    fInput.fLentVideoFrameSize = fFrameSize;
+    fNumTruncatedBytes = 0;
+    return True; // the buffer gets requeued by "releaseVideoFrame()"
+  }
+
   if (fFrameSize > fMaxSize) {
     fNumTruncatedBytes = fFrameSize - fMaxSize;
     fFrameSize = fMaxSize;
@@ -670,13 +1738,14 @@ void WISVideoOpenFileSource::readFromFile() {
   }
 
   // Copy to the desired place:
-  memmove(fTo, buffers[buf.index].addr, fFrameSize);
+  memmove(fTo, frame.data, fFrameSize);
+  ++fInput.fNumCopiedVideoFrames;
 
   // Send the buffer back to the kernel to be filled in again:
-  if (ioctl(fFileNo, VIDIOC_QBUF, &buf) < 0) {
+  if (frame.bufferIndex >= 0 && !fInput.requeueVideoBuffer(frame.bufferIndex)) {
     printErr(envir(), "VIDIOC_QBUF");
-    return;
   }
+  return True;
 }
 
 
@@ -684,33 +1753,36 @@ void WISVideoOpenFileSource::readFromFile() {
 
 WISAudioOpenFileSource
 ::WISAudioOpenFileSource(UsageEnvironment& env, WISInput& input)
-  : WISOpenFileSource(env, input, input.fOurAudioFileNo) {
+  : WISOpenFileSource(env, input, input.fOurAudioFileNo,
+		      input.fAudioRing, input.fAudioEventFd) {
 }
 
 WISAudioOpenFileSource::~WISAudioOpenFileSource() {
   fInput.fOurAudioSource = NULL;
 }
 
-void WISAudioOpenFileSource::readFromFile() {
-  // Read available audio data:
-  int timeinc;
-  int ret = read(fInput.fOurAudioFileNo, fTo, fMaxSize);
-  if (ret < 0) ret = 0;
-  fFrameSize = (unsigned)ret;
-  gettimeofday(&fPresentationTime, NULL);
+Boolean WISAudioOpenFileSource::startCapturing() {
+  return fInput.startCapturing(False);
+}
 
-  /* PR#2665 fix from Robin
-   * Assuming audio format = AFMT_S16_LE
-   * Get the current time
-   * Substract the time increment of the audio oss buffer, which is equal to
-   * buffer_size / channel_number / sample_rate / sample_size ==> 400+ millisec
-   */
-  timeinc = fFrameSize * 1000 / audioNumChannels / (audioSamplingFrequency/1000) / 2;
-  while (fPresentationTime.tv_usec < timeinc)
-  {
-    fPresentationTime.tv_sec -= 1;
-    timeinc -= 1000000;
-  }
-  fPresentationTime.tv_usec -= timeinc;
+void WISAudioOpenFileSource::captureAvailableData() {
+  fInput.captureAudioData(False);
 }
 
+Boolean WISAudioOpenFileSource::deliverFrame(CapturedFrame& frame) {
+  // Deliver as much of the chunk as our client has room for:
+  fFrameSize = frame.size < fMaxSize ? frame.size : fMaxSize;
+  fNumTruncatedBytes = 0;
+  memmove(fTo, frame.data, fFrameSize);
+
+  // Our chunk's presentation time is that of its first sample.  (It was
+  // computed, from the amount of data buffered, when the chunk was captured.)
+  fPresentationTime = frame.presentationTime;
+
+  // Advance past what we delivered, in case our client didn't take it all:
+  frame.data += fFrameSize;
+  frame.size -= fFrameSize;
+  advanceAudioPresentationTime(frame.presentationTime, fFrameSize);
+
+  return frame.size == 0;
+}
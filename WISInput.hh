@@ -23,32 +23,202 @@
 #define _WIS_INPUT_HH
 
 #include <MediaSink.hh>
+#include <pthread.h>
+#ifndef _CAPTURE_RING_HH
+#include "CaptureRing.hh"
+#endif
+#ifndef _AUDIO_CLOCK_HH
+#include "AudioClock.hh"
+#endif
+#ifdef HAVE_ALSA
+#include <alsa/asoundlib.h>
+#endif
+
+class CaptureReplayer; // forward
+class BitrateController; // forward
+
+#define MAX_BUFFERS     32 // the most that we'll use, whatever "-vbuffers" asks for
+
+// The options that a capture device is set up with.  A device can be handed over
+// to another process only if that process would set it up in the same way:
+#define NUM_DEVICE_SETTINGS 19
+
+// What's needed for another process to take over our capture device, without
+// re-initializing it.  (This is sent over a Unix socket; see "Handover.hh".)
+struct WISInputHandoverState {
+  int videoFileNo, audioFileNo; // -1 if none
+  int videoDeviceNum;
+  int deviceSettings[NUM_DEVICE_SETTINGS];
+  unsigned numBuffers;
+  struct {
+    unsigned offset, length;
+  } buffers[MAX_BUFFERS]; // the layout of the driver's memory-mapped buffers
+  Boolean captureStarted; // i.e., VIDIOC_STREAMON has been done
+  Boolean haveVideoSequence;
+  unsigned lastVideoSequence;
+};
 
 class WISInput: public Medium {
 public:
-  static WISInput* createNew(UsageEnvironment& env);
+  static WISInput* createNew(UsageEnvironment& env, char const* deviceName = NULL);
+      // "deviceName" selects a GO7007 device by its sysfs path or USB address
+      // (e.g., "1-2.3").  If NULL, the first GO7007 device not already in use is chosen.
+  static WISInput* createNew(UsageEnvironment& env, char const* deviceName,
+			     WISInputHandoverState const& handoverState);
+      // takes over a device that another process has handed over to us
+      // (The file descriptors in "handoverState" are duplicated, not adopted.)
+
+  // Handing our device over to another process:
+  Boolean prepareHandover(WISInputHandoverState& handoverState);
+      // stops capturing, and describes our device
+  void cancelHandover(); // resumes capturing, if the other process didn't take over
+  void completeTakeover();
+      // called (by the other process) once we've exited; gives the driver back
+      // the buffers that we had dequeued
 
   FramedSource* videoSource();
   FramedSource* audioSource();
+      // at "audioSamplingFrequency" and "audioNumChannels".  If we capture at
+      // "audioCaptureSamplingFrequency" and "audioCaptureNumChannels" instead,
+      // each call returns a new converting filter, which the caller must close
+
+  // Single-copy access to captured video frames.  Once a downstream object has
+  // called "enableVideoFrameLending()", each frame that it gets from
+  // "videoSource()" is left in the driver's memory-mapped buffer ('lent'),
+  // rather than being copied into the object's own buffer.  The object copies
+  // what it wants directly from there, then - before returning from its
+  // 'after getting' function - calls "releaseVideoFrame()", to give the
+  // buffer back to the driver.
+  void enableVideoFrameLending();
+  Boolean lentVideoFrame(unsigned char*& frameData, unsigned& frameSize);
+      // returns True iff the most recently delivered video frame was lent
+  void releaseVideoFrame();
+
+  unsigned numLentVideoFrames() const { return fNumLentVideoFrames; }
+  unsigned numCopiedVideoFrames() const { return fNumCopiedVideoFrames; }
+
+  // Video capture accounting:
+  unsigned numVideoBuffers() const { return fNumBuffers; }
+  unsigned numFilledVideoBuffers();
+      // the number of buffers that the driver has filled, but we haven't yet dequeued
+  unsigned numCapturedVideoFrames() const { return fNumCapturedVideoFrames; }
+  unsigned numDroppedVideoFrames() const { return fNumDroppedVideoFrames; }
+      // frames that the driver dropped (i.e., gaps in "v4l2_buffer.sequence")
+  void printStatistics(UsageEnvironment& env);
+
+  // Adaptive bitrate control (if "-ratecontrol" was given):
+  BitrateController* bitrateController() const { return fBitrateController; }
+  void changeVideoBitrate(unsigned bitrate);
+      // The new bitrate is applied when the encoder next starts a GOP.
+  unsigned currentVideoBitrate() const { return fCurrentVideoBitrate; }
 
 private:
-  WISInput(UsageEnvironment& env); // called only by createNew()
+  WISInput(UsageEnvironment& env, char const* deviceName); // called only by createNew()
   virtual ~WISInput();
 
-  static Boolean initialize(UsageEnvironment& env);
-  static Boolean openFiles(UsageEnvironment& env);
-  static Boolean initALSA(UsageEnvironment& env);
-  static Boolean initV4L(UsageEnvironment& env);
-  static void listVideoInputDevices(UsageEnvironment& env);
+  Boolean initialize(UsageEnvironment& env, WISInputHandoverState const* handoverState);
+  Boolean openFiles(UsageEnvironment& env);
+  Boolean takeOverDevice(UsageEnvironment& env, WISInputHandoverState const& handoverState);
+  Boolean initALSA(UsageEnvironment& env);
+#ifdef HAVE_ALSA
+  // Our (optional) native ALSA audio capture backend:
+  Boolean openALSAPCM(UsageEnvironment& env, int cardNum);
+  Boolean setALSAPCMParams(UsageEnvironment& env);
+  void captureALSAData(Boolean dropIfRingIsFull);
+  void recoverFromALSAError(int errorCode);
+#endif
+  Boolean initV4L(UsageEnvironment& env);
+  void noteVideoTimestampClock(unsigned bufferFlags);
+  Boolean setEncoderBitrate(int bitrate);
+  void listVideoInputDevices(UsageEnvironment& env);
+  Boolean deviceMatches(char const* videoDevicePath) const;
+
+  // Video capture, used either from the event loop or from our capture thread:
+  Boolean startVideoCapture(char const*& failedOperation);
+  Boolean dequeueVideoFrame(CapturedFrame& frame, char const*& failedOperation);
+  Boolean requeueVideoBuffer(unsigned bufferIndex);
+
+  // Capture everything that's currently available into our rings.  These are
+  // called from the event loop, or else from our (optional) capture thread:
+  Boolean startCapturing(Boolean isVideo);
+  Boolean startCaptureThread();
+  void captureVideoFrames(Boolean dropIfRingIsFull);
+  void captureAudioData(Boolean dropIfRingIsFull);
+
+  // Our (optional) replay backend, used instead of a capture device:
+  void startReplaying(Boolean isVideo);
+  static void replayVideoHandler(void* clientData);
+  static void replayAudioHandler(void* clientData);
+  void replayVideo();
+  void replayAudio();
+
+  // Our (optional) capture thread:
+  static void* captureThreadMain(void* clientData);
+  void captureThreadLoop();
+  static void wakeUp(int eventFd);
 
 private:
+  friend class WISOpenFileSource;
   friend class WISVideoOpenFileSource;
   friend class WISAudioOpenFileSource;
-  static Boolean fHaveInitialized;
-  static int fOurVideoFileNo;
-  static FramedSource* fOurVideoSource;
-  static int fOurAudioFileNo;
-  static FramedSource* fOurAudioSource;
+  char* fDeviceName;
+  int fVideoDeviceNum; // N, in "/dev/videoN"; -1 if not known
+  int fOurVideoFileNo;
+  FramedSource* fOurVideoSource;
+  int fOurAudioFileNo; // if we use ALSA directly, this is our PCM's poll descriptor
+  FramedSource* fOurAudioSource;
+#ifdef HAVE_ALSA
+  snd_pcm_t* fPCM; // non-NULL iff we use ALSA directly (rather than via OSS)
+  unsigned volatile fNumAudioXruns;
+#endif
+
+  // The driver's memory-mapped video capture buffers:
+  struct {
+    unsigned char *addr;
+    unsigned int length;
+  } fBuffers[MAX_BUFFERS];
+  unsigned fNumBuffers;
+  Boolean fCaptureStart;
+
+  // Captured video frames, and audio data, are queued in these rings until
+  // they're delivered.  If we have a capture thread, it fills the rings, and
+  // signals the corresponding event fds:
+  CaptureRing* fVideoRing;
+  CaptureRing* fAudioRing;
+  int fVideoEventFd, fAudioEventFd; // -1 if we don't have a capture thread
+  int fWakeupEventFd; // tells the capture thread to re-check its state
+  pthread_t fCaptureThread;
+  Boolean fCaptureThreadIsRunning;
+  Boolean volatile fCaptureVideo, fCaptureAudio, fStopCaptureThread;
+  unsigned volatile fNumCaptureErrors;
+  Boolean fCaptureIsSuspended; // while we're handing our device over to another process
+
+  // Video capture accounting; updated by whoever dequeues video frames:
+  Boolean fHaveVideoSequence;
+  unsigned fLastVideoSequence;
+  unsigned volatile fNumCapturedVideoFrames, fNumDroppedVideoFrames;
+  unsigned volatile fMaxVideoFramesPerBatch;
+
+  // Timestamps captured audio data; used by whoever captures audio and video:
+  AudioClock fAudioClock;
+
+  // State used if we're replaying (files, or synthetic data), rather than capturing.
+  // The replayed data is queued in our rings, and signalled using their event fds:
+  CaptureReplayer* fReplayer;
+  TaskToken fVideoReplayTask, fAudioReplayTask;
+  struct timeval fVideoReplayStartTime, fAudioReplayStartTime;
+  u_int64_t fNumReplayedVideoFrames, fNumReplayedAudioBytes;
+
+  // Adaptive bitrate control.  A bitrate change is applied by whoever dequeues
+  // video frames:
+  BitrateController* fBitrateController;
+  unsigned volatile fPendingVideoBitrate; // 0 if none
+  unsigned volatile fCurrentVideoBitrate, fNumFailedBitrateChanges;
+
+  Boolean fVideoFrameLendingEnabled;
+  int fLentBufferIndex; // the most recently delivered frame, if still lent; else -1
+  unsigned fLentVideoFrameSize;
+  unsigned fNumLentVideoFrames, fNumCopiedVideoFrames;
 };
 
 // Functions to set the optimal buffer size for RTP sink objects.
@@ -23,14 +23,16 @@
 #include "WISJPEGStreamSource.hh"
 
 WISJPEGStreamSource*
-WISJPEGStreamSource::createNew(FramedSource* inputSource) {
-  return new WISJPEGStreamSource(inputSource);
+WISJPEGStreamSource::createNew(FramedSource* inputSource, WISInput* frameLender) {
+  return new WISJPEGStreamSource(inputSource, frameLender);
 }
 
-WISJPEGStreamSource::WISJPEGStreamSource(FramedSource* inputSource)
+WISJPEGStreamSource::WISJPEGStreamSource(FramedSource* inputSource,
+					 WISInput* frameLender)
   : JPEGVideoSource(inputSource->envir()),
-    fLastWidth(0), fLastHeight(0) {
+    fFrameLender(frameLender), fLastWidth(0), fLastHeight(0) {
   fSource = inputSource;
+  if (fFrameLender != NULL) fFrameLender->enableVideoFrameLending();
 }
 
 WISJPEGStreamSource::~WISJPEGStreamSource() {
@@ -80,7 +82,11 @@ void WISJPEGStreamSource
 ::afterGettingFrame1(unsigned frameSize, unsigned numTruncatedBytes,
 		     struct timeval presentationTime,
 		     unsigned durationInMicroseconds) {
-  fFrameSize = frameSize < fMaxSize ? frameSize : fMaxSize;
+  // If the frame was lent to us, then parse it in place, rather than from "fBuffer":
+  unsigned char* frame = fBuffer;
+  Boolean frameIsLent = fFrameLender != NULL
+    && fFrameLender->lentVideoFrame(frame, frameSize);
+
   // NOTE: Change the following if the size of the encoder's JPEG hdr changes
   unsigned const JPEGHeaderSize = 524;
   
@@ -90,24 +96,24 @@ void WISJPEGStreamSource
   Boolean foundSOF0 = False;
   fLastQuantizationTableSize = 0;
   for (unsigned i = 0; i < JPEGHeaderSize-8; ++i) {
-    if (fBuffer[i] == 0xFF) {
-      if (fBuffer[i+1] == 0xDB) { // DQT
-	u_int16_t length = (fBuffer[i+2]<<8) | fBuffer[i+3];
+    if (frame[i] == 0xFF) {
+      if (frame[i+1] == 0xDB) { // DQT
+	u_int16_t length = (frame[i+2]<<8) | frame[i+3];
 	if (i+2 + length < JPEGHeaderSize) { // sanity check
 	  u_int16_t tableSize = length - 3;
 	  if (fLastQuantizationTableSize + tableSize > 128) { // sanity check
 	    tableSize = 128 - fLastQuantizationTableSize;
 	  }
 	  memmove(&fLastQuantizationTable[fLastQuantizationTableSize],
-		  &fBuffer[i+5], tableSize);
+		  &frame[i+5], tableSize);
 	  fLastQuantizationTableSize += tableSize;
 	  if (fLastQuantizationTableSize == 128 && foundSOF0) break;
 	      // we've found everything that we want
 	  i += length; // skip over table
 	}
-      } else if (fBuffer[i+1] == 0xC0) { // SOF0
-	fLastHeight = (fBuffer[i+5]<<5)|(fBuffer[i+6]>>3);
-	fLastWidth = (fBuffer[i+7]<<5)|(fBuffer[i+8]>>3);
+      } else if (frame[i+1] == 0xC0) { // SOF0
+	fLastHeight = (frame[i+5]<<5)|(frame[i+6]>>3);
+	fLastWidth = (frame[i+7]<<5)|(frame[i+8]>>3);
 	foundSOF0 = True;
 	if (fLastQuantizationTableSize == 128) break;
 	    // we've found everything that we want
@@ -124,9 +130,14 @@ void WISJPEGStreamSource
   }
   if (!foundSOF0) envir() << "Failed to find SOF0 marker in JPEG header!\n";
 
-  // Complete delivery to the client:
-  fFrameSize = fFrameSize > JPEGHeaderSize ? fFrameSize - JPEGHeaderSize : 0;
-  memmove(fTo, &fBuffer[JPEGHeaderSize], fFrameSize);
+  // Complete delivery to the client (truncating the frame, if it's too big):
+  fFrameSize = frameSize > JPEGHeaderSize ? frameSize - JPEGHeaderSize : 0;
+  if (fFrameSize > fMaxSize) {
+    numTruncatedBytes += fFrameSize - fMaxSize;
+    fFrameSize = fMaxSize;
+  }
+  memmove(fTo, &frame[JPEGHeaderSize], fFrameSize);
+  if (frameIsLent) fFrameLender->releaseVideoFrame();
   fNumTruncatedBytes = numTruncatedBytes;
   fPresentationTime = presentationTime;
   fDurationInMicroseconds = fDurationInMicroseconds;
@@ -33,10 +33,13 @@
 
 class WISJPEGStreamSource: public JPEGVideoSource {
 public:
-  static WISJPEGStreamSource* createNew(FramedSource* inputSource); 
+  static WISJPEGStreamSource* createNew(FramedSource* inputSource,
+					WISInput* frameLender = NULL);
+      // If "frameLender" is non-NULL, then "inputSource" must be its "videoSource()";
+      // frames will then be parsed directly from the capture device's buffers.
 
 private:
-  WISJPEGStreamSource(FramedSource* inputSource);
+  WISJPEGStreamSource(FramedSource* inputSource, WISInput* frameLender);
       // called only by createNew()
 
   virtual ~WISJPEGStreamSource();
@@ -61,6 +64,7 @@ private:
 
 private:
   FramedSource* fSource;
+  WISInput* fFrameLender;
   u_int8_t fLastWidth, fLastHeight; // actual dimensions /8
   u_int8_t fLastQuantizationTable[128];
   u_int16_t fLastQuantizationTableSize;
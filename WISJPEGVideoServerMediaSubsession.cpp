@@ -43,7 +43,7 @@ FramedSource* WISJPEGVideoServerMediaSubsession
   estBitrate = fEstimatedKbps;
 
   // Create a JPEG stream source (encapsulating the raw JPEG video source):
-  return WISJPEGStreamSource::createNew(fWISInput.videoSource());
+  return WISJPEGStreamSource::createNew(fWISInput.videoSource(), &fWISInput);
 }
 
 RTPSink* WISJPEGVideoServerMediaSubsession
@@ -51,5 +51,5 @@ RTPSink* WISJPEGVideoServerMediaSubsession
 		   unsigned char /*rtpPayloadTypeIfDynamic*/,
 		   FramedSource* /*inputSource*/) {
   setVideoRTPSinkBufferSize();
-  return JPEGVideoRTPSink::createNew(envir(), rtpGroupsock);
+  return monitorRTPSink(JPEGVideoRTPSink::createNew(envir(), rtpGroupsock));
 }
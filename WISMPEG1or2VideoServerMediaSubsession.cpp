@@ -58,5 +58,5 @@ RTPSink* WISMPEG1or2VideoServerMediaSubsession
 		   unsigned char /*rtpPayloadTypeIfDynamic*/,
 		   FramedSource* /*inputSource*/) {
   setVideoRTPSinkBufferSize();
-  return MPEG1or2VideoRTPSink::createNew(envir(), rtpGroupsock);
+  return monitorRTPSink(MPEG1or2VideoRTPSink::createNew(envir(), rtpGroupsock));
 }
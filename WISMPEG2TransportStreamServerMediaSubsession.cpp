@@ -75,7 +75,7 @@ RTPSink* WISMPEG2TransportStreamServerMediaSubsession
 		   unsigned char /*rtpPayloadTypeIfDynamic*/,
 		   FramedSource* /*inputSource*/) {
   setVideoRTPSinkBufferSize();
-  return SimpleRTPSink::createNew(envir(), rtpGroupsock,
-				  33, 90000, "video", "mp2t",
-				  1, True, False/*no 'M' bit*/);
+  return monitorRTPSink(SimpleRTPSink::createNew(envir(), rtpGroupsock,
+						 33, 90000, "video", "mp2t",
+						 1, True, False/*no 'M' bit*/));
 }
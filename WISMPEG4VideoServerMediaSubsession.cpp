@@ -98,5 +98,6 @@ RTPSink* WISMPEG4VideoServerMediaSubsession
 		   unsigned char rtpPayloadTypeIfDynamic,
 		   FramedSource* /*inputSource*/) {
   setVideoRTPSinkBufferSize();
-  return MPEG4ESVideoRTPSink::createNew(envir(), rtpGroupsock, rtpPayloadTypeIfDynamic);
+  return monitorRTPSink(MPEG4ESVideoRTPSink::createNew(envir(), rtpGroupsock,
+						       rtpPayloadTypeIfDynamic));
 }
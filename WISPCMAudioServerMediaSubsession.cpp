@@ -45,11 +45,11 @@ WISPCMAudioServerMediaSubsession::~WISPCMAudioServerMediaSubsession() {
 FramedSource* WISPCMAudioServerMediaSubsession
 ::createNewStreamSource(unsigned /*clientSessionId*/, unsigned& estBitrate) {
   estBitrate = fEstimatedKbps;
-  return createAudioSource(envir(), fWISInput.audioSource());
+  return createAudioSource(envir(), fWISInput.audioSource(), fWISInput.bitrateController());
 }
 
 RTPSink* WISPCMAudioServerMediaSubsession
 ::createNewRTPSink(Groupsock* rtpGroupsock, unsigned char rtpPayloadTypeIfDynamic,
 		   FramedSource* /*inputSource*/) {
-  return createAudioRTPSink(envir(), rtpGroupsock, rtpPayloadTypeIfDynamic);
+  return monitorRTPSink(createAudioRTPSink(envir(), rtpGroupsock, rtpPayloadTypeIfDynamic));
 }
@@ -21,6 +21,7 @@
 // Implementation
 
 #include "WISServerMediaSubsession.hh"
+#include "BitrateController.hh"
 
 WISServerMediaSubsession
 ::WISServerMediaSubsession(UsageEnvironment& env, WISInput& wisInput, unsigned estimatedBitrate)
@@ -31,3 +32,9 @@ WISServerMediaSubsession
 
 WISServerMediaSubsession::~WISServerMediaSubsession() {
 }
+
+RTPSink* WISServerMediaSubsession::monitorRTPSink(RTPSink* rtpSink) {
+  BitrateController* bitrateController = fWISInput.bitrateController();
+  if (bitrateController != NULL && rtpSink != NULL) bitrateController->addRTPSink(rtpSink);
+  return rtpSink;
+}
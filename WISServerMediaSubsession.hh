@@ -34,6 +34,9 @@ protected: // we're a virtual base class
 			   unsigned estimatedBitrate);
   virtual ~WISServerMediaSubsession();
 
+  RTPSink* monitorRTPSink(RTPSink* rtpSink);
+      // lets our input's bitrate controller (if any) see "rtpSink"'s receiver reports
+
 protected:
   WISInput& fWISInput;
   unsigned fEstimatedKbps;
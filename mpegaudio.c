@@ -26,6 +26,15 @@
 #include "mpegaudio.h"
 #include "mpegaudiocommon.h"
 
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define MPA_SIMD_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define MPA_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
 /*
  * @file mpegaudiodectab.h
  * mpeg audio layer decoder tables. 
@@ -266,7 +275,9 @@ const unsigned char *alloc_tables[5] =
 #define MUL(a,b) (((int64_t)(a) * (int64_t)(b)) >> FRAC_BITS)
 #define FIX(a)   ((int)((a) * (1 << FRAC_BITS)))
 
-#define SAMPLES_BUF_SIZE 4096
+/* a ring of the last 512 samples, stored twice so that the window
+   always reads them from 512 consecutive shorts */
+#define SAMPLES_BUF_SIZE (2 * 512)
 
 typedef struct MpegAudioContext {
     PutBitContext pb;
@@ -294,6 +305,149 @@ typedef struct MpegAudioContext {
 
 #include "mpegaudiotab.h"
 
+/* the 512-tap window: tmp[i] = the sum of p[i+64*k]*filter_bank[i+64*k],
+   k < 8, for i < 64 */
+static void filter_window_c(int *tmp, const short *p)
+{
+    const short *q = filter_bank;
+    int sum, i;
+
+    /* maxsum = 23169 */
+    for(i=0;i<64;i++) {
+        sum = p[0*64] * q[0*64];
+        sum += p[1*64] * q[1*64];
+        sum += p[2*64] * q[2*64];
+        sum += p[3*64] * q[3*64];
+        sum += p[4*64] * q[4*64];
+        sum += p[5*64] * q[5*64];
+        sum += p[6*64] * q[6*64];
+        sum += p[7*64] * q[7*64];
+        tmp[i] = sum;
+        p++;
+        q++;
+    }
+}
+
+/* The vector windows compute the same 32-bit sums as filter_window_c(),
+   so their output is bit-exact with it.  On x86, pmaddwd multiplies the
+   samples of rows k and k+1, interleaved, by filter_bank_pairs[] and adds
+   each pair of products; see filter_window_init() for its layout. */
+#ifdef MPA_SIMD_X86
+__attribute__((target("sse2")))
+static void filter_window_sse2(int *tmp, const short *p)
+{
+    const short *q;
+    __m128i a0, a1, b0, b1, s0, s1, s2, s3;
+    int i, k;
+
+    for(i=0;i<64;i+=16) {
+        s0 = s1 = s2 = s3 = _mm_setzero_si128();
+        q = filter_bank_pairs + 2*i;
+        for(k=0;k<8;k+=2) {
+            a0 = _mm_loadu_si128((const __m128i *)(p + k*64));
+            a1 = _mm_loadu_si128((const __m128i *)(p + k*64 + 8));
+            b0 = _mm_loadu_si128((const __m128i *)(p + (k+1)*64));
+            b1 = _mm_loadu_si128((const __m128i *)(p + (k+1)*64 + 8));
+            s0 = _mm_add_epi32(s0, _mm_madd_epi16(_mm_unpacklo_epi16(a0, b0),
+                                                  _mm_loadu_si128((const __m128i *)q)));
+            s1 = _mm_add_epi32(s1, _mm_madd_epi16(_mm_unpackhi_epi16(a0, b0),
+                                                  _mm_loadu_si128((const __m128i *)(q + 16))));
+            s2 = _mm_add_epi32(s2, _mm_madd_epi16(_mm_unpacklo_epi16(a1, b1),
+                                                  _mm_loadu_si128((const __m128i *)(q + 8))));
+            s3 = _mm_add_epi32(s3, _mm_madd_epi16(_mm_unpackhi_epi16(a1, b1),
+                                                  _mm_loadu_si128((const __m128i *)(q + 24))));
+            q += 2*64;
+        }
+        _mm_storeu_si128((__m128i *)(tmp + i), s0);
+        _mm_storeu_si128((__m128i *)(tmp + i + 4), s1);
+        _mm_storeu_si128((__m128i *)(tmp + i + 8), s2);
+        _mm_storeu_si128((__m128i *)(tmp + i + 12), s3);
+        p += 16;
+    }
+}
+
+__attribute__((target("avx2")))
+static void filter_window_avx2(int *tmp, const short *p)
+{
+    const short *q;
+    __m256i a, b, lo, hi;
+    int i, k;
+
+    for(i=0;i<64;i+=16) {
+        lo = hi = _mm256_setzero_si256();
+        q = filter_bank_pairs + 2*i;
+        for(k=0;k<8;k+=2) {
+            a = _mm256_loadu_si256((const __m256i *)(p + k*64));
+            b = _mm256_loadu_si256((const __m256i *)(p + (k+1)*64));
+            /* the unpacks work within 128-bit lanes: lo gets the pairs
+               of i..i+3 and i+8..i+11, hi those of i+4..i+7 and i+12..i+15 */
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b),
+                                                        _mm256_loadu_si256((const __m256i *)q)));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b),
+                                                        _mm256_loadu_si256((const __m256i *)(q + 16))));
+            q += 2*64;
+        }
+        _mm256_storeu_si256((__m256i *)(tmp + i), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)(tmp + i + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+        p += 16;
+    }
+}
+#endif
+
+#ifdef MPA_SIMD_NEON
+static void filter_window_neon(int *tmp, const short *p)
+{
+    const short *q = filter_bank;
+    int16x8_t a, c;
+    int32x4_t lo, hi;
+    int i, k;
+
+    for(i=0;i<64;i+=8) {
+        lo = hi = vdupq_n_s32(0);
+        for(k=0;k<8;k++) {
+            a = vld1q_s16(p + k*64);
+            c = vld1q_s16(q + k*64);
+            lo = vmlal_s16(lo, vget_low_s16(a), vget_low_s16(c));
+            hi = vmlal_s16(hi, vget_high_s16(a), vget_high_s16(c));
+        }
+        vst1q_s32(tmp + i, lo);
+        vst1q_s32(tmp + i + 4, hi);
+        p += 8;
+        q += 8;
+    }
+}
+#endif
+
+static void (*filter_window)(int *tmp, const short *p) = filter_window_c;
+
+/* call once filter_bank[] is set */
+static void filter_window_init(void)
+{
+    int i, j, k;
+
+    /* for each row pair k, k+1 and each group of 16 taps, the (row k,
+       row k+1) pairs of taps 0-3, 8-11, 4-7 and 12-15: the order in
+       which the 256-bit unpacks leave the samples */
+    for(k=0;k<8;k+=2) {
+        for(i=0;i<64;i++) {
+            j = (i & ~15) | (i & 3) | ((i & 4) << 1) | ((i & 8) >> 1);
+            filter_bank_pairs[k*64 + 2*j] = filter_bank[k*64 + i];
+            filter_bank_pairs[k*64 + 2*j + 1] = filter_bank[(k+1)*64 + i];
+        }
+    }
+
+#ifdef MPA_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        filter_window = filter_window_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        filter_window = filter_window_sse2;
+#endif
+#ifdef MPA_SIMD_NEON
+    filter_window = filter_window_neon; /* we were built for a CPU that has NEON */
+#endif
+}
+
 static int MPA_encode_init(AVCodecContext *avctx)
 {
     MpegAudioContext* s = (MpegAudioContext*)(avctx->priv_data);
@@ -357,6 +511,7 @@ static int MPA_encode_init(AVCodecContext *avctx)
 
     for(i=0;i<s->nb_channels;i++)
         s->samples_offset[i] = 0;
+    memset(s->samples_buf, 0, sizeof(s->samples_buf));
 
     for(i=0;i<257;i++) {
         int v;
@@ -370,6 +525,7 @@ static int MPA_encode_init(AVCodecContext *avctx)
         if (i != 0)
             filter_bank[512 - i] = v;
     }
+    filter_window_init();
 
     for(i=0;i<64;i++) {
         v = (int)(pow(2.0, (3 - i) / 3.0) * (1 << 20));
@@ -538,8 +694,8 @@ static void idct32(int *out, int *tab)
 
 static void filter(MpegAudioContext *s, int ch, short *samples, int incr)
 {
-    short *p, *q;
-    int sum, offset, i, j;
+    short *p;
+    int offset, i, j;
     int tmp[64];
     int tmp1[32];
     int *out;
@@ -549,44 +705,26 @@ static void filter(MpegAudioContext *s, int ch, short *samples, int incr)
     offset = s->samples_offset[ch];
     out = &s->sb_samples[ch][0][0][0];
     for(j=0;j<36;j++) {
-        /* 32 samples at once */
+        /* 32 samples at once, into both copies of the ring */
+        p = s->samples_buf[ch] + offset;
         for(i=0;i<32;i++) {
-            s->samples_buf[ch][offset + (31 - i)] = samples[0];
+            p[31 - i] = p[512 + 31 - i] = samples[0];
             samples += incr;
         }
 
         /* filter */
-        p = s->samples_buf[ch] + offset;
-        q = filter_bank;
-        /* maxsum = 23169 */
-        for(i=0;i<64;i++) {
-            sum = p[0*64] * q[0*64];
-            sum += p[1*64] * q[1*64];
-            sum += p[2*64] * q[2*64];
-            sum += p[3*64] * q[3*64];
-            sum += p[4*64] * q[4*64];
-            sum += p[5*64] * q[5*64];
-            sum += p[6*64] * q[6*64];
-            sum += p[7*64] * q[7*64];
-            tmp[i] = sum;
-            p++;
-            q++;
-        }
+        filter_window(tmp, p);
         tmp1[0] = tmp[16] >> WSHIFT;
         for( i=1; i<=16; i++ ) tmp1[i] = (tmp[i+16]+tmp[16-i]) >> WSHIFT;
         for( i=17; i<=31; i++ ) tmp1[i] = (tmp[i+16]-tmp[80-i]) >> WSHIFT;
 
         idct32(out, tmp1);
 
-        /* advance of 32 samples */
+        /* advance of 32 samples, wrapping around the ring */
         offset -= 32;
         out += 32;
-        /* handle the wrap around */
-        if (offset < 0) {
-            memmove(s->samples_buf[ch] + SAMPLES_BUF_SIZE - (512 - 32), 
-                    s->samples_buf[ch], (512 - 32) * 2);
-            offset = SAMPLES_BUF_SIZE - 512;
-        }
+        if (offset < 0)
+            offset += 512;
     }
     s->samples_offset[ch] = offset;
 
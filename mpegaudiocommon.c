@@ -55,7 +55,7 @@ void init_put_bits(PutBitContext *s, uint8_t *buffer, int buffer_size)
 //    memset(buffer, 0, buffer_size);
 #else
     s->buf_ptr = s->buf;
-    s->bit_left=32;
+    s->bit_left=64;
     s->bit_buf=0;
 #endif
 }
@@ -68,7 +68,7 @@ int get_bit_count(PutBitContext *s)
 #ifdef ALT_BITSTREAM_WRITER
     return s->index;
 #else
-    return (s->buf_ptr - s->buf) * 8 + 32 - s->bit_left;
+    return (s->buf_ptr - s->buf) * 8 + 64 - s->bit_left;
 #endif
 }
 
@@ -89,14 +89,15 @@ void flush_put_bits(PutBitContext *s)
 #ifdef ALT_BITSTREAM_WRITER
     align_put_bits(s);
 #else
-    s->bit_buf<<= s->bit_left;
-    while (s->bit_left < 32) {
+    if (s->bit_left < 64)
+        s->bit_buf<<= s->bit_left;
+    while (s->bit_left < 64) {
         /* XXX: should test end of buffer */
-        *s->buf_ptr++=s->bit_buf >> 24;
+        *s->buf_ptr++=s->bit_buf >> 56;
         s->bit_buf<<=8;
         s->bit_left+=8;
     }
-    s->bit_left=32;
+    s->bit_left=64;
     s->bit_buf=0;
 #endif
 }
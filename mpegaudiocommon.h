@@ -253,7 +253,7 @@ typedef struct PutBitContext {
     uint8_t *buf, *buf_end;
     int index;
 #else
-    uint32_t bit_buf;
+    uint64_t bit_buf;   /* the bits not yet written, in the low 64-bit_left bits */
     int bit_left;
     uint8_t *buf, *buf_ptr, *buf_end;
 #endif
@@ -329,9 +329,10 @@ static inline uint32_t unaligned32(const void *v) {
 #endif //!ARCH_X86
 
 #ifndef ALT_BITSTREAM_WRITER
+/* whole 64-bit words go to the buffer at a time, like PutBit() in AACEncoder/bitstream.h */
 static inline void put_bits(PutBitContext *s, int n, unsigned int value)
 {
-    unsigned int bit_buf;
+    uint64_t bit_buf;
     int bit_left;
 
 #ifdef STATS
@@ -343,26 +344,15 @@ static inline void put_bits(PutBitContext *s, int n, unsigned int value)
     bit_buf = s->bit_buf;
     bit_left = s->bit_left;
 
-    //    printf("n=%d value=%x cnt=%d buf=%x\n", n, value, bit_cnt, bit_buf);
-    /* XXX: optimize */
     if (n < bit_left) {
         bit_buf = (bit_buf<<n) | value;
         bit_left-=n;
     } else {
-	bit_buf<<=bit_left;
-        bit_buf |= value >> (n - bit_left);
-#ifdef UNALIGNED_STORES_ARE_BAD
-        if (3 & (int) s->buf_ptr) {
-            s->buf_ptr[0] = bit_buf >> 24;
-            s->buf_ptr[1] = bit_buf >> 16;
-            s->buf_ptr[2] = bit_buf >>  8;
-            s->buf_ptr[3] = bit_buf      ;
-        } else
-#endif
-        *(uint32_t *)s->buf_ptr = be2me_32(bit_buf);
-        //printf("bitbuf = %08x\n", bit_buf);
-        s->buf_ptr+=4;
-	bit_left+=32 - n;
+        bit_buf = (bit_buf<<bit_left) | (value >> (n - bit_left));
+        bit_buf = be2me_64(bit_buf);
+        memcpy(s->buf_ptr, &bit_buf, 8); /* unaligned stores are fine this way */
+        s->buf_ptr+=8;
+        bit_left+=64 - n;
         bit_buf = value;
     }
 
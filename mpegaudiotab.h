@@ -61,6 +61,8 @@ static const int bitinv32[32] = {
 
 
 static int16_t filter_bank[512];
+/* filter_bank[], with the rows k and k+1 (k even) of 64 taps interleaved */
+static int16_t filter_bank_pairs[512];
 
 static int scale_factor_table[64];
 #ifdef USE_FLOATS
@@ -27,6 +27,22 @@
 #include "UnicastStreaming.hh"
 #include "MulticastStreaming.hh"
 #include "DarwinStreaming.hh"
+#include "Handover.hh"
+
+// Our input devices (one per "-device" option; or else just one):
+static WISInput* inputDevices[MAX_INPUT_DEVICES];
+static unsigned numDevices = 0;
+
+static void reportStatistics(void* clientData) {
+  UsageEnvironment& env = *(UsageEnvironment*)clientData;
+
+  for (unsigned i = 0; i < numDevices; ++i) {
+    if (numDevices > 1) env << "Device #" << i << ": ";
+    inputDevices[i]->printStatistics(env);
+  }
+  env.taskScheduler().scheduleDelayedTask(statisticsReportInterval*1000000,
+					  (TaskFunc*)reportStatistics, &env);
+}
 
 int main(int argc, char** argv) {
   // Begin by setting up our usage environment:
@@ -44,45 +60,122 @@ int main(int argc, char** argv) {
   
   *env << "Initializing...\n";
 
-  // Initialize the WIS input device:
-  WISInput* inputDevice = WISInput::createNew(*env);
-  if (inputDevice == NULL) {
-    err(*env) << "Failed to create WIS input device\n";
-    exit(1);
+  // If we're restarting, take over the running instance's devices, rather than
+  // initializing them ourselves:
+  numDevices = numInputDevices > 0 ? numInputDevices : 1;
+  HandoverRequest* handover = NULL;
+  if (handoverSocketName != NULL) {
+    Boolean instanceIsRunning;
+    handover = HandoverRequest::createNew(*env, handoverSocketName, instanceIsRunning);
+    if (handover == NULL && instanceIsRunning) {
+      err(*env) << "Failed to take over from the running instance\n";
+      exit(1);
+    }
+    if (handover != NULL && handover->state().numDevices != numDevices) {
+      err(*env) << "The running instance has " << handover->state().numDevices
+		<< " input devices, not " << numDevices << "\n";
+      delete handover; // lets the running instance carry on
+      exit(1);
+    }
+  }
+
+  // Initialize the WIS input device(s):
+  for (unsigned i = 0; i < numDevices; ++i) {
+    char const* deviceName = numInputDevices > 0 ? inputDeviceNames[i] : NULL;
+    if (handover != NULL) {
+      inputDevices[i] = WISInput::createNew(*env, deviceName, handover->state().devices[i]);
+    } else {
+      inputDevices[i] = WISInput::createNew(*env, deviceName);
+    }
+    if (inputDevices[i] == NULL) {
+      err(*env) << "Failed to create WIS input device";
+      if (numInputDevices > 0) *env << " \"" << inputDeviceNames[i] << "\"";
+      *env << "\n";
+      delete handover;
+      exit(1);
+    }
   }
+  WISInput* inputDevice = inputDevices[0];
 
   // Create the RTSP server:
-  RTSPServer* rtspServer = NULL;
+  HandoverRTSPServer* rtspServer = NULL;
   if (streamingMode == STREAMING_UNICAST_THROUGH_DARWIN) {
     // Special case: Streaming through a Darwin Streaming Server:
     setupDarwinStreaming(*env, *inputDevice);
   } else {
     // Normal case: Streaming from a built-in RTSP server:
-    rtspServer = RTSPServer::createNew(*env, rtspServerPortNum, authDB);
+    // (If we're taking over from a running instance, then use its server's socket,
+    // so that no RTSP connection is refused while we restart.)
+    int handedOverSocket = -1;
+    if (handover != NULL && handover->state().rtspServerSocket >= 0) {
+      handedOverSocket = handover->state().rtspServerSocket;
+      if (handover->state().rtspServerPortNum != rtspServerPortNum) {
+	warn(*env) << "Using the running instance's RTSP server port ("
+		   << handover->state().rtspServerPortNum << ")\n";
+	rtspServerPortNum = handover->state().rtspServerPortNum;
+      }
+    }
+    rtspServer = HandoverRTSPServer::createNew(*env, rtspServerPortNum, authDB, handedOverSocket);
     if (rtspServer == NULL) {
       *env << "Failed to create RTSP server: " << env->getResultMsg() << "\n";
+      delete handover;
       exit(1);
     }
 
     *env << "...done initializing\n";
 
-    // Create a record describing the media to be streamed:
-    ServerMediaSession* sms
-      = ServerMediaSession::createNew(*env, "", NULL, streamDescription,
-				      streamingMode == STREAMING_MULTICAST_SSM);
-    rtspServer->addServerMediaSession(sms);
-    char *url = rtspServer->rtspURL(sms);
-    *env << "Play this stream using the URL:\n\t" << url << "\n";
-    delete[] url;
-
-    // Configure it for unicast or multicast streaming:
-    if (streamingMode == STREAMING_UNICAST) {
-      setupUnicastStreaming(*inputDevice, sms);
-    } else {
-      setupMulticastStreaming(*inputDevice, sms);
+    // Create a record describing the media to be streamed from each device.
+    // (If there's more than one device, each gets its own stream name.)
+    for (unsigned i = 0; i < numDevices; ++i) {
+      char streamName[30];
+      if (numDevices > 1) {
+	snprintf(streamName, sizeof streamName, "device%u", i);
+      } else {
+	streamName[0] = '\0';
+      }
+      ServerMediaSession* sms
+	= ServerMediaSession::createNew(*env, streamName, NULL, streamDescription,
+					streamingMode == STREAMING_MULTICAST_SSM);
+      rtspServer->addServerMediaSession(sms);
+      char *url = rtspServer->rtspURL(sms);
+      *env << "Play this stream using the URL:\n\t" << url << "\n";
+      delete[] url;
+
+      // Configure it for unicast or multicast streaming:
+      if (streamingMode == STREAMING_UNICAST) {
+	setupUnicastStreaming(*inputDevices[i], sms);
+      } else {
+	setupMulticastStreaming(*inputDevice, sms);
+      }
     }
   }
 
+  // If we're taking over from a running instance, then tell it to exit, and start
+  // using its devices:
+  if (handover != NULL) {
+    if (!handover->accept()) {
+      delete handover;
+      exit(1);
+    }
+    delete handover;
+    for (unsigned i = 0; i < numDevices; ++i) inputDevices[i]->completeTakeover();
+    *env << "...done taking over\n";
+  }
+
+  // Let our own successor take over from us, if desired:
+  HandoverListener* handoverListener = NULL;
+  if (handoverSocketName != NULL) {
+    handoverListener = HandoverListener::createNew(*env, handoverSocketName,
+						   inputDevices, numDevices, rtspServer);
+    if (handoverListener == NULL) warn(*env) << "Restarting will re-initialize our devices\n";
+  }
+
+  // Periodically report capture statistics, if requested:
+  if (statisticsReportInterval > 0) {
+    env->taskScheduler().scheduleDelayedTask(statisticsReportInterval*1000000,
+					     (TaskFunc*)reportStatistics, env);
+  }
+
   // Begin the LIVE555 event loop:
   env->taskScheduler().doEventLoop(); // does not return
 
@@ -90,8 +183,9 @@ int main(int argc, char** argv) {
   if (streamingMode != STREAMING_UNICAST && streamingMode != STREAMING_UNICAST_THROUGH_DARWIN) {
     reclaimMulticastStreaming();
   }
+  Medium::close(handoverListener);
   Medium::close(rtspServer); // will also reclaim "sms" and its "ServerMediaSubsession"s
-  Medium::close(inputDevice);
+  for (unsigned i = 0; i < numDevices; ++i) Medium::close(inputDevices[i]);
   reclaimArgs();
   env->reclaim();
   delete scheduler;